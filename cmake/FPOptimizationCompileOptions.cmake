@@ -124,12 +124,12 @@ function(get_fp_optimization_compile_options USE_SIMD outVar)
       "The CONFIG_ARCH_FLAGS variable is not defined.\n"
       "This variable is strongly-recommended while compiling with OpenMP-SIMD, in order to inform the compiler which vector instructions are available/prefered.\n"
       "This variable should be defined in the machine config file.\n"
-      "A reasonable default value for this variable, when using the ${CMAKE_CXX_COMPILER_ID} compiler, might be \"${HOSTARCHFLAG}\" (this tells the compiler to target the CPU architecture of the machine that is performing the compilation)."
+      "A reasonable default value for this variable, when using the ${CMAKE_CXX_COMPILER_ID} compiler, might be \"${DFLT_HOSTARCHFLAG}\" (this tells the compiler to target the CPU architecture of the machine that is performing the compilation)."
       )
   endif()
 
   # Finally, construct the list of flags
-  set(optionList ${CONFIG_ARG_FLAGS} ${FP_FLAGS})
+  set(optionList ${CONFIG_ARCH_FLAGS} ${FP_FLAGS})
 
   if(USE_SIMD)
     list(APPEND optionList ${OMPSIMD_FLAGS})
@@ -147,3 +147,40 @@ function(get_fp_optimization_compile_options USE_SIMD outVar)
   set("${outVar}" "$<$<COMPILE_LANGUAGE:C,CXX>:${optionList}>" PARENT_SCOPE)
 
 endfunction()
+
+# Function 'get_vectorization_report_options' is used to retrieve C and C++
+# flags that make the compiler report which loops were (and were not)
+# vectorized, and with what vector width
+#
+# ARGUMENTS
+# ---------
+# outVar
+#   The name of the variable where the list of compiler-options are written to
+#   by this function.
+#
+# NOTES
+# -----
+# The reports are written to stderr by gcc and clang, and to *.optrpt files
+# alongside the object files by the Intel compilers. Note that gcc may prefer
+# 256-bit vectors even when AVX-512 is available; to use full-width AVX-512
+# registers, include "-mprefer-vector-width=512" in CONFIG_ARCH_FLAGS.
+function(get_vectorization_report_options outVar)
+
+  if(CMAKE_CXX_COMPILER_ID MATCHES "^AppleClang|Clang$")
+    set(REPORT_FLAGS "-Rpass=loop-vectorize;-Rpass-missed=loop-vectorize")
+  elseif(CMAKE_CXX_COMPILER_ID STREQUAL "GNU")
+    set(REPORT_FLAGS "-fopt-info-vec-optimized;-fopt-info-vec-missed")
+  elseif(CMAKE_CXX_COMPILER_ID STREQUAL "IntelLLVM")
+    set(REPORT_FLAGS "-qopt-report=2")
+  elseif(CMAKE_CXX_COMPILER_ID MATCHES "Intel")
+    set(REPORT_FLAGS "-qopt-report=2;-qopt-report-phase=vec")
+  else()
+    message(FATAL_ERROR
+      "get_vectorization_report_options does not support the "
+      "${CMAKE_CXX_COMPILER_ID} compiler yet."
+      )
+  endif()
+
+  set("${outVar}" "$<$<COMPILE_LANGUAGE:C,CXX>:${REPORT_FLAGS}>" PARENT_SCOPE)
+
+endfunction()
@@ -66,3 +66,17 @@ if (use_papi)
       )
   endif()
 endif()
+
+option(use_adios2 "Use ADIOS2 for the \"adios\" Output type" OFF)
+if (use_adios2)
+  find_package(ADIOS2 COMPONENTS CXX11)
+  if (ADIOS2_FOUND)
+    add_compile_definitions(CONFIG_USE_ADIOS2)
+  else()
+    message(FATAL_ERROR
+      "Requested to use ADIOS2 but ADIOS2 was not found. "
+      "Try setting specific path via `-DADIOS2_ROOT=/PATH/TO/ADIOS2/INSTALL` "
+      " or disable ADIOS2 via `-Duse_adios2=OFF` (default)."
+      )
+  endif()
+endif()
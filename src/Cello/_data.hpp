@@ -25,6 +25,32 @@ enum struct ghost_choice {
   permit   ///< include the ghost zone, if allocated
 };
 
+/// @enum     field_layout_type
+/// @brief    Placement of permanent fields within a Block's field array
+enum field_layout_type {
+  /// fields follow one another, separated only by padding and alignment
+  field_layout_packed,
+  /// field starts are spread evenly over FIELD_STAGGER_BYTES, so that
+  /// the same cell of different fields maps to different cache sets
+  field_layout_staggered
+};
+
+/// @enum     field_lifecycle_type
+/// @brief    When storage for a field exists on a Block
+enum field_lifecycle_type {
+  /// in the permanent array of every Block, so refreshed, interpolated
+  /// and checkpointed
+  field_lifecycle_permanent,
+  /// temporary field allocated and deallocated explicitly by its owner
+  field_lifecycle_temporary,
+  /// allocated on first use, and released at the end of the cycle
+  field_lifecycle_cycle,
+  /// allocated on first use, and kept while the Block exists; not
+  /// carried through refinement or coarsening, so its values must be
+  /// recomputable
+  field_lifecycle_demand
+};
+
 //----------------------------------------------------------------------
 // System includes
 //----------------------------------------------------------------------
@@ -49,7 +75,11 @@ extern void png_array (const char * filename,
 // Defines
 //----------------------------------------------------------------------
 
-#define PARTICLE_ALIGN 16
+#define PARTICLE_ALIGN 64
+
+/// Period over which field starts are spread by field_layout_staggered:
+/// the page size, whose multiples alias in L1 caches
+#define FIELD_STAGGER_BYTES 4096
 
 // integer limits on particle position within a Block:
 //
@@ -86,9 +116,13 @@ class FieldFace;
 #include "data_Scalar.hpp"
 
 #include "data_FieldDescr.hpp"
+#include "data_FieldArena.hpp"
 #include "data_FieldData.hpp"
 #include "data_Field.hpp"
+#include "data_FieldHandle.hpp"
 #include "data_FieldFace.hpp"
+#include "data_FieldFacePool.hpp"
+#include "data_FieldCodec.hpp"
 
 #include "data_ItIndex.hpp"
 #include "data_ItIndexList.hpp"
@@ -100,6 +134,7 @@ class FieldFace;
 #include "data_ParticleDescr.hpp"
 #include "data_ParticleData.hpp"
 #include "data_Particle.hpp"
+#include "data_ParticleAttrHandle.hpp"
 
 #include "data_Face.hpp"
 #include "data_FaceFluxes.hpp"
@@ -74,6 +74,7 @@ namespace cello {
 #include "io_Input.hpp"
 
 #include "io_Output.hpp"
+#include "io_OutputAdios.hpp"
 #include "io_OutputCheckpoint.hpp"
 #include "io_OutputData.hpp"
 #include "io_OutputImage.hpp"
@@ -14,6 +14,7 @@
 
 #include <stdio.h>
 
+#include <algorithm>
 #include <stack>
 #include <memory>
 
@@ -22,6 +23,7 @@
 //----------------------------------------------------------------------
 
 #include "memory_Memory.hpp"
+#include "memory_PageAllocator.hpp"
 
 #endif /* _MEMORY_HPP */
 
@@ -86,6 +86,12 @@ enum adapt_type {
   adapt_refine
 };
 
+/// @typedef  face_level_type
+/// @brief    Storage type for mesh levels in the face level arrays that
+///           every Block carries, kept small to reduce per-Block memory
+
+typedef int8_t face_level_type;
+
 //----------------------------------------------------------------------
 // System includes
 //----------------------------------------------------------------------
@@ -108,6 +114,7 @@ enum adapt_type {
 
 #include "mesh_Block.hpp"
 #include "mesh_Hierarchy.hpp"
+#include "mesh_RefreshAggregator.hpp"
 #include "mesh_Factory.hpp"
 
 // Iterators
@@ -31,6 +31,7 @@ enum monitor_mode {
 //----------------------------------------------------------------------
 
 #include "monitor_Monitor.hpp"
+#include "monitor_Telemetry.hpp"
 
 #endif /* _MONITOR_HPP */
 
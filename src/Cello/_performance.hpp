@@ -12,6 +12,8 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <chrono>
+#include <limits>
 #include <vector>
 #include <map>
 #include <stack>
@@ -34,7 +36,10 @@
 #ifdef CONFIG_USE_PAPI  
 #include "performance_Papi.hpp"
 #endif
+#include "performance_HwCounters.hpp"
 #include "performance_Performance.hpp"
+#include "performance_Tuner.hpp"
+#include "performance_Budget.hpp"
 
 
 #endif /* _PERFORMANCE_HPP */
@@ -27,6 +27,16 @@ enum neighbor_enum {
   neighbor_level,   // neighbors is in same level, maybe not leaves
   neighbor_tree     // neighbors that are leaves, but only if in same octree
 };
+
+/// @enum     codec_enum
+/// @brief    encoding of field face arrays in refresh messages
+enum codec_enum {
+  codec_none,     // field faces are sent unencoded
+  codec_lossless, // byte-shuffled and run-length encoded
+  codec_lossy,    // selected fields quantized to within a tolerance
+  codec_sparse,   // runs of nonzero values, e.g. for accumulated faces
+  codec_constant  // faces with uniform values sent as a single value
+};
   
 //----------------------------------------------------------------------
 
@@ -65,6 +75,7 @@ extern void method_close_files_mutex_init();
 #include "problem_MethodCloseFiles.hpp"
 #include "problem_MethodDebug.hpp"
 #include "problem_MethodFluxCorrect.hpp"
+#include "problem_MethodHistogram.hpp"
 #include "problem_MethodNull.hpp"
 #include "problem_MethodOrderMorton.hpp"
 #include "problem_MethodOrderHilbert.hpp"
@@ -23,6 +23,7 @@
 //----------------------------------------------------------------------
 
 #include "view_CelloView.hpp"
+#include "view_CelloViewRef.hpp"
 #include "view_ViewCollec.hpp"
 #include "view_StringIndRdOnlyMap.hpp"
 #include "view_ViewMap.hpp"
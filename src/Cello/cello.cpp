@@ -9,6 +9,16 @@
 #include "error.hpp"
 #include "charm_simulation.hpp"
 #include "simulation.hpp"
+
+//----------------------------------------------------------------------
+
+static CmiNodeLock node_shared_lock;
+void mutex_init_node_shared()
+{  node_shared_lock = CmiCreateLock(); }
+
+#ifdef CONFIG_USE_CKLOOP
+#  include "CkLoopAPI.h"
+#endif
 //----------------------------------------------------------------------
 
 namespace cello {
@@ -367,11 +377,18 @@ namespace cello {
     return out;
   }
  
+  //---------------------------------------------------------------------- 
+  void define_field_lazy (std::string field_name, int lifecycle)
+  {
+    cello::field_descr()->request_lazy (field_name, lifecycle);
+  }
+
   //---------------------------------------------------------------------- 
   void finalize_fields ()
   {
     FieldDescr * field_descr = cello::field_descr();
     Config   * config  = (Config *) cello::config();
+    field_descr->insert_lazy(config->field_precision);
     field_descr->reset_history(config->field_history);
   }
 
@@ -458,6 +475,44 @@ namespace cello {
   {
     return (1.0/pow(1.0*num_children(),1.0*level));
   }
+
+  //----------------------------------------------------------------------
+
+#ifdef CONFIG_USE_CKLOOP
+  struct ParallelForArgs {
+    int lower, upper, num_tasks;
+    const std::function<void(int,int,int)> * fn;
+  };
+
+  /// CkLoop helper function: run tasks [first,last] (inclusive)
+  static void parallel_for_tasks_
+  (int first, int last, void * result, int num_param, void * param)
+  {
+    const ParallelForArgs * args = (const ParallelForArgs *) param;
+    const int n = args->upper - args->lower;
+    for (int task=first; task<=last; task++) {
+      const int i0 = args->lower + (long(n)*task)     / args->num_tasks;
+      const int i1 = args->lower + (long(n)*(task+1)) / args->num_tasks;
+      if (i0 < i1) (*args->fn)(task,i0,i1);
+    }
+  }
+#endif
+
+  void parallel_for (int lower, int upper, int num_tasks,
+                     const std::function<void(int,int,int)> & fn)
+  {
+    if (upper <= lower) return;
+#ifdef CONFIG_USE_CKLOOP
+    num_tasks = std::min(num_tasks, upper - lower);
+    if (num_tasks > 1) {
+      ParallelForArgs args = { lower, upper, num_tasks, &fn };
+      CkLoop_Parallelize (parallel_for_tasks_, 1, &args,
+                          num_tasks, 0, num_tasks - 1);
+      return;
+    }
+#endif
+    fn(0,lower,upper);
+  }
   
   //----------------------------------------------------------------------
 
@@ -619,3 +674,28 @@ namespace cello {
   }
 
 }
+
+//----------------------------------------------------------------------
+
+namespace cello {
+
+  std::shared_ptr<const void> node_shared_
+  (const std::string & key,
+   const std::function<std::shared_ptr<const void>()> & create)
+  {
+    static std::map<std::string, std::shared_ptr<const void> > objects;
+
+    // hold the lock while creating, so other PEs wait for the first
+    // one instead of reading the same file
+    CmiLock(node_shared_lock);
+    auto it = objects.find(key);
+    if (it == objects.end()) {
+      it = objects.emplace(key,create()).first;
+    }
+    std::shared_ptr<const void> object = it->second;
+    CmiUnlock(node_shared_lock);
+
+    return object;
+  }
+
+}
@@ -29,6 +29,8 @@
 #include <unistd.h>
 
 #include <cstdlib>
+#include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <random>
@@ -776,6 +778,13 @@ namespace cello {
   int define_field_in_group (std::string field_name,
                              std::string group_name,
                              int cx=0, int cy=0, int cz=0);
+
+  /// Define a cell-centered field needed by method or solver only
+  /// where it is used, with lifecycle field_lifecycle_cycle or
+  /// field_lifecycle_demand.  It is stored as a temporary field
+  /// (inserted by finalize_fields()) unless a permanent field has the
+  /// same name; access it with Field::values_demand()
+  void define_field_lazy (std::string field_name, int lifecycle);
   /// Call after adding all fields, temporary or permanent
   void finalize_fields ();
   /// Return a pointer to the ParticledDescr object defining particles on Blocks
@@ -819,6 +828,14 @@ namespace cello {
   size_t          num_blocks_process();
   /// Return the cell volume at the given level relative to the root level
   double          relative_cell_volume (int level);
+
+  /// Split [lower,upper) into num_tasks nearly equal ranges and call
+  /// fn(task,first,last) for each range [first,last).  When built with
+  /// CkLoop (use_ckloop) the tasks are run concurrently by the threads
+  /// of this node; otherwise fn(0,lower,upper) is called once.  Tasks
+  /// must not write to the same memory.
+  void parallel_for (int lower, int upper, int num_tasks,
+                     const std::function<void(int,int,int)> & fn);
   //----------------------------------------------------------------------
 
   /// Return the file name for the format and given arguments
@@ -1087,6 +1104,25 @@ namespace cello {
   /// (however, the option exists to make the code more explicit)
   bool is_initial_cycle(InitCycleKind kind) noexcept;
   bool is_initial_cycle(int cycle, InitCycleKind kind) noexcept;
+
+  /// Return the read-only object shared by all PEs of this process
+  /// under the given key, calling create() to construct it on the
+  /// first request.  Used for large tables read from files, so that
+  /// they are read and stored once per process rather than once per
+  /// PE.  Objects are kept until the program exits.
+  std::shared_ptr<const void> node_shared_
+  (const std::string & key,
+   const std::function<std::shared_ptr<const void>()> & create);
+
+  template <class T>
+  std::shared_ptr<const T> node_shared
+  (const std::string & key, const std::function<T * ()> & create)
+  {
+    return std::static_pointer_cast<const T>
+      (node_shared_(key,[&create] ()
+                    { return std::shared_ptr<const void>
+                        (std::shared_ptr<const T>(create())); }));
+  }
 }
 
 #endif /* CELLO_HPP */
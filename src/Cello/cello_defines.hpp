@@ -25,4 +25,13 @@
 #define FORCE_INLINE inline
 #endif
 
+/// @def      RESTRICT
+/// @brief    Qualifies a pointer to indicate that, for its lifetime, the
+///           memory it refers to is not accessed through any other pointer
+#ifdef __GNUC__
+#define RESTRICT __restrict__
+#else // drop the hint for unrecognized compilers
+#define RESTRICT /* ... */
+#endif
+
 #endif /* CELLO_DEFINES_HPP */
@@ -8,6 +8,8 @@
 #include "charm++.h"
 
 #include <string>
+#include <map>
+#include <vector>
 
 #include "_error.hpp"
 #include "mesh_Index.hpp"
@@ -16,6 +18,7 @@
 #include "charm_MappingIo.hpp"
 #include "charm_MappingTree.hpp"
 
+#include "charm_MsgCounter.hpp"
 #include "charm_FieldMsg.hpp"
 #include "charm_MsgAdapt.hpp"
 #include "charm_MsgCoarsen.hpp"
@@ -24,3 +27,4 @@
 #include "charm_MsgRefine.hpp"
 #include "charm_MsgRefresh.hpp"
 #include "charm_MsgState.hpp"
+#include "charm_NocopyPool.hpp"
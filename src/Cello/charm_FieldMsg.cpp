@@ -0,0 +1,43 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_FieldMsg.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Charm] Implementation of the FieldMsg Charm++ message
+
+#include "data.hpp"
+#include "charm.hpp"
+#include "charm_simulation.hpp"
+
+//----------------------------------------------------------------------
+
+std::map< int, std::vector<FieldMsg *> >
+FieldMsg::pool_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+FieldMsg * FieldMsg::create (int n)
+{
+  std::vector<FieldMsg *> & pool = pool_[cello::index_static()][n];
+  if (pool.empty()) {
+    FieldMsg * msg = new (n) FieldMsg;
+    msg->n = n;
+    return msg;
+  }
+  FieldMsg * msg = pool.back();
+  pool.pop_back();
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+void FieldMsg::release (FieldMsg * msg)
+{
+  // n is the allocated array size, since create() sets it so
+  std::vector<FieldMsg *> & pool = pool_[cello::index_static()][msg->n];
+  if (int(pool.size()) < pool_size_max_) {
+    pool.push_back(msg);
+  } else {
+    delete msg;
+  }
+}
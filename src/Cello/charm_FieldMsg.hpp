@@ -10,6 +10,17 @@
 
 class FieldMsg : public CMessage_FieldMsg {
 
+public: // interface
+
+  /// Return a message with an array of n bytes, reusing a message
+  /// released on this process with the same array size if available
+  static FieldMsg * create (int n);
+
+  /// Keep a received message for reuse by create() instead of deleting
+  /// it.  Solvers exchange messages of the same few sizes every
+  /// iteration, so this avoids allocating each one.
+  static void release (FieldMsg * msg);
+
 public: // attributes
 
   int child_index() const { return ic3[0] + 2*(ic3[1] + 2*(ic3[2])); }
@@ -22,6 +33,14 @@ public: // attributes
 
   /// Child indices
   int ic3[3];
+
+private: // attributes
+
+  /// Maximum number of released messages kept per array size
+  static const int pool_size_max_ = 64;
+
+  /// Released messages on each process, by array size
+  static std::map< int, std::vector<FieldMsg *> > pool_[CONFIG_NODE_SIZE];
 };
 
 #endif /* CHARM_FIELD_MSG_HPP */
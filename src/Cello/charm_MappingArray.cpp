@@ -7,14 +7,25 @@
 
 #include "charm.hpp"
 
+#include <algorithm>
+
+#include "TopoManager.h"
+
 //======================================================================
 
-MappingArray::MappingArray(int nx, int ny, int nz)
-  :  CkArrayMap()
+MappingArray::MappingArray
+(int nx, int ny, int nz, bool node_aware, int mx, int my, int mz)
+  :  CkArrayMap(),
+     pe_()
 {
   nx_ = nx;
   ny_ = ny;
   nz_ = nz;
+
+  if (node_aware) {
+    map_node_aware_();
+    if (CkMyPe() == 0) print_edge_cut_(mx,my,mz);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -33,8 +44,110 @@ int MappingArray::procNum(int, const CkArrayIndex &idx) {
   int ix,iy,iz;
   in.array    (&ix,&iy,&iz);
 
-  int index = ((long long) CkNumPes())*(ix + nx_*(iy + ny_*iz)) / (nx_*ny_*nz_);
-  
-  return index;
+  return process_(ix,iy,iz);
+}
+
+//----------------------------------------------------------------------
+
+void MappingArray::map_node_aware_()
+{
+  const int n = nx_*ny_*nz_;
+
+  // Morton key of each root Block
+
+  int bits = 0;
+  while ((1 << bits) < std::max(nx_,std::max(ny_,nz_))) ++bits;
+
+  std::vector<long long> key (n);
+  for (int iz=0; iz<nz_; iz++) {
+    for (int iy=0; iy<ny_; iy++) {
+      for (int ix=0; ix<nx_; ix++) {
+        long long k = 0;
+        for (int b=bits-1; b>=0; b--) {
+          k = (k << 3)
+            | (((iz >> b) & 1) << 2)
+            | (((iy >> b) & 1) << 1)
+            | (((ix >> b) & 1));
+        }
+        key[ix + nx_*(iy + ny_*iz)] = k;
+      }
+    }
+  }
+
+  std::vector<int> order (n);
+  for (int i=0; i<n; i++) order[i] = i;
+  std::sort (order.begin(), order.end(),
+             [&key] (int a, int b) { return key[a] < key[b]; });
+
+  // Split the curve into one segment per node, with length
+  // proportional to the node's process count, then split each node's
+  // segment evenly among its processes
+
+  const int np = CkNumPes();
+  pe_.resize(n);
+  int k = 0;
+  int ip_begin = 0;
+  for (int node=0; node<CkNumNodes(); node++) {
+    const int node_size = CkNodeSize(node);
+    const int ip_end = ip_begin + node_size;
+    const int k_end = ((long long) n)*ip_end / np;
+    const int count = k_end - k;
+    for (int i=0; i<count; i++) {
+      pe_[order[k+i]] = CkNodeFirst(node)
+        + ((long long) node_size)*i / std::max(count,1);
+    }
+    k = k_end;
+    ip_begin = ip_end;
+  }
 }
 
+//----------------------------------------------------------------------
+
+void MappingArray::print_edge_cut_(int mx, int my, int mz) const
+{
+  TopoManager topo;
+
+  // face areas, in cells, of faces normal to each axis
+
+  const long long area[3] = {
+    (long long) my*mz, (long long) mz*mx, (long long) mx*my };
+
+  // [mapping][total, cut, cut * hops], where mapping 0 is row-major
+
+  long long cut[2][3] = { {0, 0, 0}, {0, 0, 0} };
+
+  for (int iz=0; iz<nz_; iz++) {
+    for (int iy=0; iy<ny_; iy++) {
+      for (int ix=0; ix<nx_; ix++) {
+        const int i3[3] = {ix, iy, iz};
+        const int n3[3] = {nx_, ny_, nz_};
+        for (int axis=0; axis<3; axis++) {
+          if (i3[axis] + 1 >= n3[axis]) continue;
+          int j3[3] = {ix, iy, iz};
+          ++j3[axis];
+          const int pe_a[2] = { process_linear_(ix,iy,iz),
+                                process_(ix,iy,iz) };
+          const int pe_b[2] = { process_linear_(j3[0],j3[1],j3[2]),
+                                process_(j3[0],j3[1],j3[2]) };
+          for (int m=0; m<2; m++) {
+            cut[m][0] += area[axis];
+            if (CkNodeOf(pe_a[m]) != CkNodeOf(pe_b[m])) {
+              cut[m][1] += area[axis];
+              cut[m][2] += area[axis]*topo.getHopsBetweenRanks
+                (pe_a[m],pe_b[m]);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  for (int m=0; m<2; m++) {
+    CkPrintf ("MappingArray %s: inter-node edge cut %lld of %lld "
+              "face cells (%.1f%%), %lld face cell hops\n",
+              (m == 0) ? "row-major " : "node-aware",
+              cut[m][1], cut[m][0],
+              (cut[m][0] > 0) ? 100.0*cut[m][1]/cut[m][0] : 0.0,
+              cut[m][2]);
+  }
+}
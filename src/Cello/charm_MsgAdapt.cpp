@@ -49,6 +49,8 @@ void * MsgAdapt::pack (MsgAdapt * msg)
 
   char * buffer = (char *) CkAllocBuffer (msg,size);
 
+  MsgCounter::sent (msg_class_adapt,size);
+
   //--------------------------------------------------
   //  3. serialize message data into buffer 
   //--------------------------------------------------
@@ -108,6 +110,8 @@ MsgAdapt * MsgAdapt::unpack(void * buffer)
   LOAD_SCALAR_TYPE(pc,bool,  msg->can_coarsen_);
   LOAD_ARRAY_TYPE(pc,char,msg->tag_,TAG_LEN+1);
 
+  MsgCounter::received (msg_class_adapt,pc - (char *) buffer);
+
   // 3. Save the input buffer for freeing later
 
   msg->buffer_ = buffer;
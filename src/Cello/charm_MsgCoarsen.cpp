@@ -13,6 +13,8 @@
 
 long MsgCoarsen::counter[CONFIG_NODE_SIZE] = {0};
 
+std::map<Index,MsgCoarsen *> MsgCoarsen::pending[CONFIG_NODE_SIZE];
+
 //----------------------------------------------------------------------
 
 MsgCoarsen::MsgCoarsen()
@@ -21,6 +23,7 @@ MsgCoarsen::MsgCoarsen()
     data_msg_(NULL),
     buffer_(NULL),
     adapt_child_(nullptr),
+    next_(nullptr),
     num_face_level_(0),
     face_level_(NULL)
 {
@@ -32,7 +35,7 @@ MsgCoarsen::MsgCoarsen()
 
 MsgCoarsen::MsgCoarsen
 (int num_face_level,
- std::vector<int> & face_level,
+ std::vector<face_level_type> & face_level,
  int ic3[3],
  Adapt * adapt_child)
   : CMessage_MsgCoarsen(),
@@ -40,6 +43,7 @@ MsgCoarsen::MsgCoarsen
     data_msg_(NULL),
     buffer_(NULL),
     adapt_child_(adapt_child),
+    next_(nullptr),
     num_face_level_(num_face_level),
     face_level_(new int[num_face_level])
 {
@@ -66,6 +70,8 @@ MsgCoarsen::~MsgCoarsen()
   face_level_ = 0;
   CkFreeMsg (buffer_);
   buffer_=nullptr;
+  delete next_;
+  next_ = nullptr;
 }
 
 //----------------------------------------------------------------------
@@ -82,30 +88,27 @@ void MsgCoarsen::set_data_msg  (DataMsg * data_msg)
 
 //----------------------------------------------------------------------
 
+void MsgCoarsen::append (MsgCoarsen * msg)
+{
+  MsgCoarsen * last = this;
+  while (last->next_) last = last->next_;
+  last->next_ = msg;
+}
+
+//----------------------------------------------------------------------
+
 void * MsgCoarsen::pack (MsgCoarsen * msg)
 {
   if (msg->buffer_ != NULL) return msg->buffer_;
 
   int size = 0;
 
-  // have_data
-  size += sizeof(int); 
-  int have_data = (msg->data_msg_ != NULL);
-  if (have_data) {
-    size += msg->data_msg_->data_size();
-  }
-
-  // num_face_level_
+  // number of aggregated child messages
   size += sizeof(int);
 
-  // face_level_[]
-  size += msg->num_face_level_ * sizeof(int);
-
-  // ic3_[]
-  size += 3*sizeof(int);
-
-  // Adapt class
-  SIZE_OBJECT_PTR_TYPE(size,Adapt,msg->adapt_child_);
+  for (MsgCoarsen * m = msg; m; m = m->next_) {
+    size += m->data_size_();
+  }
 
   //--------------------------------------------------
   //  2. allocate buffer using CkAllocBuffer()
@@ -113,6 +116,8 @@ void * MsgCoarsen::pack (MsgCoarsen * msg)
 
   char * buffer = (char *) CkAllocBuffer (msg,size);
 
+  MsgCounter::sent (msg_class_coarsen,size);
+
   //--------------------------------------------------
   //  3. serialize message data into buffer 
   //--------------------------------------------------
@@ -124,30 +129,12 @@ void * MsgCoarsen::pack (MsgCoarsen * msg)
 
   pc = buffer;
 
-  // have_data
-  have_data = (msg->data_msg_ != NULL);
-  (*pi++) = have_data; 
-  if (have_data) {
-    // data_msg_
-    pc = msg->data_msg_->save_data(pc);   
-  }
-
-  // num_face_level_
-  (*pi++) = msg->num_face_level_;
+  (*pi++) = msg->num_children();
 
-  // face_level_[]
-  for (int i=0; i<msg->num_face_level_; i++) {
-    (*pi++) = msg->face_level_[i];
+  for (MsgCoarsen * m = msg; m; m = m->next_) {
+    pc = m->save_data_(pc);
   }
 
-  // ic3_[]
-  (*pi++) = msg->ic3_[0];
-  (*pi++) = msg->ic3_[1];
-  (*pi++) = msg->ic3_[2];
-
-  // Adapt class
-  SAVE_OBJECT_PTR_TYPE(pc,Adapt,msg->adapt_child_);
-
   ASSERT2("MsgCoarsen::pack()",
 	  "buffer size mismatch %ld allocated %d packed",
 	  (pc - (char*)buffer),size,
@@ -184,43 +171,138 @@ MsgCoarsen * MsgCoarsen::unpack(void * buffer)
 
   pc = (char *) buffer;
 
+  const int num_children = (*pi++);
+
+  pc = msg->load_data_(pc);
+
+  // messages of sibling children refer to the buffer of the first
+
+  for (int i=1; i<num_children; i++) {
+    MsgCoarsen * msg_next = new MsgCoarsen;
+    msg_next->is_local_ = false;
+    pc = msg_next->load_data_(pc);
+    msg->append(msg_next);
+  }
+
+  MsgCounter::received (msg_class_coarsen,pc - (char *) buffer);
+
+  // 3. Save the input buffer for freeing later
+
+  msg->buffer_ = buffer;
+
+  return msg;
+}
+
+//----------------------------------------------------------------------
+
+int MsgCoarsen::data_size_ () const
+{
+  int size = 0;
+
+  // have_data
+  size += sizeof(int); 
+  int have_data = (data_msg_ != NULL);
+  if (have_data) {
+    size += data_msg_->data_size();
+  }
+
+  // num_face_level_
+  size += sizeof(int);
+
+  // face_level_[]
+  size += num_face_level_ * sizeof(int);
+
+  // ic3_[]
+  size += 3*sizeof(int);
+
+  // Adapt class
+  SIZE_OBJECT_PTR_TYPE(size,Adapt,adapt_child_);
+
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgCoarsen::save_data_ (char * buffer) const
+{
+  union {
+    char * pc;
+    int  * pi;
+  };
+
+  pc = buffer;
+
+  // have_data
+  int have_data = (data_msg_ != NULL);
+  (*pi++) = have_data; 
+  if (have_data) {
+    // data_msg_
+    pc = data_msg_->save_data(pc);   
+  }
+
+  // num_face_level_
+  (*pi++) = num_face_level_;
+
+  // face_level_[]
+  for (int i=0; i<num_face_level_; i++) {
+    (*pi++) = face_level_[i];
+  }
+
+  // ic3_[]
+  (*pi++) = ic3_[0];
+  (*pi++) = ic3_[1];
+  (*pi++) = ic3_[2];
+
+  // Adapt class
+  SAVE_OBJECT_PTR_TYPE(pc,Adapt,adapt_child_);
+
+  return pc;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgCoarsen::load_data_ (char * buffer)
+{
+  union {
+    char * pc;
+    int  * pi;
+  };
+
+  pc = buffer;
+
   // have_data
   int have_data = (*pi++);
 
   if (have_data) {
     // data_msg_
-    msg->data_msg_ = new DataMsg;
-    pc = msg->data_msg_->load_data(pc);
+    data_msg_ = new DataMsg;
+    pc = data_msg_->load_data(pc);
   } else {
-    msg->data_msg_ = NULL;
+    data_msg_ = NULL;
   }
 
   // num_face_level_
-  msg->num_face_level_ = (*pi++);
+  num_face_level_ = (*pi++);
 
   // face_level_[]
-  if (msg->num_face_level_ > 0) {
-    msg->face_level_ = new int [msg->num_face_level_];
-    for (int i = 0; i<msg->num_face_level_; i++) {
-      msg->face_level_[i] = (*pi++);
+  if (num_face_level_ > 0) {
+    face_level_ = new int [num_face_level_];
+    for (int i = 0; i<num_face_level_; i++) {
+      face_level_[i] = (*pi++);
     }
   } else {
-    msg->face_level_ = 0;
+    face_level_ = 0;
   }
 
   // ic3_[]
-  msg->ic3_[0] = (*pi++);
-  msg->ic3_[1] = (*pi++);
-  msg->ic3_[2] = (*pi++);
+  ic3_[0] = (*pi++);
+  ic3_[1] = (*pi++);
+  ic3_[2] = (*pi++);
 
   // Adapt class
-  LOAD_OBJECT_PTR_TYPE(pc,Adapt,msg->adapt_child_);
-
-  // 3. Save the input buffer for freeing later
+  LOAD_OBJECT_PTR_TYPE(pc,Adapt,adapt_child_);
 
-  msg->buffer_ = buffer;
-
-  return msg;
+  return pc;
 }
 
 //----------------------------------------------------------------------
@@ -25,9 +25,13 @@ public: // interface
 
   static long counter[CONFIG_NODE_SIZE];
 
+  /// Messages of coarsening children waiting for their siblings on
+  /// the same process, keyed by the (remote) parent index
+  static std::map<Index,MsgCoarsen *> pending[CONFIG_NODE_SIZE];
+
   MsgCoarsen();
 
-  MsgCoarsen( int num_face_level, std::vector<int> & face_level, int ic3[3],
+  MsgCoarsen( int num_face_level, std::vector<face_level_type> & face_level, int ic3[3],
               Adapt * adapt_child);
 
   virtual ~MsgCoarsen();
@@ -55,6 +59,16 @@ public: // interface
   int * face_level() { return face_level_; }
 
   Adapt * adapt_child() const { return adapt_child_; }
+
+  /// Append the message of a sibling child, to be sent together
+  void append (MsgCoarsen * msg);
+
+  /// Return the next aggregated sibling message, if any
+  MsgCoarsen * next() { return next_; }
+
+  /// Return the number of child messages aggregated in this one
+  int num_children () const
+  { return 1 + (next_ ? next_->num_children() : 0); }
   
 public: // static methods
 
@@ -63,6 +77,13 @@ public: // static methods
 
   /// Unpack data to de-serialize
   static MsgCoarsen * unpack(void *);
+
+private: // functions
+
+  /// Size, save, and load the data of one child's message
+  int data_size_ () const;
+  char * save_data_ (char * buffer) const;
+  char * load_data_ (char * buffer);
   
 protected: // attributes
 
@@ -77,6 +98,9 @@ protected: // attributes
 
   /// Mesh connectivity of child block to update parent's
   Adapt * adapt_child_;
+
+  /// Messages of sibling children sent with this one, or nullptr
+  MsgCoarsen * next_;
   
   /// MsgRefine-specific attributes
 
@@ -0,0 +1,123 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MsgCounter.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Charm] Implementation of the MsgCounter class
+
+#include "charm.hpp"
+
+//----------------------------------------------------------------------
+
+long long MsgCounter::class_counter_
+[CONFIG_NODE_SIZE][num_msg_class][num_msg_counter] = { };
+
+long long MsgCounter::refresh_counter_
+[CONFIG_NODE_SIZE][num_refresh_counter][2] = { };
+
+long long MsgCounter::delay_counter_
+[CONFIG_NODE_SIZE][num_msg_class][2] = { };
+
+std::vector<long long> MsgCounter::refresh_id_counter_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+void MsgCounter::refresh_sent (int id_refresh, int kind, long long bytes)
+{
+  const int in = cello::index_static();
+  ++refresh_counter_[in][kind][0];
+  refresh_counter_[in][kind][1] += bytes;
+  std::vector<long long> & c = refresh_id_counter_[in];
+  if (int(c.size()) <= id_refresh*num_msg_counter) {
+    c.resize((id_refresh+1)*num_msg_counter,0);
+  }
+  ++c[id_refresh*num_msg_counter + msg_counter_sent];
+  c[id_refresh*num_msg_counter + msg_counter_sent_bytes] += bytes;
+}
+
+//----------------------------------------------------------------------
+
+void MsgCounter::refresh_received (int id_refresh, long long bytes)
+{
+  const int in = cello::index_static();
+  std::vector<long long> & c = refresh_id_counter_[in];
+  if (int(c.size()) <= id_refresh*num_msg_counter) {
+    c.resize((id_refresh+1)*num_msg_counter,0);
+  }
+  ++c[id_refresh*num_msg_counter + msg_counter_recv];
+  c[id_refresh*num_msg_counter + msg_counter_recv_bytes] += bytes;
+}
+
+//----------------------------------------------------------------------
+
+void MsgCounter::remote_totals (long long * messages, long long * bytes)
+{
+  const int in = cello::index_static();
+  *messages = 0;
+  *bytes = 0;
+  for (int i=0; i<num_msg_class; i++) {
+    if (i == msg_class_field) continue;
+    const long long * c = class_counter_[in][i];
+    *messages += c[msg_counter_sent] + c[msg_counter_recv];
+    *bytes    += c[msg_counter_sent_bytes] + c[msg_counter_recv_bytes];
+  }
+}
+
+//----------------------------------------------------------------------
+
+void MsgCounter::take (long long * values, int num_refresh)
+{
+  const int in = cello::index_static();
+  int m = 0;
+  for (int i=0; i<num_msg_class; i++) {
+    for (int ic=0; ic<num_msg_counter; ic++) {
+      values[m++] = class_counter_[in][i][ic];
+      class_counter_[in][i][ic] = 0;
+    }
+  }
+  for (int i=0; i<num_refresh_counter; i++) {
+    for (int ic=0; ic<2; ic++) {
+      values[m++] = refresh_counter_[in][i][ic];
+      refresh_counter_[in][i][ic] = 0;
+    }
+  }
+  std::vector<long long> & c = refresh_id_counter_[in];
+  for (int i=0; i<num_refresh*num_msg_counter; i++) {
+    values[m++] = (i < int(c.size())) ? c[i] : 0;
+  }
+  std::fill (c.begin(),c.end(),0);
+  for (int i=0; i<num_msg_class; i++) {
+    for (int ic=0; ic<2; ic++) {
+      values[m++] = delay_counter_[in][i][ic];
+      delay_counter_[in][i][ic] = 0;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+const char * MsgCounter::class_name (int msg_class)
+{
+  static const char * name[num_msg_class] =
+    { "MsgRefresh", "MsgAdapt", "MsgCoarsen", "MsgRefine",
+      "FieldMsg", "EnzoMsgCheck" };
+  return name[msg_class];
+}
+
+//----------------------------------------------------------------------
+
+const char * MsgCounter::refresh_name (int kind)
+{
+  static const char * name[num_refresh_counter] =
+    { "same", "coarse", "fine", "flux", "particle" };
+  return name[kind];
+}
+
+//----------------------------------------------------------------------
+
+const char * MsgCounter::counter_name (int counter)
+{
+  static const char * name[num_msg_counter] =
+    { "sent", "sent-bytes", "recv", "recv-bytes" };
+  return name[counter];
+}
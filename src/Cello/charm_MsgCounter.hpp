@@ -0,0 +1,140 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_MsgCounter.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Charm] Declaration of the MsgCounter class
+
+#ifndef CHARM_MSG_COUNTER_HPP
+#define CHARM_MSG_COUNTER_HPP
+
+#include "cello.hpp"
+
+/// @enum     msg_class_enum
+/// @brief    Message classes counted by MsgCounter
+enum msg_class_enum {
+  msg_class_refresh,
+  msg_class_adapt,
+  msg_class_coarsen,
+  msg_class_refine,
+  msg_class_field,
+  msg_class_check,
+  num_msg_class
+};
+
+/// @enum     msg_counter_enum
+/// @brief    Counters kept for each message class and Refresh id
+enum msg_counter_enum {
+  msg_counter_sent,
+  msg_counter_sent_bytes,
+  msg_counter_recv,
+  msg_counter_recv_bytes,
+  num_msg_counter
+};
+
+/// @enum     refresh_counter_enum
+/// @brief    Kinds of refresh messages counted by MsgCounter
+enum refresh_counter_enum {
+  refresh_counter_same,      // same level
+  refresh_counter_coarse,    // fine to coarse
+  refresh_counter_fine,      // coarse to fine
+  refresh_counter_flux,      // fine to coarse fluxes
+  refresh_counter_particle,  // particles
+  num_refresh_counter
+};
+
+class MsgCounter {
+
+  /// @class    MsgCounter
+  /// @ingroup  Charm
+  /// @brief    [\ref Charm] Counts of messages and bytes sent and received
+  ///
+  /// Messages are counted when serialized and de-serialized, so only
+  /// messages between processes are included, with bytes being the
+  /// serialized size excluding the Charm++ envelope (and after any
+  /// field compression).  Refresh messages are counted individually
+  /// whether or not they are aggregated, and also by Refresh id and by
+  /// kind.  FieldMsg, which Charm++ packs itself, is counted by its
+  /// sender and receiver, including local sends.  Counters are kept
+  /// per thread and reset by take().  The delay between sending and
+  /// receiving messages delivered through the scheduler queue of the
+  /// same process is also accumulated by message class, which shows
+  /// the effect of Performance:message_priority.
+
+public: // interface
+
+  /// Count a message of class msg_class sent with the given bytes
+  static void sent (int msg_class, long long bytes)
+  {
+    long long * c = class_counter_[cello::index_static()][msg_class];
+    ++c[msg_counter_sent];
+    c[msg_counter_sent_bytes] += bytes;
+  }
+
+  /// Count a message of class msg_class received with the given bytes
+  static void received (int msg_class, long long bytes)
+  {
+    long long * c = class_counter_[cello::index_static()][msg_class];
+    ++c[msg_counter_recv];
+    c[msg_counter_recv_bytes] += bytes;
+  }
+
+  /// Count a refresh message of the given kind and Refresh id sent
+  /// by a Block
+  static void refresh_sent (int id_refresh, int kind, long long bytes);
+
+  /// Count a refresh message of the given Refresh id received by a Block
+  static void refresh_received (int id_refresh, long long bytes);
+
+  /// Count a message of class msg_class delivered on the same process
+  /// the given number of seconds after it was sent
+  static void delay (int msg_class, double seconds)
+  {
+    long long * c = delay_counter_[cello::index_static()][msg_class];
+    ++c[0];
+    c[1] += (long long)(1e6*seconds);
+  }
+
+  /// Number of values written by take()
+  static int length (int num_refresh)
+  {
+    return num_msg_class*num_msg_counter + num_refresh_counter*2
+      + num_refresh*num_msg_counter + num_msg_class*2;
+  }
+
+  /// Total messages and bytes sent and received between processes
+  /// since the last take(), excluding FieldMsg (which includes local
+  /// sends)
+  static void remote_totals (long long * messages, long long * bytes);
+
+  /// Copy counts since the last call into values[length(num_refresh)],
+  /// ordered by message class, then refresh kind (sent messages and
+  /// bytes), then Refresh id, then message class (delayed messages
+  /// and microseconds), and reset them
+  static void take (long long * values, int num_refresh);
+
+  /// Name of a msg_class_enum class
+  static const char * class_name (int msg_class);
+
+  /// Name of a refresh_counter_enum kind
+  static const char * refresh_name (int kind);
+
+  /// Name of a msg_counter_enum counter
+  static const char * counter_name (int counter);
+
+private: // attributes
+
+  static long long class_counter_
+  [CONFIG_NODE_SIZE][num_msg_class][num_msg_counter];
+
+  static long long refresh_counter_
+  [CONFIG_NODE_SIZE][num_refresh_counter][2];
+
+  static long long delay_counter_
+  [CONFIG_NODE_SIZE][num_msg_class][2];
+
+  /// num_msg_counter counters per Refresh id, grown as needed
+  static std::vector<long long> refresh_id_counter_[CONFIG_NODE_SIZE];
+};
+
+#endif /* CHARM_MSG_COUNTER_HPP */
@@ -18,6 +18,9 @@
 #  define TRACE_MSG_INITIAL(MSG) /* ... */
 #endif
 
+/// Round a buffer offset up to a multiple of 8 bytes
+#define MSG_INITIAL_ALIGN(OFFSET) ((((OFFSET) + 7) / 8) * 8)
+
 //----------------------------------------------------------------------
 
 long MsgInitial::counter[CONFIG_NODE_SIZE] = {0};
@@ -35,6 +38,11 @@ MsgInitial::MsgInitial()
     data_values_(nullptr),
     data_delete_(true),
     count_(false),
+    list_names_(),
+    list_attributes_(),
+    list_precisions_(),
+    list_offsets_(),
+    list_sizes_(),
     buffer_(nullptr),
     tag_(),
     n4_(),
@@ -73,9 +81,17 @@ void * MsgInitial::pack (MsgInitial * msg)
   SIZE_STRING_TYPE(size,msg->data_attribute_);
   SIZE_SCALAR_TYPE(size,int, msg->data_precision_);
   SIZE_SCALAR_TYPE(size,int, msg->data_bytes_);
-  SIZE_ARRAY_TYPE (size,char,msg->data_values_,msg->data_bytes_);
   SIZE_SCALAR_TYPE(size,int, msg->data_delete_);
   SIZE_SCALAR_TYPE(size,int, msg->count_);
+  const int num_list = msg->list_names_.size();
+  SIZE_SCALAR_TYPE(size,int, num_list);
+  for (int i=0; i<num_list; i++) {
+    SIZE_STRING_TYPE(size,msg->list_names_[i]);
+    SIZE_STRING_TYPE(size,msg->list_attributes_[i]);
+  }
+  SIZE_VECTOR_TYPE(size,int,msg->list_precisions_);
+  SIZE_VECTOR_TYPE(size,int,msg->list_offsets_);
+  SIZE_VECTOR_TYPE(size,int,msg->list_sizes_);
   SIZE_ARRAY_TYPE (size,char,msg->tag_,TAG_LEN+1);
   SIZE_ARRAY_TYPE (size,int,   msg->n4_,4);
   SIZE_ARRAY_TYPE (size,double,msg->h4_,4);
@@ -86,6 +102,10 @@ void * MsgInitial::pack (MsgInitial * msg)
   SIZE_SCALAR_TYPE(size,int, msg->IY_);
   SIZE_SCALAR_TYPE(size,int, msg->IZ_);
 
+  // data values last, aligned so that unpack() can use them in place
+  const int offset_values = MSG_INITIAL_ALIGN(size);
+  size = offset_values + msg->data_bytes_;
+
   //--------------------------------------------------
 
   // allocate buffer using CkAllocBuffer()
@@ -106,9 +126,16 @@ void * MsgInitial::pack (MsgInitial * msg)
   SAVE_STRING_TYPE(pc,msg->data_attribute_);
   SAVE_SCALAR_TYPE(pc,int,msg->data_precision_);
   SAVE_SCALAR_TYPE(pc,int,msg->data_bytes_);
-  SAVE_ARRAY_TYPE(pc,char,msg->data_values_,msg->data_bytes_);
   SAVE_SCALAR_TYPE(pc,int,msg->data_delete_);
   SAVE_SCALAR_TYPE(pc,int,msg->count_);
+  SAVE_SCALAR_TYPE(pc,int,num_list);
+  for (int i=0; i<num_list; i++) {
+    SAVE_STRING_TYPE(pc,msg->list_names_[i]);
+    SAVE_STRING_TYPE(pc,msg->list_attributes_[i]);
+  }
+  SAVE_VECTOR_TYPE(pc,int,msg->list_precisions_);
+  SAVE_VECTOR_TYPE(pc,int,msg->list_offsets_);
+  SAVE_VECTOR_TYPE(pc,int,msg->list_sizes_);
   SAVE_ARRAY_TYPE(pc,char,msg->tag_,TAG_LEN+1);
   SAVE_ARRAY_TYPE (pc,int,   msg->n4_,4);
   SAVE_ARRAY_TYPE (pc,double,msg->h4_,4);
@@ -119,6 +146,10 @@ void * MsgInitial::pack (MsgInitial * msg)
   SAVE_SCALAR_TYPE(pc,int, msg->IY_);
   SAVE_SCALAR_TYPE(pc,int, msg->IZ_);
 
+  pc = buffer + offset_values;
+  std::copy_n (msg->data_values_, msg->data_bytes_, pc);
+  pc += msg->data_bytes_;
+
   ASSERT2("MsgInitial::pack()",
           "buffer size mismatch %ld allocated %d packed",
           (pc - (char*)buffer),size,
@@ -157,11 +188,19 @@ MsgInitial * MsgInitial::unpack(void * buffer)
   LOAD_STRING_TYPE(pc,msg->data_attribute_);
   LOAD_SCALAR_TYPE(pc,int,msg->data_precision_);
   LOAD_SCALAR_TYPE(pc,int,msg->data_bytes_);
-  msg->data_values_ = new char[msg->data_bytes_];
-  LOAD_ARRAY_TYPE (pc,char,msg->data_values_,msg->data_bytes_);
   LOAD_SCALAR_TYPE(pc,int,msg->data_delete_);
-  msg->data_delete_ = true;
   LOAD_SCALAR_TYPE(pc,int,msg->count_);
+  int num_list;
+  LOAD_SCALAR_TYPE(pc,int,num_list);
+  msg->list_names_.resize(num_list);
+  msg->list_attributes_.resize(num_list);
+  for (int i=0; i<num_list; i++) {
+    LOAD_STRING_TYPE(pc,msg->list_names_[i]);
+    LOAD_STRING_TYPE(pc,msg->list_attributes_[i]);
+  }
+  LOAD_VECTOR_TYPE(pc,int,msg->list_precisions_);
+  LOAD_VECTOR_TYPE(pc,int,msg->list_offsets_);
+  LOAD_VECTOR_TYPE(pc,int,msg->list_sizes_);
   LOAD_ARRAY_TYPE(pc,char,msg->tag_,TAG_LEN+1);
   LOAD_ARRAY_TYPE (pc,int,   msg->n4_,4);
   LOAD_ARRAY_TYPE (pc,double,msg->h4_,4);
@@ -172,6 +211,13 @@ MsgInitial * MsgInitial::unpack(void * buffer)
   LOAD_SCALAR_TYPE(pc,int, msg->IY_);
   LOAD_SCALAR_TYPE(pc,int, msg->IZ_);
 
+  // Access data values in place rather than copying them; they are
+  // freed with the buffer
+
+  pc = (char *) buffer + MSG_INITIAL_ALIGN(pc - (char *) buffer);
+  msg->data_values_ = pc;
+  msg->data_delete_ = false;
+
   // Save the input buffer for freeing later
 
   msg->buffer_ = buffer;
@@ -188,6 +234,7 @@ void MsgInitial::update (Data * data)
   if (!is_local_) {
     CkFreeMsg (buffer_);
     buffer_ = nullptr;
+    if (! data_delete_) data_values_ = nullptr;
   } 
 }
 
@@ -203,13 +250,13 @@ void MsgInitial::print (const char * msg)
 
 void MsgInitial::set_field_data
 (std::string field_name,
- char * data, int data_size, int data_precision)
+ char * data, int data_size, int data_precision, bool copy)
 {
   data_type_      = "field";
   data_name_      = field_name;
   data_attribute_ = "";  // unused for field data
   
-  copy_data_(data,data_size,data_precision);
+  copy_data_(data,data_size,data_precision,copy);
 }
 
 
@@ -259,13 +306,13 @@ void MsgInitial::get_dataset
 
 void MsgInitial::set_particle_data
 (std::string particle_name, std::string particle_attribute,
- char * data, int data_size, int data_precision)
+ char * data, int data_size, int data_precision, bool copy)
 {
   data_type_      = "particle";
   data_name_      = particle_name;
   data_attribute_ = particle_attribute;
 
-  copy_data_(data,data_size,data_precision);
+  copy_data_(data,data_size,data_precision,copy);
 }
 
 //----------------------------------------------------------------------
@@ -283,16 +330,60 @@ void MsgInitial::get_particle_data
   (*data_precision) = data_precision_;
 }
 
+//----------------------------------------------------------------------
+
+void MsgInitial::set_particle_list_data (char * data, int data_bytes)
+{
+  data_type_      = "particle_list";
+  data_name_      = "";
+  data_attribute_ = "";
+  data_precision_ = type_unknown;
+  data_bytes_     = data_bytes;
+  data_values_    = data;
+  data_delete_    = true;
+}
+
+//----------------------------------------------------------------------
+
+void MsgInitial::add_particle_list
+(std::string particle_name, std::string particle_attribute,
+ int data_offset, int data_size, int data_precision)
+{
+  list_names_.push_back(particle_name);
+  list_attributes_.push_back(particle_attribute);
+  list_offsets_.push_back(data_offset);
+  list_sizes_.push_back(data_size);
+  list_precisions_.push_back(data_precision);
+}
+
+//----------------------------------------------------------------------
+
+void MsgInitial::get_particle_list
+(int i, std::string * particle_name, std::string * particle_attribute,
+ char ** data, int * data_size, int * data_precision)
+{
+  (*particle_name)      = list_names_[i];
+  (*particle_attribute) = list_attributes_[i];
+  (*data)               = data_values_ + list_offsets_[i];
+  (*data_size)          = list_sizes_[i];
+  (*data_precision)     = list_precisions_[i];
+}
+
 //======================================================================
 
-void MsgInitial::copy_data_( char * data, int data_size, int data_precision)
+void MsgInitial::copy_data_
+( char * data, int data_size, int data_precision, bool copy)
 {
-  // create copy of data
+  // create copy of data, or take ownership of it
   const int bytes_per_element = cello::sizeof_precision(data_precision);
   data_precision_ = data_precision;
   data_bytes_ = data_size*bytes_per_element;
-  data_values_ = new char[data_bytes_];
   data_delete_ = true;
-  std::copy_n( data, data_bytes_, data_values_);
+  if (copy) {
+    data_values_ = new char[data_bytes_];
+    std::copy_n( data, data_bytes_, data_values_);
+  } else {
+    data_values_ = data;
+  }
 }
 
@@ -42,6 +42,11 @@ public: // interface
     data_values_    = nullptr;
     data_delete_    = true;
     count_           = msg_initial.count_;
+    list_names_      = msg_initial.list_names_;
+    list_attributes_ = msg_initial.list_attributes_;
+    list_precisions_ = msg_initial.list_precisions_;
+    list_offsets_    = msg_initial.list_offsets_;
+    list_sizes_      = msg_initial.list_sizes_;
     // new message, so new tag
     cello::hex_string(tag_,TAG_LEN);
 
@@ -74,25 +79,48 @@ public: // static methods
 
 public: // methods
   
-  /// Set data array for a field
+  /// Set data array for a field.  If copy is false, the message
+  /// takes ownership of data, which must be allocated with new char[]
   void set_field_data
   (std::string field_name,
-   char * data, int data_size, int data_precision);
+   char * data, int data_size, int data_precision, bool copy = true);
 
   /// Get data array for a field
   void get_field_data
   (std::string * field_name, char ** data, int * data_precision);
 
-  /// Set data array for a particle attribute
+  /// Set data array for a particle attribute.  If copy is false, the
+  /// message takes ownership of data, which must be allocated with
+  /// new char[]
   void set_particle_data
   (std::string particle_name, std::string particle_attribute,
-   char * data, int data_size, int data_precision);
+   char * data, int data_size, int data_precision, bool copy = true);
   
   /// Set data array for a particle attribute
   void get_particle_data
   (std::string * particle_name, std::string * particle_attribute,
    char ** data, int * data_size, int * data_precision);
 
+  /// Set a single data array holding several particle attributes,
+  /// added with add_particle_list(); the message takes ownership of
+  /// data, which must be allocated with new char[]
+  void set_particle_list_data (char * data, int data_bytes);
+
+  /// Add a particle attribute stored in the particle list data array
+  /// at the given byte offset
+  void add_particle_list
+  (std::string particle_name, std::string particle_attribute,
+   int data_offset, int data_size, int data_precision);
+
+  /// Return the number of particle attributes in the list
+  int num_particle_list() const
+  { return list_names_.size(); }
+
+  /// Get the i'th particle attribute in the list
+  void get_particle_list
+  (int i, std::string * particle_name, std::string * particle_attribute,
+   char ** data, int * data_size, int * data_precision);
+
   /// Set dataset sizes
   void set_dataset (int n4[4], double h4[4],
                     int nx, int ny, int nz,
@@ -113,7 +141,8 @@ public: // methods
   
 protected: // methods
 
-  void copy_data_( char * data, int data_size, int data_precision);
+  void copy_data_( char * data, int data_size, int data_precision,
+                   bool copy);
 
 protected: // attributes
 
@@ -135,7 +164,8 @@ protected: // attributes
   /// Number of elements in data array (of given precision type)
   int data_bytes_;
 
-  /// Data values in a packed array of length data_bytes_
+  /// Data values in a packed array of length data_bytes_; after
+  /// unpack() this points into buffer_
   char * data_values_;
 
   /// Whether to delete data_values_ when deleting this message
@@ -145,6 +175,14 @@ protected: // attributes
   /// this one) that will be received
   int count_;
 
+  /// Particle types, attributes, precisions, byte offsets into
+  /// data_values_, and sizes if data_type_ is "particle_list"
+  std::vector<std::string> list_names_;
+  std::vector<std::string> list_attributes_;
+  std::vector<int> list_precisions_;
+  std::vector<int> list_offsets_;
+  std::vector<int> list_sizes_;
+
   /// Saved Charm++ buffers for deleting after unpack()
   void * buffer_;
 
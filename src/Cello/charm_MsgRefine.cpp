@@ -163,6 +163,8 @@ void * MsgRefine::pack (MsgRefine * msg)
 
   char * buffer = (char *) CkAllocBuffer (msg,size);
 
+  MsgCounter::sent (msg_class_refine,size);
+
 #ifdef DEBUG_MSG_REFINE  
   CkPrintf ("%d %s:%d DEBUG_MSG_REFINE ENTER MsgRefine::pack() msg %p --> buffer %p\n",
 	    CkMyPe(),__FILE__,__LINE__,msg,buffer);
@@ -301,6 +303,8 @@ MsgRefine * MsgRefine::unpack(void * buffer)
     msg->data_msg_ = nullptr;
   }
 
+  MsgCounter::received (msg_class_refine,pc - (char *) buffer);
+
   // 3. Save the input buffer for freeing later
 
 #ifdef DEBUG_MSG_REFINE  
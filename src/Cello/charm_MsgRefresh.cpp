@@ -20,7 +20,11 @@ MsgRefresh::MsgRefresh()
       is_local_(true),
       id_refresh_(-1),
       data_msg_(nullptr),
-      buffer_(nullptr)
+      buffer_(nullptr),
+      buffer_copy_(nullptr),
+      counter_kind_(refresh_counter_same),
+      data_bytes_(0),
+      time_sent_(0.0)
 {
   ++counter[cello::index_static()];
 }
@@ -34,6 +38,8 @@ MsgRefresh::~MsgRefresh()
   data_msg_ = nullptr;
   CkFreeMsg (buffer_);
   buffer_=nullptr;
+  delete [] buffer_copy_;
+  buffer_copy_ = nullptr;
 }
 
 //----------------------------------------------------------------------
@@ -54,10 +60,7 @@ void * MsgRefresh::pack (MsgRefresh * msg)
 {
   if (msg->buffer_ != nullptr) return msg->buffer_;
 
-  int size = 0;
-
-  SIZE_SCALAR_TYPE(size,int,msg->id_refresh_);
-  SIZE_OBJECT_PTR_TYPE(size,DataMsg,msg->data_msg_);
+  int size = msg->data_size();
 
   //--------------------------------------------------
   //  2. allocate buffer using CkAllocBuffer()
@@ -69,10 +72,7 @@ void * MsgRefresh::pack (MsgRefresh * msg)
   //  3. serialize message data into buffer 
   //--------------------------------------------------
 
-  char * pc = buffer;
-
-  SAVE_SCALAR_TYPE(pc,int,msg->id_refresh_);
-  SAVE_OBJECT_PTR_TYPE(pc,DataMsg,msg->data_msg_);
+  char * pc = msg->save_data(buffer);
 
   delete msg;
 
@@ -103,10 +103,7 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
   // 2. De-serialize message data from input buffer into the allocated
   // message (must be consistent with pack())
 
-  char * pc = (char *) buffer;
-
-  LOAD_SCALAR_TYPE(pc,int,msg->id_refresh_);
-  LOAD_OBJECT_PTR_TYPE(pc,DataMsg,msg->data_msg_);
+  msg->load_data((char *) buffer);
 
   // 3. Save the input buffer for freeing later
 
@@ -117,6 +114,94 @@ MsgRefresh * MsgRefresh::unpack(void * buffer)
 
 //----------------------------------------------------------------------
 
+int MsgRefresh::data_size () const
+{
+  int size = 0;
+
+  SIZE_SCALAR_TYPE(size,int,id_refresh_);
+  SIZE_OBJECT_PTR_TYPE(size,DataMsg,data_msg_);
+
+  return size;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgRefresh::save_data (char * buffer) const
+{
+  char * pc = buffer;
+
+  SAVE_SCALAR_TYPE(pc,int,id_refresh_);
+  SAVE_OBJECT_PTR_TYPE(pc,DataMsg,data_msg_);
+
+  // one remote refresh message, sent individually or aggregated
+  MsgCounter::sent (msg_class_refresh,pc - buffer);
+  MsgCounter::refresh_sent (id_refresh_,counter_kind_,pc - buffer);
+
+  return pc;
+}
+
+//----------------------------------------------------------------------
+
+char * MsgRefresh::load_data (char * buffer)
+{
+  char * pc = buffer;
+
+  LOAD_SCALAR_TYPE(pc,int,id_refresh_);
+  LOAD_OBJECT_PTR_TYPE(pc,DataMsg,data_msg_);
+
+  data_bytes_ = pc - buffer;
+  MsgCounter::received (msg_class_refresh,data_bytes_);
+  MsgCounter::refresh_received (id_refresh_,data_bytes_);
+
+  return pc;
+}
+
+//----------------------------------------------------------------------
+
+void MsgRefresh::load_data_copy (int n, const char * buffer)
+{
+  MemoryGroup memory_group (memory_group_messages);
+
+  delete [] buffer_copy_;
+  buffer_copy_ = new char[n];
+  memcpy (buffer_copy_,buffer,n);
+
+  is_local_ = false;
+
+  char * pc = load_data(buffer_copy_);
+
+  ASSERT2("MsgRefresh::load_data_copy()",
+	  "buffer size mismatch %ld loaded %d expected",
+	  (pc - buffer_copy_),n,
+	  (pc - buffer_copy_) == n);
+}
+
+//----------------------------------------------------------------------
+
+void MsgRefresh::load_data_nocopy (int n, char * buffer)
+{
+  is_local_ = false;
+
+  char * pc = load_data(buffer);
+
+  ASSERT2("MsgRefresh::load_data_nocopy()",
+	  "buffer size mismatch %ld loaded %d expected",
+	  (pc - buffer),n,
+	  (pc - buffer) == n);
+}
+
+//----------------------------------------------------------------------
+
+int MsgRefresh::id_refresh (const char * buffer)
+{
+  // id_refresh_ is serialized first by save_data()
+  int id_refresh;
+  memcpy (&id_refresh,buffer,sizeof(int));
+  return id_refresh;
+}
+
+//----------------------------------------------------------------------
+
 void MsgRefresh::update (Data * data)
 {
   if (data_msg_ == nullptr) return;
@@ -131,6 +216,16 @@ void MsgRefresh::update (Data * data)
 
 //----------------------------------------------------------------------
 
+void MsgRefresh::copy_local ()
+{
+  if (is_local_ && data_msg_ != nullptr) {
+    data_msg_->copy_field_face();
+    is_local_ = false;
+  }
+}
+
+//----------------------------------------------------------------------
+
 void MsgRefresh::print (const char * message, FILE * fp_in)
 {
   FILE * fp = fp_in ? fp_in : stdout;
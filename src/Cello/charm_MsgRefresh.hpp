@@ -41,6 +41,25 @@ public: // interface
 
   int id_refresh() const
   { return id_refresh_; }
+
+  /// Set the refresh_counter_enum kind of the message for MsgCounter
+  void set_counter_kind (int kind)
+  { counter_kind_ = kind; }
+
+  /// Serialized bytes of a message received from another process, or
+  /// 0 if delivered locally
+  int data_bytes() const
+  { return data_bytes_; }
+
+  /// Set the wall time the message was sent, for measuring the delay
+  /// of messages delivered on the same process
+  void set_time_sent (double time)
+  { time_sent_ = time; }
+
+  /// Wall time the message was sent, or 0 if not known (e.g. if it was
+  /// received from another process)
+  double time_sent() const
+  { return time_sent_; }
   
   // Set the DataMsg object
   void set_data_msg (DataMsg * data_msg);
@@ -48,7 +67,33 @@ public: // interface
   /// Update the Data with data stored in this message
   void update (Data * data);
 
+  /// Copy field faces of a local message from the sending Block, so
+  /// that the message can be kept after the sender continues
+  void copy_local ();
+
   void print(const char * message, FILE * fp=nullptr);
+
+  /// Return the number of bytes required to serialize the message
+  int data_size () const;
+
+  /// Serialize the message into the buffer, returning the next position
+  char * save_data (char * buffer) const;
+
+  /// De-serialize the message from the buffer, returning the next
+  /// position.  The buffer must remain valid until update() is called
+  char * load_data (char * buffer);
+
+  /// De-serialize the message from a copy of the buffer, for buffers not
+  /// owned by the message such as parts of aggregated messages
+  void load_data_copy (int n, const char * buffer);
+
+  /// De-serialize the message from a buffer that is only valid until
+  /// the message is updated and deleted, such as a zero-copy entry
+  /// method parameter
+  void load_data_nocopy (int n, char * buffer);
+
+  /// Return the refresh id of a serialized message
+  static int id_refresh (const char * buffer);
   
 public: // static methods
 
@@ -71,6 +116,18 @@ protected: // attributes
   /// Saved Charm++ buffer for deleting after unpack()
   void * buffer_;
 
+  /// Copy of a buffer passed to load_data_copy()
+  char * buffer_copy_;
+
+  /// Kind of refresh message for MsgCounter; not serialized
+  int counter_kind_;
+
+  /// Bytes de-serialized by load_data()
+  int data_bytes_;
+
+  /// Wall time the message was sent; not serialized
+  double time_sent_;
+
 };
 
 #endif /* CHARM_MSG_HPP */
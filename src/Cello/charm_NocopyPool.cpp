@@ -0,0 +1,65 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_NocopyPool.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Charm] Implementation of the NocopyPool class
+
+#include "data.hpp"
+#include "charm.hpp"
+
+//----------------------------------------------------------------------
+
+std::map< int, std::vector<char *> > NocopyPool::pool_[CONFIG_NODE_SIZE];
+std::map< char *, int > NocopyPool::capacity_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+char * NocopyPool::acquire (int n)
+{
+  const int in = cello::index_static();
+
+  int capacity = 1;
+  while (capacity < n) capacity *= 2;
+
+  std::vector<char *> & pool = pool_[in][capacity];
+  char * buffer;
+  if (pool.empty()) {
+    MemoryGroup memory_group (memory_group_messages);
+    buffer = new char[capacity];
+  } else {
+    buffer = pool.back();
+    pool.pop_back();
+  }
+  capacity_[in][buffer] = capacity;
+  return buffer;
+}
+
+//----------------------------------------------------------------------
+
+void NocopyPool::release (char * buffer)
+{
+  const int in = cello::index_static();
+
+  auto it = capacity_[in].find(buffer);
+  ASSERT("NocopyPool::release()",
+         "buffer was not acquired on this process",
+         (it != capacity_[in].end()));
+
+  std::vector<char *> & pool = pool_[in][it->second];
+  capacity_[in].erase(it);
+  if (int(pool.size()) < pool_size_max_) {
+    pool.push_back(buffer);
+  } else {
+    delete [] buffer;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void NocopyPool::release (CkDataMsg * msg)
+{
+  CkNcpyBuffer * source = (CkNcpyBuffer *)(msg->data);
+  release ((char *)source->ptr);
+  delete msg;
+}
@@ -0,0 +1,50 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     charm_NocopyPool.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Charm] Declaration of the NocopyPool class
+
+#ifndef CHARM_NOCOPY_POOL_HPP
+#define CHARM_NOCOPY_POOL_HPP
+
+class NocopyPool {
+
+  /// @class    NocopyPool
+  /// @ingroup  Charm
+  /// @brief    [\ref Charm] Per-process staging buffers for zero-copy sends
+  ///
+  /// Large refresh messages are serialized into a staging buffer and
+  /// sent with the Charm++ zero-copy entry method API, which lets the
+  /// network read the buffer directly instead of copying it into a
+  /// Charm++ message.  The buffer must not be reused until Charm++
+  /// invokes the sender's callback, which releases it here.  Buffers
+  /// are kept in free lists by power-of-two capacity so that
+  /// steady-state refreshes reuse buffers whose memory the network
+  /// layer has already registered.
+
+public: // interface
+
+  /// Return a buffer of at least n bytes
+  static char * acquire (int n);
+
+  /// Return a buffer from acquire() to the pool
+  static void release (char * buffer);
+
+  /// Zero-copy send callback releasing the sent buffer
+  static void release (CkDataMsg * msg);
+
+private: // attributes
+
+  /// Maximum number of free buffers kept per capacity
+  static const int pool_size_max_ = 64;
+
+  /// Free buffers on each process, by capacity
+  static std::map< int, std::vector<char *> > pool_[CONFIG_NODE_SIZE];
+
+  /// Capacity of each buffer acquired and not yet released
+  static std::map< char *, int > capacity_[CONFIG_NODE_SIZE];
+
+};
+
+#endif /* CHARM_NOCOPY_POOL_HPP */
@@ -102,6 +102,107 @@ CkReductionMsg * r_reduce_method_debug(int n, CkReductionMsg ** msgs)
 
 //======================================================================
 
+CkReduction::reducerType r_reduce_method_histogram_type;
+
+void register_reduce_method_histogram(void)
+{ r_reduce_method_histogram_type =
+    CkReduction::addReducer(r_reduce_method_histogram); }
+
+CkReductionMsg * r_reduce_method_histogram(int n, CkReductionMsg ** msgs)
+// Header values (length, method, cycle, time) are copied from the
+// first contribution, and the remaining bins are summed
+{
+  if (n <= 0) return NULL;
+
+  const int length = ((double*) (msgs[0]->getData()))[0];
+  const int num_header = 4;
+
+  std::vector<double> accum (length,0.0);
+
+  std::copy_n ((double *) msgs[0]->getData(), num_header, accum.begin());
+
+  for (int i=0; i<n; i++) {
+    ASSERT2 ("r_reduce_method_histogram()",
+	     "Contribution size %d differs from expected %d",
+	     msgs[i]->getSize(),int(length*sizeof(double)),
+	     (msgs[i]->getSize() == int(length*sizeof(double))));
+    double * values = (double *) msgs[i]->getData();
+    for (int j=num_header; j<length; j++) {
+      accum [j] += values[j];
+    }
+  }
+
+  return CkReductionMsg::buildNew(length*sizeof(double),&accum[0]);
+}
+
+//======================================================================
+
+CkReduction::reducerType r_reduce_arrival_type;
+
+void register_reduce_arrival(void)
+{ r_reduce_arrival_type = CkReduction::addReducer(r_reduce_arrival); }
+
+CkReductionMsg * r_reduce_arrival(int n, CkReductionMsg ** msgs)
+// Barrier arrival times (double[5]): first arrival, last arrival, and
+// the Index values of the Block that arrived last
+{
+  if (n <= 0) return NULL;
+
+  double accum[5];
+  std::copy_n ((double *) msgs[0]->getData(), 5, accum);
+
+  for (int i=1; i<n; i++) {
+    ASSERT2 ("r_reduce_arrival()",
+	     "Contribution size %d differs from expected %d",
+	     msgs[i]->getSize(),int(5*sizeof(double)),
+	     (msgs[i]->getSize() == int(5*sizeof(double))));
+    double * values = (double *) msgs[i]->getData();
+    accum[0] = std::min(accum[0],values[0]);
+    if (values[1] > accum[1]) std::copy_n (values+1, 4, accum+1);
+  }
+
+  return CkReductionMsg::buildNew(5*sizeof(double),accum);
+}
+
+//======================================================================
+
+CkReduction::reducerType r_reduce_fused_type;
+
+void register_reduce_fused(void)
+{ r_reduce_fused_type = CkReduction::addReducer(r_reduce_fused); }
+
+CkReductionMsg * r_reduce_fused(int n, CkReductionMsg ** msgs)
+// Composite reduction (double[3 + num_min + num_max + num_sum]): the
+// counts num_min, num_max, and num_sum, followed by the values reduced
+// by minimum, maximum, and sum
+{
+  if (n <= 0) return NULL;
+
+  const double * header = (const double *) msgs[0]->getData();
+  const int num_min = header[0];
+  const int num_max = header[1];
+  const int num_sum = header[2];
+  const int length = 3 + num_min + num_max + num_sum;
+
+  std::vector<double> accum (header, header + length);
+
+  for (int i=1; i<n; i++) {
+    ASSERT2 ("r_reduce_fused()",
+	     "Contribution size %d differs from expected %d",
+	     msgs[i]->getSize(),int(length*sizeof(double)),
+	     (msgs[i]->getSize() == int(length*sizeof(double))));
+    const double * values = (const double *) msgs[i]->getData();
+    int j = 3;
+    for (int k=0; k<num_min; k++,j++) accum[j] = std::min(accum[j],values[j]);
+    for (int k=0; k<num_max; k++,j++) accum[j] = std::max(accum[j],values[j]);
+    for (int k=0; k<num_sum; k++,j++) accum[j] += values[j];
+  }
+
+  return CkReductionMsg::buildNew(length*sizeof(double),accum.data());
+}
+
+//======================================================================
+
 CkReduction::reducerType sum_long_double_type;
 
 void register_sum_long_double(void)
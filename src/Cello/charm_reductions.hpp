@@ -22,3 +22,15 @@ extern CkReductionMsg * r_reduce_method_debug(int n, CkReductionMsg ** msgs);
 extern CkReduction::reducerType r_reduce_method_debug_type;
 extern void register_reduce_method_debug(void);
 
+extern CkReductionMsg * r_reduce_method_histogram(int n, CkReductionMsg ** msgs);
+extern CkReduction::reducerType r_reduce_method_histogram_type;
+extern void register_reduce_method_histogram(void);
+
+extern CkReductionMsg * r_reduce_arrival(int n, CkReductionMsg ** msgs);
+extern CkReduction::reducerType r_reduce_arrival_type;
+extern void register_reduce_arrival(void);
+
+extern CkReductionMsg * r_reduce_fused(int n, CkReductionMsg ** msgs);
+extern CkReduction::reducerType r_reduce_fused_type;
+extern void register_reduce_fused(void);
+
@@ -54,6 +54,29 @@ public: // virtual functions
     return std::string();
   };
 
+  /// Return the fields read by compute(), used by
+  /// Block::compute_derived() to decide whether a derived field must
+  /// be recomputed.  An empty list means any field that is not in the
+  /// "derived" group may be read.
+  virtual std::vector<int> input_field_list () throw()
+  { return std::vector<int>(); }
+
+  /// Whether compute_slab() can evaluate the derived quantity, so that
+  /// it can be written without a field to hold it
+  virtual bool is_streamed () throw()
+  { return false; }
+
+  /// Evaluate the derived quantity in the planes iz0 <= iz < iz0 + nz
+  /// of the Block's field arrays, ghost zones included, into values,
+  /// an array of mx * my * nz values
+  virtual void compute_slab
+  (Block * block, int iz0, int nz, cello_float * values) throw()
+  {
+    ERROR1 ("Compute::compute_slab()",
+            "Compute %s cannot be evaluated in slabs",
+            name().c_str());
+  }
+
   /// Return / set field history to use in computation
 
   virtual int  get_history(int i_hist) {return i_hist_;};
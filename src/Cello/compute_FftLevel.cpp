@@ -0,0 +1,446 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     compute_FftLevel.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    Implementation of the FftLevel class
+
+#include "compute.hpp"
+
+//----------------------------------------------------------------------
+
+std::vector<FftLevel *> FftLevel::instances_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Copy the interior of a field into complex values
+  template <class T>
+  void load_ (const T * field, std::complex<double> * values,
+              int mx, int my, int gx, int gy, int gz,
+              int nx, int ny, int nz)
+  {
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        for (int ix=0; ix<nx; ix++) {
+          const int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+          values[ix + nx*(iy + ny*iz)] = double(field[i]);
+        }
+      }
+    }
+  }
+
+  /// Copy the scaled real part of complex values into the field interior
+  template <class T>
+  void store_ (T * field, const std::complex<double> * values, double scale,
+               int mx, int my, int gx, int gy, int gz,
+               int nx, int ny, int nz)
+  {
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        for (int ix=0; ix<nx; ix++) {
+          const int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+          field[i] = T(scale*values[ix + nx*(iy + ny*iz)].real());
+        }
+      }
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+FftLevel::FftLevel (std::string field_src, std::string field_dst) throw()
+  : field_src_(field_src),
+    field_dst_(field_dst),
+    id_(-1),
+    buffer_(),
+    callback_(),
+    time_start_(0.0)
+{
+  for (int axis=0; axis<3; axis++) {
+    nb3_[axis] = 0;
+    n3_[axis] = 0;
+  }
+
+  // objects created for unpacking register themselves in pup()
+  if (field_src_ != "") {
+    auto & instances = instances_[cello::index_static()];
+    id_ = instances.size();
+    instances.push_back(this);
+  }
+}
+
+//----------------------------------------------------------------------
+
+FftLevel::~FftLevel() throw()
+{
+  auto & instances = instances_[cello::index_static()];
+  if (0 <= id_ && id_ < int(instances.size()) && instances[id_] == this) {
+    instances[id_] = nullptr;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::pup (PUP::er &p)
+{
+  TRACEPUP;
+  // NOTE: change this function whenever attributes change
+
+  p | field_src_;
+  p | field_dst_;
+  p | id_;
+  PUParray(p,nb3_,3);
+  PUParray(p,n3_,3);
+
+  if (p.isUnpacking() && id_ >= 0) {
+    auto & instances = instances_[cello::index_static()];
+    if (int(instances.size()) <= id_) instances.resize(id_ + 1, nullptr);
+    instances[id_] = this;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::apply (Block * block, int callback) throw()
+{
+  initialize_();
+
+  ASSERT1 ("FftLevel::apply()",
+           "Block %s is not a root Block",
+           block->name().c_str(),
+           block->level() == 0);
+
+  int ib3[3];
+  block->index().array(ib3,ib3+1,ib3+2);
+
+  if (rank_(ib3) == 0) time_start_ = CmiWallTimer();
+
+  callback_[rank_(ib3)] = callback;
+
+  Field field = block->data()->field();
+  const int id_field = field.field_id(field_src_);
+
+  ASSERT1 ("FftLevel::apply()",
+           "Field %s is not defined",
+           field_src_.c_str(),
+           id_field >= 0);
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions(id_field,&mx,&my,&mz);
+  field.ghost_depth(id_field,&gx,&gy,&gz);
+
+  const int nx = n3_[0], ny = n3_[1], nz = n3_[2];
+  std::vector< std::complex<double> > values (nx*ny*nz);
+
+  void * array = field.values(id_field);
+  const int precision = field.precision(id_field);
+
+  if      (precision == precision_single)
+    load_ ((float *)array, values.data(), mx,my,gx,gy,gz, nx,ny,nz);
+  else if (precision == precision_double)
+    load_ ((double *)array, values.data(), mx,my,gx,gy,gz, nx,ny,nz);
+  else if (precision == precision_quadruple)
+    load_ ((long double *)array, values.data(), mx,my,gx,gy,gz, nx,ny,nz);
+  else
+    ERROR1("FftLevel::apply()", "precision %d not recognized", precision);
+
+  int ih3[3];
+  pencil_host_ (0,ib3,ih3);
+  send_ (ih3, phase_x, ib3[0], values.data(), values.size());
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::recv
+(Block * block, int phase, int source, int n, const double * values) throw()
+{
+  initialize_();
+
+  int ib3[3];
+  block->index().array(ib3,ib3+1,ib3+2);
+
+  auto & buffer = buffer_[phase][rank_(ib3)];
+
+  const std::complex<double> * piece =
+    reinterpret_cast<const std::complex<double> *> (values);
+
+  if (phase == phase_block) {
+    buffer.first.assign(piece, piece + n/2);
+  } else {
+    // pencils along the axis of the phase hold nb3_[axis] pieces
+    const int axis = (phase == phase_x || phase == phase_back_x) ? 0
+      :              (phase == phase_y || phase == phase_back_y) ? 1 : 2;
+    if (buffer.first.size() == 0) {
+      buffer.first.resize(nb3_[axis]*n3_[0]*n3_[1]*n3_[2]);
+    }
+    copy_piece_ (buffer.first.data(),
+                 const_cast<std::complex<double> *>(piece),
+                 axis, source, false);
+  }
+
+  if (++buffer.second == num_pieces_(phase)) {
+    complete_ (block,phase);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::fft
+(std::complex<double> * a, int n, int stride, bool inverse)
+{
+  if (n <= 1) return;
+
+  const double sign = inverse ? 1.0 : -1.0;
+  std::vector< std::complex<double> > b(n);
+  for (int i=0; i<n; i++) b[i] = a[i*stride];
+
+  if ((n & (n-1)) == 0) {
+
+    // iterative radix-2: bit-reversal permutation then butterflies
+
+    for (int i=1, j=0; i<n; i++) {
+      int bit = n >> 1;
+      for (; j & bit; bit >>= 1) j ^= bit;
+      j ^= bit;
+      if (i < j) std::swap(b[i],b[j]);
+    }
+    for (int len=2; len<=n; len <<= 1) {
+      const double theta = sign*2.0*cello::pi/len;
+      const std::complex<double> w_len (cos(theta),sin(theta));
+      for (int i=0; i<n; i+=len) {
+        std::complex<double> w = 1.0;
+        for (int j=0; j<len/2; j++) {
+          const std::complex<double> u = b[i+j];
+          const std::complex<double> v = b[i+j+len/2]*w;
+          b[i+j]       = u + v;
+          b[i+j+len/2] = u - v;
+          w *= w_len;
+        }
+      }
+    }
+    for (int i=0; i<n; i++) a[i*stride] = b[i];
+
+  } else {
+
+    // direct DFT for sizes that are not a power of two
+
+    for (int k=0; k<n; k++) {
+      std::complex<double> sum = 0.0;
+      for (int i=0; i<n; i++) {
+        const double theta = sign*2.0*cello::pi*((long(i)*k) % n)/n;
+        sum += b[i]*std::complex<double>(cos(theta),sin(theta));
+      }
+      a[k*stride] = sum;
+    }
+  }
+}
+
+//======================================================================
+
+void FftLevel::pencil_host_ (int axis, const int ib3[3], int ih3[3]) const
+{
+  // rotate the host along each row so that no Block hosts more than
+  // one pencil per axis
+  const int a1 = (axis+1) % 3;
+  const int a2 = (axis+2) % 3;
+  ih3[axis] = (ib3[a1] + ib3[a2]) % nb3_[axis];
+  ih3[a1] = ib3[a1];
+  ih3[a2] = ib3[a2];
+}
+
+//----------------------------------------------------------------------
+
+int FftLevel::num_pieces_ (int phase) const
+{
+  switch (phase) {
+  case phase_x:      return nb3_[0];
+  case phase_y:      return nb3_[1];
+  case phase_z:      return nb3_[2];
+  case phase_back_y: return nb3_[1];
+  case phase_back_x: return nb3_[0];
+  default:           return 1;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::send_
+(const int ib3[3], int phase, int source,
+ const std::complex<double> * values, int n) const
+{
+  Index index (ib3[0],ib3[1],ib3[2]);
+  cello::block_array()[index].p_fft_recv
+    (id_, phase, source, 2*n, (double *)(values));
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::copy_piece_
+(std::complex<double> * pencil, std::complex<double> * piece,
+ int axis, int ip, bool to_piece) const
+{
+  const int nx = n3_[0], ny = n3_[1], nz = n3_[2];
+
+  // pencil dimensions and offset of the piece
+  int m3[3] = {nx, ny, nz};
+  int o3[3] = {0, 0, 0};
+  m3[axis] *= nb3_[axis];
+  o3[axis] = ip*n3_[axis];
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      std::complex<double> * p =
+        pencil + o3[0] + m3[0]*((iy+o3[1]) + m3[1]*(iz+o3[2]));
+      std::complex<double> * q = piece + nx*(iy + ny*iz);
+      if (to_piece) std::copy_n (p,nx,q);
+      else          std::copy_n (q,nx,p);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::complete_ (Block * block, int phase)
+{
+  int ib3[3];
+  block->index().array(ib3,ib3+1,ib3+2);
+  const int rank = rank_(ib3);
+
+  std::vector< std::complex<double> > values;
+  values.swap(buffer_[phase][rank].first);
+  buffer_[phase].erase(rank);
+
+  const int nx = n3_[0], ny = n3_[1], nz = n3_[2];
+  const int N3[3] = { nb3_[0]*nx, nb3_[1]*ny, nb3_[2]*nz };
+
+  if (phase == phase_block) {
+
+    Field field = block->data()->field();
+    const int id_field = field.field_id(field_dst_);
+
+    ASSERT1 ("FftLevel::complete_()",
+             "Field %s is not defined",
+             field_dst_.c_str(),
+             id_field >= 0);
+
+    int mx,my,mz;
+    int gx,gy,gz;
+    field.dimensions(id_field,&mx,&my,&mz);
+    field.ghost_depth(id_field,&gx,&gy,&gz);
+
+    // inverse transforms are unnormalized
+    const double scale = 1.0 / (double(N3[0])*N3[1]*N3[2]);
+    void * array = field.values(id_field);
+    const int precision = field.precision(id_field);
+
+    if      (precision == precision_single)
+      store_ ((float *)array,values.data(),scale, mx,my,gx,gy,gz, nx,ny,nz);
+    else if (precision == precision_double)
+      store_ ((double *)array,values.data(),scale, mx,my,gx,gy,gz, nx,ny,nz);
+    else if (precision == precision_quadruple)
+      store_ ((long double *)array,values.data(),scale,
+              mx,my,gx,gy,gz, nx,ny,nz);
+    else
+      ERROR1("FftLevel::complete_()", "precision %d not recognized",
+             precision);
+
+    if (rank == 0) {
+      cello::monitor()->print
+        ("Fft","%dx%dx%d level 0 on %d PEs: %.6f s",
+         N3[0],N3[1],N3[2],CkNumPes(),CmiWallTimer() - time_start_);
+    }
+
+    const int callback = callback_[rank];
+    callback_.erase(rank);
+    CkCallback(callback,
+               CkArrayIndexIndex(block->index()),
+               block->proxy_array()).send();
+    return;
+  }
+
+  const bool inverse = (phase >= phase_back_y);
+
+  // pencil dimensions and transform axis
+  const int axis = (phase == phase_x || phase == phase_back_x) ? 0
+    :              (phase == phase_y || phase == phase_back_y) ? 1 : 2;
+  int m3[3] = {nx, ny, nz};
+  m3[axis] = N3[axis];
+
+  if (axis == 0) {
+    for (int iz=0; iz<m3[2]; iz++)
+      for (int iy=0; iy<m3[1]; iy++)
+        fft (&values[m3[0]*(iy + m3[1]*iz)], m3[0], 1, inverse);
+  } else if (axis == 1) {
+    for (int iz=0; iz<m3[2]; iz++)
+      for (int ix=0; ix<m3[0]; ix++)
+        fft (&values[ix + m3[0]*m3[1]*iz], m3[1], m3[0], inverse);
+  } else {
+    for (int iy=0; iy<m3[1]; iy++)
+      for (int ix=0; ix<m3[0]; ix++)
+        fft (&values[ix + m3[0]*iy], m3[2], m3[0]*m3[1], inverse);
+  }
+
+  if (phase == phase_z) {
+    const int k03[3] = { ib3[0]*nx, ib3[1]*ny, 0 };
+    spectral (values.data(), k03, m3, N3);
+    for (int iy=0; iy<m3[1]; iy++)
+      for (int ix=0; ix<m3[0]; ix++)
+        fft (&values[ix + m3[0]*iy], m3[2], m3[0]*m3[1], true);
+  }
+
+  // forward phases pass pieces to the pencils along the next axis,
+  // inverse phases to the pencils along the previous axis or Blocks
+
+  const int axis_next =
+    (phase == phase_x) ? 1 :
+    (phase == phase_y) ? 2 :
+    (phase == phase_z) ? 1 :
+    (phase == phase_back_y) ? 0 : -1;
+  const int phase_next =
+    (phase == phase_x) ? phase_y :
+    (phase == phase_y) ? phase_z :
+    (phase == phase_z) ? phase_back_y :
+    (phase == phase_back_y) ? phase_back_x : phase_block;
+
+  std::vector< std::complex<double> > piece (nx*ny*nz);
+  for (int ip=0; ip<nb3_[axis]; ip++) {
+    copy_piece_ (values.data(), piece.data(), axis, ip, true);
+    int jb3[3] = {ib3[0], ib3[1], ib3[2]};
+    jb3[axis] = ip;
+    int ih3[3];
+    if (axis_next >= 0) {
+      pencil_host_ (axis_next,jb3,ih3);
+    } else {
+      ih3[0] = jb3[0];
+      ih3[1] = jb3[1];
+      ih3[2] = jb3[2];
+    }
+    const int source = (axis_next >= 0) ? jb3[axis_next] : 0;
+    send_ (ih3, phase_next, source, piece.data(), piece.size());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FftLevel::initialize_ ()
+{
+  if (nb3_[0] > 0) return;
+
+  const Config * config = cello::config();
+  for (int axis=0; axis<3; axis++) {
+    nb3_[axis] = std::max(1,config->mesh_root_blocks[axis]);
+    n3_[axis] = std::max(1,config->mesh_root_size[axis]) / nb3_[axis];
+  }
+}
+
+//======================================================================
+
+void Block::p_fft_recv
+(int id_fft, int phase, int source, int n, double values[])
+{
+  FftLevel::instance(id_fft)->recv (this,phase,source,n,values);
+}
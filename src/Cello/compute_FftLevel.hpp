@@ -0,0 +1,158 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     compute_FftLevel.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Compute] Declaration of the FftLevel class
+
+#ifndef COMPUTE_FFT_LEVEL_HPP
+#define COMPUTE_FFT_LEVEL_HPP
+
+class FftLevel {
+
+  /// @class    FftLevel
+  /// @ingroup  Compute
+  /// @brief    [\ref Compute] Distributed FFT of a field on the root level
+  ///
+  /// Transforms a field over the uniform grid formed by the root
+  /// Blocks, applies spectral(), and transforms back into another
+  /// field.  The grid is decomposed into pencils of root Blocks, one
+  /// pencil per row of Blocks along each axis, each hosted by one
+  /// Block of its row chosen so that a Block hosts at most one pencil
+  /// per axis:
+  ///
+  ///    1. Blocks send their values to the x-pencil of their row,
+  ///       which transforms along x
+  ///    2. x-pencils send each Block-sized piece to a y-pencil, which
+  ///       transforms along y
+  ///    3. y-pencils likewise send to z-pencils, which transform along
+  ///       z and call spectral() on the transformed values
+  ///
+  /// after which the steps are reversed with inverse transforms and
+  /// each Block receives its values, which are written to the output
+  /// field before its callback is invoked.  Each transpose is an
+  /// all-to-all within a row of Blocks, so no process ever holds more
+  /// than a pencil of the grid.
+  ///
+  /// Subclasses override spectral(), e.g. to multiply by a Green's
+  /// function or accumulate a power spectrum.  Every process must
+  /// construct its FftLevel objects in the same order, as is the case
+  /// for Method members, since the construction order identifies them
+  /// in messages.  Only one transform per FftLevel may be in progress.
+
+public: // interface
+
+  /// Create an FftLevel transforming field_src into field_dst
+  FftLevel (std::string field_src = "",
+            std::string field_dst = "") throw();
+
+  /// Destructor
+  virtual ~FftLevel() throw();
+
+  /// Not copyable, since the id refers to this object
+  FftLevel (const FftLevel &) = delete;
+  FftLevel & operator= (const FftLevel &) = delete;
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Start the transform on a root Block; must be called on every root
+  /// Block, and invokes the Block entry method callback when the
+  /// Block's output field is written
+  void apply (Block * block, int callback) throw();
+
+  /// Receive values sent to the given Block during a transform
+  void recv (Block * block, int phase, int source,
+             int n, const double * values) throw();
+
+  /// Return the FftLevel with the given id on this process
+  static FftLevel * instance (int id)
+  { return instances_[cello::index_static()].at(id); }
+
+  /// In-place complex FFT of n values separated by stride; inverse
+  /// transforms are unnormalized
+  static void fft (std::complex<double> * a, int n, int stride,
+                   bool inverse);
+
+protected: // virtual functions
+
+  /// Operate on the transform of field_src in a z-pencil, which holds
+  /// nk3 wavenumbers starting at k03 of the n3 grid, with x varying
+  /// fastest.  The default leaves the values unchanged.
+  virtual void spectral (std::complex<double> * values,
+                         const int k03[3], const int nk3[3],
+                         const int n3[3]) throw()
+  { }
+
+private: // functions
+
+  /// Axis-ordered phases of the transform
+  enum phase_type {
+    phase_x,      // Block values to x-pencil
+    phase_y,      // x-pencil pieces to y-pencil
+    phase_z,      // y-pencil pieces to z-pencil
+    phase_back_y, // z-pencil pieces back to y-pencil
+    phase_back_x, // y-pencil pieces back to x-pencil
+    phase_block,  // x-pencil pieces back to Block
+    num_phases
+  };
+
+  /// Root Block hosting the pencil along axis containing root Block ib3
+  void pencil_host_ (int axis, const int ib3[3], int ih3[3]) const;
+
+  /// Rank of root Block ib3 among the root Blocks
+  int rank_ (const int ib3[3]) const
+  { return ib3[0] + nb3_[0]*(ib3[1] + nb3_[1]*ib3[2]); }
+
+  /// Number of pieces received by a pencil or Block in the phase
+  int num_pieces_ (int phase) const;
+
+  /// Send a piece of values to a root Block
+  void send_ (const int ib3[3], int phase, int source,
+              const std::complex<double> * values, int n) const;
+
+  /// Copy between a pencil along axis and the piece of it belonging
+  /// to root Block offset ip along that axis
+  void copy_piece_ (std::complex<double> * pencil,
+                    std::complex<double> * piece,
+                    int axis, int ip, bool to_piece) const;
+
+  /// Continue once the pencil or Block has received all pieces
+  void complete_ (Block * block, int phase);
+
+  /// Initialize the grid description from the configuration
+  void initialize_ ();
+
+private: // attributes
+
+  /// Field transformed
+  std::string field_src_;
+
+  /// Field receiving the result
+  std::string field_dst_;
+
+  /// Index of this object in instances_
+  int id_;
+
+  /// Number of root Blocks along each axis
+  int nb3_[3];
+
+  /// Number of cells per root Block along each axis
+  int n3_[3];
+
+  /// Transient pencil and Block buffers on this process, by phase and
+  /// root Block rank: values and number of pieces received (not packed)
+  std::map< int, std::pair< std::vector< std::complex<double> >, int > >
+  buffer_[num_phases];
+
+  /// Callback for each root Block rank on this process (not packed)
+  std::map<int,int> callback_;
+
+  /// Wall time when root Block 0 started the transform (not packed)
+  double time_start_;
+
+  /// FftLevel objects on each process, in construction order
+  static std::vector<FftLevel *> instances_[CONFIG_NODE_SIZE];
+};
+
+#endif /* COMPUTE_FFT_LEVEL_HPP */
@@ -56,6 +56,14 @@ public: // virtual functions
   /// How many ghost zones required for matvec
   virtual int ghost_depth() const throw() = 0;
 
+  /// Apply n weighted Jacobi sweeps X <-- X + w*(B - A*X)/diag(A) in a
+  /// single fused pass per sweep, sweep k excluding g0 + k*ghost_depth()
+  /// layers.  Returns false if not implemented by the Matrix, in which
+  /// case the caller must use residual() and diagonal() instead
+  virtual bool jacobi (int ix, int ib, double w, int n,
+                       Block * block, int g0=1) throw()
+  { return false; }
+
 protected: // functions
 
   template<class T>
@@ -36,7 +36,7 @@ Solver::Solver (std::string name,
                 int max_level) throw()
   : PUP::able(),
     name_(name),
-    ix_(-1),ib_(-1),
+    ix_(-1),ib_(-1),ix0_(-1),
     monitor_iter_(monitor_iter),
     restart_cycle_(restart_cycle),
     callback_(0),
@@ -47,7 +47,10 @@ Solver::Solver (std::string name,
     solve_type_(solve_type),
     index_prolong_(index_prolong),
     index_restrict_(index_restrict),
-    ir_post_(-1)
+    ir_post_(-1),
+    res_tol_change_(0.0),
+    res_tol_level_(),
+    iter_max_level_()
 {
   FieldDescr * field_descr = cello::field_descr();
   ix_ = field_descr->field_id(field_x);
@@ -60,7 +63,7 @@ Solver::Solver (std::string name,
 Solver::Solver () throw()
   : PUP::able(),
     name_(""),
-    ix_(-1),ib_(-1),
+    ix_(-1),ib_(-1),ix0_(-1),
     monitor_iter_(0),
     restart_cycle_(1),
     callback_(0),
@@ -71,7 +74,10 @@ Solver::Solver () throw()
     solve_type_(solve_leaf),
     index_prolong_(0),
     index_restrict_(0),
-    ir_post_(-1)
+    ir_post_(-1),
+    res_tol_change_(0.0),
+    res_tol_level_(),
+    iter_max_level_()
 {
   ir_post_ = add_refresh_();
 }
@@ -135,6 +141,40 @@ bool Solver::reuse_solution_ (int cycle) const throw()
 
 //----------------------------------------------------------------------
 
+int Solver::level_index_ (Block * block, int list_length) const throw()
+{
+  // Only Blocks in level and block solves share the same level, so
+  // that all Blocks in the solve make the same convergence decision
+
+  if (list_length == 0 ||
+      (solve_type_ != solve_level && solve_type_ != solve_block)) {
+    return -1;
+  }
+  const int i = block->level() - std::max(min_level_,
+                                          cello::hierarchy()->min_level());
+  return std::min(std::max(i,0),list_length-1);
+}
+
+//----------------------------------------------------------------------
+
+double Solver::adaptive_res_tol_
+(Block * block, double res_tol, double err0) const throw()
+{
+  const int i = level_index_(block,res_tol_level_.size());
+  if (i >= 0) res_tol = res_tol_level_[i];
+  return std::max(res_tol, res_tol_change_*err0);
+}
+
+//----------------------------------------------------------------------
+
+int Solver::adaptive_iter_max_ (Block * block, int iter_max) const throw()
+{
+  const int i = level_index_(block,iter_max_level_.size());
+  return (i >= 0) ? std::min(iter_max,iter_max_level_[i]) : iter_max;
+}
+
+//----------------------------------------------------------------------
+
 void Solver::begin_(Block * block)
 {
 #ifdef TRACE_SOLVER  
@@ -144,6 +184,11 @@ void Solver::begin_(Block * block)
 #endif  
 	    
   block->push_solver(index_);
+
+  Performance * performance = cello::simulation()->performance();
+  if (performance->trace_active()) {
+    performance->trace_begin ("solver:" + name_, block->name());
+  }
 }
 
 //----------------------------------------------------------------------
@@ -161,6 +206,11 @@ void Solver::end_(Block * block)
 	  "Solver mismatch was %d expected %d",
 	  index,index_,(index == index_));
 
+  Performance * performance = cello::simulation()->performance();
+  if (performance->trace_active()) {
+    performance->trace_end ("solver:" + name_, block->name());
+  }
+
   CkCallback(callback_,
 	     CkArrayIndexIndex(block->index()),
 	     block->proxy_array()).send();
@@ -40,7 +40,7 @@ public: // interface
   Solver (CkMigrateMessage *m)
     : PUP::able (m),
       name_(""),
-      ix_(-1),ib_(-1),
+      ix_(-1),ib_(-1),ix0_(-1),
       monitor_iter_(0),
       restart_cycle_(1),
       callback_(0),
@@ -51,7 +51,10 @@ public: // interface
       solve_type_(solve_leaf),
       index_prolong_(0),
       index_restrict_(0),
-      ir_post_(-1)
+      ir_post_(-1),
+      res_tol_change_(0.0),
+      res_tol_level_(),
+      iter_max_level_()
   { }
 
   /// Destructor
@@ -68,6 +71,7 @@ public: // interface
     p | name_;
     p | ix_;
     p | ib_;
+    p | ix0_;
     p | monitor_iter_;
     p | restart_cycle_;
     p | callback_;
@@ -79,6 +83,9 @@ public: // interface
     p | index_prolong_;
     p | index_restrict_;
     p | ir_post_;
+    p | res_tol_change_;
+    p | res_tol_level_;
+    p | iter_max_level_;
   }
 
   Refresh * refresh(size_t index=0) ;
@@ -98,6 +105,23 @@ public: // interface
   void set_field_b (int ib)
   { ib_ = ib;  }
 
+  /// Set the field holding an initial guess for X, or -1 to start
+  /// from X = 0.  Only used by solvers that support initial guesses
+  void set_field_x0 (int ix0)
+  { ix0_ = ix0;  }
+
+  /// Set the adaptive convergence policy: converge once the error is
+  /// below res_tol_change times the initial error, and use per-level
+  /// tolerances and iteration caps (index 0 for min_level)
+  void set_adaptive_tolerance (double res_tol_change,
+                               std::vector<double> res_tol_level,
+                               std::vector<int> iter_max_level)
+  {
+    res_tol_change_ = res_tol_change;
+    res_tol_level_  = res_tol_level;
+    iter_max_level_ = iter_max_level;
+  }
+
   void set_min_level (int min_level)
   { min_level_ = min_level; }
 
@@ -208,6 +232,19 @@ protected: // functions
 
   bool reuse_solution_ (int cycle) const throw();
 
+  /// Return the residual tolerance for the solve containing the
+  /// Block, given the default tolerance and the initial error err0
+  /// (0 to ignore Solver:<s>:res_tol_change)
+  double adaptive_res_tol_ (Block * block, double res_tol,
+                            double err0 = 0.0) const throw();
+
+  /// Return the iteration limit for the solve containing the Block
+  int adaptive_iter_max_ (Block * block, int iter_max) const throw();
+
+  /// Return the index into per-level parameter lists for the solve
+  /// containing the Block, or -1 if the lists do not apply
+  int level_index_ (Block * block, int list_length) const throw();
+
 protected: // attributes
 
   /// Name of the solver
@@ -218,6 +255,9 @@ protected: // attributes
   
   /// Field id for right-hand side
   int ib_;
+
+  /// Field id for initial guess, or -1 if none
+  int ix0_;
   
   /// How often to write output
   int monitor_iter_;
@@ -251,6 +291,15 @@ protected: // attributes
   
   /// New Refresh id for after the solver
   int ir_post_;
+
+  /// Converge once the error is below this times the initial error
+  double res_tol_change_;
+
+  /// Residual tolerance by level, starting at min_level_
+  std::vector<double> res_tol_level_;
+
+  /// Iteration cap by level, starting at min_level_
+  std::vector<int> iter_max_level_;
 };
 
 #endif /* COMPUTE_SOLVER_HPP */
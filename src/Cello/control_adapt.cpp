@@ -58,7 +58,14 @@ void Block::adapt_enter_()
   TRACE_ADAPT("adapt_enter_",this);
   if ( do_adapt_()) {
 
-    adapt_begin_();
+    const int initial_cycle = cello::config()->initial_cycle;
+    const bool is_first_cycle = (initial_cycle == cycle());
+
+    if (cello::config()->adapt_precheck && ! is_first_cycle) {
+      adapt_precheck_();
+    } else {
+      adapt_begin_();
+    }
 
   } else {
 
@@ -69,7 +76,38 @@ void Block::adapt_enter_()
 
 //----------------------------------------------------------------------
 
-void Block::adapt_begin_()
+/// @brief Optional first step of the adapt phase: skip the adapt
+/// protocol if no refinement criteria decision has changed.
+///
+/// With Adapt:precheck, leaf Blocks evaluate the refinement criteria
+/// and compare the decision with that of the last adapt.  If no
+/// Block's decision changed, the mesh would not change, so a single
+/// reduction replaces the level exchange and barriers of the full
+/// adapt phase.  Otherwise the full phase continues with the levels
+/// already computed.
+
+void Block::adapt_precheck_()
+{
+  TRACE_ADAPT("adapt_precheck_",this);
+
+  int changed = 0;
+  if (is_leaf()) {
+    const int level_maximum = cello::config()->mesh_max_level;
+    level_next_ = adapt_compute_desired_level_(level_maximum);
+    const int decision =
+      (level_next_ > level()) ? adapt_refine :
+      (level_next_ < level()) ? adapt_coarsen : adapt_same;
+    changed = (decision != adapt_decision_) ? 1 : 0;
+  }
+
+  CkCallback callback = CkCallback
+    (CkIndex_Block::r_adapt_precheck(nullptr), proxy_array());
+  contribute(sizeof(int),&changed,CkReduction::sum_int, callback);
+}
+
+//----------------------------------------------------------------------
+
+void Block::adapt_begin_(bool compute_level)
 {
   TRACE_ADAPT("adapt_begin_",this);
 
@@ -81,9 +119,15 @@ void Block::adapt_begin_()
     adapt_.write("adapt",this,DEBUG_CYCLE_START);
 #endif
 
-  // Evaluate local mesh refinement criteria
+  // Evaluate local mesh refinement criteria, unless already evaluated
+  // by adapt_precheck_()
     const int level_maximum = cello::config()->mesh_max_level;
-    level_next_ = adapt_compute_desired_level_(level_maximum);
+    if (compute_level) {
+      level_next_ = adapt_compute_desired_level_(level_maximum);
+    }
+    adapt_decision_ =
+      (level_next_ > level()) ? adapt_refine :
+      (level_next_ < level()) ? adapt_coarsen : adapt_same;
 
     // Reset adapt level bounds for next adapt phase
     adapt_.reset_bounds();
@@ -124,15 +168,46 @@ void Block::adapt_barrier_()
 {
   if (! adapt_balanced_) {
     adapt_balanced_ = true;
+    // neighbors must see final bounds before the barrier completes
+    if (adapt_send_pending_) {
+      adapt_send_pending_ = false;
+      adapt_send_level();
+    }
     TRACE_ADAPT("calling contribute",this);
-    int changed = (is_leaf() && (level() != level_next_)) ? 1 : 0;
+    // sum: changed, leaves, rounds, messages; max: rounds
+    long long data[7];
+    data[0] = 4;
+    data[1] = 1;
+    data[2] = (is_leaf() && (level() != level_next_)) ? 1 : 0;
+    data[3] = is_leaf() ? 1 : 0;
+    data[4] = adapt_num_sends_;
+    data[5] = adapt_num_messages_;
+    data[6] = adapt_num_sends_;
     CkCallback callback = CkCallback
       (CkIndex_Block::r_adapt_next(nullptr), 
        proxy_array());
     adapt_ready_ = true;
-    contribute(sizeof(int),&changed,CkReduction::sum_int, callback);
+    contribute(sizeof(data),data,r_reduce_performance_type, callback);
   }
 }
+
+//----------------------------------------------------------------------
+
+int Block::adapt_statistics_(CkReductionMsg * msg)
+{
+  const long long * data = (const long long *) msg->getData();
+  const long long num_leaves = data[3];
+
+  if (index_.is_root()) {
+    cello::monitor()->print
+      ("Adapt","step %d leaf Blocks %lld rounds %.2f mean %lld max "
+       "messages %lld (%.2f per leaf)",
+       adapt_step_, num_leaves,
+       (num_leaves > 0) ? double(data[4])/num_leaves : 0.0, data[6],
+       data[5], (num_leaves > 0) ? double(data[5])/num_leaves : 0.0);
+  }
+  return data[2];
+}
 //----------------------------------------------------------------------
 
 /// @brief Third step of the adapt phase: coarsen or refine according
@@ -227,6 +302,9 @@ void Block::adapt_end_()
   TRACE_ADAPT("adapt_end_",this);
   adapt_.reset_face_level(Adapt::LevelType::last);
 
+  // neighbors may have changed, so sparse refreshes must send all fields
+  data()->field_data()->set_all_modified();
+
   sync_coarsen_.reset();
   sync_coarsen_.set_stop(cello::num_children());
 
@@ -238,6 +316,9 @@ void Block::adapt_end_()
   adapt_step_++;
   adapt_ready_ = false;
   adapt_balanced_ = false;
+  adapt_send_pending_ = false;
+  adapt_num_sends_ = 0;
+  adapt_num_messages_ = 0;
 
   if (adapt_again) {
     control_sync_quiescence (CkIndex_Main::p_adapt_enter());
@@ -275,6 +356,9 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   TRACE_ADAPT("adapt_compute_desired_level_",this);
   if (! is_leaf()) return adapt_same;
 
+  // Quiescent Blocks keep their level without evaluating the criteria
+  if (is_quiescent()) return level();
+
   int adapt = adapt_unknown;
 
   int level = this->level();
@@ -283,9 +367,24 @@ int Block::adapt_compute_desired_level_(int level_maximum)
   Problem * problem = cello::problem();
   Refine * refine;
 
+  const int initial_cycle = cello::config()->initial_cycle;
+  const bool is_first_cycle = (initial_cycle == cycle());
+
+  // The combined result is the maximum over criteria, so stop
+  // evaluating once it cannot change: once any criterion refines, or
+  // once any does not coarsen if the Block cannot refine.  Criteria
+  // writing output fields are always evaluated.
+
+  const bool can_refine  = (level < level_maximum);
+  const bool can_coarsen = (level > 0 && ! is_first_cycle);
+  const int adapt_final =
+    can_refine ? adapt_refine : (can_coarsen ? adapt_same : adapt_unknown);
+
   int index_refine = 0;
   while ((refine = problem->refine(index_refine++))) {
 
+    if (adapt >= adapt_final && ! refine->has_output()) continue;
+
     Schedule * schedule = refine->schedule();
 
     if ((schedule==NULL) || schedule->write_this_cycle(cycle(),time()) ) {
@@ -293,8 +392,6 @@ int Block::adapt_compute_desired_level_(int level_maximum)
     }
 
   }
-  const int initial_cycle = cello::config()->initial_cycle;
-  const bool is_first_cycle = (initial_cycle == cycle());
 
   if (adapt == adapt_coarsen && level > 0 && ! is_first_cycle)
     level_desired = level - 1;
@@ -345,6 +442,19 @@ void Block::adapt_refine_()
 
   particle_scatter_children_ (particle_list,particle);
 
+  // Delete particles since relocated to children, before creating
+  // the children to limit the peak memory of refining
+
+  int count = 0;
+  int nt = particle.num_types();
+  for (int it=0; it<nt; it++) {
+    int nb = particle.num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+      count += particle.delete_particles (it, ib);
+    }
+  }
+  cello::simulation()->data_delete_particles(count);
+
   // For each new child
 
   const int rank = cello::rank();
@@ -375,8 +485,10 @@ void Block::adapt_refine_()
       // @@@ should be true but ~FieldFace() crashes
       data_msg -> set_field_face (field_face,false);
       data_msg -> set_field_data (data()->field_data(),false);
-      ParticleData * p_data = new ParticleData(*particle_list[IC3(ic3)]);
-      data_msg -> set_particle_data (p_data,true);
+      // the message takes the child's particles, which were scattered
+      // only for this child
+      data_msg -> set_particle_data (particle_list[IC3(ic3)],true);
+      particle_list[IC3(ic3)] = nullptr;
 
       const Factory * factory = cello::simulation()->factory();
 
@@ -386,6 +498,11 @@ void Block::adapt_refine_()
       char * array = 0;
       int num_field_data = 1;
 
+      int face_level_child[27];
+      for (int i=0; i<27; i++) {
+        face_level_child[i] = child_face_level_curr_[27*IC3(ic3)+i];
+      }
+
       factory->create_block
 	(
 	 data_msg,
@@ -396,7 +513,7 @@ void Block::adapt_refine_()
 	 cycle_,time_,dt_,
 	 narray, array, refresh_fine,
 	 27,
-         &child_face_level_curr_.data()[27*IC3(ic3)],
+         face_level_child,
          &adapt_,
 	 cello::simulation());
 
@@ -412,18 +529,6 @@ void Block::adapt_refine_()
     delete particle_list[i];
   }
 
-  // Delete particles since relocated to children
-
-  int count = 0;
-  int nt = particle.num_types();
-  for (int it=0; it<nt; it++) {
-    int nb = particle.num_batches(it);
-    for (int ib=0; ib<nb; ib++) {
-      count += particle.delete_particles (it, ib);
-    }
-  }
-  cello::simulation()->data_delete_particles(count);
-
   adapt_.set_valid(false);
   is_leaf_ = false;
   TRACE_ADAPT("adapt_refine exit",this);
@@ -546,6 +651,8 @@ void Block::adapt_send_level()
   adapt_.update_bounds();
   adapt_.get_level_bounds(&level_min,&level_max,&can_coarsen);
 
+  ++adapt_num_sends_;
+
   ItNeighbor it_neighbor = this->it_neighbor(index_);
   int of3[3];
   std::map<Index,int> index_count;
@@ -577,8 +684,9 @@ void Block::adapt_send_level()
     // }
     if (index_first[index_neighbor]) {
 
-      msg_map[index_neighbor] = new MsgAdapt
+      msg_map[index_neighbor] = new (8*sizeof(int)) MsgAdapt
         (adapt_step_,index_,ic3,of3,level,level_min,level_max,can_coarsen);
+      message_set_priority_ (msg_map[index_neighbor],phase_adapt);
       index_first[index_neighbor] = false;
     } else {
       msg_map[index_neighbor]->add_face(of3);
@@ -595,12 +703,43 @@ void Block::adapt_send_level()
                 name().c_str(),name(index_neighbor).c_str());
 #endif
       thisProxy[index_neighbor].p_adapt_recv_level (msg_map[index_neighbor]);
+      ++adapt_num_messages_;
     }
   }
   TRACE_ADAPT("calling adapt_recv_level",this);
   adapt_recv_level();
 }
 
+//----------------------------------------------------------------------
+
+/// With Adapt:batch, a Block whose bounds change does not resend its
+/// levels once per received message.  Instead a single send is queued
+/// behind the MsgAdapt messages already delivered to this process, so
+/// that all of them are applied before one updated message per
+/// neighbor is sent.  This reduces the number of rounds and messages
+/// in each adapt step without changing the converged levels.
+
+void Block::adapt_send_level_deferred_()
+{
+  if (! cello::config()->adapt_batch) {
+    adapt_send_level();
+  } else if (! adapt_send_pending_) {
+    adapt_send_pending_ = true;
+    thisProxy[index_].p_adapt_send_level();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_adapt_send_level()
+{
+  // may have already been sent by adapt_barrier_()
+  if (adapt_send_pending_) {
+    adapt_send_pending_ = false;
+    adapt_send_level();
+  }
+}
+
 void Block::p_adapt_recv_level (MsgAdapt * msg)
 {
   if (!adapt_ready_) {
@@ -795,7 +934,7 @@ void Block::adapt_recv_level
   }
   if (changed) {
     level_next_ = level_min;
-    adapt_send_level();
+    adapt_send_level_deferred_();
   }
   TRACE_ADAPT("testing convergence",this);
   if (adapt_.neighbors_converged() && adapt_.is_converged()) {
@@ -941,6 +1080,34 @@ void Block::adapt_coarsen_()
 
   msg->set_data_msg (data_msg);
 
+  if (thisProxy[index_parent].ckLocal() == nullptr) {
+
+    // Parent is remote: send the messages of siblings on this process
+    // together, once the last of them has coarsened.  (A local parent
+    // restricts each child in place without packing.)
+
+    const int rank = cello::rank();
+    int num_local = 0;
+    ItChild it_child (rank);
+    int jc3[3];
+    while (it_child.next(jc3)) {
+      Index index_sibling = index_parent.index_child(jc3);
+      if (thisProxy[index_sibling].ckLocal() != nullptr) ++num_local;
+    }
+
+    auto & pending = MsgCoarsen::pending[cello::index_static()];
+    auto it = pending.find(index_parent);
+    if (it != pending.end()) {
+      it->second->append(msg);
+      msg = it->second;
+    }
+    if (msg->num_children() < num_local) {
+      pending[index_parent] = msg;
+      return;
+    }
+    pending.erase(index_parent);
+  }
+
   thisProxy[index_parent].p_adapt_recv_child (msg);
 
 }
@@ -953,6 +1120,25 @@ void Block::p_adapt_recv_child (MsgCoarsen * msg)
   TRACE_ADAPT("p_adapt_recv_child",this);
 
   performance_start_(perf_adapt_update);
+
+  // Messages of sibling children sent with this one refer to its
+  // buffer, which update() frees, so are applied first
+  for (MsgCoarsen * msg_next = msg->next(); msg_next;
+       msg_next = msg_next->next()) {
+    adapt_recv_child_(msg_next);
+  }
+  adapt_recv_child_(msg);
+
+  delete msg;
+
+  performance_stop_(perf_adapt_update);
+  performance_start_(perf_adapt_update_sync);
+}
+
+//----------------------------------------------------------------------
+
+void Block::adapt_recv_child_ (MsgCoarsen * msg)
+{
   msg->update(data());
   int * ic3 = msg->ic3();
   int * child_face_level_curr = msg->face_level();
@@ -987,11 +1173,6 @@ void Block::p_adapt_recv_child (MsgCoarsen * msg)
   adapt_delete_child_(index_child);
 
   age_ = 0;
-
-  delete msg;
-
-  performance_stop_(perf_adapt_update);
-  performance_start_(perf_adapt_update_sync);
 }
 
 
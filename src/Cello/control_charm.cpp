@@ -102,7 +102,7 @@ void Block::output_exit_()
 	    name().c_str(),__FILE__,__LINE__);
   fflush(stdout);
 #endif  
-  control_sync_barrier (CkIndex_Block::r_stopping_enter(NULL));
+  control_sync_barrier_arrival_ (CkIndex_Block::r_stopping_enter(NULL));
 
 }
 
@@ -145,7 +145,7 @@ void Block::compute_exit_ ()
 {
   TRACE_CONTROL("compute_exit");
 
-  control_sync_barrier(CkIndex_Block::r_adapt_enter(NULL));
+  control_sync_barrier_arrival_(CkIndex_Block::r_adapt_enter(NULL));
 }
 
 //----------------------------------------------------------------------
@@ -203,6 +203,41 @@ void Block::control_sync_barrier (int entry_point)
 
 //----------------------------------------------------------------------
 
+void Block::control_sync_barrier_arrival_ (int entry_point)
+{
+  if (! cello::config()->performance_critical_path) {
+    control_sync_barrier (entry_point);
+    return;
+  }
+
+  int v3[3];
+  index_.values(v3);
+  const double time = CkWallTimer();
+  double arrival[5] = { time, time, double(v3[0]), double(v3[1]), double(v3[2]) };
+
+  contribute(5*sizeof(double), arrival, r_reduce_arrival_type,
+             CkCallback (entry_point,thisProxy));
+}
+
+//----------------------------------------------------------------------
+
+void Block::barrier_arrival_ (CkReductionMsg * msg, const char * phase) const
+{
+  if (! index_.is_root()) return;
+  if (msg->getSize() != int(5*sizeof(double))) return;
+
+  const double * arrival = (const double *) msg->getData();
+  int v3[3] = { int(arrival[2]), int(arrival[3]), int(arrival[4]) };
+  Index index_last;
+  index_last.set_values(v3);
+
+  cello::monitor()->print
+    ("Performance","barrier %s skew %.6f last %s",
+     phase, arrival[1] - arrival[0], name(index_last).c_str());
+}
+
+//----------------------------------------------------------------------
+
 void Block::control_sync_neighbor(int entry_point, int id_sync,
 				  int min_face_rank,
 				  int neighbor_type,
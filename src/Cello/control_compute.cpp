@@ -33,6 +33,8 @@ void Block::compute_begin_ ()
 
   cello::simulation()->set_phase(phase_compute);
 
+  quiescent_update_();
+
   index_method_ = 0;
   compute_next_();
 }
@@ -56,9 +58,46 @@ void Block::compute_next_ ()
 
     int ir_post = method->refresh_id_post();
 
-    cello::refresh(ir_post)->set_active (is_leaf());
+    Refresh * refresh = cello::refresh(ir_post);
 
-    refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+    refresh->set_active (is_leaf());
+
+    if (skip_method_(method)) {
+
+      // non-leaf Block: no compute and no refresh
+
+      index_method_++;
+      compute_next_();
+      return;
+    }
+
+    Schedule * schedule = method->schedule();
+    const bool is_scheduled =
+      (schedule==NULL) ||
+      (schedule->write_this_cycle(cycle_,time_));
+
+    if (method->refresh_fused()) {
+
+      // ghost zones were updated by a preceding Method's refresh
+
+      thisProxy[thisIndex].p_compute_continue();
+
+    } else if (method->overlap_refresh() && refresh->is_active() &&
+               is_scheduled) {
+
+      // split-phase: compute interior while ghost faces are in flight
+
+      refresh_send (ir_post);
+
+      method->compute_interior (this);
+
+      refresh_wait (ir_post,CkIndex_Block::p_compute_continue());
+
+    } else {
+
+      refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+
+    }
 
   } else {
 
@@ -69,6 +108,133 @@ void Block::compute_next_ ()
 
 //----------------------------------------------------------------------
 
+bool Block::skip_method_ (Method * method) const
+{
+  if (is_leaf() || ! method->leaf_only()) return false;
+
+  // an inactive refresh still synchronizes non-leaf Blocks unless it
+  // only synchronizes with (leaf) neighbors
+  const Refresh * refresh = cello::refresh(method->refresh_id_post());
+  return (method->refresh_fused() || refresh->sync_type() == sync_neighbor);
+}
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Append the interior values of a field to values, returning the
+  /// maximum change relative to the previous values starting at
+  /// values_prev, or -1 if there are none
+  template <class T>
+  double quiescent_change_
+  (const T * field, int mx, int my, int gx, int gy, int gz,
+   int nx, int ny, int nz,
+   std::vector<double> & values, const double * values_prev)
+  {
+    double change = values_prev ? 0.0 : -1.0;
+    for (int iz=gz; iz<gz+nz; iz++) {
+      for (int iy=gy; iy<gy+ny; iy++) {
+        for (int ix=gx; ix<gx+nx; ix++) {
+          const double value = field[ix + mx*(iy + my*iz)];
+          if (values_prev) {
+            const double value_prev = values_prev[values.size()];
+            const double scale = std::max(std::abs(value_prev),1e-30);
+            change = std::max(change,std::abs(value - value_prev)/scale);
+          }
+          values.push_back(value);
+        }
+      }
+    }
+    return change;
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+bool Block::is_quiescent() const
+{
+  const int num_cycles = cello::config()->adapt_quiescent_cycles;
+  return (num_cycles > 0 && quiescent_count_ >= num_cycles);
+}
+
+//----------------------------------------------------------------------
+
+void Block::quiescent_update_()
+{
+  const Config * config = cello::config();
+  const std::vector<std::string> & field_list =
+    config->adapt_quiescent_fields;
+
+  if (field_list.empty() || ! is_leaf()) {
+    quiescent_count_ = 0;
+    quiescent_values_.clear();
+    return;
+  }
+
+  Field field = data()->field();
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+  const size_t num_values = size_t(nx)*ny*nz*field_list.size();
+
+  std::vector<double> values;
+  values.reserve(num_values);
+
+  const double * values_prev = (quiescent_values_.size() == num_values) ?
+    quiescent_values_.data() : nullptr;
+
+  double change = 0.0;
+  for (const std::string & name : field_list) {
+    const int id_field = field.field_id(name);
+    ASSERT1 ("Block::quiescent_update_()",
+             "Adapt:quiescent_fields field %s is not defined",
+             name.c_str(), id_field >= 0);
+    int mx,my,mz, gx,gy,gz;
+    field.dimensions(id_field,&mx,&my,&mz);
+    field.ghost_depth(id_field,&gx,&gy,&gz);
+    const void * array = field.values(id_field);
+    const int precision = field.precision(id_field);
+    double change_field = 0.0;
+    if      (precision == precision_single)
+      change_field = quiescent_change_
+        ((const float *)array, mx,my,gx,gy,gz, nx,ny,nz, values,values_prev);
+    else if (precision == precision_double)
+      change_field = quiescent_change_
+        ((const double *)array, mx,my,gx,gy,gz, nx,ny,nz, values,values_prev);
+    else if (precision == precision_quadruple)
+      change_field = quiescent_change_
+        ((const long double *)array, mx,my,gx,gy,gz, nx,ny,nz,
+         values,values_prev);
+    else
+      ERROR1("Block::quiescent_update_()",
+             "precision %d not recognized", precision);
+    change = std::max(change,change_field);
+  }
+
+  if (values_prev == nullptr) {
+    quiescent_count_ = 0;
+  } else if (change < config->adapt_quiescent_tolerance) {
+    ++quiescent_count_;
+  } else {
+    quiescent_count_ = 0;
+  }
+
+  // Bound the error of skipping work: after Adapt:quiescent_max_skip
+  // quiescent cycles, the Block must show it is still quiescent with
+  // every Method applied
+
+  const int max_skip = config->adapt_quiescent_max_skip;
+  if (max_skip > 0 &&
+      quiescent_count_ >= config->adapt_quiescent_cycles + max_skip) {
+    quiescent_count_ = 0;
+  }
+
+  quiescent_values_.swap(values);
+}
+
+//----------------------------------------------------------------------
+
 void Block::compute_continue_ ()
 {
   performance_start_(perf_compute,__FILE__,__LINE__);
@@ -81,11 +247,21 @@ void Block::compute_continue_ ()
   //  double time_start = CmiWallTimer();
 #endif
 
+  if (index_method_side_ >= 0) {
+
+    // refresh completed for a Method run while the current one waits
+
+    compute_side_continue_();
+    performance_stop_(perf_compute,__FILE__,__LINE__);
+    return;
+  }
+
   Method * method = this->method();
   Schedule * schedule = method->schedule();
   bool is_scheduled = 
-    (schedule==NULL) ||
-    (schedule->write_this_cycle(cycle_,time_));
+    ((schedule==NULL) ||
+     (schedule->write_this_cycle(cycle_,time_))) &&
+    ! (method->skip_quiescent() && is_quiescent());
 
   if (is_scheduled) {
     TRACE2 ("Block::compute_continue() method = %d %p\n",
@@ -97,10 +273,44 @@ void Block::compute_continue_ ()
 	      CkMyPe(),name().c_str(),method->name().c_str());
     CkPrintf ("DEBUG_TRACE_REFRESH Method %s compute()\n",method->name().c_str());
 #endif
-    // Apply the method to the Block
+    if (method->batch()) {
+
+      // Join this process's pending batch, which is computed once
+      // messages already queued on this process (e.g. refresh data
+      // completing other Blocks) have been processed
+
+      if (method->batch_add(this)) {
+        thisProxy[thisIndex].p_compute_batch();
+      }
+
+    } else {
+
+      // Run following independent Methods while this one waits on
+      // its reductions and refreshes
+
+      const bool overlap = (method->overlap_end() > index_method_ + 1);
+
+      if (overlap) {
+        index_method_side_ = index_method_ + 1;
+        overlap_main_done_ = false;
+      }
+
+      // Apply the method to the Block; compute_done() may advance
+      // index_method_ before compute() returns
+
+      const int index_method = index_method_;
+      const long long trace_start = trace_start_();
+      method_counters_start_();
+
+      method->compute (this);
+
+      method_counters_stop_(index_method);
+      trace_stop_ ("method:" + method->name(), trace_start);
+
+      if (overlap) compute_side_next_();
+
+    }
 
-    method->compute (this);
-    
     performance_stop_(perf_compute,__FILE__,__LINE__);
 
   } else {
@@ -113,12 +323,148 @@ void Block::compute_continue_ ()
 
 //----------------------------------------------------------------------
 
+void Block::compute_batch_ ()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  Method * method = this->method();
+
+  std::vector<Block *> blocks = method->batch_take();
+
+#ifdef DEBUG_COMPUTE
+  if (cycle() >= CYCLE)
+    CkPrintf ("%d %s DEBUG_COMPUTE applying Method %s to %d Blocks\n",
+              CkMyPe(),name().c_str(),method->name().c_str(),
+              int(blocks.size()));
+#endif
+
+  const int index_method = index_method_;
+  const long long trace_start = trace_start_();
+  method_counters_start_();
+
+  method->compute_batch (blocks);
+
+  method_counters_stop_(index_method);
+  trace_stop_ ("method:" + method->name() + ":batch", trace_start);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void Block::compute_side_next_ ()
+{
+  const int index_end = method()->overlap_end();
+
+  if (index_method_side_ < index_end) {
+
+    Method * method_side = cello::problem()->method(index_method_side_);
+
+    if (skip_method_(method_side)) {
+      ++index_method_side_;
+      compute_side_next_();
+      return;
+    }
+
+    const int ir_post = method_side->refresh_id_post();
+
+    cello::refresh(ir_post)->set_active (is_leaf());
+
+    refresh_start (ir_post,CkIndex_Block::p_compute_continue());
+
+  } else if (overlap_main_done_) {
+
+    compute_overlap_end_();
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::compute_side_continue_ ()
+{
+  Method * method_side = cello::problem()->method(index_method_side_);
+
+  Schedule * schedule = method_side->schedule();
+  const bool is_scheduled =
+    ((schedule==NULL) ||
+     (schedule->write_this_cycle(cycle_,time_))) &&
+    ! (method_side->skip_quiescent() && is_quiescent());
+
+  if (is_scheduled) {
+
+#ifdef DEBUG_COMPUTE
+    if (cycle() >= CYCLE)
+      CkPrintf ("%d %s DEBUG_COMPUTE applying overlapped Method %s\n",
+                CkMyPe(),name().c_str(),method_side->name().c_str());
+#endif
+
+    in_side_compute_   = true;
+    side_compute_done_ = false;
+
+    const int index_method = index_method_side_;
+    const long long trace_start = trace_start_();
+    method_counters_start_();
+
+    method_side->compute (this);
+
+    method_counters_stop_(index_method);
+    trace_stop_ ("method:" + method_side->name(), trace_start);
+
+    in_side_compute_ = false;
+
+    ASSERT1 ("Block::compute_side_continue_()",
+             "Overlapped Method %s returned before calling compute_done()",
+             method_side->name().c_str(),
+             side_compute_done_);
+
+    method_side->set_fields_modified(this);
+  }
+
+  ++index_method_side_;
+  compute_side_next_();
+}
+
+//----------------------------------------------------------------------
+
+void Block::compute_overlap_end_ ()
+{
+  index_method_ = index_method_side_;
+  index_method_side_ = -1;
+  overlap_main_done_ = false;
+  compute_next_();
+}
+
+//----------------------------------------------------------------------
+
 void Block::compute_done ()
 {
 #ifdef DEBUG_COMPUTE
   if (cycle() >= CYCLE)
     CkPrintf ("%d %s DEBUG_COMPUTE Block::compute_done_()\n", CkMyPe(),name().c_str());
 #endif
+  // completion of a Method run while the current Method waits is
+  // handled in compute_side_continue_()
+  if (in_side_compute_) {
+    side_compute_done_ = true;
+    return;
+  }
+
+  // record fields the method may have modified for sparse refreshes
+  Method * method = this->method();
+  if (method) method->set_fields_modified(this);
+
+  if (index_method_side_ >= 0) {
+
+    // wait for the overlapped Methods unless they are already done
+
+    overlap_main_done_ = true;
+    if (index_method_side_ == method->overlap_end()) {
+      compute_overlap_end_();
+    }
+    return;
+  }
+
   index_method_++;
   compute_next_();
 }
@@ -143,6 +489,12 @@ void Block::compute_end_ ()
   // delete fluxes
   data()->flux_data()->deallocate();
 
+  // release lazy fields that only live within a cycle
+  data()->field().deallocate_lifecycle(field_lifecycle_cycle);
+
+  // release temporary field storage no longer in use on this process
+  FieldArena::trim(cycle_);
+
   // Update block cycle and time
   set_cycle (cycle_ + 1);
   set_time  (time_  + dt_);
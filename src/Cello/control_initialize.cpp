@@ -51,6 +51,13 @@ void Simulation::initialize() throw()
   problem_->initialize_restrict (config_);
   problem_->initialize_initial(config_,parameters_);
   problem_->initialize_method  (config_,factory());
+
+  if (config_->performance_method_counters &&
+      ! performance_->method_counters_enable(problem_->num_methods())) {
+    WARNING ("Simulation::initialize()",
+             "Performance:method_counters: no hardware counters available");
+  }
+
   problem_->initialize_solver  (config_);
   problem_->initialize_refine  (config_,parameters_);
   problem_->initialize_stopping(config_);
@@ -60,6 +67,11 @@ void Simulation::initialize() throw()
 
   initialize_hierarchy_();
 
+  if (config_->performance_level_counters) {
+    performance_->level_counters_enable
+      (hierarchy_->min_level(),hierarchy_->max_level());
+  }
+
   // initialize_block_array() is called in charm_initialize
   // using QD to ensure that initialize_hierarchy() is called
   // on all processors before Blocks are created
@@ -110,7 +110,10 @@ void Simulation::output_start(int index_output)
   TRACE_OUTPUT("Simulation::output_start()");
   Output * output = problem()->output(index_output);
   output->init();
-  output->open();
+  {
+    MemoryGroup memory_group (memory_group_io);
+    output->open();
+  }
   index_output_ = index_output;
   contribute(CkCallback (CkIndex_Simulation::r_output_barrier(NULL),thisProxy));
 }
@@ -145,10 +148,20 @@ void Block::p_output_write (int index_output, int step)
   Output        * output         = cello::output(index_output);
   Config        * config         = (Config *) cello::config();
 
-  // update derived fields (if any)
-  this->compute_derived(config->output_field_list[index_output]);
+  if (output->is_block_written(this)) {
+
+    // update derived fields (if any)
+    this->compute_derived(config->output_field_list[index_output]);
+
+    const long long trace_start = trace_start_();
 
-  output->write_block(this);
+    {
+      MemoryGroup memory_group (memory_group_io);
+      output->write_block(this);
+    }
+
+    trace_stop_ ("output:" + config->output_list[index_output], trace_start);
+  }
 
   simulation->write_();
   performance_stop_ (perf_output);
@@ -44,57 +44,78 @@ void Block::refresh_start (int id_refresh, int callback)
 {
   CHECK_ID(id_refresh);
   Refresh * refresh = cello::refresh(id_refresh);
-  Sync * sync = sync_(id_refresh);
 
   // Send field and/or particle data associated with the given refresh
   // object to corresponding neighbors
   if ( refresh->is_active() ) {
 
-    ASSERT1 ("Block::refresh_start()",
-	     "refresh[%d] state is not inactive",
-	     id_refresh,
-	     (sync->state() == RefreshState::INACTIVE));
+    refresh_send (id_refresh);
 
-    sync->set_state(RefreshState::ACTIVE);
+    refresh_wait(id_refresh,callback);
 
-    // send Field face data
+  } else {
 
-    int count_field=0;
-    if (refresh->any_fields()) {
-      count_field = refresh_load_field_faces_ (*refresh);
-    }
+    refresh_exit(*refresh);
 
-    // send Particle face data
-    int count_particle=0;
-    if (refresh->any_particles()){
-      count_particle = refresh_load_particle_faces_(*refresh,
-						    refresh->particles_are_copied());
-    }
+  }
+}
 
-    // send Flux face data
-    int count_flux=0;
-    if (refresh->any_fluxes()){
-      count_flux = refresh_load_flux_faces_(*refresh);
-    }
+//----------------------------------------------------------------------
+
+void Block::refresh_send (int id_refresh)
+{
+  CHECK_ID(id_refresh);
+  Refresh * refresh = cello::refresh(id_refresh);
+  Sync * sync = sync_(id_refresh);
 
-    const int count = count_field + count_particle + count_flux;
+  ASSERT1 ("Block::refresh_send()",
+           "refresh[%d] is not active",
+           id_refresh,
+           (refresh->is_active()));
 
-    // Make sure sync counter is not active
-    ASSERT4 ("Block::refresh_start()",
-	     "refresh[%d] sync object %p is active (%d/%d)",
-	     id_refresh, sync, sync->value(), sync->stop(),
-	     (sync->value() == 0 && sync->stop() == 0));
+  ASSERT1 ("Block::refresh_send()",
+           "refresh[%d] state is not inactive",
+           id_refresh,
+           (sync->state() == RefreshState::INACTIVE));
 
-    // Initialize sync counter
-    sync->set_stop(count);
+  sync->set_state(RefreshState::ACTIVE);
 
-    refresh_wait(id_refresh,callback);
+  Performance * performance = cello::simulation()->performance();
+  if (performance->trace_active()) {
+    performance->trace_begin
+      ("refresh:" + cello::simulation()->refresh_name(id_refresh), name_);
+  }
 
-  } else {
+  // send Field face data
 
-    refresh_exit(*refresh);
+  int count_field=0;
+  if (refresh->any_fields()) {
+    count_field = refresh_load_field_faces_ (*refresh);
+  }
 
+  // send Particle face data
+  int count_particle=0;
+  if (refresh->any_particles()){
+    count_particle = refresh_load_particle_faces_(*refresh,
+                                                  refresh->particles_are_copied());
   }
+
+  // send Flux face data
+  int count_flux=0;
+  if (refresh->any_fluxes()){
+    count_flux = refresh_load_flux_faces_(*refresh);
+  }
+
+  const int count = count_field + count_particle + count_flux;
+
+  // Make sure sync counter is not active
+  ASSERT4 ("Block::refresh_send()",
+           "refresh[%d] sync object %p is active (%d/%d)",
+           id_refresh, sync, sync->value(), sync->stop(),
+           (sync->value() == 0 && sync->stop() == 0));
+
+  // Initialize sync counter
+  sync->set_stop(count);
 }
 
 //----------------------------------------------------------------------
@@ -189,6 +210,12 @@ void Block::refresh_check_done (int id_refresh)
 
     refresh_coarse_apply_(refresh);
 
+    Performance * performance = cello::simulation()->performance();
+    if (performance->trace_active()) {
+      performance->trace_end
+        ("refresh:" + cello::simulation()->refresh_name(id_refresh), name_);
+    }
+
     // Call callback
 
     refresh_exit(*refresh);
@@ -203,6 +230,18 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
   CHECK_ID(id_refresh);
   Sync * sync = sync_(id_refresh);
 
+  Performance * performance = cello::simulation()->performance();
+  if (msg_refresh->time_sent() > 0.0) {
+    MsgCounter::delay
+      (msg_class_refresh,CkWallTimer() - msg_refresh->time_sent());
+  }
+
+  if (performance->level_counters_active()) {
+    performance->level_counter_add (level(),level_counter_refresh_msgs,1);
+    performance->level_counter_add
+      (level(),level_counter_refresh_bytes,msg_refresh->data_bytes());
+  }
+
   if (sync->state() == RefreshState::READY) {
 
     // unpack message data into Block data if ready
@@ -217,7 +256,9 @@ void Block::p_refresh_recv (MsgRefresh * msg_refresh)
 
   } else {
 
-    // save message if not ready
+    // save message if not ready, copying faces of a message from the
+    // same process since the sender may modify its fields before then
+    msg_refresh->copy_local();
     refresh_msg_list_[id_refresh].push_back(msg_refresh);
 
   }
@@ -247,6 +288,31 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
   const int min_face_rank = refresh.min_face_rank();
   const int neighbor_type = refresh.neighbor_type();
 
+  // a sparse refresh only sends fields modified since it last sent
+  // them; refresh_sparse is left null if all fields are modified
+
+  FieldData * field_data = data()->field_data();
+  Refresh refresh_subset;
+  Refresh * refresh_sparse = nullptr;
+  if (refresh.is_sparse()) {
+    const auto field_list_src = refresh.field_list_src();
+    const auto field_list_dst = refresh.field_list_dst();
+    refresh_subset = refresh;
+    refresh_subset.clear_fields();
+    int num_modified = 0;
+    for (size_t i_f=0; i_f<field_list_src.size(); i_f++) {
+      if (field_data->is_modified(refresh.id(),field_list_src[i_f])) {
+        refresh_subset.add_field_src_dst
+          (field_list_src[i_f],field_list_dst[i_f]);
+        ++num_modified;
+      }
+      field_data->set_refreshed(refresh.id(),field_list_src[i_f]);
+    }
+    if (num_modified < int(field_list_src.size())) {
+      refresh_sparse = &refresh_subset;
+    }
+  }
+
   if (neighbor_type == neighbor_leaf ||
       neighbor_type == neighbor_tree) {
 
@@ -280,12 +346,12 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
       if (pad == 0) {
         refresh_load_field_face_
-          (refresh,refresh_type,index_neighbor,if3,ic3);
+          (refresh,refresh_type,index_neighbor,if3,ic3,refresh_sparse);
         ++count;
       } else {
         if (level_face == level) {
           refresh_load_field_face_
-            (refresh,refresh_type,index_neighbor,if3,ic3);
+            (refresh,refresh_type,index_neighbor,if3,ic3,refresh_sparse);
           ++count;
         } else {
           count += refresh_load_coarse_face_
@@ -293,7 +359,7 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
         }
         if (level_face < level) {
           refresh_load_field_face_
-            (refresh,refresh_type,index_neighbor,if3,ic3);
+            (refresh,refresh_type,index_neighbor,if3,ic3,refresh_sparse);
         } else if (level_face > level) {
           count ++;
         }
@@ -316,7 +382,8 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
       if ( ! is_leaf() || face_level(if3) >= level()) {
 	Index index_face = it_face.index();
 	int ic3[3] = {0,0,0};
-	refresh_load_field_face_ (refresh,refresh_same,index_face,if3,ic3);
+	refresh_load_field_face_
+          (refresh,refresh_same,index_face,if3,ic3,refresh_sparse);
 	++count;
 
       }
@@ -330,32 +397,224 @@ int Block::refresh_load_field_faces_ (Refresh & refresh)
 
 void Block::refresh_load_field_face_
 ( Refresh & refresh,  int refresh_type,
-  Index index_neighbor,  int if3[3], int ic3[3])
+  Index index_neighbor,  int if3[3], int ic3[3],
+  const Refresh * refresh_sparse)
 {
-  // create refresh message
+  // create refresh message, with bits for a priority (see
+  // message_set_priority_())
 
-  MsgRefresh * msg_refresh = new MsgRefresh;
-
-  // create field face
-  if (refresh_type == refresh_coarse) {
-    index_.child(index_.level(),ic3,ic3+1,ic3+2);
-  }
-  int g3[3] = {0,0,0};
-  FieldFace * field_face = create_face
-    (if3, ic3, g3, refresh_type, &refresh,false);
+  MsgRefresh * msg_refresh = new (8*sizeof(int)) MsgRefresh;
 
   // create data message
   DataMsg * data_msg = new DataMsg;
-  // initialize data message
-  data_msg -> set_field_face (field_face,true);
-  data_msg -> set_field_data (data()->field_data(),false);
+
+  // create field face unless a sparse refresh has no modified fields;
+  // the (empty) message is still sent so the neighbor's count matches
+  const bool any_fields =
+    (refresh_sparse == nullptr) || refresh_sparse->any_fields();
+
+  if (any_fields) {
+    if (refresh_type == refresh_coarse) {
+      index_.child(index_.level(),ic3,ic3+1,ic3+2);
+    }
+    int g3[3] = {0,0,0};
+    FieldFace * field_face = nullptr;
+    if (refresh_sparse == nullptr) {
+      // reuse a pooled FieldFace for this Refresh object if available
+      field_face = FieldFacePool::acquire(cello::rank(),refresh.id());
+      field_face -> set_refresh(&refresh,false);
+    } else {
+      // the face owns a copy of the Refresh with only modified fields,
+      // reusing a pooled owned copy if available
+      field_face = FieldFacePool::acquire_owner(cello::rank());
+      if (field_face->owns_refresh() && field_face->refresh() != nullptr) {
+        *field_face->refresh() = *refresh_sparse;
+      } else {
+        field_face -> set_refresh(new Refresh(*refresh_sparse),true);
+      }
+    }
+    field_face -> set_refresh_type (refresh_type);
+    field_face -> set_child (ic3[0],ic3[1],ic3[2]);
+    field_face -> set_face (if3[0],if3[1],if3[2]);
+    field_face -> set_ghost(g3[0],g3[1],g3[2]);
+
+    // initialize data message
+    data_msg -> set_field_face (field_face,true);
+    data_msg -> set_field_data (data()->field_data(),false);
+  }
 
   // initialize refresh message
   msg_refresh->set_refresh_id (refresh.id());
   msg_refresh->set_data_msg (data_msg);
 
+  const int kind =
+    (refresh_type == refresh_coarse) ? refresh_counter_coarse :
+    (refresh_type == refresh_fine)   ? refresh_counter_fine :
+    refresh_counter_same;
+  msg_refresh->set_counter_kind (kind);
+
+  // deliver directly if neighbor is on this process, bypassing
+  // Charm++ message scheduling
+  Block * block_neighbor = (cello::config()->refresh_local_copy) ?
+    cello::hierarchy()->local_block(index_neighbor) : nullptr;
+
+  if (block_neighbor != nullptr) {
+    block_neighbor->refresh_recv_local_ (msg_refresh);
+  } else {
+    refresh_send_msg_ (index_neighbor,msg_refresh);
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_send_msg_ (Index index_neighbor, MsgRefresh * msg_refresh)
+{
+  const Config * config = cello::config();
+  if (config->performance_message_priority ||
+      config->performance_critical_path) {
+    msg_refresh->set_time_sent (CkWallTimer());
+  }
+  message_set_priority_ (msg_refresh,phase_refresh);
+
+  // large messages skip aggregation, which is for small messages
+  if (config->refresh_nocopy_bytes > 0) {
+    const int size = msg_refresh->data_size();
+    if (size >= config->refresh_nocopy_bytes) {
+      refresh_send_nocopy_ (index_neighbor,msg_refresh,size);
+      return;
+    }
+  }
+
+  if (config->refresh_aggregate) {
+    const int ip =
+      thisProxy.ckLocalBranch()->lastKnown(CkArrayIndexIndex(index_neighbor));
+    if (ip != CkMyPe()) {
+      RefreshAggregator::append
+        (ip,index_neighbor,msg_refresh,message_priority_(phase_refresh));
+      return;
+    }
+  }
   thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_send_nocopy_
+(Index index_neighbor, MsgRefresh * msg_refresh, int size)
+{
+  char * buffer = NocopyPool::acquire(size);
+  char * pc = msg_refresh->save_data(buffer);
 
+  ASSERT2("Block::refresh_send_nocopy_()",
+	  "buffer size mismatch %ld saved %d expected",
+	  (pc - buffer),size,
+	  (pc - buffer) == size);
+
+  delete msg_refresh;
+
+  // the buffer is released when the receiver has its contents
+  CkCallback callback
+    (CkIndex_Simulation::p_nocopy_release(NULL),
+     proxy_simulation[CkMyPe()]);
+
+  CkEntryOptions options;
+  if (cello::config()->performance_message_priority) {
+    options.setPriority(message_priority_(phase_refresh));
+  }
+  thisProxy[index_neighbor].p_refresh_recv_nocopy
+    (size, CkSendBuffer(buffer,callback), &options);
+}
+
+//----------------------------------------------------------------------
+
+int Block::message_priority_ (int phase) const
+{
+  // Lower values are delivered first, and unprioritized messages,
+  // such as output and load balancing, have priority 0.  Adapt
+  // messages are part of a consensus that every Block waits on, so
+  // come first.  Refresh messages from deeper levels come next, since
+  // those Blocks take the most steps per root cycle, then from Blocks
+  // with larger compute time (in milliseconds) since the last load
+  // balance.  Refresh messages from quiescent Blocks, which skip most
+  // of their work, follow those from all active Blocks.
+
+  if (phase == phase_adapt) return -(3 << 20);
+
+  const int min_level = cello::hierarchy()->min_level();
+  const int level = std::max(0,std::min(511,index_.level() - min_level));
+  const int cost = std::max(0,std::min(1023,int(1e3*compute_time_)));
+  const int base = is_quiescent() ? -(1 << 20) : -(2 << 20);
+  return base - 1024*level - cost;
+}
+
+//----------------------------------------------------------------------
+
+void Block::message_set_priority_ (void * msg, int phase) const
+{
+  if (cello::config()->performance_message_priority) {
+    CkSetQueueing (msg,CK_QUEUEING_IFIFO);
+    *(int*)CkPriorityPtr(msg) = message_priority_(phase);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_refresh_recv_data (int n, char * buffer)
+{
+  MsgRefresh * msg_refresh = new MsgRefresh;
+  msg_refresh->load_data_copy (n,buffer);
+  p_refresh_recv (msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
+void Block::p_refresh_recv_nocopy (int n, char * buffer)
+{
+  // the buffer is only valid during this entry method, so field values
+  // are read from it in place only if the refresh can apply them now
+  MsgRefresh * msg_refresh = new MsgRefresh;
+  const int id_refresh = MsgRefresh::id_refresh(buffer);
+  CHECK_ID(id_refresh);
+  if (sync_(id_refresh)->state() == RefreshState::READY) {
+    msg_refresh->load_data_nocopy (n,buffer);
+  } else {
+    msg_refresh->load_data_copy (n,buffer);
+  }
+  p_refresh_recv (msg_refresh);
+}
+
+//----------------------------------------------------------------------
+
+void Block::refresh_recv_local_ (MsgRefresh * msg_refresh)
+{
+  const int id_refresh = msg_refresh->id_refresh();
+  CHECK_ID(id_refresh);
+  Sync * sync = sync_(id_refresh);
+
+  if (sync->state() == RefreshState::READY) {
+
+    // copy face directly from the sending Block's FieldData
+    msg_refresh->update(data());
+
+    delete msg_refresh;
+
+    sync->advance();
+
+    // Complete the refresh in a separate entry method so that this
+    // Block's callback is not nested inside the sender's entry method
+    if (sync->is_done()) {
+      thisProxy[index_].p_refresh_check_done(id_refresh);
+    }
+
+  } else {
+
+    // save message if not ready; processed in refresh_wait().  The
+    // sender may modify its fields before then, so copy its faces now
+    msg_refresh->copy_local();
+    refresh_msg_list_[id_refresh].push_back(msg_refresh);
+
+  }
 }
 
 //----------------------------------------------------------------------
@@ -668,6 +927,10 @@ int Block::delete_non_local_particles_(int it){
   const int d_copy   = particle.stride(it, ia_copy);
   int64_t * is_copy=0;
 
+  // Cell keys of remaining particles, if they may be sorted
+  const bool sort = particle_sort_enabled_();
+  std::vector<int64_t> key;
+
   // Loop over batches
   const int nb = particle.num_batches(it);
   for (int ib = 0; ib<nb; ib++){
@@ -710,6 +973,8 @@ int Block::delete_non_local_particles_(int it){
       // Also, we set is_copy = false for particles left behind, for which
       // in_block = true.
       is_copy[ip*d_copy] = !in_block;
+
+      if (sort && in_block) key.push_back(particle_sort_key_(x,y,z));
     }
 
     count += particle.delete_particles(it,ib,mask);
@@ -717,11 +982,80 @@ int Block::delete_non_local_particles_(int it){
     delete [] mask;
   }
 
+  // reuse the slots of deleted particles
+  if (count > 0) particle.compress(it);
+
+  if (sort) particle_sort_(it,key);
+
   return count;
 }
 
 //----------------------------------------------------------------------
 
+bool Block::particle_sort_enabled_ () const
+{
+  const Config * config = cello::config();
+  const int interval = config->particle_sort_interval;
+  return ((interval > 0 && (cycle_ % interval) == 0) ||
+          (config->particle_sort_disorder > 0.0));
+}
+
+//----------------------------------------------------------------------
+
+int64_t Block::particle_sort_key_ (double x, double y, double z) const
+{
+  const int rank = cello::rank();
+  int n3[3];
+  data()->field_data()->size(n3,n3+1,n3+2);
+  const double x3[3] = {x,y,z};
+
+  // interleave the bits of the cell indices (up to 21 bits each)
+
+  int64_t key = 0;
+  for (int axis=0; axis<rank; axis++) {
+    const int n = n3[axis];
+    int64_t i = (int64_t) std::floor(0.5*(x3[axis] + 1.0)*n);
+    i = std::max(int64_t(0),std::min(i,int64_t(n-1)));
+    for (int bit=0; bit<21; bit++) {
+      key |= ((i >> bit) & 1) << (rank*bit + axis);
+    }
+  }
+  return key;
+}
+
+//----------------------------------------------------------------------
+
+void Block::particle_sort_ (int it, const std::vector<int64_t> & key)
+{
+  const int np = key.size();
+  if (np <= 1) return;
+
+  const Config * config = cello::config();
+  const int interval = config->particle_sort_interval;
+  bool sort = (interval > 0 && (cycle_ % interval) == 0);
+
+  if (! sort) {
+    // disorder: fraction of consecutive particles out of order
+    int num_unordered = 0;
+    for (int i=1; i<np; i++) {
+      if (key[i] < key[i-1]) ++num_unordered;
+    }
+    sort = (1.0*num_unordered/(np-1) > config->particle_sort_disorder);
+  }
+
+  if (sort) {
+    Particle particle (cello::particle_descr(),
+                       data()->particle_data());
+    ASSERT2("Block::particle_sort_",
+            "Number of keys %d does not match number of particles %d",
+            np,particle.num_particles(it),
+            np == particle.num_particles(it));
+    particle.sort(it,key.data());
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Block::refresh_coarse_send_
 (Index index_neighbor,
  Field field,Refresh & refresh,
@@ -730,7 +1064,7 @@ void Block::refresh_coarse_send_
  int ifmr3[3], int ifpr3[3],
  std::string debug)
 {
-  MsgRefresh * msg_refresh = new MsgRefresh;
+  MsgRefresh * msg_refresh = new (8*sizeof(int)) MsgRefresh;
 
   DataMsg * data_msg = new DataMsg;
 
@@ -745,7 +1079,9 @@ void Block::refresh_coarse_send_
   msg_refresh->set_refresh_id (id_refresh);
   msg_refresh->set_data_msg (data_msg);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  msg_refresh->set_counter_kind (refresh_counter_fine);
+
+  refresh_send_msg_ (index_neighbor,msg_refresh);
 }
 
 //----------------------------------------------------------------------
@@ -842,27 +1178,33 @@ void Block::refresh_coarse_apply_ (Refresh * refresh)
             const int if0 = i3_f[0] + m3_f[0]*(i3_f[1] + m3_f[1]*i3_f[2]);
             const int ic0 = i3_c[0] + m3_c[0]*(i3_c[1] + m3_c[1]*i3_c[2]);
 
-            // clear first to avoid double-counting overlapped subregions
-            for (int kz=0; kz<n3_f[2]; kz++) {
-              const int kzr=kz/r;
-              for (int ky=0; ky<n3_f[1]; ky++) {
-                const int kyr=ky/r;
-                for (int kx=0; kx<n3_f[0]; kx++) {
-                  const int kxr=kx/r;
+            // sum the children of each coarse zone in one pass, in the
+            // same order as scattering fine zones into cleared coarse
+            // zones, so that sums are unchanged
+            const int ir = r;
+            const int nc3_f[3] = { (n3_f[0] + ir - 1)/ir,
+                                   (n3_f[1] + ir - 1)/ir,
+                                   (n3_f[2] + ir - 1)/ir };
+            for (int kzr=0; kzr<nc3_f[2]; kzr++) {
+              const int kz0 = ir*kzr;
+              const int kz1 = std::min(kz0 + ir,n3_f[2]);
+              for (int kyr=0; kyr<nc3_f[1]; kyr++) {
+                const int ky0 = ir*kyr;
+                const int ky1 = std::min(ky0 + ir,n3_f[1]);
+                for (int kxr=0; kxr<nc3_f[0]; kxr++) {
+                  const int kx0 = ir*kxr;
+                  const int kx1 = std::min(kx0 + ir,n3_f[0]);
+                  cello_float sum = 0;
+                  for (int kz=kz0; kz<kz1; kz++) {
+                    for (int ky=ky0; ky<ky1; ky++) {
+                      for (int kx=kx0; kx<kx1; kx++) {
+                        int kf = if0 + kx + m3_f[0]*(ky + m3_f[1]*kz);
+                        sum += rr*field_values_src[kf];
+                      }
+                    }
+                  }
                   int kc = ic0 + kxr + m3_c[0]*(kyr + m3_c[1]*kzr);
-                  coarse_field_src[kc] = 0;
-                }
-              }
-            }
-            for (int kz=0; kz<n3_f[2]; kz++) {
-              const int kzr=kz/r;
-              for (int ky=0; ky<n3_f[1]; ky++) {
-                const int kyr=ky/r;
-                for (int kx=0; kx<n3_f[0]; kx++) {
-                  const int kxr=kx/r;
-                  int kc = ic0 + kxr + m3_c[0]*(kyr + m3_c[1]*kzr);
-                  int kf = if0 + kx + m3_f[0]*(ky + m3_f[1]*kz);
-                  coarse_field_src[kc] += rr*field_values_src[kf];
+                  coarse_field_src[kc] = sum;
                 }
               }
             }
@@ -888,10 +1230,50 @@ void Block::refresh_coarse_apply_ (Refresh * refresh)
             prolong->array_sizes_valid (n3_f,n3_c);
             const bool accumulate = refresh->accumulate(i_f);
             TRACE_PROLONG("coarse_apply",prolong, m3_f,ip3_f,np3_f, m3_c,ip3_c,np3_c);
-            prolong->apply(default_precision,
-                           field_values_dst, m3_f, ip3_f, np3_f,
-                           coarse_field_src, m3_c, ip3_c, np3_c,
-                           accumulate);
+
+            // reuse cached prolonged values if the coarse values are
+            // unchanged since the last refresh of this face and field
+
+            const bool use_cache =
+              (! accumulate) && cello::config()->field_prolong_cache;
+
+            if (use_cache) {
+              const int face = (of3[0]+1) + 3*((of3[1]+1) + 3*(of3[2]+1));
+              const long long key =
+                ((refresh->id()*27LL + face) << 16) + index_field_dst;
+              const uint64_t hash = refresh_coarse_hash_
+                (coarse_field_src,m3_c,ip3_c,np3_c,ip3_f,np3_f);
+              auto & cache = refresh_coarse_cache_[key];
+              const int n = np3_f[0]*np3_f[1]*np3_f[2];
+              const bool hit =
+                (cache.first == hash) && (int(cache.second.size()) == n);
+              if (! hit) {
+                prolong->apply(default_precision,
+                               field_values_dst, m3_f, ip3_f, np3_f,
+                               coarse_field_src, m3_c, ip3_c, np3_c,
+                               false);
+                cache.first = hash;
+                cache.second.resize(n);
+              }
+              cello_float * values = cache.second.data();
+              for (int kz=0; kz<np3_f[2]; kz++) {
+                for (int ky=0; ky<np3_f[1]; ky++) {
+                  const int kf = ip3_f[0] + m3_f[0]*
+                    ((ip3_f[1]+ky) + m3_f[1]*(ip3_f[2]+kz));
+                  const int kv = np3_f[0]*(ky + np3_f[1]*kz);
+                  if (hit) {
+                    std::copy_n (values+kv,np3_f[0],field_values_dst+kf);
+                  } else {
+                    std::copy_n (field_values_dst+kf,np3_f[0],values+kv);
+                  }
+                }
+              }
+            } else {
+              prolong->apply(default_precision,
+                             field_values_dst, m3_f, ip3_f, np3_f,
+                             coarse_field_src, m3_c, ip3_c, np3_c,
+                             accumulate);
+            }
 
             if (accumulate) {
               DEBUG_PRINT_ARRAY0("refresh_coarse_apply coarse_field",coarse_field,m3_c,np3_c,ip3_c);
@@ -906,6 +1288,36 @@ void Block::refresh_coarse_apply_ (Refresh * refresh)
 
 //----------------------------------------------------------------------
 
+uint64_t Block::refresh_coarse_hash_
+(const cello_float * values_c, const int m3_c[3],
+ const int i3_c[3], const int n3_c[3],
+ const int i3_f[3], const int n3_f[3]) const
+{
+  // FNV-1a over the region extents and the coarse values read by
+  // the prolongation
+
+  uint64_t hash = 14695981039346656037ull;
+  auto add = [&hash] (const char * bytes, size_t size)
+  {
+    for (size_t i=0; i<size; i++) {
+      hash = (hash ^ (unsigned char)bytes[i]) * 1099511628211ull;
+    }
+  };
+  add ((const char *)i3_c,3*sizeof(int));
+  add ((const char *)n3_c,3*sizeof(int));
+  add ((const char *)i3_f,3*sizeof(int));
+  add ((const char *)n3_f,3*sizeof(int));
+  for (int iz=0; iz<n3_c[2]; iz++) {
+    for (int iy=0; iy<n3_c[1]; iy++) {
+      const int i = i3_c[0] + m3_c[0]*((i3_c[1]+iy) + m3_c[1]*(i3_c[2]+iz));
+      add ((const char *)(values_c+i),n3_c[0]*sizeof(cello_float));
+    }
+  }
+  return hash;
+}
+
+//----------------------------------------------------------------------
+
 int Block::refresh_load_particle_faces_ (Refresh & refresh, const bool copy)
 {
   const int rank = cello::rank();
@@ -964,19 +1376,23 @@ void Block::particle_send_
       DataMsg * data_msg = new DataMsg;
       data_msg ->set_particle_data(p_data,true);
 
-      MsgRefresh * msg_refresh = new MsgRefresh;
+      MsgRefresh * msg_refresh = new (8*sizeof(int)) MsgRefresh;
       msg_refresh->set_data_msg (data_msg);
       msg_refresh->set_refresh_id (id_refresh);
 
-      thisProxy[index].p_refresh_recv (msg_refresh);
+      msg_refresh->set_counter_kind (refresh_counter_particle);
+
+      refresh_send_msg_ (index,msg_refresh);
 
     } else if (p_data) {
 
-      MsgRefresh * msg_refresh = new MsgRefresh;
+      MsgRefresh * msg_refresh = new (8*sizeof(int)) MsgRefresh;
       msg_refresh->set_data_msg (nullptr);
       msg_refresh->set_refresh_id (id_refresh);
 
-      thisProxy[index].p_refresh_recv (msg_refresh);
+      msg_refresh->set_counter_kind (refresh_counter_particle);
+
+      refresh_send_msg_ (index,msg_refresh);
 
       // assert ParticleData object exits but has no particles
       delete p_data;
@@ -1056,7 +1472,8 @@ int Block::particle_load_faces_ (int npa,
     type_list = refresh->particle_list();
   }
 
-  particle_scatter_neighbors_(npa,particle_array,type_list, particle, copy);
+  particle_scatter_neighbors_(npa,particle_array,type_list, particle, copy,
+                              refresh->particle_copy_width());
 
   // Update positions particles crossing periodic boundaries
 
@@ -1186,6 +1603,14 @@ void Block::particle_apply_periodic_update_
   std::vector<double> dpy(nl,0.0);
   std::vector<double> dpz(nl,0.0);
 
+  // Integer positions are relative to the Block, so instead are
+  // expressed relative to the neighbor: its center c2/2 in this
+  // Block's [-1,1) coordinates, and its level relative to this one.
+  // This also accounts for periodic boundaries
+
+  std::vector<int> c2(3*nl,0);
+  std::vector<int> level_shift(nl,0);
+
   // Compute position updates for particles crossing periodic boundaries
 
   ItNeighbor it_neighbor =
@@ -1214,6 +1639,27 @@ void Block::particle_apply_periodic_update_
     particle_determine_periodic_update_
       (index_lower,index_upper,&dpx[il],&dpy[il],&dpz[il]);
 
+    if (refresh_type == refresh_same) {
+      for (int axis=0; axis<rank; axis++) {
+        c2[3*il+axis] = 4*if3[axis];
+      }
+    } else if (refresh_type == refresh_coarse) {
+      // coarse neighbor is adjacent to the parent, which is centered
+      // at +1 or -1 depending on which child this Block is
+      int ic3_self[3] = {0,0,0};
+      index_.child(index_.level(),ic3_self,ic3_self+1,ic3_self+2);
+      for (int axis=0; axis<rank; axis++) {
+        c2[3*il+axis] = 2*((ic3_self[axis] == 0 ? 1 : -1) + 4*if3[axis]);
+      }
+      level_shift[il] = -1;
+    } else if (refresh_type == refresh_fine) {
+      // fine neighbor is child ic3 of the same-level neighbor
+      for (int axis=0; axis<rank; axis++) {
+        c2[3*il+axis] = 4*if3[axis] + ((ic3[axis] == 0) ? -1 : 1);
+      }
+      level_shift[il] = 1;
+    }
+
     il++;
 
   }
@@ -1227,33 +1673,110 @@ void Block::particle_apply_periodic_update_
     ParticleData * p_data = particle_list[il];
     Particle particle_neighbor (p_descr,p_data);
 
-    if ( ((rank >= 1) && dpx[il] != 0.0) ||
-	 ((rank >= 2) && dpy[il] != 0.0) ||
-	 ((rank >= 3) && dpz[il] != 0.0) ) {
+    const bool is_periodic =
+      ( ((rank >= 1) && dpx[il] != 0.0) ||
+        ((rank >= 2) && dpy[il] != 0.0) ||
+        ((rank >= 3) && dpz[il] != 0.0) );
 
-      // ... for each particle type
-      const int nt = particle_neighbor.num_types();
-      for (int it=0; it<nt; it++) {
+    // ... for each particle type
+    const int nt = particle_neighbor.num_types();
+    for (int it=0; it<nt; it++) {
 
-	// ... for each batch of particles
-	const int nb = particle_neighbor.num_batches(it);
-	for (int ib=0; ib<nb; ib++) {
+      const bool is_int = particle_neighbor.position_is_int(it);
 
-	  particle_neighbor.position_update (it,ib,dpx[il],dpy[il],dpz[il]);
+      if (! is_int && ! is_periodic) continue;
 
-	}
+      // ... for each batch of particles
+      const int nb = particle_neighbor.num_batches(it);
+      for (int ib=0; ib<nb; ib++) {
+
+        if (is_int) {
+          particle_neighbor.position_update_frame
+            (it,ib,&c2[3*il],level_shift[il]);
+        } else {
+          particle_neighbor.position_update (it,ib,dpx[il],dpy[il],dpz[il]);
+        }
       }
     }
   }
 }
 //----------------------------------------------------------------------
 
+void Block::particle_copy_signature_
+(Particle particle, int it, int ib, int np, double copy_width,
+ std::vector<uint64_t> & signature)
+{
+  const int rank = cello::rank();
+
+  double xm,ym,zm;
+  double xp,yp,zp;
+  lower(&xm,&ym,&zm);
+  upper(&xp,&yp,&zp);
+
+  // block-normalized coordinates are in [-1,1), and element (ix,iy,iz)
+  // of particle_array covers [ix-2,ix-1) x [iy-2,iy-1) x [iz-2,iz-1)
+  const double x0 = 0.5*(xm+xp);
+  const double y0 = 0.5*(ym+yp);
+  const double z0 = 0.5*(zm+zp);
+  const double xl = xp-xm;
+  const double yl = yp-ym;
+  const double zl = zp-zm;
+
+  const int ia_x  = particle.attribute_position(it,0);
+  const bool is_float =
+    (cello::type_is_float(particle.attribute_type(it,ia_x)));
+  const int d  = particle.stride(it,ia_x);
+
+  // (...copy block-local integer positions to all neighbors)
+  if (! is_float) {
+    signature.assign(np,~uint64_t(0));
+    return;
+  }
+
+  std::vector<double> xa(np,0.0);
+  std::vector<double> ya(np,0.0);
+  std::vector<double> za(np,0.0);
+
+  particle.position(it,ib,xa.data(),ya.data(),za.data());
+
+  // distance from coordinate x to element i along an axis of width l
+  auto distance = [] (double x, int i, double l)
+    { return 0.5*l*std::max(0.0,std::max((i-2)-x,x-(i-1))); };
+
+  const int nx = (rank >= 1) ? 4 : 1;
+  const int ny = (rank >= 2) ? 4 : 1;
+  const int nz = (rank >= 3) ? 4 : 1;
+  const double w2 = copy_width*copy_width;
+
+  signature.assign(np,0);
+  for (int ip=0; ip<np; ip++) {
+    const double x = 2.0*(xa[ip*d]-x0)/xl;
+    const double y = 2.0*(ya[ip*d]-y0)/yl;
+    const double z = 2.0*(za[ip*d]-z0)/zl;
+    for (int iz=0; iz<nz; iz++) {
+      const double dz = (rank >= 3) ? distance(z,iz,zl) : 0.0;
+      for (int iy=0; iy<ny; iy++) {
+        const double dy = (rank >= 2) ? distance(y,iy,yl) : 0.0;
+        for (int ix=0; ix<nx; ix++) {
+          const double dx = distance(x,ix,xl);
+          if (dx*dx + dy*dy + dz*dz < w2) {
+            signature[ip] |= uint64_t(1) << (ix + 4*(iy + 4*iz));
+          }
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Block::particle_scatter_neighbors_
 (int npa,
  ParticleData * particle_array[],
  std::vector<int> & type_list,
  Particle particle,
- const bool copy)
+ const bool copy,
+ double copy_width)
 {
   if (copy){
 
@@ -1290,11 +1813,38 @@ void Block::particle_scatter_neighbors_
         // Index array not needed for copying
         int * index = nullptr;
 
-        // Loop over particles in this batch and fill in the mask
-        for (int ip=0; ip<np; ip++) mask[ip] = !is_copy[ip*d_copy];
+        if (copy_width == 0.0) {
 
-        // ...scatter particles to particle array
-        particle.scatter  (it,ib,np,mask,index,npa,particle_array, copy);
+          // Loop over particles in this batch and fill in the mask
+          for (int ip=0; ip<np; ip++) mask[ip] = !is_copy[ip*d_copy];
+
+          // ...scatter particles to particle array
+          particle.scatter  (it,ib,np,mask,index,npa,particle_array, copy);
+
+        } else {
+
+          // ...copy particles with the same neighbors together, to
+          // only the neighbors within copy_width of them
+          std::vector<uint64_t> signature;
+          particle_copy_signature_(particle,it,ib,np,copy_width,signature);
+          std::set<uint64_t> signatures;
+          for (int ip=0; ip<np; ip++) {
+            if (!is_copy[ip*d_copy] && signature[ip]) {
+              signatures.insert(signature[ip]);
+            }
+          }
+          std::vector<ParticleData *> particle_array_near(npa);
+          for (const uint64_t s : signatures) {
+            for (int ip=0; ip<np; ip++) {
+              mask[ip] = !is_copy[ip*d_copy] && (signature[ip] == s);
+            }
+            for (int k=0; k<npa; k++) {
+              particle_array_near[k] = ((s >> k) & 1) ? particle_array[k] : nullptr;
+            }
+            particle.scatter (it,ib,np,mask,index,npa,
+                              particle_array_near.data(), copy);
+          }
+        }
 
         delete [] mask;
       } // Loop over batches
@@ -1319,11 +1869,15 @@ void Block::particle_scatter_neighbors_
     const double zl = zp-zm;
 
     int count = 0;
+    const bool sort = particle_sort_enabled_();
     // ...for each particle type to be moved
     for (auto it_type=type_list.begin(); it_type!=type_list.end(); it_type++) {
 
       int it = *it_type;
 
+      // (...cell keys of remaining particles, if they may be sorted)
+      std::vector<int64_t> key;
+
       const int ia_x  = particle.attribute_position(it,0);
 
       // (...positions may use absolute coordinates (float) or
@@ -1390,6 +1944,8 @@ void Block::particle_scatter_neighbors_
 	  in_block = in_block && (!(rank >= 2) || (1 <= iy && iy <= 2));
 	  in_block = in_block && (!(rank >= 3) || (1 <= iz && iz <= 2));
 	  mask[ip] = ! in_block;
+
+	  if (sort && in_block) key.push_back(particle_sort_key_(x,y,z));
 	}
 
 	// ...scatter particles to particle array
@@ -1401,6 +1957,12 @@ void Block::particle_scatter_neighbors_
 	delete [] mask;
 	delete [] index;
       } // Loop over batches
+
+      // ...reuse the slots of particles moved, once per type
+      particle.compress(it);
+
+      // ...sort remaining particles if due
+      if (sort) particle_sort_(it,key);
     } // Loop over particle types
 
     cello::simulation()->data_delete_particles(count);
@@ -1480,9 +2042,10 @@ void Block::refresh_load_flux_face_
     const int nf = flux_data->num_fields();
     data_msg -> set_num_face_fluxes(nf);
     for (int i=0; i<nf; i++) {
-      FaceFluxes * face_fluxes = new FaceFluxes
-        (*flux_data->block_fluxes(axis,face,i));
-      face_fluxes->coarsen(ic3[0],ic3[1],ic3[2],cello::rank());
+      FaceFluxes * face_fluxes = new FaceFluxes;
+      face_fluxes->set_coarsened
+        (*flux_data->block_fluxes(axis,face,i),
+         ic3[0],ic3[1],ic3[2],cello::rank());
       data_msg -> set_face_fluxes (i,face_fluxes, is_new);
     }
   } else {
@@ -1497,10 +2060,12 @@ void Block::refresh_load_flux_face_
            id_refresh,
            (0 <= id_refresh));
 
-  MsgRefresh * msg_refresh = new MsgRefresh;
+  MsgRefresh * msg_refresh = new (8*sizeof(int)) MsgRefresh;
   msg_refresh->set_data_msg (data_msg);
   msg_refresh->set_refresh_id (id_refresh);
 
-  thisProxy[index_neighbor].p_refresh_recv (msg_refresh);
+  msg_refresh->set_counter_kind (refresh_counter_flux);
+
+  refresh_send_msg_ (index_neighbor,msg_refresh);
 
 }
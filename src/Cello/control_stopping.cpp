@@ -50,6 +50,9 @@ void Block::stopping_begin_()
 
   simulation->set_phase(phase_stopping);
 
+  update_memory_bytes_();
+  update_level_counters_();
+
   int stopping_interval = cello::config()->stopping_interval;
 
   bool stopping_reduce = stopping_interval ? 
@@ -65,6 +68,8 @@ void Block::stopping_begin_()
     Method * method;
     double dt_block = std::numeric_limits<double>::max();
     while ((method = problem->method(index++))) {
+      // subcycled Methods limit their own substeps instead
+      if (method->subcycle()) continue;
       dt_block = std::min(dt_block,method->timestep(this));
     }
 
@@ -91,10 +96,40 @@ void Block::stopping_begin_()
 
     // Reduce to find Block array minimum dt and stopping criteria
 
-    double min_reduce[2];
+    // Optionally append the minimum leaf dt of each level; entries for
+    // other levels are left at their maximum
+
+    const Config * config = cello::config();
+    const int num_levels = config->stopping_dt_level ?
+      config->mesh_max_level + 1 : 0;
+
+    std::vector<double> min_reduce
+      (2 + num_levels, std::numeric_limits<double>::max());
 
     min_reduce[0] = dt_block;
     min_reduce[1] = stop_block ? 1.0 : 0.0;
+    if (is_leaf() && 0 <= level() && level() < num_levels) {
+      min_reduce[2 + level()] = dt_block;
+    }
+
+    // Methods may append their own global quantities, fused into the
+    // same reduction
+
+    std::vector<double> max_reduce, sum_reduce;
+    index = 0;
+    while ((method = problem->method(index++))) {
+      method->stopping_values (this,min_reduce,max_reduce,sum_reduce);
+    }
+
+    std::vector<double> reduce;
+    reduce.reserve(3 + min_reduce.size() + max_reduce.size() +
+                   sum_reduce.size());
+    reduce.push_back(min_reduce.size());
+    reduce.push_back(max_reduce.size());
+    reduce.push_back(sum_reduce.size());
+    reduce.insert(reduce.end(),min_reduce.begin(),min_reduce.end());
+    reduce.insert(reduce.end(),max_reduce.begin(),max_reduce.end());
+    reduce.insert(reduce.end(),sum_reduce.begin(),sum_reduce.end());
 
     CkCallback callback (CkIndex_Block::r_stopping_compute_timestep(NULL),
 			 thisProxy);
@@ -103,7 +138,8 @@ void Block::stopping_begin_()
     CkPrintf ("%s %s:%d DEBUG_CONTRIBUTE\n",
 	      name().c_str(),__FILE__,__LINE__); fflush(stdout);
 #endif    
-    contribute(2*sizeof(double), min_reduce, CkReduction::min_double, callback);
+    contribute(reduce.size()*sizeof(double), reduce.data(),
+               r_reduce_fused_type, callback);
 
   } else {
 
@@ -123,16 +159,42 @@ void Block::r_stopping_compute_timestep(CkReductionMsg * msg)
   
   ++age_;
 
-  double * min_reduce = (double * )msg->getData();
+  const double * reduce = (const double * )msg->getData();
+  const int num_min = reduce[0];
+  const int num_max = reduce[1];
+  const double * min_reduce = reduce + 3;
+  const int num_levels = cello::config()->stopping_dt_level ?
+    cello::config()->mesh_max_level + 1 : 0;
 
   dt_   = min_reduce[0];
   stop_ = min_reduce[1] == 1.0 ? true : false;
 
-  delete msg;
+  std::vector<double> dt_level (min_reduce+2, min_reduce+2+num_levels);
+
+  // Pass the remaining values to the Methods that appended them
 
   Simulation * simulation = cello::simulation();
 
+  const double * values_min = min_reduce + 2 + num_levels;
+  const double * values_max = min_reduce + num_min;
+  const double * values_sum = values_max + num_max;
+  Problem * problem = simulation->problem();
+  Method * method;
+  int index = 0;
+  while ((method = problem->method(index++))) {
+    method->stopping_reduced (this,values_min,values_max,values_sum);
+  }
+
+  delete msg;
+
   dt_ *= Method::courant_global;
+
+  if (dt_level.size() > 0) {
+    for (double & dt : dt_level) {
+      if (dt < std::numeric_limits<double>::max()) dt *= Method::courant_global;
+    }
+    simulation->set_dt_level(dt_level);
+  }
   
   set_dt   (dt_);
   set_stop (stop_);
@@ -244,18 +306,33 @@ void Block::ResumeFromSync()
 
   TRACE_STOPPING("load_balance exit");
 
+  balance_time_ = 0.0;
+
   stopping_exit_();
 
 }
 
 //----------------------------------------------------------------------
 
+void Block::UserSetLBLoad()
+{
+  // Only time in Methods counts, not waiting on neighbors, output, or
+  // other Blocks on the process; communication between Blocks is
+  // still recorded by Charm++ for communication-aware balancers
+  setObjTime (std::max(balance_time_, 1e-6));
+}
+
+//----------------------------------------------------------------------
+
 void Block::exit_()
 {
 
   TRACE_STOPPING("Block::exit_");
   const int in = cello::index_static();
   if (index().is_root()) {
+    // pooled FieldFace objects are not leaks; other processes clear
+    // their pools in Simulation::p_exit_clear_pools()
+    FieldFacePool::clear();
     if (DataMsg::counter[in] != 0) {
       CkPrintf ("%d Block::exit_() DataMsg::counter = %ld != 0\n",
 		CkMyPe(),DataMsg::counter[in]);
@@ -288,6 +365,7 @@ void Block::exit_()
     }
   }
   if (index_.is_root()) {
-    proxy_main.p_exit(1);
+    // clear FieldFace pools on every process before exiting
+    proxy_simulation.p_exit_clear_pools();
   }
 }
@@ -31,6 +31,8 @@ void DataMsg::set_coarse_array
    const std::vector<int> & field_list_dst,
    std::string debug_block_recv)
 {
+  MemoryGroup memory_group (memory_group_messages);
+
   for (int i=0; i<3; i++) {
     iam3_cf_[i] = iam3[i];
     iap3_cf_[i] = iap3[i];
@@ -110,14 +112,18 @@ int DataMsg::data_size () const
 
   Field field (cello::field_descr(), field_data_u_);
 
+  const int codec = field_codec_();
   const int n_ff = (ff) ? ff->data_size() : 0;
-  const int n_fa = (ff) ? ff->num_bytes_array(field) : 0;
+  const int n_fa = (ff == nullptr) ? 0 :
+    ((codec == codec_none) ?
+     ff->num_bytes_array(field) : encode_field_array_(field));
   const int n_pd = (pd) ? pd->data_size(cello::particle_descr()) : 0;
   const int n_fd = fd.size();
 
   int size = 0;
 
   SIZE_SCALAR_TYPE(size,int,n_ff);
+  SIZE_SCALAR_TYPE(size,int,codec);
   SIZE_SCALAR_TYPE(size,int,n_fa);
   SIZE_SCALAR_TYPE(size,int,n_pd);
   SIZE_SCALAR_TYPE(size,int,n_fd);
@@ -178,12 +184,16 @@ char * DataMsg::save_data (char * buffer) const
   ParticleData * pd = particle_data_;
   auto & fd = face_fluxes_list_;
 
+  const int codec = field_codec_();
   const int n_ff = (ff) ? ff->data_size() : 0;
-  const int n_fa = (ff) ? ff->num_bytes_array(field) : 0;
+  const int n_fa = (ff == nullptr) ? 0 :
+    ((codec == codec_none) ?
+     ff->num_bytes_array(field) : encode_field_array_(field));
   const int n_pa = (pd) ? pd->data_size(cello::particle_descr()) : 0;
   const int n_fd = fd.size();
 
   SAVE_SCALAR_TYPE(pc,int,n_ff);
+  SAVE_SCALAR_TYPE(pc,int,codec);
   SAVE_SCALAR_TYPE(pc,int,n_fa);
   SAVE_SCALAR_TYPE(pc,int,n_pa);
   SAVE_SCALAR_TYPE(pc,int,n_fd);
@@ -194,7 +204,19 @@ char * DataMsg::save_data (char * buffer) const
   }
     // save field array
   if (n_ff > 0 && n_fa > 0) {
-    ff->face_to_array(field,pc);
+    if (codec == codec_none) {
+      ff->face_to_array(field,pc);
+    } else {
+      memcpy(pc,field_array_code_.data(),n_fa);
+      Simulation * simulation = cello::simulation();
+      if (simulation) {
+        Performance * performance = simulation->performance();
+        performance->increment_counter
+          (perf_index_codec_bytes_in,
+           FieldCodec::decoded_size(field_array_code_.data()));
+        performance->increment_counter (perf_index_codec_bytes_out,n_fa);
+      }
+    }
     pc += n_fa;
   }
   // save particle data
@@ -248,6 +270,8 @@ char * DataMsg::save_data (char * buffer) const
 
 char * DataMsg::load_data (char * buffer)
 {
+  MemoryGroup memory_group (memory_group_messages);
+
   TRACE_DATA_MSG("load_data()");
   // 2. De-serialize message data from input buffer into the allocated
   // message (must be consistent with pack())
@@ -260,24 +284,30 @@ char * DataMsg::load_data (char * buffer)
 
   pc = buffer;
 
-  int n_ff,n_fa,n_pa,n_fd;
+  int n_ff,codec,n_fa,n_pa,n_fd;
   LOAD_SCALAR_TYPE(pc,int,n_ff);
+  LOAD_SCALAR_TYPE(pc,int,codec);
   LOAD_SCALAR_TYPE(pc,int,n_fa);
   LOAD_SCALAR_TYPE(pc,int,n_pa);
   LOAD_SCALAR_TYPE(pc,int,n_fd);
 
   // load field face
   if (n_ff > 0) {
-    field_face_ = new FieldFace(cello::rank());
+    field_face_ = FieldFacePool::acquire_owner(cello::rank());
     pc = field_face_->load_data (pc);
   } else {
     field_face_ = nullptr;
   }
 
   // load field array
-  if (n_fa > 0) {
+  if (n_fa > 0 && codec == codec_none) {
     field_array_u_ = pc;
     pc += n_fa;
+  } else if (n_fa > 0) {
+    field_array_code_.resize(FieldCodec::decoded_size(pc));
+    FieldCodec::decode(pc,n_fa,field_array_code_.data());
+    field_array_u_ = field_array_code_.data();
+    pc += n_fa;
   } else {
     field_array_u_ = nullptr;
   }
@@ -328,6 +358,28 @@ char * DataMsg::load_data (char * buffer)
 
 //----------------------------------------------------------------------
 
+void DataMsg::copy_field_face ()
+{
+  TRACE_DATA_MSG("copy_field_face()");
+  FieldFace * ff = field_face_;
+
+  if (ff != nullptr && field_data_u_ != nullptr) {
+
+    Field field (cello::field_descr(), field_data_u_);
+
+    field_array_copy_.resize(ff->num_bytes_array(field));
+    ff->face_to_array(field,field_array_copy_.data());
+
+    if (field_data_delete_) {
+      delete field_data_u_;
+      field_data_delete_ = false;
+    }
+    field_array_u_ = field_array_copy_.data();
+  }
+}
+
+//----------------------------------------------------------------------
+
 void DataMsg::update (Data * data, bool is_local, bool is_kept)
 {
   TRACE_DATA_MSG("update()");
@@ -372,10 +424,13 @@ void DataMsg::update (Data * data, bool is_local, bool is_kept)
       ff->array_to_face(fa,field_dst);
 
     }
+
+    // ghost zones changed, so derived fields must be recomputed
+    data->field_data()->set_ghosts_modified();
   }
 
   if (ff != nullptr) {
-    delete field_face_;
+    FieldFacePool::release(field_face_);
     field_face_ = nullptr;
   }
 
@@ -439,6 +494,47 @@ void DataMsg::update (Data * data, bool is_local, bool is_kept)
 
 //----------------------------------------------------------------------
 
+int DataMsg::field_codec_ () const
+{
+  const Refresh * refresh = field_face_ ? field_face_->refresh() : nullptr;
+  return refresh ? refresh->codec() : int(codec_none);
+}
+
+//----------------------------------------------------------------------
+
+int DataMsg::encode_field_array_ (Field field) const
+{
+  MemoryGroup memory_group (memory_group_messages);
+
+  if (field_array_code_.empty()) {
+
+    FieldFace * ff = field_face_;
+    const int n = ff->num_bytes_array(field);
+    std::vector<char> array(n);
+    std::vector<int> field_bytes;
+    ff->face_to_array(field,array.data(),&field_bytes);
+
+    // one segment per field, using its precision and error bound
+
+    const Refresh * refresh = ff->refresh();
+    auto field_list_src = refresh->field_list_src();
+    std::vector<FieldCodec::Segment> segments(field_bytes.size());
+    for (size_t i_f=0; i_f<field_bytes.size(); i_f++) {
+      const int index_field = field_list_src[i_f];
+      segments[i_f].bytes = field_bytes[i_f];
+      segments[i_f].element_size =
+        cello::sizeof_precision(field.precision(index_field));
+      segments[i_f].tolerance = refresh->codec_tolerance(index_field);
+      segments[i_f].sparse = (refresh->codec() == codec_sparse);
+      segments[i_f].raw = (refresh->codec() == codec_constant);
+    }
+    FieldCodec::encode (array.data(),n,segments,field_array_code_);
+  }
+  return field_array_code_.size();
+}
+
+//----------------------------------------------------------------------
+
 void DataMsg::print (const char * message, FILE * fp_in) const
 {
   FILE * fp = fp_in ? fp_in : stdout;
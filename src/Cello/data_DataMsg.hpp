@@ -24,13 +24,15 @@ public: // interface
       field_face_delete_   (false),
       field_data_u_(nullptr),
       field_data_delete_   (false),
+      field_array_copy_(),
       particle_data_(nullptr),
       particle_data_delete_(false),
       face_fluxes_list_(),
       face_fluxes_delete_(),
       coarse_field_buffer_(),
       coarse_field_list_src_(),
-      coarse_field_list_dst_()
+      coarse_field_list_dst_(),
+      field_array_code_()
   {
     for (int i=0; i<3; i++) {
       iam3_cf_[i]  =0;
@@ -48,7 +50,7 @@ public: // interface
     --counter[cello::index_static()];
     
     if (field_face_delete_) {
-      delete field_face_;
+      FieldFacePool::release(field_face_);
       field_face_ = nullptr;
     }
     if (field_data_delete_) {
@@ -71,6 +73,7 @@ public: // interface
     coarse_field_buffer_.clear();
     coarse_field_list_src_.clear();
     coarse_field_list_dst_.clear();
+    field_array_code_.clear();
   }
 
   /// Copy constructor
@@ -206,6 +209,11 @@ public: // interface
   /// serializing multiple objects in one buffer.
   char * load_data (char * buffer);
 
+  /// Copy the field face of a local source FieldData into an owned
+  /// array, so that later changes to the source do not affect
+  /// update(), which must then be called with is_local false
+  void copy_field_face ();
+
   /// Update the Data with the data stored in this DataMsg. "is_local"
   /// is true if the data in the source and destination are on the
   /// same process. "is_kept" is true (default) when the particle
@@ -215,6 +223,15 @@ public: // interface
   /// Debugging
   void print (const char * message, FILE * fp = nullptr) const;
 
+protected: // functions
+
+  /// Return the encoding of the field face array, if any
+  int field_codec_ () const;
+
+  /// Encode the field face array into field_array_code_ if not
+  /// already encoded, and return its size in bytes
+  int encode_field_array_ (Field field) const;
+
 protected: // attributes
 
   /// Field Face Data
@@ -235,6 +252,9 @@ protected: // attributes
   };
   /// Whether FieldData data should be deleted in destructor
   bool field_data_delete_;
+
+  /// Field face copied from a local source by copy_field_face()
+  std::vector<char> field_array_copy_;
   
   /// Particle data
   ParticleData * particle_data_;
@@ -262,6 +282,10 @@ protected: // attributes
   /// loop limits for the receiving field
   int ifmr3_cf_[3], ifpr3_cf_[3];
 
+  /// Encoded field face array if sending, or decoded field face array
+  /// if receiving, when the Refresh object specifies a codec
+  mutable std::vector<char> field_array_code_;
+
 };
 
 #endif /* DATA_DATA_MSG_HPP */
@@ -128,13 +128,45 @@ cello_float * FaceFluxes::flux_array (int * dx, int * dy, int *dz)
 void FaceFluxes::coarsen (int cx, int cy, int cz, int rank)
 {
   TRACE_FACE_FLUXES("coarsen()");
-  int mxf,myf,mzf;
-  int m = get_size(&mxf,&myf,&mzf);
-  
+  const int m = get_size();
+
   cello_float * fluxes_fine = new cello_float[m];
   std::copy_n(fluxes_,m,fluxes_fine);
   std::fill_n(fluxes_,m,0.0);
 
+  coarsen_(fluxes_fine,cx,cy,cz,rank);
+
+  delete [] fluxes_fine;
+}
+
+//----------------------------------------------------------------------
+
+void FaceFluxes::set_coarsened
+(const FaceFluxes & face_fluxes, int cx, int cy, int cz, int rank)
+{
+  TRACE_FACE_FLUXES("set_coarsened()");
+  deallocate_storage();
+  face_        = face_fluxes.face_;
+  index_field_ = face_fluxes.index_field_;
+  nx_ = face_fluxes.nx_;
+  ny_ = face_fluxes.ny_;
+  nz_ = face_fluxes.nz_;
+  cx_ = face_fluxes.cx_;
+  cy_ = face_fluxes.cy_;
+  cz_ = face_fluxes.cz_;
+  allocate_storage();
+
+  coarsen_(face_fluxes.fluxes_,cx,cy,cz,rank);
+}
+
+//----------------------------------------------------------------------
+
+void FaceFluxes::coarsen_
+(const cello_float * fluxes_fine, int cx, int cy, int cz, int rank)
+{
+  int mxf,myf,mzf;
+  get_size(&mxf,&myf,&mzf);
+
   const int mxc = (nx_ > 1) ? (nx_/2 + cx_) : 1;
   const int myc = (ny_ > 1) ? (ny_/2 + cy_) : 1;
   const int mzc = (nz_ > 1) ? (nz_/2 + cz_) : 1;
@@ -245,8 +277,6 @@ void FaceFluxes::coarsen (int cx, int cy, int cz, int rank)
             rank);
 
   }
-
-  delete [] fluxes_fine;
 }
   
 //----------------------------------------------------------------------
@@ -128,6 +128,13 @@ public: // interface
   /// determined by child indices
   void coarsen (int cx, int cy, int cz, int rank);
 
+  /// Set this object to the coarsened fluxes of the given fine-level
+  /// FaceFluxes, with child indices (cx,cy,cz) as in coarsen().
+  /// Restricts directly into newly allocated storage, leaving
+  /// face_fluxes unchanged
+  void set_coarsened
+  (const FaceFluxes & face_fluxes, int cx, int cy, int cz, int rank);
+
   /// Add FaceFluxes object to this one. Used for accumulating fluxes
   /// with finer time steps until they match the coarser time
   /// step. Assumes spacially-conforming FaceFlux objects
@@ -175,6 +182,13 @@ public: // interface
 
   void print (Block * block, std::string message);
 
+private: // functions
+
+  /// Add the coarsened fluxes_fine array to the flux array, which is
+  /// assumed to be cleared
+  void coarsen_ (const cello_float * fluxes_fine,
+                 int cx, int cy, int cz, int rank);
+
 private: // attributes
 
   // NOTE: change pup() method whenever attributes change
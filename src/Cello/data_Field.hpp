@@ -82,6 +82,10 @@ public: // interface
   void set_padding(int padding) throw()
   { field_descr_->set_padding(padding); }
 
+  /// Set the field_layout_type layout of permanent fields
+  void set_layout(int layout) throw()
+  { field_descr_->set_layout(layout); }
+
   /// Set centering for a field
   void set_centering(int id, int cx, int cy=0, int cz=0) 
     throw()
@@ -140,6 +144,10 @@ public: // interface
   int padding() const throw()
   { return field_descr_->padding() ;}
 
+  /// field_layout_type layout of permanent fields in memory
+  int layout() const throw()
+  { return field_descr_->layout() ;}
+
   /// centering of given field
   void centering(int id, int * cx, int * cy = 0, int * cz = 0) const 
     throw()
@@ -259,6 +267,33 @@ public: // interface
   const char * values (std::string name, int index_history=0) const throw ()
   { return field_data_->values(field_descr_,name,index_history); }
 
+  /// Return array for the field, first allocating it if it is a lazy
+  /// field (see cello::define_field_lazy()) not yet allocated on this
+  /// Block.  Newly allocated values are zero
+  char * values_demand (int id_field) throw ()
+  {
+    char * array = values(id_field);
+    if (array == nullptr && field_descr_->lifecycle(id_field) >=
+        field_lifecycle_cycle) {
+      allocate_temporary(id_field);
+      array = values(id_field);
+    }
+    return array;
+  }
+
+  char * values_demand (std::string name) throw ()
+  { return values_demand(field_id(name)); }
+
+  /// Deallocate the lazy fields with the given lifecycle
+  void deallocate_lifecycle (int lifecycle) throw ()
+  {
+    for (const auto & it : field_descr_->lazy_fields()) {
+      if (it.second == lifecycle && values(it.first) != nullptr) {
+        deallocate_temporary(it.first);
+      }
+    }
+  }
+
   /// Return a CelloView that acts as a view of the corresponding field
   ///
   /// If the field cannot be found the program will abort with an error.
@@ -294,6 +329,55 @@ public: // interface
                              int index_history=0) const throw()
   { return field_data_->view<T>(field_descr_,name,choice,index_history); }
 
+  /// Return whether a field stores its values as type T
+  template<class T>
+  bool is_type(int id_field) const throw()
+  { return data_type(id_field) == cello::get_type_enum<T>(); }
+
+  /// Copy the values of a field, including ghost zones, into an array of
+  /// type T, converting them from the field's precision
+  template<class T>
+  void copy_to_array(int id_field, T * array, int index_history=0) const
+    throw()
+  {
+    const char * values = this->values(id_field,index_history);
+    const int n = values_size_(id_field);
+    switch (data_type(id_field)) {
+    case type_single:
+      convert_values_(array, (const float *)values, n);       break;
+    case type_double:
+      convert_values_(array, (const double *)values, n);      break;
+    case type_quadruple:
+      convert_values_(array, (const long double *)values, n); break;
+    default:
+      ERROR1("Field::copy_to_array",
+             "Unsupported precision for field %s",
+             field_name(id_field).c_str());
+    }
+  }
+
+  /// Copy an array of type T into the values of a field, including ghost
+  /// zones, converting them to the field's precision
+  template<class T>
+  void copy_from_array(int id_field, const T * array, int index_history=0)
+    throw()
+  {
+    char * values = this->values(id_field,index_history);
+    const int n = values_size_(id_field);
+    switch (data_type(id_field)) {
+    case type_single:
+      convert_values_((float *)values, array, n);       break;
+    case type_double:
+      convert_values_((double *)values, array, n);      break;
+    case type_quadruple:
+      convert_values_((long double *)values, array, n); break;
+    default:
+      ERROR1("Field::copy_from_array",
+             "Unsupported precision for field %s",
+             field_name(id_field).c_str());
+    }
+  }
+
   /// Return array for the corresponding coarse field
   char * coarse_values (int id_field) throw ()
   { return field_data_->coarse_values (field_descr_,id_field); }
@@ -449,6 +533,27 @@ public: // interface
 	      bool use_file = false) const throw()
   { field_data_->print(field_descr_,message,use_file); }
 
+private: // functions
+
+  /// Number of values of a field including ghost zones, which must be
+  /// allocated
+  int values_size_(int id_field) const throw()
+  {
+    ASSERT("Field::values_size_",
+           "ghost zones must be allocated to convert field values",
+           ghosts_allocated());
+    int mx,my,mz;
+    dimensions(id_field,&mx,&my,&mz);
+    return mx*my*mz;
+  }
+
+  /// Copy n values from src to dest, converting them to type T
+  template<class T, class U>
+  static void convert_values_(T * dest, const U * src, int n) throw()
+  {
+    for (int i=0; i<n; i++) dest[i] = (T) src[i];
+  }
+
 private: // attributes
 
   /// Field descriptor for global field data
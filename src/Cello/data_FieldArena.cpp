@@ -0,0 +1,133 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldArena.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the FieldArena class
+
+#include "cello.hpp"
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+long FieldArena::hits[CONFIG_NODE_SIZE] = {0};
+long FieldArena::misses[CONFIG_NODE_SIZE] = {0};
+std::map<int, std::vector<char *> > FieldArena::free_[CONFIG_NODE_SIZE];
+std::set<int> FieldArena::used_[CONFIG_NODE_SIZE];
+int FieldArena::cycle_trim_[CONFIG_NODE_SIZE] = {0};
+int64_t FieldArena::bytes_used_[CONFIG_NODE_SIZE] = {0};
+int64_t FieldArena::bytes_free_[CONFIG_NODE_SIZE] = {0};
+
+//----------------------------------------------------------------------
+
+char * FieldArena::allocate (int bytes)
+{
+  const int in = cello::index_static();
+  const int size = padded_(bytes);
+
+  used_[in].insert(size);
+  bytes_used_[in] += size;
+
+  std::vector<char *> & free_list = free_[in][size];
+  if (! free_list.empty()) {
+    ++hits[in];
+    char * array = free_list.back();
+    free_list.pop_back();
+    bytes_free_[in] -= size;
+    return array;
+  }
+
+  ++misses[in];
+  return new_(size);
+}
+
+//----------------------------------------------------------------------
+
+void FieldArena::deallocate (char * array, int bytes)
+{
+  if (array == nullptr) return;
+  const int in = cello::index_static();
+  const int size = padded_(bytes);
+
+  free_[in][size].push_back(array);
+  bytes_used_[in] -= size;
+  bytes_free_[in] += size;
+}
+
+//----------------------------------------------------------------------
+
+void FieldArena::trim (int cycle)
+{
+  const int in = cello::index_static();
+  if (cycle == cycle_trim_[in]) return;
+  cycle_trim_[in] = cycle;
+  for (auto & it : free_[in]) {
+    if (used_[in].find(it.first) == used_[in].end()) {
+      for (char * array : it.second) delete_(array);
+      bytes_free_[in] -= int64_t(it.first)*it.second.size();
+      it.second.clear();
+    }
+  }
+  used_[in].clear();
+}
+
+//----------------------------------------------------------------------
+
+void FieldArena::clear ()
+{
+  const int in = cello::index_static();
+  for (auto & it : free_[in]) {
+    for (char * array : it.second) delete_(array);
+  }
+  free_[in].clear();
+  used_[in].clear();
+  bytes_free_[in] = 0;
+}
+
+//----------------------------------------------------------------------
+
+int64_t FieldArena::bytes_used ()
+{ return bytes_used_[cello::index_static()]; }
+
+//----------------------------------------------------------------------
+
+int64_t FieldArena::bytes_free ()
+{ return bytes_free_[cello::index_static()]; }
+
+//----------------------------------------------------------------------
+
+char * FieldArena::new_ (int bytes)
+{
+  // The original pointer is stored immediately before the aligned
+  // array so that delete_() can recover it
+
+#ifdef CONFIG_USE_MEMORY
+  // counted in the enclosing group if any, e.g. Solver for solver
+  // temporaries, even if later reused from the free list
+  Memory * memory = Memory::instance();
+  const int index_group = memory->current_index_group();
+  if (index_group == memory_group_cello) {
+    memory->set_index_group(memory_group_field_arena);
+  }
+#endif
+
+  char * base = new char [bytes + align_ + sizeof(char *)];
+
+#ifdef CONFIG_USE_MEMORY
+  memory->set_index_group(index_group);
+#endif
+
+  uintptr_t start = uintptr_t(base + sizeof(char *));
+  char * array = (char *)(((start + align_ - 1) / align_) * align_);
+  ((char **)array)[-1] = base;
+  return array;
+}
+
+//----------------------------------------------------------------------
+
+void FieldArena::delete_ (char * array)
+{
+  // deallocations are counted in the group of the allocation
+
+  delete [] ((char **)array)[-1];
+}
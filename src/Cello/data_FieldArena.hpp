@@ -0,0 +1,95 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldArena.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Data] Declaration of the FieldArena class
+
+#ifndef DATA_FIELD_ARENA_HPP
+#define DATA_FIELD_ARENA_HPP
+
+class FieldArena {
+
+  /// @class    FieldArena
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Per-process aligned storage for temporary fields
+  ///
+  /// Methods allocate and deallocate temporary fields on every Block
+  /// every cycle, almost always with the same few sizes.  This class
+  /// keeps released arrays in per-process free lists keyed by size
+  /// so that steady-state allocations reuse them.  Since each
+  /// process only accesses its own free lists no locking is needed.
+  ///
+  /// Arrays are aligned to 64 bytes, a multiple of the cache-line
+  /// size and of the widest SIMD vector width.  Memory is allocated
+  /// in the "FieldArena" Memory group so that it is reported
+  /// separately from other Cello allocations.
+  ///
+  /// Temporary fields may outlive a single Method (e.g. history
+  /// fields, or iterative solver vectors), so the arena is not reset
+  /// wholesale; instead trim() is called at the end of each Block's
+  /// compute phase, and on the first call of each cycle releases
+  /// free arrays of sizes that were not requested during the
+  /// previous cycle, for example after mesh refinement changes the
+  /// Block sizes in use.
+
+public: // interface
+
+  /// Number of allocate() calls satisfied from the free lists
+  static long hits[CONFIG_NODE_SIZE];
+
+  /// Number of allocate() calls that required new memory
+  static long misses[CONFIG_NODE_SIZE];
+
+  /// Return an aligned array of at least the given number of bytes
+  static char * allocate (int bytes);
+
+  /// Return an array obtained from allocate() to the free lists
+  static void deallocate (char * array, int bytes);
+
+  /// Release free arrays of sizes not requested since the last
+  /// trim(), if not already called this cycle
+  static void trim (int cycle);
+
+  /// Release all free arrays on this process
+  static void clear ();
+
+  /// Bytes in arrays currently allocated to temporary fields
+  static int64_t bytes_used ();
+
+  /// Bytes in arrays currently held in the free lists
+  static int64_t bytes_free ();
+
+private: // functions
+
+  /// Round the requested size up to a multiple of the alignment
+  static int padded_ (int bytes)
+  { return ((bytes + align_ - 1) / align_) * align_; }
+
+  /// Allocate and free aligned memory in the "FieldArena" Memory group
+  static char * new_ (int bytes);
+  static void delete_ (char * array);
+
+private: // attributes
+
+  /// Alignment in bytes of all arrays
+  static const int align_ = 64;
+
+  /// Free arrays for each padded size
+  static std::map<int, std::vector<char *> > free_[CONFIG_NODE_SIZE];
+
+  /// Padded sizes requested since the last trim()
+  static std::set<int> used_[CONFIG_NODE_SIZE];
+
+  /// Cycle of the last trim()
+  static int cycle_trim_[CONFIG_NODE_SIZE];
+
+  /// Current bytes allocated to temporary fields
+  static int64_t bytes_used_[CONFIG_NODE_SIZE];
+
+  /// Current bytes held in the free lists
+  static int64_t bytes_free_[CONFIG_NODE_SIZE];
+
+};
+
+#endif /* DATA_FIELD_ARENA_HPP */
@@ -0,0 +1,426 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldCodec.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the FieldCodec class
+///
+/// Encoded stream:
+///
+///    int n                 number of decoded bytes
+///    int num_segments
+///    for each segment:
+///       int mode           segment_lossless, segment_lossy,
+///                          segment_sparse, segment_raw, or
+///                          segment_constant
+///       int bytes          number of decoded bytes in the segment
+///       int element_size
+///       double step        quantization step (segment_lossy only)
+///       int bytes_code     number of encoded bytes that follow
+///       char code[bytes_code]
+
+#include "data.hpp"
+
+enum codec_segment_enum {
+  segment_lossless,
+  segment_lossy,
+  segment_sparse,
+  segment_raw,
+  segment_constant
+};
+
+namespace {
+
+  template <class T>
+  void append_ (std::vector<char> & code, T value)
+  {
+    const char * p = reinterpret_cast<const char *>(&value);
+    code.insert(code.end(), p, p + sizeof(T));
+  }
+
+  template <class T>
+  const char * extract_ (const char * code, const char * code_end, T * value)
+  {
+    ASSERT("FieldCodec::decode()", "Encoded stream is truncated",
+           code + sizeof(T) <= code_end);
+    memcpy (value, code, sizeof(T));
+    return code + sizeof(T);
+  }
+
+  // "zig-zag" map signed integers to unsigned so that values of small
+  // magnitude have short variable-length encodings
+
+  inline unsigned long long zigzag_ (long long value)
+  {
+    return (static_cast<unsigned long long>(value) << 1) ^
+      static_cast<unsigned long long>(value >> 63);
+  }
+
+  inline long long unzigzag_ (unsigned long long value)
+  {
+    return static_cast<long long>(value >> 1) ^ -static_cast<long long>(value & 1);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FieldCodec::encode
+(const char * array, int n,
+ const std::vector<Segment> & segments,
+ std::vector<char> & code)
+{
+  code.clear();
+  append_(code,n);
+  append_(code,int(segments.size()));
+
+  std::vector<char> code_segment;
+  int offset = 0;
+  for (const Segment & segment : segments) {
+
+    ASSERT3 ("FieldCodec::encode()",
+             "Segment of %d bytes at offset %d exceeds array size %d",
+             segment.bytes, offset, n,
+             (offset + segment.bytes <= n));
+    ASSERT2 ("FieldCodec::encode()",
+             "Segment size %d is not a multiple of element size %d",
+             segment.bytes, segment.element_size,
+             (segment.bytes % segment.element_size == 0));
+
+    const char * array_segment = array + offset;
+    const int num_elements = segment.bytes / segment.element_size;
+    const double step = 2.0*segment.tolerance;
+
+    bool is_lossy = false;
+    const bool is_constant = is_constant_
+      (array_segment, segment.bytes, segment.element_size);
+    if (step > 0.0 && ! is_constant) {
+      if (segment.element_size == sizeof(float)) {
+        is_lossy = encode_lossy_
+          ((const float *)array_segment, num_elements, step, code_segment);
+      } else if (segment.element_size == sizeof(double)) {
+        is_lossy = encode_lossy_
+          ((const double *)array_segment, num_elements, step, code_segment);
+      } else if (segment.element_size == sizeof(long double)) {
+        is_lossy = encode_lossy_
+          ((const long double *)array_segment, num_elements, step,
+           code_segment);
+      }
+    }
+    int mode = segment_lossy;
+    if (is_constant) {
+      // e.g. a uniform ambient medium: store the value once
+      mode = segment_constant;
+      code_segment.assign
+        (array_segment, array_segment + segment.element_size);
+    } else if (! is_lossy && segment.raw) {
+      mode = segment_raw;
+      code_segment.assign(array_segment, array_segment + segment.bytes);
+    } else if (! is_lossy && segment.sparse) {
+      mode = encode_sparse_
+        (array_segment, segment.bytes, segment.element_size, code_segment) ?
+        segment_sparse : segment_raw;
+      if (mode == segment_raw) {
+        code_segment.assign(array_segment, array_segment + segment.bytes);
+      }
+    } else if (! is_lossy) {
+      mode = segment_lossless;
+      encode_lossless_
+        (array_segment, segment.bytes, segment.element_size, code_segment);
+    }
+
+    append_(code,mode);
+    append_(code,segment.bytes);
+    append_(code,segment.element_size);
+    if (is_lossy) append_(code,step);
+    append_(code,int(code_segment.size()));
+    code.insert(code.end(),code_segment.begin(),code_segment.end());
+
+    offset += segment.bytes;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int FieldCodec::decoded_size (const char * code)
+{
+  int n;
+  memcpy (&n, code, sizeof(int));
+  return n;
+}
+
+//----------------------------------------------------------------------
+
+void FieldCodec::decode (const char * code, int n_code, char * array)
+{
+  const char * code_end = code + n_code;
+
+  int n, num_segments;
+  code = extract_(code,code_end,&n);
+  code = extract_(code,code_end,&num_segments);
+
+  int offset = 0;
+  for (int i_s=0; i_s<num_segments; i_s++) {
+    int mode, bytes, element_size, bytes_code;
+    double step = 0.0;
+    code = extract_(code,code_end,&mode);
+    code = extract_(code,code_end,&bytes);
+    code = extract_(code,code_end,&element_size);
+    if (mode == segment_lossy) code = extract_(code,code_end,&step);
+    code = extract_(code,code_end,&bytes_code);
+
+    ASSERT("FieldCodec::decode()", "Encoded segment exceeds array size",
+           (offset + bytes <= n) && (code + bytes_code <= code_end));
+
+    const char * segment_end = code + bytes_code;
+    char * array_segment = array + offset;
+    const int num_elements = bytes / element_size;
+
+    const char * code_next = nullptr;
+    if (mode == segment_lossless) {
+      code_next = decode_lossless_
+        (code, segment_end, array_segment, bytes, element_size);
+    } else if (mode == segment_sparse) {
+      code_next = decode_sparse_
+        (code, segment_end, array_segment, bytes, element_size);
+    } else if (mode == segment_raw) {
+      ASSERT ("FieldCodec::decode()", "Encoded segment size mismatch",
+              bytes_code == bytes);
+      std::copy_n (code, bytes, array_segment);
+      code_next = segment_end;
+    } else if (mode == segment_constant) {
+      ASSERT ("FieldCodec::decode()", "Encoded segment size mismatch",
+              bytes_code == element_size);
+      for (int i=0; i<num_elements; i++) {
+        std::copy_n (code, element_size, array_segment + i*element_size);
+      }
+      code_next = segment_end;
+    } else if (element_size == sizeof(float)) {
+      code_next = decode_lossy_
+        (code, segment_end, (float *)array_segment, num_elements, step);
+    } else if (element_size == sizeof(double)) {
+      code_next = decode_lossy_
+        (code, segment_end, (double *)array_segment, num_elements, step);
+    } else if (element_size == sizeof(long double)) {
+      code_next = decode_lossy_
+        (code, segment_end, (long double *)array_segment, num_elements, step);
+    } else {
+      ERROR1 ("FieldCodec::decode()",
+              "Unsupported element size %d for lossy segment",
+              element_size);
+    }
+    ASSERT ("FieldCodec::decode()", "Encoded segment size mismatch",
+            code_next == segment_end);
+
+    code = segment_end;
+    offset += bytes;
+  }
+
+  // bytes not covered by segments were not encoded
+  std::fill_n (array + offset, n - offset, 0);
+}
+
+//----------------------------------------------------------------------
+
+bool FieldCodec::is_constant_
+(const char * array, int n, int element_size)
+{
+  for (int i=element_size; i<n; i+=element_size) {
+    if (memcmp (array + i, array, element_size) != 0) return false;
+  }
+  return n > element_size;
+}
+
+//----------------------------------------------------------------------
+
+void FieldCodec::encode_lossless_
+(const char * array, int n, int element_size, std::vector<char> & code)
+{
+  code.clear();
+
+  // shuffle bytes: byte k of element i is moved to k*num_elements + i
+
+  const int num_elements = n / element_size;
+  std::vector<unsigned char> shuffle(n);
+  for (int i=0; i<num_elements; i++) {
+    for (int k=0; k<element_size; k++) {
+      shuffle[k*num_elements + i] = array[i*element_size + k];
+    }
+  }
+
+  // run-length encode: control byte c >= 0 is followed by c+1 literal
+  // bytes, and c < 0 by a single byte repeated 1-c times
+
+  const int max_run = 128;
+  int i = 0;
+  while (i < n) {
+    int run = 1;
+    while (i + run < n && run < max_run && shuffle[i+run] == shuffle[i]) {
+      ++run;
+    }
+    if (run >= 3) {
+      code.push_back(char(1 - run));
+      code.push_back(shuffle[i]);
+      i += run;
+    } else {
+      // extend literals until the start of a run of at least 3 bytes
+      int j = i;
+      while (j < n && j - i < max_run &&
+             ! (j + 2 < n && shuffle[j] == shuffle[j+1] &&
+                shuffle[j] == shuffle[j+2])) {
+        ++j;
+      }
+      code.push_back(char(j - i - 1));
+      code.insert(code.end(), shuffle.begin() + i, shuffle.begin() + j);
+      i = j;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+const char * FieldCodec::decode_lossless_
+(const char * code, const char * code_end,
+ char * array, int n, int element_size)
+{
+  std::vector<char> shuffle(n);
+  int i = 0;
+  while (i < n) {
+    ASSERT ("FieldCodec::decode()", "Encoded stream is truncated",
+            code < code_end);
+    const int c = (signed char)(*code++);
+    const int count = (c >= 0) ? c + 1 : 1 - c;
+    ASSERT ("FieldCodec::decode()", "Encoded run exceeds segment size",
+            i + count <= n);
+    if (c >= 0) {
+      ASSERT ("FieldCodec::decode()", "Encoded stream is truncated",
+              code + count <= code_end);
+      std::copy_n (code, count, shuffle.begin() + i);
+      code += count;
+    } else {
+      ASSERT ("FieldCodec::decode()", "Encoded stream is truncated",
+              code < code_end);
+      std::fill_n (shuffle.begin() + i, count, *code++);
+    }
+    i += count;
+  }
+
+  const int num_elements = n / element_size;
+  for (int i=0; i<num_elements; i++) {
+    for (int k=0; k<element_size; k++) {
+      array[i*element_size + k] = shuffle[k*num_elements + i];
+    }
+  }
+  return code;
+}
+
+//----------------------------------------------------------------------
+
+bool FieldCodec::encode_sparse_
+(const char * array, int n, int element_size, std::vector<char> & code)
+{
+  code.clear();
+
+  // pairs of run lengths (zero elements, nonzero elements), each
+  // followed by the nonzero elements
+
+  const int num_elements = n / element_size;
+  auto is_zero = [array,element_size] (int i)
+  {
+    const char * element = array + i*element_size;
+    for (int k=0; k<element_size; k++) if (element[k]) return false;
+    return true;
+  };
+
+  int i = 0;
+  while (i < num_elements) {
+    const int i_zero = i;
+    while (i < num_elements && is_zero(i)) ++i;
+    const int i_value = i;
+    while (i < num_elements && ! is_zero(i)) ++i;
+    append_(code,i_value - i_zero);
+    append_(code,i - i_value);
+    code.insert(code.end(),
+                array + i_value*element_size, array + i*element_size);
+    if (int(code.size()) >= n) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+const char * FieldCodec::decode_sparse_
+(const char * code, const char * code_end,
+ char * array, int n, int element_size)
+{
+  const int num_elements = n / element_size;
+  int i = 0;
+  while (i < num_elements) {
+    int num_zero, num_value;
+    code = extract_(code,code_end,&num_zero);
+    code = extract_(code,code_end,&num_value);
+    const int bytes_value = num_value*element_size;
+    ASSERT ("FieldCodec::decode()", "Encoded run exceeds segment size",
+            num_zero >= 0 && num_value >= 0 &&
+            i + num_zero + num_value <= num_elements);
+    ASSERT ("FieldCodec::decode()", "Encoded stream is truncated",
+            code + bytes_value <= code_end);
+    std::fill_n (array + i*element_size, num_zero*element_size, 0);
+    i += num_zero;
+    std::copy_n (code, bytes_value, array + i*element_size);
+    code += bytes_value;
+    i += num_value;
+  }
+  return code;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+bool FieldCodec::encode_lossy_
+(const T * array, int n, double step, std::vector<char> & code)
+{
+  code.clear();
+
+  // largest quantized magnitude, leaving room for differences
+  const long double q_max = 4.0e18L;
+
+  long long q_prev = 0;
+  for (int i=0; i<n; i++) {
+    const long double q = std::round((long double)array[i] / step);
+    if (! (std::abs(q) < q_max)) return false; // also catches nan and inf
+    const long long q_curr = (long long)q;
+    unsigned long long value = zigzag_(q_curr - q_prev);
+    q_prev = q_curr;
+    // variable-length integer: 7 bits per byte, high bit set if more follow
+    while (value >= 0x80) {
+      code.push_back(char((value & 0x7f) | 0x80));
+      value >>= 7;
+    }
+    code.push_back(char(value));
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+const char * FieldCodec::decode_lossy_
+(const char * code, const char * code_end, T * array, int n, double step)
+{
+  long long q_prev = 0;
+  for (int i=0; i<n; i++) {
+    unsigned long long value = 0;
+    int shift = 0;
+    unsigned char byte;
+    do {
+      ASSERT ("FieldCodec::decode()", "Encoded stream is truncated",
+              code < code_end && shift < 64);
+      byte = *code++;
+      value |= (unsigned long long)(byte & 0x7f) << shift;
+      shift += 7;
+    } while (byte & 0x80);
+    q_prev += unzigzag_(value);
+    array[i] = T((long double)q_prev * step);
+  }
+  return code;
+}
@@ -0,0 +1,114 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldCodec.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Data] Declaration of the FieldCodec class
+
+#ifndef DATA_FIELD_CODEC_HPP
+#define DATA_FIELD_CODEC_HPP
+
+class FieldCodec {
+
+  /// @class    FieldCodec
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Compresses and decompresses packed field arrays
+  ///
+  /// A packed field array (e.g. the array of ghost-face values in a
+  /// refresh message) is divided into segments, one per field. Each
+  /// segment is encoded independently:
+  ///
+  /// - lossless: bytes are shuffled so that byte k of every element is
+  ///   stored contiguously (grouping the slowly-varying sign and exponent
+  ///   bytes), and the result is run-length encoded
+  ///
+  /// - lossy: if the segment has a positive tolerance, values are
+  ///   quantized to multiples of twice the tolerance, so that each decoded
+  ///   value is within the tolerance of the original (up to rounding to
+  ///   the field's precision). Differences of successive quantized values
+  ///   are stored as variable-length integers. Segments containing
+  ///   non-finite values, or values too large to quantize, are encoded
+  ///   losslessly instead.
+  ///
+  /// - sparse: runs of zero elements are skipped and runs of nonzero
+  ///   elements are copied unmodified, which is cheap to encode and
+  ///   decode and suits accumulated ghost values (e.g. deposited
+  ///   particle mass) that are mostly zero.  Segments that would not
+  ///   shrink are copied whole instead.
+  ///
+  /// - raw: segments are copied unmodified
+  ///
+  /// With any of these, a segment whose elements are all identical
+  /// (e.g. a uniform ambient medium) is stored as a single element.
+  ///
+  /// The encoded stream is self-describing, so decode() needs no
+  /// information about the fields or the codec used.
+
+public: // interface
+
+  /// A contiguous range of a packed array holding values of one field
+  struct Segment {
+    /// Number of bytes in the segment
+    int bytes;
+    /// Size in bytes of each element (4, 8, or 16)
+    int element_size;
+    /// Absolute error bound for lossy encoding, or 0 if lossless
+    double tolerance;
+    /// Whether to encode only runs of nonzero elements (if not lossy)
+    bool sparse;
+    /// Whether to copy the segment unencoded (if not lossy)
+    bool raw;
+  };
+
+  /// Encode the n bytes of array, divided into the given segments, and
+  /// store the result in code. Bytes beyond the last segment are not
+  /// encoded, and are zero when decoded.
+  static void encode (const char * array, int n,
+                      const std::vector<Segment> & segments,
+                      std::vector<char> & code);
+
+  /// Return the number of bytes in the array encoded in code
+  static int decoded_size (const char * code);
+
+  /// Decode the n bytes of code into array, which must hold at least
+  /// decoded_size(code) bytes
+  static void decode (const char * code, int n, char * array);
+
+private: // functions
+
+  /// Whether a segment has more than one element, all identical
+  static bool is_constant_ (const char * array, int n, int element_size);
+
+  /// Shuffle and run-length encode a segment
+  static void encode_lossless_ (const char * array, int n, int element_size,
+                                std::vector<char> & code);
+
+  /// Inverse of encode_lossless_()
+  static const char * decode_lossless_
+  (const char * code, const char * code_end,
+   char * array, int n, int element_size);
+
+  /// Encode runs of nonzero elements of a segment; returns false if
+  /// the result is not smaller than the segment
+  static bool encode_sparse_ (const char * array, int n, int element_size,
+                              std::vector<char> & code);
+
+  /// Inverse of encode_sparse_()
+  static const char * decode_sparse_
+  (const char * code, const char * code_end,
+   char * array, int n, int element_size);
+
+  /// Quantize a segment and encode differences of successive values;
+  /// returns false if the segment cannot be quantized
+  template <class T>
+  static bool encode_lossy_ (const T * array, int n, double step,
+                             std::vector<char> & code);
+
+  /// Inverse of encode_lossy_()
+  template <class T>
+  static const char * decode_lossy_
+  (const char * code, const char * code_end, T * array, int n, double step);
+
+};
+
+#endif /* DATA_FIELD_CODEC_HPP */
@@ -25,7 +25,10 @@ FieldData::FieldData
     history_time_(),
     units_scaling_(),
     coarse_dimensions_(),
-    array_coarse_()
+    array_coarse_(),
+    field_refreshed_(),
+    field_derived_(),
+    derived_time_()
 {
   if (nx != 0) {
     size_[0] = nx;
@@ -45,9 +48,73 @@ FieldData::FieldData
 
 //----------------------------------------------------------------------
 
+FieldData::FieldData (const FieldData & field_data) throw()
+{
+  copy_(field_data);
+}
+
+//----------------------------------------------------------------------
+
+FieldData & FieldData::operator= (const FieldData & field_data) throw()
+{
+  if (this != &field_data) {
+    deallocate_temporary_();
+    copy_(field_data);
+  }
+  return *this;
+}
+
+//----------------------------------------------------------------------
+
 FieldData::~FieldData() throw()
 {
   deallocate_permanent();
+  deallocate_temporary_();
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::copy_ (const FieldData & field_data) throw()
+{
+  for (int i=0; i<3; i++) size_[i] = field_data.size_[i];
+  array_permanent_   = field_data.array_permanent_;
+  temporary_size_    = field_data.temporary_size_;
+  offsets_           = field_data.offsets_;
+  ghosts_allocated_  = field_data.ghosts_allocated_;
+  history_id_        = field_data.history_id_;
+  history_time_      = field_data.history_time_;
+  units_scaling_     = field_data.units_scaling_;
+  coarse_dimensions_ = field_data.coarse_dimensions_;
+  array_coarse_      = field_data.array_coarse_;
+  field_refreshed_   = field_data.field_refreshed_;
+  field_derived_     = field_data.field_derived_;
+  derived_time_      = field_data.derived_time_;
+
+  // temporary fields are owned through the FieldArena, so allocate
+  // new arrays instead of aliasing (and later double-freeing) them
+  const int nt = field_data.array_temporary_.size();
+  array_temporary_.assign(nt,nullptr);
+  for (int i=0; i<nt; i++) {
+    const int n = temporary_size_[i];
+    const char * source = field_data.array_temporary_[i];
+    if (n > 0 && source != nullptr) {
+      array_temporary_[i] = FieldArena::allocate(n);
+      memcpy(array_temporary_[i],source,n);
+    } else {
+      temporary_size_[i] = 0;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::deallocate_temporary_ () throw()
+{
+  for (size_t i=0; i<array_temporary_.size(); i++) {
+    FieldArena::deallocate(array_temporary_[i],temporary_size_[i]);
+  }
+  array_temporary_.clear();
+  temporary_size_.clear();
 }
 
 //----------------------------------------------------------------------
@@ -56,23 +123,31 @@ void FieldData::pup(PUP::er &p)
 {
   TRACEPUP;
 
+  MemoryGroup memory_group (memory_group_fields);
+
   PUParray(p,size_,3);
 
-  p | array_permanent_;
+  // bulk copy of permanent fields, rather than per-element pup()
+  int np = array_permanent_.size();
+  p | np;
+  if (p.isUnpacking()) {
+    array_permanent_.resize(np);
+  }
+  if (np > 0) PUParray(p,array_permanent_.data(),np);
 
   p | temporary_size_;
   int nt = temporary_size_.size();
   p | nt;
   if (p.isUnpacking()) {
-    array_temporary_.resize(nt);
+    array_temporary_.resize(nt,nullptr);
   }
   for (int i=0; i<nt; i++) {
     int n = temporary_size_[i];
     if (n > 0) {
       if (p.isUnpacking()) {
-	array_temporary_[i].resize(n);
+	array_temporary_[i] = FieldArena::allocate(n);
       }
-      p | array_temporary_[i];
+      PUParray(p,array_temporary_[i],n);
     }
   }
 
@@ -82,13 +157,12 @@ void FieldData::pup(PUP::er &p)
   if (p.isUnpacking()) {
     array_coarse_.resize(nc);
   }
+  // coarse arrays only hold values within a refresh, never across
+  // migration or checkpoint, so only their sizes are packed
   for (int i=0; i<nc; i++) {
     int n = coarse_dimensions_[i];
-    if (n > 0) {
-      if (p.isUnpacking()) {
-	array_coarse_[i].resize(n);
-      }
-      p | array_coarse_[i];
+    if (n > 0 && p.isUnpacking()) {
+      array_coarse_[i].assign(n,0);
     }
   }
   p | offsets_;
@@ -168,9 +242,7 @@ char * FieldData::values
       int id_temp = id_field - field_descr->num_permanent();
 
       if (0 <= id_temp && id_temp < int(array_temporary_.size())) {
-	if (array_temporary_[id_temp].size() > 0) {
-          values = array_temporary_[id_temp].data();
-        }
+	values = array_temporary_[id_temp];
       }
     }
   }
@@ -195,9 +267,15 @@ char * FieldData::coarse_values
 {
   ASSERT("FieldData::coarse_values", "index_history must be 0",
          index_history == 0);
+  // allocated when first used, so only Blocks with coarse neighbors
+  // keep them
+  if (id_field >= int(array_coarse_.size()) ||
+      array_coarse_[id_field].size() == 0) {
+    allocate_coarse(field_descr,id_field);
+  }
 #ifdef DEBUG_COARSE_ARRAY
   CkPrintf ("DEBUG_COARSE_ARRAY %p returning %p[%d]\n",
-            (void*)this,(void *)array_coarse_[id_field],id_field);
+            (void*)this,(void *)array_coarse_[id_field].data(),id_field);
 #endif
   return array_coarse_[id_field].data();
 }
@@ -320,6 +398,7 @@ void FieldData::allocate_permanent
 (const FieldDescr * field_descr,
  bool ghosts_allocated ) throw()
 {
+  MemoryGroup memory_group (memory_group_fields);
 
   // Error check size
 
@@ -338,31 +417,18 @@ void FieldData::allocate_permanent
     return;
   }
 
-  allocate_coarse(field_descr);
-
   ghosts_allocated_ = ghosts_allocated;
 
-  int padding   = field_descr->padding();
   int alignment = field_descr->alignment();
 
-  int array_size = 0;
-
-  for (int id_field=0; id_field<field_descr->field_count(); id_field++) {
+  // Field offsets relative to the aligned start of the array
 
-    // Increment array_size, including padding and alignment adjustment
-
-    int nx,ny,nz;       // not needed
-
-    int size = field_size(field_descr,id_field, &nx,&ny,&nz);
-
-    array_size += adjust_padding_   (size,padding);
-    array_size += adjust_alignment_ (size,alignment);
-
-  }
+  std::vector<int> field_offsets;
+  const int layout_size = permanent_layout_(field_descr,field_offsets);
 
   // Adjust for possible initial misalignment
 
-  array_size += alignment - 1;
+  const int array_size = layout_size + alignment - 1;
 
   // Allocate the array
 
@@ -370,32 +436,14 @@ void FieldData::allocate_permanent
 
   // Initialize field_begin
 
-  int field_offset = align_padding_(alignment);
+  const int field_offset = align_padding_(alignment);
 
   offsets_.reserve(field_descr->field_count());
 
   for (int id_field=0; id_field<field_descr->field_count(); id_field++) {
-
-    offsets_.push_back(field_offset);
-
-    // Increment array_size, including padding and alignment adjustment
-
-    int nx,ny,nz;       // not needed
-
-    int size = field_size(field_descr,id_field,&nx,&ny,&nz);
-
-    field_offset += adjust_padding_  (size,padding);
-    field_offset += adjust_alignment_(size,alignment);
+    offsets_.push_back(field_offset + field_offsets[id_field]);
   }
 
-  // check if array_size is too big or too small
-
-  if ( ! ( 0 <= (array_size - field_offset)
-	   &&   (array_size - field_offset) < alignment)) {
-    ERROR ("FieldData::allocate_permanent",
-	   "Code error: array size was computed incorrectly");
-  };
-
   // Allocate any "temporary" fields for history
 
   const int np = field_descr->num_permanent();
@@ -414,28 +462,30 @@ void FieldData::allocate_temporary (const FieldDescr * field_descr,
 				    int id_field) throw ()
 
 {
-  allocate_coarse(field_descr,id_field);
-
   int index_field = id_field - field_descr->num_permanent();
   if (! (index_field < int(array_temporary_.size()))) {
-    array_temporary_.resize(index_field+1);
-    temporary_size_. resize(index_field+1);
+    array_temporary_.resize(index_field+1,nullptr);
+    temporary_size_. resize(index_field+1,0);
   }
 
-  if (array_temporary_[index_field].size() == 0) {
+  if (array_temporary_[index_field] == nullptr) {
     int mx,my,mz;
     dimensions(field_descr,id_field,&mx,&my,&mz);
     int m = mx*my*mz;
     precision_type precision = field_descr->precision(id_field);
+    int bytes = 0;
     if (precision == precision_single) {
-      array_temporary_[index_field].resize(m*sizeof(float));
-      temporary_size_[index_field] = m*sizeof(float);
+      bytes = m*sizeof(float);
     } else if (precision == precision_double) {
-      array_temporary_[index_field].resize(m*sizeof(double));
-      temporary_size_[index_field] = m*sizeof(double);
+      bytes = m*sizeof(double);
     } else if (precision == precision_quadruple) {
-      array_temporary_[index_field].resize(m*sizeof(long double));
-      temporary_size_[index_field] = m*sizeof(long double);
+      bytes = m*sizeof(long double);
+    }
+    if (bytes > 0) {
+      // std::vector<char>::resize() zero-initialized temporaries
+      array_temporary_[index_field] = FieldArena::allocate(bytes);
+      std::fill_n(array_temporary_[index_field],bytes,0);
+      temporary_size_[index_field] = bytes;
     } else {
       WARNING("FieldData::allocate_temporary",
 	      "Calling allocate_temporary() on already-allocated Field");
@@ -508,11 +558,13 @@ void FieldData::deallocate_temporary (const FieldDescr * field_descr,
   int index_field = id_field - field_descr->num_permanent();
 
   if (! (index_field < int(array_temporary_.size()))) {
-    array_temporary_.resize(index_field+1);
-    temporary_size_. resize(index_field+1);
+    array_temporary_.resize(index_field+1,nullptr);
+    temporary_size_. resize(index_field+1,0);
   }
-  if (array_temporary_[index_field].size() != 0) {
-    array_temporary_[index_field].clear();
+  if (array_temporary_[index_field] != nullptr) {
+    FieldArena::deallocate(array_temporary_[index_field],
+                           temporary_size_[index_field]);
+    array_temporary_[index_field] = nullptr;
   }
   temporary_size_ [index_field] = 0;
 }
@@ -544,6 +596,8 @@ void FieldData::reallocate_permanent
  bool               ghosts_allocated
  ) throw()
 {
+  MemoryGroup memory_group (memory_group_fields);
+
   if (! permanent_allocated() ) {
     WARNING ("FieldData::reallocate_permanent",
 	     "Array not allocated yet: calling allocate()");
@@ -552,7 +606,7 @@ void FieldData::reallocate_permanent
   }
 
   std::vector<int>  old_offsets;
-  std::vector<char> old_array;
+  std::vector<char, PageAllocator<char,memory_group_fields> > old_array;
 
   old_array = array_permanent_;
   old_offsets = offsets_;
@@ -907,28 +961,16 @@ void FieldData::save_history (const FieldDescr * field_descr, double time)
 
   if (nh > 0) {
 
-    // Save oldest history id's
-
-    std::vector<int> history_id_save;
-    history_id_save.resize(np);
-    for (int ip=0; ip<np; ip++) {
-      history_id_save[ip] = history_id_[ip+np*(nh-1)];
-    }
-
-    // Shuffle remaining id's
-    for (int ih=nh-1; ih>0; ih--) {
-      for (int ip=0; ip<np; ip++) {
-	history_id_[ip+np*(ih)] = history_id_[ip+np*(ih-1)];
-      }
-    }
-
-    // Copy saved oldest id's to newest id's
+    // Rotate history id's in place, so that the oldest history
+    // buffers become the newest
 
-    for (int ip=0; ip<np; ip++) {
-      history_id_[ip] = history_id_save[ip];
-    }
+    std::rotate (history_id_.begin(),
+                 history_id_.begin() + np*(nh-1),
+                 history_id_.begin() + np*nh);
 
-    // Copy field values to newest history
+    // Copy field values to newest history.  This copy cannot be
+    // replaced by swapping buffers: methods update permanent fields
+    // in place, and callers keep values() pointers across cycles
     for (int ip=0; ip<np; ip++) {
       int mx,my,mz;
       char * src = values(field_descr,ip,0);
@@ -939,9 +981,9 @@ void FieldData::save_history (const FieldDescr * field_descr, double time)
 
     // Shuffle times and save newest time
 
-    for (int ih=nh-1; ih>0; ih--) {
-      history_time_[ih] = history_time_[ih-1];
-    }
+    std::rotate (history_time_.begin(),
+                 history_time_.begin() + (nh-1),
+                 history_time_.begin() + nh);
 
     history_time_[0] = time;
   }
@@ -1028,6 +1070,76 @@ void FieldData::units_scale_code (const FieldDescr * field_descr, int id, double
 
 //----------------------------------------------------------------------
 
+void FieldData::set_modified (int id_field)
+{
+  for (auto & refreshed : field_refreshed_) {
+    if (0 <= id_field && id_field < int(refreshed.size())) {
+      refreshed[id_field] = false;
+    }
+  }
+  for (auto & derived : field_derived_) {
+    if (0 <= id_field && id_field < int(derived.size())) {
+      derived[id_field] = false;
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::set_derived
+(int id_derived, const std::vector<int> & input_list, double time)
+{
+  if (id_derived < 0) return;
+  if (id_derived >= int(field_derived_.size())) {
+    field_derived_.resize(id_derived + 1);
+    derived_time_.resize(id_derived + 1, 0.0);
+  }
+  std::vector<char> & derived = field_derived_[id_derived];
+  derived.clear();
+  for (int id_field : input_list) {
+    if (id_field >= int(derived.size())) derived.resize(id_field + 1, false);
+    derived[id_field] = true;
+  }
+  if (id_derived >= int(derived.size())) derived.resize(id_derived + 1, false);
+  derived[id_derived] = true;
+  derived_time_[id_derived] = time;
+}
+
+//----------------------------------------------------------------------
+
+bool FieldData::is_derived_current
+(int id_derived, const std::vector<int> & input_list, double time) const
+{
+  if (! (0 <= id_derived && id_derived < int(field_derived_.size())))
+    return false;
+  const std::vector<char> & derived = field_derived_[id_derived];
+  if (derived_time_[id_derived] != time) return false;
+  if (! (id_derived < int(derived.size()) && derived[id_derived]))
+    return false;
+  for (int id_field : input_list) {
+    if (! (0 <= id_field && id_field < int(derived.size()) &&
+           derived[id_field])) return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void FieldData::set_refreshed (int id_refresh, int id_field)
+{
+  if (id_refresh < 0 || id_field < 0) return;
+  if (id_refresh >= int(field_refreshed_.size())) {
+    field_refreshed_.resize(id_refresh + 1);
+  }
+  std::vector<char> & refreshed = field_refreshed_[id_refresh];
+  if (id_field >= int(refreshed.size())) {
+    refreshed.resize(id_field + 1, false);
+  }
+  refreshed[id_field] = true;
+}
+
+//----------------------------------------------------------------------
+
 int FieldData::data_size (FieldDescr * field_descr) const
 {
 
@@ -1036,7 +1148,10 @@ int FieldData::data_size (FieldDescr * field_descr) const
   SIZE_ARRAY_TYPE(size,int,size_,3);
   SIZE_VECTOR_TYPE(size,char,array_permanent_);
   SIZE_VECTOR_TYPE(size,int,temporary_size_);
-  SIZE_VECTOR_VECTOR_TYPE(size,char,array_temporary_);
+  SIZE_SCALAR_TYPE(size,int,array_temporary_.size());
+  for (size_t i=0; i<array_temporary_.size(); i++) {
+    SIZE_ARRAY_TYPE(size,char,array_temporary_[i],temporary_size_[i]);
+  }
   SIZE_VECTOR_TYPE(size,int,offsets_);
   SIZE_SCALAR_TYPE(size,bool,ghosts_allocated_);
   SIZE_VECTOR_TYPE(size,int,history_id_);
@@ -1063,7 +1178,11 @@ char * FieldData::save_data (FieldDescr * field_descr,
   SAVE_ARRAY_TYPE(pc,int,size_,3);
   SAVE_VECTOR_TYPE(pc,char,array_permanent_);
   SAVE_VECTOR_TYPE(pc,int,temporary_size_);
-  SAVE_VECTOR_VECTOR_TYPE(pc,char,array_temporary_);
+  const int num_temporary = array_temporary_.size();
+  SAVE_SCALAR_TYPE(pc,int,num_temporary);
+  for (size_t i=0; i<array_temporary_.size(); i++) {
+    SAVE_ARRAY_TYPE(pc,char,array_temporary_[i],temporary_size_[i]);
+  }
   SAVE_VECTOR_TYPE(pc,int,offsets_);
   SAVE_SCALAR_TYPE(pc,bool,ghosts_allocated_);
   SAVE_VECTOR_TYPE(pc,int,history_id_);
@@ -1094,8 +1213,19 @@ char * FieldData::load_data (FieldDescr * field_descr,
 
   LOAD_ARRAY_TYPE(pc,int,size_,3);
   LOAD_VECTOR_TYPE(pc,char,array_permanent_);
+  for (size_t i=0; i<array_temporary_.size(); i++) {
+    FieldArena::deallocate(array_temporary_[i],temporary_size_[i]);
+  }
+  array_temporary_.clear();
   LOAD_VECTOR_TYPE(pc,int,temporary_size_);
-  LOAD_VECTOR_VECTOR_TYPE(pc,char,array_temporary_);
+  int num_temporary;
+  LOAD_SCALAR_TYPE(pc,int,num_temporary);
+  array_temporary_.resize(num_temporary,nullptr);
+  for (int i=0; i<num_temporary; i++) {
+    const int bytes = temporary_size_[i];
+    if (bytes > 0) array_temporary_[i] = FieldArena::allocate(bytes);
+    LOAD_ARRAY_TYPE(pc,char,array_temporary_[i],bytes);
+  }
   LOAD_VECTOR_TYPE(pc,int,offsets_);
   LOAD_SCALAR_TYPE(pc,bool,ghosts_allocated_);
   LOAD_VECTOR_TYPE(pc,int,history_id_);
@@ -1134,6 +1264,48 @@ int FieldData::adjust_alignment_
 
 //----------------------------------------------------------------------
 
+int FieldData::permanent_layout_
+(const FieldDescr * field_descr, std::vector<int> & field_offsets)
+  const throw ()
+{
+  const int padding   = field_descr->padding();
+  const int alignment = field_descr->alignment();
+  const int num_fields = field_descr->field_count();
+  const bool is_staggered =
+    (field_descr->layout() == field_layout_staggered);
+
+  field_offsets.resize(num_fields);
+
+  int offset = 0;
+  for (int id_field=0; id_field<num_fields; id_field++) {
+
+    if (is_staggered) {
+      // start field id_field at id_field/num_fields of the way through
+      // a stagger block, keeping the alignment
+      const int target = (FIELD_STAGGER_BYTES*id_field/num_fields)
+        / alignment * alignment;
+      offset += (target - offset % FIELD_STAGGER_BYTES + FIELD_STAGGER_BYTES)
+        % FIELD_STAGGER_BYTES;
+      offset += adjust_alignment_ (offset,alignment);
+    }
+
+    field_offsets[id_field] = offset;
+
+    // Increment offset, including padding and alignment adjustment
+
+    int nx,ny,nz;       // not needed
+
+    const int size = field_size(field_descr,id_field,&nx,&ny,&nz);
+
+    offset += adjust_padding_   (size,padding);
+    offset += adjust_alignment_ (size,alignment);
+  }
+
+  return offset;
+}
+
+//----------------------------------------------------------------------
+
 int FieldData::align_padding_ (int alignment) const throw()
 {
   long unsigned start_long = reinterpret_cast<long unsigned>(&array_permanent_[0]);
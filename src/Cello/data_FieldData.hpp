@@ -38,6 +38,12 @@ public: // interface
   FieldData(const FieldDescr * = NULL,
 	    int nx=0, int ny=1, int nz=1) throw();
 
+  /// Copy constructor: temporary fields are deep-copied from the FieldArena
+  FieldData(const FieldData & field_data) throw();
+
+  /// Assignment operator: temporary fields are deep-copied from the FieldArena
+  FieldData & operator= (const FieldData & field_data) throw();
+
   /// Deconstructor
   ~FieldData() throw();
 
@@ -205,6 +211,16 @@ public: // interface
   size_t permanent_size() const throw()
   { return array_permanent_.size(); }
 
+  /// Return the bytes allocated for permanent, temporary, and coarse
+  /// arrays
+  int64_t bytes_allocated() const throw()
+  {
+    int64_t bytes = array_permanent_.size();
+    for (int size : temporary_size_) bytes += size;
+    for (const auto & array : array_coarse_) bytes += array.size();
+    return bytes;
+  }
+
   /// Allocate storage for the permanent fields
   void allocate_permanent(const FieldDescr *,
 			  bool ghosts_allocated = false) throw();
@@ -295,6 +311,57 @@ public: // interface
   /// 1.0 if in code units, or the scaling factor if in cgs
   double units_scaling (const FieldDescr *, int id);
 
+  //--------------------------------------------------
+  // Sparse refresh
+  //--------------------------------------------------
+
+  /// Record that the values of a field may have changed, so that it
+  /// is sent by the next refresh of each sparse Refresh object
+  void set_modified (int id_field);
+
+  /// Record that the values of all fields may have changed
+  void set_all_modified ()
+  {
+    field_refreshed_.clear();
+    field_derived_.clear();
+  }
+
+  /// Record that ghost zone values may have changed, e.g. by a
+  /// refresh, which invalidates derived fields but not sparse
+  /// refreshes
+  void set_ghosts_modified ()
+  { field_derived_.clear(); }
+
+  /// Record that a field has been sent to neighbors by the given
+  /// sparse Refresh object
+  void set_refreshed (int id_refresh, int id_field);
+
+  /// Return whether a field may have changed since it was last sent
+  /// to neighbors by the given sparse Refresh object
+  bool is_modified (int id_refresh, int id_field) const
+  {
+    return ! (0 <= id_refresh && id_refresh < int(field_refreshed_.size()) &&
+              0 <= id_field   &&
+              id_field < int(field_refreshed_[id_refresh].size()) &&
+              field_refreshed_[id_refresh][id_field]);
+  }
+
+  //--------------------------------------------------
+  // Derived field cache
+  //--------------------------------------------------
+
+  /// Record that a derived field has been computed at the given time
+  /// from the current values of the given input fields
+  void set_derived (int id_derived, const std::vector<int> & input_list,
+                    double time);
+
+  /// Return whether a derived field was computed at the given time
+  /// and neither it nor any of the given input fields have been
+  /// modified since
+  bool is_derived_current (int id_derived,
+                           const std::vector<int> & input_list,
+                           double time) const;
+
   //--------------------------------------------------
 
   /// Return the number of bytes required to serialize the data object
@@ -327,6 +394,19 @@ private: // functions
 	      int gx, int gy, int gz) const throw();
 
 
+  /// Copy all attributes of field_data, allocating new temporary
+  /// fields from the FieldArena rather than aliasing its arrays
+  void copy_ (const FieldData & field_data) throw();
+
+  /// Return the temporary fields to the FieldArena
+  void deallocate_temporary_ () throw();
+
+  /// Compute the offset of each field relative to the aligned start of
+  /// the permanent array for the FieldDescr layout, returning the
+  /// total size in bytes
+  int permanent_layout_ (const FieldDescr * field_descr,
+                         std::vector<int> & field_offsets) const throw();
+
   /// Given field size and padding, compute offset to start of the next field
   int adjust_padding_ (int size, int padding) const throw();
 
@@ -382,14 +462,16 @@ private: // attributes
   /// Size of fields, assuming centered
   int size_[3];
 
-  /// Single array of permanent fields
-  std::vector<char> array_permanent_;
+  /// Single array of permanent fields, mapped from fresh pages so
+  /// that it is local to the NUMA domain of the owning process
+  std::vector<char, PageAllocator<char,memory_group_fields> >
+  array_permanent_;
 
   /// Length of allocated temporary fields
   std::vector<int> temporary_size_;
 
-  /// Array of temporary fields
-  std::vector< std::vector<char> > array_temporary_;
+  /// Array of temporary fields, allocated from the FieldArena
+  std::vector<char *> array_temporary_;
 
   /// Offsets into values_ of the first element of each field
   std::vector<int> offsets_;
@@ -416,6 +498,20 @@ private: // attributes
   /// Coarse fields with one ghost zone for padded Prolong
   std::vector< std::vector<char> > array_coarse_;
 
+  //--------------------------------------------------
+
+  /// Whether each field [id_field] is unchanged since it was last sent
+  /// by each sparse Refresh object [id_refresh].  Not serialized, so
+  /// all fields are considered modified after migration or restart.
+  std::vector< std::vector<char> > field_refreshed_;
+
+  /// Whether each field [id_field] is unchanged since each derived
+  /// field [id_derived] was computed, and the Block time at which it
+  /// was computed.  Not serialized, so derived fields are recomputed
+  /// after migration or restart.
+  std::vector< std::vector<char> > field_derived_;
+  std::vector< double > derived_time_;
+
 };   
 
 #endif /* DATA_FIELD_DATA_HPP */
@@ -19,12 +19,16 @@ FieldDescr::FieldDescr () throw ()
     groups_(),
     alignment_(1),
     padding_(0),
+    layout_(field_layout_packed),
     precision_(),
     centering_(),
     ghost_depth_(),
     conserved_(),
     history_(0),
-    history_id_()
+    history_id_(),
+    lazy_name_(),
+    lazy_lifecycle_(),
+    lifecycle_()
 {
   for (int i=0; i<3; i++) {
     ghost_depth_default_[i] = 0;
@@ -170,6 +174,52 @@ int FieldDescr::insert_temporary(const std::string & field_name) throw()
 
 //----------------------------------------------------------------------
 
+void FieldDescr::request_lazy
+(const std::string & field_name, int lifecycle) throw()
+{
+  ASSERT1 ("FieldDescr::request_lazy()",
+           "Lazy field %s must have lifecycle cycle or demand",
+           field_name.c_str(),
+           (lifecycle == field_lifecycle_cycle ||
+            lifecycle == field_lifecycle_demand));
+  for (size_t i=0; i<lazy_name_.size(); i++) {
+    if (lazy_name_[i] == field_name) {
+      // keep the longer lifecycle if requested twice
+      lazy_lifecycle_[i] = std::max(lazy_lifecycle_[i],lifecycle);
+      return;
+    }
+  }
+  lazy_name_.push_back(field_name);
+  lazy_lifecycle_.push_back(lifecycle);
+}
+
+//----------------------------------------------------------------------
+
+void FieldDescr::insert_lazy(int precision) throw()
+{
+  for (size_t i=0; i<lazy_name_.size(); i++) {
+    const std::string & field_name = lazy_name_[i];
+    if (is_field(field_name)) continue;
+    const int id = insert_temporary();
+    id_[field_name] = id;
+    set_precision(id,precision);
+    lifecycle_[id] = lazy_lifecycle_[i];
+  }
+  lazy_name_.clear();
+  lazy_lifecycle_.clear();
+}
+
+//----------------------------------------------------------------------
+
+int FieldDescr::lifecycle(int id_field) const throw()
+{
+  if (is_permanent(id_field)) return field_lifecycle_permanent;
+  auto it = lifecycle_.find(id_field);
+  return (it != lifecycle_.end()) ? it->second : field_lifecycle_temporary;
+}
+
+//----------------------------------------------------------------------
+
 int FieldDescr::insert_(const std::string & field_name,
 			bool is_permanent) throw()
 {
@@ -278,12 +328,16 @@ void FieldDescr::set_default_ghost_depth(int gx, int gy, int gz) throw()
 void FieldDescr::copy_(const FieldDescr & field_descr) throw()
 {
   name_      = field_descr.name_;
+  lazy_name_ = field_descr.lazy_name_;
+  lazy_lifecycle_ = field_descr.lazy_lifecycle_;
+  lifecycle_ = field_descr.lifecycle_;
   num_permanent_ = field_descr.num_permanent_;
   num_temporary_ = field_descr.num_temporary_;
   id_        = field_descr.id_;
   groups_    = field_descr.groups_;
   alignment_ = field_descr.alignment_;
   padding_   = field_descr.padding_;
+  layout_    = field_descr.layout_;
   precision_ = field_descr.precision_;
   for (size_t i=0; i<centering_.size(); i++) {
     delete [] centering_[i];
@@ -56,6 +56,7 @@ public: // functions
     p | groups_;
     p | alignment_;
     p | padding_;
+    p | layout_;
     p | precision_;
 
     if (pk) n=centering_.size();
@@ -77,6 +78,9 @@ public: // functions
     p | conserved_;
     p | history_;
     p | history_id_;
+    p | lazy_name_;
+    p | lazy_lifecycle_;
+    p | lifecycle_;
   }
 
   /// Set alignment
@@ -87,6 +91,10 @@ public: // functions
   void set_padding(int padding) throw()
   { padding_ = padding; }
 
+  /// Set the field_layout_type layout of permanent fields
+  void set_layout(int layout) throw()
+  { layout_ = layout; }
+
   /// Set precision for a field
   void set_precision(int id_field, int precision) throw();
 
@@ -108,6 +116,22 @@ public: // functions
   /// Insert a new temporary field (does not require a name)
   int insert_temporary(const std::string & name_field = "") throw();
 
+  /// Request a named field with lifecycle field_lifecycle_cycle or
+  /// field_lifecycle_demand.  It is inserted by insert_lazy() after
+  /// all permanent fields, unless a permanent field has the same name
+  void request_lazy(const std::string & name_field, int lifecycle) throw();
+
+  /// Insert the requested lazy fields as temporary fields with the
+  /// given precision
+  void insert_lazy(int precision) throw();
+
+  /// Return the field_lifecycle_type of the field
+  int lifecycle(int id_field) const throw();
+
+  /// Return the lifecycle of each lazy field, by field id
+  const std::map<int,int> & lazy_fields() const throw()
+  { return lifecycle_; }
+
   /// Return the number of fields
   int field_count() const throw();
 
@@ -192,6 +216,10 @@ public: // functions
   int padding() const throw()
   { return padding_; }
 
+  /// field_layout_type layout of permanent fields in memory
+  int layout() const throw()
+  { return layout_; }
+
   /// Return precision of given field
   int precision(int id_field) const throw()
   {
@@ -282,6 +310,9 @@ private: // attributes
   /// padding between fields in bytes
   int padding_;
 
+  /// field_layout_type layout of permanent fields
+  int layout_;
+
   /// Precision of each field
   std::vector<int> precision_;
 
@@ -306,6 +337,17 @@ private: // attributes
   /// Temporary fields used for history.  Non-permuted.
   std::vector<int> history_id_;
 
+  /// Names and lifecycles of lazy fields requested but not yet
+  /// inserted
+  std::vector<std::string> lazy_name_;
+  std::vector<int> lazy_lifecycle_;
+
+  /// Lifecycle of each inserted lazy field, by field id.  Lazy fields
+  /// are temporary fields with a name in id_ but not in name_, so
+  /// loops over field_count() (output, add_all_fields(), etc.) skip
+  /// them
+  std::map<int,int> lifecycle_;
+
 };
 
 #endif /* DATA_FIELD_DESCR_HPP */
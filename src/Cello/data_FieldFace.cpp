@@ -120,6 +120,33 @@ enum enum_op_type {
 #   define CHECK_COARSE(FIELD,index_field)  /* ... */
 #endif
 
+namespace {
+
+  /// Box-derived loop limits, cached across consecutive fields in a
+  /// Refresh field list that share ghost depth, centering, and
+  /// accumulate flag, so the Box is only recomputed when they change
+  struct FaceRegion {
+    FaceRegion() : valid(false) {}
+    bool match (const int g[3], const int c[3], bool a) const
+    {
+      return valid && (a == accumulate) &&
+        g[0]==g3[0] && g[1]==g3[1] && g[2]==g3[2] &&
+        c[0]==c3[0] && c[1]==c3[1] && c[2]==c3[2];
+    }
+    void set (const int g[3], const int c[3], bool a)
+    {
+      valid = true;
+      accumulate = a;
+      for (int i=0; i<3; i++) { g3[i] = g[i]; c3[i] = c[i]; }
+    }
+    bool valid;
+    bool accumulate;
+    int g3[3], c3[3];
+    int i3[3], n3[3];
+    int ic3[3], nc3[3];
+  };
+}
+
 //----------------------------------------------------------------------
 
 FieldFace::FieldFace (int rank) throw()
@@ -213,6 +240,8 @@ void FieldFace::pup (PUP::er &p)
 
 void FieldFace::face_to_array ( Field field, int * n, char ** array) throw()
 {
+  MemoryGroup memory_group (memory_group_messages);
+
   ASSERT("FieldFace::face_to_array()",
 	 "field_src.size() must be > 0",
 	 refresh_->any_fields());
@@ -229,13 +258,18 @@ void FieldFace::face_to_array ( Field field, int * n, char ** array) throw()
 }
 
 //----------------------------------------------------------------------
-void FieldFace::face_to_array ( Field field,char * array) throw()
+void FieldFace::face_to_array
+( Field field,char * array, std::vector<int> * field_bytes) throw()
 {
   size_t index_array = 0;
 
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
 
+  if (field_bytes) field_bytes->clear();
+
+  FaceRegion region;
+
   for (size_t i_f=0; i_f < field_list_src.size(); i_f++) {
 
     const size_t index_field = field_list_src[i_f];
@@ -256,20 +290,26 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 
     const bool accumulate = refresh_->accumulate(i_f);
 
-    int i3[3], n3[3];
-    field.size(n3,n3+1,n3+2);
-    Box box(rank_,n3,g3);
-    box.set_centering(c3);
-    set_box_(&box);
+    if (! region.match(g3,c3,accumulate)) {
+      int nb3[3];
+      field.size(nb3,nb3+1,nb3+2);
+      Box box(rank_,nb3,g3);
+      box.set_centering(c3);
+      set_box_(&box);
 
-    box_adjust_accumulate_(&box,accumulate,g3);
+      box_adjust_accumulate_(&box,accumulate,g3);
 
-    box.compute_region();
-    // limits for Send block 
-    //    box.get_start_size(i3,n3,BlockType::receive,BlockType::send);
-    bool lpad;
-    TRACE_ONCE;
-    box.get_start_size(i3,n3,BlockType::send,BlockType::send,lpad=true);
+      box.compute_region();
+      // limits for Send block 
+      //    box.get_start_size(i3,n3,BlockType::receive,BlockType::send);
+      bool lpad;
+      TRACE_ONCE;
+      box.get_start_size
+        (region.i3,region.n3,BlockType::send,BlockType::send,lpad=true);
+      region.set(g3,c3,accumulate);
+    }
+    int i3[3] = {region.i3[0],region.i3[1],region.i3[2]};
+    int n3[3] = {region.n3[0],region.n3[1],region.n3[2]};
 #ifdef DEBUG_NEW_BOX
     if (i_f == 0) {
       CkPrintf ("DEBUG_NEW_BOX face_to_array() %d %d %d\n",i3[0],i3[1],i3[2]);
@@ -315,6 +355,10 @@ void FieldFace::face_to_array ( Field field,char * array) throw()
 
     // unscale by density if needed to convert back from conservative form
     div_by_density_(field,index_field,i3,n3,m3);
+
+    if (field_bytes) {
+      field_bytes->push_back(&array[index_array] - array_face);
+    }
   }
 
 }
@@ -328,6 +372,8 @@ void FieldFace::array_to_face (char * array, Field field) throw()
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
 
+  FaceRegion region;
+
   for (size_t i_f=0; i_f < field_list_dst.size(); i_f++) {
 
     size_t index_field = field_list_dst[i_f];
@@ -348,25 +394,36 @@ void FieldFace::array_to_face (char * array, Field field) throw()
 
     const bool accumulate = refresh_->accumulate(i_f);
 
-    int i3[3], n3[3];
+    bool lpad;
+    if (! region.match(g3,c3,accumulate)) {
 
-    // adjust face relative to sender
-    invert_face();
+      // adjust face relative to sender
+      invert_face();
 
-    field.size(n3,n3+1,n3+2);
-    Box box (rank_,n3,g3);
-    set_box_(&box);
-    box.set_centering(c3);
-    invert_face();
+      int nb3[3];
+      field.size(nb3,nb3+1,nb3+2);
+      Box box (rank_,nb3,g3);
+      set_box_(&box);
+      box.set_centering(c3);
+      invert_face();
 
-    box_adjust_accumulate_(&box,accumulate,g3);
+      box_adjust_accumulate_(&box,accumulate,g3);
 
-    bool lpad;
-    TRACE_ONCE;
-    box.get_start_size(i3,n3,BlockType::receive,BlockType::receive,lpad=false);
+      TRACE_ONCE;
+      box.get_start_size
+        (region.i3,region.n3,
+         BlockType::receive,BlockType::receive,lpad=false);
+      if (refresh_type_ == refresh_fine) {
+        TRACE_ONCE;
+        box.get_start_size
+          (region.ic3,region.nc3,BlockType::send,BlockType::send,lpad=true);
+      }
+      region.set(g3,c3,accumulate);
+    }
+    int i3[3] = {region.i3[0],region.i3[1],region.i3[2]};
+    int n3[3] = {region.n3[0],region.n3[1],region.n3[2]};
 
 #ifdef DEBUG_NEW_BOX
-    box.print("array_to_face");
     if (i_f == 0) {
       CkPrintf ("DEBUG_NEW_BOX array_to_face %d %d %d\n",i3[0],i3[1],i3[2]);
       CkPrintf ("DEBUG_NEW_BOX array_to_face %d %d %d\n",n3[0],n3[1],n3[2]);
@@ -382,9 +439,7 @@ void FieldFace::array_to_face (char * array, Field field) throw()
               (prolong() != nullptr));
         
       int ic3[3];
-      int nc3[3];
-      TRACE_ONCE;
-      box.get_start_size(ic3,nc3,BlockType::send,BlockType::send,lpad=true);
+      int nc3[3] = {region.nc3[0],region.nc3[1],region.nc3[2]};
       int mc3[3] = {nc3[0],nc3[1],nc3[2]};
       // reset ic3 for array
       ic3[0] = 0;
@@ -571,6 +626,8 @@ int FieldFace::num_bytes_array(Field field) throw()
   auto field_list_src = refresh_->field_list_src();
   auto field_list_dst = refresh_->field_list_dst();
 
+  FaceRegion region;
+
   for (size_t i_f=0; i_f < field_list_src.size(); i_f++) {
 
     size_t index_field = field_list_src[i_f];
@@ -589,18 +646,23 @@ int FieldFace::num_bytes_array(Field field) throw()
 
     const bool accumulate = refresh_->accumulate(i_f);
 
-    Box box (rank_,n3,g3);
-    set_box_(&box);
-    box.set_centering(c3);
+    if (! region.match(g3,c3,accumulate)) {
+      Box box (rank_,n3,g3);
+      set_box_(&box);
+      box.set_centering(c3);
 
-    box_adjust_accumulate_(&box,accumulate,g3);
+      box_adjust_accumulate_(&box,accumulate,g3);
 
-    bool lpad;
-    int i3[3];
-    TRACE_ONCE;
-    box.get_start_size(i3,n3,BlockType::send,BlockType::send,lpad=true);
+      bool lpad;
+      TRACE_ONCE;
+      box.get_start_size
+        (region.i3,region.n3,BlockType::send,BlockType::send,lpad=true);
+      region.set(g3,c3,accumulate);
+    }
+    for (int i=0; i<3; i++) n3[i] = region.n3[i];
     
 #ifdef DEBUG_NEW_BOX
+    int * i3 = region.i3;
     if (i_f == 0) {
       CkPrintf ("DEBUG_NEW_BOX num_bytes_array() %d %d %d\n",i3[0],i3[1],i3[2]);
       CkPrintf ("DEBUG_NEW_BOX num_bytes_array() %d %d %d\n",n3[0],n3[1],n3[2]);
@@ -673,8 +735,11 @@ char * FieldFace::load_data (char * buffer)
 
   memcpy(&refresh_type_,p,n=sizeof(int));   p+=n;
 
-  Refresh * refresh = new Refresh;
-  set_refresh(refresh,true);
+  // reuse owned Refresh object if available (see FieldFacePool)
+  if (! (new_refresh_ && refresh_ != nullptr)) {
+    Refresh * refresh = new Refresh;
+    set_refresh(refresh,true);
+  }
 
   p = refresh_->load_data(p);
 
@@ -688,6 +753,52 @@ char * FieldFace::load_data (char * buffer)
 
 //======================================================================
 
+namespace {
+
+  /// Copy (or add) an n3[0] x n3[1] x n3[2] region between two
+  /// arrays with row strides md3 / ms3.  Rows are contiguous, and the
+  /// row length NX is a compile-time constant when NX > 0 so that the
+  /// short rows of x-axis faces (ghost depth 3 or 4) are unrolled.
+  template<class T, int NX, bool ACCUMULATE>
+  void copy_rows_
+  (T       * vd, int mdx, int mdy,
+   const T * vs, int msx, int msy, const int n3[3])
+  {
+    const int nx = (NX > 0) ? NX : n3[0];
+    for (int iz=0; iz<n3[2]; iz++) {
+      for (int iy=0; iy<n3[1]; iy++) {
+        T       * rd = vd + mdx*(iy + mdy*iz);
+        const T * rs = vs + msx*(iy + msy*iz);
+        if (ACCUMULATE) {
+          #pragma omp simd
+          for (int ix=0; ix<nx; ix++) rd[ix] += rs[ix];
+        } else {
+          #pragma omp simd
+          for (int ix=0; ix<nx; ix++) rd[ix] = rs[ix];
+        }
+      }
+    }
+  }
+
+  /// Select the copy_rows_() specialization for the given row length
+  template<class T, bool ACCUMULATE>
+  void copy_region_
+  (T       * vd, int mdx, int mdy,
+   const T * vs, int msx, int msy, const int n3[3])
+  {
+    switch (n3[0]) {
+    case 1: copy_rows_<T,1,ACCUMULATE>(vd,mdx,mdy,vs,msx,msy,n3); break;
+    case 2: copy_rows_<T,2,ACCUMULATE>(vd,mdx,mdy,vs,msx,msy,n3); break;
+    case 3: copy_rows_<T,3,ACCUMULATE>(vd,mdx,mdy,vs,msx,msy,n3); break;
+    case 4: copy_rows_<T,4,ACCUMULATE>(vd,mdx,mdy,vs,msx,msy,n3); break;
+    default:copy_rows_<T,0,ACCUMULATE>(vd,mdx,mdy,vs,msx,msy,n3); break;
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
 template<class T>
 size_t FieldFace::load_
 ( T * array_face, const T * field_face, 
@@ -695,20 +806,12 @@ size_t FieldFace::load_
 {
   // NOTE: don't check accumulate since loading array; accumulate
   // is handled in corresponding store_() at the receiving end
-  // add values
-
-  for (int iz=0; iz <n3[2]; iz++)  {
-    int kz = iz+i3[2];
-    for (int iy=0; iy < n3[1]; iy++) {
-      int ky = iy+i3[1];
-      for (int ix=0; ix < n3[0]; ix++) {
-	int kx = ix+i3[0];
-	int index_array = ix +   n3[0]*(iy +   n3[1] * iz);
-	int index_field = kx + m3[0]*(ky + m3[1] * kz);
-	array_face[index_array] = field_face[index_field];
-      }
-    }
-  }
+
+  const int im = i3[0] + m3[0]*(i3[1] + m3[1]*i3[2]);
+
+  copy_region_<T,false>
+    (array_face,     n3[0],n3[1],
+     field_face + im,m3[0],m3[1], n3);
 
   return (sizeof(T) * n3[0] * n3[1] * n3[2]);
 
@@ -767,33 +870,13 @@ template<class T> size_t FieldFace::store_
   } else {
 
     if (accumulate) {
-      // add values
-      for (int iz=0; iz <n3[2]; iz++)  {
-        int kz = iz+i3[2];
-        for (int iy=0; iy < n3[1]; iy++) {
-          int ky = iy+i3[1];
-          for (int ix=0; ix < n3[0]; ix++) {
-            int kx = ix+i3[0];
-            int index_array = ix + n3[0]*(iy + n3[1] * iz);
-            int index_field = kx + m3[0]*(ky + m3[1] * kz);
-            ghost[index_field] += array[index_array];
-          }
-        }
-      }
+      copy_region_<T,true>
+        (ghost + im, m3[0],m3[1],
+         array,      n3[0],n3[1], n3);
     } else {
-      // copy values
-      for (int iz=0; iz <n3[2]; iz++)  {
-        int kz = iz+i3[2];
-        for (int iy=0; iy < n3[1]; iy++) {
-          int ky = iy+i3[1];
-          for (int ix=0; ix < n3[0]; ix++) {
-            int kx = ix+i3[0];
-            int index_array = ix + n3[0]*(iy + n3[1] * iz);
-            int index_field = kx + m3[0]*(ky + m3[1] * kz);
-            ghost[index_field] = array[index_array];
-          }
-        }
-      }
+      copy_region_<T,false>
+        (ghost + im, m3[0],m3[1],
+         array,      n3[0],n3[1], n3);
     }
   }
 
@@ -810,32 +893,14 @@ template<class T> void FieldFace::copy_
 {
   const int is0 = is3[0] + ms3[0]*(is3[1] + ms3[1]*is3[2]);
   const int id0 = id3[0] + md3[0]*(id3[1] + md3[1]*id3[2]);
-  T * vd0 = vd + id0;
-  const T * vs0 = vs + is0;
-  const int msx = ms3[0];
-  const int msy = ms3[1];
-  const int mdx = md3[0];
-  const int mdy = md3[1];
   if (accumulate) {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = ix + msx*(iy + msy*iz);
-	  int i_dst = ix + mdx*(iy + mdy*iz);
-	  vd0[i_dst] += vs0[i_src];
-	}
-      }
-    }
+    copy_region_<T,true>
+      (vd + id0, md3[0],md3[1],
+       vs + is0, ms3[0],ms3[1], ns3);
   } else {
-    for (int iz=0; iz <ns3[2]; iz++)  {
-      for (int iy=0; iy < ns3[1]; iy++) {
-	for (int ix=0; ix < ns3[0]; ix++) {
-	  int i_src = ix + msx*(iy + msy*iz);
-	  int i_dst = ix + mdx*(iy + mdy*iz);
-	  vd0[i_dst] = vs0[i_src];
-	}
-      }
-    }
+    copy_region_<T,false>
+      (vd + id0, md3[0],md3[1],
+       vs + is0, ms3[0],ms3[1], ns3);
   }
 }
 
@@ -1011,6 +1076,14 @@ void FieldFace::box_adjust_accumulate_ (Box * box, int accumulate, int g3[3])
     gs3[0] = (ghost_[0]&&face_[0]==0)?g3[0]:0;
     gs3[1] = (ghost_[1]&&face_[1]==0)?g3[1]:0;
     gs3[2] = (ghost_[2]&&face_[2]==0)?g3[2]:0;
+
+    // refresh only the ghost layers needed, if fewer than the field's
+    const int gl = refresh_->ghost_layers();
+    if (gl > 0) {
+      int gr3[3] = { std::min(g3[0],gl), std::min(g3[1],gl),
+                     std::min(g3[2],gl) };
+      box->set_recv_ghosts(gr3);
+    }
   }
   box->set_send_ghosts(gs3);
   box->compute_block_start(BoxType_receive);
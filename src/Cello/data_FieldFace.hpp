@@ -105,14 +105,20 @@ public: // interface
   /// Return the Refresh object
   Refresh * refresh () const
   { return refresh_; }
+
+  /// Return whether the Refresh object is deleted with this FieldFace
+  bool owns_refresh () const
+  { return new_refresh_; }
   
   void set_field_list (std::vector<int> field_list);
   
   /// Create an array with the field's face data
   void face_to_array(Field field, int * n, char ** array) throw();
 
-  /// Use existing array for field's face data
-  void face_to_array (Field field, char * array) throw();
+  /// Use existing array for field's face data. If field_bytes is
+  /// given, it is set to the number of bytes written for each field
+  void face_to_array (Field field, char * array,
+                      std::vector<int> * field_bytes = nullptr) throw();
 
   /// Copy the input array data to the field's ghost zones
 
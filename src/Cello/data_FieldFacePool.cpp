@@ -0,0 +1,97 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldFacePool.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the FieldFacePool class
+
+#include "cello.hpp"
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+long FieldFacePool::hits[CONFIG_NODE_SIZE] = {0};
+long FieldFacePool::misses[CONFIG_NODE_SIZE] = {0};
+std::map<int, std::vector<FieldFace *> >
+FieldFacePool::free_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
+FieldFace * FieldFacePool::acquire (int rank, int id_refresh)
+{
+  return acquire_(rank,id_refresh);
+}
+
+//----------------------------------------------------------------------
+
+FieldFace * FieldFacePool::acquire_owner (int rank)
+{
+  return acquire_(rank,key_owner_);
+}
+
+//----------------------------------------------------------------------
+
+FieldFace * FieldFacePool::acquire_ (int rank, int key)
+{
+  const int in = cello::index_static();
+  auto it = free_[in].find(key);
+  if (it != free_[in].end() && ! it->second.empty()) {
+    FieldFace * field_face = it->second.back();
+    it->second.pop_back();
+    ++hits[in];
+    return field_face;
+  } else {
+    ++misses[in];
+    return new FieldFace(rank);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void FieldFacePool::release (FieldFace * field_face)
+{
+  if (field_face == nullptr) return;
+
+  Refresh * refresh = field_face->refresh();
+
+  // only pool faces whose Refresh is either owned or registered
+  // with the Problem (and hence persistent)
+  const bool is_owner = (refresh != nullptr) && field_face->owns_refresh();
+  const bool is_registered = (refresh != nullptr) && (refresh->id() >= 0);
+  const int key = is_owner ? key_owner_ : (refresh ? refresh->id() : -1);
+
+  const int in = cello::index_static();
+  if (is_owner || is_registered) {
+    std::vector<FieldFace *> & free_list = free_[in][key];
+    if ((int)free_list.size() < max_free_) {
+      free_list.push_back(field_face);
+      return;
+    }
+  }
+  delete field_face;
+}
+
+//----------------------------------------------------------------------
+
+void FieldFacePool::clear ()
+{
+  const int in = cello::index_static();
+  for (auto & it : free_[in]) {
+    for (size_t i=0; i<it.second.size(); i++) {
+      delete it.second[i];
+    }
+  }
+  free_[in].clear();
+}
+
+//----------------------------------------------------------------------
+
+int FieldFacePool::num_free ()
+{
+  const int in = cello::index_static();
+  int count = 0;
+  for (const auto & it : free_[in]) {
+    count += it.second.size();
+  }
+  return count;
+}
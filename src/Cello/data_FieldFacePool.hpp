@@ -0,0 +1,73 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldFacePool.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Data] Declaration of the FieldFacePool class
+
+#ifndef DATA_FIELD_FACE_POOL_HPP
+#define DATA_FIELD_FACE_POOL_HPP
+
+class FieldFacePool {
+
+  /// @class    FieldFacePool
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Per-process free lists of FieldFace objects
+  ///
+  /// Refresh phases create and delete one FieldFace per neighbor
+  /// face on the sending side, and one FieldFace plus its own Refresh
+  /// object on the receiving side of each remote message.  This
+  /// class keeps released FieldFace objects in free lists so that
+  /// steady-state refreshes reuse them instead of allocating.
+  ///
+  /// Sending faces are keyed by the id of the (persistent) Refresh
+  /// object they reference, which determines the field list; face,
+  /// child, ghost and refresh-type attributes are always reset by
+  /// the caller.  Receiving faces own a Refresh object whose field
+  /// lists are reloaded in-place by FieldFace::load_data(), and are
+  /// kept in a separate free list.
+
+public: // interface
+
+  /// Number of acquire() calls satisfied from the pool
+  static long hits[CONFIG_NODE_SIZE];
+
+  /// Number of acquire() calls that required a new FieldFace
+  static long misses[CONFIG_NODE_SIZE];
+
+  /// Return a FieldFace for sending faces of the given Refresh object
+  static FieldFace * acquire (int rank, int id_refresh);
+
+  /// Return a FieldFace that owns its Refresh object, for
+  /// deserializing incoming faces
+  static FieldFace * acquire_owner (int rank);
+
+  /// Return the FieldFace to the pool, or delete it if it cannot
+  /// be reused or the corresponding free list is full
+  static void release (FieldFace * field_face);
+
+  /// Delete all pooled FieldFace objects on this process
+  static void clear ();
+
+  /// Return the number of FieldFace objects currently pooled on
+  /// this process
+  static int num_free ();
+
+private: // functions
+
+  static FieldFace * acquire_ (int rank, int key);
+
+private: // attributes
+
+  /// Key used for FieldFace objects that own their Refresh object
+  static const int key_owner_ = -1;
+
+  /// Maximum number of FieldFace objects kept per free list
+  static const int max_free_ = 1024;
+
+  /// Free lists, indexed by refresh id or key_owner_
+  static std::map<int, std::vector<FieldFace *> > free_[CONFIG_NODE_SIZE];
+
+};
+
+#endif /* DATA_FIELD_FACE_POOL_HPP */
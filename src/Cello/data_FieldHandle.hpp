@@ -0,0 +1,89 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_FieldHandle.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Data] Declaration of the FieldHandle class
+
+#ifndef DATA_FIELD_HANDLE_HPP
+#define DATA_FIELD_HANDLE_HPP
+
+class FieldHandle {
+
+  /// @class    FieldHandle
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Field name whose id is looked up only once
+  ///
+  /// Accessing a field by name searches the std::map of field names
+  /// in FieldDescr.  Methods that access the same fields on every
+  /// Block every cycle can instead store handles, typically created in
+  /// the Method constructor, and access fields through them.
+  ///
+  /// Since fields may be defined after a handle is created (e.g. by
+  /// Methods constructed later), the id is looked up on first use and
+  /// then cached; ids of defined fields never change.  The cached id
+  /// refers to this process's FieldDescr, so it is not packed.
+
+public: // interface
+
+  /// Create an empty handle
+  FieldHandle() throw()
+    : name_(),
+      id_(id_unknown_)
+  { }
+
+  /// Create a handle for the named field
+  explicit FieldHandle(const std::string & name) throw()
+    : name_(name),
+      id_(id_unknown_)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    p | name_;
+    if (p.isUnpacking()) id_ = id_unknown_;
+  }
+
+  /// Return the field name
+  const std::string & name() const throw()
+  { return name_; }
+
+  /// Return the field id, or -1 if the field is not defined
+  int id(const FieldDescr * field_descr = cello::field_descr()) const throw()
+  {
+    if (id_ == id_unknown_) id_ = field_descr->field_id(name_);
+    return id_;
+  }
+
+  /// Return whether the field is defined
+  bool exists(const FieldDescr * field_descr = cello::field_descr())
+    const throw()
+  { return id(field_descr) >= 0; }
+
+  /// Return the field's values in the given Field
+  template<class T>
+  T * values(Field & field, int index_history=0) const throw()
+  { return (T *) field.values(id(field.field_descr()),index_history); }
+
+  /// Return a view of the field in the given Field
+  template<class T>
+  CelloView<T, 3> view(Field & field,
+                       ghost_choice choice = ghost_choice::include,
+                       int index_history=0) const throw()
+  { return field.view<T>(id(field.field_descr()),choice,index_history); }
+
+private: // attributes
+
+  /// Value of id_ before the id is looked up
+  static const int id_unknown_ = -2;
+
+  /// Name of the field
+  std::string name_;
+
+  /// Cached field id, or id_unknown_ if not yet looked up
+  mutable int id_;
+
+};
+
+#endif /* DATA_FIELD_HANDLE_HPP */
@@ -17,7 +17,8 @@ void FluxData::allocate
   bool single_array,
   std::vector<int> * cx_list,
   std::vector<int> * cy_list,
-  std::vector<int> * cz_list)
+  std::vector<int> * cz_list,
+  const bool (*neighbor_faces)[2])
 {
   field_list_ = field_list;
   unsigned nf = field_list.size();
@@ -45,8 +46,10 @@ void FluxData::allocate
         const int i = index_(axis,face,i_f);
         block_fluxes_[i] = new FaceFluxes
           (Face(ix,iy,iz,axis,face),index_field,nx,ny,nz,cx,cy,cz);
-        neighbor_fluxes_[i] = new FaceFluxes
-          (Face(ix,iy,iz,axis,face),index_field,nx,ny,nz,cx,cy,cz);
+        if (neighbor_faces == nullptr || neighbor_faces[axis][face]) {
+          neighbor_fluxes_[i] = new FaceFluxes
+            (Face(ix,iy,iz,axis,face),index_field,nx,ny,nz,cx,cy,cz);
+        }
       }
     }
   }
@@ -64,7 +67,7 @@ void FluxData::allocate
         for (int face=0; face<2; face++) {
           const int i = index_(axis,face,i_f);
           const int m = block_fluxes_[i]->get_size();
-          size += 2*m;
+          size += (neighbor_fluxes_[i] != nullptr) ? 2*m : m;
         }
       }
     }
@@ -81,8 +84,10 @@ void FluxData::allocate
           const int m = block_fluxes_[i]->get_size();
           block_fluxes_[i] ->set_storage(&flux_vector_.data()[size]);
           size += m;
-          neighbor_fluxes_[i]->set_storage(&flux_vector_.data()[size]);
-          size += m;
+          if (neighbor_fluxes_[i] != nullptr) {
+            neighbor_fluxes_[i]->set_storage(&flux_vector_.data()[size]);
+            size += m;
+          }
         }
       }
     }
@@ -96,7 +101,9 @@ void FluxData::allocate
         for (int face=0; face<2; face++) {
           int i = index_(axis,face,i_f);
           block_fluxes_[i]->allocate_storage();
-          neighbor_fluxes_[i]->allocate_storage();
+          if (neighbor_fluxes_[i] != nullptr) {
+            neighbor_fluxes_[i]->allocate_storage();
+          }
         }
       }
     }
@@ -252,8 +259,10 @@ char * FluxData::load_data (char * buffer)
           const int flux_size = block_fluxes_[i]->get_size();
           block_fluxes_[i]->set_storage(&flux_data[size]);
           size += flux_size;
-          neighbor_fluxes_[i]->set_storage(&flux_data[size]);
-          size += flux_size;
+          if (neighbor_fluxes_[i] != nullptr) {
+            neighbor_fluxes_[i]->set_storage(&flux_data[size]);
+            size += flux_size;
+          }
         }
       }
     }
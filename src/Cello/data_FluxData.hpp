@@ -85,14 +85,18 @@ public: // interface
   
   /// Allocate all flux arrays for each field in the list of field
   /// indices.  Optional arrays to indicate the centering of fields
-  /// may also be provided
+  /// may also be provided.  If neighbor_faces is given, neighbor
+  /// fluxes are only allocated for faces [axis][face] for which it
+  /// is true, i.e. faces with finer neighbors whose fluxes are used
+  /// for flux correction; neighbor_fluxes() is nullptr for others
   void allocate
   (int nx, int ny, int nz,
    std::vector<int> field_list,
    bool single_array = false,
    std::vector<int> * cx_list=nullptr,
    std::vector<int> * cy_list=nullptr,
-   std::vector<int> * cz_list=nullptr);
+   std::vector<int> * cz_list=nullptr,
+   const bool (*neighbor_faces)[2] = nullptr);
 
   /// Deallocate all face fluxes for all faces and all fields
   void deallocate();
@@ -135,6 +139,9 @@ public: // interface
 
   void sum_neighbor_fluxes (FaceFluxes * fluxes, unsigned index)
   {
+    ASSERT1 ("FluxData::sum_neighbor_fluxes()",
+             "neighbor fluxes [%d] not allocated",index,
+             (neighbor_fluxes_[index] != nullptr));
     int mx,my,mz;
     neighbor_fluxes_[index]->get_size(&mx,&my,&mz);
     cello_float * flux_array = fluxes->flux_array();
@@ -103,6 +103,24 @@ public: // interface
     return pc;
   }
 
+  /// Return the center and radius of the sphere
+  const double * center() const { return center_; }
+  double radius() const { return radius_; }
+
+  /// Whether the sphere intersects the box [lower,upper] along the
+  /// first rank axes
+  bool intersects (const double lower[3], const double upper[3],
+                   int rank = 3) const
+  {
+    double d2 = 0.0;
+    for (int axis=0; axis<rank; axis++) {
+      const double c = center_[axis];
+      const double d = std::max(0.0,std::max(lower[axis]-c,c-upper[axis]));
+      d2 += d*d;
+    }
+    return d2 <= radius_*radius_;
+  }
+
 public: // virtual methods
 
   virtual void draw() { CkPrintf ("ObjectSphere::draw()\n"); }
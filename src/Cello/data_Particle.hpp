@@ -152,7 +152,7 @@ public: // interface
   { particle_descr_->set_velocity (it,ix,iy,iz); }
 
   /// Byte offsets of attributes into block array.  Not including
-  /// initial offset for 16-byte alignment.
+  /// initial offset for PARTICLE_ALIGN-byte alignment.
 
   int attribute_offset(int it, int ia) const
   { return particle_descr_->attribute_offset(it,ia); }
@@ -285,6 +285,16 @@ public: // interface
   { return particle_data_->attribute_array
       (particle_descr_, it,ia,ib); }
 
+  /// Return a CelloView of the given non-interleaved attribute array
+  /// for the given particle type and batch.  Attribute arrays are
+  /// aligned to PARTICLE_ALIGN bytes, so loops over the view may be
+  /// vectorized.
+
+  template <class T>
+  CelloView<T,1> attribute_view (int it,int ia,int ib)
+  { return particle_data_->attribute_view<T>
+      (particle_descr_, it,ia,ib); }
+
   /// Return the number of batches of particles for the given type.
 
   int num_batches (int it) const
@@ -350,6 +360,14 @@ public: // interface
   void compress (int it)
   { particle_data_->compress(particle_descr_,it); }
 
+  /// Reorder all particles of the given type in increasing order of
+  /// key, where key[i] is the key of the i'th particle counting
+  /// consecutively through all batches.  Used to keep particles that
+  /// are close in space close in memory.
+
+  void sort (int it, const int64_t * key)
+  { particle_data_->sort(particle_descr_,it,key); }
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -374,12 +392,36 @@ public: // interface
   float overhead (int it, int ib)
   { return particle_data_->overhead(particle_descr_,it,ib); }
 
-  /// Fill a vector of position coordinates for the given type and batch
-  /// Bounds is used when positions are stored relative to the local block
-  /// (e.g. as integers) and used to convert local to global coordinates
+  /// Fill a vector of position coordinates for the given type and batch.
+  /// Integer positions are relative to the Block, with the Block
+  /// spanning [-1,1)
   bool position (int it, int ib, double * x, double * y, double * z)
   { return particle_data_->position(particle_descr_,it,ib,x,y,z); }
 
+  /// Fill a vector of position coordinates for the given type and
+  /// batch in global coordinates.  Bounds are used to convert integer
+  /// positions, which are stored relative to the Block
+  bool position (int it, int ib, double * x, double * y, double * z,
+                 const double lower[3], const double upper[3])
+  { return particle_data_->position_global
+      (particle_descr_,it,ib,x,y,z,lower,upper); }
+
+  /// Whether positions of the given type are integers relative to the
+  /// Block rather than floating-point global coordinates
+  bool position_is_int (int it) const
+  {
+    const int ia = particle_descr_->attribute_position(it,0);
+    return (ia >= 0) &&
+      cello::type_is_int(particle_descr_->attribute_type(it,ia));
+  }
+
+  /// Express integer positions relative to a neighboring Block; see
+  /// ParticleData::position_update_frame()
+  void position_update_frame (int it, int ib, const int c2[3],
+                              int level_shift)
+  { particle_data_->position_update_frame
+      (particle_descr_,it,ib,c2,level_shift); }
+
   /// Update positions in a batch a given amount.  Only used in refresh for
   /// updating positions in periodic boundary conditions
   void position_update (int it, int ib,
@@ -0,0 +1,107 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     data_ParticleAttrHandle.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Data] Declaration of the ParticleAttrHandle class
+
+#ifndef DATA_PARTICLE_ATTR_HANDLE_HPP
+#define DATA_PARTICLE_ATTR_HANDLE_HPP
+
+class ParticleAttrHandle {
+
+  /// @class    ParticleAttrHandle
+  /// @ingroup  Data
+  /// @brief    [\ref Data] Particle type and attribute names whose
+  ///           indices are looked up only once
+  ///
+  /// The particle analogue of FieldHandle: the type and attribute
+  /// indices are looked up in this process's ParticleDescr on first
+  /// use and then cached, so they are not packed.
+
+public: // interface
+
+  /// Create an empty handle
+  ParticleAttrHandle() throw()
+    : type_name_(),
+      attribute_name_(),
+      it_(index_unknown_),
+      ia_(index_unknown_)
+  { }
+
+  /// Create a handle for the named attribute of the named particle type
+  ParticleAttrHandle(const std::string & type_name,
+                     const std::string & attribute_name) throw()
+    : type_name_(type_name),
+      attribute_name_(attribute_name),
+      it_(index_unknown_),
+      ia_(index_unknown_)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    p | type_name_;
+    p | attribute_name_;
+    if (p.isUnpacking()) it_ = ia_ = index_unknown_;
+  }
+
+  /// Return the particle type name
+  const std::string & type_name() const throw()
+  { return type_name_; }
+
+  /// Return the attribute name
+  const std::string & attribute_name() const throw()
+  { return attribute_name_; }
+
+  /// Return the particle type index, or -1 if the type is not defined
+  int type(const ParticleDescr * particle_descr = cello::particle_descr())
+    const throw()
+  {
+    if (it_ == index_unknown_) {
+      it_ = particle_descr->type_index(type_name_);
+      ia_ = (it_ >= 0) ?
+        particle_descr->attribute_index(it_,attribute_name_) : -1;
+    }
+    return it_;
+  }
+
+  /// Return the attribute index, or -1 if the type or attribute is
+  /// not defined
+  int attribute(const ParticleDescr * particle_descr = cello::particle_descr())
+    const throw()
+  {
+    type(particle_descr);
+    return ia_;
+  }
+
+  /// Return whether the particle type and attribute are defined
+  bool exists(const ParticleDescr * particle_descr = cello::particle_descr())
+    const throw()
+  { return attribute(particle_descr) >= 0; }
+
+  /// Return the attribute array of batch ib in the given Particle
+  char * attribute_array(Particle & particle, int ib) const throw()
+  {
+    const ParticleDescr * particle_descr = particle.particle_descr();
+    return particle.attribute_array
+      (type(particle_descr),attribute(particle_descr),ib);
+  }
+
+private: // attributes
+
+  /// Value of it_ and ia_ before the indices are looked up
+  static const int index_unknown_ = -2;
+
+  /// Names of the particle type and attribute
+  std::string type_name_;
+  std::string attribute_name_;
+
+  /// Cached type and attribute indices, or index_unknown_ if not
+  /// yet looked up
+  mutable int it_;
+  mutable int ia_;
+
+};
+
+#endif /* DATA_PARTICLE_ATTR_HANDLE_HPP */
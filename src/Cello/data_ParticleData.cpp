@@ -37,9 +37,27 @@ bool ParticleData::operator== (const ParticleData & particle_data) throw ()
 
 void ParticleData::pup (PUP::er &p)
 {
-  p | attribute_array_;
+  MemoryGroup memory_group (memory_group_particles);
+
+  // bulk copy of each batch, rather than per-element pup()
+  int nt = attribute_array_.size();
+  p | nt;
+  if (p.isUnpacking()) attribute_array_.resize(nt);
+  for (int it=0; it<nt; it++) {
+    int nb = attribute_array_[it].size();
+    p | nb;
+    if (p.isUnpacking()) attribute_array_[it].resize(nb);
+    for (int ib=0; ib<nb; ib++) {
+      batch_array_type & array = attribute_array_[it][ib];
+      int n = array.size();
+      p | n;
+      if (p.isUnpacking()) array.resize(n);
+      if (n > 0) PUParray(p,array.data(),n);
+    }
+  }
   p | attribute_align_;
   p | particle_count_;
+  if (p.isUnpacking()) realign_();
 }
 
 //----------------------------------------------------------------------
@@ -519,69 +537,145 @@ void ParticleData::compress (ParticleDescr * particle_descr, int it)
 {
   const int nb = num_batches(it);
   const int mb = particle_descr->batch_size();
-  const int na = particle_descr->num_attributes(it);
 
-  const bool interleaved = particle_descr->interleaved(it);
+  // move particles forward into the free slots left by deletions,
+  // preserving their order, in runs of consecutive particles
+
+  int ib_dst = 0; // destination batch and particle indices
+  int ip_dst = 0;
+  int ib_sized = -1; // last destination batch sized to hold mb particles
 
-  // find first batch with space in it
+  for (int ib_src=0; ib_src<nb; ib_src++) {
 
-  int ib_src, ip_src; // source batch and particle indices
-  int ib_dst, ip_dst; // destination batch and particle indices
+    const int np_src = num_particles(particle_descr,it,ib_src);
+    int ip_src = 0;
 
-  int np_dst; // number of particles in ib_dst batch
-  int np_src; // number of particles in ib_src batch
+    while (ip_src < np_src) {
 
-  // find destination: first empty spot
+      int n = std::min(np_src - ip_src, mb - ip_dst);
+
+      if (ib_src != ib_dst || ip_src != ip_dst) {
+        if (ib_sized < ib_dst) {
+          // count is reset below
+          resize_attribute_array_ (particle_descr,it,ib_dst,mb);
+          ib_sized = ib_dst;
+        }
+        copy_particles_(particle_descr,it,ib_src,ip_src,ib_dst,ip_dst,n);
+      } else {
+        // the rest of this batch is already in place
+        n = np_src - ip_src;
+      }
 
-  ib_dst=0;
-  np_dst=(ib_dst<nb) ? num_particles(particle_descr,it,ib_dst) : 0;
-  while (ib_dst<nb && np_dst == mb) {
-    ib_dst++;
-  } // assert ib_dst == nb || np_dst < mb
-  ip_dst = np_dst;
+      ip_src += n;
+      ip_dst += n;
+      if (ip_dst == mb) {
+        ib_dst++;
+        ip_dst = 0;
+      }
+    }
+  }
 
-  // first source: next non-empty spot
-  ib_src = ib_dst + 1;
-  ip_src = 0;
-  np_src = num_particles(particle_descr,it,ib_src);
+  // set particle counts and drop the batches emptied
 
-  resize_attribute_array_ (particle_descr,it,ib_dst,mb);
-  np_dst = mb;
+  for (int ib=0; ib<ib_dst; ib++) {
+    resize_attribute_array_ (particle_descr,it,ib,mb);
+  }
+  if (ip_dst > 0) {
+    resize_attribute_array_ (particle_descr,it,ib_dst,ip_dst);
+  }
 
-  int mp = particle_descr->particle_bytes(it);
+  const int nb_new = ib_dst + ((ip_dst > 0) ? 1 : 0);
+  if (nb_new < nb) {
+    attribute_array_[it].resize(nb_new);
+    attribute_align_[it].resize(nb_new);
+    particle_count_ [it].resize(nb_new);
+  }
+}
 
-  while (ib_src < nb && ip_src < np_src) {
+//----------------------------------------------------------------------
+
+void ParticleData::copy_particles_
+(ParticleDescr * particle_descr, int it,
+ int ib_src, int ip_src, int ib_dst, int ip_dst, int n)
+{
+  const int na = particle_descr->num_attributes(it);
+  const bool interleaved = particle_descr->interleaved(it);
+  const int mp = particle_descr->particle_bytes(it);
 
+  if (interleaved) {
+    // particles are contiguous: copy all attributes at once
+    char * a_src = &attribute_array_[it][ib_src][0]
+      + attribute_align_[it][ib_src];
+    char * a_dst = &attribute_array_[it][ib_dst][0]
+      + attribute_align_[it][ib_dst];
+    memmove (a_dst + mp*ip_dst, a_src + mp*ip_src, size_t(mp)*n);
+  } else {
     for (int ia=0; ia<na; ia++) {
-      if (!interleaved) {
-	mp = particle_descr->attribute_bytes(it,ia);
-      }
-      int ny = particle_descr->attribute_bytes(it,ia);
+      const int ny = particle_descr->attribute_bytes(it,ia);
       char * a_src = attribute_array(particle_descr,it,ia,ib_src);
       char * a_dst = attribute_array(particle_descr,it,ia,ib_dst);
-      for (int iy=0; iy<ny; iy++) {
-	a_dst [iy + mp*ip_dst] = a_src [iy + mp*ip_src];
-      }
+      memmove (a_dst + ny*ip_dst, a_src + ny*ip_src, size_t(ny)*n);
     }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::sort
+(ParticleDescr * particle_descr, int it, const int64_t * key)
+{
+  const int nb = num_batches(it);
+  const int np = num_particles(particle_descr,it);
+
+  if (np <= 1) return;
 
-    ip_dst++;
-    if (ip_dst>=np_dst) {
-      ip_dst = 0;
-      ib_dst++;
-      np_dst = mb;
-      if (ib_dst < nb) resize_attribute_array_ (particle_descr,it,ib_dst,mb);
+  // batch and particle index of the i'th particle
+
+  std::vector<int> ib_of(np), ip_of(np);
+  for (int ib=0, i=0; ib<nb; ib++) {
+    const int npb = num_particles(particle_descr,it,ib);
+    for (int ip=0; ip<npb; ip++,i++) {
+      ib_of[i] = ib;
+      ip_of[i] = ip;
     }
+  }
 
-    ip_src++;
-    if (ip_src>=np_src) {
-      ip_src = 0;
-      ib_src++;
-      if (ib_src < nb) np_src = num_particles(particle_descr,it,ib_src);
+  // permutation: i'th particle after sorting is order[i] before
+
+  std::vector<int> order(np);
+  for (int i=0; i<np; i++) order[i] = i;
+  std::stable_sort (order.begin(),order.end(),
+                    [key] (int i1, int i2) { return key[i1] < key[i2]; });
+
+  // gather each attribute (or whole particle if interleaved) into a
+  // temporary array in sorted order, and copy it back in place
+
+  const bool interleaved = particle_descr->interleaved(it);
+  const int na = interleaved ? 1 : particle_descr->num_attributes(it);
+  std::vector<char> temp;
+
+  for (int ia=0; ia<na; ia++) {
+
+    const int mp = interleaved ?
+      particle_descr->particle_bytes(it) :
+      particle_descr->attribute_bytes(it,ia);
+
+    temp.resize(size_t(np)*mp);
+
+    for (int i=0; i<np; i++) {
+      const int j = order[i];
+      const char * a_src =
+        attribute_array(particle_descr,it,ia,ib_of[j]) + mp*ip_of[j];
+      std::copy_n (a_src,mp,temp.data() + size_t(mp)*i);
     }
 
+    for (int ib=0, i=0; ib<nb; ib++) {
+      const int npb = num_particles(particle_descr,it,ib);
+      char * a_dst = attribute_array(particle_descr,it,ia,ib);
+      std::copy_n (temp.data() + size_t(mp)*i, size_t(mp)*npb, a_dst);
+      i += npb;
+    }
   }
-
-  // deallocate empty batches?
 }
 
 
@@ -758,6 +852,96 @@ void ParticleData::position_update
 
 //----------------------------------------------------------------------
 
+bool ParticleData::position_global
+(
+ ParticleDescr * particle_descr,
+ int it, int ib,
+ double * x, double * y, double * z,
+ const double lower[3], const double upper[3])
+{
+  const bool l_return = position (particle_descr,it,ib,x,y,z);
+
+  const int np = num_particles(particle_descr,it,ib);
+  double * coord[3] = {x,y,z};
+  for (int axis=0; axis<3; axis++) {
+    const int ia = particle_descr->attribute_position(it,axis);
+    if (coord[axis] && ia != -1 &&
+        cello::type_is_int(particle_descr->attribute_type(it,ia))) {
+      // Block spans [-1,1) in integer coordinates
+      const double c = 0.5*(lower[axis] + upper[axis]);
+      const double h = 0.5*(upper[axis] - lower[axis]);
+      double * a = coord[axis];
+      for (int ip=0; ip<np; ip++) a[ip] = c + h*a[ip];
+    }
+  }
+  return l_return;
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::position_update_frame
+(ParticleDescr * particle_descr, int it, int ib,
+ const int c2[3], int level_shift)
+{
+  for (int axis=0; axis<3; axis++) {
+    const int ia = particle_descr->attribute_position(it,axis);
+    if (ia == -1) continue;
+    const int type = particle_descr->attribute_type(it,ia);
+    if (! cello::type_is_int(type)) continue;
+    if (c2[axis] == 0 && level_shift == 0) continue;
+    if (type == type_int8) {
+      update_frame_int_<int8_t>
+        (particle_descr,it,ib,ia,c2[axis],level_shift,PMAX_8);
+    } else if (type == type_int16) {
+      update_frame_int_<int16_t>
+        (particle_descr,it,ib,ia,c2[axis],level_shift,PMAX_16);
+    } else if (type == type_int32) {
+      update_frame_int_<int32_t>
+        (particle_descr,it,ib,ia,c2[axis],level_shift,PMAX_32);
+    } else if (type == type_int64) {
+      update_frame_int_<int64_t>
+        (particle_descr,it,ib,ia,c2[axis],level_shift,PMAX_64);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T>
+void ParticleData::update_frame_int_
+(ParticleDescr * particle_descr,
+ int it, int ib, int ia, int c2, int level_shift, int64_t pmax)
+{
+  // PMAX is one half Block width, so the new center is c2*(PMAX/2).
+  // Moving to a coarser Block halves the resolution, rounding down;
+  // moving to a finer Block is exact.  Unsigned arithmetic wraps, so
+  // the result is exact whenever it is representable, even if
+  // intermediate values are not (e.g. for int64_t positions)
+
+  ASSERT1 ("ParticleData::update_frame_int_",
+           "Coarse Block center %d/2 must be a whole number",
+           c2, (level_shift >= 0 || c2 % 2 == 0));
+
+  const int dx = particle_descr->stride(it,ia);
+  T * array = (T *) attribute_array(particle_descr,it,ia,ib);
+  const int np = num_particles(particle_descr,it,ib);
+  const uint64_t half = pmax/2;
+  for (int ip=0; ip<np; ip++) {
+    const int64_t v = int64_t(array[ip*dx]);
+    uint64_t u;
+    if (level_shift > 0) {
+      u = 2*(uint64_t(v) - uint64_t(int64_t(c2))*half);
+    } else if (level_shift < 0) {
+      u = uint64_t(v >> 1) - uint64_t(int64_t(c2/2))*half;
+    } else {
+      u = uint64_t(v) - uint64_t(int64_t(c2))*half;
+    }
+    array[ip*dx] = T(int64_t(u));
+  }
+}
+
+//----------------------------------------------------------------------
+
 void ParticleData::copy_attribute_float_
 (ParticleDescr * particle_descr,
  int type, int it, int ib, int ia, double * coord)
@@ -783,6 +967,23 @@ void ParticleData::copy_attribute_float_
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// Add da to the np values of array with stride dx in precision P,
+  /// using a unit-stride loop when possible so that it vectorizes
+  template <class T, class P>
+  void shift_array_ (T * array, int np, int dx, P da)
+  {
+    if (dx == 1) {
+      for (int ip=0; ip<np; ip++) array[ip] = T(P(array[ip]) + da);
+    } else {
+      for (int ip=0; ip<np; ip++) array[ip*dx] = T(P(array[ip*dx]) + da);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void ParticleData::update_attribute_float_
 (ParticleDescr * particle_descr,
  int type, int it, int ib, int ia, long double da)
@@ -790,15 +991,15 @@ void ParticleData::update_attribute_float_
   const int dx = particle_descr->stride(it,ia);
   char * array = attribute_array(particle_descr,it,ia,ib);
   const int np = num_particles(particle_descr,it,ib);
+  // float and double attributes are shifted in double precision
+  // rather than long double, which on x86 is scalar x87 code; only
+  // quadruple attributes need long double
   if (type == type_float) {
-    float * array_f = (float *) array;
-    for (int ip=0; ip<np; ip++) array_f[ip*dx] += da;
+    shift_array_<float,double> ((float *) array, np, dx, double(da));
   } else if (type == type_double) {
-    double * array_d = (double *) array;
-    for (int ip=0; ip<np; ip++) array_d[ip*dx] += da;
+    shift_array_<double,double> ((double *) array, np, dx, double(da));
   } else if (type == type_quadruple) {
-    long double * array_q = (long double *) array;
-    for (int ip=0; ip<np; ip++) array_q[ip*dx] += da;
+    shift_array_<long double,long double> ((long double *) array, np, dx, da);
   } else {
     ERROR1("ParticleData::copy_attribute_float_()",
 	   "Unknown particle attribute type %d",
@@ -871,36 +1072,30 @@ void ParticleData::update_position_int_
 
 int ParticleData::data_size (ParticleDescr * particle_descr) const
 {
+  // only the attributes of particles in use are sent: not batch
+  // slack, alignment padding, or unused batch_size() capacity
 
   int size = 0;
   const int nt = particle_descr->num_types();
 
-  // array lengths
+  // number of types
 
   size += sizeof(int);
 
   for (int it=0; it<nt; it++) {
 
-    // array[it] lengths
-
-    size += sizeof(int);
-
     const int nb = num_batches(it);
 
-    // attribute_align_[it] values
-    size += nb*sizeof(char);
+    // number of batches, and particle_count_[it] values
 
-    // particle_count_[it] values
+    size += sizeof(int);
     size += nb*sizeof(int);
 
-    for (int ib=0; ib<nb; ib++) {
-
-      // array[it][ib] length
-      size += sizeof(int);
+    // packed particle attributes
 
-      // attribute_array_[it][ib] values
-      const int mp = attribute_array_[it][ib].size();
-      size += mp * sizeof(char);
+    const int mp = particle_descr->particle_bytes(it);
+    for (int ib=0; ib<nb; ib++) {
+      size += particle_count_[it][ib] * mp;
     }
   }
   return size;
@@ -930,45 +1125,42 @@ char * ParticleData::save_data (ParticleDescr * particle_descr,
 
   for (int it=0; it<nt; it++) {
 
-    // ...store number of batches for the type
+    // ...store number of batches for the type, and particles per batch
 
-    int nb = (*pi++) = num_batches(it);
+    const int nb = (*pi++) = num_batches(it);
 
-    for (int ib=0; ib<nb; ib++) {
-
-      // ...store particle attribute array lengths
-
-      (*pi++) = attribute_array_[it][ib].size();
-
-    }
-  }
-
-  // store int particle_count_[it][ib]
-
-  for (int it=0; it<nt; it++) {
-    const int nb = particle_count_[it].size();
     for (int ib=0; ib<nb; ib++) {
       (*pi++) = particle_count_[it][ib];
     }
   }
 
-  // store char attribute_align_[it][ib] array
-
-  for (int it=0; it<nt; it++) {
-    const int nb = attribute_align_[it].size();
-    for (int ib=0; ib<nb; ib++) {
-      (*pc++) = attribute_align_[it][ib];
-    }
-  }
+  //--------------------
+  // Store particle attributes
+  //--------------------
 
-  // store char attribute_array_[it][ib][k]
+  // ...interleaved particles are copied whole; otherwise each
+  // attribute array is copied contiguously
 
   for (int it=0; it<nt; it++) {
-    const int nb = attribute_array_[it].size();
+    const int nb = num_batches(it);
+    const int na = particle_descr->num_attributes(it);
+    const int mp = particle_descr->particle_bytes(it);
+    const bool interleaved = particle_descr->interleaved(it);
     for (int ib=0; ib<nb; ib++) {
-      const int n = attribute_array_[it][ib].size();
-      for (int k=0; k<n; k++) {
-	(*pc++) = attribute_array_[it][ib][k];
+      const int np = particle_count_[it][ib];
+      if (np == 0) continue;
+      const char * array =
+        attribute_array_[it][ib].data() + attribute_align_[it][ib];
+      if (interleaved) {
+        memcpy (pc, array, size_t(np)*mp);
+        pc += size_t(np)*mp;
+      } else {
+        for (int ia=0; ia<na; ia++) {
+          const int ny = particle_descr->attribute_bytes(it,ia);
+          memcpy (pc, array + particle_descr->attribute_offset(it,ia),
+                  size_t(np)*ny);
+          pc += size_t(np)*ny;
+        }
       }
     }
   }
@@ -988,6 +1180,8 @@ char * ParticleData::load_data (ParticleDescr * particle_descr,
 {
   // NOTE: integers stored first, then char's, to avoid alignment issues
 
+  MemoryGroup memory_group (memory_group_particles);
+
   union {
     int  * pi;
     char * pc;
@@ -996,7 +1190,7 @@ char * ParticleData::load_data (ParticleDescr * particle_descr,
   pc = (char *) buffer;
 
   //-----------------------------------------
-  // Load array sizes and pre-allocate arrays
+  // Load array sizes and allocate arrays
   //-----------------------------------------
 
   // ...load number of types
@@ -1017,21 +1211,20 @@ char * ParticleData::load_data (ParticleDescr * particle_descr,
 
     // ...load number of batches for the type
 
-    int nb = (*pi++);
-
-    // ... allocate arrays[it]
+    const int nb = (*pi++);
 
     ASSERT1("ParticleData::load_data",
 	    "Trying to allocate negative particle batches: nb = %d",
 	    nb, nb >= 0);
 
+    attribute_array_[it].clear();
     attribute_array_[it].resize(nb);
     attribute_align_[it].resize(nb);
     particle_count_[it].resize(nb);
 
-    for (int ib=0; ib<nb; ib++) {
+    // ...load particles per batch and allocate the batch
 
-      // ...load particle attribute array lengths
+    for (int ib=0; ib<nb; ib++) {
 
       const int np = (*pi++);
 
@@ -1039,37 +1232,34 @@ char * ParticleData::load_data (ParticleDescr * particle_descr,
 	      "Trying to allocate negative particles: np = %d",
 	      np, np >= 0);
 
-      attribute_array_[it][ib].resize(np);
-
-    }
-  }
-
-  // load int particle_count_[it][ib]
-
-  for (int it=0; it<nt; it++) {
-    const int nb = particle_count_[it].size();
-    for (int ib=0; ib<nb; ib++) {
-      particle_count_[it][ib] = (*pi++);
-    }
-  }
-
-  // load char attribute_align_[it][ib] array
-
-  for (int it=0; it<nt; it++) {
-    const int nb = attribute_align_[it].size();
-    for (int ib=0; ib<nb; ib++) {
-      attribute_align_[it][ib] = (*pc++);
+      resize_attribute_array_(particle_descr,it,ib,np);
     }
   }
 
-  // load char attribute_array_[it][ib][k]
+  //-----------------------------------------
+  // Load particle attributes
+  //-----------------------------------------
 
   for (int it=0; it<nt; it++) {
-    const int nb = attribute_array_[it].size();
+    const int nb = num_batches(it);
+    const int na = particle_descr->num_attributes(it);
+    const int mp = particle_descr->particle_bytes(it);
+    const bool interleaved = particle_descr->interleaved(it);
     for (int ib=0; ib<nb; ib++) {
-      const int n = attribute_array_[it][ib].size();
-      for (int k=0; k<n; k++) {
-	attribute_array_[it][ib][k] = (*pc++);
+      const int np = particle_count_[it][ib];
+      if (np == 0) continue;
+      char * array =
+        attribute_array_[it][ib].data() + attribute_align_[it][ib];
+      if (interleaved) {
+        memcpy (array, pc, size_t(np)*mp);
+        pc += size_t(np)*mp;
+      } else {
+        for (int ia=0; ia<na; ia++) {
+          const int ny = particle_descr->attribute_bytes(it,ia);
+          memcpy (array + particle_descr->attribute_offset(it,ia), pc,
+                  size_t(np)*ny);
+          pc += size_t(np)*ny;
+        }
       }
     }
   }
@@ -1166,6 +1356,8 @@ void ParticleData::write_ifrite (ParticleDescr * particle_descr,
 void ParticleData::resize_attribute_array_
 (ParticleDescr * particle_descr,int it, int ib, int np)
 {
+  MemoryGroup memory_group (memory_group_particles);
+
   // store number of particles allocated
   particle_count_[it][ib] = np;
 
@@ -1175,7 +1367,9 @@ void ParticleData::resize_attribute_array_
     np = particle_descr->batch_size();
   }
 
-  long unsigned new_size = mp*(np) + (PARTICLE_ALIGN - 1) ;
+  const long unsigned bytes = particle_descr->interleaved(it) ?
+    mp*np : particle_descr->batch_bytes(it);
+  long unsigned new_size = bytes + (PARTICLE_ALIGN - 1) ;
 
   if (attribute_array_[it][ib].size() != new_size) {
 
@@ -1183,11 +1377,53 @@ void ParticleData::resize_attribute_array_
 	    "Trying to allocate negative particles: new_size = %ld",
 	    new_size, new_size >= 0);
 
+    const bool is_new = attribute_array_[it][ib].empty();
+    if (is_new) {
+      // reserve a full batch so that particles appended later fill
+      // the slack without reallocating and copying the batch
+      attribute_array_[it][ib].reserve
+        (particle_descr->batch_bytes(it) + (PARTICLE_ALIGN - 1));
+    }
     attribute_array_[it][ib].resize(new_size);
-    char * array = &attribute_array_[it][ib][0];
-    uintptr_t iarray = (uintptr_t) array;
-    int defect = (iarray % PARTICLE_ALIGN);
-    attribute_align_[it][ib] = (defect == 0) ? 0 : PARTICLE_ALIGN-defect;
+    if (is_new) {
+      char * array = &attribute_array_[it][ib][0];
+      uintptr_t iarray = (uintptr_t) array;
+      int defect = (iarray % PARTICLE_ALIGN);
+      attribute_align_[it][ib] = (defect == 0) ? 0 : PARTICLE_ALIGN-defect;
+    } else {
+      // existing particles were copied at the old alignment offset
+      realign_(it,ib);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::realign_ (int it, int ib)
+{
+  batch_array_type & array = attribute_array_[it][ib];
+  if (array.size() < PARTICLE_ALIGN - 1) return;
+
+  uintptr_t iarray = (uintptr_t) array.data();
+  int defect = (iarray % PARTICLE_ALIGN);
+  const int align = (defect == 0) ? 0 : PARTICLE_ALIGN-defect;
+  const int align_old = attribute_align_[it][ib];
+
+  if (align != align_old) {
+    const size_t bytes = array.size() - (PARTICLE_ALIGN - 1);
+    memmove (array.data() + align, array.data() + align_old, bytes);
+    attribute_align_[it][ib] = align;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void ParticleData::realign_ ()
+{
+  for (size_t it=0; it<attribute_array_.size(); it++) {
+    for (size_t ib=0; ib<attribute_array_[it].size(); ib++) {
+      realign_(it,ib);
+    }
   }
 }
 
@@ -18,9 +18,27 @@ class ParticleData {
 
 public: // interface
 
+  /// Storage of one batch of particle attributes
+  typedef std::vector<char, PageAllocator<char,memory_group_particles> >
+  batch_array_type;
+
   static int64_t counter[CONFIG_NODE_SIZE];
   static int64_t id_counter[CONFIG_NODE_SIZE];
 
+  /// Reserve n consecutive values of this process's id_counter for
+  /// particles created together, returning the first
+  static int64_t reserve_ids (int n)
+  {
+    int64_t & count = id_counter[cello::index_static()];
+    const int64_t first = count;
+    count += n;
+    return first;
+  }
+
+  /// Particle id, unique over processes, for a reserved id_counter value
+  static int64_t id (int64_t count)
+  { return CkMyPe() + count * CkNumPes(); }
+
   /// Constructor
   ParticleData();
 
@@ -38,6 +56,7 @@ public: // interface
     attribute_array_ = particle_data.attribute_array_;
     attribute_align_ = particle_data.attribute_align_;
     particle_count_  = particle_data.particle_count_;
+    realign_();
 
     ParticleDescr * particle_descr = cello::particle_descr();
     id_counter[cello::index_static()] = num_particles(particle_descr);
@@ -54,6 +73,26 @@ public: // interface
       ((ParticleData*)this) -> attribute_array (pd,it,ia,ib);
   }
 
+  /// Return a CelloView of the given attribute in the given batch.
+  /// Requires the attribute type to match T and attributes not to be
+  /// interleaved; the view is aligned to PARTICLE_ALIGN bytes.
+  template <class T>
+  CelloView<T,1> attribute_view (ParticleDescr * pd, int it, int ia, int ib)
+  {
+    ASSERT2("ParticleData::attribute_view()",
+            "Particle type %d attribute %d must not be interleaved",
+            it,ia, (! pd->interleaved(it)));
+    constexpr int type = cello::get_type_enum<T,true>();
+    ASSERT3("ParticleData::attribute_view()",
+            "Particle type %d attribute %d does not have type %s",
+            it,ia,cello::type_name[type],
+            ((type == type_unknown) ?
+             (pd->attribute_bytes(it,ia) == int(sizeof(T))) :
+             (pd->attribute_type(it,ia) == type)));
+    T * array = (T *) attribute_array (pd,it,ia,ib);
+    return CelloView<T,1> (array, num_particles(pd,it,ib));
+  }
+
   /// Return the number of batches of particles for the given type.
 
   int num_batches (int it) const;
@@ -100,12 +139,21 @@ public: // interface
   int gather (ParticleDescr *, int it, int n, ParticleData * particle_array[]);
 
   /// Compress particles in batches so that all batches except
-  /// possibly the last have batch_size() particles.  May be performed
-  /// periodically to recover unused memory from multiple insert/deletes
+  /// possibly the last have batch_size() particles, preserving their
+  /// order, and remove the batches emptied.  Performed once per type
+  /// after particles leave a Block, so that free slots are reused
 
   void compress (ParticleDescr *);
   void compress (ParticleDescr *, int it);
 
+  /// Reorder all particles of the given type in increasing order of
+  /// key, where key[i] is the key of the i'th particle counting
+  /// consecutively through all batches.  The number of particles in
+  /// each batch is unchanged, and the relative order of particles
+  /// with equal keys is preserved.
+
+  void sort (ParticleDescr *, int it, const int64_t * key);
+
   /// Return the storage "efficiency" for particles of the given type
   /// and in the given batch, or average if batch or type not specified.
   /// 1.0 means no wasted storage, 0.5 means twice as much storage
@@ -153,6 +201,21 @@ public: // interface
   (ParticleDescr * particle_descr,int it, int ib,
    long double dx, long double dy, long double dz);
 
+  /// Fill position coordinates in global coordinates, converting any
+  /// integer positions using the lower and upper extents of the Block
+  bool position_global (ParticleDescr * particle_descr,
+                        int it, int ib,
+                        double * x, double * y, double * z,
+                        const double lower[3], const double upper[3]);
+
+  /// Express integer positions in a batch relative to a different
+  /// Block: one whose center is at c2[axis]/2 in this Block's
+  /// [-1,1) coordinates, and whose level is level_shift levels finer
+  /// (-1, 0, or 1).  Floating-point positions are unchanged.
+  void position_update_frame
+  (ParticleDescr * particle_descr, int it, int ib,
+   const int c2[3], int level_shift);
+
   /// Fill a vector of velocity coordinates for the given type and batch
   bool velocity (ParticleDescr * particle_descr,
 		 int it, int ib,
@@ -163,6 +226,16 @@ public: // interface
   /// Return the number of bytes required to serialize the data object
   int data_size (ParticleDescr * particle_descr) const;
 
+  /// Return the bytes allocated for particle attribute arrays
+  int64_t bytes_allocated () const throw()
+  {
+    int64_t bytes = 0;
+    for (const auto & type : attribute_array_) {
+      for (const auto & batch : type) bytes += batch.size();
+    }
+    return bytes;
+  }
+
   /// Serialize the object into the provided empty memory buffer.
   /// Returns the next open position in the buffer to simplify
   /// serializing multiple objects in one buffer.
@@ -184,10 +257,22 @@ private: /// functions
 
   /// long long assign_id_ ()
 
-  /// Allocate attribute_array_ block, aligned at 16 byte boundary
-  /// with updated attribute_align_
+  /// Allocate attribute_array_ block, aligned at PARTICLE_ALIGN byte
+  /// boundary with updated attribute_align_
   void resize_attribute_array_ (ParticleDescr *, int it, int ib, int np);
 
+  /// Update attribute_align_ and move the attribute data if the
+  /// attribute_array_ block has been reallocated, e.g. after copying
+  /// or unpacking
+  void realign_ (int it, int ib);
+  void realign_ ();
+
+  /// Copy n consecutive particles at (ib_src,ip_src) to (ib_dst,ip_dst),
+  /// which must be allocated; the ranges may overlap if ib_src==ib_dst
+  void copy_particles_ (ParticleDescr *, int it,
+                        int ib_src, int ip_src,
+                        int ib_dst, int ip_dst, int n);
+
   void check_arrays_ (ParticleDescr * particle_descr,
 		      std::string file, int line) const;
 
@@ -199,7 +284,8 @@ private: /// functions
    int type, int it, int ib, int ia, double * coord);
 
   /// Increment the given floating point attribute of given float type
-  /// (float, double, quad, etc.) by the given double long constant value.
+  /// (float, double, quad, etc.) by the given double long constant
+  /// value, computed in long double only for quad attributes
   void update_attribute_float_
   (ParticleDescr * particle_descr,
    int type, int it, int ib, int ia, long double da);
@@ -219,6 +305,12 @@ private: /// functions
   (ParticleDescr * particle_descr,
    int type, int it, int ib, int ia, int64_t da);
 
+  /// Change of frame version of copy_position_int_()
+  template <class T>
+  void update_frame_int_
+  (ParticleDescr * particle_descr,
+   int it, int ib, int ia, int c2, int level_shift, int64_t pmax);
+
   void write_ifrite (ParticleDescr * particle_descr,
 		     int it, std::string file_name,
 		     double xm, double ym, double zm,
@@ -227,9 +319,11 @@ private: /// functions
 private: /// attributes
 
   /// Array of blocks of particle attributes array_[it][ib][iap];
-  std::vector< std::vector< std::vector<char> > > attribute_array_;
+  /// large batches are mapped from fresh pages local to the NUMA
+  /// domain of the owning process
+  std::vector< std::vector< batch_array_type > > attribute_array_;
 
-  /// Alignment adjustment to correct for 16-byte alignment of
+  /// Alignment adjustment to correct for PARTICLE_ALIGN-byte alignment of
   /// first attribute in each batch
 
   std::vector< std::vector< char > > attribute_align_;
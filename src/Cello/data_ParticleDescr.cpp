@@ -189,12 +189,15 @@ int ParticleDescr::new_attribute (int it, std::string name, int type)
   attribute_type_[it]. push_back(type);
   attribute_bytes_[it].push_back(attribute_bytes);
 
-  // compute offset of next attribute
+  // compute offset of next attribute: non-interleaved attribute
+  // arrays start on PARTICLE_ALIGN byte boundaries
 
   const int increment = attribute_interleaved_[it] ? 1 : batch_size_;
 
-  attribute_offset_[it].push_back
-    (attribute_offset_[it][na] + increment * attribute_bytes_[it][na]);
+  int offset = attribute_offset_[it][na] + increment * attribute_bytes_[it][na];
+  if (! attribute_interleaved_[it]) offset = align_(offset,PARTICLE_ALIGN);
+
+  attribute_offset_[it].push_back (offset);
 
   // update particle bytes
   if (attribute_interleaved_[it]) {
@@ -560,6 +563,19 @@ int ParticleDescr::attribute_offset (int it, int ia) const
   return attribute_offset_[it][ia]; 
 }
 
+//----------------------------------------------------------------------
+
+int ParticleDescr::batch_bytes (int it) const
+{
+  ASSERT1("ParticleDescr::batch_bytes",
+	  "Trying to access unknown particle type %d",
+	  it, (0 <= it && it < num_types()));
+
+  return attribute_interleaved_[it] ?
+    particle_bytes_[it] * batch_size_ :
+    attribute_offset_[it][num_attributes(it)];
+}
+
 //======================================================================
 
 //----------------------------------------------------------------------
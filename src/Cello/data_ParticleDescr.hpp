@@ -110,9 +110,15 @@ public: // interface
   std::string attribute_name (int it, int ia) const;
 
   /// Byte offsets of attributes into block array.  Not including
-  /// initial offset for 16-byte alignment.
+  /// initial offset for PARTICLE_ALIGN-byte alignment.  If not
+  /// interleaved, each attribute array begins on a PARTICLE_ALIGN
+  /// byte boundary.
   int attribute_offset(int it, int ia) const;
 
+  /// Return the number of bytes used to store a full batch of
+  /// particles, including padding between attribute arrays
+  int batch_bytes (int it) const;
+
   /// Define which attributes represent position coordinates (-1 if not defined)
   void set_position (int it, int ix, int iy=-1, int iz=-1);
 
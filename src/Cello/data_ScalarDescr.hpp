@@ -24,6 +24,10 @@ public: // interface
     p | name_;
     p | offset_;
     p | length_;
+    if (p.isUnpacking()) {
+      index_.clear();
+      for (size_t i=0; i<name_.size(); i++) index_[name_[i]] = i;
+    }
   }
 
   /// Reserve space for a new scalar
@@ -35,17 +39,15 @@ public: // interface
       0 : offset_[index-1]+length_[index-1];
     offset_.push_back(offset);
     length_.push_back(n);
+    index_[name] = index;
     return index;
   }
 
   /// Return the *last* index of the named scalar
   int index (std::string name) const
   {
-    int i=name_.size();
-    while (--i>=0) {
-      if (name == name_[i]) break;
-    }
-    return i;
+    auto it = index_.find(name);
+    return (it == index_.end()) ? -1 : it->second;
   }
 
   /// Return the name of the given scalar
@@ -79,6 +81,9 @@ private: // attributes
 
   /// Vector of scalar data lengths
   std::vector <int> length_;
+
+  /// Last index of each scalar name (not packed)
+  std::map <std::string,int> index_;
 };
 
 #endif /* DATA_SCALARDESCR_HPP */
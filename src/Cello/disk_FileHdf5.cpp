@@ -6,6 +6,7 @@
 /// @brief     Implementation of the FileHdf5 class
 
 #include <hdf5.h>
+#include <sstream>
 
 #include "cello.hpp"
 #include "disk.hpp"
@@ -15,6 +16,9 @@
 #define MAX_DATA_RANK 4
 #define MAX_ATTR_RANK 4
 
+/// Minimum chunk size in values of datasets written by data_append()
+#define FILE_APPEND_CHUNK 4096
+
 //----------------------------------------------------------------------
 
 std::map<const std::string,FileHdf5 *> FileHdf5::file_list;
@@ -38,7 +42,11 @@ FileHdf5::FileHdf5 (std::string path, std::string name) throw()
     data_rank_(0),
     data_prop_(H5P_DEFAULT),
     is_data_open_(false),
-    compress_level_(0)
+    compress_level_(0),
+    alignment_(0),
+    buffer_size_(0),
+    chunk_(),
+    filters_()
 {
   data_prop_  = H5Pcreate (H5P_DATASET_CREATE);
 #ifdef TRACE_DISK  
@@ -111,10 +119,14 @@ void FileHdf5::file_create () throw()
 
   std::string file_name = path_ + "/" + name_;
 
+  hid_t file_prop = file_access_prop_();
+
   file_id_ = H5Fcreate(file_name.c_str(),
 		       H5F_ACC_TRUNC,
 		       H5P_DEFAULT,
-		       H5P_DEFAULT);
+		       file_prop);
+
+  if (file_prop != H5P_DEFAULT) H5Pclose (file_prop);
 #ifdef TRACE_DISK  
   CkPrintf ("%d %Ld :%d TRACE_DISK H5Fcreate(%d)\n",CkMyPe(),file_id_, __LINE__,file_id_);
   fflush(stdout);
@@ -166,6 +178,58 @@ void FileHdf5::file_close () throw()
 
 //----------------------------------------------------------------------
 
+void FileHdf5::file_append () throw()
+{
+  std::string file_name = path_ + "/" + name_;
+
+  ASSERT1("FileHdf5::file_append", "Attempting to reopen an opened file %s",
+	  file_name.c_str(), ! is_file_open_);
+
+  struct stat file_stat;
+  if (stat(file_name.c_str(),&file_stat) != 0) {
+    file_create();
+    return;
+  }
+
+  hid_t file_prop = file_access_prop_();
+
+  file_id_ = H5Fopen(file_name.c_str(), H5F_ACC_RDWR, file_prop);
+
+  if (file_prop != H5P_DEFAULT) H5Pclose (file_prop);
+#ifdef TRACE_DISK  
+  CkPrintf ("%d %Ld :%d TRACE_DISK H5Fopen(%s)\n",CkMyPe(),file_id_, __LINE__,file_name.c_str());
+  fflush(stdout);
+#endif  
+
+  ASSERT2("FileHdf5::file_append", "Return value %ld opening file %s",
+	 file_id_,file_name.c_str(), file_id_ >= 0);
+
+  is_file_open_ = true;
+}
+
+//----------------------------------------------------------------------
+
+hdf5_id FileHdf5::file_access_prop_ () const throw()
+{
+  // align large objects (e.g. to the file system stripe size) and
+  // allocate metadata in blocks of the same size so it does not
+  // fragment the aligned data
+
+  if (alignment_ <= 0 && buffer_size_ <= 0) return H5P_DEFAULT;
+
+  hid_t file_prop = H5Pcreate (H5P_FILE_ACCESS);
+  if (alignment_ > 0) {
+    H5Pset_alignment (file_prop, alignment_, alignment_);
+    H5Pset_meta_block_size (file_prop, alignment_);
+  }
+  if (buffer_size_ > 0) {
+    H5Pset_sieve_buf_size (file_prop, buffer_size_);
+  }
+  return file_prop;
+}
+
+//----------------------------------------------------------------------
+
 void FileHdf5::data_open
 ( std::string name,  int * type,
   int * m1, int * m2, int * m3, int * m4) throw()
@@ -230,6 +294,14 @@ void FileHdf5::mem_create
   mem_space_id_ = space_create_ (mx,my,mz,1, nx,ny,nz,1, gx,gy,gz,0);
 }
 
+//----------------------------------------------------------------------
+
+void FileHdf5::mem_close ()
+{
+  space_close_(mem_space_id_);
+  mem_space_id_ = H5S_ALL;
+}
+
 
 //----------------------------------------------------------------------
 
@@ -259,6 +331,10 @@ void FileHdf5::data_create
 				  n1,n2,n3,n4,
 				  o1,o2,o3,o4);
 
+  // Set chunking (empty datasets are left contiguous)
+
+  const bool is_chunked = set_data_chunk_ (data_space_id_);
+
   // Create the new dataset
 
   data_id_ = H5Dcreate( group,
@@ -266,7 +342,7 @@ void FileHdf5::data_create
 			scalar_to_hdf5_(type),
 			data_space_id_,
 			H5P_DEFAULT,
-			data_prop_,
+			is_chunked ? data_prop_ : H5P_DEFAULT,
 			H5P_DEFAULT);
 #ifdef TRACE_DISK  
   CkPrintf ("%d %Ld :%d TRACE_DISK H5Dcreate(%d)\n",CkMyPe(),file_id_, __LINE__,data_id_);
@@ -290,6 +366,14 @@ void FileHdf5::data_create
 
 void FileHdf5::data_read
 ( void * buffer) throw()
+{
+  data_read_type (buffer, data_type_);
+}
+
+//----------------------------------------------------------------------
+
+void FileHdf5::data_read_type
+( void * buffer, int type) throw()
 {
 
   // error check file open
@@ -312,7 +396,7 @@ void FileHdf5::data_read
 #endif  
   int retval = 
     H5Dread (data_id_,
-	     scalar_to_hdf5_(data_type_),
+	     scalar_to_hdf5_(type),
 	     mem_space_id_,
 	     data_space_id_,
 	     H5P_DEFAULT,
@@ -327,6 +411,31 @@ void FileHdf5::data_read
 
 //----------------------------------------------------------------------
 
+long long FileHdf5::data_offset () throw()
+{
+  ASSERT1("FileHdf5::data_offset", "Trying to access unopened dataset %s",
+	  data_name_.c_str(), is_data_open_);
+
+  long long offset = -1;
+
+  hid_t prop = H5Dget_create_plist (data_id_);
+  hid_t type_file = H5Dget_type (data_id_);
+
+  if (H5Pget_layout (prop) == H5D_CONTIGUOUS &&
+      H5Pget_nfilters (prop) == 0 &&
+      H5Tequal (type_file, scalar_to_hdf5_(data_type_)) > 0) {
+    haddr_t address = H5Dget_offset (data_id_);
+    if (address != HADDR_UNDEF) offset = (long long) address;
+  }
+
+  H5Tclose (type_file);
+  H5Pclose (prop);
+
+  return offset;
+}
+
+//----------------------------------------------------------------------
+
 void FileHdf5::data_write ( const void * buffer ) throw()
 {
 
@@ -384,6 +493,163 @@ void FileHdf5::data_close() throw()
 
 //----------------------------------------------------------------------
 
+void FileHdf5::data_append
+(std::string name, int type, int n, const void * buffer) throw()
+{
+  std::string file_name = path_ + "/" + name_;
+
+  ASSERT1("FileHdf5::data_append", "Trying to write to unopened file %s",
+	  file_name.c_str(), is_file_open_);
+
+  if (n <= 0) return;
+
+  data_close();
+
+  hid_t group = (is_group_open_) ? group_id_ : file_id_;
+
+  // open the dataset, or create it empty and extendible; chunks are
+  // at least FILE_APPEND_CHUNK values so small appends stay cheap
+
+  hsize_t size = 0;
+  if (H5Lexists (group, name.c_str(), H5P_DEFAULT) > 0) {
+    data_id_ = open_dataset_(group,name);
+    hid_t space_id = H5Dget_space (data_id_);
+    H5Sget_simple_extent_dims (space_id,&size,nullptr);
+    H5Sclose (space_id);
+  } else {
+    const hsize_t dims = 0;
+    const hsize_t max_dims = H5S_UNLIMITED;
+    const hsize_t chunk = std::max (hsize_t(n),hsize_t(FILE_APPEND_CHUNK));
+    hid_t space_id = H5Screate_simple (1,&dims,&max_dims);
+    hid_t prop_id = H5Pcreate (H5P_DATASET_CREATE);
+    H5Pset_chunk (prop_id,1,&chunk);
+    data_id_ = H5Dcreate (group, name.c_str(), scalar_to_hdf5_(type),
+                          space_id, H5P_DEFAULT, prop_id, H5P_DEFAULT);
+    H5Pclose (prop_id);
+    H5Sclose (space_id);
+    ASSERT2("FileHdf5::data_append", "Return value %ld creating dataset %s",
+            data_id_,name.c_str(), data_id_ >= 0);
+  }
+
+  data_name_ = name;
+  data_type_ = type;
+  is_data_open_ = true;
+
+  // extend the dataset and write the new values at its end
+
+  const hsize_t new_size = size + n;
+  H5Dset_extent (data_id_,&new_size);
+
+  data_space_id_ = H5Dget_space (data_id_);
+  const hsize_t offset = size;
+  const hsize_t count = n;
+  H5Sselect_hyperslab
+    (data_space_id_,H5S_SELECT_SET,&offset,nullptr,&count,nullptr);
+
+  hid_t mem_id = H5Screate_simple (1,&count,nullptr);
+  int retval = H5Dwrite (data_id_, scalar_to_hdf5_(type),
+                         mem_id, data_space_id_, H5P_DEFAULT, buffer);
+  H5Sclose (mem_id);
+
+  ASSERT1("FileHdf5::data_append","H5Dwrite() returned %d",retval,(retval>=0));
+
+  data_close();
+}
+
+//----------------------------------------------------------------------
+
+void FileHdf5::table_write
+(std::string name, int n,
+ const std::vector<std::string> & column_name,
+ const std::vector<int> & column_type,
+ const std::vector<int> & column_count,
+ const void * buffer) throw()
+{
+  ASSERT1("FileHdf5::table_write", "Trying to write to unopened file %s",
+	  (path_ + "/" + name_).c_str(), is_file_open_);
+
+  // packed compound type of all columns
+
+  size_t record_bytes = 0;
+  for (size_t i=0; i<column_name.size(); i++) {
+    record_bytes += size_t(cello::type_bytes[column_type[i]])*column_count[i];
+  }
+
+  hid_t type_id = H5Tcreate (H5T_COMPOUND, record_bytes);
+  size_t offset = 0;
+  for (size_t i=0; i<column_name.size(); i++) {
+    hid_t column_id = column_to_hdf5_(column_type[i],column_count[i]);
+    H5Tinsert (type_id, column_name[i].c_str(), offset, column_id);
+    H5Tclose (column_id);
+    offset += size_t(cello::type_bytes[column_type[i]])*column_count[i];
+  }
+
+  hid_t group = (is_group_open_) ? group_id_ : file_id_;
+  const hsize_t dims = n;
+  hid_t space_id = H5Screate_simple (1,&dims,nullptr);
+  hid_t dataset_id = H5Dcreate (group, name.c_str(), type_id, space_id,
+                                H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+
+  ASSERT2("FileHdf5::table_write", "Return value %ld creating table %s",
+          dataset_id,name.c_str(), dataset_id >= 0);
+
+  if (n > 0) {
+    int retval = H5Dwrite (dataset_id, type_id, H5S_ALL, H5S_ALL,
+                           H5P_DEFAULT, buffer);
+    ASSERT1("FileHdf5::table_write","H5Dwrite() returned %d",
+            retval,(retval>=0));
+  }
+
+  H5Dclose (dataset_id);
+  H5Sclose (space_id);
+  H5Tclose (type_id);
+}
+
+//----------------------------------------------------------------------
+
+int FileHdf5::table_size (std::string name) throw()
+{
+  hid_t group = (is_group_open_) ? group_id_ : file_id_;
+  hid_t dataset_id = open_dataset_(group,name);
+  hid_t space_id = H5Dget_space (dataset_id);
+  hsize_t n = 0;
+  H5Sget_simple_extent_dims (space_id,&n,nullptr);
+  H5Sclose (space_id);
+  H5Dclose (dataset_id);
+  return int(n);
+}
+
+//----------------------------------------------------------------------
+
+void FileHdf5::table_read_column
+(std::string name, std::string column_name, int type, int count,
+ void * buffer) throw()
+{
+  // HDF5 converts between compound types by member name, so reading
+  // with a one-member type extracts just that column
+
+  hid_t group = (is_group_open_) ? group_id_ : file_id_;
+  hid_t dataset_id = open_dataset_(group,name);
+
+  hid_t column_id = column_to_hdf5_(type,count);
+  hid_t type_id = H5Tcreate
+    (H5T_COMPOUND, size_t(cello::type_bytes[type])*count);
+  H5Tinsert (type_id, column_name.c_str(), 0, column_id);
+
+  int retval = H5Dread (dataset_id, type_id, H5S_ALL, H5S_ALL,
+                        H5P_DEFAULT, buffer);
+
+  ASSERT3("FileHdf5::table_read_column",
+          "H5Dread() returned %d reading column %s of table %s",
+          retval,column_name.c_str(),name.c_str(),(retval>=0));
+
+  H5Tclose (type_id);
+  H5Tclose (column_id);
+  H5Dclose (dataset_id);
+}
+
+//----------------------------------------------------------------------
+
 void FileHdf5::file_read_scalar
 ( void * buffer, std::string name,  int * type) throw()
 {
@@ -649,24 +915,11 @@ void FileHdf5::group_create () throw()
     std::string group = group_rest.substr(0,pos);
     group_rest.erase(0,pos+1);
 
-    // Loop through children to find if subgroup exists
-
-    H5G_info_t group_info;
-    H5Gget_info_by_name (file_id_, group_full.c_str(),
-			 &group_info, H5P_DEFAULT);
-
-    bool group_exists = false;
-    for (size_t i=0; i<group_info.nlinks; i++) {
-      char group_name[80] = {0};
-      H5Lget_name_by_idx (file_id_, group_full.c_str(),
-			  H5_INDEX_NAME,
-			  H5_ITER_NATIVE,i,
-			  group_name,80,H5P_DEFAULT);
-      if (group == group_name) {
-	group_exists = true;
-	break;
-      }
-    }
+    // Check whether subgroup exists (a name lookup rather than a scan
+    // of all children, which is quadratic in the number of Block groups)
+
+    const bool group_exists =
+      (H5Lexists (file_id_, (group_full + group).c_str(), H5P_DEFAULT) > 0);
 
     group_full = group_full + group + "/" ;
 
@@ -790,18 +1043,132 @@ void FileHdf5::group_read_meta
 void FileHdf5::set_compress (int level) throw ()
 {
   compress_level_ = level; 
+  set_pipeline_();
+}
+
+//----------------------------------------------------------------------
+
+void FileHdf5::set_filters (const std::vector<std::string> & filters) throw ()
+{
+  filters_ = filters;
+  set_pipeline_();
+}
+
+//----------------------------------------------------------------------
+
+void FileHdf5::set_pipeline_ () throw()
+{
+  H5Premove_filter (data_prop_, H5Z_FILTER_ALL);
+
+  for (const std::string & filter : filters_) {
+
+    // split "name:v1,v2,..."
+
+    const size_t i_colon = filter.find(':');
+    const std::string name = filter.substr(0,i_colon);
+    std::vector<unsigned int> values;
+    if (i_colon != std::string::npos) {
+      std::stringstream stream (filter.substr(i_colon+1));
+      std::string value;
+      while (std::getline(stream,value,',')) {
+        values.push_back(std::stoul(value));
+      }
+    }
+
+    herr_t retval = 0;
+
+    if (name == "shuffle") {
+      retval = H5Pset_shuffle (data_prop_);
+    } else if (name == "fletcher32") {
+      retval = H5Pset_fletcher32 (data_prop_);
+    } else if (name == "deflate") {
+      retval = H5Pset_deflate (data_prop_, values.empty() ? 6 : values[0]);
+    } else if (name == "szip") {
+      unsigned int config = 0;
+      if (H5Zfilter_avail(H5Z_FILTER_SZIP) > 0) {
+        H5Zget_filter_info (H5Z_FILTER_SZIP, &config);
+      }
+      if (config & H5Z_FILTER_CONFIG_ENCODE_ENABLED) {
+        retval = H5Pset_szip (data_prop_, H5_SZIP_NN_OPTION_MASK,
+                              values.empty() ? 16 : values[0]);
+      } else {
+        WARNING ("FileHdf5::set_filters()",
+                 "SZIP encoding is not available: skipping filter");
+      }
+    } else {
+
+      // plugin filters, by registered name or numeric identifier
+
+      H5Z_filter_t id = -1;
+      if      (name == "bzip2") id = 307;
+      else if (name == "blosc") id = 32001;
+      else if (name == "lz4")   id = 32004;
+      else if (name == "zfp")   id = 32013;
+      else if (name == "zstd")  id = 32015;
+      else if (name.find_first_not_of("0123456789") == std::string::npos &&
+               ! name.empty()) {
+        id = std::stoi(name);
+      } else {
+        ERROR1 ("FileHdf5::set_filters()",
+                "Unknown HDF5 filter \"%s\"", filter.c_str());
+      }
+
+      if (H5Zfilter_avail(id) > 0) {
+        retval = H5Pset_filter (data_prop_, id, H5Z_FLAG_MANDATORY,
+                                values.size(), values.data());
+      } else {
+        WARNING1 ("FileHdf5::set_filters()",
+                  "HDF5 filter \"%s\" is not available: skipping filter",
+                  filter.c_str());
+      }
+    }
+
+    ASSERT2 ("FileHdf5::set_filters()",
+             "Return value %d setting HDF5 filter \"%s\"",
+             retval, filter.c_str(), retval >= 0);
+  }
+
   if (compress_level_ != 0) {
-    WARNING("FileHdf5::set_compress",
-	    "Hard-coded for 2D data with chunk size [10,10]");
-    int rank = 2;
-    hsize_t chunk_size[MAX_DATA_RANK];
-    chunk_size[0]=10;
-    chunk_size[1]=10;
-    H5Pset_chunk(data_prop_,rank,chunk_size);
     H5Pset_deflate(data_prop_,compress_level_);
   }
 }
 
+//----------------------------------------------------------------------
+
+bool FileHdf5::set_data_chunk_ (hdf5_id space_id) throw()
+{
+  if (chunk_.empty() && H5Pget_nfilters(data_prop_) == 0) return false;
+
+  hsize_t dims[MAX_DATA_RANK];
+  const int rank = H5Sget_simple_extent_dims (space_id, dims, NULL);
+
+  for (int i=0; i<rank; i++) {
+    if (dims[i] == 0) return false;
+  }
+
+  // dimension rank-1-k has chunk extent chunk_[k]
+
+  const int nc = chunk_.size();
+  hsize_t chunk[MAX_DATA_RANK];
+  for (int k=0; k<rank; k++) {
+    const hsize_t dim = dims[rank-1-k];
+    hsize_t c = dim;
+    if (k < nc && chunk_[k] > 0) {
+      c = chunk_[k];
+      if (k == rank-1) {
+        for (int i=rank; i<nc; i++) if (chunk_[i] > 0) c *= chunk_[i];
+      }
+    } else if (k >= nc && nc > 0) {
+      c = 1;
+    }
+    chunk[rank-1-k] = std::min(c,dim);
+  }
+
+  H5Pset_chunk (data_prop_, rank, chunk);
+
+  return true;
+}
+
 //======================================================================
 
 void FileHdf5::write_meta_
@@ -947,6 +1314,24 @@ hdf5_id FileHdf5::scalar_to_hdf5_ (int type) const throw()
     hdf5_type = native ? 
       H5T_NATIVE_LLONG : (be ? H5T_STD_I64BE : H5T_STD_I64LE);
     break;
+  case type_half:
+  case type_bfloat16:
+    {
+      // derived from the native float, so the byte order matches the
+      // 16-bit encodings in memory; created once per process
+      static hid_t type_16[2] = {-1, -1};
+      const int i = type - type_half;
+      if (type_16[i] < 0) {
+        const size_t esize = (type == type_half) ? 5 : 8;
+        const size_t msize = 15 - esize;
+        type_16[i] = H5Tcopy (H5T_NATIVE_FLOAT);
+        H5Tset_fields (type_16[i], 15, msize, esize, 0, msize);
+        H5Tset_size   (type_16[i], 2);
+        H5Tset_ebias  (type_16[i], (1 << (esize-1)) - 1);
+      }
+      hdf5_type = type_16[i];
+    }
+    break;
   default:
     ERROR1("FileHdf5::scalar_to_hdf5_", "unsupported type %d", type);
     hdf5_type = 0;
@@ -969,6 +1354,8 @@ int FileHdf5::hdf5_to_scalar_ (hdf5_id hdf5_type) const throw()
 
     if (hdf5_size == sizeof(char)) {
       type = type_char;
+    } else if (hdf5_size == sizeof(short)) {
+      type = type_short;
     } else if (hdf5_size == sizeof(int)) {
       type = type_int;
     } else if (hdf5_size == sizeof(long long)) {
@@ -977,7 +1364,9 @@ int FileHdf5::hdf5_to_scalar_ (hdf5_id hdf5_type) const throw()
 
   } else if (hdf5_class == H5T_FLOAT) {
 
-    if (hdf5_size == sizeof(float)) {
+    if (hdf5_size == 2) {
+      type = (H5Tget_ebias(hdf5_type) == 15) ? type_half : type_bfloat16;
+    } else if (hdf5_size == sizeof(float)) {
       type = type_float;
     } else if (hdf5_size == sizeof(double)) {
       type = type_double;
@@ -1253,6 +1642,15 @@ void FileHdf5::space_close_ (hdf5_id space_id) throw()
 
 //----------------------------------------------------------------------
 
+hdf5_id FileHdf5::column_to_hdf5_ (int type, int count) const throw()
+{
+  if (count == 1) return H5Tcopy (scalar_to_hdf5_(type));
+  const hsize_t dims = count;
+  return H5Tarray_create (scalar_to_hdf5_(type), 1, &dims);
+}
+
+//----------------------------------------------------------------------
+
 hdf5_id FileHdf5::open_dataset_ (hdf5_id group, std::string name) throw()
 {
   
@@ -14,6 +14,18 @@
 
 typedef int64_t hdf5_id;
 
+//----------------------------------------------------------------------
+/// @enum     file_hdf5_type_enum
+/// @brief    Two-byte floating-point types for reduced-precision output
+///
+/// These follow type_enum but exist only on disk: values are held in
+/// memory as their 16-bit encodings, so no conversion is done by HDF5
+
+enum file_hdf5_type_enum {
+  type_half = NUM_TYPES,  // IEEE 754 binary16
+  type_bfloat16           // 8-bit exponent and 7-bit mantissa
+};
+
 class FileHdf5 : public File {
 
   /// @class    FileHdf5
@@ -55,6 +67,10 @@ public: // interface
     p | data_prop_;
     p | is_data_open_;
     p | compress_level_;
+    p | alignment_;
+    p | buffer_size_;
+    p | chunk_;
+    p | filters_;
   }
 
 public: // virtual functions
@@ -69,6 +85,10 @@ public: // virtual functions
 
   /// Close the file
   virtual void file_close () throw();
+
+  /// Open an existing file for writing, or create it if it does not
+  /// exist
+  void file_append () throw();
   
   /// Read scalar metadata item associated with the file
   virtual void file_read_scalar
@@ -118,6 +138,31 @@ public: // virtual functions
   /// Close the opened dataset
   virtual void data_close () throw();
 
+  /// Append n values to the one-dimensional dataset in the current
+  /// group, creating it with unlimited extent if it does not exist
+  void data_append
+  (std::string name, int type, int n, const void * buffer) throw();
+
+  /// Write n records as one compound dataset (a table) in the
+  /// current group.  Column i is named column_name[i] and holds
+  /// column_count[i] values of scalar type column_type[i], and
+  /// records are packed in buffer without padding
+  void table_write
+  (std::string name, int n,
+   const std::vector<std::string> & column_name,
+   const std::vector<int> & column_type,
+   const std::vector<int> & column_count,
+   const void * buffer) throw();
+
+  /// Return the number of records in the table in the current group
+  int table_size (std::string name) throw();
+
+  /// Read one column of the table in the current group into buffer,
+  /// which holds count values of the given scalar type per record
+  void table_read_column
+  (std::string name, std::string column_name, int type, int count,
+   void * buffer) throw();
+
   /// Read a metadata item associated with the opened dataset
   virtual void data_read_meta
   ( void * buffer, std::string name,  int * s_type,
@@ -135,8 +180,7 @@ public: // virtual functions
     int nx, int ny, int nz,
     int gx, int gy, int gz );
 
-  virtual void mem_close ()
-  { space_close_(mem_space_id_) ; }
+  virtual void mem_close ();
   
   // Groups
 
@@ -163,6 +207,10 @@ public: // virtual functions
   ( void * buffer, std::string name,  int * s_type,
     int * n1=0, int * n2=0, int * n3=0, int * n4=0) throw();
   
+  /// Return whether the opened group has the named metadata item
+  bool group_meta_exists (std::string name) const throw()
+  { return H5Aexists(group_id_, name.c_str()) > 0; }
+
   /// Write a metadata item associated with the opened group
   virtual void group_write_meta
   ( const void * buffer, std::string name, int type,
@@ -171,12 +219,58 @@ public: // virtual functions
 
 public: // functions
 
-  /// Set the compression level
+  /// Set the deflate compression level, applied after any filters
+  /// set by set_filters() (0 for none)
   void set_compress (int level) throw ();
 
   /// Return the compression level
   int compress () throw () {return compress_level_; }
 
+  /// Set chunk extents for datasets created by data_create(), fastest
+  /// varying dimension first (e.g. x, y, z for fields).  Dimensions
+  /// beyond those given are chunked with extent 1; 0 spans the
+  /// dataset.  Datasets of lower rank fold the remaining extents into
+  /// their slowest dimension.  If empty, datasets are contiguous unless
+  /// filters are used, in which case each is a single chunk
+  void set_chunk (const std::vector<int> & chunk) throw ()
+  { chunk_ = chunk; }
+  const std::vector<int> & chunk () const throw () { return chunk_; }
+
+  /// Set the filter pipeline for datasets created by data_create(),
+  /// applied in order.  Each filter is "name" or "name:v1,v2,..."
+  /// with name one of "shuffle", "fletcher32", "deflate" (level),
+  /// "szip" (pixels per block), a registered plugin "blosc", "lz4",
+  /// "bzip2", "zfp" or "zstd", or a numeric HDF5 filter id; values
+  /// are passed to plugins as client data.  Unavailable optional
+  /// filters are skipped with a warning
+  void set_filters (const std::vector<std::string> & filters) throw ();
+  const std::vector<std::string> & filters () const throw ()
+  { return filters_; }
+
+  /// Align file objects of at least the given size in bytes to
+  /// multiples of it, e.g. the Lustre stripe size (0 for no alignment).
+  /// Must be called before file_create()
+  void set_alignment (int alignment) throw ()
+  { alignment_ = alignment; }
+  int alignment () const throw () { return alignment_; }
+
+  /// Coalesce small contiguous raw data writes in a buffer of the
+  /// given size in bytes, so that consecutive datasets reach the file
+  /// in large writes (0 for HDF5 default).  Must be called before
+  /// file_create() or file_append()
+  void set_buffer_size (int buffer_size) throw ()
+  { buffer_size_ = buffer_size; }
+
+  /// Read from the opened dataset, converting values to the given
+  /// scalar type (e.g. type_single or type_double)
+  void data_read_type (void * buffer, int type) throw();
+
+  /// Return the byte offset of the opened dataset in the file if it is
+  /// stored contiguously, unfiltered, and in the native representation
+  /// of its scalar type, so that it can be accessed directly (e.g.
+  /// through mmap()); otherwise return -1
+  long long data_offset () throw();
+
   /// Allocate a buffer for reading in a dataset of the given
   /// length and type
   char * allocate_buffer (int n, int type_data)
@@ -204,12 +298,24 @@ public: // functions
   
 protected: // functions
 
+  /// Rebuild the filter pipeline of data_prop_ from filters_ and
+  /// compress_level_
+  void set_pipeline_ () throw();
+
+  /// Set the chunk extents of data_prop_ for the dataset space;
+  /// returns false if the dataset is empty and cannot be chunked
+  bool set_data_chunk_ (hdf5_id space_id) throw();
+
   virtual void write_meta_
   ( hdf5_id id, const void * buffer, std::string name, int type,
     int n1=1, int n2=0, int n3=0, int n4=0) throw();
 
 private: // functions
 
+  /// Return the file access property list for the alignment and
+  /// buffer size, H5P_DEFAULT if neither is set
+  hdf5_id file_access_prop_ () const throw();
+
   /// Convert the scalar type to HDF5 datatype
   hdf5_id scalar_to_hdf5_(int type) const throw();
 
@@ -254,6 +360,10 @@ private: // functions
   /// Open the dataset
   hdf5_id open_dataset_ (hdf5_id group, std::string name) throw();
 
+  /// Return a new HDF5 type for count values of the scalar type, for
+  /// use as a table column
+  hdf5_id column_to_hdf5_ (int type, int count) const throw();
+
   /// Close the dataset
   void close_dataset_ () throw();
 
@@ -315,6 +425,18 @@ private: // attributes
   /// Compression level
   int compress_level_;
 
+  /// File object alignment in bytes (0 for HDF5 default)
+  int alignment_;
+
+  /// Raw data sieve buffer size in bytes (0 for HDF5 default)
+  int buffer_size_;
+
+  /// Dataset chunk extents, fastest varying dimension first
+  std::vector<int> chunk_;
+
+  /// Dataset filter pipeline
+  std::vector<std::string> filters_;
+
 };
 
 #endif /* DISK_FILE_HDF5_HPP */
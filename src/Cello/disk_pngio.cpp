@@ -11,17 +11,19 @@
 // we intentionally include "pngwriter.h" or <png.h> here and NOT in any headers
 // so that they don't become transitive dependencies
 #include "pngwriter.h"
+#include <png.h>
+
+/// Gamma written to the gAMA chunk, as pngwriter did
+#define PNGIO_FILE_GAMMA 0.6
 
 //----------------------------------------------------------------------
 
 void pngio::write(const std::string& fname, double* data, int width,
                   int height, const std::vector<float> (&colormap)[3],
                   ImgTransform transform,
-                  const std::array<double,2>* min_max) noexcept
+                  const std::array<double,2>* min_max,
+                  int compression) noexcept
 {
-
-  pngwriter png = pngwriter(width, height, 0, fname.c_str());
-
   ASSERT("pngio::write", "width must be positive", width > 0);
   ASSERT("pngio::write", "height must be positive", height > 0);
 
@@ -64,9 +66,20 @@ void pngio::write(const std::string& fname, double* data, int width,
     }
   }
 
-  // loop over pixels (ix,iy)
+  // map pixels (ix,iy) to 16-bit big-endian RGB rows; the image
+  // origin is the lower left, so pixel row iy is PNG row my-1-iy
+
+  std::vector<png_byte> rgb (size_t(6)*m);
+
+  auto channel = [](png_byte * pixel, double c) {
+    int value = int(c*65535);
+    value = std::max(0,std::min(65535,value));
+    pixel[0] = png_byte(value >> 8);
+    pixel[1] = png_byte(value & 0xff);
+  };
 
   for (int iy = 0; iy<my; iy++) {
+    png_byte * row = rgb.data() + size_t(6)*mx*(my-1-iy);
     for (int ix = 0; ix<mx; ix++) {
 
       int i = ix + mx*iy;
@@ -76,7 +89,7 @@ void pngio::write(const std::string& fname, double* data, int width,
       if (transform == ImgTransform::abs) value = fabs(value);
       if (transform == ImgTransform::log) value = log(fabs(value));
 
-      double r=0.0,g=0.0,b=0.0;
+      double r=1.0,g=0.0,b=0.0;  // red if out of bounds
 
       if (value < min) value = min;
       if (value > max) value = max;
@@ -99,22 +112,52 @@ void pngio::write(const std::string& fname, double* data, int width,
 	r = (1-ratio)*colormap[0][k] + ratio*colormap[0][k+1];
 	g = (1-ratio)*colormap[1][k] + ratio*colormap[1][k+1];
 	b = (1-ratio)*colormap[2][k] + ratio*colormap[2][k+1];
+      }
 
-	png.plot      (ix+1, iy+1, r,g,b);
+      png_byte * pixel = row + 6*ix;
+      channel(pixel,  r);
+      channel(pixel+2,g);
+      channel(pixel+4,b);
+    }
+  }
 
-      } else {
+  // encode the rows directly with libpng: the "sub" filter alone with
+  // a low zlib level is several times faster than the adaptive default,
+  // and colormapped images compress nearly as well with it
 
-	// red if out of bounds
-	png.plot(ix+1, iy+1, 1.0, 0.0, 0.0);
+  FILE * fp = fopen(fname.c_str(), "wb");
+  if (fp == nullptr) {
+    ERROR2 ("pngio::write",
+            "fopen(%s) returned errno %d",fname.c_str(),errno);
+  }
 
-      }
+  png_structp png_ptr = png_create_write_struct
+    (PNG_LIBPNG_VER_STRING, nullptr, nullptr, nullptr);
+  png_infop info_ptr = png_create_info_struct(png_ptr);
+  ASSERT1 ("pngio::write", "Cannot create the PNG structs for %s",
+           fname.c_str(), (png_ptr != nullptr && info_ptr != nullptr));
 
-      // Plot pixel
-    }
+  if (setjmp(png_jmpbuf(png_ptr))) {
+    ERROR1 ("pngio::write", "libpng error writing %s", fname.c_str());
   }
 
-  // close up the png file (the output data gets written to disk all at once)
-  png.close();
+  png_init_io(png_ptr, fp);
+  png_set_compression_level(png_ptr, compression);
+  png_set_filter(png_ptr, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+
+  png_set_IHDR(png_ptr, info_ptr, mx, my,
+               16, PNG_COLOR_TYPE_RGB, PNG_INTERLACE_NONE,
+               PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+  png_set_gAMA(png_ptr, info_ptr, PNGIO_FILE_GAMMA);
+
+  png_write_info(png_ptr, info_ptr);
+  for (int iy = 0; iy<my; iy++) {
+    png_write_row(png_ptr, rgb.data() + size_t(6)*mx*iy);
+  }
+  png_write_end(png_ptr, info_ptr);
+
+  png_destroy_write_struct(&png_ptr, &info_ptr);
+  fclose(fp);
 }
 
 //----------------------------------------------------------------------
@@ -27,10 +27,17 @@ namespace pngio{
   ///    been applied to entries of data). Values outside of this range are
   ///    clamped to the nearest value. Pass ``nullptr`` to indicate that the
   ///    full range of elements in data should be mapped to colors.
+  /// @param[in] compression The zlib compression level, from 0 (none)
+  ///    to 9 (smallest file, slowest)
+  ///
+  /// @note
+  /// This function only touches its arguments, so it may be called
+  /// concurrently from threads other than the Charm++ scheduler's
   void write(const std::string& fname, double* values, int width, int height,
              const std::vector<float> (&colormap)[3],
              ImgTransform transform,
-             const std::array<double,2>* min_max) noexcept;
+             const std::array<double,2>* min_max,
+             int compression = 1) noexcept;
 
   /// reads data from a png file to create a mask. The mask is true if any RGB
   /// channel in the image is non-zero
@@ -22,6 +22,9 @@ IoBlock::IoBlock() throw ()
   meta_name_.push_back("array");
   meta_name_.push_back("index_order");
   meta_name_.push_back("count_order");
+  // optional: absent from checkpoints written before it was added
+  meta_name_.push_back("cost_order");
+  for (int i=0; i<3; i++) cost_order_[i] = 0.0;
 }
 
 //----------------------------------------------------------------------
@@ -40,6 +43,7 @@ void IoBlock::set_block (Block * block) throw()
   dt_    = block->dt_;
   for (i=0; i<3; i++) array_[i] = block->array_[i];
   block->get_order(&index_order_, &count_order_);
+  block->get_order_cost(cost_order_, cost_order_+1, cost_order_+2);
 }
 
 //----------------------------------------------------------------------
@@ -87,6 +91,10 @@ void IoBlock::meta_value
   } else if (index == count++) {
     *buffer = (void *) & count_order_;
     *type   = type_long_long;
+  } else if (index == count++) {
+    *buffer = (void *) cost_order_;
+    *type   = type_double;
+    *nxd    = 3;
   }
 }
 //======================================================================
@@ -107,6 +115,7 @@ int IoBlock::data_size () const
   SIZE_ARRAY_TYPE(size,int,array_,3);
   SIZE_SCALAR_TYPE(size,long long, index_order_);
   SIZE_SCALAR_TYPE(size,long long, count_order_);
+  SIZE_ARRAY_TYPE(size,double, cost_order_,3);
 
   return size;
 }
@@ -129,6 +138,7 @@ char * IoBlock::save_data (char * buffer) const
   SAVE_ARRAY_TYPE(pc,int,array_,3);
   SAVE_SCALAR_TYPE(pc,long long, index_order_);
   SAVE_SCALAR_TYPE(pc,long long, count_order_);
+  SAVE_ARRAY_TYPE(pc,double, cost_order_,3);
 
   ASSERT2 ("IoBlock::save_data()",
   	   "Expecting buffer size %d actual size %d",
@@ -157,6 +167,7 @@ char * IoBlock::load_data (char * buffer)
   LOAD_ARRAY_TYPE(pc,int,array_,3);
   LOAD_SCALAR_TYPE(pc,long long, index_order_);
   LOAD_SCALAR_TYPE(pc,long long, count_order_);
+  LOAD_ARRAY_TYPE(pc,double, cost_order_,3);
 
   return pc;
 }
@@ -178,5 +189,6 @@ void IoBlock::save_to (void * v)
   b->time_  = time_;
   b->dt_    = dt_;
   b->set_order(index_order_, count_order_);
+  b->set_order_cost(cost_order_[0], cost_order_[1], cost_order_[2]);
 }
 
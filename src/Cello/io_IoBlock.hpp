@@ -50,6 +50,7 @@ public: // interface
     PUParray(p,array_,3);
     p | index_order_;
     p | count_order_;
+    PUParray(p,cost_order_,3);
   }
 
   /// Set block
@@ -69,6 +70,12 @@ public: // interface
   void get_order (long long * index_order, long long * count_order) const
   { *index_order = index_order_; *count_order = count_order_; }
 
+  void get_order_cost
+  (double * cost_self, double * cost_index, double * cost_total) const
+  { *cost_self  = cost_order_[0];
+    *cost_index = cost_order_[1];
+    *cost_total = cost_order_[2]; }
+
   void index(int index3[3]) { index3[0]=index_[0]; index3[1]=index_[1]; index3[2]=index_[2]; }
 
   /// PACKING / UNPACKING
@@ -108,6 +115,8 @@ public: // interface
               array_[0], array_[1], array_[2]);
     CkPrintf ("DEBUG_IO_BLOCK index_order_    %lld\n", index_order_);
     CkPrintf ("DEBUG_IO_BLOCK count_order_    %lld\n", count_order_);
+    CkPrintf ("DEBUG_IO_BLOCK cost_order_     %g %g %g\n",
+              cost_order_[0], cost_order_[1], cost_order_[2]);
   }
 protected: // attributes
 
@@ -121,6 +130,7 @@ protected: // attributes
   int array_[3];
   long long index_order_;
   long long count_order_;
+  double cost_order_[3];
 
 };
 
@@ -7,13 +7,19 @@
 
 #include "io.hpp"
 
+#include <algorithm> // std::min, std::max
+#include <cmath>     // std::isfinite, std::lround
+#include <cstring>   // memcpy
+#include <limits>
+
 //----------------------------------------------------------------------
 
 IoFieldData::IoFieldData() throw ()
   : Io(),
     field_data_(0),
     field_index_(0),
-    include_ghosts_(true)
+    include_ghosts_(true),
+    precision_(io_precision_default)
 {
   // meta_name_.push_back("size");
   // meta_name_.push_back("array_size");
@@ -37,6 +43,55 @@ void IoFieldData::pup (PUP::er &p)
   //  p | *field_data_;
   p | field_index_;
   p | include_ghosts_;
+  p | precision_;
+}
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  const char * io_precision_names[NUM_IO_PRECISION] = {
+    "unknown",
+    "default",
+    "single",
+    "half",
+    "bfloat16",
+    "int16",
+    "int8"
+  };
+
+}
+
+//----------------------------------------------------------------------
+
+int IoFieldData::precision_value (std::string name) throw()
+{
+  for (int i=io_precision_default; i<NUM_IO_PRECISION; i++) {
+    if (name == io_precision_names[i]) return i;
+  }
+  return io_precision_unknown;
+}
+
+//----------------------------------------------------------------------
+
+const char * IoFieldData::precision_name (int precision) throw()
+{
+  return (0 <= precision && precision < NUM_IO_PRECISION) ?
+    io_precision_names[precision] : io_precision_names[0];
+}
+
+//----------------------------------------------------------------------
+
+int IoFieldData::precision_disk_type (int precision, int type) throw()
+{
+  switch (precision) {
+  case io_precision_single:   return type_single;
+  case io_precision_half:     return type_half;
+  case io_precision_bfloat16: return type_bfloat16;
+  case io_precision_int16:    return type_int16;
+  case io_precision_int8:     return type_int8;
+  default:                    return type;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -128,3 +183,206 @@ void IoFieldData::field_array
 
 //----------------------------------------------------------------------
 
+
+namespace {
+
+  /// Return the IEEE binary16 encoding of the float, rounded to
+  /// nearest even
+  uint16_t float_to_half_ (float value)
+  {
+    uint32_t bits;
+    memcpy (&bits,&value,sizeof(bits));
+    const uint16_t sign = (bits >> 16) & 0x8000;
+    const uint32_t abs = bits & 0x7fffffff;
+
+    if (abs >= 0x7f800000) {
+      // infinity or NaN
+      return sign | 0x7c00 | ((abs > 0x7f800000) ? 0x0200 : 0);
+    } else if (abs >= 0x477ff000) {
+      // rounds to at least 65520: overflows to infinity
+      return sign | 0x7c00;
+    } else if (abs < 0x38800000) {
+      // below 2^-14: subnormal, or zero at or below 2^-25
+      if (abs <= 0x33000000) return sign;
+      const int shift = 126 - int(abs >> 23);
+      const uint32_t mantissa = (abs & 0x007fffff) | 0x00800000;
+      uint32_t half = mantissa >> shift;
+      const uint32_t rest = mantissa & ((1u << shift) - 1);
+      const uint32_t tie = 1u << (shift - 1);
+      if (rest > tie || (rest == tie && (half & 1))) ++half;
+      return sign | half;
+    } else {
+      // normal: rebias the exponent and round the mantissa
+      uint32_t half = (abs - 0x38000000) >> 13;
+      const uint32_t rest = abs & 0x1fff;
+      if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) ++half;
+      return sign | half;
+    }
+  }
+
+  /// Return the bfloat16 encoding of the float, rounded to nearest
+  /// even
+  uint16_t float_to_bfloat16_ (float value)
+  {
+    uint32_t bits;
+    memcpy (&bits,&value,sizeof(bits));
+    if ((bits & 0x7fffffff) > 0x7f800000) {
+      // keep NaNs quiet rather than rounding them to infinity
+      return (bits >> 16) | 0x0040;
+    }
+    return (bits + 0x7fff + ((bits >> 16) & 1)) >> 16;
+  }
+
+  /// Pack the nx*ny*nz values of array, with dimensions mx*my, into
+  /// pack converted to the precision
+  template <class T>
+  void pack_values_
+  (const T * array, std::vector<char> & pack, int precision,
+   double * scale, double * offset,
+   int mx, int my, int nx, int ny, int nz)
+  {
+    const size_t n = size_t(nx)*ny*nz;
+    *scale = 1.0;
+    *offset = 0.0;
+
+    auto for_each = [&] (auto f)
+      {
+        size_t i = 0;
+        for (int iz=0; iz<nz; iz++) {
+          for (int iy=0; iy<ny; iy++) {
+            const T * row = array + size_t(mx)*(iy + size_t(my)*iz);
+            for (int ix=0; ix<nx; ix++,i++) f(i,row[ix]);
+          }
+        }
+      };
+
+    if (precision == io_precision_half ||
+        precision == io_precision_bfloat16) {
+
+      pack.resize(n*sizeof(uint16_t));
+      uint16_t * values = (uint16_t *) pack.data();
+      if (precision == io_precision_half) {
+        for_each ([values] (size_t i, T v) { values[i] = float_to_half_(v); });
+      } else {
+        for_each ([values] (size_t i, T v)
+                  { values[i] = float_to_bfloat16_(v); });
+      }
+
+    } else if (precision == io_precision_int16 ||
+               precision == io_precision_int8) {
+
+      // scale the Block's range of finite values to [-q_max,q_max];
+      // non-finite values are written as 0
+
+      double v_min = std::numeric_limits<double>::max();
+      double v_max = std::numeric_limits<double>::lowest();
+      for_each ([&] (size_t i, T v)
+                {
+                  if (std::isfinite(v)) {
+                    v_min = std::min(v_min,double(v));
+                    v_max = std::max(v_max,double(v));
+                  }
+                });
+      if (v_min > v_max) v_min = v_max = 0.0;
+
+      const int q_max = (precision == io_precision_int16) ? 32767 : 127;
+      *offset = 0.5*(v_min + v_max);
+      *scale  = 0.5*(v_max - v_min) / q_max;
+      const double offset_q = *offset;
+      const double scale_q = (*scale > 0.0) ? 1.0 / (*scale) : 0.0;
+      auto quantize = [offset_q,scale_q,q_max] (T v)
+        {
+          if (! std::isfinite(v)) return 0L;
+          const long q = std::lround((v - offset_q)*scale_q);
+          return std::max(-long(q_max),std::min(long(q_max),q));
+        };
+
+      if (precision == io_precision_int16) {
+        pack.resize(n*sizeof(int16_t));
+        int16_t * values = (int16_t *) pack.data();
+        for_each ([&] (size_t i, T v) { values[i] = quantize(v); });
+      } else {
+        pack.resize(n*sizeof(int8_t));
+        int8_t * values = (int8_t *) pack.data();
+        for_each ([&] (size_t i, T v) { values[i] = quantize(v); });
+      }
+
+    } else if (precision == io_precision_single) {
+
+      pack.resize(n*sizeof(float));
+      float * values = (float *) pack.data();
+      for_each ([values] (size_t i, T v) { values[i] = v; });
+
+    } else {
+
+      pack.resize(n*sizeof(T));
+      T * values = (T *) pack.data();
+      for_each ([values] (size_t i, T v) { values[i] = v; });
+
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
+void IoFieldData::field_pack
+(std::vector<char> & pack, std::string * name, int * type,
+ double * scale, double * offset,
+ int * pnx, int * pny, int * pnz) throw()
+/// @param pack   [out] packed values in the disk type
+/// @param name   [out] identifier for the field
+/// @param type   [out] disk type of the packed values
+/// @param scale,offset [out] decoding of integer values
+/// @param pnx,pny,pnz [out] array size of the packed values
+{
+  void * buffer;
+  std::string field_name;
+  int type_field;
+  int mx,my,mz;
+  int nx,ny,nz;
+  field_array (&buffer, &field_name, &type_field, &mx,&my,&mz, &nx,&ny,&nz);
+
+  if (name) (*name) = field_name;
+  if (pnx) (*pnx) = nx;
+  if (pny) (*pny) = ny;
+  if (pnz) (*pnz) = nz;
+
+  if (type) (*type) = precision_disk_type (precision_,type_field);
+
+  switch (type_field) {
+  case type_single:
+    pack_values_ ((const float *) buffer, pack, precision_, scale, offset,
+                  mx,my, nx,ny,nz);
+    break;
+  case type_double:
+    pack_values_ ((const double *) buffer, pack, precision_, scale, offset,
+                  mx,my, nx,ny,nz);
+    break;
+  case type_quadruple:
+    pack_values_ ((const long double *) buffer, pack, precision_, scale, offset,
+                  mx,my, nx,ny,nz);
+    break;
+  default:
+    ERROR2 ("IoFieldData::field_pack",
+            "Unsupported type %d for field %s",
+            type_field, field_name.c_str());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoFieldData::convert_values
+(const cello_float * values, size_t n, int precision,
+ std::vector<char> & pack) throw()
+{
+  ASSERT1 ("IoFieldData::convert_values",
+           "Precision %s requires the range of all values",
+           precision_name(precision), ! precision_is_scaled(precision));
+
+  double scale, offset;
+  pack_values_ (values, pack, precision, &scale, &offset,
+                int(n),1, int(n),1,1);
+}
+
+//----------------------------------------------------------------------
@@ -10,6 +10,21 @@
 
 class FieldData;
 
+//----------------------------------------------------------------------
+/// @enum     io_precision_enum
+/// @brief    Precision of field values written by IoFieldData::field_pack()
+
+enum io_precision_enum {
+  io_precision_unknown,
+  io_precision_default,   // storage precision of the field
+  io_precision_single,    // IEEE 32-bit float
+  io_precision_half,      // IEEE 16-bit float
+  io_precision_bfloat16,  // 16-bit float with the exponent range of single
+  io_precision_int16,     // integers scaled to the Block's range of values
+  io_precision_int8,
+  NUM_IO_PRECISION
+};
+
 class IoFieldData : public Io {
 
   /// @class    IoFieldData
@@ -45,12 +60,50 @@ public: // interface
   void set_include_ghosts (bool include_ghosts)
   { include_ghosts_ = include_ghosts; }
 
+  /// Set the precision of values packed by field_pack()
+  void set_precision (int precision)
+  { precision_ = precision; }
+
+  /// Return the io_precision_enum value with the given name,
+  /// "default", "single", "half", "bfloat16", "int16" or "int8", or
+  /// io_precision_unknown
+  static int precision_value (std::string name) throw();
+
+  /// Return the name of the io_precision_enum value
+  static const char * precision_name (int precision) throw();
+
+  /// Return the disk type of values of the given type packed at the
+  /// precision
+  static int precision_disk_type (int precision, int type) throw();
+
+  /// Whether values packed at the precision are scaled integers
+  static bool precision_is_scaled (int precision) throw()
+  { return (precision == io_precision_int16 ||
+            precision == io_precision_int8); }
+
   /// Return the ith data item associated with the object
   virtual void field_array
   (void ** buffer, std::string * name, int * type,
    int * pmx, int * pmy, int * pmz,
    int * pnx, int * pny, int * pnz) throw();
 
+  /// Pack the field's values contiguously into pack, converting them
+  /// to the precision set by set_precision().  Returns the disk type
+  /// of the packed values and the array size as field_array().  Values
+  /// packed as integers decode as offset + scale * value, with scale
+  /// and offset chosen so the Block's finite values span the integer
+  /// range; otherwise scale is 1 and offset 0
+  void field_pack
+  (std::vector<char> & pack, std::string * name, int * type,
+   double * scale, double * offset,
+   int * pnx, int * pny, int * pnz) throw();
+
+  /// Convert n values to the precision, which must not be a scaled
+  /// integer precision, into pack
+  static void convert_values
+  (const cello_float * values, size_t n, int precision,
+   std::vector<char> & pack) throw();
+
   /// Return the ith metadata item associated with the object
   virtual void meta_value
   (int index,
@@ -69,6 +122,9 @@ protected: // functions
 private: // attributes
 
   bool include_ghosts_;
+
+  /// Precision of values packed by field_pack()
+  int precision_;
 };
 
 #endif /* IO_IO_FIELD_DATA_HPP */
@@ -30,9 +30,14 @@ Output::Output (int index, const Factory * factory) throw()
     io_particle_data_(nullptr),
     it_field_index_(nullptr),        // set_it_index_field()
     it_particle_index_(nullptr),        // set_it_index_particle()
+    derived_list_(),
     stride_write_(1), // default one file per process
-    stride_wait_(1) // default all can write at once
-
+    stride_wait_(1), // default all can write at once
+    min_level_(std::numeric_limits<int>::min()),
+    max_level_(std::numeric_limits<int>::max()),
+    region_lower_(),
+    region_upper_(),
+    region_sphere_(nullptr)
 {
   io_block_         = factory->create_io_block();
   io_field_data_    = factory->create_io_field_data();
@@ -44,6 +49,7 @@ Output::Output (int index, const Factory * factory) throw()
 Output::~Output () throw()
 {
   delete schedule_;          schedule_ = nullptr;
+  delete region_sphere_;     region_sphere_ = nullptr;
   delete file_;              file_ = nullptr;
   delete io_block_;          io_block_ = nullptr;
   delete io_field_data_;     io_field_data_ = nullptr;
@@ -81,10 +87,17 @@ void Output::pup (PUP::er &p)
   p | io_particle_data_;
   p | it_field_index_;
   p | it_particle_index_;
+  p | derived_list_;
 
   p | stride_write_;
   p | stride_wait_;
 
+  p | min_level_;
+  p | max_level_;
+  p | region_lower_;
+  p | region_upper_;
+  p | region_sphere_; // PUP::able
+
 }
 
 //----------------------------------------------------------------------
@@ -97,6 +110,39 @@ void Output::set_schedule (Schedule * schedule) throw()
 
 //----------------------------------------------------------------------
 
+void Output::set_region_sphere (ObjectSphere * sphere) throw()
+{
+  delete region_sphere_;
+  region_sphere_ = sphere;
+}
+
+//----------------------------------------------------------------------
+
+bool Output::is_block_written ( const Block * block ) const throw()
+{
+  const int level = block->level();
+  if (level < min_level_ || max_level_ < level) return false;
+
+  if (region_lower_.empty() && region_sphere_ == nullptr) return true;
+
+  const int rank = cello::rank();
+  double lower[3], upper[3];
+  block->lower(lower,lower+1,lower+2);
+  block->upper(upper,upper+1,upper+2);
+
+  if (! region_lower_.empty()) {
+    for (int axis=0; axis<rank; axis++) {
+      if (upper[axis] < region_lower_[axis] ||
+          region_upper_[axis] < lower[axis]) return false;
+    }
+  }
+
+  return (region_sphere_ == nullptr ||
+          region_sphere_->intersects(lower,upper,rank));
+}
+
+//----------------------------------------------------------------------
+
 bool Output::is_scheduled (int cycle, double time) throw()
 {
   cycle_ = cycle;
@@ -273,6 +319,12 @@ void Output::write_block_ ( const Block * block ) throw()
     }
   }
 
+  // Write derived quantities that are not fields
+
+  for (const std::string & name : derived_list_) {
+    write_derived_data (block, name);
+  }
+
   // Write particles
 
   ItIndex * it_p = it_particle_index_;
@@ -13,6 +13,7 @@
 class Factory;
 class Hierarchy;
 class ItIndex;
+class ObjectSphere;
 class ItParticle;
 class Schedule;
 class Simulation;
@@ -58,8 +59,14 @@ public: // functions
       io_particle_data_(nullptr),
       it_field_index_(nullptr),        // set_it_index_field()
       it_particle_index_(nullptr),        // set_it_index_particle()
+      derived_list_(),
       stride_write_(1),// default one file per process
-      stride_wait_(0) // default no synchronization of writes
+      stride_wait_(0), // default no synchronization of writes
+      min_level_(std::numeric_limits<int>::min()),
+      max_level_(std::numeric_limits<int>::max()),
+      region_lower_(),
+      region_upper_(),
+      region_sphere_(nullptr)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -100,6 +107,12 @@ public: // functions
   /// Set particle iterator
   void set_it_particle_index (ItIndex * it_index) throw()
   { it_particle_index_ = it_index; }
+
+  /// Set the derived quantities in field_list that are not fields,
+  /// which are evaluated by their Compute as they are written
+  void set_derived_list (const std::vector<std::string> & derived_list)
+    throw()
+  { derived_list_ = derived_list; }
   
   /// Return the File object pointer
   File * file() throw() 
@@ -115,6 +128,24 @@ public: // functions
   /// Return whether output is scheduled for this cycle
   bool is_scheduled (int cycle, double time) throw();
 
+  /// Restrict output to Blocks in the given range of levels
+  void set_level_range (int min_level, int max_level) throw()
+  {
+    min_level_ = min_level;
+    max_level_ = max_level;
+  }
+
+  /// Restrict output to Blocks intersecting the box [lower,upper]
+  void set_region_box
+  (const double lower[3], const double upper[3]) throw()
+  {
+    region_lower_.assign(lower,lower+3);
+    region_upper_.assign(upper,upper+3);
+  }
+
+  /// Restrict output to Blocks intersecting the sphere
+  void set_region_sphere (ObjectSphere * sphere) throw();
+
   void set_stride_write (int stride) throw () 
   {
     stride_write_ = stride; 
@@ -174,6 +205,10 @@ public: // virtual functions
   virtual void finalize () throw ()
   { count_ ++; }
 
+  /// Wait for any output still being written in the background
+  virtual void wait () throw ()
+  { }
+
   /// Write Simulation data to disk
   virtual void write_simulation ( const Simulation * simulation ) throw()
   {
@@ -192,6 +227,12 @@ public: // virtual functions
     write_hierarchy_(hierarchy);
   }
 
+  /// Whether write_block() writes anything for the given Block,
+  /// by default whether it is within the level range and intersects
+  /// the region of interest.  Blocks that are skipped are neither
+  /// packed nor sent, and skip computing derived fields
+  virtual bool is_block_written ( const Block * block ) const throw();
+
   /// Write local block data to disk
   virtual void write_block ( const Block * block ) throw()
   {
@@ -209,6 +250,17 @@ public: // virtual functions
   virtual void write_particle_data ( const ParticleData * particle_data,
 				     int particle_index) throw() = 0;
 
+  /// Write a derived quantity that is not a field, evaluating it
+  /// without allocating a field
+  virtual void write_derived_data ( const Block * block,
+                                    const std::string & name) throw()
+  {
+    ERROR1 ("Output::write_derived_data()",
+            "%s is not a field, and this output type cannot write "
+            "derived quantities that are not fields",
+            name.c_str());
+  }
+
   /// Prepare local array with data to be sent to remote chare for processing
   virtual void prepare_remote (int * n, char ** buffer) throw()
   {}
@@ -309,12 +361,26 @@ protected: // attributes
   /// Iterator over particle type indices
   ItIndex * it_particle_index_;
 
+  /// Derived quantities written that are not fields
+  std::vector<std::string> derived_list_;
+
   /// Only processes with id's divisible by stride_write_ writes
   /// (1: all processes write; 2: 0,2,4,... write; np: root process writes)
   int stride_write_;
   
   int stride_wait_;
 
+  /// Range of levels of Blocks written
+  int min_level_;
+  int max_level_;
+
+  /// Box that written Blocks intersect, if not empty
+  std::vector<double> region_lower_;
+  std::vector<double> region_upper_;
+
+  /// Sphere that written Blocks intersect, if not null
+  ObjectSphere * region_sphere_;
+
 };
 
 #endif /* IO_OUTPUT_HPP */
@@ -0,0 +1,336 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputAdios.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the OutputAdios class
+
+#include "cello.hpp"
+#include "main.hpp"
+#include "io.hpp"
+
+#ifdef CONFIG_USE_ADIOS2
+#  include <adios2.h>
+#endif
+
+//----------------------------------------------------------------------
+
+#ifdef CONFIG_USE_ADIOS2
+
+struct OutputAdios::Stream {
+  adios2::ADIOS adios;
+  adios2::IO io;
+  adios2::Engine engine;
+  /// Path of the open engine
+  std::string path;
+  /// Packed particle attributes, kept until the step ends
+  std::vector< std::vector<char> > pack;
+};
+
+namespace {
+
+  /// Define or reuse the variable and put the array in the current step
+  template <class T>
+  void adios_put_
+  (adios2::IO & io, adios2::Engine & engine,
+   std::string name, const void * data,
+   const adios2::Dims & count, const adios2::Dims & memory,
+   adios2::Mode mode)
+  {
+    adios2::Variable<T> var = io.InquireVariable<T>(name);
+    if (! var) {
+      var = (count.size() == 0) ?
+        io.DefineVariable<T>(name) :
+        io.DefineVariable<T>(name,count,adios2::Dims(count.size(),0),count);
+    } else if (count.size() > 0) {
+      var.SetShape(count);
+      var.SetSelection({adios2::Dims(count.size(),0),count});
+    }
+    if (memory.size() > 0) {
+      var.SetMemorySelection({adios2::Dims(memory.size(),0),memory});
+    }
+    engine.Put(var,(const T *)data,mode);
+  }
+
+  /// Dispatch adios_put_ on the Cello type
+  void adios_put_type_
+  (adios2::IO & io, adios2::Engine & engine, int type, std::string name,
+   const void * data, const adios2::Dims & count,
+   const adios2::Dims & memory, adios2::Mode mode)
+  {
+    switch (type) {
+    case type_float:
+      adios_put_<float>      (io,engine,name,data,count,memory,mode); break;
+    case type_double:
+      adios_put_<double>     (io,engine,name,data,count,memory,mode); break;
+    case type_long_double:
+      adios_put_<long double>(io,engine,name,data,count,memory,mode); break;
+    case type_int8:
+      adios_put_<int8_t>     (io,engine,name,data,count,memory,mode); break;
+    case type_int16:
+      adios_put_<int16_t>    (io,engine,name,data,count,memory,mode); break;
+    case type_int32:
+      adios_put_<int32_t>    (io,engine,name,data,count,memory,mode); break;
+    case type_int64:
+      adios_put_<int64_t>    (io,engine,name,data,count,memory,mode); break;
+    default:
+      ERROR2 ("OutputAdios::write()",
+              "Unsupported type %d for variable %s",
+              type,name.c_str());
+    }
+  }
+}
+
+#endif
+
+//----------------------------------------------------------------------
+
+OutputAdios::OutputAdios
+(
+ int index,
+ const Factory * factory,
+ Config * config
+) throw ()
+  : Output(index,factory),
+    engine_type_(config->output_engine[index_]),
+    prefix_(),
+    stream_(nullptr)
+{
+#ifndef CONFIG_USE_ADIOS2
+  ERROR1 ("OutputAdios::OutputAdios()",
+          "Output:%s:type \"adios\" requires building with use_adios2",
+          config->output_list[index_].c_str());
+#endif
+
+  // each process writes its own Blocks to its own engine
+
+  set_stride_write (1);
+  stride_wait_ = 1;
+}
+
+//----------------------------------------------------------------------
+
+OutputAdios::~OutputAdios() throw()
+{
+  close_engine_();
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::pup (PUP::er &p)
+{
+  TRACEPUP;
+
+  // NOTE: change this function whenever attributes change
+
+  Output::pup(p);
+
+  p | engine_type_;
+}
+
+//======================================================================
+
+void OutputAdios::open () throw()
+{
+#ifdef CONFIG_USE_ADIOS2
+  const std::string file_name = expand_name_(&file_name_,&file_args_);
+  const std::string path = directory() + "/" + file_name;
+
+  if (stream_ && stream_->path != path) close_engine_();
+
+  if (stream_ == nullptr) {
+
+    Monitor::instance()->print
+      ("Output","opening %s stream %s",engine_type_.c_str(),path.c_str());
+
+    stream_ = new Stream;
+    stream_->io = stream_->adios.DeclareIO("Output:" + file_name_);
+    stream_->io.SetEngine(engine_type_);
+    stream_->engine = stream_->io.Open(path,adios2::Mode::Write);
+    stream_->path = path;
+  }
+
+  stream_->engine.BeginStep();
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::close () throw()
+{
+#ifdef CONFIG_USE_ADIOS2
+  if (stream_ == nullptr) return;
+
+  // deferred puts are performed here, after all local Blocks are put
+
+  stream_->engine.EndStep();
+  stream_->pack.clear();
+
+  if (file_args_.size() > 0) close_engine_();
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::close_engine_() throw()
+{
+#ifdef CONFIG_USE_ADIOS2
+  if (stream_ == nullptr) return;
+  stream_->engine.Close();
+  delete stream_;
+  stream_ = nullptr;
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::finalize () throw ()
+{
+  Output::finalize();
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::write_hierarchy ( const Hierarchy * hierarchy ) throw()
+{
+  Simulation * simulation = cello::simulation();
+  IoSimulation io_simulation(simulation);
+  write_meta_ (&io_simulation,"");
+
+  IoHierarchy io_hierarchy(hierarchy);
+  write_meta_ (&io_hierarchy,"");
+
+  Output::write_hierarchy(hierarchy);
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::write_block ( const Block * block ) throw()
+{
+  prefix_ = block->name() + "/";
+
+  io_block()->set_block((Block *)block);
+  write_meta_ (io_block(),prefix_);
+
+  Output::write_block(block);
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::write_field_data
+( const FieldData * field_data,
+  int index_field) throw()
+{
+#ifdef CONFIG_USE_ADIOS2
+  io_field_data()->set_field_data((FieldData*)field_data);
+  io_field_data()->set_field_index(index_field);
+
+  void * buffer;
+  std::string name;
+  int type;
+  int nxd,nyd,nzd;  // Array dimension
+  int nx,ny,nz;     // Array size
+
+  io_field_data()->field_array(&buffer, &name, &type,
+                               &nxd,&nyd,&nzd,
+                               &nx, &ny, &nz);
+
+  // buffer starts at the first value written, so the memory selection
+  // starts at the origin and only gives the strides
+
+  adios2::Dims count, memory;
+  if (nzd > 1) {
+    count  = {size_t(nz), size_t(ny), size_t(nx)};
+    memory = {size_t(nz), size_t(nyd),size_t(nxd)};
+  } else if (nyd > 1) {
+    count  = {size_t(ny), size_t(nx)};
+    memory = {size_t(nyd),size_t(nxd)};
+  } else {
+    count  = {size_t(nx)};
+    memory = {size_t(nxd)};
+  }
+
+  adios_put_type_ (stream_->io,stream_->engine,type,prefix_ + name,
+                   buffer,count,memory,adios2::Mode::Deferred);
+#endif
+}
+
+//----------------------------------------------------------------------
+
+void OutputAdios::write_particle_data
+( const ParticleData * particle_data,
+  int it) throw()
+{
+#ifdef CONFIG_USE_ADIOS2
+  ParticleDescr * particle_descr = cello::particle_descr();
+
+  const Particle particle ( (ParticleDescr*) particle_descr,
+                            (ParticleData*)  particle_data);
+
+  const int nb = particle.num_batches(it);
+  const int na = particle.num_attributes(it);
+  const int np = particle.num_particles (it);
+
+  for (int ia=0; ia<na; ia++) {
+
+    const std::string name = prefix_ + "particle_"
+      +                particle.type_name(it) + "_"
+      +                particle.attribute_name(it,ia);
+
+    const int type  = particle.attribute_type(it,ia);
+    const int bytes = particle.attribute_bytes(it,ia);
+    const int stride = particle.stride(it,ia);
+
+    // pack batches into one contiguous array that lives until the
+    // step ends, so the put can be deferred
+
+    stream_->pack.emplace_back(size_t(bytes)*np);
+    char * pack = stream_->pack.back().data();
+
+    int i0 = 0;
+    for (int ib=0; ib<nb; ib++) {
+      const int mb = particle.num_particles(it,ib);
+      const char * array = (const char *) particle.attribute_array(it,ia,ib);
+      for (int ip=0; ip<mb; ip++) {
+        memcpy (pack + size_t(bytes)*(i0+ip),
+                array + size_t(bytes)*stride*ip, bytes);
+      }
+      i0 += mb;
+    }
+
+    ASSERT2 ("OutputAdios::write_particle_data()",
+             "Particle count mismatch %d particles %d written",
+             np,i0,
+             np == i0);
+
+    adios_put_type_ (stream_->io,stream_->engine,type,name,
+                     pack,{size_t(np)},{},adios2::Mode::Deferred);
+  }
+#endif
+}
+
+//======================================================================
+
+void OutputAdios::write_meta_ (Io * io, std::string prefix) throw()
+{
+#ifdef CONFIG_USE_ADIOS2
+  for (size_t i=0; i<io->meta_count(); i++) {
+
+    void * buffer;
+    std::string name;
+    int type;
+    int nx,ny,nz;
+
+    io->meta_value(i,&buffer,&name,&type,&nx,&ny,&nz);
+
+    // metadata buffers are reused by the Io object, so put them now
+
+    const size_t n = size_t(nx)*ny*nz;
+    adios2::Dims count;
+    if (n > 1) count = {n};
+
+    adios_put_type_ (stream_->io,stream_->engine,type,prefix + name,
+                     buffer,count,{},adios2::Mode::Sync);
+  }
+#endif
+}
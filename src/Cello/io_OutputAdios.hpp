@@ -0,0 +1,112 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     io_OutputAdios.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Io] Declaration of the OutputAdios class
+
+#ifndef IO_OUTPUT_ADIOS_HPP
+#define IO_OUTPUT_ADIOS_HPP
+
+class Factory;
+class Hierarchy;
+class Config;
+
+class OutputAdios : public Output {
+
+  /// @class    OutputAdios
+  /// @ingroup  Io
+  /// @brief    [\ref Io] Stream data through ADIOS2
+  ///
+  /// Writes the same Blocks, fields, and particles as OutputData,
+  /// but through an ADIOS2 engine: "BP5" for files, or "SST" to stage
+  /// data directly to a separate analysis job.  Each process has its
+  /// own engine.  Each output is one engine step; field puts are
+  /// deferred, so field data are not copied until the step ends when
+  /// the output closes.  If the file name has no format arguments the
+  /// engine stays open and successive outputs are successive steps of
+  /// one stream, otherwise each output is a separate one-step file.
+  /// Variables are named "<block>/<name>" as the datasets in the
+  /// Block groups of OutputData; simulation and hierarchy metadata
+  /// are top-level variables.  Requires building with use_adios2.
+
+public: // functions
+
+  /// Empty constructor for Charm++ pup()
+  OutputAdios() throw()
+    : engine_type_(),
+      prefix_(),
+      stream_(nullptr)
+  {}
+
+  /// Create an uninitialized OutputAdios object
+  OutputAdios(int index_output,
+              const Factory * factory,
+              Config * config) throw();
+
+  /// Close the engine if it is open
+  virtual ~OutputAdios() throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(OutputAdios);
+
+  /// Charm++ PUP::able migration constructor
+  OutputAdios (CkMigrateMessage *m)
+    : Output (m),
+      engine_type_(),
+      prefix_(),
+      stream_(nullptr)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+public: // virtual functions
+
+  /// Open the engine if needed and begin a step
+  virtual void open () throw();
+
+  /// End the step, closing the engine if each output is its own file
+  virtual void close () throw();
+
+  /// Finalize output
+  virtual void finalize () throw ();
+
+  /// Write hierarchy metadata
+  virtual void write_hierarchy ( const Hierarchy * hierarchy) throw();
+
+  /// Write block metadata and data
+  virtual void write_block ( const Block* block) throw();
+
+  /// Put local field
+  virtual void write_field_data
+  ( const FieldData * field_data,
+    int index_field) throw();
+
+  /// Put local particles
+  virtual void write_particle_data
+  ( const ParticleData * particle_data,
+    int index_particle) throw();
+
+protected: // functions
+
+  /// Put the metadata of the Io object, prefixing names with prefix
+  void write_meta_ (Io * io, std::string prefix) throw();
+
+  /// Close the engine, if any
+  void close_engine_() throw();
+
+protected: // attributes
+
+  /// ADIOS2 engine type, "BP5" or "SST"
+  std::string engine_type_;
+
+  /// Name prefix of variables for the Block being written
+  std::string prefix_;
+
+  /// ADIOS2 objects, defined only when built with ADIOS2; not pupped
+  struct Stream;
+  Stream * stream_;
+};
+
+#endif /* IO_OUTPUT_ADIOS_HPP */
@@ -14,6 +14,10 @@
 
 //#define TRACE_OUTPUT
 
+// Number of cells in the slabs in which derived quantities that are
+// not fields are evaluated as they are written
+#define DERIVED_SLAB_CELLS 16384
+
 OutputData::OutputData
 (
  int index,
@@ -21,7 +25,21 @@ OutputData::OutputData
  Config * config
 ) throw ()
   : Output(index,factory),
-    text_block_count_(0)
+    text_block_count_(0),
+    num_blocks_written_(0),
+    aggregate_(config->output_layout[index_] == "aggregate"),
+    alignment_(config->output_alignment[index_]),
+    chunk_(config->output_chunk[index_]),
+    filters_(config->output_filters[index_]),
+    precision_default_(io_precision_default),
+    precision_field_(),
+    block_row_(),
+    row_level_(),
+    level_row_(),
+    level_size_(),
+    particle_offset_(),
+    row_(-1),
+    pack_()
 {
   // Set process stride, with default = 1
 
@@ -39,6 +57,22 @@ OutputData::OutputData
   
   stride = config->output_stride_wait[index_];
   stride_wait_ = (stride == 0) ? 1 : stride;
+
+  // Set field precisions: one for all fields, or one for each field
+  // in field_list
+
+  const std::vector<std::string> & precision =
+    config->output_precision[index_];
+  const std::vector<std::string> & field_list =
+    config->output_field_list[index_];
+  if (precision.size() == 1) {
+    precision_default_ = IoFieldData::precision_value(precision[0]);
+  } else {
+    for (size_t i=0; i<precision.size(); i++) {
+      precision_field_[field_list[i]] =
+        IoFieldData::precision_value(precision[i]);
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -60,6 +94,12 @@ void OutputData::pup (PUP::er &p)
   Output::pup(p);
 
   p | text_block_count_;
+  p | aggregate_;
+  p | alignment_;
+  p | chunk_;
+  p | filters_;
+  p | precision_default_;
+  p | precision_field_;
 }
 
 //======================================================================
@@ -77,9 +117,42 @@ void OutputData::open () throw()
     ("Output","writing data file %s",
      (dir + "/" + file_name).c_str());
 
-  file_ = new FileHdf5 (dir,file_name);
+  FileHdf5 * file = new FileHdf5 (dir,file_name);
+
+  file->set_alignment(alignment_);
+  file->set_chunk(chunk_);
+  file->set_filters(filters_);
+
+  file_ = file;
 
   file_->file_create();
+
+  // Count local Blocks written, so each process knows how many lines
+  // it contributes to the block_list and file_list text files
+
+  Hierarchy * hierarchy = cello::hierarchy();
+  num_blocks_written_ = 0;
+  for (int k=0; k<hierarchy->num_blocks(); k++) {
+    if (is_block_written(hierarchy->block(k))) ++num_blocks_written_;
+  }
+  text_block_count_ = 0;
+
+  if (num_blocks_written_ == 0) {
+    // contribute an empty line so the text files are still closed
+    std::string name_dir, name_file, name_out_file;
+    text_names_(&name_dir,&name_file,&name_out_file);
+    const std::string block_list = name_file + ".block_list";
+    const std::string file_list  = name_file + ".file_list";
+    char line[1] = {'\0'};
+    proxy_main.p_text_file_write(name_dir.size()+1,  (char *)name_dir.c_str(),
+                                 block_list.size()+1,(char *)block_list.c_str(),
+                                 1, line, 1);
+    proxy_main.p_text_file_write(name_dir.size()+1,  (char *)name_dir.c_str(),
+                                 file_list.size()+1, (char *)file_list.c_str(),
+                                 1, line, 1);
+  }
+
+  if (aggregate_) aggregate_create_();
 }
 
 //----------------------------------------------------------------------
@@ -91,6 +164,12 @@ void OutputData::close () throw()
 #endif    
   if (file_) file_->file_close();
   delete file_;  file_ = 0;
+  block_row_.clear();
+  row_level_.clear();
+  level_row_.clear();
+  level_size_.clear();
+  particle_offset_.clear();
+  pack_.clear();
 }
 
 //----------------------------------------------------------------------
@@ -133,23 +212,11 @@ void OutputData::write_block ( const  Block * block ) throw()
   char dir[256];
   char line[256];
 
-  std::string name_dir = expand_name_(&dir_name_,&dir_args_);
-
   // Write blocks text file
-  std::string name_file;
-  std::string name_out_file  = expand_name_(&file_name_,&file_args_);
+  std::string name_dir, name_file, name_out_file;
+  text_names_(&name_dir,&name_file,&name_out_file);
 
-  if (name_dir == "") {
-    // output block list and parameters to work directory
-    name_dir  = ".";
-    // strip extension, use this for name
-    name_file = name_out_file.substr(0, name_out_file.rfind("."));
-  } else {
-    // output block list and parameters to subdirectory
-    name_file = name_dir;
-  }
-
-  const int num_blocks = cello::hierarchy()->num_blocks();
+  const int num_blocks = num_blocks_written_;
   int count = 0;
     
   // Write DIR.parameters file
@@ -196,6 +263,22 @@ void OutputData::write_block ( const  Block * block ) throw()
 
   text_block_count_ = (text_block_count_ + 1) % num_blocks;
 
+  if (aggregate_) {
+
+    // Block metadata was written to the "/blocks" table on open()
+
+    auto it_row = block_row_.find(block->name());
+    ASSERT1 ("OutputData::write_block()",
+             "Block %s was not on this process when the file was opened",
+             block->name().c_str(),
+             (it_row != block_row_.end()));
+    row_ = it_row->second;
+
+    Output::write_block(block);
+
+    return;
+  }
+
   // Create file group for block
 
   std::string group_name = "/" + block->name();
@@ -228,6 +311,93 @@ void OutputData::write_field_data
   io_field_data()->set_field_data((FieldData*)field_data);
   io_field_data()->set_field_index(index_field);
 
+  const int precision = field_precision_(index_field);
+
+  if (aggregate_) {
+
+    // Pack values contiguously, converting them to the precision, and
+    // write them to the Block's row of its level's dataset
+
+    io_field_data()->set_precision(precision);
+
+    std::string name;
+    int type;
+    double scale, offset;
+    int nx,ny,nz;
+    io_field_data()->field_pack(pack_, &name, &type, &scale, &offset,
+                                &nx,&ny,&nz);
+
+    const int level = row_level_[row_];
+    const int nb = level_size_[level];
+    const int ib = level_row_[row_];
+    const std::string group = level_group_(level);
+    int type_disk;
+    file_->data_open(group + "/" + name,&type_disk);
+    if (nz > 1) {
+      file_->data_slice(nb,nz,ny,nx, 1,nz,ny,nx, ib,0,0,0);
+    } else if (ny > 1) {
+      file_->data_slice(nb,ny,nx, 1, 1,ny,nx, 1, ib,0,0,0);
+    } else {
+      file_->data_slice(nb,nx, 1, 1, 1,nx, 1, 1, ib,0,0,0);
+    }
+    const int n = nx*ny*nz;
+    file_->mem_create(n,1,1,n,1,1,0,0,0);
+    file_->data_write(pack_.data());
+    file_->mem_close();
+    file_->data_close();
+
+    if (IoFieldData::precision_is_scaled(precision)) {
+      const std::pair<std::string,double> decode[2] =
+        { {"_scale",scale}, {"_offset",offset} };
+      for (const auto & item : decode) {
+        file_->data_open(group + "/" + name + item.first,&type_disk);
+        file_->data_slice(nb,1,1,1, 1,1,1,1, ib,0,0,0);
+        file_->mem_create(1,1,1,1,1,1,0,0,0);
+        file_->data_write(&item.second);
+        file_->mem_close();
+        file_->data_close();
+      }
+    }
+
+    return;
+  }
+
+  if (precision != io_precision_default) {
+
+    // Write packed values converted to the precision, and how to
+    // decode them
+
+    io_field_data()->set_precision(precision);
+
+    std::string name;
+    int type;
+    double scale, offset;
+    int nx,ny,nz;
+    io_field_data()->field_pack(pack_, &name, &type, &scale, &offset,
+                                &nx,&ny,&nz);
+
+    file_->mem_create(nx,ny,nz,nx,ny,nz,0,0,0);
+    if (nz > 1) {
+      file_->data_create(name,type,nz,ny,nx,1);
+    } else if (ny > 1) {
+      file_->data_create(name,type,ny,nx,1,1);
+    } else {
+      file_->data_create(name,type,nx,1,1,1);
+    }
+    file_->data_write(pack_.data());
+
+    const std::string precision_name = IoFieldData::precision_name(precision);
+    file_->data_write_meta(precision_name.c_str(),"precision",type_char,
+                           precision_name.size());
+    if (IoFieldData::precision_is_scaled(precision)) {
+      file_->data_write_meta(&scale,"scale",type_double);
+      file_->data_write_meta(&offset,"offset",type_double);
+    }
+    file_->data_close();
+
+    return;
+  }
+
   void * buffer;
   std::string name;
   int type;
@@ -255,6 +425,98 @@ void OutputData::write_field_data
 
 //----------------------------------------------------------------------
 
+void OutputData::write_derived_data
+( const Block * block,
+  const std::string & name) throw()
+{
+  Compute * compute = cello::problem()->create_compute
+    (name, (Config *) cello::config());
+
+  ASSERT1 ("OutputData::write_derived_data()",
+           "%s is neither a field nor a derived quantity that can be "
+           "computed as it is written",
+           name.c_str(), compute->is_streamed());
+
+  const int precision = precision_(name);
+
+  ASSERT2 ("OutputData::write_derived_data()",
+           "Precision %s of %s requires its whole range, so it must be "
+           "a field",
+           IoFieldData::precision_name(precision), name.c_str(),
+           ! IoFieldData::precision_is_scaled(precision));
+
+  // Evaluate the quantity in slabs of planes of the field arrays,
+  // straight into the write buffer, so no field is allocated for it
+
+  int mx,my,mz;
+  ((Block *)block)->data()->field().dimensions(0,&mx,&my,&mz);
+  const int nz_slab = std::min(mz,std::max(1,DERIVED_SLAB_CELLS/(mx*my)));
+
+  const std::string name_data = "field_" + name;
+  const int type = IoFieldData::precision_disk_type(precision,default_type);
+
+  int nb = 0;
+  int ib = 0;
+  if (aggregate_) {
+    const int level = row_level_[row_];
+    nb = level_size_[level];
+    ib = level_row_[row_];
+    int type_disk;
+    file_->data_open(level_group_(level) + "/" + name_data,&type_disk);
+  } else {
+    if (mz > 1) {
+      file_->data_create(name_data,type,mz,my,mx,1);
+    } else if (my > 1) {
+      file_->data_create(name_data,type,my,mx,1,1);
+    } else {
+      file_->data_create(name_data,type,mx,1,1,1);
+    }
+    if (precision != io_precision_default) {
+      const std::string precision_name = IoFieldData::precision_name(precision);
+      file_->data_write_meta(precision_name.c_str(),"precision",type_char,
+                             precision_name.size());
+    }
+  }
+
+  std::vector<cello_float> slab;
+  for (int iz0=0; iz0<mz; iz0+=nz_slab) {
+
+    const int nz = std::min(nz_slab,mz-iz0);
+    const int n = mx*my*nz;
+
+    if (precision == io_precision_default) {
+      pack_.resize(n*sizeof(cello_float));
+      compute->compute_slab ((Block *)block, iz0, nz,
+                             (cello_float *) pack_.data());
+    } else {
+      slab.resize(n);
+      compute->compute_slab ((Block *)block, iz0, nz, slab.data());
+      IoFieldData::convert_values (slab.data(), n, precision, pack_);
+    }
+
+    if (aggregate_) {
+      if (mz > 1) {
+        file_->data_slice(nb,mz,my,mx, 1,nz,my,mx, ib,iz0,0,0);
+      } else if (my > 1) {
+        file_->data_slice(nb,my,mx, 1, 1,my,mx, 1, ib,0,0,0);
+      } else {
+        file_->data_slice(nb,mx, 1, 1, 1,mx, 1, 1, ib,0,0,0);
+      }
+    } else if (mz > 1) {
+      file_->data_slice(mz,my,mx,1, nz,my,mx,1, iz0,0,0,0);
+    }
+    file_->mem_create(n,1,1,n,1,1,0,0,0);
+    file_->data_write(pack_.data());
+    file_->mem_close();
+  }
+
+  file_->data_close();
+
+  delete compute;
+}
+
+//----------------------------------------------------------------------
+
 void OutputData::write_particle_data
 ( const ParticleData * particle_data,
   int it) throw()
@@ -287,6 +549,42 @@ void OutputData::write_particle_data
     
     const int type = particle.attribute_type(it,ia);
 
+    if (aggregate_) {
+
+      // write batches to the Block's range of the aggregated dataset
+
+      const std::vector<int> & offset = particle_offset_[it];
+      const int np_file = offset.back();
+
+      ASSERT3 ("OutputData::write_particle_data()",
+               "Particle count mismatch %d particles %d expected for %s",
+               np, offset[row_+1] - offset[row_], name.c_str(),
+               np == offset[row_+1] - offset[row_]);
+
+      if (np == 0) continue;
+
+      int type_disk;
+      file_->data_open(name,&type_disk);
+
+      int i0 = offset[row_];
+      for (int ib=0; ib<nb; ib++) {
+        const int mb = particle.num_particles(it,ib);
+        if (mb == 0) continue;
+        file_->mem_create(mb,1,1,mb,1,1,0,0,0);
+        const void * buffer = (const void *) particle.attribute_array(it,ia,ib);
+        file_->data_slice
+          (np_file, 1, 1, 1,
+           mb, 1, 1, 1,
+           i0, 0, 0, 0);
+        i0 += mb;
+        file_->data_write(buffer);
+        file_->mem_close();
+      }
+
+      file_->data_close();
+      continue;
+    }
+
     // create the disk array
     file_->data_create(name.c_str(),type,np,1,1,1,np,1,1,1);
     
@@ -331,3 +629,254 @@ void OutputData::write_particle_data
 }
 
 //======================================================================
+
+void OutputData::text_names_
+(std::string * name_dir,
+ std::string * name_file,
+ std::string * name_out_file) const throw()
+{
+  *name_dir      = expand_name_(&dir_name_,&dir_args_);
+  *name_out_file = expand_name_(&file_name_,&file_args_);
+
+  if (*name_dir == "") {
+    // output block list and parameters to work directory
+    *name_dir  = ".";
+    // strip extension, use this for name
+    *name_file = name_out_file->substr(0, name_out_file->rfind("."));
+  } else {
+    // output block list and parameters to subdirectory
+    *name_file = *name_dir;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int OutputData::precision_ (const std::string & name) const throw()
+{
+  auto it = precision_field_.find(name);
+  return (it != precision_field_.end()) ? it->second : precision_default_;
+}
+
+//----------------------------------------------------------------------
+
+int OutputData::field_precision_ (int index_field) const throw()
+{
+  if (precision_field_.empty()) return precision_default_;
+  return precision_(cello::field_descr()->field_name(index_field));
+}
+
+//----------------------------------------------------------------------
+
+void OutputData::aggregate_create_ () throw()
+{
+  // Only Blocks selected by is_block_written() get rows
+
+  Hierarchy * hierarchy = cello::hierarchy();
+  std::vector<Block *> blocks;
+  for (int k=0; k<hierarchy->num_blocks(); k++) {
+    if (is_block_written(hierarchy->block(k))) {
+      blocks.push_back(hierarchy->block(k));
+    }
+  }
+  const int nb = blocks.size();
+
+  // Assign table rows and rows within levels to local Blocks, and
+  // find particle offsets
+
+  ParticleDescr * particle_descr = cello::particle_descr();
+  const int nt = particle_descr->num_types();
+
+  block_row_.clear();
+  row_level_.resize(nb);
+  level_row_.resize(nb);
+  level_size_.clear();
+  particle_offset_.assign(nt,std::vector<int>(nb+1,0));
+  int name_length = 1;
+
+  for (int k=0; k<nb; k++) {
+    Block * block = blocks[k];
+    block_row_[block->name()] = k;
+    const int level = block->level();
+    row_level_[k] = level;
+    level_row_[k] = level_size_[level]++;
+    name_length = std::max(name_length,int(block->name().size())+1);
+    Particle particle = block->data()->particle();
+    for (int it=0; it<nt; it++) {
+      particle_offset_[it][k+1] =
+        particle_offset_[it][k] + particle.num_particles(it);
+    }
+  }
+
+  if (nb == 0) return;
+
+  // Columns of the "/blocks" table: name, level, row in the level's
+  // field datasets, Block metadata, and particle offsets and counts.
+  // All Blocks have the same metadata and particle types, so columns
+  // are taken from the first Block
+
+  std::vector<std::string> column_name;
+  std::vector<int> column_type;
+  std::vector<int> column_count;
+
+  auto add_column = [&] (std::string name, int type, int count)
+    {
+      column_name.push_back(name);
+      column_type.push_back(type);
+      column_count.push_back(count);
+    };
+
+  add_column("name",type_char,name_length);
+  add_column("level",type_int,1);
+  add_column("level_row",type_int,1);
+
+  io_block()->set_block(blocks[0]);
+  for (size_t i=0; i<io_block()->meta_count(); i++) {
+    void * buffer;
+    std::string name;
+    int type;
+    int nx,ny,nz;
+    io_block()->meta_value(i,&buffer,&name,&type,&nx,&ny,&nz);
+    add_column(name,type,nx*ny*nz);
+  }
+
+  std::vector<int> particle_types;
+  ItIndex * it_p = it_particle_index_;
+  if (it_p) {
+    for (it_p->first(); ! it_p->done();  it_p->next()  ) {
+      const int it = it_p->value();
+      particle_types.push_back(it);
+      const std::string prefix = "particle_" + particle_descr->type_name(it);
+      add_column(prefix + "_offset",type_int,1);
+      add_column(prefix + "_count",type_int,1);
+    }
+  }
+
+  size_t record_bytes = 0;
+  for (size_t i=0; i<column_name.size(); i++) {
+    record_bytes += size_t(cello::type_bytes[column_type[i]])*column_count[i];
+  }
+
+  // Pack one record per Block and write the table in one operation
+
+  std::vector<char> table (record_bytes*nb,0);
+
+  for (int k=0; k<nb; k++) {
+    char * record = table.data() + record_bytes*k;
+    auto pack = [&record] (const void * value, size_t bytes)
+      {
+        memcpy (record,value,bytes);
+        record += bytes;
+      };
+
+    std::vector<char> name (name_length,0);
+    strncpy (name.data(),blocks[k]->name().c_str(),name_length-1);
+    pack (name.data(),name_length);
+    pack (&row_level_[k],sizeof(int));
+    pack (&level_row_[k],sizeof(int));
+
+    io_block()->set_block(blocks[k]);
+    for (size_t i=0; i<io_block()->meta_count(); i++) {
+      void * buffer;
+      std::string meta_name;
+      int type;
+      int nx,ny,nz;
+      io_block()->meta_value(i,&buffer,&meta_name,&type,&nx,&ny,&nz);
+      pack (buffer,size_t(cello::type_bytes[type])*nx*ny*nz);
+    }
+
+    for (int it : particle_types) {
+      const int count = particle_offset_[it][k+1] - particle_offset_[it][k];
+      pack (&particle_offset_[it][k],sizeof(int));
+      pack (&count,sizeof(int));
+    }
+  }
+
+  FileHdf5 * file = static_cast<FileHdf5 *>(file_);
+  file->table_write ("blocks",nb,column_name,column_type,column_count,
+                     table.data());
+
+  // Create field datasets for each level, with the Block as the
+  // slowest axis and, unless chunks are given, one Block per chunk
+
+  auto create_field = [&] (const std::string & name, int type, int precision,
+                           int nl, int nx, int ny, int nz)
+    {
+      type = IoFieldData::precision_disk_type(precision,type);
+      if (chunk_.empty()) file->set_chunk(std::vector<int> {nx,ny,nz});
+      if (nz > 1) {
+        file_->data_create(name,type,nl,nz,ny,nx);
+      } else if (ny > 1) {
+        file_->data_create(name,type,nl,ny,nx,1);
+      } else {
+        file_->data_create(name,type,nl,nx,1,1);
+      }
+      if (precision != io_precision_default) {
+        const std::string precision_name =
+          IoFieldData::precision_name(precision);
+        file_->data_write_meta(precision_name.c_str(),"precision",type_char,
+                               precision_name.size());
+      }
+      file_->data_close();
+      file->set_chunk(chunk_);
+      if (IoFieldData::precision_is_scaled(precision)) {
+        file_->data_create(name + "_scale",type_double,nl);
+        file_->data_close();
+        file_->data_create(name + "_offset",type_double,nl);
+        file_->data_close();
+      }
+    };
+
+  ItIndex * it_f = it_field_index_;
+  if (it_f || ! derived_list_.empty()) {
+    for (auto level_size : level_size_) {
+      const int level = level_size.first;
+      const int nl = level_size.second;
+      file_->group_chdir(level_group_(level));
+      file_->group_create();
+      if (it_f) {
+        for (it_f->first(); ! it_f->done();  it_f->next()  ) {
+          const int index_field = it_f->value();
+          io_field_data()->set_field_data(blocks[0]->data()->field_data());
+          io_field_data()->set_field_index(index_field);
+
+          std::string name;
+          int type;
+          int nxd,nyd,nzd;
+          int nx,ny,nz;
+          io_field_data()->field_array(nullptr, &name, &type,
+                                       &nxd,&nyd,&nzd,
+                                       &nx, &ny, &nz);
+          create_field (name,type,field_precision_(index_field),
+                        nl,nx,ny,nz);
+        }
+      }
+      // derived quantities that are not fields span the field arrays
+      for (const std::string & name : derived_list_) {
+        int mx,my,mz;
+        blocks[0]->data()->field().dimensions(0,&mx,&my,&mz);
+        create_field ("field_" + name,default_type,precision_(name),
+                      nl,mx,my,mz);
+      }
+      file_->group_close();
+    }
+  }
+
+  // Create particle datasets, one per attribute for all Blocks
+
+  if (it_p) {
+    Particle particle = blocks[0]->data()->particle();
+    for (int it : particle_types) {
+      const int np = particle_offset_[it][nb];
+      const int na = particle.num_attributes(it);
+      for (int ia=0; ia<na; ia++) {
+        const std::string name = "particle_"
+          +                particle.type_name(it) + "_"
+          +                particle.attribute_name(it,ia);
+        file_->data_create(name,particle.attribute_type(it,ia),np);
+        file_->data_close();
+      }
+    }
+  }
+}
+
+//======================================================================
@@ -17,11 +17,45 @@ class OutputData : public Output {
   /// @class    OutputData
   /// @ingroup  Io
   /// @brief    [\ref Io] define interface for data I/O
+  ///
+  /// With layout "block" (the default) each Block is written to its
+  /// own HDF5 group.  With layout "aggregate" the Blocks of each level
+  /// in a file share one dataset per field in group "/level_<level>",
+  /// with the Block as the slowest varying axis, and particles of a
+  /// type are concatenated into one dataset per attribute.  The
+  /// "/blocks" compound table has one record per Block: its name,
+  /// level, row in the level's datasets, Block metadata, and for each
+  /// particle type the offset and count of the Block's particles.
+  /// This replaces tens of thousands of small datasets, groups and
+  /// attributes per file with a few large contiguous writes.
+  ///
+  /// Field values may be written at reduced precision ("precision"
+  /// parameter), converted as they are packed by IoFieldData.  Such
+  /// datasets have a "precision" attribute, and scaled integer values
+  /// decode as offset + scale * value, with "scale" and "offset"
+  /// attributes in layout "block" and datasets "<field>_scale" and
+  /// "<field>_offset", one value per row, in layout "aggregate".
 
 public: // functions
 
   /// Empty constructor for Charm++ pup()
-  OutputData() throw() : text_block_count_(0) {}
+  OutputData() throw()
+    : text_block_count_(0),
+      num_blocks_written_(0),
+      aggregate_(false),
+      alignment_(0),
+      chunk_(),
+      filters_(),
+      precision_default_(io_precision_default),
+      precision_field_(),
+      block_row_(),
+      row_level_(),
+      level_row_(),
+      level_size_(),
+      particle_offset_(),
+      row_(-1),
+      pack_()
+  {}
 
   /// Create an uninitialized OutputData object
   OutputData(int index_output,
@@ -37,7 +71,21 @@ public: // functions
   /// Charm++ PUP::able migration constructor
   OutputData (CkMigrateMessage *m)
     : Output (m),
-      text_block_count_(0)
+      text_block_count_(0),
+      num_blocks_written_(0),
+      aggregate_(false),
+      alignment_(0),
+      chunk_(),
+      filters_(),
+      precision_default_(io_precision_default),
+      precision_field_(),
+      block_row_(),
+      row_level_(),
+      level_row_(),
+      level_size_(),
+      particle_offset_(),
+      row_(-1),
+      pack_()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -75,11 +123,76 @@ public: // virtual functions
   ( const ParticleData * particle_data,
     int index_particle) throw();
 
+  /// Write a derived quantity that is not a field, evaluating it in
+  /// slabs directly into the write buffer
+  virtual void write_derived_data
+  ( const Block * block,
+    const std::string & name) throw();
+
+protected: // functions
+
+  /// Return the directory and base name of the block_list and
+  /// file_list text files, and the name of the data file
+  void text_names_ (std::string * name_dir,
+                    std::string * name_file,
+                    std::string * name_out_file) const throw();
+
+  /// Create the aggregated datasets for all Blocks on this process
+  void aggregate_create_ () throw();
+
+  /// Return the io_precision_enum value for writing the field or
+  /// derived quantity
+  int precision_ (const std::string & name) const throw();
+  int field_precision_ (int index_field) const throw();
+
+  /// Return the name of the group of field datasets for the level
+  static std::string level_group_ (int level) throw()
+  { return "/level_" + std::to_string(level); }
+
 protected:
 
   /// Count of number of Blocks sent from local process for text file
   /// output
   int text_block_count_;
+
+  /// Number of local Blocks written, as selected by is_block_written()
+  int num_blocks_written_;
+
+  /// Whether Blocks are written to aggregated datasets rather than
+  /// one group per Block
+  bool aggregate_;
+
+  /// File object alignment in bytes, e.g. the file system stripe size
+  int alignment_;
+
+  /// Dataset chunk extents (x,y,z) and filter pipeline
+  std::vector<int> chunk_;
+  std::vector<std::string> filters_;
+
+  /// Precision of fields written, unless given for the field by name
+  int precision_default_;
+  std::map<std::string,int> precision_field_;
+
+  /// Row of each local Block in the aggregated datasets, by name
+  std::map<std::string,int> block_row_;
+
+  /// Level of the Block in each row, and its row in the level's
+  /// field datasets
+  std::vector<int> row_level_;
+  std::vector<int> level_row_;
+
+  /// Number of local Blocks in each level
+  std::map<int,int> level_size_;
+
+  /// Offset of each Block's particles in the aggregated particle
+  /// datasets, for each particle type; the last element is the total
+  std::vector< std::vector<int> > particle_offset_;
+
+  /// Row of the Block being written
+  int row_;
+
+  /// Buffer for packing the values of a field
+  std::vector<char> pack_;
 };
 
 #endif /* IO_OUTPUT_DATA_HPP */
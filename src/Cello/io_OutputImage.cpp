@@ -59,7 +59,10 @@ OutputImage::OutputImage(int index,
   include_ghost_(ghost),
   min_level_(min_level),
   max_level_(max_level),
-  leaf_only_(leaf_only)
+  leaf_only_(leaf_only),
+  num_resolutions_(1),
+  compression_(1),
+  pending_()
 {
   int root_size[3] =
     {root_size_in[0], root_size_in[1], root_size_in[2]};
@@ -131,12 +134,15 @@ OutputImage::OutputImage(int index,
     image_lower_[axis] = image_lower[axis];
     image_upper_[axis] = image_upper[axis];
   }
+  tile_clear_();
 }
 
 //----------------------------------------------------------------------
 
 OutputImage::~OutputImage() throw ()
 {
+  wait();
+
   TRACE_MEMORY("delete image_data_",image_size_[0]*image_size_[1]*sizeof(double));
   TRACE_MEMORY("delete image_mesh_",image_size_[0]*image_size_[1]*sizeof(double));
 
@@ -201,6 +207,10 @@ void OutputImage::pup (PUP::er &p)
   p | leaf_only_;
   PUParray(p,image_lower_,3);
   PUParray(p,image_upper_,3);
+  p | num_resolutions_;
+  p | compression_;
+  PUParray(p,tile_lower_,2);
+  PUParray(p,tile_upper_,2);
 }
 
 //----------------------------------------------------------------------
@@ -298,12 +308,27 @@ void OutputImage::write_block ( const Block *  block ) throw()
   ixp = (bp3[IX]-dm3[IX])/(dp3[IX]-dm3[IX])*image_size_[0];
   iyp = (bp3[IY]-dm3[IY])/(dp3[IY]-dm3[IY])*image_size_[1];
 
+  // Exit if Block does not cover any image pixels (allowing one pixel
+  // for particle deposition)
+
+  if (ixp < -1 || ixm > image_size_[0] ||
+      iyp < -1 || iym > image_size_[1]) return;
+
+  tile_extend_(ixm-1,ixp+1,iym-1,iyp+1);
+
   double h3[3];
   block->cell_width(h3,h3+1,h3+2);
 
+  // Skip field data if Block does not intersect the slice along the
+  // image axis
+
+  const double zlo = dm3[IZ] - 0.5*h3[IZ];
+  const double zhi = dp3[IZ] + 0.5*h3[IZ];
+  const bool in_slice = (rank < 3) || (bm3[IZ] <= zhi && zlo <= bp3[IZ]);
+
   if (type_is_data_()) {
 
-    if (index_field >= 0) {
+    if (index_field >= 0 && in_slice) {
 
       // Get ghost depth
 
@@ -339,6 +364,17 @@ void OutputImage::write_block ( const Block *  block ) throw()
       m3[0] = include_ghost_ ? nd3[0] : nb3[0];
       m3[1] = include_ghost_ ? nd3[1] : nb3[1];
       m3[2] = include_ghost_ ? nd3[2] : nb3[2];
+
+      // range of cells along the image axis that may intersect the
+      // slice (each cell is still tested below)
+      int izm = 0;
+      int izp = m3[IZ]-1;
+      if (rank >= 3) {
+        const double hz = (bp3[IZ]-bm3[IZ])/m3[IZ];
+        izm = std::max(izm, int(floor((zlo-bm3[IZ])/hz - 0.5)) - 1);
+        izp = std::min(izp, int(ceil ((zhi-bm3[IZ])/hz - 0.5)) + 1);
+      }
+
       for (int ix=0; ix<m3[IX]; ix++) {
 	double x = bm3[IX] + (ix+0.5)*(bp3[IX]-bm3[IX])/m3[IX];
 	int jxm = ixm +  ix   *(ixp-ixm)/m3[IX];
@@ -349,10 +385,8 @@ void OutputImage::write_block ( const Block *  block ) throw()
 	    int jym = iym +  iy   *(iyp-iym)/m3[IY];
 	    int jyp = iym + (iy+1)*(iyp-iym)/m3[IY]-1;
 	    if (dm3[IY] <= y && y <= dp3[IY]) {
-	      for (int iz=0; iz<m3[IZ]; iz++) {
+	      for (int iz=izm; iz<=izp; iz++) {
 		double z = bm3[IZ] + (iz+0.5)*(bp3[IZ]-bm3[IZ])/m3[IZ];
-		double zlo = dm3[IZ] - 0.5*h3[IZ];
-		double zhi = dp3[IZ] + 0.5*h3[IZ];
 		if (rank < 3 || (zlo <= z && z <= zhi)) {
 		  int i=ix*d3[IX] + iy*d3[IY] + iz*d3[IZ];
 		  double value = 0.0;
@@ -527,16 +561,28 @@ void OutputImage::write_particle_data
 //----------------------------------------------------------------------
 
 void OutputImage::prepare_remote (int * n, char ** buffer) throw()
+// Only the tile of pixels modified on this process is sent
 {
   int size = 0;
-  int nx = image_size_[0];
-  int ny = image_size_[1];
+  const int nx = image_size_[0];
+  const int ny = image_size_[1];
+
+  int ixm = 0, ixp = -1, iym = 0, iyp = -1;
+  if (! tile_empty_()) {
+    ixm = tile_lower_[0];
+    iym = tile_lower_[1];
+    ixp = tile_upper_[0];
+    iyp = tile_upper_[1];
+  }
+  const int mx = ixp - ixm + 1;
+  const int my = iyp - iym + 1;
 
   // Determine buffer size
 
   size += 2*sizeof(int);        // image_size_[0], image_size_[1]
-  size += nx*ny*sizeof(double); // image_data_
-  size += nx*ny*sizeof(double); // image_mesh_
+  size += 4*sizeof(int);        // tile bounds
+  size += mx*my*sizeof(double); // image_data_ tile
+  size += mx*my*sizeof(double); // image_mesh_ tile
   (*n) = size;
 
   // Allocate buffer (deallocated in cleanup_remote())
@@ -553,10 +599,17 @@ void OutputImage::prepare_remote (int * n, char ** buffer) throw()
 
   *p.i++ = nx;
   *p.i++ = ny;
+  *p.i++ = ixm;
+  *p.i++ = ixp;
+  *p.i++ = iym;
+  *p.i++ = iyp;
 
-  for (int k=0; k<nx*ny; k++) *p.d++ = image_data_[k];
-  for (int k=0; k<nx*ny; k++) *p.d++ = image_mesh_[k];
-
+  for (int iy=iym; iy<=iyp; iy++) {
+    for (int ix=ixm; ix<=ixp; ix++) *p.d++ = image_data_[ix+nx*iy];
+  }
+  for (int iy=iym; iy<=iyp; iy++) {
+    for (int ix=ixm; ix<=ixp; ix++) *p.d++ = image_mesh_[ix+nx*iy];
+  }
 }
 
 //----------------------------------------------------------------------
@@ -573,24 +626,34 @@ void OutputImage::update_remote  ( int m, char * buffer) throw()
 
   const int nx = *p.i++;
   const int ny = *p.i++;
-
-  const int n = nx*ny;
-
-  if (op_reduce_ == reduce_min) {
-    for (int k=0; k<n; k++) image_data_[k] = std::min(image_data_[k],*p.d++);
-    for (int k=0; k<n; k++) image_mesh_[k] = std::min(image_mesh_[k],*p.d++);
-  } else if (op_reduce_ == reduce_max) {
-    for (int k=0; k<n; k++) image_data_[k] = std::max(image_data_[k],*p.d++);
-    for (int k=0; k<n; k++) image_mesh_[k] = std::max(image_mesh_[k],*p.d++);
-  } else if (op_reduce_ == reduce_sum) {
-    for (int k=0; k<n; k++) image_data_[k] += *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k] += *p.d++;
-  } else if (op_reduce_ == reduce_avg) {
-    for (int k=0; k<n; k++) image_data_[k] += *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k] += *p.d++;
-  } else if (op_reduce_ == reduce_set) {
-    for (int k=0; k<n; k++) image_data_[k]  = *p.d++;
-    for (int k=0; k<n; k++) image_mesh_[k]  = *p.d++;
+  const int ixm = *p.i++;
+  const int ixp = *p.i++;
+  const int iym = *p.i++;
+  const int iyp = *p.i++;
+
+  ASSERT4 ("OutputImage::update_remote()",
+           "Remote image size %d x %d differs from local size %d x %d",
+           nx,ny,image_size_[0],image_size_[1],
+           (nx == image_size_[0] && ny == image_size_[1]));
+
+  double * images[2] = { image_data_, image_mesh_ };
+
+  for (int k=0; k<2; k++) {
+    double * image = images[k];
+    for (int iy=iym; iy<=iyp; iy++) {
+      double * row = image + nx*iy;
+      if (op_reduce_ == reduce_min) {
+        for (int ix=ixm; ix<=ixp; ix++) row[ix] = std::min(row[ix],*p.d++);
+      } else if (op_reduce_ == reduce_max) {
+        for (int ix=ixm; ix<=ixp; ix++) row[ix] = std::max(row[ix],*p.d++);
+      } else if (op_reduce_ == reduce_sum) {
+        for (int ix=ixm; ix<=ixp; ix++) row[ix] += *p.d++;
+      } else if (op_reduce_ == reduce_avg) {
+        for (int ix=ixm; ix<=ixp; ix++) row[ix] += *p.d++;
+      } else if (op_reduce_ == reduce_set) {
+        for (int ix=ixm; ix<=ixp; ix++) row[ix]  = *p.d++;
+      }
+    }
   }
 
 }
@@ -692,6 +755,8 @@ void OutputImage::image_create_ () throw()
   for (int i=0; i<image_size_[0]*image_size_[1]; i++) image_data_[i] = value0;
   for (int i=0; i<image_size_[0]*image_size_[1]; i++) image_mesh_[i] = value0;
 
+  tile_clear_();
+
 }
 
 //----------------------------------------------------------------------
@@ -704,24 +769,25 @@ void OutputImage::image_write_ () throw()
           "this method was called on a non-writer block");
   }
 
-  // fetch the pointer to the data that will be plotted
-  double* data = nullptr;
-  std::vector<double> buf(0);
+  // finish encoding the previous output's images before starting
+  // this output's
 
-  if (type_is_mesh_() && type_is_data_()){
+  wait();
 
-    const int m  = image_size_[0]*image_size_[1];
+  // copy the data that will be plotted, since image_data_ and
+  // image_mesh_ are deleted once this output closes
 
-    // wasteful to allocate memory on the heap, but it's probably fine
-    buf.resize(static_cast<std::size_t>(m));
+  const int m  = image_size_[0]*image_size_[1];
 
-    for (int i=0; i<m; i++) buf[i] = (image_data_[i] + 0.2*image_mesh_[i])/1.2;
-    data = buf.data();
+  auto data = std::make_shared<std::vector<double>>(m);
 
+  if (type_is_mesh_() && type_is_data_()){
+    for (int i=0; i<m; i++)
+      (*data)[i] = (image_data_[i] + 0.2*image_mesh_[i])/1.2;
   } else if (type_is_data_()){
-    data = image_data_;
+    std::copy_n(image_data_,m,data->begin());
   } else if (type_is_mesh_()) {
-    data = image_mesh_;
+    std::copy_n(image_mesh_,m,data->begin());
   } else {
     ERROR ("OutputImage::image_write_", "image_type is neither mesh nor data");
   }
@@ -735,13 +801,8 @@ void OutputImage::image_write_ () throw()
   }
 
   // prepare the min_max argument
-  std::array<double, 2>* min_max_arg = nullptr;
-  std::array<double, 2> min_max_buf_;
-  if (use_min_max_){
-    min_max_buf_[0] = min_value_;
-    min_max_buf_[1] = max_value_;
-    min_max_arg = &min_max_buf_;
-  }
+  const bool use_min_max = use_min_max_;
+  const std::array<double, 2> min_max = {min_value_, max_value_};
 
   // determine the output path
   std::string file_name = expand_name_ (&file_name_,&file_args_);
@@ -759,10 +820,91 @@ void OutputImage::image_write_ () throw()
             errno,strerror(errno));
   };
 
-  pngio::write(dir_name + "/" + file_name, data, 
-               image_size_[0], // = width
-               image_size_[1], // = height
-               colormap_, transform, min_max_arg);
+  // Each image is encoded and written by its own thread, so the
+  // simulation continues while the PNG files are compressed.  Tasks
+  // capture copies of everything they use.
+
+  const std::vector<float> (&colormap)[3] = colormap_;
+  const int compression = compression_;
+  auto encode = [=] (std::string path,
+                     std::shared_ptr<std::vector<double>> values,
+                     int nx, int ny) {
+    pngio::write(path, values->data(), nx, ny, colormap, transform,
+                 use_min_max ? &min_max : nullptr, compression);
+  };
+
+  pending_.push_back
+    (std::async(std::launch::async, encode,
+                dir_name + "/" + file_name, data,
+                image_size_[0], image_size_[1]));
+
+  // write any coarser resolutions, named by inserting "-<k>" before
+  // the file extension
+
+  const size_t i_ext = file_name.rfind('.');
+  const std::string file_base = file_name.substr(0,i_ext);
+  const std::string file_ext =
+    (i_ext == std::string::npos) ? "" : file_name.substr(i_ext);
+
+  std::shared_ptr<std::vector<double>> fine = data;
+  int nx = image_size_[0];
+  int ny = image_size_[1];
+  for (int k=1; k<num_resolutions_ && (nx > 1 || ny > 1); k++) {
+    auto coarse = std::make_shared<std::vector<double>>();
+    image_coarsen_(fine->data(),nx,ny,*coarse);
+    nx = (nx + 1) / 2;
+    ny = (ny + 1) / 2;
+    fine = coarse;
+    pending_.push_back
+      (std::async(std::launch::async, encode,
+                  dir_name + "/" + file_base + "-" + std::to_string(k)
+                  + file_ext, fine, nx, ny));
+  }
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::wait () throw()
+{
+  for (auto & task : pending_) task.wait();
+  pending_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void OutputImage::image_coarsen_
+(const double * data, int nx, int ny, std::vector<double> & coarse) const
+/// Coarse pixels are the minimum or maximum of the fine pixels they
+/// cover for min and max reductions, and the average otherwise
+{
+  const int cx = (nx + 1) / 2;
+  const int cy = (ny + 1) / 2;
+  coarse.resize(cx*cy);
+  for (int jy=0; jy<cy; jy++) {
+    for (int jx=0; jx<cx; jx++) {
+      double value = 0.0;
+      int count = 0;
+      for (int iy=2*jy; iy<std::min(2*jy+2,ny); iy++) {
+        for (int ix=2*jx; ix<std::min(2*jx+2,nx); ix++) {
+          const double v = data[ix+nx*iy];
+          if (count == 0) {
+            value = v;
+          } else if (op_reduce_ == reduce_min) {
+            value = std::min(value,v);
+          } else if (op_reduce_ == reduce_max) {
+            value = std::max(value,v);
+          } else {
+            value += v;
+          }
+          ++count;
+        }
+      }
+      if (op_reduce_ != reduce_min && op_reduce_ != reduce_max) {
+        value /= count;
+      }
+      coarse[jx+cx*jy] = value;
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -79,7 +79,10 @@ public: // functions
       include_ghost_(false),
       min_level_(0),
       max_level_(0),
-      leaf_only_(false)
+      leaf_only_(false),
+      num_resolutions_(1),
+      compression_(1),
+      pending_()
   {
     colormap_[0].clear();
     colormap_[1].clear();
@@ -88,6 +91,7 @@ public: // functions
       image_lower_[axis] = -std::numeric_limits<double>::max();
       image_upper_[axis] =  std::numeric_limits<double>::max();
     }
+    tile_clear_();
   }
 
   /// CHARM++ Pack / Unpack function
@@ -96,6 +100,15 @@ public: // functions
   // Set the image colormap
   void set_colormap (std::vector<float> colormap[3]);
 
+  /// Set the number of image resolutions written, each half the size
+  /// of the previous
+  void set_resolutions (int num_resolutions)
+  { num_resolutions_ = num_resolutions; }
+
+  /// Set the zlib compression level of PNG files
+  void set_compression (int compression)
+  { compression_ = compression; }
+
 public: // virtual functions
 
   /// Prepare for accumulating block data
@@ -122,13 +135,17 @@ public: // virtual functions
   /// Close file for IO
   ///
   /// @note
-  /// In practice this opens the output file, writes the image (that is already
-  /// assembled in memory) to the file and then closes the file
+  /// In practice this hands the image (that is already assembled in
+  /// memory) to background threads that encode and write the PNG
+  /// files, and returns without waiting for them
   virtual void close () throw();
 
   /// Cleanup after output
   virtual void finalize () throw();
 
+  /// Wait until PNG files still being encoded are written
+  virtual void wait () throw();
+
   /// Write block-related field and particle data
   virtual void write_block ( const Block * block ) throw();
 
@@ -164,15 +181,42 @@ private: // functions
 
   bool is_active_ (const Block * block) const;
 
+  /// Clear the local tile of modified pixels
+  void tile_clear_ ()
+  {
+    tile_lower_[0] = tile_lower_[1] = std::numeric_limits<int>::max();
+    tile_upper_[0] = tile_upper_[1] = -1;
+  }
+
+  /// Extend the local tile of modified pixels to include the given
+  /// box, clipped to the image
+  void tile_extend_ (int ixm, int ixp, int iym, int iyp)
+  {
+    tile_lower_[0] = std::min(tile_lower_[0],std::max(ixm,0));
+    tile_lower_[1] = std::min(tile_lower_[1],std::max(iym,0));
+    tile_upper_[0] = std::max(tile_upper_[0],std::min(ixp,image_size_[0]-1));
+    tile_upper_[1] = std::max(tile_upper_[1],std::min(iyp,image_size_[1]-1));
+  }
+
+  /// Whether any pixels have been modified locally
+  bool tile_empty_ () const
+  { return (tile_lower_[0] > tile_upper_[0] ||
+            tile_lower_[1] > tile_upper_[1]); }
+
   /// Create the image data object
   void image_create_ () throw();
 
-  /// Generate PNG image, using given min and max for colormap
+  /// Start encoding the PNG images in background threads, using
+  /// given min and max for colormap
   void image_write_ () throw();
 
   /// Close the image data
   void image_close_ () throw();
 
+  /// Coarsen an nx*ny image by a factor of two in each dimension
+  void image_coarsen_ (const double * data, int nx, int ny,
+                       std::vector<double> & coarse) const;
+
    /// Generate a PNG image of array data
   void reduce_point_
   ( double * data,  int ix, int iy, double value, double alpha=1.0) throw();
@@ -249,7 +293,21 @@ private: // attributes
   /// Lower and upper bounds on image (can be used for slices)
   double image_lower_[3];
   double image_upper_[3];
-  
+
+  /// Number of image resolutions written, each half the previous
+  int num_resolutions_;
+
+  /// zlib compression level of PNG files
+  int compression_;
+
+  /// PNG files being encoded and written by background threads
+  /// [not pup'ed: waited for before the simulation exits]
+  std::vector< std::future<void> > pending_;
+
+  /// Bounds of the pixels modified on this process (not including
+  /// remote updates); only this tile is sent to the writer
+  int tile_lower_[2];
+  int tile_upper_[2];
 };
 
 #endif /* IO_OUTPUT_IMAGE_HPP */
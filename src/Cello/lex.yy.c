@@ -588,6 +588,10 @@ char linebuf[500];
   const char * curfilename;
   int cello_new_file (const char *);
   int cello_pop_file ();
+
+  /* every file opened, for validating cached parameters */
+  static char ** cello_file_names = 0;
+  static int     cello_num_files  = 0;
     
 
 #line 594 "lex.yy.c"
@@ -2302,6 +2306,14 @@ int cello_new_file(const char * filename)
     exit(1);
   }
 
+  if (curbs == NULL) {
+    /* new top-level file */
+    while (cello_num_files > 0) free (cello_file_names[--cello_num_files]);
+  }
+  cello_file_names = realloc (cello_file_names,
+			      (cello_num_files+1)*sizeof(char *));
+  cello_file_names[cello_num_files++] = strdup(filename);
+
   if (curbs != NULL) curbs->lineno = yylineno;
   bs->prev = curbs;
   bs->bs = yy_create_buffer(fp,YY_BUF_SIZE);
@@ -2338,4 +2350,14 @@ int cello_pop_file ()
   return 1;
 }
 
+int cello_parameters_num_files ()
+{
+  return cello_num_files;
+}
+
+const char * cello_parameters_file (int i)
+{
+  return cello_file_names[i];
+}
+
 
@@ -53,6 +53,12 @@ extern CProxy_EnzoSimulation proxy_simulation;
 void Main::p_exit(int count)
 {
   DEBUG("Main::p_exit");
+#ifdef CHARM_ENZO
+  // Wait for any asynchronous checkpoint to finish writing; calls
+  // p_exit() again when done
+  EnzoSimulation * simulation = enzo::simulation();
+  if (simulation && simulation->check_defer_exit()) return;
+#endif
   count_exit_++;
   unit_finalize();
   if (count_exit_ >= count) {
@@ -75,6 +81,15 @@ void Main::exit_()
   }
 
   if (simulation) {
+    // Final per-cycle latency budget, recorded on the root process
+    if (CkMyPe() == 0 && simulation->budget()) {
+      simulation->budget()->write();
+    }
+    // Wait for images still being encoded in the background
+    Problem * problem = simulation->problem();
+    for (int i=0; problem->output(i) != nullptr; i++) {
+      problem->output(i)->wait();
+    }
     enzo_finalize(simulation);
   }
 
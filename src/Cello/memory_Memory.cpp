@@ -24,11 +24,18 @@ void Memory::initialize_()
   index_group_ = 0;
 
   if (group_name_.size() == 0) {
-    new_group ("Cello");
+    for (int i=0; i<num_memory_group; i++) {
+      new_group (default_group_name(i));
+    }
+  }
+
+  for (int k=0; k<MEMORY_NUM_SIZE_CLASS; k++) {
+    size_class_new_[k] = 0;
   }
 
-  fill_new_    = 0xaa;
-  fill_delete_ = 0xdd;
+  // filling every allocation is costly: see Memory:fill
+  fill_new_    = 0;
+  fill_delete_ = 0;
 
   is_active_ = true;
 
@@ -37,32 +44,42 @@ void Memory::initialize_()
 
 //----------------------------------------------------------------------
 
+const char * Memory::default_group_name (int index_group)
+{
+  static const char * name[num_memory_group] =
+    { "Cello", "Fields", "Particles", "Messages", "Solver", "Io",
+      "Migration", "FieldArena" };
+  return name[index_group];
+}
+
+//----------------------------------------------------------------------
+
 void * Memory::allocate ( size_t bytes )
 /// @param  bytes   Number of bytes to allocate
 /// @return        Pointer to the allocated memory
 {
 #ifdef CONFIG_USE_MEMORY
 
-  if (warning_mb_ != 0.0 && ( (bytes) >= (1e6)*warning_mb_)) {
+  if (warning_bytes_ != 0 && int64_t(bytes) >= warning_bytes_) {
     // WARNING: do not use WARNING since allocates memory, leading to
     //          recursive calls to overloaded operator new 
     CkPrintf ("%d WARNING: Allocating %ld bytes > %f MB\n",
-  	      CkMyPe(),bytes,warning_mb_);
+  	      CkMyPe(),bytes,1e-6*warning_bytes_);
   }
 
-  if (limit_gb_ != 0.0 && (bytes_curr_.size() > 0)  &&
-      ((bytes_curr_[0] + bytes) >= (1e9)*limit_gb_)) {
+  if (limit_bytes_ != 0 && (counters_.size() > 0)  &&
+      ((counters_[0].bytes + int64_t(bytes)) >= limit_bytes_)) {
     // WARNING: do not use ERROR or ASSERT since allocates memory, leading to
     //          recursive calls to overloaded operator new 
     CkPrintf ("%d ERROR: Cannot allocate %ld bytes: limit is %f GB\n",
-	      CkMyPe(), (bytes_curr_[0] + bytes),limit_gb_);
+	      CkMyPe(), long(counters_[0].bytes + bytes),1e-9*limit_bytes_);
     void * array[10];
     size_t size = backtrace(array,10);
     backtrace_symbols_fd(array,size,STDERR_FILENO);
     CmiAbort("MEMORY ALLOCATION ERROR");
   }
 
-  int * buffer = (int *)(std::malloc(bytes + 2*sizeof(int)));
+  int64_t * buffer = (int64_t *)(std::malloc(bytes + MEMORY_HEADER_BYTES));
 
   ASSERT("Memory::allocate",
 	 "Cannot allocate buffer: out of memory",
@@ -78,18 +95,12 @@ void * Memory::allocate ( size_t bytes )
       memset (&buffer[2],fill_new_,bytes);
     }
 
-    ++ new_calls_[0] ;
-    bytes_curr_[0] += bytes;
-    bytes_high_[0]    = MAX(bytes_high_[0],   bytes_curr_[0]);
-    bytes_highest_[0] = MAX(bytes_highest_[0],bytes_curr_[0]);
+    ++ size_class_new_[size_class(bytes)];
+
+    count_new_(counters_[0],bytes);
 
     if (index_group_ != 0) {
-      ++ new_calls_[index_group_] ;
-      bytes_curr_[index_group_] += bytes;
-      bytes_high_[index_group_]    = MAX(bytes_high_[index_group_],
-					 bytes_curr_[index_group_]);
-      bytes_highest_[index_group_] = MAX(bytes_highest_[index_group_],
-					 bytes_curr_[index_group_]);
+      count_new_(counters_[index_group_],bytes);
     }
 
   } else {
@@ -108,21 +119,20 @@ void Memory::deallocate ( void * pointer )
 {
 #ifdef CONFIG_USE_MEMORY
 
-  int *buffer = (int *)(pointer) - 2;
-
+  int64_t *buffer = (int64_t *)(pointer) - 2;
 
   if (is_active_) {
 
-    int bytes = buffer[0];
+    const int64_t bytes = buffer[0];
 
-    ++ delete_calls_[0] ;
-    bytes_curr_[0] -= bytes;
+    ++ counters_[0].num_delete;
+    counters_[0].bytes -= bytes;
 
-    int index_group = buffer[1];
+    const int index_group = buffer[1];
 
     if (index_group != 0) {
-      ++ delete_calls_[index_group] ;
-      bytes_curr_[index_group] -= bytes;
+      ++ counters_[index_group].num_delete;
+      counters_[index_group].bytes -= bytes;
     }
 
     if (fill_delete_) {
@@ -144,12 +154,8 @@ void Memory::new_group ( std::string group_name )
 #ifdef CONFIG_USE_MEMORY
 
   group_name_.push_back(group_name);
-  bytes_limit_  .push_back(0);
-  bytes_curr_   .push_back(0);
-  bytes_high_   .push_back(0);
-  bytes_highest_.push_back(0);
-  new_calls_    .push_back(0);
-  delete_calls_ .push_back(0);
+  bytes_limit_.push_back(0);
+  counters_   .push_back(MemoryCounters());
   
 #endif
 }
@@ -159,7 +165,7 @@ void Memory::new_group ( std::string group_name )
 int64_t Memory::bytes ( std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
-  return bytes_curr_[index_group(group_name)];
+  return counters_[index_group(group_name)].bytes;
 #else
   return 0;
 #endif
@@ -172,7 +178,7 @@ int64_t Memory::bytes_available ( std::string group_name )
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
   if (bytes_limit_[index_group] != 0) {
-    return bytes_limit_[index_group] - bytes_curr_[index_group];
+    return bytes_limit_[index_group] - counters_[index_group].bytes;
   } else {
     return 0;
   }
@@ -188,7 +194,7 @@ float Memory::efficiency ( std::string group_name )
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
   if (bytes_limit_[index_group] != 0) {
-    return (float) bytes_curr_[index_group] / bytes_limit_[index_group];
+    return (float) counters_[index_group].bytes / bytes_limit_[index_group];
   } else {
     return 0.0;
   }
@@ -204,8 +210,8 @@ int64_t Memory::bytes_high ( std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
-  TRACE1("bytes_high = %lld",bytes_high_[index_group]);
-  return bytes_high_[index_group];
+  TRACE1("bytes_high = %lld",counters_[index_group].bytes_high);
+  return counters_[index_group].bytes_high;
 #else
   return 0;
 #endif
@@ -217,8 +223,8 @@ int64_t Memory::bytes_highest ( std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
   int index_group = this->index_group(group_name);
-  TRACE1("bytes_highest = %lld",bytes_highest_[index_group]);
-  return bytes_highest_[index_group];
+  TRACE1("bytes_highest = %lld",counters_[index_group].bytes_highest);
+  return counters_[index_group].bytes_highest;
 #else
   return 0;
 #endif
@@ -250,7 +256,7 @@ int64_t Memory::bytes_limit ( std::string group_name )
 int Memory::num_new ( std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
-  return new_calls_[index_group(group_name)];
+  return counters_[index_group(group_name)].num_new;
 #else
   return 0;
 #endif
@@ -261,7 +267,7 @@ int Memory::num_new ( std::string group_name )
 int Memory::num_delete ( std::string group_name )
 {
 #ifdef CONFIG_USE_MEMORY
-  return delete_calls_[index_group(group_name)];
+  return counters_[index_group(group_name)].num_delete;
 #else
   return 0;
 #endif
@@ -276,12 +282,22 @@ void Memory::print ()
     Monitor * monitor = Monitor::instance();
     if (i == 0 || group_name_[i] != "") {
       monitor->print ("Memory","Group %s",i ? group_name_[i].c_str(): "Total");
-      monitor->print ("Memory","  bytes         = %ld",long(bytes_curr_[i]));
-      monitor->print ("Memory","  bytes_high    = %ld",long(bytes_high_[i]));
-      monitor->print ("Memory","  bytes_highest = %ld",long(bytes_highest_[i]));
+      const MemoryCounters & counters = counters_[i];
+      monitor->print ("Memory","  bytes         = %ld",long(counters.bytes));
+      monitor->print ("Memory","  bytes_high    = %ld",long(counters.bytes_high));
+      monitor->print ("Memory","  bytes_highest = %ld",long(counters.bytes_highest));
       monitor->print ("Memory","  bytes_limit   = %ld",long(bytes_limit_[i]));
-      monitor->print ("Memory","  new_calls     = %ld",long(new_calls_[i]));
-      monitor->print ("Memory","  delete_calls  = %ld",long(delete_calls_[i]));
+      monitor->print ("Memory","  new_calls     = %ld",long(counters.num_new));
+      monitor->print ("Memory","  delete_calls  = %ld",long(counters.num_delete));
+    }
+  }
+  // allocation counts by size class: [2^(k-1),2^k) bytes
+  for (int k=0; k<MEMORY_NUM_SIZE_CLASS; k++) {
+    if (size_class_new_[k] > 0) {
+      Monitor::instance()->print
+        ("Memory","  new_calls < %ld bytes = %ld",
+         (k < MEMORY_NUM_SIZE_CLASS - 1) ? (1L << k) : -1L,
+         long(size_class_new_[k]));
     }
   }
 #endif
@@ -294,12 +310,11 @@ void Memory::reset()
 #ifdef CONFIG_USE_MEMORY
   index_group_ = 0;
 
-  for (size_t i=0; i<bytes_curr_.size(); i++) {
-    bytes_curr_    [i] = 0;
-    bytes_high_    [i] = 0;
-    bytes_highest_ [i] = 0;
-    new_calls_     [i] = 0;
-    delete_calls_  [i] = 0;
+  for (size_t i=0; i<counters_.size(); i++) {
+    counters_[i] = MemoryCounters();
+  }
+  for (int k=0; k<MEMORY_NUM_SIZE_CLASS; k++) {
+    size_class_new_[k] = 0;
   }
 #endif
 }
@@ -310,9 +325,10 @@ void Memory::reset_high()
 {
 #ifdef CONFIG_USE_MEMORY
   TRACE("reset_high");
-  for (size_t i=0; i<bytes_high_.size(); i++) {
-    bytes_high_ [i] = bytes_curr_[i];
+  for (size_t i=0; i<counters_.size(); i++) {
+    counters_[i].bytes_high = counters_[i].bytes;
   }
+  block_bytes_high_ = 0;
 #endif
 }
 
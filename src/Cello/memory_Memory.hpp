@@ -9,6 +9,47 @@
 #ifndef MEMORY_MEMORY_HPP
 #define MEMORY_MEMORY_HPP
 
+/// @enum     memory_group_enum
+/// @brief    Memory groups defined on all processes, in order, so that
+///           their indices agree for reductions
+enum memory_group_enum {
+  memory_group_cello,
+  memory_group_fields,
+  memory_group_particles,
+  memory_group_messages,
+  memory_group_solver,
+  memory_group_io,
+  memory_group_migration,
+  memory_group_field_arena,
+  num_memory_group
+};
+
+/// Number of power-of-two allocation size classes counted: class k
+/// holds allocations of [2^(k-1),2^k) bytes, and the last class all
+/// larger ones
+#define MEMORY_NUM_SIZE_CLASS 40
+
+/// Bytes of the header before each allocation, holding its size and
+/// group; a multiple of 16 to keep the alignment of std::malloc()
+#define MEMORY_HEADER_BYTES 16
+
+/// @struct   MemoryCounters
+/// @brief    [\ref Memory] Allocation counters of one memory group,
+///           kept together so that allocate() touches one cache line
+///           per group
+struct MemoryCounters {
+  /// Current bytes allocated
+  int64_t bytes;
+  /// Intervaled high-water bytes allocated
+  int64_t bytes_high;
+  /// High-water bytes allocated
+  int64_t bytes_highest;
+  /// Number of calls to new
+  int64_t num_new;
+  /// Number of calls to delete
+  int64_t num_delete;
+};
+
 class Memory {
 
   /// @class    Memory
@@ -32,8 +73,9 @@ private: // interface
   Memory()
 #ifdef CONFIG_USE_MEMORY
   : is_active_(false),
-    warning_mb_(0.0),
-    limit_gb_ (0.0)
+    warning_bytes_(0),
+    limit_bytes_ (0),
+    block_bytes_high_(0)
 #endif
   { initialize_(); }
 
@@ -98,6 +140,57 @@ public: // interface
   std::string group () const 
   { return group_name_[index_group_]; }
 
+  /// Return the index of the current group
+  int current_index_group () const
+  { return index_group_; }
+
+  /// Begin allocating memory associated with the given group index
+  void set_index_group (int index_group)
+  { index_group_ = index_group; }
+
+  /// Count bytes mapped (bytes > 0) or unmapped (bytes < 0) directly
+  /// from the operating system in the given group
+  void count_mapped (int index_group, int64_t bytes)
+  {
+#ifdef CONFIG_USE_MEMORY
+    if (! is_active_) return;
+    if (bytes >= 0) {
+      ++ size_class_new_[size_class(bytes)];
+      count_new_(counters_[0],bytes);
+      if (index_group != 0) count_new_(counters_[index_group],bytes);
+    } else {
+      ++ counters_[0].num_delete;
+      counters_[0].bytes += bytes;
+      if (index_group != 0) {
+        ++ counters_[index_group].num_delete;
+        counters_[index_group].bytes += bytes;
+      }
+    }
+#endif
+  }
+
+  /// Name of the given memory_group_enum group
+  static const char * default_group_name (int index_group);
+
+  /// Record the bytes allocated by a Block, keeping the maximum
+  /// since reset_high()
+  void update_block_bytes (int64_t bytes)
+  {
+#ifdef CONFIG_USE_MEMORY
+    block_bytes_high_ = std::max(block_bytes_high_,bytes);
+#endif
+  }
+
+  /// Maximum bytes allocated by a single Block since reset_high()
+  int64_t block_bytes_high () const
+  {
+#ifdef CONFIG_USE_MEMORY
+    return block_bytes_high_;
+#else
+    return 0;
+#endif
+  }
+
   /// Current number of bytes allocated
   int64_t bytes ( std::string group = "" );
   
@@ -171,17 +264,35 @@ public: // interface
   void set_warning_mb (float value)
   { 
 #ifdef CONFIG_USE_MEMORY
-    warning_mb_ = value; 
+    warning_bytes_ = int64_t(1e6*value);
 #endif
 }
 
   void set_limit_gb (float value)
   {
 #ifdef CONFIG_USE_MEMORY
-  limit_gb_ = value;
+  limit_bytes_ = int64_t(1e9*value);
 #endif
  }
 
+  /// Number of calls to allocate in the given size class since reset()
+  int64_t num_new_size_class (int size_class) const
+  {
+#ifdef CONFIG_USE_MEMORY
+    return size_class_new_[size_class];
+#else
+    return 0;
+#endif
+  }
+
+  /// Size class of an allocation of the given number of bytes
+  static int size_class (size_t bytes)
+  {
+    // number of significant bits of bytes
+    const int k = (bytes == 0) ? 0 : 64 - __builtin_clzll(bytes);
+    return std::min(k, MEMORY_NUM_SIZE_CLASS - 1);
+  }
+
   //======================================================================
 
 private: // functions
@@ -189,6 +300,20 @@ private: // functions
   /// Initialize the memory component
   void initialize_();
 
+#ifdef CONFIG_USE_MEMORY
+  /// Count an allocation of the given size in the given group
+  static void count_new_ (MemoryCounters & counters, int64_t bytes)
+  {
+    ++ counters.num_new;
+    counters.bytes += bytes;
+    if (counters.bytes > counters.bytes_high) {
+      counters.bytes_high = counters.bytes;
+      if (counters.bytes > counters.bytes_highest)
+        counters.bytes_highest = counters.bytes;
+    }
+  }
+#endif
+
   //======================================================================
 
 private: // attributes
@@ -212,26 +337,21 @@ private: // attributes
   /// Limit on number of bytes to allocate
   std::vector<int64_t> bytes_limit_;
 
-  /// Current bytes allocated for different groups
-  std::vector<int64_t> bytes_curr_;
+  /// Allocation counters for different groups
+  std::vector<MemoryCounters> counters_;
 
-  /// Intervaled high-water bytes allocated for different groups
-  std::vector<int64_t> bytes_high_;
+  /// Number of calls to new in each size class
+  int64_t size_class_new_[MEMORY_NUM_SIZE_CLASS];
 
-  /// High-water bytes allocated for different groups
-  std::vector<int64_t> bytes_highest_;
+  /// Limit on single memory allocation to display warning, or 0
+  int64_t warning_bytes_;
 
-  /// Number of calls to new for different groups
-  std::vector<int64_t> new_calls_;
+  /// Limit on total memory allocated before error (to prevent
+  /// crashing machine), or 0
+  int64_t limit_bytes_;
 
-  /// Number of calls to delete for different groups
-  std::vector<int64_t> delete_calls_;
-
-  /// Limit on single memory allocation to display warning
-  float  warning_mb_;
-
-  /// Limit on total memory allocated before error (to prevent crashing machine)
-  float  limit_gb_;
+  /// Maximum bytes of a single Block since reset_high()
+  int64_t block_bytes_high_;
 
 #endif
 
@@ -243,4 +363,42 @@ private: // attributes
 
 };
 
+//----------------------------------------------------------------------
+
+class MemoryGroup {
+
+  /// @class    MemoryGroup
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Count allocations within the enclosing
+  /// scope in the given memory_group_enum group
+  ///
+  /// The previous group is restored when the scope ends, so scopes
+  /// may nest, with the innermost group taking precedence.
+  /// Deallocations are always counted in the group of the allocation.
+
+public: // interface
+
+  MemoryGroup (int index_group)
+#ifdef CONFIG_USE_MEMORY
+    : index_group_prev_(Memory::instance()->current_index_group())
+  { Memory::instance()->set_index_group(index_group); }
+#else
+  { }
+#endif
+
+  ~MemoryGroup()
+  {
+#ifdef CONFIG_USE_MEMORY
+    Memory::instance()->set_index_group(index_group_prev_);
+#endif
+  }
+
+private: // attributes
+
+#ifdef CONFIG_USE_MEMORY
+  /// Group to restore at the end of the scope
+  int index_group_prev_;
+#endif
+};
+
 #endif /* MEMORY_MEMORY_HPP */
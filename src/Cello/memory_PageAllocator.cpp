@@ -0,0 +1,104 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_PageAllocator.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    Implementation of the PageMemory class
+
+#include "cello.hpp"
+#include "memory.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+//----------------------------------------------------------------------
+
+int PageMemory::huge_pages_ = memory_huge_none;
+
+//----------------------------------------------------------------------
+
+void * PageMemory::allocate (size_t bytes, int index_group)
+{
+  if (bytes < MEMORY_PAGE_MIN_BYTES) {
+    MemoryGroup memory_group (index_group);
+    return ::operator new (bytes);
+  }
+
+  const size_t size = mapped_bytes_(bytes);
+  void * pointer = MAP_FAILED;
+
+#ifdef MAP_HUGETLB
+  if (huge_pages_ == memory_huge_explicit && size >= MEMORY_HUGE_PAGE_BYTES) {
+    // fails unless huge pages are reserved, e.g. vm.nr_hugepages
+    pointer = mmap (nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  }
+#endif
+
+  if (pointer == MAP_FAILED && size >= MEMORY_HUGE_PAGE_BYTES &&
+      huge_pages_ != memory_huge_none) {
+
+    // over-map by one huge page and unmap the ends to align the
+    // array to a huge page boundary
+    const size_t align = MEMORY_HUGE_PAGE_BYTES;
+    char * base = (char *) mmap (nullptr, size + align, PROT_READ | PROT_WRITE,
+                                 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base != MAP_FAILED) {
+      char * start = (char *)((((uintptr_t)base + align - 1)/align)*align);
+      if (start > base) munmap (base, start - base);
+      munmap (start + size, base + align - start);
+#ifdef MADV_HUGEPAGE
+      madvise (start, size, MADV_HUGEPAGE);
+#endif
+      pointer = start;
+    }
+  }
+
+  if (pointer == MAP_FAILED) {
+    pointer = mmap (nullptr, size, PROT_READ | PROT_WRITE,
+                    MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  }
+
+  ASSERT1 ("PageMemory::allocate()",
+           "Cannot map %ld bytes: out of memory",
+           long(size),
+           pointer != MAP_FAILED);
+
+  Memory * memory = Memory::instance();
+  if (memory) memory->count_mapped (index_group, bytes);
+
+  return pointer;
+}
+
+//----------------------------------------------------------------------
+
+void PageMemory::deallocate (void * pointer, size_t bytes, int index_group)
+{
+  if (pointer == nullptr) return;
+
+  if (bytes < MEMORY_PAGE_MIN_BYTES) {
+    ::operator delete (pointer);
+    return;
+  }
+
+  const size_t size = mapped_bytes_(bytes);
+  munmap (pointer, size);
+
+  Memory * memory = Memory::instance();
+  if (memory) memory->count_mapped (index_group, -int64_t(bytes));
+}
+
+//----------------------------------------------------------------------
+
+size_t PageMemory::mapped_bytes_ (size_t bytes)
+{
+  // round up to whole huge pages if large enough to use them, else
+  // to whole pages; independent of the huge page mode so that it
+  // agrees for allocate() and deallocate().  Pages past the array
+  // are never touched, so use no physical memory
+
+  static const size_t page_bytes = sysconf(_SC_PAGESIZE);
+  const size_t align = (bytes >= MEMORY_HUGE_PAGE_BYTES) ?
+    MEMORY_HUGE_PAGE_BYTES : page_bytes;
+  return ((bytes + align - 1) / align) * align;
+}
@@ -0,0 +1,110 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     memory_PageAllocator.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Memory] Declaration of the PageMemory class and
+///           PageAllocator template
+
+#ifndef MEMORY_PAGE_ALLOCATOR_HPP
+#define MEMORY_PAGE_ALLOCATOR_HPP
+
+/// Allocations at least this large are mapped directly from the
+/// operating system; smaller ones use operator new
+#define MEMORY_PAGE_MIN_BYTES (64*1024)
+
+/// Size of huge pages in bytes
+#define MEMORY_HUGE_PAGE_BYTES (2*1024*1024)
+
+/// @enum     memory_huge_enum
+/// @brief    Whether and how large page-mapped arrays use huge pages
+enum memory_huge_enum {
+  memory_huge_none,
+  memory_huge_transparent,
+  memory_huge_explicit
+};
+
+class PageMemory {
+
+  /// @class    PageMemory
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Allocate large arrays as freshly mapped pages
+  ///
+  /// Physical pages of an anonymous mapping are placed on the NUMA
+  /// domain of the thread that first touches them.  Since large
+  /// arrays are mapped afresh rather than reusing heap memory that
+  /// another process may have touched, Block arrays allocated (or
+  /// unpacked after migration) on a process are local to its
+  /// domain.  Arrays at least MEMORY_HUGE_PAGE_BYTES large may also
+  /// be backed by transparent huge pages, aligned to the huge page
+  /// size and advised with MADV_HUGEPAGE, or by explicit huge pages
+  /// using MAP_HUGETLB, falling back to transparent huge pages if
+  /// none are reserved.  Mapped bytes are counted in the given
+  /// memory_group_enum group.
+
+public: // interface
+
+  /// Set the memory_huge_enum huge page mode
+  static void set_huge_pages (int huge_pages)
+  { huge_pages_ = huge_pages; }
+
+  /// Return the memory_huge_enum huge page mode
+  static int huge_pages ()
+  { return huge_pages_; }
+
+  /// Allocate the given number of bytes
+  static void * allocate (size_t bytes, int index_group);
+
+  /// Deallocate memory returned by allocate() for the same number of
+  /// bytes and group
+  static void deallocate (void * pointer, size_t bytes, int index_group);
+
+private: // functions
+
+  /// Size of the mapping holding the given number of bytes
+  static size_t mapped_bytes_ (size_t bytes);
+
+private: // attributes
+
+  /// memory_huge_enum huge page mode, the same on all processes
+  static int huge_pages_;
+};
+
+//----------------------------------------------------------------------
+
+template <class T, int GROUP>
+class PageAllocator {
+
+  /// @class    PageAllocator
+  /// @ingroup  Memory
+  /// @brief    [\ref Memory] Standard allocator using PageMemory in
+  ///           the memory_group_enum group GROUP
+
+public: // interface
+
+  typedef T value_type;
+
+  template <class U>
+  struct rebind { typedef PageAllocator<U,GROUP> other; };
+
+  PageAllocator() noexcept { }
+
+  template <class U>
+  PageAllocator (const PageAllocator<U,GROUP> &) noexcept { }
+
+  T * allocate (size_t n)
+  { return (T *) PageMemory::allocate(n*sizeof(T),GROUP); }
+
+  void deallocate (T * pointer, size_t n)
+  { PageMemory::deallocate(pointer,n*sizeof(T),GROUP); }
+
+  template <class U>
+  bool operator == (const PageAllocator<U,GROUP> &) const noexcept
+  { return true; }
+
+  template <class U>
+  bool operator != (const PageAllocator<U,GROUP> &) const noexcept
+  { return false; }
+};
+
+#endif /* MEMORY_PAGE_ALLOCATOR_HPP */
@@ -34,6 +34,15 @@ bool Adapt::insert_neighbor (Index index, bool is_sibling)
 
     LevelInfo neighbor { index, level, level-1, level+1, is_sibling, false };
     neighbor_list_.push_back(neighbor);
+
+    // keep the hash table at most half full
+    if (2*neighbor_list_.size() > neighbor_hash_.size()) {
+      neighbor_hash_.clear();
+    } else {
+      int k = hash_slot_(index);
+      while (neighbor_hash_[k] >= 0) k = (k + 1) & (neighbor_hash_.size() - 1);
+      neighbor_hash_[k] = neighbor_list_.size() - 1;
+    }
   }
 
   return (! found);
@@ -208,8 +217,8 @@ void Adapt::update_neighbor
 {
   LevelInfo * neighbor = neighbor_(index);
   if (neighbor) {
-    neighbor->level_min_ = std::max(neighbor->level_min_,level_min);
-    neighbor->level_max_ = std::min(neighbor->level_max_,level_max);
+    neighbor->level_min_ = std::max<int>(neighbor->level_min_,level_min);
+    neighbor->level_max_ = std::min<int>(neighbor->level_max_,level_max);
     neighbor->can_coarsen_ = neighbor->can_coarsen_ || can_coarsen;
   }
 }
@@ -231,7 +240,7 @@ bool Adapt::update_bounds()
   }
   int neighbor_max = min_level_;
   for (int i=0; i<n; i++) {
-    neighbor_max = std::max(neighbor_max,neighbor_list_[i].level_max_);
+    neighbor_max = std::max<int>(neighbor_max,neighbor_list_[i].level_max_);
   }
 
   level_max_new = std::max(level_min_new,neighbor_max-1);
@@ -241,7 +250,7 @@ bool Adapt::update_bounds()
   // Reset level_max to >= level_now pending checking all sibling can
   // coarsen
   self_.level_min_ = level_min_new;
-  self_.level_max_ = std::max(level_max_new,self_.level_now_);
+  self_.level_max_ = std::max<int>(level_max_new,self_.level_now_);
 
   // adjust for coarsening: can only coarsen if all siblings can coarsen
 
@@ -322,13 +331,12 @@ void Adapt::get_level_bounds
 void Adapt::get_neighbor_level_bounds
 (Index index, int * level_min, int * level_max, bool * can_coarsen) const
 {
-  for (int i=0; i<num_neighbors(); i++) {
+  const int i = find_neighbor_(index);
+  if (i >= 0) {
     auto & neighbor = neighbor_list_[i];
-    if (index == neighbor_list_[i].index_) {
-      (*level_min)   = neighbor.level_min_;
-      (*level_max)   = neighbor.level_max_;
-      (*can_coarsen) = neighbor.can_coarsen_;
-    }
+    (*level_min)   = neighbor.level_min_;
+    (*level_max)   = neighbor.level_max_;
+    (*can_coarsen) = neighbor.can_coarsen_;
   }
 }
 
@@ -434,9 +442,9 @@ int Adapt::data_size () const
 {
   int size = 0;
 
-  SIZE_VECTOR_TYPE(size,int,face_level_[0]);
-  SIZE_VECTOR_TYPE(size,int,face_level_[1]);
-  SIZE_VECTOR_TYPE(size,int,face_level_[2]);
+  SIZE_VECTOR_TYPE(size,face_level_type,face_level_[0]);
+  SIZE_VECTOR_TYPE(size,face_level_type,face_level_[1]);
+  SIZE_VECTOR_TYPE(size,face_level_type,face_level_[2]);
 
   SIZE_SCALAR_TYPE(size,bool,valid_);
   SIZE_SCALAR_TYPE(size,int,rank_);
@@ -455,9 +463,9 @@ char * Adapt::save_data (char * buffer) const
 {
   char * pc = buffer;
 
-  SAVE_VECTOR_TYPE(pc,int,face_level_[0]);
-  SAVE_VECTOR_TYPE(pc,int,face_level_[1]);
-  SAVE_VECTOR_TYPE(pc,int,face_level_[2]);
+  SAVE_VECTOR_TYPE(pc,face_level_type,face_level_[0]);
+  SAVE_VECTOR_TYPE(pc,face_level_type,face_level_[1]);
+  SAVE_VECTOR_TYPE(pc,face_level_type,face_level_[2]);
 
   SAVE_SCALAR_TYPE(pc,bool,valid_);
   SAVE_SCALAR_TYPE(pc,int,rank_);
@@ -476,9 +484,9 @@ char * Adapt::load_data (char * buffer)
 {
   char * pc = buffer;
 
-  LOAD_VECTOR_TYPE(pc,int,face_level_[0]);
-  LOAD_VECTOR_TYPE(pc,int,face_level_[1]);
-  LOAD_VECTOR_TYPE(pc,int,face_level_[2]);
+  LOAD_VECTOR_TYPE(pc,face_level_type,face_level_[0]);
+  LOAD_VECTOR_TYPE(pc,face_level_type,face_level_[1]);
+  LOAD_VECTOR_TYPE(pc,face_level_type,face_level_[2]);
 
   LOAD_SCALAR_TYPE(pc,bool,valid_);
   LOAD_SCALAR_TYPE(pc,int,rank_);
@@ -487,6 +495,7 @@ char * Adapt::load_data (char * buffer)
   LOAD_SCALAR_TYPE(pc,int,max_level_);
   LOAD_SCALAR_TYPE(pc,LevelInfo,self_);
   LOAD_VECTOR_TYPE(pc,LevelInfo,neighbor_list_);
+  neighbor_hash_.clear();
 
   return pc;
 }
@@ -495,16 +504,44 @@ char * Adapt::load_data (char * buffer)
 
 bool Adapt::is_neighbor (Index index, int * ip) const
 {
-  // Search for index
-  int i;
-  const int n = neighbor_list_.size();
-  for (i=0; i<n; i++) {
-    if (neighbor_list_[i].index_==index) break;
+  const int i = find_neighbor_(index);
+  // return index if used, or one past the last index if not
+  if (ip) (*ip) = (i >= 0) ? i : neighbor_list_.size();
+
+  return (i >= 0);
+}
+
+//----------------------------------------------------------------------
+
+int Adapt::find_neighbor_ (Index index) const
+{
+  if (neighbor_list_.empty()) return -1;
+  if (neighbor_hash_.empty()) hash_neighbors_();
+
+  const int mask = neighbor_hash_.size() - 1;
+  for (int k = hash_slot_(index); neighbor_hash_[k] >= 0; k = (k + 1) & mask) {
+    const int i = neighbor_hash_[k];
+    if (neighbor_list_[i].index_ == index) return i;
   }
-  // return index if used
-  if (ip) (*ip) = i;
+  return -1;
+}
+
+//----------------------------------------------------------------------
 
-  return (i < n);
+void Adapt::hash_neighbors_ () const
+{
+  // power of two at least twice the number of neighbors
+  const int n = neighbor_list_.size();
+  int size = 16;
+  while (size < 2*n) size *= 2;
+  neighbor_hash_.assign(size,-1);
+
+  const int mask = size - 1;
+  for (int i=0; i<n; i++) {
+    int k = hash_slot_(neighbor_list_[i].index_);
+    while (neighbor_hash_[k] >= 0) k = (k + 1) & mask;
+    neighbor_hash_[k] = i;
+  }
 }
 
 //----------------------------------------------------------------------
@@ -518,6 +555,8 @@ void Adapt::delete_neighbor_ (int i)
   }
   // ... and resize
   neighbor_list_.resize(n-1);
+  // positions changed
+  neighbor_hash_.clear();
 }
 
 //----------------------------------------------------------------------
@@ -537,5 +576,6 @@ void Adapt::copy_ (const Adapt & adapt)
   max_level_ =     adapt.max_level_;
   self_ =          adapt.self_;
   neighbor_list_ = adapt.neighbor_list_;
+  neighbor_hash_ = adapt.neighbor_hash_;
 }
 
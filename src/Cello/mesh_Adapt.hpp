@@ -30,9 +30,9 @@ public: // interface
       p | can_coarsen_;
     }
     Index index_;
-    int level_now_;
-    int level_min_;
-    int level_max_;
+    face_level_type level_now_;
+    face_level_type level_min_;
+    face_level_type level_max_;
     bool is_sibling_;
     bool can_coarsen_;
   };
@@ -42,7 +42,10 @@ public: // interface
     : valid_(false),
       rank_(0),
       min_level_(0),
-      max_level_(0)
+      max_level_(0),
+      self_(),
+      neighbor_list_(),
+      neighbor_hash_()
   {
     face_level_[0].resize(27);
     face_level_[1].resize(27);
@@ -64,6 +67,7 @@ public: // interface
     p | max_level_;
     p | self_;
     p | neighbor_list_;
+    if (p.isUnpacking()) neighbor_hash_.clear();
 
   }
 
@@ -128,7 +132,7 @@ public: // interface
   size_t size_face_level(LevelType level_type)
   { return face_level_[int(level_type)].size(); }
 
-  std::vector<int> & vector_face_level(LevelType level_type)
+  std::vector<face_level_type> & vector_face_level(LevelType level_type)
   { return face_level_[int(level_type)]; }
 
   void update_curr_from_next ()
@@ -299,12 +303,24 @@ private: // methods
 
   LevelInfo * neighbor_ (Index index)
   {
-    const int n = neighbor_list_.size();
-    for (int i=0; i<n; i++) {
-      if (neighbor_list_[i].index_ == index)
-        return &neighbor_list_[i];
-    }
-    return nullptr;
+    const int i = find_neighbor_(index);
+    return (i >= 0) ? &neighbor_list_[i] : nullptr;
+  }
+
+  /// Return the position of index in neighbor_list_, or -1 if absent
+  int find_neighbor_ (Index index) const;
+
+  /// Rebuild neighbor_hash_ from neighbor_list_
+  void hash_neighbors_ () const;
+
+  /// Hash table slot at which to start searching for index
+  int hash_slot_ (Index index) const
+  {
+    const unsigned h =
+      unsigned(index[0])*0x9e3779b1u ^
+      unsigned(index[1])*0x85ebca77u ^
+      unsigned(index[2])*0xc2b2ae3du;
+    return (h ^ (h >> 15)) & (neighbor_hash_.size() - 1);
   }
 
 
@@ -312,7 +328,7 @@ private: // attributes
 
   /// List of neighbor indices (and self)
   // NOTE: change pup() function whenever attributes change
-  std::vector<int> face_level_[3];
+  std::vector<face_level_type> face_level_[3];
 
   /// Whether this Adapt class is valid; used for resetting existing
   /// Adapt
@@ -330,6 +346,10 @@ private: // attributes
   /// Level bound information for neighboring blocks
   std::vector<LevelInfo> neighbor_list_;
 
+  /// Open-addressing hash table of positions in neighbor_list_, or -1
+  /// for empty slots; rebuilt when empty (not packed)
+  mutable std::vector<int> neighbor_hash_;
+
 };
 
 #endif /* MESH_ADAPT_HPP */
@@ -58,15 +58,30 @@ Block::Block ( process_type ip_source, MsgType msg_type )
     adapt_ready_(false),
     adapt_balanced_(false),
     adapt_changed_(0),
+    adapt_send_pending_(false),
+    adapt_num_sends_(0),
+    adapt_num_messages_(0),
+    adapt_decision_(adapt_unknown),
+    quiescent_count_(0),
+    quiescent_values_(),
+    refresh_coarse_cache_(),
     coarsened_(false),
     is_leaf_((thisIndex.level() >= 0)),
     age_(0),
     ip_next_(-1),
+    compute_time_(0.0),
+    compute_time_start_(-1.0),
+    balance_time_(0.0),
     name_(""),
     index_method_(-1),
+    index_method_side_(-1),
+    overlap_main_done_(false),
+    in_side_compute_(false),
+    side_compute_done_(false),
     index_solver_(),
     refresh_(),
-    index_(thisIndex)
+    index_(thisIndex),
+    cost_order_{0.0,0.0,0.0}
 {
 #ifdef TRACE_BLOCK
 
@@ -78,6 +93,8 @@ Block::Block ( process_type ip_source, MsgType msg_type )
 
   init_refresh_();
   usesAtSync = true;
+  // Balance:measure "compute" supplies loads through UserSetLBLoad()
+  usesAutoMeasure = (cello::config()->balance_measure != "compute");
 
   thisIndex.array(array_,array_+1,array_+2);
 
@@ -140,6 +157,12 @@ void Block::init_refine_
   adapt_ready_ = false;
   adapt_balanced_ = false;
   adapt_changed_ = 0;
+  adapt_send_pending_ = false;
+  adapt_num_sends_ = 0;
+  adapt_num_messages_ = 0;
+  adapt_decision_ = adapt_unknown;
+  quiescent_count_ = 0;
+  quiescent_values_.clear();
 
   // Enable Charm++ AtSync() dynamic load balancing
 
@@ -282,6 +305,8 @@ void Block::pup(PUP::er &p)
 {
   TRACEPUP;
 
+  MemoryGroup memory_group (memory_group_migration);
+
   CBase_Block::pup(p);
 
   bool up = p.isUnpacking();
@@ -321,13 +346,26 @@ void Block::pup(PUP::er &p)
   p | adapt_ready_;
   p | adapt_balanced_;
   p | adapt_changed_;
+  p | adapt_send_pending_;
+  p | adapt_num_sends_;
+  p | adapt_num_messages_;
+  p | adapt_decision_;
+  p | quiescent_count_;
+  p | quiescent_values_;
+  // refresh_coarse_cache_ is rebuilt after migration
   // std::vector < MsgAdapt * > adapt_msg_list_;
   p | coarsened_;
   p | is_leaf_;
   p | age_;
   p | ip_next_;
+  p | compute_time_;
+  // SKIP compute_time_start_: not in a region between entry methods
+  p | balance_time_;
   p | name_;
   p | index_method_;
+  p | index_method_side_;
+  p | overlap_main_done_;
+  // SKIP in_side_compute_, side_compute_done_: only set within compute()
   p | index_solver_;
   p | refresh_;
   // SKIP method_: initialized when needed
@@ -347,6 +385,7 @@ void Block::pup(PUP::er &p)
 
   p | index_order_;
   p | count_order_;
+  PUParray(p,cost_order_,3);
 }
 
 //----------------------------------------------------------------------
@@ -478,43 +517,61 @@ void Block::compute_derived(const std::vector< std::string>& field_list
 {
   TRACE("Block::compute_derived()");
 
-  // compute all derived fields on this block
-
   Field field = data()->field();
 
   int nderived = field.groups()->size("derived");
 
   if (nderived > 0){
 
-    Problem * problem = cello::problem();
-    Config   * config  = (Config *) cello::config();
+    // derived fields in field_list, or all derived fields if empty
 
-    // this is not a good way of doing this...
-    //   should contruct list of fields from full list
-    //   rather than copying this loop twice...
+    std::vector<std::string> derived_list;
     if (field_list.size() > 0){
       for (size_t i = 0; i < field_list.size(); i++){
-        std::string name = field_list[i];
-        if (field.groups()->is_in(name,"derived")){
-          Compute * compute = problem->create_compute(name,
-                                                      config);
-          compute->compute(this);
-          delete compute; // must be done
+        if (field.groups()->is_in(field_list[i],"derived")){
+          derived_list.push_back(field_list[i]);
         }
       }
-    } else{ // else check full field list and compute all
-      // derived fields
-      for(int i = 0; i < field.field_count(); i++){
+    } else {
+      for (int i = 0; i < field.field_count(); i++){
         std::string name = field.field_name(i);
         if (field.groups()->is_in(name,"derived")){
-          // call the appropriate compute object
-          Compute * compute = problem->create_compute(name,
-                                                      config);
-          compute->compute(this);
-          delete compute; // must be done
+          derived_list.push_back(name);
         }
       }
     }
+
+    Problem * problem = cello::problem();
+    Config   * config  = (Config *) cello::config();
+    FieldData * field_data = data()->field_data();
+
+    for (const std::string & name : derived_list) {
+
+      Compute * compute = problem->create_compute(name, config);
+
+      // default inputs: every field that is not derived
+
+      std::vector<int> input_list = compute->input_field_list();
+      if (input_list.empty()) {
+        for (int i = 0; i < field.field_count(); i++){
+          if (! field.groups()->is_in(field.field_name(i),"derived")) {
+            input_list.push_back(i);
+          }
+        }
+      }
+
+      // recompute only if an input or the derived field itself was
+      // modified, or the Block time changed, since it was last computed
+
+      const int id_derived = field.field_id(name);
+      if (! field_data->is_derived_current(id_derived,input_list,time_)) {
+        compute->compute(this);
+        field_data->set_modified(id_derived);
+        field_data->set_derived(id_derived,input_list,time_);
+      }
+
+      delete compute; // must be done
+    }
   } // end if derived
 
   return;
@@ -671,14 +728,29 @@ Block::Block ()
     adapt_ready_(false),
     adapt_balanced_(false),
     adapt_changed_(0),
+    adapt_send_pending_(false),
+    adapt_num_sends_(0),
+    adapt_num_messages_(0),
+    adapt_decision_(adapt_unknown),
+    quiescent_count_(0),
+    quiescent_values_(),
+    refresh_coarse_cache_(),
     coarsened_(false),
     is_leaf_((thisIndex.level() >= 0)),
     age_(0),
     ip_next_(-1),
+    compute_time_(0.0),
+    compute_time_start_(-1.0),
+    balance_time_(0.0),
     name_(""),
     index_method_(-1),
+    index_method_side_(-1),
+    overlap_main_done_(false),
+    in_side_compute_(false),
+    side_compute_done_(false),
     index_solver_(),
-    refresh_()
+    refresh_(),
+    cost_order_{0.0,0.0,0.0}
 {
   init_refresh_();
   init_adapt_(nullptr);
@@ -690,19 +762,27 @@ Block::Block ()
 
 void Block::init_adapt_(Adapt * adapt_parent)
 {
-  const int level = index_.level();
+  init_adapt_neighbors_(adapt_,index_,adapt_parent);
+}
+
+//----------------------------------------------------------------------
+
+void Block::init_adapt_neighbors_
+(Adapt & adapt, Index index, const Adapt * adapt_parent) const
+{
+  const int level = index.level();
   const int rank = cello::rank();
 
   int p3[3],b3[3];
   cello::hierarchy()->get_periodicity(p3,p3+1,p3+2);
   cello::hierarchy()->root_blocks(b3,b3+1,b3+2);
 
-  adapt_.set_rank(rank);
-  adapt_.set_min_level(cello::config()->mesh_min_level);
-  adapt_.set_max_level(cello::config()->mesh_max_level);
-  adapt_.set_index(index_);
-  adapt_.set_periodicity(p3);
-  adapt_.set_valid(true);
+  adapt.set_rank(rank);
+  adapt.set_min_level(cello::config()->mesh_min_level);
+  adapt.set_max_level(cello::config()->mesh_max_level);
+  adapt.set_index(index);
+  adapt.set_periodicity(p3);
+  adapt.set_valid(true);
 
   if ( (level <= 0) && cello::is_initial_cycle(cycle_,InitCycleKind::fresh) ) {
     // If root-level (or below) block in first simulation cycle,
@@ -710,7 +790,7 @@ void Block::init_adapt_(Adapt * adapt_parent)
     int nb3[3],np3[3],ib3[3];
     cello::hierarchy()->root_blocks(nb3,nb3+1,nb3+2);
     cello::hierarchy()->get_periodicity(np3,np3+1,np3+2);
-    index_.array(ib3,ib3+1,ib3+2);
+    index.array(ib3,ib3+1,ib3+2);
     // Initialize face index loop limits
     int ifm3[3],ifp3[3];
     for (int i=0; i<3; i++) {
@@ -734,8 +814,8 @@ void Block::init_adapt_(Adapt * adapt_parent)
       for (if3[1]=ifm3[1]; if3[1]<=ifp3[1]; ++if3[1]) {
         for (if3[0]=ifm3[0]; if3[0]<=ifp3[0]; ++if3[0]) {
           if (if3[0] || if3[1] || if3[2]) {
-            Index index_neighbor = index_.index_neighbor(if3,nb3);
-            adapt_.insert_neighbor(index_neighbor);
+            Index index_neighbor = index.index_neighbor(if3,nb3);
+            adapt.insert_neighbor(index_neighbor);
           }
         }
       }
@@ -745,13 +825,21 @@ void Block::init_adapt_(Adapt * adapt_parent)
     // else if a refined Block, initialize adapt from its incoming
     // parent block
     int ic3[3];
-    index_.child(level,ic3,ic3+1,ic3+2);
-    adapt_.refine(*adapt_parent,ic3);
+    index.child(level,ic3,ic3+1,ic3+2);
+    if (adapt_parent != nullptr) {
+      adapt.refine(*adapt_parent,ic3);
+    } else {
+      // parent inserted with Mesh:initial_bulk_insert: its
+      // neighbors are rebuilt here from the root Block down
+      Adapt adapt_ancestor;
+      init_adapt_neighbors_(adapt_ancestor,index.index_parent(),nullptr);
+      adapt.refine(adapt_ancestor,ic3);
+    }
 #ifdef DEBUG_ADAPT
     CkPrintf ("DEBUG_ADAPT %s Block() level > 0\n",
               name().c_str());
-    adapt_parent->print("init_adapt parent",this);
-    adapt_.print("init_adapt child after",this);
+    if (adapt_parent) adapt_parent->print("init_adapt parent",this);
+    adapt.print("init_adapt child after",this);
 #endif    
   }
 
@@ -759,12 +847,12 @@ void Block::init_adapt_(Adapt * adapt_parent)
   // during the initialization phase.
   int max_initial_level = cello::config()->mesh_max_initial_level;
   for (int level_i=level; level_i < max_initial_level; level_i++) {
-    std::vector<Index> neighbors = adapt_.index_neighbors();
+    std::vector<Index> neighbors = adapt.index_neighbors();
     for (int i=0; i<(int) neighbors.size(); i++) {
       Index neighbor_index = neighbors.at(i);
       if (neighbor_index.level() == level_i) {
         if (refine_during_initialization(neighbor_index))
-          adapt_.refine_neighbor(neighbor_index);
+          adapt.refine_neighbor(neighbor_index);
       }
     }
   }
@@ -1102,6 +1190,12 @@ void Block::copy_(const Block & block) throw()
   adapt_ready_ = block.adapt_ready_;
   adapt_balanced_ = block.adapt_balanced_;
   adapt_changed_ = block.adapt_changed_;
+  adapt_send_pending_ = block.adapt_send_pending_;
+  adapt_num_sends_ = block.adapt_num_sends_;
+  adapt_num_messages_ = block.adapt_num_messages_;
+  adapt_decision_ = block.adapt_decision_;
+  quiescent_count_ = block.quiescent_count_;
+  quiescent_values_ = block.quiescent_values_;
   coarsened_  = block.coarsened_;
 }
 
@@ -1130,6 +1224,9 @@ void Block::performance_start_
   Simulation * simulation = cello::simulation();
   if (simulation)
     simulation->performance()->start_region(index_region,file,line);
+  if (index_region == perf_compute && compute_time_start_ < 0.0) {
+    compute_time_start_ = CkWallTimer();
+  }
 }
 
 //----------------------------------------------------------------------
@@ -1140,6 +1237,83 @@ void Block::performance_stop_
   Simulation * simulation = cello::simulation();
   if (simulation)
     simulation->performance()->stop_region(index_region,file,line);
+  if (index_region == perf_compute && compute_time_start_ >= 0.0) {
+    const double time = CkWallTimer() - compute_time_start_;
+    compute_time_ += time;
+    balance_time_ += time;
+    compute_time_start_ = -1.0;
+  }
+}
+
+//----------------------------------------------------------------------
+
+long long Block::trace_start_() const
+{
+  Simulation * simulation = cello::simulation();
+  Performance * performance = simulation ? simulation->performance() : nullptr;
+  return (performance && performance->trace_active()) ?
+    performance->trace_time() : 0;
+}
+
+//----------------------------------------------------------------------
+
+void Block::trace_stop_
+(const std::string & region, long long time_start) const
+{
+  if (time_start == 0) return;
+  cello::simulation()->performance()->trace_complete
+    (region,name_,time_start);
+}
+
+//----------------------------------------------------------------------
+
+void Block::update_memory_bytes_() const
+{
+  Memory * memory = Memory::instance();
+  if (memory == nullptr || data_ == nullptr) return;
+  int64_t bytes = data_->particle_data()->bytes_allocated();
+  for (int i=0; i<data_->num_field_data(); i++) {
+    bytes += data_->field_data(i)->bytes_allocated();
+  }
+  memory->update_block_bytes(bytes);
+}
+
+//----------------------------------------------------------------------
+
+void Block::method_counters_start_() const
+{
+  Performance * performance = cello::simulation()->performance();
+  if (performance->method_counters_active()) {
+    performance->method_counters_start();
+  }
+  if (performance->level_counters_active()) {
+    performance->level_compute_start();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::method_counters_stop_(int index_method) const
+{
+  Performance * performance = cello::simulation()->performance();
+  if (performance->method_counters_active()) {
+    performance->method_counters_stop(index_method);
+  }
+  if (performance->level_counters_active()) {
+    performance->level_compute_stop(level());
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Block::update_level_counters_() const
+{
+  Performance * performance = cello::simulation()->performance();
+  if (performance->level_counters_active() && data_ != nullptr) {
+    performance->level_counter_add
+      (level(),level_counter_particles,
+       data_->particle_data()->num_particles(cello::particle_descr()));
+  }
 }
 
 //----------------------------------------------------------------------
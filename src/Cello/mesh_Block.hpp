@@ -111,6 +111,13 @@ public: // interface
   /// Set  process to migrate to next
   void set_ip_next(int ip) { ip_next_ = ip; }
 
+  /// Return the wall time spent in the compute phase on this Block
+  /// since the last reset, for measuring Block cost
+  double compute_time() const throw() { return compute_time_; }
+
+  /// Reset the Block's accumulated compute time
+  void reset_compute_time() { compute_time_ = 0.0; }
+
   /// Return the current timestep
   double dt() const throw()
   { return dt_; };
@@ -128,6 +135,11 @@ public: // interface
   bool is_leaf() const
   { return is_leaf_; }
 
+  /// Return whether this Block is quiescent: its Adapt:quiescent_fields
+  /// have changed by less than Adapt:quiescent_tolerance relative to
+  /// their values in each of the last Adapt:quiescent_cycles cycles
+  bool is_quiescent() const;
+
   /// Index of the Block
   const Index & index() const
   { return index_; }
@@ -224,6 +236,11 @@ public: // interface
   /// Initialize Adapt class for neighbor connectivity
   void init_adapt_(Adapt * adapt_parent);
 
+  /// Initialize the neighbors of the Block with the given index in
+  /// the initial mesh, from its parent's Adapt if not nullptr
+  void init_adapt_neighbors_
+  (Adapt & adapt, Index index, const Adapt * adapt_parent) const;
+
   /// Initialize arrays for refresh
   void init_refresh_();
 
@@ -303,6 +320,9 @@ public: // interface
     compute_continue_();
   }
 
+  void p_compute_batch()
+  {      compute_batch_();  }
+
   void p_compute_exit()
   {      compute_exit_();  }
   void r_compute_exit(CkReductionMsg * msg)
@@ -357,6 +377,22 @@ public: // interface
   { *index = index_order_;
     *count = count_order_;
   }
+
+  /// Accessor functions for the Block's cost, the cost of Blocks
+  /// preceding it in the ordering, and the total cost, saved in
+  /// checkpoints for placing Blocks on restart
+  void set_order_cost (double cost_self, double cost_index, double cost_total)
+  {
+    cost_order_[0] = cost_self;
+    cost_order_[1] = cost_index;
+    cost_order_[2] = cost_total;
+  }
+  void get_order_cost
+  (double * cost_self, double * cost_index, double * cost_total) const
+  { *cost_self  = cost_order_[0];
+    *cost_index = cost_order_[1];
+    *cost_total = cost_order_[2];
+  }
   
 protected: // methods
 
@@ -367,8 +403,24 @@ protected: // methods
   void compute_begin_();
   /// Initiate computing the next Method in the sequence
   void compute_next_();
+  /// Whether this Block skips the Method because it is a non-leaf
+  /// Block and the Method is leaf-only (see Method::leaf_only())
+  bool skip_method_(Method * method) const;
+  /// Update quiescent_count_ from the change in the quiescent fields
+  /// since the last cycle
+  void quiescent_update_();
   /// Return after performing any Refresh operations
   void compute_continue_();
+  /// Apply the current Method to this process's pending batch of
+  /// Blocks
+  void compute_batch_();
+  /// Refresh for the next Method run while the current Method waits
+  void compute_side_next_();
+  /// Apply the next Method run while the current Method waits
+  void compute_side_continue_();
+  /// Continue after both the current Method and the Methods run while
+  /// it waited are done
+  void compute_overlap_end_();
   /// Cleanup after all Methods have been applied
   void compute_end_();
   /// Exit control compute phase
@@ -387,7 +439,9 @@ public: // methods
 
   /// Compute all derived fields in a block (default)
   ///   if field_list is provided, loops through that list and computes
-  ///   those fields that are grouped as derived
+  ///   those fields that are grouped as derived.  Derived fields whose
+  ///   inputs are unchanged since they were last computed at the
+  ///   current time are not recomputed
   void compute_derived(const std::vector< std::string >& field_list =
                              std::vector< std::string>()) throw();
 
@@ -436,16 +490,31 @@ public:
   void r_adapt_enter(CkReductionMsg * msg)
   {
     performance_start_(perf_adapt_apply);
+    barrier_arrival_(msg,"compute");
     delete msg;
     adapt_enter_();
     performance_stop_(perf_adapt_apply);
     performance_start_(perf_adapt_apply_sync);
   }
 
+  void r_adapt_precheck(CkReductionMsg * msg)
+  {
+    performance_start_(perf_adapt_apply);
+    const int changed = *((int * )msg->getData());
+    delete msg;
+    if (changed) {
+      adapt_begin_(false);
+    } else {
+      adapt_exit_();
+    }
+    performance_stop_(perf_adapt_apply);
+    performance_start_(perf_adapt_apply_sync);
+  }
+
   void r_adapt_next(CkReductionMsg * msg)
   {
     performance_start_(perf_adapt_update);
-    adapt_changed_ = *((int * )msg->getData());
+    adapt_changed_ = adapt_statistics_(msg);
     delete msg;
     adapt_next_();
     performance_stop_(perf_adapt_update);
@@ -503,10 +572,22 @@ public:
 
   void adapt_send_level();
 
+  /// Send levels to neighbors now, or after pending messages are
+  /// processed if Adapt:batch is set
+  void adapt_send_level_deferred_();
+
+  /// Perform a deferred adapt_send_level()
+  void p_adapt_send_level();
+
+  /// Print adapt consensus statistics on the root Block and return the
+  /// number of Blocks that will refine or coarsen
+  int adapt_statistics_(CkReductionMsg * msg);
+
 protected:
   bool do_adapt_();
   void adapt_enter_();
-  void adapt_begin_ ();
+  void adapt_precheck_();
+  void adapt_begin_ (bool compute_level = true);
   void adapt_next_ ();
   void adapt_barrier_();
   void adapt_end_ ();
@@ -517,6 +598,8 @@ protected:
   void adapt_called_();
   int adapt_compute_desired_level_(int level_maximum);
   void adapt_delete_child_(Index index_child);
+  /// Restrict one coarsening child's data into this Block
+  void adapt_recv_child_(MsgCoarsen * msg);
 public:
 
   //--------------------------------------------------
@@ -570,6 +653,10 @@ public:
   /// Begin a refresh operation, optionally waiting then invoking callback
   void refresh_start (int id_refresh, int callback);
 
+  /// Send the faces of an active refresh operation without waiting;
+  /// must be followed by refresh_wait()
+  void refresh_send (int id_refresh);
+
   /// Wait for a refresh operation to complete, then continue with the callback
   void refresh_wait (int id_refresh, int callback);
 
@@ -580,6 +667,41 @@ public:
   /// Receive a Refresh data message from an adjacent Block
   void p_refresh_recv (MsgRefresh * msg);
 
+  /// Entry method wrapper for refresh_check_done(), used to complete
+  /// a Refresh whose last face was copied directly by a Block on the
+  /// same process
+  void p_refresh_check_done (int id_refresh)
+  { refresh_check_done (id_refresh); }
+
+  /// Receive a Refresh data message from an adjacent Block on the
+  /// same process by direct function call rather than through Charm++
+  void refresh_recv_local_ (MsgRefresh * msg);
+
+  /// Receive a serialized Refresh data message that was part of an
+  /// aggregated message (see RefreshAggregator)
+  void p_refresh_recv_data (int n, char * buffer);
+
+  /// Receive a serialized Refresh data message sent with the Charm++
+  /// zero-copy API (see Refresh:nocopy_bytes)
+  void p_refresh_recv_nocopy (int n, char * buffer);
+
+  /// Send a Refresh data message to an adjacent Block, aggregating it
+  /// with other messages to the same process if enabled
+  void refresh_send_msg_ (Index index_neighbor, MsgRefresh * msg);
+
+  /// Send a serialized Refresh data message of the given size from a
+  /// staging buffer using the Charm++ zero-copy API
+  void refresh_send_nocopy_ (Index index_neighbor, MsgRefresh * msg,
+                             int size);
+
+  /// Return the Charm++ priority of messages sent by this Block in the
+  /// given phase_type phase (lower values are delivered first)
+  int message_priority_ (int phase) const;
+
+  /// Set the priority of a message allocated with priority bits, if
+  /// Performance:message_priority is enabled
+  void message_set_priority_ (void * msg, int phase) const;
+
   int refresh_load_field_faces_ (Refresh & refresh);
   
   /// Scatter particles in ghost zones to neighbors
@@ -589,11 +711,27 @@ public:
   /// particles, sets the 'is_copy' attribute to false
   int delete_non_local_particles_ (int it);
 
+  /// Return whether particles may be sorted this cycle, as set by the
+  /// Particle:sort_interval and Particle:sort_disorder parameters
+  bool particle_sort_enabled_ () const;
+
+  /// Return the Morton key of the Block cell containing the point
+  /// with coordinates (x,y,z) normalized to [-1,1) across the Block
+  int64_t particle_sort_key_ (double x, double y, double z) const;
+
+  /// Reorder particles of the given type by key if due this cycle or
+  /// if they are sufficiently out of order.  key[i] is the key of
+  /// the i'th particle counting consecutively through all batches.
+  void particle_sort_ (int it, const std::vector<int64_t> & key);
+
   /// Send flux data to neighbors
   int refresh_load_flux_faces_ (Refresh & refresh);
 
+  /// Send field face data to a neighbor.  If refresh_sparse is
+  /// given, only its fields are sent.
   void refresh_load_field_face_
-  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3]);
+  (Refresh & refresh, int refresh_type, Index index, int if3[3], int ic3[3],
+   const Refresh * refresh_sparse = nullptr);
   /// Send particles in list to corresponding indices
   void particle_send_(Refresh & refresh, int nl,Index index_list[],
                       ParticleData * particle_list[]);
@@ -609,15 +747,19 @@ public:
   void r_method_flux_correct_sum_fields(CkReductionMsg * msg);
   void r_method_debug_sum_fields(CkReductionMsg * msg);
 
+  /// Receive values for an FftLevel transform
+  void p_fft_recv(int id_fft, int phase, int source, int n, double values[]);
+
   void r_method_order_morton_continue(CkReductionMsg * msg);
   void r_method_order_morton_complete(CkReductionMsg * msg);
-  void p_method_order_morton_weight(int ic3[3], int weight, Index index);
-  void p_method_order_morton_index(int index, int count);
+  void p_method_order_morton_weight(int ic3[3], int weight, double cost, Index index);
+  void p_method_order_morton_index(int index, int count, double cost_index, double cost_total);
 
+  void r_method_order_hilbert_path(CkReductionMsg * msg);
   void r_method_order_hilbert_continue(CkReductionMsg * msg);
   void r_method_order_hilbert_complete(CkReductionMsg * msg);
-  void p_method_order_hilbert_weight(int ic3[3], int weight, Index index);
-  void p_method_order_hilbert_index(int index, int count);
+  void p_method_order_hilbert_weight(int ic3[3], int weight, double cost, Index index);
+  void p_method_order_hilbert_index(int index, int count, double cost_index, double cost_total);
 
   void p_method_output_next (MsgOutput * msg);
   void p_method_output_write (MsgOutput * msg);
@@ -653,6 +795,13 @@ protected:
   /// Apply prolongation operations on Block
   void refresh_coarse_apply_(Refresh * refresh);
 
+  /// Hash of the coarse values and regions of a coarse-fine
+  /// prolongation, for Field:prolong_cache
+  uint64_t refresh_coarse_hash_
+  (const cello_float * values_c, const int m3_c[3],
+   const int i3_c[3], const int n3_c[3],
+   const int i3_f[3], const int n3_f[3]) const;
+
   /// Scatter particles in ghost zones to neighbors
   int refresh_load_particle_faces_ (Refresh * refresh);
 
@@ -683,11 +832,20 @@ protected:
   ( int nl, ParticleData * particle_list[], Refresh * refresh);
 
   /// Scatter particles of given types in type_list, to appropriate
-  /// particle_array ParticleData elements
+  /// particle_array ParticleData elements.  If copying and copy_width
+  /// is non-zero, particles are only copied to the elements within
+  /// copy_width of them
   void particle_scatter_neighbors_
   (int npa, ParticleData * particle_array[],
    std::vector<int> & type_list, Particle particle_src,
-   const bool copy = false);
+   const bool copy = false, double copy_width = 0.0);
+
+  /// Set signature[ip] to the bit mask of the 4x4x4 particle_array
+  /// elements within copy_width of each of the np particles of batch
+  /// ib of type it
+  void particle_copy_signature_
+  (Particle particle, int it, int ib, int np, double copy_width,
+   std::vector<uint64_t> & signature);
 
   /// Scatter particles to appropriate partictle_list elements
   void particle_scatter_children_ (ParticleData * particle_list[],
@@ -723,6 +881,7 @@ public:
   void r_stopping_enter (CkReductionMsg * msg)
   {
     performance_start_(perf_stopping);
+    barrier_arrival_(msg,"output");
     delete msg;
     stopping_enter_();
     performance_stop_(perf_stopping);
@@ -788,6 +947,38 @@ protected:
   void performance_stop_
   (int index_region, std::string file="", int line=0);
 
+  /// Barrier that also reduces arrival times if
+  /// Performance:critical_path is set
+  void control_sync_barrier_arrival_ (int entry_point);
+
+  /// Report arrival skew and the last Block of a barrier reduction
+  /// from control_sync_barrier_arrival_(), if any
+  void barrier_arrival_ (CkReductionMsg * msg, const char * phase) const;
+
+  /// Return the start time of a trace region, or 0 if not tracing
+  /// (Performance:trace:file)
+  long long trace_start_() const;
+
+  /// Record a trace region of this Block started at time_start
+  void trace_stop_(const std::string & region, long long time_start) const;
+
+  /// Record this Block's allocated bytes in the Memory object's
+  /// per-Block high-water mark
+  void update_memory_bytes_() const;
+
+  /// Begin counting hardware events (Performance:method_counters)
+  /// and the time of this Block's level (Performance:level_counters)
+  /// for a Method computation
+  void method_counters_start_() const;
+
+  /// End counting hardware events, adding them to the given Method,
+  /// and the level time
+  void method_counters_stop_(int index_method) const;
+
+  /// Add this Block's particles to the per-level counters
+  /// (Performance:level_counters)
+  void update_level_counters_() const;
+
   //--------------------------------------------------
   // TESTING
   //--------------------------------------------------
@@ -833,6 +1024,10 @@ public: // virtual functions
 
   void ResumeFromSync();
 
+  /// Set the Block's load for the Charm++ load balancer from its
+  /// compute time when Balance:measure is "compute"
+  void UserSetLBLoad();
+
   FieldFace * create_face
   (int if3[3], int ic3[3], int g3[3],
    int refresh_type,
@@ -989,10 +1184,10 @@ protected: // attributes
   Adapt adapt_;
 
   /// current level of neighbors accumulated from children that can coarsen
-  std::vector<int> child_face_level_curr_;
+  std::vector<face_level_type> child_face_level_curr_;
 
   /// new level of neighbors accumulated from children that can coarsen
-  std::vector<int> child_face_level_next_;
+  std::vector<face_level_type> child_face_level_next_;
 
   /// Can coarsen only if all children can coarsen
   int count_coarsen_;
@@ -1010,6 +1205,33 @@ protected: // attributes
   /// Number of blocks that have refined or coarsened in this phase
   int adapt_changed_;
 
+  /// Whether a deferred adapt_send_level() is queued (Adapt:batch)
+  bool adapt_send_pending_;
+
+  /// Number of adapt_send_level() rounds in this adapt step
+  int adapt_num_sends_;
+
+  /// Number of MsgAdapt messages sent in this adapt step
+  int adapt_num_messages_;
+
+  /// Refinement criteria decision (adapt_refine, adapt_same, or
+  /// adapt_coarsen) at the last adapt, for Adapt:precheck
+  int adapt_decision_;
+
+  /// Number of consecutive cycles in which the Adapt:quiescent_fields
+  /// changed by less than Adapt:quiescent_tolerance
+  int quiescent_count_;
+
+  /// Interior values of the Adapt:quiescent_fields at the last cycle
+  std::vector<double> quiescent_values_;
+
+  /// Prolonged coarse-fine ghost values from previous refreshes,
+  /// keyed by refresh, face, and field, with a hash of the coarse
+  /// values they were computed from (Field:prolong_cache; not pupped)
+  std::map < long long,
+             std::pair < uint64_t, std::vector<cello_float> > >
+  refresh_coarse_cache_;
+
   /// Buffer for incoming MsgAdapt objects
   std::vector < MsgAdapt * > adapt_msg_list_;
 
@@ -1028,12 +1250,34 @@ protected: // attributes
   /// Process to migrate to if different from current; -1 to skip
   int ip_next_;
 
+  /// Accumulated compute wall time, and start time of the current
+  /// perf_compute region or -1 if not in one
+  double compute_time_;
+  double compute_time_start_;
+
+  /// Compute wall time since the last load balance, the Block's load
+  /// for Balance:measure "compute"
+  double balance_time_;
+
   /// String for storing bit ID name
   mutable std::string name_;
 
   /// Index of currently-active Method
   int index_method_;
 
+  /// Index of the next Method run while the current Method waits, or
+  /// -1 if not overlapping Methods
+  int index_method_side_;
+
+  /// Whether the current Method has called compute_done() while
+  /// overlapping Methods
+  bool overlap_main_done_;
+
+  /// Whether a Method run while the current Method waits is in its
+  /// compute(), and whether it has called compute_done()
+  bool in_side_compute_;
+  bool side_compute_done_;
+
   /// Stack of currently active solvers
   std::vector<int> index_solver_;
 
@@ -1047,6 +1291,10 @@ protected: // attributes
   /// Index and total count used for ordering blocks, e.g. for dynamic load balancing
   long long index_order_;
   long long count_order_;
+
+  /// Cost of the Block, of Blocks preceding it in the ordering, and
+  /// total cost, or 0 if the ordering has not measured costs
+  double cost_order_[3];
 };
 
 #endif /* COMM_BLOCK_HPP */
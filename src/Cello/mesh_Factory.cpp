@@ -66,7 +66,15 @@ CProxy_Block Factory::new_block_proxy
 
   CProxy_Block proxy_block;
 
-  CProxy_MappingArray array_map  = CProxy_MappingArray::ckNew(nbx,nby,nbz);
+  const Config * config = cello::config();
+  const bool node_aware = (config->mesh_root_mapping == "node");
+  int m3[3];
+  for (int axis=0; axis<3; axis++) {
+    m3[axis] = config->mesh_root_size[axis] / config->mesh_root_blocks[axis];
+  }
+
+  CProxy_MappingArray array_map  = CProxy_MappingArray::ckNew
+    (nbx,nby,nbz, node_aware, m3[0],m3[1],m3[2]);
 
   CkArrayOptions opts;
   opts.setMap(array_map);
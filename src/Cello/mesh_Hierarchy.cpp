@@ -42,6 +42,8 @@ Hierarchy::Hierarchy
   refined_regions_upper_(),
   num_blocks_(0),
   num_blocks_level_(),
+  block_vec_(),
+  block_map_(),
   num_particles_(0),
   num_zones_total_(0),
   num_zones_real_(0),
@@ -209,6 +211,32 @@ void Hierarchy::deallocate_blocks() throw()
 
 //----------------------------------------------------------------------
 
+void Hierarchy::insert_block (Block * block)
+{
+  block_vec_.push_back(block);
+  block_map_[block->index()] = block;
+}
+
+//----------------------------------------------------------------------
+
+bool Hierarchy::delete_block (Block * block)
+{
+  const int n = block_vec_.size();
+  bool found = false;
+  for (int i=0; i<n; i++) {
+    if (found) block_vec_[i-1] = block_vec_[i];
+    if (block_vec_[i] == block) found=true;
+  }
+  if (found) block_vec_.resize(n-1);
+  auto it = block_map_.find(block->index());
+  if (it != block_map_.end() && it->second == block) {
+    block_map_.erase(it);
+  }
+  return found;
+}
+
+//----------------------------------------------------------------------
+
 void Hierarchy::increment_block_count(int count, int level)
 {
   num_blocks_ += count;
@@ -21,6 +21,7 @@ void Refine::pup (PUP::er &p)
   p | include_ghosts_;
   p | schedule_;
   p | output_;
+  p | buffer_;
 }
 
 //----------------------------------------------------------------------
@@ -29,7 +29,8 @@ public: // interface
       max_level_(max_level),
       include_ghosts_(include_ghosts),
       output_(output),
-      schedule_(NULL)
+      schedule_(NULL),
+      buffer_(0)
   {};
 
   /// CHARM++ PUP::able declaration
@@ -44,7 +45,8 @@ public: // interface
       max_level_(0),
       include_ghosts_(false),
       output_(""),
-      schedule_(NULL)
+      schedule_(NULL),
+      buffer_(0)
   {}
 
   /// CHARM++ Pack / Unpack function
@@ -71,8 +73,50 @@ public: // interface
   /// Set schedule
   void set_schedule (Schedule * schedule) throw();
 
+  /// Set the number of ghost cells included in the criteria
+  void set_buffer (int buffer) throw()
+  { buffer_ = buffer; }
+
+  /// Whether the criterion writes its result to an output field
+  bool has_output () const throw()
+  { return output_ != ""; }
+
 protected: // functions
 
+  /// Return the maximum value of the array excluding ghost zones,
+  /// written as a branch-free reduction so the inner loop vectorizes
+  template <class T>
+  static T array_max_ (const T * array,
+                       int mx, int my, int mz,
+                       int gx, int gy, int gz) throw ()
+  {
+    T value_max = std::numeric_limits<T>::lowest();
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        const T * row = array + mx*(iy + my*iz);
+        for (int ix=gx; ix<mx-gx; ix++) {
+          value_max = (row[ix] > value_max) ? row[ix] : value_max;
+        }
+      }
+    }
+    return value_max;
+  }
+
+  /// Reduce the ghost depths that bound the cells evaluated so that
+  /// up to buffer_ ghost cells are included, keeping at least stencil
+  /// ghost cells for the criterion's stencil
+  void apply_buffer_ (int * gx, int * gy, int * gz,
+                      int stencil = 0) const throw ()
+  {
+    if (buffer_ > 0) {
+      int * g3[3] = {gx, gy, gz};
+      for (int axis=0; axis<3; axis++) {
+        int & g = *g3[axis];
+        if (g > 0) g = std::max(g - buffer_, std::min(g, stencil));
+      }
+    }
+  }
+
   /// Don't refine if already at max_level_
   void adjust_for_level_ (int * adapt_result, int level) const throw ()
   {
@@ -102,6 +146,11 @@ protected:
   /// Schedule for refinement; NULL if none
   Schedule * schedule_;
 
+  /// Number of ghost cells included in the criteria, so that regions
+  /// flagged near the Block boundary are refined before features
+  /// reach the Block
+  int buffer_;
+
 };
 
 #endif /* MESH_REFINE_HPP */
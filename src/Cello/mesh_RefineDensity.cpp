@@ -41,6 +41,7 @@ int RefineDensity::apply ( Block * block ) throw ()
     gx = gy = gz = 0;
   } else {
     field.ghost_depth(id, &gx,&gy,&gz);
+    apply_buffer_(&gx,&gy,&gz);
   }
   char * array = field.values(id);
 
@@ -78,18 +79,13 @@ int RefineDensity::apply_
   int mx, int my, int mz,
   int gx, int gy, int gz ) const throw ()
 {
+  // both conditions depend only on the maximum value
+
+  const T value_max = array_max_(array,mx,my,mz,gx,gy,gz);
+
+  const bool any_refine  = (value_max > min_refine_);
+  const bool all_coarsen = ! (value_max > max_coarsen_);
 
-  bool any_refine  = false;
-  bool all_coarsen = true;
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	if (array[i] > min_refine_)  any_refine  = true;
-	if (array[i] > max_coarsen_) all_coarsen = false;
-      }
-    }
-  }
   return 
     any_refine ?  adapt_refine :
     (all_coarsen ? adapt_coarsen : adapt_same) ;
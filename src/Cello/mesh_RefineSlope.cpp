@@ -56,6 +56,9 @@ int RefineSlope::apply ( Block * block ) throw ()
 
   for (size_t k=0; k<field_id_list_.size(); k++) {
 
+    // result cannot change once any field requires refinement
+    if (any_refine && ! output) break;
+
     int id_field = field_id_list_[k];
 
     int gx,gy,gz;
@@ -65,6 +68,7 @@ int RefineSlope::apply ( Block * block ) throw ()
       gz = (rank >= 3) ? 1 : 0;
     } else {
       field.ghost_depth(id_field, &gx,&gy,&gz);
+      apply_buffer_(&gx,&gy,&gz,1);
     }
 
     int mx,my,mz;
@@ -123,26 +127,64 @@ void RefineSlope::evaluate_block_(T * array, T * output ,
 				  int rank, 
 				  double * h3 )
 {
-  T slope;
+  if (rank == 1) {
+    evaluate_block_rank_<T,1>
+      (array,output,mx,my,mz,gx,gy,gz,any_refine,all_coarsen,h3);
+  } else if (rank == 2) {
+    evaluate_block_rank_<T,2>
+      (array,output,mx,my,mz,gx,gy,gz,any_refine,all_coarsen,h3);
+  } else {
+    evaluate_block_rank_<T,3>
+      (array,output,mx,my,mz,gx,gy,gz,any_refine,all_coarsen,h3);
+  }
+}
+
+//----------------------------------------------------------------------
+
+template <class T, int RANK>
+void RefineSlope::evaluate_block_rank_(T * array, T * output ,
+				       int mx, int my, int mz,
+				       int gx, int gy, int gz,
+				       bool *any_refine,
+				       bool * all_coarsen, 
+				       double * h3 )
+{
+  // All axes are evaluated in a single pass over the Block.  Without
+  // an output field, only the largest slope in each row matters, and
+  // evaluation stops once the Block is known to refine.
   const int d3[3] = {1,mx,mx*my};
-  T tiny = 1e-10;
-  int count=0;
-  for (int axis=0; axis<rank; axis++) {
-    int id = d3[axis];
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
+  const T tiny = 1e-10;
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      const int i0 = mx*(iy + my*iz);
+      if (output) {
 	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
-	  slope = fabs( (array[i+id] - array[i-id]) / a);
-	  count++;
-	  if (slope > min_refine_)  *any_refine  = true;
-	  if (slope > max_coarsen_) *all_coarsen = false;
-	  if (output) {
+	  const int i = i0 + ix;
+	  for (int axis=0; axis<RANK; axis++) {
+	    const int id = d3[axis];
+	    const T a = std::max(T(2.0*h3[axis]*fabs(array[i])),tiny);
+	    const T slope = fabs( (array[i+id] - array[i-id]) / a);
+	    if (slope > min_refine_)  *any_refine  = true;
+	    if (slope > max_coarsen_) *all_coarsen = false;
 	    if (slope > max_coarsen_) output[i] =  0;
 	    if (slope > min_refine_)  output[i] = +1;
 	  }
 	}
+      } else {
+	T slope_max = std::numeric_limits<T>::lowest();
+	for (int axis=0; axis<RANK; axis++) {
+	  const int id = d3[axis];
+	  const T scale = 2.0*h3[axis];
+	  for (int ix=gx; ix<mx-gx; ix++) {
+	    const int i = i0 + ix;
+	    const T a = std::max(T(scale*fabs(array[i])),tiny);
+	    const T slope = fabs( (array[i+id] - array[i-id]) / a);
+	    slope_max = (slope > slope_max) ? slope : slope_max;
+	  }
+	}
+	if (slope_max > min_refine_)  *any_refine  = true;
+	if (slope_max > max_coarsen_) *all_coarsen = false;
+	if (*any_refine) return;
       }
     }
   }
@@ -57,6 +57,16 @@ private: // functions
 		       int rank, 
 		       double * h3);
 
+  /// Evaluate the slopes along each axis with the rank known at
+  /// compile time, so the loop over axes is unrolled
+  template <class T, int RANK>
+  void evaluate_block_rank_(T * array,  T * output,
+			    int ndx, int ndy, int ndz,
+			    int gx, int gy, int gz,
+			    bool * any_refine,
+			    bool * all_coarsen, 
+			    double * h3);
+
 private: // attributes
 
   /// List of field id's
@@ -0,0 +1,142 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     mesh_RefreshAggregator.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the RefreshAggregator class
+
+#include "cello.hpp"
+
+#include "mesh.hpp"
+
+#include "charm_simulation.hpp"
+#include "charm_mesh.hpp"
+
+//----------------------------------------------------------------------
+
+long RefreshAggregator::num_parts[CONFIG_NODE_SIZE] = {0};
+long RefreshAggregator::num_msgs[CONFIG_NODE_SIZE] = {0};
+std::map<int, std::vector<char> >
+RefreshAggregator::buffer_[CONFIG_NODE_SIZE];
+std::map<int, int> RefreshAggregator::count_[CONFIG_NODE_SIZE];
+std::map<int, int> RefreshAggregator::priority_[CONFIG_NODE_SIZE];
+bool RefreshAggregator::flush_pending_[CONFIG_NODE_SIZE] = {false};
+int RefreshAggregator::buffer_size_[CONFIG_NODE_SIZE] = {0};
+int RefreshAggregator::flush_count_[CONFIG_NODE_SIZE] = {0};
+
+//----------------------------------------------------------------------
+
+void RefreshAggregator::append
+(int ip, Index index, MsgRefresh * msg, int priority)
+{
+  const int in = cello::index_static();
+
+  // part layout: Index values, message size, message data
+  // (NOTE: SAVE_SCALAR_TYPE() declares a local variable "n")
+
+  int v3[3];
+  index.values(v3);
+  const int size = msg->data_size();
+
+  std::vector<char> & buffer = buffer_[in][ip];
+  const size_t i0 = buffer.size();
+  buffer.resize(i0 + 4*sizeof(int) + size);
+
+  char * pc = buffer.data() + i0;
+  SAVE_SCALAR_TYPE(pc,int,v3[0]);
+  SAVE_SCALAR_TYPE(pc,int,v3[1]);
+  SAVE_SCALAR_TYPE(pc,int,v3[2]);
+  SAVE_SCALAR_TYPE(pc,int,size);
+  pc = msg->save_data(pc);
+
+  ASSERT2("RefreshAggregator::append()",
+          "buffer size mismatch %ld saved %ld allocated",
+          (pc - buffer.data()),buffer.size(),
+          (pc - buffer.data()) == (long)buffer.size());
+
+  delete msg;
+
+  ++num_parts[in];
+  const int count = ++count_[in][ip];
+  int & priority_buffer = priority_[in][ip];
+  if (count == 1 || priority < priority_buffer) priority_buffer = priority;
+
+  const Config * config = cello::config();
+  const int buffer_size = (buffer_size_[in] > 0) ?
+    buffer_size_[in] : config->refresh_aggregate_buffer_size;
+  const int flush_count = (flush_count_[in] > 0) ?
+    flush_count_[in] : config->refresh_aggregate_flush_count;
+  if (((int)buffer.size() >= buffer_size) || (count >= flush_count)) {
+    flush_(ip);
+  } else if (! flush_pending_[in]) {
+    // flush after Block entry methods already queued on this process
+    flush_pending_[in] = true;
+    proxy_simulation[CkMyPe()].p_refresh_flush();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void RefreshAggregator::flush ()
+{
+  const int in = cello::index_static();
+  flush_pending_[in] = false;
+  for (auto & it : buffer_[in]) {
+    if (! it.second.empty()) flush_(it.first);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void RefreshAggregator::flush_ (int ip)
+{
+  const int in = cello::index_static();
+  std::vector<char> & buffer = buffer_[in][ip];
+  if (cello::config()->performance_message_priority) {
+    CkEntryOptions options;
+    options.setPriority (priority_[in][ip]);
+    proxy_simulation[ip].p_refresh_recv_aggregate
+      (buffer.size(),buffer.data(),&options);
+  } else {
+    proxy_simulation[ip].p_refresh_recv_aggregate
+      (buffer.size(),buffer.data());
+  }
+  ++num_msgs[in];
+  // keep capacity for the next refresh phase
+  buffer.clear();
+  count_[in][ip] = 0;
+}
+
+//----------------------------------------------------------------------
+
+void RefreshAggregator::deliver (int n, char * buffer)
+{
+  Hierarchy * hierarchy = cello::hierarchy();
+
+  char * pc = buffer;
+  while (pc < buffer + n) {
+
+    int v3[3], n_part;
+    LOAD_SCALAR_TYPE(pc,int,v3[0]);
+    LOAD_SCALAR_TYPE(pc,int,v3[1]);
+    LOAD_SCALAR_TYPE(pc,int,v3[2]);
+    LOAD_SCALAR_TYPE(pc,int,n_part);
+
+    Index index;
+    index.set_values(v3);
+
+    Block * block = hierarchy->local_block(index);
+    if (block != nullptr) {
+      block->p_refresh_recv_data (n_part,pc);
+    } else {
+      // Block has migrated: forward the part individually
+      hierarchy->block_array()[index].p_refresh_recv_data (n_part,pc);
+    }
+    pc += n_part;
+  }
+
+  ASSERT2("RefreshAggregator::deliver()",
+          "buffer size mismatch %ld read %d received",
+          (pc - buffer),n,
+          (pc - buffer) == n);
+}
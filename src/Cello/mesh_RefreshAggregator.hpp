@@ -0,0 +1,86 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     mesh_RefreshAggregator.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Mesh] Declaration of the RefreshAggregator class
+
+#ifndef MESH_REFRESH_AGGREGATOR_HPP
+#define MESH_REFRESH_AGGREGATOR_HPP
+
+class MsgRefresh;
+
+class RefreshAggregator {
+
+  /// @class    RefreshAggregator
+  /// @ingroup  Mesh
+  /// @brief    [\ref Mesh] Combine refresh messages sent to the same process
+  ///
+  /// With small Blocks, refresh phases send many small MsgRefresh
+  /// messages between the same pairs of processes.  When
+  /// Refresh:aggregate is enabled, messages destined for Blocks on
+  /// other processes are serialized into per-process buffers instead
+  /// of being sent individually.  A buffer is sent as one message to
+  /// the Simulation group when it exceeds Refresh:aggregate_buffer_size
+  /// bytes or Refresh:aggregate_flush_count messages, and otherwise
+  /// when the flush request this class enqueues on its own process is
+  /// processed, which happens after the currently-queued Block entry
+  /// methods of the refresh phase.  On arrival the parts are
+  /// delivered to their Blocks, which advance their Sync counters as
+  /// for individual messages.
+
+public: // interface
+
+  /// Number of refresh messages buffered, before aggregation
+  static long num_parts[CONFIG_NODE_SIZE];
+
+  /// Number of aggregated messages sent
+  static long num_msgs[CONFIG_NODE_SIZE];
+
+  /// Buffer the message for the Block at the given Index on process
+  /// ip.  The message is serialized immediately and deleted.  The
+  /// aggregated message is sent with the highest (lowest valued)
+  /// priority of its parts if Performance:message_priority is enabled
+  static void append (int ip, Index index, MsgRefresh * msg,
+                      int priority = 0);
+
+  /// Send all non-empty buffers
+  static void flush ();
+
+  /// Deliver the parts of an aggregated message to their Blocks
+  static void deliver (int n, char * buffer);
+
+  /// Override Refresh:aggregate_buffer_size on this process
+  static void set_buffer_size (int buffer_size)
+  { buffer_size_[cello::index_static()] = buffer_size; }
+
+  /// Override Refresh:aggregate_flush_count on this process
+  static void set_flush_count (int flush_count)
+  { flush_count_[cello::index_static()] = flush_count; }
+
+private: // functions
+
+  /// Send the buffer for process ip
+  static void flush_ (int ip);
+
+private: // attributes
+
+  /// Buffered serialized messages for each destination process
+  static std::map<int, std::vector<char> > buffer_[CONFIG_NODE_SIZE];
+
+  /// Number of messages in each buffer
+  static std::map<int, int> count_[CONFIG_NODE_SIZE];
+
+  /// Highest priority of the messages in each buffer
+  static std::map<int, int> priority_[CONFIG_NODE_SIZE];
+
+  /// Whether a flush request has been enqueued and not yet processed
+  static bool flush_pending_[CONFIG_NODE_SIZE];
+
+  /// Flush thresholds if set, e.g. by the Tuner, or else 0
+  static int buffer_size_[CONFIG_NODE_SIZE];
+  static int flush_count_[CONFIG_NODE_SIZE];
+
+};
+
+#endif /* MESH_REFRESH_AGGREGATOR_HPP */
@@ -108,6 +108,11 @@ void Monitor::header () const
   print ("Define","CONFIG_SMP_MODE     %s","Yes");
 #else
   print ("Define","CONFIG_SMP_MODE     %s","no");
+#endif
+#ifdef CONFIG_USE_CKLOOP
+  print ("Define","CONFIG_USE_CKLOOP   %s","Yes");
+#else
+  print ("Define","CONFIG_USE_CKLOOP   %s","no");
 #endif
   print ("CHARM","CkNumPes()           %d",CkNumPes());
   print ("CHARM","CkNumNodes()         %d",CkNumNodes());
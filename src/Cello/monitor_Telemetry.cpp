@@ -0,0 +1,188 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     monitor_Telemetry.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the Telemetry class
+
+#include "cello.hpp"
+
+#include "monitor.hpp"
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/// Maximum UDP datagram payload, to avoid fragmentation
+#define TELEMETRY_UDP_BYTES 1400
+
+//----------------------------------------------------------------------
+
+Telemetry::Telemetry
+(std::string target, std::string format, std::string prefix) throw()
+  : type_(),
+    path_(),
+    port_(),
+    is_statsd_(format == "statsd"),
+    prefix_(prefix),
+    socket_(-1),
+    is_warned_(false),
+    buffer_()
+{
+  ASSERT1 ("Telemetry::Telemetry()",
+           "Unknown telemetry format \"%s\": must be prometheus or statsd",
+           format.c_str(),
+           (format == "prometheus" || format == "statsd"));
+
+  const size_t i = target.find(':');
+  type_ = target.substr(0,i);
+  const std::string rest = (i == std::string::npos) ? "" : target.substr(i+1);
+
+  if (type_ == "file") {
+    path_ = rest;
+  } else if (type_ == "udp" || type_ == "tcp") {
+    const size_t j = rest.rfind(':');
+    if (j != std::string::npos) {
+      path_ = rest.substr(0,j);
+      port_ = rest.substr(j+1);
+    }
+  }
+
+  ASSERT1 ("Telemetry::Telemetry()",
+           "Telemetry target \"%s\" must be file:<path>, "
+           "udp:<host>:<port>, or tcp:<host>:<port>",
+           target.c_str(),
+           ((type_ == "file" || type_ == "udp" || type_ == "tcp") &&
+            path_ != "" && (type_ == "file" || port_ != "")));
+}
+
+//----------------------------------------------------------------------
+
+Telemetry::~Telemetry() throw()
+{
+  if (socket_ >= 0) close (socket_);
+}
+
+//----------------------------------------------------------------------
+
+void Telemetry::metric
+(std::string name, double value,
+ std::string label_name, std::string label_value) throw()
+{
+  char line[256];
+  if (is_statsd_) {
+    // prefix.name[.label_value]:value|g
+    snprintf (line,sizeof(line),"%s.%s%s%s:%.17g|g\n",
+              prefix_.c_str(),name.c_str(),
+              label_value.empty() ? "" : ".",label_value.c_str(),value);
+  } else if (label_name.empty()) {
+    snprintf (line,sizeof(line),"%s_%s %.17g\n",
+              prefix_.c_str(),name.c_str(),value);
+  } else {
+    snprintf (line,sizeof(line),"%s_%s{%s=\"%s\"} %.17g\n",
+              prefix_.c_str(),name.c_str(),
+              label_name.c_str(),label_value.c_str(),value);
+  }
+  buffer_ += line;
+}
+
+//----------------------------------------------------------------------
+
+void Telemetry::send () throw()
+{
+  if (type_ == "file") {
+
+    // write then rename, so readers never see a partial file
+
+    const std::string temp = path_ + ".tmp";
+    FILE * fp = fopen (temp.c_str(),"w");
+    if (fp != nullptr) {
+      fputs (buffer_.c_str(),fp);
+      fclose (fp);
+      if (rename (temp.c_str(),path_.c_str()) != 0) {
+        warn_ ("cannot rename telemetry file");
+      }
+    } else {
+      warn_ ("cannot open telemetry file");
+    }
+
+  } else if (connect_()) {
+
+    send_socket_();
+
+  }
+
+  buffer_.clear();
+}
+
+//----------------------------------------------------------------------
+
+bool Telemetry::connect_ () throw()
+{
+  if (socket_ >= 0) return true;
+
+  struct addrinfo hints;
+  memset (&hints,0,sizeof(hints));
+  hints.ai_family   = AF_UNSPEC;
+  hints.ai_socktype = (type_ == "udp") ? SOCK_DGRAM : SOCK_STREAM;
+
+  struct addrinfo * address = nullptr;
+  if (getaddrinfo (path_.c_str(),port_.c_str(),&hints,&address) != 0) {
+    warn_ ("cannot resolve telemetry host");
+    return false;
+  }
+
+  for (struct addrinfo * a = address; a != nullptr; a = a->ai_next) {
+    socket_ = socket (a->ai_family,a->ai_socktype,a->ai_protocol);
+    if (socket_ < 0) continue;
+    // connected UDP sockets let send() be used for both types
+    if (::connect (socket_,a->ai_addr,a->ai_addrlen) == 0) break;
+    close (socket_);
+    socket_ = -1;
+  }
+  freeaddrinfo (address);
+
+  if (socket_ < 0) warn_ ("cannot connect to telemetry target");
+
+  return socket_ >= 0;
+}
+
+//----------------------------------------------------------------------
+
+void Telemetry::send_socket_ () throw()
+{
+  const bool is_udp = (type_ == "udp");
+  size_t start = 0;
+  while (start < buffer_.size()) {
+
+    // UDP datagrams end at a line boundary
+
+    size_t length = buffer_.size() - start;
+    if (is_udp && length > TELEMETRY_UDP_BYTES) {
+      const size_t end = buffer_.rfind('\n',start + TELEMETRY_UDP_BYTES - 1);
+      length = (end != std::string::npos && end >= start) ?
+        end + 1 - start : TELEMETRY_UDP_BYTES;
+    }
+
+    const ssize_t sent = ::send (socket_,buffer_.data() + start,length,
+                                 MSG_NOSIGNAL);
+    if (sent < 0) {
+      // reconnect on the next send()
+      warn_ ("cannot send to telemetry target");
+      close (socket_);
+      socket_ = -1;
+      return;
+    }
+    start += sent;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Telemetry::warn_ (const char * message) throw()
+{
+  if (! is_warned_) {
+    WARNING2 ("Telemetry::send()","%s %s",message,path_.c_str());
+    is_warned_ = true;
+  }
+}
@@ -0,0 +1,78 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     monitor_Telemetry.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Monitor] Declaration of the Telemetry class
+
+#ifndef MONITOR_TELEMETRY_HPP
+#define MONITOR_TELEMETRY_HPP
+
+class Telemetry {
+
+  /// @class    Telemetry
+  /// @ingroup  Monitor
+  /// @brief    [\ref Monitor] Send metrics to a file or network target
+  ///
+  /// Metrics are collected with metric() and sent together by send(),
+  /// either in Prometheus text exposition format or as StatsD gauges.
+  /// Targets are "file:<path>", which is rewritten by each send() so
+  /// that it can be read by e.g. the Prometheus node_exporter textfile
+  /// collector, "udp:<host>:<port>", or "tcp:<host>:<port>".  Used
+  /// only on the root process.
+
+public: // interface
+
+  /// Create a Telemetry object for the given target, format
+  /// ("prometheus" or "statsd"), and metric name prefix
+  Telemetry (std::string target, std::string format,
+             std::string prefix) throw();
+
+  /// Close the connection, if any
+  ~Telemetry() throw();
+
+  /// Add a metric, optionally with a single label
+  void metric (std::string name, double value,
+               std::string label_name = "",
+               std::string label_value = "") throw();
+
+  /// Send the metrics added since the last send()
+  void send () throw();
+
+private: // functions
+
+  /// Open the socket if needed, returning whether it is open
+  bool connect_ () throw();
+
+  /// Write buffer_ to the socket
+  void send_socket_ () throw();
+
+  /// Warn once about a failure to send
+  void warn_ (const char * message) throw();
+
+private: // attributes
+
+  /// Target type: "file", "udp", or "tcp"
+  std::string type_;
+
+  /// File path, or host name and port
+  std::string path_;
+  std::string port_;
+
+  /// Whether to use StatsD rather than Prometheus format
+  bool is_statsd_;
+
+  /// Prefix of metric names
+  std::string prefix_;
+
+  /// Socket for udp and tcp targets, or -1
+  int socket_;
+
+  /// Whether a send failure was reported
+  bool is_warned_;
+
+  /// Metrics added since the last send()
+  std::string buffer_;
+};
+
+#endif /* MONITOR_TELEMETRY_HPP */
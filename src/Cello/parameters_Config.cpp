@@ -30,6 +30,13 @@ void Config::pup (PUP::er &p)
   p | adapt_list;
   p | adapt_interval;
   p | adapt_min_face_rank;
+  p | adapt_batch;
+  p | adapt_precheck;
+  p | adapt_buffer;
+  p | adapt_quiescent_fields;
+  p | adapt_quiescent_tolerance;
+  p | adapt_quiescent_cycles;
+  p | adapt_quiescent_max_skip;
   p | adapt_type;
   p | adapt_field_list;
   p | adapt_min_refine;
@@ -45,6 +52,7 @@ void Config::pup (PUP::er &p)
   // Balance
 
   p | balance_schedule_index;
+  p | balance_measure;
   p | balance_type;
 
   // Boundary
@@ -70,9 +78,12 @@ void Config::pup (PUP::er &p)
   PUParray(p,field_centering,3);
   PUParray(p,field_ghost_depth,3);
   p | field_padding;
+  p | field_layout;
   p | field_history;
   p | field_precision;
+  p | field_precision_list;
   p | field_prolong;
+  p | field_prolong_cache;
   p | field_restrict;
   p | field_group_list;
 
@@ -86,6 +97,8 @@ void Config::pup (PUP::er &p)
 
   p | initial_restart;
   p | initial_restart_dir;
+  p | initial_restart_num_readers;
+  p | initial_restart_prefetch;
 
   p | initial_trace_name;
   p | initial_trace_field;
@@ -99,31 +112,50 @@ void Config::pup (PUP::er &p)
   p | memory_active;
   p | memory_warning_mb;
   p | memory_limit_gb;
+  p | memory_fill;
+  p | memory_huge_pages;
 
   // Mesh
 
   PUParray(p,mesh_root_blocks,3);
   p | mesh_root_rank;
   PUParray(p,mesh_root_size,3);
+  p | mesh_root_mapping;
   p | mesh_min_level;
   p | mesh_max_level;
   p | mesh_max_initial_level;
   p | refined_regions_lower;
   p | refined_regions_upper;
+  p | mesh_initial_bulk_insert;
 
   // Method
 
   p | num_method;
   p | method_courant_global;
+  p | method_dataflow;
   p | method_list;
   p | method_schedule_index;
   p | method_courant;
+  p | method_batch;
+  p | method_subcycle;
+  p | method_max_subcycles;
+  p | method_skip_quiescent;
+  p | method_codec;
+  p | method_codec_tolerance;
+  p | method_codec_fields;
+  p | method_sparse_refresh;
+  p | method_refresh_ghost_depth;
+  p | method_overlap;
+  p | method_fuse;
   p | method_type;
 
   // Monitor
 
   p | monitor_debug;
   p | monitor_verbose;
+  p | monitor_telemetry_target;
+  p | monitor_telemetry_format;
+  p | monitor_telemetry_prefix;
 
   // Output
 
@@ -146,14 +178,26 @@ void Config::pup (PUP::er &p)
   p | output_image_face_rank;
   p | output_image_min;
   p | output_image_max;
+  p | output_image_resolutions;
+  p | output_image_compression;
   p | output_min_level;
   p | output_max_level;
   p | output_leaf_only;
+  p | output_region_lower;
+  p | output_region_upper;
+  p | output_region_center;
+  p | output_region_radius;
   p | output_schedule_index;
   p | output_dir;
   p | output_dir_global;
   p | output_stride_write;
   p | output_stride_wait;
+  p | output_layout;
+  p | output_alignment;
+  p | output_engine;
+  p | output_chunk;
+  p | output_filters;
+  p | output_precision;
   p | output_field_list;
   p | output_particle_list;
   p | output_checkpoint_file;
@@ -181,20 +225,44 @@ void Config::pup (PUP::er &p)
   PUParray (p,particle_attribute_velocity,3);
   p | particle_batch_size;
   p | particle_group_list;
+  p | particle_sort_interval;
+  p | particle_sort_disorder;
 
   // Performance
 
   p | performance_papi_counters;
   p | performance_projections_on_at_start;
   p | performance_warnings;
+  p | performance_critical_path;
+  p | performance_smp;
+  p | performance_message_priority;
+  p | performance_method_counters;
+  p | performance_level_counters;
+  p | performance_level_file;
+  p | performance_trace_file;
+  p | performance_trace_size;
   p | performance_on_schedule_index;
   p | performance_off_schedule_index;
+  p | performance_tune_file;
+  p | performance_tune_active;
+  p | performance_tune_cycles;
+  p | performance_tune_methods;
+  p | performance_budget_active;
+  p | performance_budget_interval;
 
   // Physics
   
   p | num_physics;
   p | physics_list;
 
+  // Refresh
+
+  p | refresh_local_copy;
+  p | refresh_aggregate;
+  p | refresh_aggregate_buffer_size;
+  p | refresh_aggregate_flush_count;
+  p | refresh_nocopy_bytes;
+
   // Solvers
   
   p | num_solvers;
@@ -204,6 +272,9 @@ void Config::pup (PUP::er &p)
   p | solver_solve_type;
   p | solver_iter_max;
   p | solver_res_tol;
+  p | solver_res_tol_change;
+  p | solver_res_tol_level;
+  p | solver_iter_max_level;
   p | solver_diag_precon;
   p | solver_monitor_iter;
   p | solver_restrict;
@@ -219,6 +290,7 @@ void Config::pup (PUP::er &p)
   p | stopping_time;
   p | stopping_seconds;
   p | stopping_interval;
+  p | stopping_dt_level;
 
   // Testing
 
@@ -248,6 +320,7 @@ void Config::read(Parameters * p) throw()
   read_particle_(p);
   read_performance_(p);
   read_physics_(p);
+  read_refresh_(p);
   read_stopping_(p);
   read_testing_(p);
   read_units_(p);
@@ -284,6 +357,28 @@ void Config::read_adapt_ (Parameters * p) throw()
   adapt_schedule_index .resize(num_adapt);
 
   adapt_min_face_rank = p->value_integer("Adapt:min_face_rank",0);
+  adapt_batch = p->value_logical("Adapt:batch",false);
+  adapt_precheck = p->value_logical("Adapt:precheck",false);
+  adapt_buffer = p->value_integer("Adapt:buffer",0);
+
+  ASSERT1 ("Config::read_adapt_()",
+           "Adapt:buffer %d must not be negative",
+           adapt_buffer, (adapt_buffer >= 0));
+
+  const int num_quiescent_fields = p->list_length("Adapt:quiescent_fields");
+  adapt_quiescent_fields.resize(num_quiescent_fields);
+  for (int i=0; i<num_quiescent_fields; i++) {
+    adapt_quiescent_fields[i] =
+      p->list_value_string(i,"Adapt:quiescent_fields");
+  }
+  adapt_quiescent_tolerance =
+    p->value_float("Adapt:quiescent_tolerance",1e-6);
+  adapt_quiescent_cycles = p->value_integer("Adapt:quiescent_cycles",4);
+  adapt_quiescent_max_skip = p->value_integer("Adapt:quiescent_max_skip",16);
+
+  ASSERT1 ("Config::read_adapt_()",
+           "Adapt:quiescent_cycles %d must be positive",
+           adapt_quiescent_cycles, (adapt_quiescent_cycles > 0));
 
   for (int ia=0; ia<num_adapt; ia++) {
 
@@ -358,6 +453,13 @@ void Config::read_balance_ (Parameters * p) throw()
            ((balance_type == "charm") ||
             (balance_type == "cello")));
 
+  balance_measure = p->value_string ("Balance:measure","wall");
+  ASSERT1 ("Config::read_balance_",
+          "Unknown Balance:measure parameter %s; valid are \"wall\" or \"compute\"",
+           balance_measure.c_str(),
+           ((balance_measure == "wall") ||
+            (balance_measure == "compute")));
+
   const bool balance_scheduled = 
     (p->type("Balance:schedule:var") != parameter_unknown);
 
@@ -575,22 +677,44 @@ void Config::read_field_ (Parameters * p) throw()
 
   field_padding = p->value_integer("Field:padding",0);
 
+  field_layout = p->value_string("Field:layout","packed");
+
   field_history = p->value_integer("Field:history",0);
 
   // Field precision
 
-  std::string precision_str = p->value_string("Field:precision","default");
+  auto read_precision = [p](const std::string& param, int precision)
+    {
+      if (p->type(param) != parameter_string) return precision;
+      const std::string precision_str = p->value_string(param);
+      if      (precision_str == "default")   return (int)precision_default;
+      else if (precision_str == "single")    return (int)precision_single;
+      else if (precision_str == "double")    return (int)precision_double;
+      else if (precision_str == "quadruple") return (int)precision_quadruple;
+      ERROR2 ("Config::read()", "Unknown precision %s for parameter %s",
+              precision_str.c_str(), param.c_str());
+      return precision;
+    };
 
-  if      (precision_str == "default")   field_precision = precision_default;
-  else if (precision_str == "single")    field_precision = precision_single;
-  else if (precision_str == "double")    field_precision = precision_double;
-  else if (precision_str == "quadruple") field_precision = precision_quadruple;
-  else {
-    ERROR1 ("Config::read()", "Unknown precision %s",
-	    precision_str.c_str());
+  field_precision = read_precision("Field:precision",precision_default);
+
+  // Per-field precision (Field : <field_name> : precision) overrides the
+  // precision of the field's groups (Group : <group_name> : precision),
+  // which in turn overrides Field : precision
+
+  field_precision_list.resize(num_fields);
+
+  for (int index_field=0; index_field<num_fields; index_field++) {
+    int precision = field_precision;
+    for (const std::string& group : field_group_list[index_field]) {
+      precision = read_precision("Group:" + group + ":precision", precision);
+    }
+    param = "Field:" + field_list[index_field] + ":precision";
+    field_precision_list[index_field] = read_precision(param, precision);
   }
 
   field_prolong   = p->value_string ("Field:prolong","enzo");
+  field_prolong_cache = p->value_logical ("Field:prolong_cache",false);
   field_restrict  = p->value_string ("Field:restrict","linear");
 }
 
@@ -623,6 +747,10 @@ void Config::read_initial_ (Parameters * p) throw()
 
   initial_restart      = p->value_logical ("Initial:restart",false);
   initial_restart_dir  = p->value_string  ("Initial:restart_dir","");
+  initial_restart_num_readers =
+    p->value_integer ("Initial:restart_num_readers",0);
+  initial_restart_prefetch =
+    p->value_logical ("Initial:restart_prefetch",true);
 
   // InitialTrace
   initial_trace_name = p->value_string ("Initial:trace:name","trace");
@@ -644,6 +772,16 @@ void Config::read_memory_ (Parameters * p) throw()
   memory_active = p->value_logical("Memory:active",true);
   memory_warning_mb =  p->value_float("Memory:warning_mb",0.0);
   memory_limit_gb =    p->value_float("Memory:limit_gb",0.0);
+  memory_fill =        p->value_logical("Memory:fill",false);
+  memory_huge_pages =  p->value_string("Memory:huge_pages","none");
+
+  ASSERT1 ("Config::read_memory_()",
+           "Memory:huge_pages = \"%s\" must be \"none\", "
+           "\"transparent\", or \"explicit\"",
+           memory_huge_pages.c_str(),
+           (memory_huge_pages == "none" ||
+            memory_huge_pages == "transparent" ||
+            memory_huge_pages == "explicit"));
 }
 
 //----------------------------------------------------------------------
@@ -696,6 +834,13 @@ void Config::read_mesh_ (Parameters * p) throw()
   mesh_root_size[1] = p->list_value_integer(1,"Mesh:root_size",1);
   mesh_root_size[2] = p->list_value_integer(2,"Mesh:root_size",1);
 
+  mesh_root_mapping = p->value_string("Mesh:root_mapping","linear");
+
+  ASSERT1 ("Config::read_mesh_()",
+           "Mesh:root_mapping %s must be \"linear\" or \"node\"",
+           mesh_root_mapping.c_str(),
+           (mesh_root_mapping == "linear" || mesh_root_mapping == "node"));
+
   //--------------------------------------------------
 
   mesh_max_level = p->value_integer
@@ -818,6 +963,8 @@ void Config::read_mesh_ (Parameters * p) throw()
     refined_regions_upper.size(), 
     mesh_max_initial_level);
   }
+
+  mesh_initial_bulk_insert = p->value_logical("Mesh:initial_bulk_insert",false);
 }
 
 //----------------------------------------------------------------------
@@ -834,10 +981,23 @@ void Config::read_method_ (Parameters * p) throw()
 
   method_list.   resize(num_method);
   method_courant.resize(num_method);
+  method_batch.resize(num_method);
+  method_subcycle.resize(num_method);
+  method_max_subcycles.resize(num_method);
+  method_skip_quiescent.resize(num_method);
+  method_codec.resize(num_method);
+  method_codec_tolerance.resize(num_method);
+  method_codec_fields.resize(num_method);
+  method_sparse_refresh.resize(num_method);
+  method_refresh_ghost_depth.resize(num_method);
+  method_overlap.resize(num_method);
+  method_fuse.resize(num_method);
   method_schedule_index.resize(num_method);
   method_type.resize(num_method);
   
   method_courant_global = p->value_float ("Method:courant",1.0);
+
+  method_dataflow = p->value_logical ("Method:dataflow",false);
   
   for (int index_method=0; index_method<num_method; index_method++) {
 
@@ -866,6 +1026,59 @@ void Config::read_method_ (Parameters * p) throw()
     // Read courant condition if any
     method_courant[index_method] = p->value_float  (full_name + ":courant",1.0);
 
+    // Read whether ready Blocks are computed together
+    method_batch[index_method] = p->value_logical (full_name + ":batch",false);
+
+    // Read whether the Method is subcycled within each Block
+    method_subcycle[index_method] =
+      p->value_logical (full_name + ":subcycle",false);
+    method_max_subcycles[index_method] =
+      p->value_integer (full_name + ":max_subcycles",0);
+    ASSERT2 ("Config::read_method_()",
+             "%s:max_subcycles %d must not be negative",
+             full_name.c_str(),method_max_subcycles[index_method],
+             (method_max_subcycles[index_method] >= 0));
+
+    // Read whether the Method is skipped on quiescent Blocks
+    method_skip_quiescent[index_method] =
+      p->value_logical (full_name + ":skip_quiescent",false);
+
+    // Read how field faces are encoded in the Method's refresh messages
+    method_codec[index_method] =
+      p->value_string (full_name + ":codec","auto");
+    method_codec_tolerance[index_method] =
+      p->value_float (full_name + ":codec_tolerance",0.0);
+    ASSERT1 ("Config::read_method_()",
+             "%s:codec_tolerance must be positive for the lossy codec",
+             full_name.c_str(),
+             (method_codec[index_method] != "lossy" ||
+              method_codec_tolerance[index_method] > 0.0));
+    const int num_codec_fields = p->list_length(full_name + ":codec_fields");
+    for (int i=0; i<num_codec_fields; i++) {
+      method_codec_fields[index_method].push_back
+        (p->list_value_string(i,full_name + ":codec_fields"));
+    }
+
+    // Read whether the Method's refresh only sends modified fields
+    method_sparse_refresh[index_method] =
+      p->value_logical (full_name + ":sparse_refresh",false);
+
+    // Read the number of ghost zone layers the Method's refresh sends
+    method_refresh_ghost_depth[index_method] =
+      p->value_integer (full_name + ":refresh_ghost_depth",0);
+    ASSERT2 ("Config::read_method_()",
+             "%s:refresh_ghost_depth %d must not be negative",
+             full_name.c_str(),method_refresh_ghost_depth[index_method],
+             (method_refresh_ghost_depth[index_method] >= 0));
+
+    // Read whether following independent Methods run while this one waits
+    method_overlap[index_method] =
+      p->value_logical (full_name + ":overlap",false);
+
+    // Read whether this Method's refresh is merged into the previous one
+    method_fuse[index_method] =
+      p->value_logical (full_name + ":fuse",false);
+
     method_type[index_method] = p->value_string
       (full_name + ":type", name);
   }
@@ -882,6 +1095,12 @@ void Config::read_monitor_ (Parameters * p) throw()
 
   monitor_debug   = p->value_logical("Monitor:debug",  false);
   monitor_verbose = p->value_logical("Monitor:verbose",false);
+  monitor_telemetry_target = p->value_string
+    ("Monitor:telemetry:target","");
+  monitor_telemetry_format = p->value_string
+    ("Monitor:telemetry:format","prometheus");
+  monitor_telemetry_prefix = p->value_string
+    ("Monitor:telemetry:prefix","enzoe");
 
 }
 
@@ -915,13 +1134,25 @@ void Config::read_output_ (Parameters * p) throw()
   output_image_face_rank.resize(num_output);
   output_image_min.resize(num_output);
   output_image_max.resize(num_output);
+  output_image_resolutions.resize(num_output);
+  output_image_compression.resize(num_output);
   output_min_level.resize(num_output);
   output_max_level.resize(num_output);
   output_leaf_only.resize(num_output);
+  output_region_lower.resize(num_output);
+  output_region_upper.resize(num_output);
+  output_region_center.resize(num_output);
+  output_region_radius.resize(num_output);
   output_schedule_index.resize(num_output);
   output_dir.resize(num_output);
   output_stride_write.resize(num_output);
   output_stride_wait.resize(num_output);
+  output_layout.resize(num_output);
+  output_alignment.resize(num_output);
+  output_engine.resize(num_output);
+  output_chunk.resize(num_output);
+  output_filters.resize(num_output);
+  output_precision.resize(num_output);
   output_field_list.resize(num_output);
   output_particle_list.resize(num_output);
   output_name.resize(num_output);
@@ -949,6 +1180,49 @@ void Config::read_output_ (Parameters * p) throw()
 
     output_stride_wait[index_output] = p->value_integer("stride_wait",0);
 
+    output_layout[index_output] = p->value_string("layout","block");
+
+    ASSERT2("Config::read",
+            "Output:%s:layout \"%s\" must be \"block\" or \"aggregate\"",
+            output_list[index_output].c_str(),
+            output_layout[index_output].c_str(),
+            (output_layout[index_output] == "block" ||
+             output_layout[index_output] == "aggregate"));
+
+    output_alignment[index_output] = p->value_integer("alignment",0);
+
+    output_engine[index_output] = p->value_string("engine","BP5");
+
+    ASSERT2("Config::read",
+            "Output:%s:engine \"%s\" must be \"BP5\" or \"SST\"",
+            output_list[index_output].c_str(),
+            output_engine[index_output].c_str(),
+            (output_engine[index_output] == "BP5" ||
+             output_engine[index_output] == "SST"));
+
+    if (p->type("chunk") == parameter_list) {
+      int length = p->list_length("chunk");
+      output_chunk[index_output].resize(length);
+      for (int i=0; i<length; i++) {
+        output_chunk[index_output][i] = p->list_value_integer(i,"chunk",0);
+        ASSERT2("Config::read",
+                "Output:%s:chunk[%d] must be non-negative",
+                output_list[index_output].c_str(),i,
+                output_chunk[index_output][i] >= 0);
+      }
+    }
+
+    if (p->type("filters") == parameter_list) {
+      int length = p->list_length("filters");
+      output_filters[index_output].resize(length);
+      for (int i=0; i<length; i++) {
+        output_filters[index_output][i] = p->list_value_string(i,"filters","");
+      }
+    } else if (p->type("filters") == parameter_string) {
+      output_filters[index_output].resize(1);
+      output_filters[index_output][0] = p->value_string("filters","");
+    }
+
     if (p->type("dir") == parameter_string) {
       output_dir[index_output].resize(1);
       output_dir[index_output][0] = p->value_string("dir","");
@@ -991,6 +1265,37 @@ void Config::read_output_ (Parameters * p) throw()
       }
     }
 
+    // Precision of field values written: one for all fields, or one
+    // for each field in field_list
+
+    if (p->type("precision") == parameter_list) {
+      int length = p->list_length("precision");
+      ASSERT3("Config::read",
+              "Output:%s:precision list length %d must match field_list "
+              "length %d",
+              output_list[index_output].c_str(), length,
+              int(output_field_list[index_output].size()),
+              (length == int(output_field_list[index_output].size())));
+      output_precision[index_output].resize(length);
+      for (int i=0; i<length; i++) {
+        output_precision[index_output][i] =
+          p->list_value_string(i,"precision","default");
+      }
+    } else if (p->type("precision") == parameter_string) {
+      output_precision[index_output].resize(1);
+      output_precision[index_output][0] = p->value_string("precision","default");
+    }
+
+    for (const std::string & precision : output_precision[index_output]) {
+      ASSERT2("Config::read",
+              "Output:%s:precision \"%s\" must be \"default\", \"single\", "
+              "\"half\", \"bfloat16\", \"int16\" or \"int8\"",
+              output_list[index_output].c_str(), precision.c_str(),
+              (precision == "default" || precision == "single" ||
+               precision == "half" || precision == "bfloat16" ||
+               precision == "int16" || precision == "int8"));
+    }
+
     if (p->type("particle_list") == parameter_list) {
       int length = p->list_length("particle_list");
       output_particle_list[index_output].resize(length);
@@ -999,6 +1304,42 @@ void Config::read_output_ (Parameters * p) throw()
       }
     }
 
+    // Level range and region of interest of Blocks to write; images
+    // default to levels from the root level
+
+    output_min_level[index_output] = p->value_integer
+      ("min_level",(output_type[index_output] == "image") ?
+       0 : std::numeric_limits<int>::min());
+    output_max_level[index_output] =
+      p->value_integer("max_level",std::numeric_limits<int>::max());
+
+    if (p->type("region_lower") == parameter_list ||
+        p->type("region_upper") == parameter_list) {
+      output_region_lower[index_output].resize(3);
+      output_region_upper[index_output].resize(3);
+      for (int axis=0; axis<3; axis++) {
+        output_region_lower[index_output][axis] =
+          p->list_value_float(axis,"region_lower",domain_lower[axis]);
+        output_region_upper[index_output][axis] =
+          p->list_value_float(axis,"region_upper",domain_upper[axis]);
+      }
+    }
+
+    output_region_radius[index_output] = p->value_float("region_radius",0.0);
+    ASSERT2("Config::read",
+            "Output:%s:region_radius %g must be non-negative",
+            output_list[index_output].c_str(),
+            output_region_radius[index_output],
+            (output_region_radius[index_output] >= 0.0));
+    if (output_region_radius[index_output] > 0.0) {
+      output_region_center[index_output].resize(3);
+      for (int axis=0; axis<3; axis++) {
+        output_region_center[index_output][axis] =
+          p->list_value_float(axis,"region_center",
+                              0.5*(domain_lower[axis]+domain_upper[axis]));
+      }
+    }
+
     // Read schedule for the Output object
       
     p->group_push("schedule");
@@ -1059,9 +1400,20 @@ void Config::read_output_ (Parameters * p) throw()
       output_image_max[index_output] =
 	p->value_float("image_max",-std::numeric_limits<double>::max());
 
-      output_min_level[index_output] = p->value_integer("min_level",0);
-      output_max_level[index_output] =
-	p->value_integer("max_level",std::numeric_limits<int>::max());
+      output_image_resolutions[index_output] =
+	p->value_integer("image_resolutions",1);
+      ASSERT1 ("Config::read()",
+	       "output_image_resolutions[%d] must be at least 1",
+	       index_output, output_image_resolutions[index_output] >= 1);
+
+      output_image_compression[index_output] =
+	p->value_integer("image_compression",1);
+      ASSERT1 ("Config::read()",
+	       "output_image_compression[%d] must be between 0 and 9",
+	       index_output,
+	       (0 <= output_image_compression[index_output] &&
+		output_image_compression[index_output] <= 9));
+
       output_leaf_only[index_output] = p->value_logical("leaf_only",true);
 
       if (p->type("colormap") == parameter_list) {
@@ -1139,6 +1491,9 @@ void Config::read_particle_ (Parameters * p) throw()
 
   particle_batch_size = p->value_integer("Particle:batch_size",1024);
 
+  particle_sort_interval = p->value_integer("Particle:sort_interval",0);
+  particle_sort_disorder = p->value_float("Particle:sort_disorder",0.0);
+
   num_particles = p->list_length("Particle:list"); 
 
   particle_list.resize(num_particles);
@@ -1346,6 +1701,39 @@ void Config::read_performance_ (Parameters * p) throw()
 
   performance_warnings = p->value_logical("Performance:warnings",false);
 
+  performance_critical_path =
+    p->value_logical("Performance:critical_path",false);
+  performance_smp = p->value_logical("Performance:smp",false);
+  performance_message_priority =
+    p->value_logical("Performance:message_priority",false);
+  performance_method_counters =
+    p->value_logical("Performance:method_counters",false);
+  performance_level_counters =
+    p->value_logical("Performance:level_counters",false);
+  performance_level_file = p->value_string("Performance:level_file","");
+
+  performance_trace_file = p->value_string("Performance:trace:file","");
+  performance_trace_size = p->value_integer("Performance:trace:size",100000);
+
+  ASSERT1 ("Config::read_performance_()",
+           "Performance:trace:size %d must be positive",
+           performance_trace_size, (performance_trace_size > 0));
+
+  performance_tune_file = p->value_string("Performance:tune:file","");
+  performance_tune_active = p->value_logical("Performance:tune:active",false);
+  performance_tune_cycles = p->value_integer("Performance:tune:cycles",2);
+  const int num_tune_methods = p->list_length("Performance:tune:methods");
+  performance_tune_methods.resize(num_tune_methods);
+  for (int i=0; i<num_tune_methods; i++) {
+    performance_tune_methods[i] =
+      p->list_value_string(i,"Performance:tune:methods");
+  }
+
+  performance_budget_active =
+    p->value_logical("Performance:budget:active",false);
+  performance_budget_interval =
+    p->value_integer("Performance:budget:interval",0);
+
 #ifdef CONFIG_USE_PROJECTIONS
   
   int i_on = -1;
@@ -1406,6 +1794,25 @@ void Config::read_physics_ (Parameters * p) throw()
 
 //----------------------------------------------------------------------
 
+void Config::read_refresh_ (Parameters * p) throw()
+{
+  //--------------------------------------------------
+  // Refresh
+  //--------------------------------------------------
+
+  refresh_local_copy = p->value_logical("Refresh:local_copy",false);
+
+  refresh_aggregate = p->value_logical("Refresh:aggregate",false);
+  refresh_aggregate_buffer_size =
+    p->value_integer("Refresh:aggregate_buffer_size",65536);
+  refresh_aggregate_flush_count =
+    p->value_integer("Refresh:aggregate_flush_count",256);
+
+  refresh_nocopy_bytes = p->value_integer("Refresh:nocopy_bytes",0);
+}
+
+//----------------------------------------------------------------------
+
 void Config::read_solver_ (Parameters * p) throw()
 {
   //--------------------------------------------------
@@ -1421,6 +1828,9 @@ void Config::read_solver_ (Parameters * p) throw()
   solver_solve_type   .resize(num_solvers);
   solver_iter_max     .resize(num_solvers);
   solver_res_tol      .resize(num_solvers);
+  solver_res_tol_change.resize(num_solvers);
+  solver_res_tol_level.resize(num_solvers);
+  solver_iter_max_level.resize(num_solvers);
   solver_diag_precon  .resize(num_solvers);
   solver_monitor_iter .resize(num_solvers);
   solver_restrict     .resize(num_solvers);
@@ -1454,6 +1864,26 @@ void Config::read_solver_ (Parameters * p) throw()
     solver_res_tol[index_solver] = p->value_float
       (full_name + ":res_tol",1e-6);
 
+    // Adaptive tolerance: relative to the initial residual, and by
+    // level (entry i for level min_level + i, the last one extending)
+
+    solver_res_tol_change[index_solver] = p->value_float
+      (full_name + ":res_tol_change",0.0);
+
+    const int num_res_tol_level =
+      p->list_length(full_name + ":res_tol_level");
+    for (int i=0; i<num_res_tol_level; i++) {
+      solver_res_tol_level[index_solver].push_back
+        (p->list_value_float(i,full_name + ":res_tol_level"));
+    }
+
+    const int num_iter_max_level =
+      p->list_length(full_name + ":iter_max_level");
+    for (int i=0; i<num_iter_max_level; i++) {
+      solver_iter_max_level[index_solver].push_back
+        (p->list_value_integer(i,full_name + ":iter_max_level"));
+    }
+
     solver_diag_precon[index_solver] = p->value_logical
       (full_name + ":diag_precon",false);
     
@@ -1505,6 +1935,7 @@ void Config::read_stopping_ (Parameters * p) throw()
   }
 
   stopping_interval = p->value_integer ( "Stopping:interval" , 1);
+  stopping_dt_level = p->value_logical ( "Stopping:dt_level" , false);
 }
 
 void Config::read_units_ (Parameters * p) throw()
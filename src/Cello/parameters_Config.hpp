@@ -27,6 +27,13 @@ public: // interface
     adapt_list(),
     adapt_interval(0),
     adapt_min_face_rank(0),
+    adapt_batch(false),
+    adapt_precheck(false),
+    adapt_buffer(0),
+    adapt_quiescent_fields(),
+    adapt_quiescent_tolerance(0.0),
+    adapt_quiescent_cycles(0),
+    adapt_quiescent_max_skip(0),
     adapt_type(),
     adapt_field_list(),
     adapt_min_refine(),
@@ -39,6 +46,7 @@ public: // interface
     adapt_output(),
     adapt_schedule_index(),
     balance_schedule_index(0),
+    balance_measure(),
     balance_type(),
     num_boundary(0),
     boundary_list(),
@@ -51,9 +59,12 @@ public: // interface
     field_list(),
     field_alignment(0),
     field_padding(0),
+    field_layout(""),
     field_history(0),
     field_precision(0),
+    field_precision_list(),
     field_prolong(""),
+    field_prolong_cache(false),
     field_restrict(""),
     field_group_list(),
     num_initial(0),
@@ -63,6 +74,8 @@ public: // interface
     initial_time(0.0),
     initial_restart(false),
     initial_restart_dir(""),
+    initial_restart_num_readers(0),
+    initial_restart_prefetch(true),
     initial_trace_name(""),
     initial_trace_field(""),
     initial_trace_mpp(0.0),
@@ -72,20 +85,39 @@ public: // interface
     memory_active(false),
     memory_warning_mb(0.0),
     memory_limit_gb(0.0),
+    memory_fill(false),
+    memory_huge_pages("none"),
     mesh_root_rank(0),
+    mesh_root_mapping("linear"),
     mesh_min_level(0),
     mesh_max_level(0),
     mesh_max_initial_level(0),
     refined_regions_lower(),
     refined_regions_upper(),
+    mesh_initial_bulk_insert(false),
     num_method(0),
     method_courant_global(1.0),
+    method_dataflow(false),
     method_list(),
     method_schedule_index(),
     method_courant(),
+    method_batch(),
+    method_subcycle(),
+    method_max_subcycles(),
+    method_skip_quiescent(),
+    method_codec(),
+    method_codec_tolerance(),
+    method_codec_fields(),
+    method_sparse_refresh(),
+    method_refresh_ghost_depth(),
+    method_overlap(),
+    method_fuse(),
     method_type(),
     monitor_debug(false),
     monitor_verbose(false),
+    monitor_telemetry_target(""),
+    monitor_telemetry_format(""),
+    monitor_telemetry_prefix(""),
     num_output(0),
     output_list(),
     output_type(),
@@ -105,13 +137,25 @@ public: // interface
     output_image_face_rank(),
     output_image_min(),
     output_image_max(),
+    output_image_resolutions(),
+    output_image_compression(),
     output_schedule_index(),
     output_max_level(),
     output_min_level(),
     output_leaf_only(),
+    output_region_lower(),
+    output_region_upper(),
+    output_region_center(),
+    output_region_radius(),
     output_dir(),
     output_stride_write(),
     output_stride_wait(),
+    output_layout(),
+    output_alignment(),
+    output_engine(),
+    output_chunk(),
+    output_filters(),
+    output_precision(),
     output_field_list(),
     output_particle_list(),
     output_name(),
@@ -133,13 +177,34 @@ public: // interface
     particle_attribute_type(),
     particle_batch_size(0),
     particle_group_list(),
+    particle_sort_interval(0),
+    particle_sort_disorder(0.0),
     performance_papi_counters(),
     performance_projections_on_at_start(true),
     performance_warnings(false),
+    performance_critical_path(false),
+    performance_smp(false),
+    performance_message_priority(false),
+    performance_method_counters(false),
+    performance_level_counters(false),
+    performance_level_file(""),
+    performance_trace_file(""),
+    performance_trace_size(0),
     performance_on_schedule_index(-1),
     performance_off_schedule_index(-1),
+    performance_tune_file(""),
+    performance_tune_active(false),
+    performance_tune_cycles(0),
+    performance_tune_methods(),
+    performance_budget_active(false),
+    performance_budget_interval(0),
     num_physics(0),
     physics_list(),
+    refresh_local_copy(false),
+    refresh_aggregate(false),
+    refresh_aggregate_buffer_size(0),
+    refresh_aggregate_flush_count(0),
+    refresh_nocopy_bytes(0),
     num_solvers(),
     solver_list(),
     solver_index(),
@@ -147,6 +212,9 @@ public: // interface
     solver_solve_type(),
     solver_iter_max(),
     solver_res_tol(),
+    solver_res_tol_change(),
+    solver_res_tol_level(),
+    solver_iter_max_level(),
     solver_diag_precon(),
     solver_monitor_iter(),
     solver_restrict(),
@@ -159,6 +227,7 @@ public: // interface
     stopping_time(0.0),
     stopping_seconds(0.0),
     stopping_interval(0),
+    stopping_dt_level(false),
     units_mass(1.0),
     units_density(1.0),
     units_length(1.0),
@@ -179,6 +248,13 @@ public: // interface
       adapt_list(),
       adapt_interval(0),
       adapt_min_face_rank(0),
+      adapt_batch(false),
+      adapt_precheck(false),
+      adapt_buffer(0),
+      adapt_quiescent_fields(),
+      adapt_quiescent_tolerance(0.0),
+      adapt_quiescent_cycles(0),
+      adapt_quiescent_max_skip(0),
       adapt_type(),
       adapt_field_list(),
       adapt_min_refine(),
@@ -191,6 +267,7 @@ public: // interface
       adapt_output(),
       adapt_schedule_index(),
       balance_schedule_index(-1),
+      balance_measure(),
       balance_type(),
       num_boundary(0),
       boundary_list(),
@@ -203,9 +280,12 @@ public: // interface
       field_list(),
       field_alignment(0),
       field_padding(0),
+      field_layout(""),
       field_history(0),
       field_precision(0),
+      field_precision_list(),
       field_prolong(""),
+      field_prolong_cache(false),
       field_restrict(""),
       field_group_list(),
       num_initial(0),
@@ -215,6 +295,8 @@ public: // interface
       initial_time(0.0),
       initial_restart(false),
       initial_restart_dir(""),
+      initial_restart_num_readers(0),
+      initial_restart_prefetch(true),
       initial_trace_name(""),
       initial_trace_field(""),
       initial_trace_mpp(0.0),
@@ -224,20 +306,39 @@ public: // interface
       memory_active(false),
       memory_warning_mb(0.0),
       memory_limit_gb(0.0),
+      memory_fill(false),
+      memory_huge_pages("none"),
       mesh_root_rank(0),
+      mesh_root_mapping("linear"),
       mesh_min_level(0),
       mesh_max_level(0),
       mesh_max_initial_level(0),
       refined_regions_lower(),
       refined_regions_upper(),
+      mesh_initial_bulk_insert(false),
       num_method(0),
       method_courant_global(1.0),
+      method_dataflow(false),
       method_list(),
       method_schedule_index(),
       method_courant(),
+      method_batch(),
+      method_subcycle(),
+      method_max_subcycles(),
+      method_skip_quiescent(),
+      method_codec(),
+      method_codec_tolerance(),
+      method_codec_fields(),
+      method_sparse_refresh(),
+      method_refresh_ghost_depth(),
+      method_overlap(),
+      method_fuse(),
       method_type(),
       monitor_debug(false),
       monitor_verbose(false),
+      monitor_telemetry_target(""),
+      monitor_telemetry_format(""),
+      monitor_telemetry_prefix(""),
       num_output(0),
       output_list(),
       output_type(),
@@ -257,13 +358,25 @@ public: // interface
       output_image_face_rank(),
       output_image_min(),
       output_image_max(),
+      output_image_resolutions(),
+      output_image_compression(),
       output_schedule_index(),
       output_max_level(),
       output_min_level(),
       output_leaf_only(),
+      output_region_lower(),
+      output_region_upper(),
+      output_region_center(),
+      output_region_radius(),
       output_dir(),
       output_stride_write(),
       output_stride_wait(),
+      output_layout(),
+      output_alignment(),
+      output_engine(),
+      output_chunk(),
+      output_filters(),
+      output_precision(),
       output_field_list(),
       output_particle_list(),
       output_name(),
@@ -285,13 +398,34 @@ public: // interface
       particle_attribute_type(),
       particle_batch_size(0),
       particle_group_list(),
+      particle_sort_interval(0),
+      particle_sort_disorder(0.0),
       performance_papi_counters(),
       performance_projections_on_at_start(true),
       performance_warnings(false),
+      performance_critical_path(false),
+      performance_smp(false),
+      performance_message_priority(false),
+      performance_method_counters(false),
+      performance_level_counters(false),
+      performance_level_file(""),
+      performance_trace_file(""),
+      performance_trace_size(0),
       performance_on_schedule_index(-1),
       performance_off_schedule_index(-1),
+      performance_tune_file(""),
+      performance_tune_active(false),
+      performance_tune_cycles(0),
+      performance_tune_methods(),
+      performance_budget_active(false),
+      performance_budget_interval(0),
       num_physics(0),
       physics_list(),
+      refresh_local_copy(false),
+      refresh_aggregate(false),
+      refresh_aggregate_buffer_size(0),
+      refresh_aggregate_flush_count(0),
+      refresh_nocopy_bytes(0),
       num_solvers(),
       solver_list(),
       solver_index(),
@@ -299,6 +433,9 @@ public: // interface
       solver_solve_type(),
       solver_iter_max(),
       solver_res_tol(),
+      solver_res_tol_change(),
+      solver_res_tol_level(),
+      solver_iter_max_level(),
       solver_diag_precon(),
       solver_monitor_iter(),
       solver_restrict(),
@@ -311,6 +448,7 @@ public: // interface
       stopping_time(0.0),
       stopping_seconds(0.0),
       stopping_interval(0),
+      stopping_dt_level(false),
       // Units
       units_mass(1.0),
       units_density(1.0),
@@ -345,6 +483,13 @@ public: // attributes
   std::vector <std::string>  adapt_list;
   int                        adapt_interval;
   int                        adapt_min_face_rank;
+  bool                       adapt_batch;
+  bool                       adapt_precheck;
+  int                        adapt_buffer;
+  std::vector <std::string>  adapt_quiescent_fields;
+  double                     adapt_quiescent_tolerance;
+  int                        adapt_quiescent_cycles;
+  int                        adapt_quiescent_max_skip;
   std::vector <std::string>  adapt_type;
   std::vector 
   < std::vector<std::string> > adapt_field_list;
@@ -361,6 +506,7 @@ public: // attributes
   // Balance (dynamic load balancing)
 
   int                        balance_schedule_index;
+  std::string                balance_measure;
   std::string                balance_type;
 
   // Boundary
@@ -387,9 +533,12 @@ public: // attributes
   std::vector<int>           field_centering [3];
   int                        field_ghost_depth[3];
   int                        field_padding;
+  std::string                field_layout;
   int                        field_history;
   int                        field_precision;
+  std::vector<int>           field_precision_list;
   std::string                field_prolong;
+  bool                       field_prolong_cache;
   std::string                field_restrict;
   std::vector< std::vector<std::string> >  field_group_list;
 
@@ -404,6 +553,8 @@ public: // attributes
   /// restart
   bool                       initial_restart;
   std::string                initial_restart_dir;
+  int                        initial_restart_num_readers;
+  bool                       initial_restart_prefetch;
 
   // InitialTrace
   std::string                initial_trace_name;
@@ -418,25 +569,41 @@ public: // attributes
   bool                       memory_active;
   double                     memory_warning_mb;
   double                     memory_limit_gb;
+  bool                       memory_fill;
+  std::string                memory_huge_pages;
 
   // Mesh
 
   int                        mesh_root_blocks[3];
   int                        mesh_root_rank;
   int                        mesh_root_size[3];
+  std::string                mesh_root_mapping;
   int                        mesh_min_level;
   int                        mesh_max_level;
   int                        mesh_max_initial_level;
   std::vector< std::vector<int> > refined_regions_lower;
   std::vector< std::vector<int> > refined_regions_upper;
+  bool                       mesh_initial_bulk_insert;
 
   // Method
 
   int                        num_method;
   double                     method_courant_global;
+  bool                       method_dataflow;
   std::vector<std::string>   method_list;
   std::vector<int>           method_schedule_index;
   std::vector<double>        method_courant;
+  std::vector<char>          method_batch;
+  std::vector<char>          method_subcycle;
+  std::vector<int>           method_max_subcycles;
+  std::vector<char>          method_skip_quiescent;
+  std::vector<std::string>   method_codec;
+  std::vector<double>        method_codec_tolerance;
+  std::vector< std::vector<std::string> > method_codec_fields;
+  std::vector<char>          method_sparse_refresh;
+  std::vector<int>           method_refresh_ghost_depth;
+  std::vector<char>          method_overlap;
+  std::vector<char>          method_fuse;
   std::vector<std::string>   method_type;
 
 
@@ -444,6 +611,9 @@ public: // attributes
 
   bool                       monitor_debug;
   bool                       monitor_verbose;
+  std::string                monitor_telemetry_target;
+  std::string                monitor_telemetry_format;
+  std::string                monitor_telemetry_prefix;
 
   // Output
 
@@ -466,14 +636,26 @@ public: // attributes
   std::vector < int >         output_image_face_rank;
   std::vector < double>       output_image_min;
   std::vector < double>       output_image_max;
+  std::vector < int >         output_image_resolutions;
+  std::vector < int >         output_image_compression;
   std::vector < int >         output_schedule_index;
   std::vector < int >         output_max_level;
   std::vector < int >         output_min_level;
   std::vector < char >        output_leaf_only;
+  std::vector < std::vector <double> > output_region_lower;
+  std::vector < std::vector <double> > output_region_upper;
+  std::vector < std::vector <double> > output_region_center;
+  std::vector < double >      output_region_radius;
   std::vector < std::vector <std::string> >  output_dir;
   std::string                 output_dir_global;
   std::vector < int >         output_stride_write;
   std::vector < int >         output_stride_wait;
+  std::vector < std::string > output_layout;
+  std::vector < int >         output_alignment;
+  std::vector < std::string > output_engine;
+  std::vector < std::vector <int> >  output_chunk;
+  std::vector < std::vector <std::string> >  output_filters;
+  std::vector < std::vector <std::string> >  output_precision;
   std::vector < std::vector <std::string> >  output_field_list;
   std::vector < std::vector <std::string> > output_particle_list;
   std::vector < std::vector <std::string> >  output_name;
@@ -504,20 +686,44 @@ public: // attributes
 
   int                        particle_batch_size;
   std::vector< std::vector<std::string> >  particle_group_list;
+  int                        particle_sort_interval;
+  double                     particle_sort_disorder;
 
   // Performance
 
   std::vector<std::string>   performance_papi_counters;
   bool                       performance_projections_on_at_start;
   bool                       performance_warnings;
+  bool                       performance_critical_path;
+  bool                       performance_smp;
+  bool                       performance_message_priority;
+  bool                       performance_method_counters;
+  bool                       performance_level_counters;
+  std::string                performance_level_file;
+  std::string                performance_trace_file;
+  int                        performance_trace_size;
   int                        performance_on_schedule_index;
   int                        performance_off_schedule_index;
+  std::string                performance_tune_file;
+  bool                       performance_tune_active;
+  int                        performance_tune_cycles;
+  std::vector<std::string>   performance_tune_methods;
+  bool                       performance_budget_active;
+  int                        performance_budget_interval;
 
   // Physics
   
   int                        num_physics;  // number of physics objects
   std::vector<std::string>   physics_list;
 
+  // Refresh
+
+  bool                       refresh_local_copy;
+  bool                       refresh_aggregate;
+  int                        refresh_aggregate_buffer_size;
+  int                        refresh_aggregate_flush_count;
+  int                        refresh_nocopy_bytes;
+
   // Solvers
 
   int                        num_solvers;
@@ -527,6 +733,9 @@ public: // attributes
   std::vector<std::string>   solver_solve_type;
   std::vector<int>           solver_iter_max;
   std::vector<double>        solver_res_tol;
+  std::vector<double>        solver_res_tol_change;
+  std::vector< std::vector<double> > solver_res_tol_level;
+  std::vector< std::vector<int> >    solver_iter_max_level;
   std::vector<char>          solver_diag_precon;
   std::vector<int>           solver_monitor_iter;
   std::vector<std::string>   solver_restrict;
@@ -542,6 +751,7 @@ public: // attributes
   double                     stopping_time;
   double                     stopping_seconds;
   int                        stopping_interval;
+  bool                       stopping_dt_level;
 
   /// Units
 
@@ -572,6 +782,7 @@ protected: // functions
   void read_particle_    ( Parameters * ) throw();
   void read_performance_ ( Parameters * ) throw();
   void read_physics_     ( Parameters * ) throw();
+  void read_refresh_     ( Parameters * ) throw();
   void read_solver_      ( Parameters * ) throw();
   void read_stopping_    ( Parameters * ) throw();
   void read_testing_     ( Parameters * ) throw();
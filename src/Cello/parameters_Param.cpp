@@ -92,8 +92,10 @@ void Param::pup (PUP::er &p)
     }
   } else if (type_ == parameter_logical_expr) {
     pup_expr_(p,&value_expr_);
+    if (up) compile_expr_();
   } else if (type_ == parameter_float_expr) {
     pup_expr_(p,&value_expr_);
+    if (up) compile_expr_();
   } else if (type_ == parameter_unknown) {
     WARNING("Param::pup","parameter type is unknown");
   }
@@ -315,15 +317,18 @@ std::string Param::value_to_string (int type)
  
 //----------------------------------------------------------------------
 
+std::vector<double> Param::scratch_float_[CONFIG_NODE_SIZE];
+std::vector<char>   Param::scratch_logical_[CONFIG_NODE_SIZE];
+
+//----------------------------------------------------------------------
+
 void Param::evaluate_float
 (int                n, 
  double *           result, 
  double *           x, 
  double *           y, 
  double *           z, 
- double             t,
- struct node_expr * node)
-/// @param node Head node of the tree defining the floating-point expression
+ double             t)
 /// @param n Length of the result buffer
 /// @param result Array in which to store the expression evaluations
 /// @param x Array of X spatial values
@@ -331,212 +336,352 @@ void Param::evaluate_float
 /// @param z Array of Z spatial values
 /// @param t time value
 {
-  if (node == 0) node = value_expr_;
+  value_accessed_ = true;
+  run_program_(n,result,NULL,x,y,z,t);
+}
 
-  double * left  = NULL;
-  double * right = NULL;
+//----------------------------------------------------------------------
 
+void Param::evaluate_logical
+(int                n, 
+ bool   *           result, 
+ double *           x, 
+ double *           y, 
+ double *           z, 
+ double             t)
+/// @param n Length of the result buffer
+/// @param result Array in which to store the expression evaluations
+/// @param x Array of X spatial values
+/// @param y Array of Y spatial values
+/// @param z Array of Z spatial values
+/// @param t Array of time values
+{
   value_accessed_ = true;
+  run_program_(n,NULL,result,x,y,z,t);
+}
+
+//----------------------------------------------------------------------
 
-  if (node->left) {
-    left = new double [n];
-    evaluate_float(n,left,x,y,z,t,node->left);
+void Param::compile_expr_ ()
+{
+  program_.clear();
+  int depth_float = 0;
+  int depth_logical = 0;
+  num_float_slots_ = 0;
+  num_logical_slots_ = 0;
+  if (type_ == parameter_float_expr) {
+    compile_float_(value_expr_,depth_float);
+    // floating-point slot 0 is the result
+    num_float_slots_ = std::max(0,num_float_slots_ - 1);
+    num_logical_slots_ = 0;
+  } else {
+    compile_logical_(value_expr_,depth_float,depth_logical);
+    // logical slot 0 is the result
+    num_logical_slots_ = std::max(0,num_logical_slots_ - 1);
   }
-  if (node->right) {
-    right = new double [n];
-    evaluate_float(n,right,x,y,z,t,node->right);
+}
+
+//----------------------------------------------------------------------
+
+void Param::compile_float_ (struct node_expr * node, int & depth)
+/// @param node Head node of the floating-point subexpression
+/// @param depth Number of floating-point slots in use
+{
+  instr_type instr = { instr_error, 0, 0, 0.0, NULL };
+
+  if (node == NULL) {
+    instr.op = enum_node_unknown;
+    program_.push_back(instr);
+    return;
   }
-  
-  int i;
+
   switch (node->type) {
   case enum_node_operation:
-    ASSERT("Param::evaluate_float()",
-           "node is NULL",
-           (node != NULL));
-    ASSERT3("Param::evaluate_float()",
-	    "Error in operation %d: left %p right %p",
-	    node ? node->op_value:-1,left,right,
-	    ((left != NULL) && (right != NULL)));
     switch (node->op_value) {
-    case enum_op_add: for (i=0; i<n; i++) result[i] = left[i] + right[i]; break;
-    case enum_op_sub: for (i=0; i<n; i++) result[i] = left[i] - right[i]; break;
-    case enum_op_mul: for (i=0; i<n; i++) result[i] = left[i] * right[i]; break;
-    case enum_op_div: for (i=0; i<n; i++) result[i] = left[i] / right[i]; break;
-    case enum_op_pow: for (i=0; i<n; i++) result[i] = pow(left[i], right[i]); break;
+    case enum_op_add:
+    case enum_op_sub:
+    case enum_op_mul:
+    case enum_op_div:
+    case enum_op_pow:
+      instr.op = node->op_value;
+      compile_float_(node->left,depth);
+      if (node->right &&
+          (node->right->type == enum_node_float ||
+           node->right->type == enum_node_integer ||
+           (node->right->type == enum_node_variable &&
+            node->right->var_value == 't'))) {
+        // constant right operand is applied directly, not pushed
+        instr.type = instr_binary_value;
+        if (node->right->type == enum_node_float) {
+          instr.value = node->right->float_value;
+        } else if (node->right->type == enum_node_integer) {
+          instr.value = double(node->right->integer_value);
+        } else {
+          instr.var = 't';
+        }
+      } else {
+        compile_float_(node->right,depth);
+        instr.type = instr_binary;
+        --depth;
+      }
+      break;
     default:
-    case enum_op_le:
-    case enum_op_lt:
-    case enum_op_ge:
-    case enum_op_gt:
-    case enum_op_eq:
-    case enum_op_ne:
-    case enum_op_and:
-    case enum_op_or:
-      ERROR1("Param::evaluate_float",
-	     "logical operator %d in floating-point expression",
-	     node->op_value);
+      // logical operator in floating-point expression
+      instr.op = node->op_value;
       break;
     }
     break;
   case enum_node_float:
-    for (i=0; i<n; i++) result[i] = node->float_value;
+    instr.type  = instr_value;
+    instr.value = node->float_value;
+    ++depth;
     break;
   case enum_node_integer:
-    for (i=0; i<n; i++) result[i] = double(node->integer_value);
+    instr.type  = instr_value;
+    instr.value = double(node->integer_value);
+    ++depth;
     break;
   case enum_node_variable:
-    switch (node->var_value) {
-    case 'x': if (x) for (i=0; i<n; i++) result[i] = x[i]; break;
-    case 'y': if (y) for (i=0; i<n; i++) result[i] = y[i]; break;
-    case 'z': if (z) for (i=0; i<n; i++) result[i] = z[i]; break;
-    case 't': for (i=0; i<n; i++) result[i] = t;    break;
-    default:
-      ERROR1("Param::evaluate_float",
-	     "unknown variable %c in floating-point expression",
-	     node->var_value);
-      break;
+    instr.var = node->var_value;
+    if (node->var_value == 't') {
+      instr.type = instr_value;
+      ++depth;
+    } else if (node->var_value == 'x' ||
+               node->var_value == 'y' ||
+               node->var_value == 'z') {
+      instr.type = instr_variable;
+      ++depth;
     }
     break;
   case enum_node_function:
-    ASSERT2("Param::evaluate_float()",
-	    "Error in function %p: left %p",
-	    node?node->fun_value : NULL, left,
-	    left != NULL);
-    for (i=0; i<n; i++) result[i] = (*(node->fun_value))(left[i]);
+    compile_float_(node->left,depth);
+    instr.type = instr_function;
+    instr.fun  = node->fun_value;
     break;
-  case enum_node_unknown:
   default:
-    ERROR1("Param::evaluate_float",
-	   "unknown expression type %d",
-	   node->type);
     break;
   }
 
-  delete [] left;
-  delete [] right;
+  if (instr.type == instr_error) {
+    // record enough to report the error as evaluate_float() did
+    instr.op  = node->type;
+    instr.var = (node->type == enum_node_variable) ? node->var_value : 0;
+    if (node->type == enum_node_operation) instr.value = node->op_value;
+  }
+
+  program_.push_back(instr);
+  num_float_slots_ = std::max(num_float_slots_,depth);
 }
 
 //----------------------------------------------------------------------
 
-void Param::evaluate_logical
-(int                n, 
- bool   *           result, 
- double *           x, 
- double *           y, 
- double *           z, 
- double             t,
- struct node_expr * node)
-/// @param node Head node of the tree defining the floating-point expression
-/// @param n Length of the result buffer
-/// @param result Array in which to store the expression evaluations
-/// @param x Array of X spatial values
-/// @param y Array of Y spatial values
-/// @param z Array of Z spatial values
-/// @param t Array of time values
+void Param::compile_logical_
+(struct node_expr * node, int & depth_float, int & depth_logical)
+/// @param node Head node of the logical subexpression
+/// @param depth_float Number of floating-point slots in use
+/// @param depth_logical Number of logical slots in use
 {
-  if (node == 0) node = value_expr_;
+  instr_type instr = { instr_error, 0, 0, 0.0, NULL };
 
-  double * left_float  = NULL;
-  double * right_float = NULL;
-  bool * left_logical  = NULL;
-  bool * right_logical = NULL;
+  if (node == NULL || node->type != enum_node_operation) {
+    instr.op = enum_node_unknown;
+    program_.push_back(instr);
+    return;
+  }
 
-  value_accessed_ = true;
+  instr.op = node->op_value;
+  switch (node->op_value) {
+  case enum_op_le:
+  case enum_op_lt:
+  case enum_op_ge:
+  case enum_op_gt:
+  case enum_op_eq:
+  case enum_op_ne:
+    compile_float_(node->left,depth_float);
+    compile_float_(node->right,depth_float);
+    instr.type = instr_compare;
+    depth_float -= 2;
+    ++depth_logical;
+    break;
+  case enum_op_and:
+  case enum_op_or:
+    compile_logical_(node->left,depth_float,depth_logical);
+    compile_logical_(node->right,depth_float,depth_logical);
+    instr.type = instr_logical;
+    --depth_logical;
+    break;
+  default:
+    instr.op = enum_node_unknown;
+    break;
+  }
 
-  // Recurse on left subtree
+  program_.push_back(instr);
+  num_logical_slots_ = std::max(num_logical_slots_,depth_logical);
+}
 
-  if (node->left && (node->left->type == enum_node_operation)) {
-    // left node is an operation
-    if ((node->op_value == enum_op_and) || 
-	(node->op_value == enum_op_or)) {
-      // left node is a logical operation
-      left_logical = new bool [n];
-      evaluate_logical(n,left_logical,x,y,z,t,node->left);
-    } else {
-      // left node is a floating-point operation
-      left_float = new double [n];
-      evaluate_float(n,left_float,x,y,z,t,node->left);
-    }
-  } else {
-    // left node is a floating-point operation
-    left_float = new double [n];
-    evaluate_float(n,left_float,x,y,z,t,node->left);
+//----------------------------------------------------------------------
+
+void Param::run_program_
+(int n, double * result_float, bool * result_logical,
+ double * x, double * y, double * z, double t)
+/// @param n Length of the result buffer
+/// @param result_float Floating-point result, or NULL if logical
+/// @param result_logical Logical result, or NULL if floating-point
+/// @param x Array of X spatial values
+/// @param y Array of Y spatial values
+/// @param z Array of Z spatial values
+/// @param t time value
+{
+  // Floating-point slot k is result_float for k == 0 in a
+  // floating-point expression, and scratch otherwise
+
+  const int in = cello::index_static();
+  std::vector<double> & scratch_float   = scratch_float_[in];
+  std::vector<char>   & scratch_logical = scratch_logical_[in];
+  if (scratch_float.size() < size_t(num_float_slots_)*n) {
+    scratch_float.resize(size_t(num_float_slots_)*n);
+  }
+  if (scratch_logical.size() < size_t(num_logical_slots_)*n) {
+    scratch_logical.resize(size_t(num_logical_slots_)*n);
   }
 
-  // Recurse on left subtree
+  const int offset_float = (result_float != NULL) ? 1 : 0;
+  auto slot_float = [&] (int k)
+    { return (k < offset_float) ? result_float :
+      scratch_float.data() + size_t(k - offset_float)*n; };
+  char * const logical = scratch_logical.data();
 
-  if (node->right && (node->right->type == enum_node_operation)) {
-    // right node exists
-    // right node is an operation
-    if ((node->op_value == enum_op_and) || 
-	(node->op_value == enum_op_or)) {
-      // right node is a logical operation
-      right_logical = new bool [n];
-      evaluate_logical(n,right_logical,x,y,z,t,node->right);
-    } else {
-      // right node is a floating-point operation
-      right_float = new double [n];
-      evaluate_float(n,right_float,x,y,z,t,node->right);
-    }
-  } else {
-    // right node is a floating-point operation
-    right_float = new double [n];
-    evaluate_float(n,right_float,x,y,z,t,node->right);
-  }
-      
+  int depth_float = 0;
+  int depth_logical = 0;
   int i;
-  if (node->type == enum_node_operation) {
-    int op = node->op_value;
-    ASSERT3("Param::evaluate_logical()",
-	    "Error in operation %d: left_float %p right_float %p",
-	    op,left_float,right_float,
-	    (op==enum_op_and || op==enum_op_or) ||
-	    (left_float != NULL && right_float != NULL));
-    ASSERT3("Param::evaluate_logical()",
-	    "Error in operation %d: left_logical %p right_logical %p",
-	    op,left_logical,right_logical,
-	    (op!=enum_op_and && op!=enum_op_or) ||
-	    (left_logical != NULL && right_logical != NULL));
-	    
-    switch (op) {
-    case enum_op_le:
-      for (i=0; i<n; i++) result[i] = left_float[i] <= right_float[i];
-      break;
-    case enum_op_lt:
-      for (i=0; i<n; i++) result[i] = left_float[i] <  right_float[i];
-      break;
-    case enum_op_ge:
-      for (i=0; i<n; i++) result[i] = left_float[i] >= right_float[i];
+  for (const instr_type & instr : program_) {
+
+    switch (instr.type) {
+
+    case instr_value:
+      {
+        double * a = slot_float(depth_float++);
+        const double value = (instr.var == 't') ? t : instr.value;
+        for (i=0; i<n; i++) a[i] = value;
+      }
       break;
-    case enum_op_gt:
-      for (i=0; i<n; i++) result[i] = left_float[i] >  right_float[i];
+
+    case instr_variable:
+      {
+        double * a = slot_float(depth_float++);
+        const double * v = (instr.var == 'x') ? x :
+          (instr.var == 'y') ? y : z;
+        if (v) for (i=0; i<n; i++) a[i] = v[i];
+      }
       break;
-    case enum_op_eq:
-      // warning: comparing equality of doubles
-      for (i=0; i<n; i++) result[i] = left_float[i] == right_float[i];
+
+    case instr_binary:
+    case instr_binary_value:
+      {
+        double * a = slot_float(depth_float - 1);
+        if (instr.type == instr_binary) {
+          const double * b = slot_float(depth_float - 1);
+          a = slot_float(depth_float - 2);
+          --depth_float;
+          switch (instr.op) {
+          case enum_op_add: for (i=0; i<n; i++) a[i] = a[i] + b[i]; break;
+          case enum_op_sub: for (i=0; i<n; i++) a[i] = a[i] - b[i]; break;
+          case enum_op_mul: for (i=0; i<n; i++) a[i] = a[i] * b[i]; break;
+          case enum_op_div: for (i=0; i<n; i++) a[i] = a[i] / b[i]; break;
+          case enum_op_pow: for (i=0; i<n; i++) a[i] = pow(a[i], b[i]); break;
+          }
+        } else {
+          const double b = (instr.var == 't') ? t : instr.value;
+          switch (instr.op) {
+          case enum_op_add: for (i=0; i<n; i++) a[i] = a[i] + b; break;
+          case enum_op_sub: for (i=0; i<n; i++) a[i] = a[i] - b; break;
+          case enum_op_mul: for (i=0; i<n; i++) a[i] = a[i] * b; break;
+          case enum_op_div: for (i=0; i<n; i++) a[i] = a[i] / b; break;
+          case enum_op_pow: for (i=0; i<n; i++) a[i] = pow(a[i], b); break;
+          }
+        }
+      }
       break;
-    case enum_op_ne:
-      // warning: comparing inequality of doubles
-      for (i=0; i<n; i++) result[i] = left_float[i] != right_float[i];
+
+    case instr_function:
+      {
+        double * a = slot_float(depth_float - 1);
+        for (i=0; i<n; i++) a[i] = (*(instr.fun))(a[i]);
+      }
       break;
-    case enum_op_and:
-      for (i=0; i<n; i++) result[i] = left_logical[i] && right_logical[i];
+
+    case instr_compare:
+      {
+        const double * a = slot_float(depth_float - 2);
+        const double * b = slot_float(depth_float - 1);
+        depth_float -= 2;
+        bool * r = result_logical;
+        char * c = logical + size_t(depth_logical - 1)*n;
+        // logical slot 0 is the result
+        if (depth_logical == 0) {
+          switch (instr.op) {
+          case enum_op_le: for (i=0; i<n; i++) r[i] = a[i] <= b[i]; break;
+          case enum_op_lt: for (i=0; i<n; i++) r[i] = a[i] <  b[i]; break;
+          case enum_op_ge: for (i=0; i<n; i++) r[i] = a[i] >= b[i]; break;
+          case enum_op_gt: for (i=0; i<n; i++) r[i] = a[i] >  b[i]; break;
+            // warning: comparing equality of doubles
+          case enum_op_eq: for (i=0; i<n; i++) r[i] = a[i] == b[i]; break;
+          case enum_op_ne: for (i=0; i<n; i++) r[i] = a[i] != b[i]; break;
+          }
+        } else {
+          switch (instr.op) {
+          case enum_op_le: for (i=0; i<n; i++) c[i] = a[i] <= b[i]; break;
+          case enum_op_lt: for (i=0; i<n; i++) c[i] = a[i] <  b[i]; break;
+          case enum_op_ge: for (i=0; i<n; i++) c[i] = a[i] >= b[i]; break;
+          case enum_op_gt: for (i=0; i<n; i++) c[i] = a[i] >  b[i]; break;
+          case enum_op_eq: for (i=0; i<n; i++) c[i] = a[i] == b[i]; break;
+          case enum_op_ne: for (i=0; i<n; i++) c[i] = a[i] != b[i]; break;
+          }
+        }
+        ++depth_logical;
+      }
       break;
-    case enum_op_or:
-      for (i=0; i<n; i++) result[i] = left_logical[i] || right_logical[i];
+
+    case instr_logical:
+      {
+        const char * b = logical + size_t(depth_logical - 2)*n;
+        --depth_logical;
+        if (depth_logical == 1) {
+          bool * r = result_logical;
+          if (instr.op == enum_op_and) {
+            for (i=0; i<n; i++) r[i] = r[i] && b[i];
+          } else {
+            for (i=0; i<n; i++) r[i] = r[i] || b[i];
+          }
+        } else {
+          char * a = logical + size_t(depth_logical - 2)*n;
+          if (instr.op == enum_op_and) {
+            for (i=0; i<n; i++) a[i] = a[i] && b[i];
+          } else {
+            for (i=0; i<n; i++) a[i] = a[i] || b[i];
+          }
+        }
+      }
       break;
+
+    case instr_error:
     default:
-      ERROR1("Param::evaluate_logical",
-	     "unknown expression type %d",
-	     node->type);
+      if (instr.op == enum_node_operation) {
+        ERROR1("Param::evaluate_float",
+               "logical operator %d in floating-point expression",
+               int(instr.value));
+      } else if (instr.op == enum_node_variable) {
+        ERROR1("Param::evaluate_float",
+               "unknown variable %c in floating-point expression",
+               instr.var);
+      } else {
+        ERROR1("Param::evaluate",
+               "unknown expression type %d",
+               instr.op);
+      }
       break;
     }
   }
-
-  delete [] left_float;
-  delete [] right_float;
-  delete [] left_logical;
-  delete [] right_logical;
 }
 
 //----------------------------------------------------------------------
@@ -58,7 +58,10 @@ public: // interface
   /// Initialize a Param object
   Param () 
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      program_(),
+      num_float_slots_(0),
+      num_logical_slots_(0)
   {};
 
   /// Delete a Param object
@@ -68,7 +71,10 @@ public: // interface
   /// Copy constructor
   Param(const Param & param) throw()
     : type_(parameter_unknown),
-      value_accessed_(false)
+      value_accessed_(false),
+      program_(),
+      num_float_slots_(0),
+      num_logical_slots_(0)
   { INCOMPLETE("Param::Param"); };
 
   /// Assignment operator
@@ -86,8 +92,7 @@ public: // interface
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0 );
+    double             t);
 
   /// Evaluate a logical expression given vectos x,y,z,t
   void evaluate_logical  
@@ -96,8 +101,7 @@ public: // interface
     double *           x, 
     double *           y, 
     double *           z, 
-    double             t,
-    struct node_expr * node = 0);
+    double             t);
 
   /// Set the parameter type and value
   void set(struct param_struct * param);
@@ -143,6 +147,21 @@ private: // functions
   /// PUP a logical or floating-point expression (recursive)
   void pup_expr_ (PUP::er &p, struct node_expr ** node);
 
+  /// Compile value_expr_ into program_
+  void compile_expr_ ();
+
+  /// Append the postfix instructions of a floating-point or logical
+  /// subexpression to program_, updating the current slot depth
+  void compile_float_ (struct node_expr * node, int & depth);
+  void compile_logical_ (struct node_expr * node,
+                         int & depth_float, int & depth_logical);
+
+  /// Run program_ on n points, leaving floating-point results in
+  /// result_float or logical results in result_logical
+  void run_program_
+  (int n, double * result_float, bool * result_logical,
+   double * x, double * y, double * z, double t);
+
   /// Set an integer parameter
   void set_integer_ (int value)
   { 
@@ -194,6 +213,7 @@ private: // functions
   { 
     type_ = parameter_float_expr;
     value_expr_     = value; 
+    compile_expr_();
   };
 
   /// Set a logical expression parameter
@@ -201,6 +221,7 @@ private: // functions
   { 
     type_ = parameter_logical_expr;
     value_expr_     = value; 
+    compile_expr_();
   };
 
   /// Deallocate the parameter
@@ -241,6 +262,38 @@ private: // attributes
     struct node_expr * value_expr_;
   };
 
+  /// Instruction of a compiled expression
+  enum instr_enum {
+    instr_value,        // push value ('t' in var: push t)
+    instr_variable,     // push x, y, or z
+    instr_binary,       // pop right, apply op to top
+    instr_binary_value, // apply op to top with value (or t) as right
+    instr_function,     // apply fun to top
+    instr_compare,      // pop two floating-point, push logical
+    instr_logical,      // pop right logical, apply op to top logical
+    instr_error         // invalid expression: reported when evaluated
+  };
+  struct instr_type {
+    instr_enum type;
+    int        op;
+    char       var;
+    double     value;
+    double (*fun)(double);
+  };
+
+  /// Expression compiled to postfix order, so that evaluating it
+  /// neither recurses nor allocates (not packed: rebuilt from
+  /// value_expr_)
+  std::vector<instr_type> program_;
+
+  /// Number of n-length scratch slots program_ needs beyond the result
+  int num_float_slots_;
+  int num_logical_slots_;
+
+  /// Scratch slots shared by all expression parameters
+  static std::vector<double> scratch_float_[CONFIG_NODE_SIZE];
+  static std::vector<char>   scratch_logical_[CONFIG_NODE_SIZE];
+
 };
 
 //----------------------------------------------------------------------
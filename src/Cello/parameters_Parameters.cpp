@@ -18,6 +18,7 @@ Parameters g_parameters;
 Parameters::Parameters(Monitor * monitor) 
   throw()
   : current_group_(),
+    files_(),
     parameter_map_(),
     parameter_tree_("Cello"),
     monitor_(monitor),
@@ -158,11 +159,99 @@ void Parameters::read ( const char * file_name )
 
   fclose(file_pointer);
 
+  files_.clear();
+  for (int i=0; i<cello_parameters_num_files(); i++) {
+    files_.push_back(cello_parameters_file(i));
+  }
+
   if (lmonitor_) monitor_->print ("Parameters","read in %s",file_name);
 }
 
 //----------------------------------------------------------------------
 
+/// Identifies the format of parameter cache files
+#define PARAMETER_CACHE_VERSION "Cello parameter cache 1"
+
+namespace {
+  /// Modification time and size of the given file, or {-1,-1}
+  std::vector<long long> file_stamp_ (const std::string & file_name)
+  {
+    struct stat buffer;
+    if (stat(file_name.c_str(),&buffer) != 0) return {-1,-1};
+    return {(long long)buffer.st_mtime, (long long)buffer.st_size};
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool Parameters::read_cache
+( const char * cache_name, const char * file_name )
+/// @param    cache_name Cache file written by write_cache()
+/// @param    file_name  Parameter file the cache must have been read from
+{
+  FILE * fp = fopen(cache_name,"rb");
+  if (fp == NULL) return false;
+
+  PUP::fromDisk p(fp);
+
+  std::string version;
+  p | version;
+  bool is_valid = (version == PARAMETER_CACHE_VERSION);
+
+  std::vector<std::string> files;
+  std::vector< std::vector<long long> > stamps;
+  if (is_valid) {
+    p | files;
+    p | stamps;
+    is_valid = (files.size() > 0 && files[0] == file_name &&
+                stamps.size() == files.size());
+  }
+  for (size_t i=0; is_valid && i<files.size(); i++) {
+    is_valid = (file_stamp_(files[i]) == stamps[i]);
+  }
+
+  if (is_valid) {
+    p | *this;
+    files_ = files;
+    if (lmonitor_) {
+      monitor_->print ("Parameters","read in %s from cache %s",
+                       file_name,cache_name);
+    }
+  }
+
+  fclose(fp);
+
+  return is_valid;
+}
+
+//----------------------------------------------------------------------
+
+void Parameters::write_cache ( const char * cache_name )
+/// @param    cache_name Cache file to write
+{
+  FILE * fp = fopen(cache_name,"wb");
+  if (fp == NULL) {
+    WARNING1("Parameters::write_cache",
+             "Cannot open parameter cache '%s' for writing",
+             cache_name);
+    return;
+  }
+
+  PUP::toDisk p(fp);
+
+  std::string version = PARAMETER_CACHE_VERSION;
+  p | version;
+  std::vector< std::vector<long long> > stamps;
+  for (const std::string & file : files_) stamps.push_back(file_stamp_(file));
+  p | files_;
+  p | stamps;
+  p | *this;
+
+  fclose(fp);
+}
+
+//----------------------------------------------------------------------
+
 void Parameters::write ( const char * file_name, int type )
 /// @param  file_name   An opened output parameter file or stdout
 {
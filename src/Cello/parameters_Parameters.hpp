@@ -44,6 +44,14 @@ public: // interface
   
   /// Read in parameters from a file
   void read (const char * file_name);
+
+  /// Read parameters from a cache written by write_cache(), returning
+  /// false without reading if the cache is missing or if file_name or
+  /// any file it included has changed since
+  bool read_cache (const char * cache_name, const char * file_name);
+
+  /// Write the parameters last read by read() to a binary cache
+  void write_cache (const char * cache_name);
   /// Write parameters to a file
   void write (const char * file_name, int write_type = param_write_cello);
   void write (FILE * fp, int write_type = param_write_cello);
@@ -301,6 +309,9 @@ private: // attributes
   /// Stack of current grouping
   std::vector <std::string> current_group_;
 
+  /// Parameter file and included files last read (not packed)
+  std::vector <std::string> files_;
+
   /// Map parameter name to Param object
   std::map<std::string, Param *>  parameter_map_;
 
@@ -321,6 +332,9 @@ extern "C" {
   struct param_struct * cello_parameters_read(const char *, FILE *);
   /// C function for printing parameters to stdout
   void cello_parameters_print();
+  /// C functions for the files opened by cello_parameters_read()
+  int cello_parameters_num_files();
+  const char * cello_parameters_file(int i);
 }
 
 extern Parameters g_parameters;
@@ -0,0 +1,111 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Budget.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    Implementation of the Budget class
+
+#include "performance.hpp"
+#include "monitor.hpp"
+
+#include <numeric>
+
+//----------------------------------------------------------------------
+
+Budget::Budget (int interval) throw()
+  : interval_(interval),
+    time_last_(-1.0),
+    cycle_times_(),
+    part_times_()
+{
+  ASSERT1 ("Budget::Budget()",
+           "Performance:budget:interval %d must not be negative",
+           interval_, (interval_ >= 0));
+
+  std::fill_n (totals_last_, num_budget_part, 0.0);
+}
+
+//----------------------------------------------------------------------
+
+bool Budget::cycle
+(double time, const double totals[num_budget_part], double idle) throw()
+{
+  if (time_last_ < 0.0) {
+    // the first cycle includes initialization, so only starts timing
+    time_last_ = time;
+    std::copy_n (totals, num_budget_part, totals_last_);
+    return false;
+  }
+
+  const double time_cycle = time - time_last_;
+  cycle_times_.push_back(time_cycle);
+
+  double time_parts = 0.0;
+  for (int i=0; i<num_budget_part; i++) {
+    double time_part = 0.0;
+    if (i == budget_idle) {
+      time_part = idle;
+    } else if (i == budget_other) {
+      time_part = std::max(0.0, time_cycle - time_parts);
+    } else {
+      time_part = std::max(0.0, totals[i] - totals_last_[i]);
+    }
+    part_times_[i].push_back(time_part);
+    time_parts += time_part;
+  }
+
+  time_last_ = time;
+  std::copy_n (totals, num_budget_part, totals_last_);
+
+  return (interval_ > 0) && (cycle_times_.size() % interval_ == 0);
+}
+
+//----------------------------------------------------------------------
+
+void Budget::write () const throw()
+{
+  const int n = cycle_times_.size();
+  if (n == 0) return;
+
+  // mean and nearest-rank percentiles of a copy of the samples
+  struct Stat {
+    double mean, p50, p95, p99;
+    Stat (std::vector<double> v) {
+      const int n = v.size();
+      mean = std::accumulate(v.begin(),v.end(),0.0) / n;
+      std::sort(v.begin(),v.end());
+      auto rank = [&] (double p)
+        { return v[std::max(0,int(std::ceil(p*n)) - 1)]; };
+      p50 = rank(0.50);
+      p95 = rank(0.95);
+      p99 = rank(0.99);
+    }
+  };
+
+  Monitor * monitor = Monitor::instance();
+
+  const Stat cycle (cycle_times_);
+  monitor->print
+    ("Performance","budget cycles %d cycle-sec mean %.6f "
+     "p50 %.6f p95 %.6f p99 %.6f",
+     n, cycle.mean, cycle.p50, cycle.p95, cycle.p99);
+
+  for (int i=0; i<num_budget_part; i++) {
+    const Stat part (part_times_[i]);
+    monitor->print
+      ("Performance","budget %s-sec mean %.6f (%.1f%%) "
+       "p50 %.6f p95 %.6f p99 %.6f",
+       part_name(i), part.mean,
+       (cycle.mean > 0.0) ? 100.0*part.mean/cycle.mean : 0.0,
+       part.p50, part.p95, part.p99);
+  }
+}
+
+//----------------------------------------------------------------------
+
+const char * Budget::part_name (int part) throw()
+{
+  static const char * names[num_budget_part] =
+    { "compute", "refresh", "adapt", "output", "reductions", "idle", "other" };
+  return names[part];
+}
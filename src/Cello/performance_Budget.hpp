@@ -0,0 +1,78 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Budget.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Performance] Declaration of the Budget class
+
+#ifndef PERFORMANCE_BUDGET_HPP
+#define PERFORMANCE_BUDGET_HPP
+
+/// @enum     budget_part
+/// @brief    Parts of a cycle reported by Budget
+enum budget_part {
+  budget_compute,     // "compute" region
+  budget_refresh,     // "refresh_*" regions
+  budget_adapt,       // "adapt_*" regions
+  budget_output,      // "output" region
+  budget_reductions,  // "stopping" region: timestep and stopping reductions
+  budget_idle,        // scheduler idle time
+  budget_other,       // remainder of the cycle's wall time
+  num_budget_part
+};
+
+class Budget {
+
+  /// @class    Budget
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Per-cycle latency budget
+  ///
+  /// Splits the wall time of each cycle into the time the average
+  /// process spent in compute, refresh, adapt, output, reductions,
+  /// and idle, with the remainder as "other", and reports the mean
+  /// and the 50th, 95th, and 99th percentiles over cycles of the
+  /// cycle time and of each part.  Region times come from the
+  /// Performance regions and idle time from scheduler idle tracking,
+  /// both summed over processes by the performance reduction.  Only
+  /// the root process records cycles.
+
+public: // interface
+
+  /// Create a Budget reporting every interval cycles, or only when
+  /// write() is called if interval is 0
+  Budget (int interval) throw();
+
+  /// Record a cycle ending at the given wall time, given for each
+  /// part except idle and other the time in seconds the average
+  /// process has spent in it since the start of the simulation, and
+  /// the average idle time since the previous cycle.  Returns whether
+  /// a report is due.
+  bool cycle (double time, const double totals[num_budget_part],
+              double idle) throw();
+
+  /// Print the report using the Monitor
+  void write () const throw();
+
+  /// Name of the part
+  static const char * part_name (int part) throw();
+
+private: // attributes
+
+  /// Cycles between reports
+  int interval_;
+
+  /// Wall time of the previous cycle, or negative before the first
+  double time_last_;
+
+  /// Totals of the previous cycle
+  double totals_last_[num_budget_part];
+
+  /// Cycle wall times in seconds
+  std::vector<double> cycle_times_;
+
+  /// Time of each part in each cycle in seconds
+  std::vector<double> part_times_[num_budget_part];
+
+};
+
+#endif /* PERFORMANCE_BUDGET_HPP */
@@ -0,0 +1,156 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_HwCounters.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the HwCounters class
+
+#include "cello.hpp"
+
+#include "performance.hpp"
+
+#ifdef __linux__
+#  include <linux/perf_event.h>
+#  include <sys/ioctl.h>
+#  include <sys/syscall.h>
+#endif
+
+//----------------------------------------------------------------------
+
+HwCounters::~HwCounters() throw()
+{
+#ifdef CONFIG_USE_PAPI
+  if (event_set_ != -1) {
+    long long values[num_hw_event];
+    PAPI_stop (event_set_,values);
+    PAPI_cleanup_eventset (event_set_);
+    PAPI_destroy_eventset (&event_set_);
+  }
+#endif
+#ifdef __linux__
+  for (int i=0; i<num_hw_event; i++) {
+    if (fd_[i] >= 0) close (fd_[i]);
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+
+bool HwCounters::init() throw()
+{
+#ifdef CONFIG_USE_PAPI
+
+  // PAPI first, since it also has floating-point operations
+
+  if (PAPI_is_initialized() == PAPI_NOT_INITED) {
+    PAPI_library_init(PAPI_VER_CURRENT);
+  }
+
+  int event_set = PAPI_NULL;
+  if (PAPI_create_eventset(&event_set) == PAPI_OK) {
+    const int papi_code[num_hw_event] =
+      { PAPI_TOT_CYC, PAPI_TOT_INS, PAPI_L3_TCM, PAPI_DP_OPS };
+    int num_events = 0;
+    for (int i=0; i<num_hw_event; i++) {
+      papi_event_[i] = -1;
+      int retval = PAPI_add_event(event_set,papi_code[i]);
+      if (retval != PAPI_OK && i == hw_event_fp_ops) {
+        retval = PAPI_add_event(event_set,PAPI_FP_OPS);
+      }
+      if (retval == PAPI_OK) papi_event_[i] = num_events++;
+    }
+    if (num_events > 0 && PAPI_start(event_set) == PAPI_OK) {
+      event_set_ = event_set;
+      backend_ = "papi";
+      return true;
+    }
+    // e.g. Performance:papi:counters already running
+    PAPI_cleanup_eventset (event_set);
+    PAPI_destroy_eventset (&event_set);
+  }
+
+#endif
+
+#ifdef __linux__
+
+  const unsigned long long perf_config[num_hw_event] =
+    { PERF_COUNT_HW_CPU_CYCLES,
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES,
+      0 };
+
+  bool is_open = false;
+  for (int i=0; i<num_hw_event; i++) {
+    if (i == hw_event_fp_ops) continue;
+    struct perf_event_attr attr;
+    memset (&attr,0,sizeof(attr));
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.size           = sizeof(attr);
+    attr.config         = perf_config[i];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+    // calling thread on any cpu
+    fd_[i] = syscall (__NR_perf_event_open,&attr,0,-1,-1,0);
+    if (fd_[i] >= 0) {
+      ioctl (fd_[i],PERF_EVENT_IOC_RESET,0);
+      ioctl (fd_[i],PERF_EVENT_IOC_ENABLE,0);
+      is_open = true;
+    }
+  }
+  if (is_open) {
+    backend_ = "perf_event";
+    return true;
+  }
+
+#endif
+
+  return false;
+}
+
+//----------------------------------------------------------------------
+
+bool HwCounters::has_event (int event) const throw()
+{
+#ifdef CONFIG_USE_PAPI
+  if (event_set_ != -1) return papi_event_[event] >= 0;
+#endif
+  return fd_[event] >= 0;
+}
+
+//----------------------------------------------------------------------
+
+void HwCounters::read (long long * values) const throw()
+{
+  for (int i=0; i<num_hw_event; i++) values[i] = 0;
+
+#ifdef CONFIG_USE_PAPI
+  if (event_set_ != -1) {
+    long long papi_values[num_hw_event];
+    PAPI_read (event_set_,papi_values);
+    for (int i=0; i<num_hw_event; i++) {
+      if (papi_event_[i] >= 0) values[i] = papi_values[papi_event_[i]];
+    }
+    return;
+  }
+#endif
+
+#ifdef __linux__
+  for (int i=0; i<num_hw_event; i++) {
+    if (fd_[i] >= 0) {
+      long long value;
+      if (::read (fd_[i],&value,sizeof(value)) == sizeof(value)) {
+        values[i] = value;
+      }
+    }
+  }
+#endif
+}
+
+//----------------------------------------------------------------------
+
+const char * HwCounters::event_name (int event) throw()
+{
+  static const char * name[num_hw_event] =
+    { "cycles", "instructions", "llc-misses", "fp-ops" };
+  return name[event];
+}
@@ -0,0 +1,90 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_HwCounters.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Performance] Declaration of the HwCounters class
+
+#ifndef PERFORMANCE_HW_COUNTERS_HPP
+#define PERFORMANCE_HW_COUNTERS_HPP
+
+/// @enum     hw_event_enum
+/// @brief    Hardware events counted by HwCounters
+enum hw_event_enum {
+  hw_event_cycles,
+  hw_event_instructions,
+  hw_event_llc_misses,
+  hw_event_fp_ops,
+  num_hw_event
+};
+
+class HwCounters {
+
+  /// @class    HwCounters
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Fixed set of hardware event counters
+  /// for the calling thread
+  ///
+  /// Counts cycles, instructions, last-level cache misses, and
+  /// floating-point operations, using PAPI if available, otherwise
+  /// Linux perf_event_open().  Events that cannot be counted read as
+  /// zero; in particular perf_event has no portable floating-point
+  /// operation event.  Unlike Papi, which counts the user-selected
+  /// Performance:papi:counters globally, these are read around
+  /// individual Method computations.
+
+public: // interface
+
+  /// Bytes per cache line, for estimating memory traffic from
+  /// last-level cache misses
+  static const int cache_line_bytes = 64;
+
+  /// Constructor
+  HwCounters() throw()
+    : backend_(),
+#ifdef CONFIG_USE_PAPI
+      event_set_(-1),
+      papi_event_(),
+#endif
+      fd_()
+  {
+    for (int i=0; i<num_hw_event; i++) fd_[i] = -1;
+  }
+
+  /// Close any open counters
+  ~HwCounters() throw();
+
+  /// Open and start the counters, returning whether any are available
+  bool init() throw();
+
+  /// Name of the counting interface in use: "papi", "perf_event", or
+  /// "" if none
+  const std::string & backend() const throw()
+  { return backend_; }
+
+  /// Whether the given event is counted
+  bool has_event (int event) const throw();
+
+  /// Read the current event counts into values[num_hw_event]
+  void read (long long * values) const throw();
+
+  /// Name of the given event
+  static const char * event_name (int event) throw();
+
+private: // attributes
+
+  /// Counting interface in use
+  std::string backend_;
+
+#ifdef CONFIG_USE_PAPI
+  /// PAPI event set
+  int event_set_;
+  /// Position of each event in the PAPI event set, or -1
+  int papi_event_[num_hw_event];
+#endif
+
+  /// perf_event file descriptor of each event, or -1
+  int fd_[num_hw_event];
+};
+
+#endif /* PERFORMANCE_HW_COUNTERS_HPP */
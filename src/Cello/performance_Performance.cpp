@@ -33,8 +33,22 @@ Performance::Performance (Config * config)
   papi_counters_(0),
 #endif
   warnings_(config ? config->performance_warnings : false),
-  index_region_current_(perf_unknown)
+  index_region_current_(perf_unknown),
+  trace_file_(config ? config->performance_trace_file : ""),
+  trace_event_(),
+  trace_next_(0),
+  trace_wrapped_(false),
+  trace_name_(),
+  trace_name_index_(),
+  idle_time_(0),
+  idle_start_(0),
+  hw_counters_(),
+  method_counters_(),
+  method_counters_stack_()
 {
+  if (trace_file_ != "") {
+    trace_event_.resize(config->performance_trace_size);
+  }
 
   const int in = cello::index_static();
 
@@ -47,6 +61,9 @@ Performance::Performance (Config * config)
   new_counter(counter_type_abs,"bytes-high");
   new_counter(counter_type_abs,"bytes-highest");
   new_counter(counter_type_abs,"bytes-available");
+  // FIELD FACE ENCODING
+  new_counter(counter_type_user,"codec-bytes-in");
+  new_counter(counter_type_user,"codec-bytes-out");
 
 #ifdef CONFIG_USE_PAPI  
   papi_.init();
@@ -93,6 +110,190 @@ Performance::end() throw()
 #ifdef TRACE_PERFORMANCE
   CkPrintf ("%d TRACE_PERFORMANCE Performance::end()\n",CkMyPe());
 #endif
+  if (trace_active()) trace_write();
+}
+
+//----------------------------------------------------------------------
+
+void Performance::idle_enable () throw()
+{
+  CcdCallOnConditionKeep (CcdPROCESSOR_BEGIN_IDLE,
+                          (CcdCondFn) Performance::idle_begin_, this);
+  CcdCallOnConditionKeep (CcdPROCESSOR_END_IDLE,
+                          (CcdCondFn) Performance::idle_end_, this);
+}
+
+//----------------------------------------------------------------------
+
+bool Performance::method_counters_enable (int num_methods) throw()
+{
+  if (! hw_counters_.init()) return false;
+  method_counters_.assign(num_methods*method_counters_length,0);
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+void Performance::method_counters_start () throw()
+{
+  const int n = method_counters_stack_.size();
+  method_counters_stack_.resize(n + method_counters_length);
+  method_counters_read_(method_counters_stack_.data() + n);
+}
+
+//----------------------------------------------------------------------
+
+void Performance::method_counters_stop (int index_method) throw()
+{
+  long long values[method_counters_length];
+  method_counters_read_(values);
+
+  const int n = method_counters_stack_.size() - method_counters_length;
+  ASSERT1 ("Performance::method_counters_stop()",
+           "method_counters_stop() for Method %d without a start",
+           index_method, (n >= 0));
+
+  long long * start  = method_counters_stack_.data() + n;
+  long long * method = method_counters_.data()
+    + index_method*method_counters_length;
+
+  for (int i=0; i<method_counters_length; i++) {
+    const long long delta = values[i] - start[i];
+    method[i] += delta;
+    // exclude from the enclosing computation, if any
+    if (n > 0) start[i - method_counters_length] += delta;
+  }
+
+  method_counters_stack_.resize(n);
+}
+
+//----------------------------------------------------------------------
+
+void Performance::method_counters_take (long long * values) throw()
+{
+  std::copy (method_counters_.begin(),method_counters_.end(),values);
+  std::fill (method_counters_.begin(),method_counters_.end(),0);
+}
+
+//----------------------------------------------------------------------
+
+void Performance::level_compute_stop (int level) throw()
+{
+  ASSERT1 ("Performance::level_compute_stop()",
+           "level_compute_stop() for level %d without a start",
+           level, (! level_compute_stack_.empty()));
+
+  const long long delta = trace_time() - level_compute_stack_.back();
+  level_compute_stack_.pop_back();
+  level_counter_add (level,level_counter_compute_nsec,delta);
+  // exclude from the enclosing computation, if any
+  if (! level_compute_stack_.empty()) level_compute_stack_.back() += delta;
+}
+
+//----------------------------------------------------------------------
+
+void Performance::level_counters_take (long long * values) throw()
+{
+  std::copy (level_counters_.begin(),level_counters_.end(),values);
+  std::fill (level_counters_.begin(),level_counters_.end(),0);
+}
+
+//----------------------------------------------------------------------
+
+void Performance::idle_begin_ (void * performance, double time)
+{
+  Performance * p = (Performance *) performance;
+  p->idle_start_ = p->trace_time();
+}
+
+//----------------------------------------------------------------------
+
+void Performance::idle_end_ (void * performance, double time)
+{
+  Performance * p = (Performance *) performance;
+  if (p->idle_start_ > 0) {
+    p->idle_time_ += p->trace_time() - p->idle_start_;
+    p->idle_start_ = 0;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Performance::trace_add_
+(char phase, const std::string & name, const std::string & block,
+ long long time, long long duration) throw()
+{
+  if (! trace_active()) return;
+
+  TraceEvent & event = trace_event_[trace_next_];
+  event.time     = time;
+  event.duration = duration;
+  event.name     = trace_name_index_of_(name);
+  event.block    = trace_name_index_of_(block);
+  event.phase    = phase;
+
+  if (++trace_next_ == int(trace_event_.size())) {
+    trace_next_ = 0;
+    trace_wrapped_ = true;
+  }
+}
+
+//----------------------------------------------------------------------
+
+int Performance::trace_name_index_of_ (const std::string & name) throw()
+{
+  auto it = trace_name_index_.find(name);
+  if (it != trace_name_index_.end()) return it->second;
+  const int index = trace_name_.size();
+  trace_name_.push_back(name);
+  trace_name_index_[name] = index;
+  return index;
+}
+
+//----------------------------------------------------------------------
+
+void Performance::trace_write () const throw()
+{
+  char file_name[256];
+  snprintf (file_name,sizeof(file_name),trace_file_.c_str(),CkMyPe());
+
+  FILE * fp = fopen (file_name,"w");
+
+  if (fp == nullptr) {
+    WARNING1 ("Performance::trace_write()",
+              "Cannot open trace file %s for writing", file_name);
+    return;
+  }
+
+  // oldest event first
+
+  const int n = trace_event_.size();
+  const int i0 = trace_wrapped_ ? trace_next_ : 0;
+  const int ne = trace_wrapped_ ? n : trace_next_;
+
+  // processes are Chrome trace "pid"s so per-process files can be
+  // loaded together; Blocks are async event ids
+
+  const int pe = CkMyPe();
+  fprintf (fp,"{\"traceEvents\":[\n");
+  for (int k=0; k<ne; k++) {
+    const TraceEvent & event = trace_event_[(i0 + k) % n];
+    const char * name  = trace_name_[event.name].c_str();
+    const char * block = trace_name_[event.block].c_str();
+    fprintf (fp,"%s{\"name\":\"%s\",\"cat\":\"cello\",\"ph\":\"%c\","
+             "\"ts\":%.3f,\"pid\":%d,\"tid\":%d,",
+             (k > 0) ? ",\n" : "", name, event.phase,
+             1e-3*event.time, pe, pe);
+    if (event.phase == 'X') {
+      fprintf (fp,"\"dur\":%.3f,\"args\":{\"block\":\"%s\"}}",
+               1e-3*event.duration, block);
+    } else {
+      fprintf (fp,"\"id2\":{\"local\":\"%s\"},"
+               "\"args\":{\"block\":\"%s\"}}", block, block);
+    }
+  }
+  fprintf (fp,"\n]}\n");
+  fclose (fp);
 }
 
 //----------------------------------------------------------------------
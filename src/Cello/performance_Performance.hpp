@@ -27,10 +27,22 @@ enum index_enum {
   perf_index_bytes_high,
   perf_index_bytes_highest,
   perf_index_bytes_available,
+  perf_index_codec_bytes_in,
+  perf_index_codec_bytes_out,
   perf_index_last,
   num_perf_index = perf_index_last
 };
   
+/// @enum    level_counter_enum
+/// @brief   Per-level costs accumulated by the Performance object
+enum level_counter_enum {
+  level_counter_compute_nsec,
+  level_counter_refresh_msgs,
+  level_counter_refresh_bytes,
+  level_counter_particles,
+  num_level_counter
+};
+
 /// @enum    perf_region
 /// @brief   region ID's for the Simulation performance object
 enum perf_region {
@@ -89,7 +101,21 @@ public: // interface
      papi_counters_(0),
 #endif
      warnings_(false),
-     index_region_current_(perf_unknown)
+     index_region_current_(perf_unknown),
+     trace_file_(),
+     trace_event_(),
+     trace_next_(0),
+     trace_wrapped_(false),
+     trace_name_(),
+     trace_name_index_(),
+     idle_time_(0),
+     idle_start_(0),
+     hw_counters_(),
+     method_counters_(),
+     method_counters_stack_(),
+     min_level_(0),
+     level_counters_(),
+     level_compute_stack_()
   {};
 
   /// Initialize a Performance object
@@ -123,6 +149,7 @@ public: // interface
 #endif    
     p | warnings_;
     p | index_region_current_;
+    // trace events are local to the process and are not pupped
   }
 
   /// Begin collecting performance data
@@ -196,11 +223,148 @@ public: // interface
   Papi * papi() { return &papi_; };
 #endif  
 
+  //--------------------------------------------------
+  // TRACE EVENTS
+  //--------------------------------------------------
+
+  /// Whether trace events are recorded (Performance:trace:file)
+  bool trace_active() const throw()
+  { return ! trace_event_.empty(); }
+
+  /// Return the trace clock in nanoseconds
+  long long trace_time() const throw()
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>
+      (std::chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /// Record a region on a Block that started at time_start and
+  /// ends now
+  void trace_complete (const std::string & name, const std::string & block,
+                       long long time_start) throw()
+  { trace_add_ ('X',name,block,time_start,trace_time()-time_start); }
+
+  /// Record the beginning of a region on a Block that may span
+  /// several entry methods, for example a refresh
+  void trace_begin (const std::string & name,
+                    const std::string & block) throw()
+  { trace_add_ ('b',name,block,trace_time(),0); }
+
+  /// Record the end of a region started with trace_begin()
+  void trace_end (const std::string & name,
+                  const std::string & block) throw()
+  { trace_add_ ('e',name,block,trace_time(),0); }
+
+  /// Write recorded trace events of this process in Chrome trace
+  /// format, readable by Perfetto and chrome://tracing
+  void trace_write () const throw();
+
+  //--------------------------------------------------
+  // IDLE TIME
+  //--------------------------------------------------
+
+  /// Start accumulating time the scheduler of this process is idle
+  /// (Performance:critical_path)
+  void idle_enable () throw();
+
+  /// Return idle time in usec since the last call, and reset it
+  long long idle_take () throw()
+  {
+    const long long idle = idle_time_/1000;
+    idle_time_ = 0;
+    return idle;
+  }
+
+  //--------------------------------------------------
+  // METHOD HARDWARE COUNTERS
+  //--------------------------------------------------
+
+  /// Number of values per Method: time in nsec, then the hw_event_enum
+  /// event counts
+  static const int method_counters_length = num_hw_event + 1;
+
+  /// Start counting hardware events for num_methods Methods
+  /// (Performance:method_counters), returning whether any are available
+  bool method_counters_enable (int num_methods) throw();
+
+  /// Whether hardware events are counted for Methods
+  bool method_counters_active() const throw()
+  { return ! method_counters_.empty(); }
+
+  /// Return the hardware counters
+  const HwCounters & hw_counters() const throw()
+  { return hw_counters_; }
+
+  /// Begin counting for a Method computation.  Computations may nest,
+  /// e.g. if a Method's compute_done() starts the next Method, and
+  /// counts of nested computations are excluded from the enclosing one
+  void method_counters_start () throw();
+
+  /// End counting for the innermost Method computation, adding the
+  /// counts to the given Method
+  void method_counters_stop (int index_method) throw();
+
+  /// Copy counts accumulated since the last call into
+  /// values[num_methods*method_counters_length], and reset them
+  void method_counters_take (long long * values) throw();
+
+  //--------------------------------------------------
+  // PER-LEVEL COSTS
+  //--------------------------------------------------
+
+  /// Start accumulating costs of mesh levels min_level to max_level
+  /// (Performance:level_counters)
+  void level_counters_enable (int min_level, int max_level) throw()
+  {
+    min_level_ = min_level;
+    level_counters_.assign((max_level-min_level+1)*num_level_counter,0);
+  }
+
+  /// Whether per-level costs are accumulated
+  bool level_counters_active() const throw()
+  { return ! level_counters_.empty(); }
+
+  /// Add to a level_counter_enum counter of the given level
+  void level_counter_add (int level, int counter, long long value) throw()
+  { level_counters_[(level-min_level_)*num_level_counter + counter] += value; }
+
+  /// Begin timing a Block computation.  As with method_counters_start()
+  /// nested computations are excluded from the enclosing one
+  void level_compute_start () throw()
+  { level_compute_stack_.push_back(trace_time()); }
+
+  /// End timing the innermost Block computation, adding it to the level
+  void level_compute_stop (int level) throw();
+
+  /// Copy counters accumulated since the last call into
+  /// values[num_levels*num_level_counter], and reset them
+  void level_counters_take (long long * values) throw();
+
 private: // functions
 
   /// Refresh the array of current counter values
   void refresh_counters_() throw();
 
+  /// Append an event to the trace ring buffer, overwriting the oldest
+  void trace_add_ (char phase, const std::string & name,
+                   const std::string & block,
+                   long long time, long long duration) throw();
+
+  /// Charm++ scheduler idle callbacks
+  static void idle_begin_ (void * performance, double time);
+  static void idle_end_ (void * performance, double time);
+
+  /// Read the current time and hardware event counts into
+  /// values[method_counters_length]
+  void method_counters_read_ (long long * values) const throw()
+  {
+    values[0] = trace_time();
+    hw_counters_.read(values + 1);
+  }
+
+  /// Return the index of the given trace name, adding it if needed
+  int trace_name_index_of_ (const std::string & name) throw();
+
   /// Return the current time in usec
   long long time_real_ () const
   {
@@ -256,6 +420,58 @@ private: // attributes
 
   /// Last region index started
   int index_region_current_;
+
+  /// Trace event in the ring buffer
+  struct TraceEvent {
+    long long time;
+    long long duration;
+    int name;
+    int block;
+    char phase;
+  };
+
+  /// Trace file name format, with a single integer conversion for the
+  /// process rank
+  std::string trace_file_;
+
+  /// Ring buffer of trace events; empty if tracing is disabled
+  std::vector<TraceEvent> trace_event_;
+
+  /// Index of the next trace event to write
+  int trace_next_;
+
+  /// Whether the ring buffer has been overwritten
+  bool trace_wrapped_;
+
+  /// Region and Block names referenced by trace events
+  std::vector<std::string> trace_name_;
+  std::map<std::string,int> trace_name_index_;
+
+  /// Accumulated scheduler idle time in nanoseconds
+  long long idle_time_;
+
+  /// Start of the current idle period, or 0 if not idle
+  long long idle_start_;
+
+  /// Hardware event counters for Method computations; local to the
+  /// process and not pupped
+  HwCounters hw_counters_;
+
+  /// Accumulated time and event counts of each Method
+  std::vector<long long> method_counters_;
+
+  /// Starting values of the Method computations in progress,
+  /// method_counters_length per level of nesting
+  std::vector<long long> method_counters_stack_;
+
+  /// Coarsest level of level_counters_
+  int min_level_;
+
+  /// Accumulated level_counter_enum counters of each level
+  std::vector<long long> level_counters_;
+
+  /// Starting times of Block computations in progress
+  std::vector<long long> level_compute_stack_;
 };
 
 #endif /* PERFORMANCE_PERFORMANCE_HPP */
@@ -0,0 +1,136 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Tuner.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    Implementation of the Tuner class
+
+#include "performance.hpp"
+#include "monitor.hpp"
+
+#include <fstream>
+
+//----------------------------------------------------------------------
+
+Tuner::Tuner (std::string file, bool active, int cycles_per_trial) throw()
+  : file_(file),
+    active_(active),
+    cycles_per_trial_(cycles_per_trial),
+    values_file_(),
+    parameters_(),
+    index_parameter_(0),
+    index_value_(0),
+    cycle_trial_(-2),
+    time_start_(0.0)
+{
+  ASSERT1 ("Tuner::Tuner()",
+           "Performance:tune:cycles %d must be positive",
+           cycles_per_trial_, (cycles_per_trial_ > 0));
+
+  ASSERT ("Tuner::Tuner()",
+          "Performance:tune:active requires Performance:tune:file",
+          (! active_ || file_ != ""));
+
+  if (! active_ && file_ != "") {
+    // one "name value" pair per line
+    std::ifstream stream (file_);
+    std::string name;
+    int value;
+    while (stream >> name >> value) values_file_[name] = value;
+  }
+}
+
+//----------------------------------------------------------------------
+
+void Tuner::add_parameter
+(std::string name, std::vector<int> values,
+ std::function<void(int)> set) throw()
+{
+  if (active_) {
+    ASSERT1 ("Tuner::add_parameter()",
+             "Parameter %s has no candidate values",
+             name.c_str(), (values.size() > 0));
+    parameters_.push_back
+      ({name, values, set, 0, std::numeric_limits<double>::max()});
+  } else {
+    auto it = values_file_.find(name);
+    if (it != values_file_.end()) set(it->second);
+  }
+}
+
+//----------------------------------------------------------------------
+
+double Tuner::cycle (double time) throw()
+{
+  if (! is_tuning() || cycle_trial_ == -1) return -1.0;
+
+  if (cycle_trial_ == -2) {
+    // start trials at a cycle boundary
+    trial_begin_();
+    time_start_ = time;
+    cycle_trial_ = 0;
+    return -1.0;
+  }
+
+  if (++cycle_trial_ < cycles_per_trial_) return -1.0;
+
+  cycle_trial_ = -1;
+  return time - time_start_;
+}
+
+//----------------------------------------------------------------------
+
+void Tuner::trial_result (double time) throw()
+{
+  Parameter & parameter = parameters_[index_parameter_];
+
+  if (time < parameter.time_best) {
+    parameter.time_best = time;
+    parameter.index_best = index_value_;
+  }
+
+  if (++index_value_ == int(parameter.values.size())) {
+
+    // keep the fastest value while tuning the remaining parameters
+
+    const int value = parameter.values[parameter.index_best];
+    parameter.set(value);
+    if (CkMyPe() == 0) {
+      Monitor::instance()->print
+        ("Performance","tune %s %d (%d values, %.6f s)",
+         parameter.name.c_str(), value, int(parameter.values.size()),
+         parameter.time_best);
+    }
+
+    ++index_parameter_;
+    index_value_ = 0;
+
+    if (! is_tuning() && CkMyPe() == 0) write_();
+  }
+
+  cycle_trial_ = -2;
+}
+
+//======================================================================
+
+void Tuner::trial_begin_ () throw()
+{
+  Parameter & parameter = parameters_[index_parameter_];
+  parameter.set(parameter.values[index_value_]);
+}
+
+//----------------------------------------------------------------------
+
+void Tuner::write_ () const throw()
+{
+  std::ofstream stream (file_);
+
+  ASSERT1 ("Tuner::write_()",
+           "Cannot open Performance:tune:file %s for writing",
+           file_.c_str(), stream.good());
+
+  for (const Parameter & parameter : parameters_) {
+    stream << parameter.name << " "
+           << parameter.values[parameter.index_best] << "\n";
+  }
+}
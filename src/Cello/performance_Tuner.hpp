@@ -0,0 +1,104 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     performance_Tuner.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Performance] Declaration of the Tuner class
+
+#ifndef PERFORMANCE_TUNER_HPP
+#define PERFORMANCE_TUNER_HPP
+
+class Tuner {
+
+  /// @class    Tuner
+  /// @ingroup  Performance
+  /// @brief    [\ref Performance] Choose tuning parameters by in-situ trials
+  ///
+  /// Components register integer tuning parameters, such as message
+  /// aggregation thresholds or a Method's number of tasks, with a
+  /// list of candidate values and a function applying a value.
+  /// Parameters must be registered in the same order on all
+  /// processes.  Values listed in Performance:tune:file are applied
+  /// when the parameter is registered.  With Performance:tune:active,
+  /// the Tuner instead tries each candidate of each parameter in turn
+  /// for Performance:tune:cycles cycles, measuring the time spent in
+  /// the "compute" Performance region on the slowest process, keeps
+  /// the fastest value before tuning the next parameter, and finally
+  /// writes the values chosen to Performance:tune:file.
+  ///
+  /// Each trial ends on every process after the same number of
+  /// cycles, when the process contributes its time to a maximum
+  /// reduction; the next trial starts when the result arrives, so all
+  /// processes make the same choices.
+
+public: // interface
+
+  /// Create a Tuner reading values from the given file unless active
+  Tuner (std::string file, bool active, int cycles_per_trial) throw();
+
+  /// Register a parameter with candidate values and a function
+  /// applying a value
+  void add_parameter (std::string name,
+                      std::vector<int> values,
+                      std::function<void(int)> set) throw();
+
+  /// Whether trials remain
+  bool is_tuning() const throw()
+  { return active_ && index_parameter_ < int(parameters_.size()); }
+
+  /// Called on each process once per cycle with its accumulated
+  /// compute time, returning the time to contribute if a trial ended
+  /// or a negative value otherwise
+  double cycle (double time) throw();
+
+  /// Record the maximum time over processes of the last trial and
+  /// start the next one
+  void trial_result (double time) throw();
+
+private: // functions
+
+  /// Apply the current candidate of the current parameter
+  void trial_begin_ () throw();
+
+  /// Write the values chosen to file_
+  void write_ () const throw();
+
+private: // attributes
+
+  /// A tuning parameter and the results of its trials
+  struct Parameter {
+    std::string name;
+    std::vector<int> values;
+    std::function<void(int)> set;
+    int index_best;
+    double time_best;
+  };
+
+  /// Tuning file
+  std::string file_;
+
+  /// Whether to run trials
+  bool active_;
+
+  /// Number of cycles per trial
+  int cycles_per_trial_;
+
+  /// Values read from file_
+  std::map<std::string,int> values_file_;
+
+  /// Parameters being tuned, in registration order
+  std::vector<Parameter> parameters_;
+
+  /// Parameter and candidate of the current trial
+  int index_parameter_;
+  int index_value_;
+
+  /// Cycles in the current trial, or -1 if waiting for its result
+  int cycle_trial_;
+
+  /// Accumulated compute time at the start of the current trial
+  double time_start_;
+
+};
+
+#endif /* PERFORMANCE_TUNER_HPP */
@@ -156,14 +156,14 @@ void BoundaryValue::enforce
 
   double t = block->time();
 
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+
   for (const BoundaryValue::ValueFListPair& cur_pair : pairs_) {
     const Value& value = cur_pair.first;
     const std::vector<std::string>& field_list = cur_pair.second;
     for (const std::string& field_name : field_list) {
 
-      int nx,ny,nz;
-      field.size(&nx,&ny,&nz);
-
       int index_field = field.field_id(field_name);
       int gx,gy,gz;
       field.ghost_depth(index_field,&gx,&gy,&gz);
@@ -175,9 +175,14 @@ void BoundaryValue::enforce
       int ndy=ny+2*gy+cy;
       int ndz=nz+2*gz+cz;
 
-      double * x = new double [ndx];
-      double * y = new double [ndy];
-      double * z = new double [ndz];
+      // reuse coordinate arrays across faces, fields, and Blocks
+
+      coords_[0].resize(ndx);
+      coords_[1].resize(ndy);
+      coords_[2].resize(ndz);
+      double * x = coords_[0].data();
+      double * y = coords_[1].data();
+      double * z = coords_[2].data();
 
       data->field_cell_faces(x,y,z,gx,gy,gz,cx,cy,cz);
 
@@ -187,13 +192,13 @@ void BoundaryValue::enforce
 
       int ix0=0 ,iy0=0,iz0=0;
 
-      nx = ndx;
-      ny = ndy;
-      nz = ndz;
+      int mx = ndx;
+      int my = ndy;
+      int mz = ndz;
 
-      if (axis == axis_x) nx=gx;
-      if (axis == axis_y) ny=gy;
-      if (axis == axis_z) nz=gz;
+      if (axis == axis_x) mx=gx;
+      if (axis == axis_y) my=gy;
+      if (axis == axis_z) mz=gz;
 
       if (face == face_upper) {
 	if (axis == axis_x) ix0 = ndx - gx;
@@ -203,76 +208,32 @@ void BoundaryValue::enforce
 
       int i0=ix0 + ndx*(iy0 + ndy*iz0);
 
-      bool * mask = 0;
-
-      if (mask_ != nullptr) mask = new bool [nx*ny*nz];
+      // values are evaluated directly into the ghost zones of the face
 
       switch (precision) {
       case precision_single:
-	{
-	  float * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (float *)array;
-	    array = new float [ndx*ndy*ndz];
-	  }
-	  
-	  value.evaluate((float *)array+i0, t,
-                         ndx,nx,x+ix0,
-                         ndy,ny,y+iy0,
-                         ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((float *)temp)[i]=((float *)array)[i];
-	    delete [] ((float*)array);
-	    array = temp;
-	  }
-	}
+        value.evaluate((float *)array+i0, t,
+                       ndx,mx,x+ix0,
+                       ndy,my,y+iy0,
+                       ndz,mz,z+iz0);
        	break;
       case precision_double:
-	{
-	  double * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (double *)array;
-	    array = new double [ndx*ndy*ndz];
-	  }
-	  value.evaluate((double *)array+i0, t,
-                         ndx,nx,x+ix0,
-                         ndy,ny,y+iy0,
-                         ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) ((double *)temp)[i]=((double *)array)[i];
-	    delete [] ((double *)array);
-	    array = temp;
-	  }
-	}
+        value.evaluate((double *)array+i0, t,
+                       ndx,mx,x+ix0,
+                       ndy,my,y+iy0,
+                       ndz,mz,z+iz0);
        	break;
       case precision_extended64:
       case precision_extended80:
       case precision_extended96:
       case precision_quadruple:
-	{
-	  long double * temp = 0;
-	  if (mask_ != nullptr) {
-	    temp = (long double *)array;
-	    array = new long double [ndx*ndy*ndz];
-	  }
-	  value.evaluate((long double *)array+i0, t,
-                         ndx,nx,x+ix0,
-                         ndy,ny,y+iy0,
-                         ndz,nz,z+iz0);
-	  if (mask_ != nullptr) {
-	    for (int i=0; i<ndx*ndy*ndz; i++) 
-	      ((long double *)temp)[i]=((long double *)array)[i];
-	    delete [] ((long double *)array);
-	    array = temp;
-	  }
-	}
+        value.evaluate((long double *)array+i0, t,
+                       ndx,mx,x+ix0,
+                       ndy,my,y+iy0,
+                       ndz,mz,z+iz0);
        	break;
       }
 
-      delete [] x;
-      delete [] y;
-      delete [] z;
-      delete [] mask;
     } // for field_name in cur_pair.fields
   } // for cur_pair in pairs_
 }
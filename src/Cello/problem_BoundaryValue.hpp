@@ -36,7 +36,8 @@ public: // interface
   BoundaryValue(Parameters& p, const std::string& parameter_group,
                 axis_enum axis, face_enum face) throw()
   : Boundary(axis,face,0),
-    pairs_(BoundaryValue::construct_ValueFList_pairs_(p,parameter_group))
+    pairs_(BoundaryValue::construct_ValueFList_pairs_(p,parameter_group)),
+    coords_()
   { }
 
   /// Destructor
@@ -47,7 +48,8 @@ public: // interface
 
   BoundaryValue(CkMigrateMessage *m)
     : Boundary (m),
-      pairs_()
+      pairs_(),
+      coords_()
   { }
 
   /// returns a string that summarizes contents (for debugging)
@@ -85,6 +87,9 @@ protected: // attributes
 
   std::vector<ValueFListPair> pairs_;
 
+  /// Scratch cell coordinates including ghost zones (not packed)
+  mutable std::vector<double> coords_[3];
+
 };
 
 #endif /* PROBLEM_BOUNDARY_VALUE_HPP */
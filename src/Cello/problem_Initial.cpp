@@ -23,6 +23,7 @@ void Initial::pup (PUP::er &p)
 
   p | cycle_;
   p | time_;
+  p | num_tasks_;
 
 }
 
@@ -21,11 +21,11 @@ public: // interface
 
   /// empty constructor for charm++ pup()
   Initial() throw()
-  : cycle_(0), time_(0.0) {}
+  : cycle_(0), time_(0.0), num_tasks_(1) {}
 
   /// Create a new Initial
   Initial(int cycle, double time) throw()
-    : cycle_(cycle), time_(time)
+    : cycle_(cycle), time_(time), num_tasks_(1)
   { }
 
   /// Destructor
@@ -38,7 +38,8 @@ public: // interface
   Initial (CkMigrateMessage *m)
     : PUP::able(m),
       cycle_(0),
-      time_(0.0)
+      time_(0.0),
+      num_tasks_(1)
   {  }
 
   /// CHARM++ Pack / Unpack function
@@ -50,6 +51,17 @@ public: // interface
   /// Initial cycle
   int cycle() const throw() { return cycle_; }
 
+  /// Number of tasks that loops within a Block may be split into (see
+  /// cello::parallel_for())
+  int num_tasks() const throw() { return num_tasks_; }
+
+  void set_num_tasks(int num_tasks) throw()
+  {
+    ASSERT1("Initial::set_num_tasks",
+            "num_tasks must be positive, not %d", num_tasks, num_tasks > 0);
+    num_tasks_ = num_tasks;
+  }
+
 public: // virtual functions
 
   /// Initialize a Block
@@ -69,6 +81,9 @@ protected: // attributes
   /// Initial time
   double time_;
 
+  /// Number of tasks that loops within a Block may be split into
+  int num_tasks_;
+
 };
 
 #endif /* METHOD_INITIAL_HPP */
@@ -88,6 +88,12 @@ void InitialValue::enforce_block ( Block * block,
   int gx, gy, gz;
   field.ghost_depth(0,&gx,&gy,&gz);
 
+  // point coordinates for each centering, and field values at the
+  // points selected by their masks
+  std::vector<double> points[8][3];
+  std::vector<int> point;
+  std::vector<double> value;
+
   FieldDescr * field_descr = cello::field_descr();
   for (int index_field = 0;
        index_field < field_descr->field_count();
@@ -140,15 +146,34 @@ void InitialValue::enforce_block ( Block * block,
 	int ndy=ny+2*gy+cy;
 	int ndz=nz+2*gz+cz;
 
+	// Coordinates of each point, shared by all fields with the
+	// same centering
+
+	std::vector<double> * p3 = points[cx + 2*(cy + 2*cz)];
+	const int n = ndx*ndy*ndz;
+	if (p3[0].empty()) {
+	  for (int axis=0; axis<3; axis++) p3[axis].resize(n);
+	  for (int iz=0; iz<ndz; iz++) {
+	    for (int iy=0; iy<ndy; iy++) {
+	      for (int ix=0; ix<ndx; ix++) {
+		int i=ix + ndx*(iy + ndy*iz);
+		p3[0][i] = x[ix];
+		p3[1][i] = y[iy];
+		p3[2][i] = z[iz];
+	      }
+	    }
+	  }
+	}
+
 	// Following convention of earlier version: initializing values in a
 	// temporary array of doubles. Then the values are copied into the
 	// field and cast to the appropriate type.
 
-	// The cast to double * in the following line is redundant
-	values_[index_field]->evaluate((double *)val_array, t,
-				       ndx,ndx,x, 
-				       ndy,ndy,y,
-				       ndz,ndz,z);
+	values_[index_field]->evaluate_points
+	  (t, n, p3[0].data(), p3[1].data(), p3[2].data(), point, value);
+	for (size_t k=0; k<point.size(); k++) {
+	  val_array[point[k]] = value[k];
+	}
 
 	copy_values_(field_data,val_array,index_field,ndx,ndy,ndz);
         
@@ -12,6 +12,13 @@
 class Param;
 class Parameters;
 
+/// Result of Mask::evaluate_box()
+enum mask_box_type {
+  mask_box_false,  // mask is false at every point of the box
+  mask_box_true,   // mask is true at every point of the box
+  mask_box_mixed   // mask may be either, or is not known
+};
+
 class Mask : public PUP::able {
 
   /// @class    Mask
@@ -62,6 +69,21 @@ public: // interface
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const = 0;
 
+  /// Return mask values at n points with coordinates x[i], y[i], z[i]
+  virtual void evaluate_points (bool * mask, double t, int n,
+                                double * x, double * y, double * z) const
+  {
+    for (int i=0; i<n; i++) mask[i] = evaluate(t,x[i],y[i],z[i]);
+  }
+
+  /// Classify the mask over the box [lower,upper], so that callers
+  /// can skip evaluating it at each point of a Block lying entirely
+  /// inside or outside the masked region.  The default is
+  /// mask_box_mixed.
+  virtual mask_box_type evaluate_box
+  (double t, const double lower[3], const double upper[3]) const
+  { return mask_box_mixed; }
+
   
 private: // functions
 
@@ -81,3 +81,11 @@ void MaskExpr::evaluate (bool * mask, double t,
   delete [] mask_temp;
 
 }
+
+//----------------------------------------------------------------------
+
+void MaskExpr::evaluate_points (bool * mask, double t, int n,
+                                double * x, double * y, double * z) const
+{
+  param_->evaluate_logical(n,mask,x,y,z,t);
+}
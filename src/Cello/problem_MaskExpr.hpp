@@ -65,6 +65,10 @@ public: // interface
 			 int ndx, int nx, double * x,
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const;
+
+  /// Return mask values at n points
+  virtual void evaluate_points (bool * mask, double t, int n,
+                                double * x, double * y, double * z) const;
   
 private: // functions
 
@@ -9,28 +9,27 @@
 
 #include "problem.hpp"
 
+std::map<std::string, std::shared_ptr<const MaskPng::Image> >
+MaskPng::cache_[CONFIG_NODE_SIZE];
+
 //----------------------------------------------------------------------
 
 MaskPng::MaskPng
 (std::string file_name, 
  double xm, double xp,
  double ym, double yp) throw()
-  : Mask(), mask_(NULL), nx_(0),ny_(0),
+  : Mask(), file_name_(file_name), image_(load_(file_name)),
     xm_(xm),xp_(xp),
     ym_(ym),yp_(yp)
 {
-  mask_ = pngio::read_as_mask(file_name, nx_, ny_);
 }
 
 //----------------------------------------------------------------------
 
 void MaskPng::copy_(const MaskPng & mask) throw()
 {
-  nx_ = mask.nx_;
-  ny_ = mask.ny_;
-  const int n = nx_*ny_;
-  mask_ = new bool [n];
-  for (int i=0; i<n; i++) mask_[i] = mask.mask_[i];
+  file_name_ = mask.file_name_;
+  image_ = mask.image_;
   xm_ = mask.xm_;
   xp_ = mask.xp_;
   ym_ = mask.ym_;
@@ -39,12 +38,39 @@ void MaskPng::copy_(const MaskPng & mask) throw()
 
 //----------------------------------------------------------------------
 
+std::shared_ptr<const MaskPng::Image> MaskPng::load_(std::string file_name)
+{
+  auto & cache = cache_[cello::index_static()];
+  auto it = cache.find(file_name);
+  if (it != cache.end()) return it->second;
+
+  auto image = std::make_shared<Image>();
+  bool * mask = pngio::read_as_mask(file_name, image->nx, image->ny);
+  const int nx = image->nx;
+  const int ny = image->ny;
+  image->mask.assign(mask, mask + nx*ny);
+  delete [] mask;
+
+  // summed-area table of true pixels for evaluate_box()
+  const int n1 = nx + 1;
+  image->count.assign(n1*(ny+1),0);
+  std::vector<int> & count = image->count;
+  for (int iy=0; iy<ny; iy++) {
+    for (int ix=0; ix<nx; ix++) {
+      count[(ix+1) + n1*(iy+1)] = image->mask[ix + nx*iy]
+        + count[ix + n1*(iy+1)] + count[(ix+1) + n1*iy] - count[ix + n1*iy];
+    }
+  }
+
+  cache[file_name] = image;
+  return image;
+}
+
+//----------------------------------------------------------------------
+
 bool MaskPng::evaluate (double t, double x, double y, double z) const
 {
-  int imx = floor(1.0*( x - xm_) / (xp_-xm_) * nx_);
-  int imy = floor(1.0*( y - ym_) / (yp_-ym_) * ny_);
-  bool valid = ((0 <= imx && imx < nx_ && 0 <= imy && imy < ny_));
-  return valid ? mask_[imx + nx_*imy] : false;
+  return value_(x,y);
 }
 
 //----------------------------------------------------------------------
@@ -55,18 +81,51 @@ void MaskPng::evaluate (bool * mask, double t,
 			 int ndz, int nz, double * zv) const
 {
   for (int ix=0; ix<nx; ix++) {
-    double x = xv[ix];
-    int ix_png= floor(1.0*( x - xm_) / (xp_-xm_) * nx_);
     for (int iy=0; iy<ny; iy++) {
-      double y = yv[iy];
-      int iy_png= floor(1.0*( y - ym_) / (yp_-ym_) * ny_);
-      int i_png = ix_png + nx_*(iy_png);
+      const bool value = value_(xv[ix],yv[iy]);
       for (int iz=0; iz<nz; iz++) {
-	int i_mask = ix + ndx*(iy + ndy*iz);
-	mask[i_mask] =
-          (xm_ <= x && x <= xp_) &&
-          (ym_ <= y && y <= yp_) ? mask_[i_png] : false;
+	mask[ix + ndx*(iy + ndy*iz)] = value;
       }
     }
   }
 }
+
+//----------------------------------------------------------------------
+
+void MaskPng::evaluate_points (bool * mask, double t, int n,
+                               double * x, double * y, double * z) const
+{
+  for (int i=0; i<n; i++) mask[i] = value_(x[i],y[i]);
+}
+
+//----------------------------------------------------------------------
+
+mask_box_type MaskPng::evaluate_box
+(double t, const double lower[3], const double upper[3]) const
+{
+  if (! image_ || xp_ <= xm_ || yp_ <= ym_) return mask_box_mixed;
+
+  // no point of the box lies in the image
+
+  if (upper[0] < xm_ || xp_ < lower[0] ||
+      upper[1] < ym_ || yp_ < lower[1]) return mask_box_false;
+
+  // count true pixels covering the part of the box in the image
+
+  const Image & image = *image_;
+  const int ixm = pixel_(std::max(lower[0],xm_),xm_,xp_,image.nx);
+  const int ixp = pixel_(std::min(upper[0],xp_),xm_,xp_,image.nx) + 1;
+  const int iym = pixel_(std::max(lower[1],ym_),ym_,yp_,image.ny);
+  const int iyp = pixel_(std::min(upper[1],yp_),ym_,yp_,image.ny) + 1;
+  const int n1 = image.nx + 1;
+  const int count =
+    image.count[ixp + n1*iyp] - image.count[ixm + n1*iyp]
+    - image.count[ixp + n1*iym] + image.count[ixm + n1*iym];
+
+  const bool inside = (xm_ <= lower[0] && upper[0] <= xp_ &&
+                       ym_ <= lower[1] && upper[1] <= yp_);
+
+  if (count == 0) return mask_box_false;
+  if (inside && count == (ixp-ixm)*(iyp-iym)) return mask_box_true;
+  return mask_box_mixed;
+}
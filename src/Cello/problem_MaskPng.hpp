@@ -14,19 +14,21 @@ class MaskPng : public Mask {
   /// @class    MaskPng
   /// @ingroup  Problem
   /// @brief    [\ref Problem] 
+  ///
+  /// Decoded images are cached on each process by file name and
+  /// shared by all MaskPng objects reading the same file, so each
+  /// image is decoded at most once per process.
 
 public: // interface
 
   /// Constructor
   MaskPng() throw() 
-  : Mask(),mask_(NULL), nx_(0),ny_(0), xm_(0),xp_(0),ym_(0),yp_(0)
+  : Mask(), file_name_(), image_(), xm_(0),xp_(0),ym_(0),yp_(0)
   { };
 
   /// Destructor
   virtual ~MaskPng() throw() 
-  {
-    delete [] mask_;
-  };
+  { };
 
   /// Copy constructor
   MaskPng(const MaskPng & mask) throw() 
@@ -49,7 +51,7 @@ public: // interface
 
   MaskPng(CkMigrateMessage *m)
     : Mask (m),
-      mask_(NULL), nx_(0),ny_(0), xm_(0),xp_(0),ym_(0),yp_(0)
+      file_name_(), image_(), xm_(0),xp_(0),ym_(0),yp_(0)
   {}
 
 
@@ -58,14 +60,13 @@ public: // interface
   {
     TRACEPUP;
     Mask::pup(p);
-    p | nx_;
-    p | ny_;
-    PUParray(p,mask_,nx_*ny_);
+    p | file_name_;
     p | xm_;
     p | xp_;
     p | ym_;
     p | yp_;
-    WARNING("MaskPng::pup()","UNFINISHED");
+    // the image is not packed, but reloaded from the cache
+    if (p.isUnpacking()) image_ = load_(file_name_);
     // NOTE: change this function whenever attributes change
   }
 
@@ -77,20 +78,63 @@ public: // interface
 			 int ndx, int nx, double * x,
 			 int ndy, int ny, double * y,
 			 int ndz, int nz, double * z) const;
-  
+
+  /// Return mask values at n points
+  virtual void evaluate_points (bool * mask, double t, int n,
+                                double * x, double * y, double * z) const;
+
+  /// Classify the mask over a box using the image's pixel counts
+  virtual mask_box_type evaluate_box
+  (double t, const double lower[3], const double upper[3]) const;
+
+private: // types
+
+  /// Decoded image
+  struct Image {
+    /// Size of the image
+    int nx;
+    int ny;
+    /// Pixel values
+    std::vector<char> mask;
+    /// Number of true pixels in [0,ix) x [0,iy), at ix + (nx+1)*iy
+    std::vector<int> count;
+  };
+
 private: // functions
 
   void copy_(const MaskPng & mask) throw();
 
+  /// Return the decoded image of the file, decoding it if not cached
+  static std::shared_ptr<const Image> load_(std::string file_name);
+
+  /// Pixel index along an axis of n pixels spanning [xm,xp], clamped
+  /// to the image
+  static int pixel_ (double x, double xm, double xp, int n)
+  { return std::max(0, std::min(n-1, int(floor((x-xm)/(xp-xm)*n)))); }
+
+  /// Mask value at a point
+  bool value_ (double x, double y) const
+  {
+    const Image & image = *image_;
+    return (xm_ <= x && x <= xp_) && (ym_ <= y && y <= yp_) &&
+      image.mask[pixel_(x,xm_,xp_,image.nx) +
+                 image.nx*pixel_(y,ym_,yp_,image.ny)];
+  }
+
 private: // attributes
 
-  bool * mask_;
-  /// Size of the image
-  int nx_;
-  int ny_;
+  /// PNG file name
+  std::string file_name_;
+
+  /// Decoded image, shared with other MaskPng objects on this process
+  std::shared_ptr<const Image> image_;
 
   double xm_, xp_, ym_, yp_;
 
+  /// Decoded images on each process by file name
+  static std::map<std::string, std::shared_ptr<const Image> >
+  cache_[CONFIG_NODE_SIZE];
+
 };
 
 #endif /* PROBLEM_MASK_PNG_HPP */
@@ -14,7 +14,19 @@ double Method::courant_global = 1.0;
 Method::Method (double courant) throw()
   : schedule_(NULL),
     courant_(courant),
-    neighbor_type_(neighbor_leaf)
+    neighbor_type_(neighbor_leaf),
+    batch_(false),
+    batch_blocks_(),
+    num_tasks_(1),
+    has_output_field_list_(false),
+    output_field_list_(),
+    has_input_field_list_(false),
+    input_field_list_(),
+    overlap_end_(-1),
+    refresh_fused_(false),
+    subcycle_(false),
+    max_subcycles_(0),
+    skip_quiescent_(false)
 {
   ir_post_ = add_refresh_();
   cello::refresh(ir_post_)->set_callback(CkIndex_Block::p_compute_continue());
@@ -37,6 +49,17 @@ void Method::pup (PUP::er &p)
   p | courant_;
   p | ir_post_;
   p | neighbor_type_;
+  p | batch_;
+  p | num_tasks_;
+  p | has_output_field_list_;
+  p | output_field_list_;
+  p | has_input_field_list_;
+  p | input_field_list_;
+  p | overlap_end_;
+  p | refresh_fused_;
+  p | subcycle_;
+  p | max_subcycles_;
+  p | skip_quiescent_;
 
 }
 
@@ -65,10 +88,54 @@ int Method::refresh_id_post() const
 
 //----------------------------------------------------------------------
 
+void Method::set_fields_modified (Block * block) const throw()
+{
+  FieldData * field_data = block->data()->field_data();
+  if (has_output_field_list_) {
+    for (int id_field : output_field_list_) {
+      field_data->set_modified(id_field);
+    }
+  } else {
+    field_data->set_all_modified();
+  }
+}
+
+//----------------------------------------------------------------------
+
 void Method::set_schedule (Schedule * schedule) throw()
 {
   if (schedule_) delete schedule_;
   schedule_ = schedule;
 }
 
+//----------------------------------------------------------------------
+
+int Method::compute_subcycled (Block * block) throw()
+{
+  const double time = block->time();
+  const double dt = block->dt();
+
+  int count = 0;
+  double dt_done = 0.0;
+  bool last = (dt <= 0.0);
+  while (! last) {
+    // the last substep takes the remainder of the timestep exactly,
+    // including when the maximum number of substeps is reached
+    double dt_sub = timestep(block);
+    last = (dt_done + dt_sub >= dt) ||
+      (max_subcycles_ > 0 && count + 1 >= max_subcycles_);
+    if (last) dt_sub = dt - dt_done;
+
+    ASSERT2 ("Method::compute_subcycled()",
+             "Method %s substep %g must be positive",
+             name().c_str(),dt_sub,
+             (dt_sub > 0.0));
+
+    compute_source (block, time + dt_done, dt_sub);
+    dt_done += dt_sub;
+    ++count;
+  }
+  return count;
+}
+
 //======================================================================
@@ -33,8 +33,19 @@ public: // interface
     schedule_(NULL),
     courant_(1.0),
     ir_post_(-1),
-    neighbor_type_(neighbor_leaf)
-
+    neighbor_type_(neighbor_leaf),
+    batch_(false),
+    batch_blocks_(),
+    num_tasks_(1),
+    has_output_field_list_(false),
+    output_field_list_(),
+    has_input_field_list_(false),
+    input_field_list_(),
+    overlap_end_(-1),
+    refresh_fused_(false),
+    subcycle_(false),
+    max_subcycles_(0),
+    skip_quiescent_(false)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -63,6 +74,44 @@ public: // virtual functions
   virtual double timestep (Block * block) throw()
   { return std::numeric_limits<double>::max(); }
 
+  /// Whether compute_source() is implemented, so that the Method may
+  /// be subcycled (see compute_subcycled())
+  virtual bool supports_subcycle () const throw()
+  { return false; }
+
+  /// Advance the Method's source terms on the Block from `time` to
+  /// `time + dt`
+  ///
+  /// Unlike `compute()`, this MUST NOT call `Block::compute_done()`.
+  virtual void compute_source (Block * block, double time, double dt) throw()
+  {
+    ERROR1 ("Method::compute_source()",
+            "Method %s cannot be subcycled", name().c_str());
+  }
+
+  /// Append values of the Block to the stopping reduction
+  ///
+  /// Method-specific global quantities can be appended to the
+  /// vectors reduced by minimum, maximum, and sum, so that they are
+  /// reduced together with the timestep and stopping criteria
+  /// instead of in a separate reduction.  This is called only in
+  /// cycles that reduce the timestep (see Stopping:interval).
+  virtual void stopping_values (Block * block,
+                                std::vector<double> & values_min,
+                                std::vector<double> & values_max,
+                                std::vector<double> & values_sum) throw()
+  { }
+
+  /// Use the reduced values appended by `stopping_values()`
+  ///
+  /// Each pointer is at the first value appended by this Method, and
+  /// must be advanced past them.
+  virtual void stopping_reduced (Block * block,
+                                 const double *& values_min,
+                                 const double *& values_max,
+                                 const double *& values_sum) throw()
+  { }
+
   /// Resume computation after a reduction
   ///
   /// This member function only typically needs to be implemented by Method
@@ -73,6 +122,72 @@ public: // virtual functions
     /* This function intentionally empty */
   }
 
+  /// Whether compute_interior() should be called while the ghost
+  /// zones of refresh_id_post() are being exchanged
+  virtual bool overlap_refresh () const throw()
+  { return false; }
+
+  /// Perform work that does not depend on ghost zone values
+  ///
+  /// When `overlap_refresh()` returns true, this is called on leaf
+  /// Blocks after the refresh_id_post() faces have been sent and
+  /// before incoming faces are processed; `compute()` is called once
+  /// the refresh completes.  Since neighbors may still read this
+  /// Block's fields, this function MUST NOT modify any refreshed
+  /// field: results should be kept in Block-specific storage until
+  /// `compute()` is called.
+  virtual void compute_interior ( Block * block) throw()
+  {
+    /* This function intentionally empty */
+  }
+
+  /// Apply the method to several Blocks whose refresh completed
+  /// together
+  ///
+  /// When `batch()` is true, Blocks on this process that are ready to
+  /// compute are collected and passed to this function together
+  /// instead of to `compute()` one at a time, so that setup can be
+  /// shared and loops may run across all Blocks in one pass.  As with
+  /// `compute()`, `Block::compute_done()` MUST be invoked on every
+  /// Block in `blocks`.  The default implementation calls `compute()`
+  /// on each Block in turn.
+  virtual void compute_batch ( std::vector<Block *> & blocks) throw()
+  {
+    for (Block * block : blocks) compute(block);
+  }
+
+  /// Whether compute() only operates on leaf Blocks
+  ///
+  /// Cells of non-leaf Blocks are covered by finer Blocks, and their
+  /// values are overwritten by restriction, so most Methods that
+  /// update fields do nothing on them but call `compute_done()`.
+  /// Such Methods may return true, so that non-leaf Blocks skip the
+  /// Method entirely, including its refresh (if it only synchronizes
+  /// with neighbors) and any temporaries allocated by `compute()`.
+  /// Methods that take part in reductions or non-neighbor
+  /// synchronization on all Blocks MUST return false.
+  virtual bool leaf_only () const throw()
+  { return false; }
+
+  /// Whether compute() always calls Block::compute_done() before
+  /// returning
+  ///
+  /// Only such Methods may run while a preceding Method that they are
+  /// independent of is waiting on reductions or refreshes (see
+  /// Problem::method_independent()).  Since the preceding Method is
+  /// still the Block's current Method, compute() must not depend on
+  /// `Block::method()` either.
+  virtual bool compute_is_synchronous () const throw()
+  { return false; }
+
+  /// Resolve fields that depend on other Methods, such as fields
+  /// defined by later Methods or computed by earlier ones.  Called by
+  /// Problem::initialize_method() after all Methods have been created,
+  /// and before their dependencies are analyzed.  The argument is
+  /// whether any Method may be overlapped with those following it
+  virtual void initialize_fields (bool overlap) throw()
+  { }
+
   /// Add a new refresh object
   int add_refresh_ (int neighbor_type = neighbor_leaf);
 
@@ -93,8 +208,149 @@ public: // virtual functions
   void set_courant(double courant) throw ()
   { courant_ = courant; }
 
+  /// Whether ready Blocks are passed together to compute_batch()
+  bool batch() const throw ()
+  { return batch_; }
+
+  void set_batch(bool batch) throw ()
+  { batch_ = batch; }
+
+  /// Number of tasks that loops within a Block may be split into (see
+  /// cello::parallel_for())
+  int num_tasks() const throw ()
+  { return num_tasks_; }
+
+  void set_num_tasks(int num_tasks) throw ()
+  {
+    ASSERT1("Method::set_num_tasks",
+            "num_tasks must be positive, not %d", num_tasks, num_tasks > 0);
+    num_tasks_ = num_tasks;
+  }
+
+  /// Whether the fields modified by compute() have been declared with
+  /// add_output_field_(); if not, all fields are assumed to be modified
+  bool has_output_field_list() const throw ()
+  { return has_output_field_list_; }
+
+  /// Return the fields modified by compute(), if declared
+  const std::vector<int> & output_field_list() const throw ()
+  { return output_field_list_; }
+
+  /// Whether the fields read by compute() have been declared with
+  /// add_input_field_(); if not, all fields are assumed to be read
+  bool has_input_field_list() const throw ()
+  { return has_input_field_list_; }
+
+  /// Return the fields read by compute(), if declared
+  const std::vector<int> & input_field_list() const throw ()
+  { return input_field_list_; }
+
+  /// Record in the Block's FieldData the fields that compute() may have
+  /// modified, so that sparse refreshes send them
+  void set_fields_modified (Block * block) const throw();
+
+  /// Index one past the last of the following Methods that run while
+  /// this Method waits, or -1 if none
+  int overlap_end() const throw ()
+  { return overlap_end_; }
+
+  void set_overlap_end(int overlap_end) throw ()
+  { overlap_end_ = overlap_end; }
+
+  /// Whether this Method's refresh fields were added to the refresh of
+  /// a preceding Method, so that its own refresh is skipped
+  bool refresh_fused() const throw ()
+  { return refresh_fused_; }
+
+  void set_refresh_fused(bool refresh_fused) throw ()
+  { refresh_fused_ = refresh_fused; }
+
+  /// Whether the Method is subcycled within each Block instead of
+  /// limiting the global timestep
+  bool subcycle() const throw ()
+  { return subcycle_; }
+
+  /// Maximum number of substeps per timestep, or 0 if unlimited
+  int max_subcycles() const throw ()
+  { return max_subcycles_; }
+
+  void set_subcycle(bool subcycle, int max_subcycles) throw ()
+  {
+    ASSERT1("Method::set_subcycle",
+            "Method %s cannot be subcycled",
+            name().c_str(),
+            (! subcycle || supports_subcycle()));
+    subcycle_ = subcycle;
+    max_subcycles_ = max_subcycles;
+  }
+
+  /// Whether the Method is skipped on quiescent Blocks (see
+  /// Block::is_quiescent())
+  bool skip_quiescent() const throw ()
+  { return skip_quiescent_; }
+
+  void set_skip_quiescent(bool skip_quiescent) throw ()
+  { skip_quiescent_ = skip_quiescent; }
+
+  /// Advance the Method's source terms over the Block's timestep by
+  /// calling compute_source() with substeps limited by timestep(),
+  /// returning the number of substeps.  Only the Block's compute time
+  /// grows with the number of substeps, which is what orderings use
+  /// as the Block's cost for load balancing.
+  int compute_subcycled (Block * block) throw();
+
+  /// Add a ready Block to the pending batch, returning true if it is
+  /// the first Block in the batch
+  bool batch_add (Block * block) throw()
+  {
+    batch_blocks_.push_back(block);
+    return (batch_blocks_.size() == 1);
+  }
+
+  /// Return the pending batch of Blocks and start a new one
+  std::vector<Block *> batch_take () throw()
+  {
+    std::vector<Block *> blocks;
+    blocks.swap(batch_blocks_);
+    return blocks;
+  }
+
 protected: // functions
 
+  /// Declare that compute() modifies the given field.  Methods that
+  /// declare none are assumed to modify all fields, while methods
+  /// that modify no fields may call set_no_output_fields_().
+  void add_output_field_ (int id_field) throw()
+  {
+    has_output_field_list_ = true;
+    if (id_field >= 0 &&
+        std::find(output_field_list_.begin(),output_field_list_.end(),
+                  id_field) == output_field_list_.end()) {
+      output_field_list_.push_back(id_field);
+    }
+  }
+
+  /// Declare that compute() doesn't modify any fields
+  void set_no_output_fields_ () throw()
+  { has_output_field_list_ = true; }
+
+  /// Declare that compute() reads the given field.  Methods that
+  /// declare none are assumed to read all fields, while methods that
+  /// read no fields may call set_no_input_fields_().
+  void add_input_field_ (int id_field) throw()
+  {
+    has_input_field_list_ = true;
+    if (id_field >= 0 &&
+        std::find(input_field_list_.begin(),input_field_list_.end(),
+                  id_field) == input_field_list_.end()) {
+      input_field_list_.push_back(id_field);
+    }
+  }
+
+  /// Declare that compute() doesn't read any fields
+  void set_no_input_fields_ () throw()
+  { has_input_field_list_ = true; }
+
   /// Perform vector copy X <- Y
   template <class T>
   void copy_ (T * X, const T * Y,
@@ -124,6 +380,43 @@ protected: // attributes
   /// Default refresh type
   int neighbor_type_;
 
+  /// Whether ready Blocks are passed together to compute_batch()
+  bool batch_;
+
+  /// Blocks on this process waiting to be passed to compute_batch()
+  /// (empty outside the compute phase, so not packed)
+  std::vector<Block *> batch_blocks_;
+
+  /// Number of tasks that loops within a Block may be split into
+  int num_tasks_;
+
+  /// Whether output_field_list_ has been declared
+  bool has_output_field_list_;
+
+  /// Fields modified by compute()
+  std::vector<int> output_field_list_;
+
+  /// Whether input_field_list_ has been declared
+  bool has_input_field_list_;
+
+  /// Fields read by compute()
+  std::vector<int> input_field_list_;
+
+  /// Index one past the last Method run while this Method waits, or -1
+  int overlap_end_;
+
+  /// Whether the refresh is performed by a preceding Method
+  bool refresh_fused_;
+
+  /// Whether the Method is subcycled within each Block
+  bool subcycle_;
+
+  /// Maximum number of substeps per timestep, or 0 if unlimited
+  int max_subcycles_;
+
+  /// Whether the Method is skipped on quiescent Blocks
+  bool skip_quiescent_;
+
 };
 
 #endif /* PROBLEM_METHOD_HPP */
@@ -270,6 +270,21 @@ void MethodFluxCorrect::compute_continue_sum_fields
 //======================================================================
 
 
+void MethodFluxCorrect::correction_faces
+(const Block * block, bool perform_correction[3][2]) throw()
+{
+  const int level = block->level();
+  const int rank = cello::rank();
+  for (int axis=0; axis < 3; axis++){
+    for (int face = 0; face < 2; face++){
+      perform_correction[axis][face] =
+        (axis < rank) && (block->face_level(axis,face) > level);
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 static void flux_correct_helper_(cello_float * const field_array,
                                  int mx, int my, int mz,
                                  int nx, int ny, int nz,
@@ -436,7 +451,6 @@ void MethodFluxCorrect::flux_correct_(Block * block)
       return;
     }
 
-    const int level = block->level();
 
     const int rank = cello::rank();
 
@@ -452,15 +466,7 @@ void MethodFluxCorrect::flux_correct_(Block * block)
 
     // determine which faces require flux corrections
     bool perform_correction[3][2];
-    for (int axis=0; axis < 3; axis++){
-      for (int face = 0; face < 2; face++){
-        if ((axis < rank) && (block->face_level(axis,face) > level)){
-          perform_correction[axis][face] = true;
-        } else {
-          perform_correction[axis][face] = false;
-        }
-      }
-    }
+    correction_faces (block,perform_correction);
     int i_f_density = -1; // will be used to store i_f for density
     for (int i_f=0; i_f<nf; i_f++) {
       const int index_field = flux_data->index_field(i_f);
@@ -55,6 +55,13 @@ public: // interface
   void compute_continue_refresh ( Block * block) throw();
   void compute_continue_sum_fields ( Block * block, CkReductionMsg * msg) throw();
 
+  /// Set which faces [axis][face] of the Block are corrected, i.e.
+  /// have finer neighbors.  Methods storing fluxes for corrections
+  /// pass these to FluxData::allocate() so that neighbor fluxes are
+  /// allocated only where they are received
+  static void correction_faces (const Block * block,
+                                bool perform_correction[3][2]) throw();
+
 public: // virtual functions
 
   /// Apply the method to advance a block one timestep 
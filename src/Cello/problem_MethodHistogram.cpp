@@ -0,0 +1,321 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MethodHistogram.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the in-situ histogram method
+///
+/// Reduction array (double):
+///
+///    [0]  length of the array
+///    [1]  index of the Method in the Problem's method list
+///    [2]  cycle
+///    [3]  time
+///    [4 ...]              summed weight in each bin
+///    [4+n_bins ...]       summed weight*value in each bin (if value field)
+
+#include "problem.hpp"
+#include "charm_simulation.hpp"
+
+/// Number of header values in the reduction array
+#define HISTOGRAM_HEADER 4
+
+//----------------------------------------------------------------------
+
+MethodHistogram::MethodHistogram(ParameterGroup p) noexcept
+  : Method (),
+    axis_field_(),
+    num_bins_(),
+    bin_min_(),
+    bin_max_(),
+    bin_log_(),
+    weight_field_(p.value_string("weight","")),
+    value_field_(p.value_string("value","")),
+    file_name_(p.value_string("file_name",""))
+{
+  const std::string path = p.get_group_path();
+  const std::string method_name = path.substr(path.rfind(':')+1);
+
+  if (file_name_ == "") file_name_ = method_name + "-%06d.data";
+
+  // quantities binned along each axis
+
+  const int num_axes = (p.type("fields") == parameter_list) ?
+    p.list_length("fields") : 1;
+
+  ASSERT1 ("MethodHistogram::MethodHistogram()",
+           "Method %s: fields must list one or two quantities",
+           method_name.c_str(), (1 <= num_axes && num_axes <= 2));
+
+  for (int axis=0; axis<num_axes; axis++) {
+
+    const std::string field = (p.type("fields") == parameter_list) ?
+      p.list_value_string(axis,"fields") : p.value_string("fields","");
+
+    ASSERT1 ("MethodHistogram::MethodHistogram()",
+             "Method %s: fields must be specified",
+             method_name.c_str(), (field != ""));
+
+    // scalar parameters apply to all axes
+
+    const bool is_list_bins = (p.type("num_bins") == parameter_list);
+    const bool is_list_min  = (p.type("min")      == parameter_list);
+    const bool is_list_max  = (p.type("max")      == parameter_list);
+    const bool is_list_log  = (p.type("log")      == parameter_list);
+
+    axis_field_.push_back(field);
+    num_bins_.push_back
+      (is_list_bins ? p.list_value_integer(axis,"num_bins",64)
+       :              p.value_integer("num_bins",64));
+    bin_min_.push_back
+      (is_list_min ? p.list_value_float(axis,"min",0.0)
+       :             p.value_float("min",0.0));
+    bin_max_.push_back
+      (is_list_max ? p.list_value_float(axis,"max",1.0)
+       :             p.value_float("max",1.0));
+    bin_log_.push_back
+      (is_list_log ? p.list_value_logical(axis,"log",false)
+       :             p.value_logical("log",false));
+
+    ASSERT2 ("MethodHistogram::MethodHistogram()",
+             "Method %s: num_bins %d must be positive",
+             method_name.c_str(), num_bins_[axis], (num_bins_[axis] > 0));
+    ASSERT3 ("MethodHistogram::MethodHistogram()",
+             "Method %s: min %g must be less than max %g",
+             method_name.c_str(), bin_min_[axis], bin_max_[axis],
+             (bin_min_[axis] < bin_max_[axis]));
+    ASSERT2 ("MethodHistogram::MethodHistogram()",
+             "Method %s: min %g must be positive for logarithmic bins",
+             method_name.c_str(), bin_min_[axis],
+             (! bin_log_[axis] || bin_min_[axis] > 0.0));
+  }
+
+  for (int i=0; i<3; i++) {
+    center_[i] = p.list_value_float(i,"center",0.0);
+  }
+
+  // only cell values are accessed, so no ghost zones are refreshed
+
+  cello::simulation()->refresh_set_name(ir_post_,name());
+}
+
+//----------------------------------------------------------------------
+
+void MethodHistogram::compute ( Block * block) throw()
+{
+  const int num_bins = num_bins_total_();
+  const int num_arrays = (value_field_ != "") ? 2 : 1;
+  const int length = HISTOGRAM_HEADER + num_arrays*num_bins;
+
+  std::vector<double> reduce (length,0.0);
+
+  // locate this Method in the Problem's method list so the root
+  // process can find it when the reduction completes
+
+  Problem * problem = cello::problem();
+  int index_method = 0;
+  while (problem->method(index_method) != this) ++index_method;
+
+  reduce[0] = length;
+  reduce[1] = index_method;
+  reduce[2] = block->cycle();
+  reduce[3] = block->time();
+
+  if (block->is_leaf()) {
+
+    Field field = block->data()->field();
+
+    int mx,my,mz;
+    int gx,gy,gz;
+    field.dimensions (0,&mx,&my,&mz);
+    field.ghost_depth (0,&gx,&gy,&gz);
+    if (mx == 1) gx = 0;
+    if (my == 1) gy = 0;
+    if (mz == 1) gz = 0;
+
+    double xm,ym,zm;
+    double hx,hy,hz;
+    block->lower(&xm,&ym,&zm);
+    block->cell_width(&hx,&hy,&hz);
+
+    // Field value accessor, respecting the field's precision
+
+    auto field_array = [&field] (const std::string & name,
+                                 const char ** values, int * precision)
+    {
+      const int id = field.field_id(name);
+      ASSERT1 ("MethodHistogram::compute()",
+               "Field %s not defined", name.c_str(), (id >= 0));
+      *values    = field.values(id);
+      *precision = field.precision(id);
+    };
+    auto field_value = [] (const char * values, int precision, int i)
+    {
+      return (precision == precision_single) ?
+        double(((const float *)values)[i]) :
+        double(((const double *)values)[i]);
+    };
+
+    const int num_axes = axis_field_.size();
+    const char * axis_values[2] = {nullptr, nullptr};
+    int axis_precision[2] = {0, 0};
+    for (int axis=0; axis<num_axes; axis++) {
+      if (axis_field_[axis] != "radius") {
+        field_array (axis_field_[axis],
+                     &axis_values[axis],&axis_precision[axis]);
+      }
+    }
+    const char * weight_values = nullptr;
+    int weight_precision = 0;
+    if (weight_field_ != "") {
+      field_array (weight_field_,&weight_values,&weight_precision);
+    }
+    const char * value_values = nullptr;
+    int value_precision = 0;
+    if (value_field_ != "") {
+      field_array (value_field_,&value_values,&value_precision);
+    }
+
+    const double rel_vol = cello::relative_cell_volume (block->level());
+
+    double * W = reduce.data() + HISTOGRAM_HEADER;
+    double * V = W + num_bins;
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      const double z = zm + (iz-gz+0.5)*hz - center_[2];
+      for (int iy=gy; iy<my-gy; iy++) {
+        const double y = ym + (iy-gy+0.5)*hy - center_[1];
+        for (int ix=gx; ix<mx-gx; ix++) {
+          const double x = xm + (ix-gx+0.5)*hx - center_[0];
+          const int i = ix + mx*(iy + my*iz);
+
+          int k = 0;
+          for (int axis=num_axes-1; axis>=0 && k>=0; axis--) {
+            const double q = (axis_values[axis] == nullptr) ?
+              sqrt(x*x + (my > 1 ? y*y : 0.0) + (mz > 1 ? z*z : 0.0)) :
+              field_value(axis_values[axis],axis_precision[axis],i);
+            const int kq = bin_(axis,q);
+            k = (kq >= 0) ? k*num_bins_[axis] + kq : -1;
+          }
+
+          if (k >= 0) {
+            const double w = (weight_values == nullptr) ? rel_vol :
+              rel_vol*field_value(weight_values,weight_precision,i);
+            W[k] += w;
+            if (value_values != nullptr) {
+              V[k] += w*field_value(value_values,value_precision,i);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  CkCallback callback (CkIndex_Simulation::r_method_histogram(NULL),
+                       proxy_simulation[0]);
+
+  block->contribute
+    (length*sizeof(double), reduce.data(),
+     r_reduce_method_histogram_type, callback);
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
+int MethodHistogram::bin_ (int axis, double q) const
+{
+  const bool is_log = bin_log_[axis];
+  if (is_log && ! (q > 0.0)) return -1;
+
+  const double qm = bin_min_[axis];
+  const double qp = bin_max_[axis];
+  const double t = is_log ?
+    (log(q) - log(qm)) / (log(qp) - log(qm)) : (q - qm) / (qp - qm);
+
+  // also rejects nan
+  if (! (0.0 <= t && t < 1.0)) return -1;
+
+  return std::min(int(t*num_bins_[axis]), num_bins_[axis]-1);
+}
+
+//----------------------------------------------------------------------
+
+double MethodHistogram::bin_edge_ (int axis, int k) const
+{
+  const double qm = bin_min_[axis];
+  const double qp = bin_max_[axis];
+  const double t = double(k) / num_bins_[axis];
+  return bin_log_[axis] ?
+    qm*pow(qp/qm,t) : qm + t*(qp - qm);
+}
+
+//======================================================================
+
+void Simulation::r_method_histogram(CkReductionMsg * msg)
+{
+  const double * data = (const double *) msg->getData();
+  const int index_method = data[1];
+
+  MethodHistogram * method =
+    static_cast<MethodHistogram *> (problem()->method(index_method));
+
+  method->write(msg);
+
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
+void MethodHistogram::write (CkReductionMsg * msg) throw()
+{
+  const double * data = (const double *) msg->getData();
+
+  const int num_bins = num_bins_total_();
+  const int num_axes = axis_field_.size();
+  const int cycle = data[2];
+  const double time = data[3];
+
+  const double * W = data + HISTOGRAM_HEADER;
+  const double * V = W + num_bins;
+
+  char file_name[256];
+  snprintf (file_name,sizeof(file_name),file_name_.c_str(),cycle);
+
+  FILE * fp = fopen (file_name,"w");
+
+  ASSERT1 ("MethodHistogram::write()",
+           "Cannot open file %s for writing",
+           file_name, (fp != nullptr));
+
+  fprintf (fp,"# cycle %d time %20.16g\n",cycle,time);
+  fprintf (fp,"#");
+  for (int axis=0; axis<num_axes; axis++) {
+    fprintf (fp," %s_lower %s_upper",
+             axis_field_[axis].c_str(),axis_field_[axis].c_str());
+  }
+  fprintf (fp," weight%s%s",
+           (weight_field_ != "") ? "_" : "", weight_field_.c_str());
+  if (value_field_ != "") fprintf (fp," mean_%s",value_field_.c_str());
+  fprintf (fp,"\n");
+
+  for (int k=0; k<num_bins; k++) {
+    int kq = k;
+    int kb[2] = {0, 0};
+    for (int axis=0; axis<num_axes; axis++) {
+      kb[axis] = kq % num_bins_[axis];
+      kq /= num_bins_[axis];
+    }
+    for (int axis=0; axis<num_axes; axis++) {
+      fprintf (fp,"%g %g ",
+               bin_edge_(axis,kb[axis]),bin_edge_(axis,kb[axis]+1));
+    }
+    fprintf (fp,"%20.16g",W[k]);
+    if (value_field_ != "") {
+      fprintf (fp," %20.16g",(W[k] != 0.0) ? V[k]/W[k] : 0.0);
+    }
+    fprintf (fp,"\n");
+  }
+
+  fclose (fp);
+}
@@ -0,0 +1,131 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     problem_MethodHistogram.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Problem] Declaration for the MethodHistogram class
+
+#ifndef PROBLEM_METHOD_HISTOGRAM_HPP
+#define PROBLEM_METHOD_HISTOGRAM_HPP
+
+class MethodHistogram : public Method
+{
+  /// @class    MethodHistogram
+  /// @ingroup  MethodHistogram
+  /// @brief    [\ref MethodHistogram] In-situ binned statistics
+  ///
+  /// Bins leaf Block cells by one or two quantities (field values, or
+  /// "radius" from a center point), accumulating the weight (cell
+  /// volume, optionally times a weight field) and optionally the
+  /// weighted sum of a value field in each bin.  This gives PDFs (one
+  /// field), phase diagrams (two fields), and radial profiles
+  /// ("radius" with a value field).  Block arrays are combined by a
+  /// custom reduction to the root process, which writes only the
+  /// binned arrays to a text file.
+
+public: // interface
+
+  /// Create a new MethodHistogram
+  MethodHistogram (ParameterGroup p) noexcept;
+
+  /// Destructor
+  virtual ~MethodHistogram() throw()
+  {};
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(MethodHistogram);
+
+  /// Charm++ PUP::able migration constructor
+  MethodHistogram (CkMigrateMessage *m)
+    : Method(m),
+      axis_field_(),
+      num_bins_(),
+      bin_min_(),
+      bin_max_(),
+      bin_log_(),
+      weight_field_(),
+      value_field_(),
+      file_name_()
+  {
+    center_[0] = center_[1] = center_[2] = 0.0;
+  }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Method::pup(p);
+    p | axis_field_;
+    p | num_bins_;
+    p | bin_min_;
+    p | bin_max_;
+    p | bin_log_;
+    PUParray(p,center_,3);
+    p | weight_field_;
+    p | value_field_;
+    p | file_name_;
+  };
+
+  /// Write the reduced histogram (called on the root process)
+  void write (CkReductionMsg * msg) throw();
+
+public: // virtual functions
+
+  /// Accumulate and contribute the Block's histogram
+
+  virtual void compute ( Block * block) throw();
+
+  /// Return the name of this MethodHistogram
+  virtual std::string name () throw ()
+  { return "histogram"; }
+
+  /// Blocks do not wait for the reduction
+  virtual bool compute_is_synchronous () const throw()
+  { return true; }
+
+protected: // functions
+
+  /// Total number of bins
+  int num_bins_total_ () const
+  {
+    int n = 1;
+    for (int bins : num_bins_) n *= bins;
+    return n;
+  }
+
+  /// Bin index along the given axis for value q, or -1 if out of range
+  int bin_ (int axis, double q) const;
+
+  /// Lower edge of bin k along the given axis
+  double bin_edge_ (int axis, int k) const;
+
+protected: // attributes
+
+  /// Quantity binned along each axis: a field name or "radius"
+  std::vector<std::string> axis_field_;
+
+  /// Number of bins along each axis
+  std::vector<int> num_bins_;
+
+  /// Range of bins along each axis
+  std::vector<double> bin_min_;
+  std::vector<double> bin_max_;
+
+  /// Whether bins along each axis are logarithmically spaced
+  std::vector<int> bin_log_;
+
+  /// Center for the "radius" quantity
+  double center_[3];
+
+  /// Field multiplying the cell volume weight, if any
+  std::string weight_field_;
+
+  /// Field whose weighted mean is computed in each bin, if any
+  std::string value_field_;
+
+  /// Output file name format, with a single integer conversion for
+  /// the cycle
+  std::string file_name_;
+};
+
+#endif /* PROBLEM_METHOD_HISTOGRAM_HPP */
@@ -22,13 +22,33 @@
 
 //----------------------------------------------------------------------
 
-MethodOrderHilbert::MethodOrderHilbert(int min_level) throw ()
+MethodOrderHilbert::MethodOrderHilbert
+(int min_level, std::string weight, bool incremental) throw ()
   : Method(),
     is_index_(-1),
     is_weight_(-1),
     is_weight_child_(-1),
-    min_level_(min_level)
+    min_level_(min_level),
+    weight_(weight),
+    is_cost_(-1),
+    is_cost_child_(-1),
+    is_cost_self_(-1),
+    is_cost_index_(-1),
+    is_cost_total_(-1),
+    incremental_(incremental),
+    is_state_(-1),
+    is_path_(-1),
+    path_(),
+    path_valid_(false)
 {
+  ASSERT1 ("MethodOrderHilbert::MethodOrderHilbert()",
+           "weight \"%s\" must be \"count\", \"particles\", or \"time\"",
+           weight_.c_str(),
+           (weight_ == "count" || weight_ == "particles" || weight_ == "time"));
+  ASSERT1 ("MethodOrderHilbert::MethodOrderHilbert()",
+           "incremental ordering requires weight \"count\", not \"%s\"",
+           weight_.c_str(), (! incremental_ || weight_ == "count"));
+
   Refresh * refresh = cello::refresh(ir_post_);
   cello::simulation()->refresh_set_name(ir_post_,name());
   refresh->add_field("density");
@@ -42,12 +62,41 @@ MethodOrderHilbert::MethodOrderHilbert(int min_level) throw ()
   is_weight_child_ = cello::scalar_descr_long_long()->new_value(name() + ":weight_child",n);
   is_sync_index_   = cello::scalar_descr_sync()->new_value(name() + ":sync_index");
   is_sync_weight_  = cello::scalar_descr_sync()->new_value(name() + ":sync_weight");
+
+  /// Create Scalar data for Block costs
+  ScalarDescr * scalar_descr_double = cello::scalar_descr_double();
+  is_cost_       = scalar_descr_double->new_value(name() + ":cost");
+  is_cost_child_ = scalar_descr_double->new_value(name() + ":cost_child",n);
+  is_cost_self_  = scalar_descr_double->new_value(name() + ":cost_self");
+  is_cost_index_ = scalar_descr_double->new_value(name() + ":cost_index");
+  is_cost_total_ = scalar_descr_double->new_value(name() + ":cost_total");
+
+  /// Create Scalar data for incremental ordering; new Blocks have
+  /// state 0 (state_new)
+  is_state_ = cello::scalar_descr_long_long()->new_value(name() + ":state");
+  is_path_  = cello::scalar_descr_long_long()->new_value(name() + ":path");
 }
 
 //======================================================================
 
 void MethodOrderHilbert::compute (Block * block) throw()
 {
+  if (incremental_) {
+    // contribute the Block's index if it was created, refined, or
+    // coarsened since the previous ordering
+    const long long state = *pstate_(block);
+    const bool is_changed = (state == state_new) ||
+      ((state == state_leaf) != block->is_leaf());
+    int v3[3];
+    block->index().values(v3);
+    path_valid_ = false;
+    CkCallback callback (CkIndex_Block::r_method_order_hilbert_path(nullptr),
+                         block->proxy_array());
+    block->contribute (is_changed ? 3*sizeof(int) : 0, v3,
+                       CkReduction::concat, callback);
+    return;
+  }
+
   // Initialize counters, then barrier to ensure counters initialized
   // before first entry method can arrive
   TRACE_ORDER_BLOCK("compute",block);
@@ -57,8 +106,11 @@ void MethodOrderHilbert::compute (Block * block) throw()
   *pindex_(block) = 0;
   *pcount_(block) = 0;
   *pweight_(block) = 1;
+  *pcost_self_(block) = block_cost_(block);
+  *pcost_(block) = *pcost_self_(block);
   for (int i=0; i<cello::num_children(); i++) {
     *pweight_child_(block,i) = 0;
+    *pcost_child_(block,i) = 0.0;
   }
   sync_index->reset();
   sync_weight->reset();
@@ -83,12 +135,148 @@ void Block::r_method_order_hilbert_continue(CkReductionMsg * msg)
 
 //----------------------------------------------------------------------
 
+void Block::r_method_order_hilbert_path(CkReductionMsg * msg)
+{
+  const int num_changed = msg->getSize() / (3*sizeof(int));
+  static_cast<MethodOrderHilbert*>
+    (this->method())->compute_path(this,num_changed,(int *)msg->getData());
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
+void MethodOrderHilbert::compute_path
+(Block * block, int num_changed, const int * values)
+{
+  TRACE_ORDER_BLOCK("path",block);
+  if (num_changed == 0) {
+    // hierarchy unchanged: keep the previous ordering
+    compute_complete(block);
+    return;
+  }
+
+  if (! path_valid_) {
+    // mark the changed Blocks and their ancestors, stopping at an
+    // ancestor already marked through the same child
+    path_.clear();
+    for (int k=0; k<num_changed; k++) {
+      Index index;
+      index.set_values(values + 3*k);
+      path_.emplace(path_key_(index),0);
+      for (int level=index.level(); level>min_level_; level--) {
+        int ic3[3];
+        index.child(level,ic3,ic3+1,ic3+2,min_level_);
+        index = index.index_parent(min_level_);
+        int & mask = path_[path_key_(index)];
+        const int bit = 1 << (ic3[0] + 2*(ic3[1] + 2*ic3[2]));
+        if (mask & bit) break;
+        mask |= bit;
+      }
+    }
+    path_valid_ = true;
+  }
+
+  auto it = path_.find(path_key_(block->index()));
+  const bool on_path = (it != path_.end());
+  const int mask = on_path ? it->second : 0;
+
+  int num_path_children = 0;
+  for (int i=0; i<cello::num_children(); i++) {
+    if (mask & (1 << i)) ++num_path_children;
+  }
+
+  *ppath_(block) = on_path ? 1 : 0;
+  psync_weight_(block)->reset();
+  psync_weight_(block)->set_stop(1 + num_path_children);
+
+  if (on_path) {
+    // keep weights of unchanged children from the previous ordering
+    *pcost_self_(block) = block_cost_(block);
+    *pweight_(block) = 1;
+    *pcost_(block) = *pcost_self_(block);
+    for (int i=0; i<cello::num_children(); i++) {
+      if (block->is_leaf() || (mask & (1 << i))) {
+        *pweight_child_(block,i) = 0;
+        *pcost_child_(block,i) = 0.0;
+      } else {
+        *pweight_(block) += *pweight_child_(block,i);
+        *pcost_(block) += *pcost_child_(block,i);
+      }
+    }
+  }
+
+  CkCallback callback (CkIndex_Block::r_method_order_hilbert_continue(nullptr),
+                       block->proxy_array());
+  block->contribute (callback);
+}
+
+//----------------------------------------------------------------------
+
 void MethodOrderHilbert::compute_continue(Block * block)
 {
   TRACE_ORDER_BLOCK("continue",block);
+  if (incremental_) {
+    if (*ppath_(block)) {
+      if (psync_weight_(block)->next()) path_up_(block);
+    } else if (block->level() == min_level_) {
+      // unchanged root: start the index pass with its previous weight
+      path_up_(block);
+    }
+    return;
+  }
   send_weight(block, 0, true);
 }
 
+//----------------------------------------------------------------------
+
+void MethodOrderHilbert::path_up_(Block * block)
+{
+  const int level = block->level();
+  if (level > min_level_) {
+    int ic3[3];
+    block->index().child(level,ic3,ic3+1,ic3+2,min_level_);
+    const Index index_parent = block->index().index_parent(min_level_);
+    TRACE_ORDER_BLOCK("path_up",block);
+    cello::block_array()[index_parent].p_method_order_hilbert_weight
+      (ic3,*pweight_(block),*pcost_(block),block->index());
+  } else {
+    *pindex_(block) = 0;
+    *pcount_(block) = *pweight_(block);
+    *pcost_index_(block) = 0.0;
+    *pcost_total_(block) = *pcost_(block);
+    path_down_(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void MethodOrderHilbert::path_down_(Block * block)
+{
+  TRACE_ORDER_BLOCK("path_down",block);
+  *pnext_(block) = hilbert_next
+    (block->index(), cello::rank(), block->is_leaf(), min_level_);
+  if (!block->is_leaf()) {
+    int index = *pindex_(block) + 1;
+    double cost_index = *pcost_index_(block) + *pcost_self_(block);
+    int children[cello::num_children()];
+    hilbert_children(block, children);
+    for (int i=0; i<cello::num_children(); i++) {
+      int ic3[3];
+      ic3[0] = (children[i] >> 0) & 1;
+      ic3[1] = (children[i] >> 1) & 1;
+      ic3[2] = (children[i] >> 2) & 1;
+      Index index_child = block->index().index_child(ic3,min_level_);
+      cello::block_array()[index_child].p_method_order_hilbert_index
+        (index,*pcount_(block),cost_index,*pcost_total_(block));
+      index += *pweight_child_(block, children[i]);
+      cost_index += *pcost_child_(block, children[i]);
+    }
+  }
+  CkCallback callback (CkIndex_Block::r_method_order_hilbert_complete(nullptr),
+                       block->proxy_array());
+  block->contribute (callback);
+}
+
 //======================================================================
 void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
 {
@@ -97,7 +285,7 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
   int weight = *pweight_(block);
   int ic3[3] = {0,0,0};
   if (self) {
-    recv_weight(block,ic3,0,true);
+    recv_weight(block,ic3,0,0.0,true);
   }
   const int level = block->level();
   if ((!self || block->is_leaf()) && level > min_level_)  {
@@ -105,7 +293,7 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
     block->index().child(level,ic3,ic3+1,ic3+2,min_level_);
     TRACE_ORDER_BLOCK("send_weight",block);
     cello::block_array()[index_parent].p_method_order_hilbert_weight
-      (ic3,weight,block->index());
+      (ic3,weight,*pcost_(block),block->index());
     send_index(block, 0, 0, self);
   } else if (level == min_level_) {
 
@@ -118,6 +306,8 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
     *pindex_(block) = 0;
     *pcount_(block) = 0;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = 0.0;
+    *pcost_total_(block) = *pcost_(block);
 
     send_index(block, 0, weight, self);
     if (!self) {
@@ -131,23 +321,35 @@ void MethodOrderHilbert::send_weight(Block * block, int weight_child, bool self)
 
 //----------------------------------------------------------------------
 
-void Block::p_method_order_hilbert_weight(int ic3[3], int weight, Index index_child)
+void Block::p_method_order_hilbert_weight
+(int ic3[3], int weight, double cost, Index index_child)
 {
   static_cast<MethodOrderHilbert*>
-    (this->method())->recv_weight(this, ic3,weight,false);
+    (this->method())->recv_weight(this, ic3,weight,cost,false);
 }
 
 //----------------------------------------------------------------------
 
 void MethodOrderHilbert::recv_weight
-(Block * block, int ic3[3], int weight, bool self)
+(Block * block, int ic3[3], int weight, double cost, bool self)
 {
   TRACE_ORDER_BLOCK("recv_weight",block);
+  if (incremental_) {
+    const int i = ic3[0] + 2*(ic3[1]+2*ic3[2]);
+    *pweight_(block) += weight;
+    *pweight_child_(block,i) = weight;
+    *pcost_(block) += cost;
+    *pcost_child_(block,i) = cost;
+    if (psync_weight_(block)->next()) path_up_(block);
+    return;
+  }
   // Update children weight if needed
   if (!self) {
     *pweight_(block) += weight;
     int i = ic3[0] + 2*(ic3[1]+2*ic3[2]);
     *pweight_child_(block,i) = weight;
+    *pcost_(block) += cost;
+    *pcost_child_(block,i) = cost;
   }
   if ((!block->is_leaf()) && psync_weight_(block)->next()) {
     // Forward weight to parent when computed
@@ -163,6 +365,8 @@ void MethodOrderHilbert::send_index
   *pcount_(block) = count;
   if (!block->is_leaf()) {
     int index = *pindex_(block) + 1;
+    double cost_index = *pcost_index_(block) + *pcost_self_(block);
+    const double cost_total = *pcost_total_(block);
 
     int children[cello::num_children()];
     hilbert_children(block, children);
@@ -173,27 +377,40 @@ void MethodOrderHilbert::send_index
       ic3[1] = (children[i] >> 1) & 1;
       ic3[2] = (children[i] >> 2) & 1;
       Index index_child = block->index().index_child(ic3,min_level_);
-      cello::block_array()[index_child].p_method_order_hilbert_index(index,count);
+      cello::block_array()[index_child].p_method_order_hilbert_index
+        (index,count,cost_index,cost_total);
 
       index += *pweight_child_(block, children[i]);
+      cost_index += *pcost_child_(block, children[i]);
     }
   }
 }
 
-void Block::p_method_order_hilbert_index(int index, int count)
+void Block::p_method_order_hilbert_index
+(int index, int count, double cost_index, double cost_total)
 {
   static_cast<MethodOrderHilbert*>
-    (this->method())->recv_index(this, index, count, false);
+    (this->method())->recv_index(this, index, count,
+                                 cost_index, cost_total, false);
 }
 
 void MethodOrderHilbert::recv_index
-(Block * block, int index, int count, bool self)
+(Block * block, int index, int count,
+ double cost_index, double cost_total, bool self)
 {
   {
     char buffer[80];
     sprintf (buffer,"recv_index %d %d\n",index,count);
     TRACE_ORDER_BLOCK(buffer,block);
   }
+  if (incremental_) {
+    *pindex_(block) = index;
+    *pcount_(block) = count;
+    *pcost_index_(block) = cost_index;
+    *pcost_total_(block) = cost_total;
+    path_down_(block);
+    return;
+  }
   if (!self) {
     const int rank = cello::rank();
     int na3[3];
@@ -203,6 +420,8 @@ void MethodOrderHilbert::recv_index
     *pindex_(block) = index;
     *pcount_(block) = count;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = cost_index;
+    *pcost_total_(block) = cost_total;
   }
   if (psync_index_(block)->next()) {
     {
@@ -232,6 +451,11 @@ void MethodOrderHilbert::compute_complete(Block * block)
 {
   // Update Block's index and count
   block->set_order(*pindex_(block),*pcount_(block));
+  block->set_order_cost
+    (*pcost_self_(block),*pcost_index_(block),*pcost_total_(block));
+  *pstate_(block) = block->is_leaf() ? state_leaf : state_parent;
+  // restart measuring Block cost for the next ordering
+  block->reset_compute_time();
   block->compute_done();
 }
 
@@ -299,6 +523,88 @@ Sync * MethodOrderHilbert::psync_weight_(Block * block)
   return scalar.value(is_sync_weight_);
 }
 
+//----------------------------------------------------------------------
+
+long long * MethodOrderHilbert::pstate_(Block * block)
+{
+  Scalar<long long> scalar(cello::scalar_descr_long_long(),
+                     block->data()->scalar_data_long_long());
+  return scalar.value(is_state_);
+}
+
+//----------------------------------------------------------------------
+
+long long * MethodOrderHilbert::ppath_(Block * block)
+{
+  Scalar<long long> scalar(cello::scalar_descr_long_long(),
+                     block->data()->scalar_data_long_long());
+  return scalar.value(is_path_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_child_(Block * block, int i)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_child_)+i;
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_self_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_self_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_index_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_index_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderHilbert::pcost_total_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_total_);
+}
+
+//----------------------------------------------------------------------
+
+double MethodOrderHilbert::block_cost_(Block * block) const
+{
+  if (weight_ == "particles") {
+    // particles cost relative to cells, so an empty Block costs 1
+    int nx,ny,nz;
+    block->data()->field().size(&nx,&ny,&nz);
+    const int num_particles = block->data()->particle().num_particles();
+    return 1.0 + double(num_particles)/(nx*ny*nz);
+  } else if (weight_ == "time") {
+    // measured compute time in seconds; the floor makes Blocks that
+    // have not been measured yet equally (and negligibly) costly
+    return std::max(block->compute_time(), 1e-6);
+  } else {
+    return 1.0;
+  }
+}
+
 
 //=========================================================
 
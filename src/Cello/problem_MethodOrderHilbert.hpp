@@ -24,18 +24,30 @@ class MethodOrderHilbert : public Method {
   /// @class    MethodOrderHilbert
   /// @ingroup  Problem
   /// @brief    [\ref Problem] 
+  ///
+  /// With incremental ordering, only Blocks created, refined, or
+  /// coarsened since the previous ordering, and their ancestors, send
+  /// weights up the tree; other Blocks keep the weights of their
+  /// children from the previous ordering.  Changed Blocks are found
+  /// with a reduction of their indices, and if there are none the
+  /// previous ordering is kept.  Otherwise indices propagate from the
+  /// root in a single pass.  Since weights must not change in
+  /// unchanged subtrees, this requires weight "count".
 
 public: // interface
 
   /// Constructor
-  MethodOrderHilbert(int min_level) throw();
+  MethodOrderHilbert(int min_level, std::string weight = "count",
+                     bool incremental = false) throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(MethodOrderHilbert);
   
   /// Charm++ PUP::able migration constructor
   MethodOrderHilbert (CkMigrateMessage *m)
-    : Method (m)
+    : Method (m),
+      path_(),
+      path_valid_(false)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -50,14 +62,30 @@ public: // interface
     p | is_sync_index_;
     p | is_sync_weight_;
     p | min_level_;
+    p | weight_;
+    p | is_cost_;
+    p | is_cost_child_;
+    p | is_cost_self_;
+    p | is_cost_index_;
+    p | is_cost_total_;
+    p | incremental_;
+    p | is_state_;
+    p | is_path_;
+    // path_ is not packed
   }
 
   void compute_continue( Block * block);
   void compute_complete( Block * block);
   void send_weight(Block * block, int weight, bool self);
-  void recv_weight(Block * block, int ic3[3], int weight, bool self);
+  void recv_weight(Block * block, int ic3[3], int weight, double cost,
+                   bool self);
   void send_index(Block * block, int index, int count, bool self);
-  void recv_index(Block * block, int index, int count, bool self);
+  void recv_index(Block * block, int index, int count,
+                  double cost_index, double cost_total, bool self);
+
+  /// Start incremental ordering given the num_changed indices of
+  /// Blocks changed since the previous ordering
+  void compute_path(Block * block, int num_changed, const int * values);
 
 public: // virtual methods
   
@@ -87,6 +115,24 @@ private: // methods
   /// Return the pointer to the Block's Hilbert ordering index 
   Sync * psync_index_(Block * block);
 
+  /// Return the pointer to the Block's cost (including descendents)
+  double * pcost_(Block * block);
+
+  /// Return the pointer to the given Block's child cost
+  double * pcost_child_(Block * block, int index);
+
+  /// Return the pointer to the Block's own cost
+  double * pcost_self_(Block * block);
+
+  /// Return the pointer to the cost of Blocks preceding the Block
+  double * pcost_index_(Block * block);
+
+  /// Return the pointer to the total cost of Blocks
+  double * pcost_total_(Block * block);
+
+  /// Return the Block's own cost for the weight type
+  double block_cost_(Block * block) const;
+
   /// Return the pointer to the Block's weight (including self)
   Sync * psync_weight_(Block * block);
 
@@ -113,6 +159,27 @@ private: // methods
 
 private: // functions
 
+  /// Incremental ordering: send the Block's weight to its parent, or
+  /// start the index pass if the Block is a root
+  void path_up_(Block * block);
+
+  /// Incremental ordering: send indices to the Block's children and
+  /// contribute to the completion reduction
+  void path_down_(Block * block);
+
+  /// Return the pointer to the Block's state at the previous ordering
+  long long * pstate_(Block * block);
+
+  /// Return the pointer to whether the Block's weight is recomputed
+  long long * ppath_(Block * block);
+
+  /// Key of an Index in path_
+  static std::pair<long long,int> path_key_(const Index & index)
+  {
+    int v3[3];
+    index.values(v3);
+    return {((long long)(v3[0]) << 32) | (unsigned int)(v3[1]), v3[2]};
+  }
 
 private: // attributes
 
@@ -136,6 +203,35 @@ private: // attributes
   /// Minimum refinement level for ordering; may be < 0
   int min_level_;
 
+  /// How Block cost is measured: "count", "particles", or "time"
+  std::string weight_;
+  /// Block Scalar<double> cost (descendent blocks + self)
+  int is_cost_;
+  /// Block Scalar<double> child cost (array of size cello::num_children())
+  int is_cost_child_;
+  /// Block Scalar<double> own cost
+  int is_cost_self_;
+  /// Block Scalar<double> cost of preceding blocks
+  int is_cost_index_;
+  /// Block Scalar<double> total cost
+  int is_cost_total_;
+
+  /// Whether to recompute weights only in changed subtrees
+  bool incremental_;
+  /// Block Scalar<long long> state at the previous ordering
+  int is_state_;
+  /// Block Scalar<long long> whether the Block's weight is recomputed
+  int is_path_;
+
+  /// Block states at the previous ordering
+  enum state_type { state_new, state_leaf, state_parent };
+
+  /// Blocks whose weights are recomputed on this process's Blocks,
+  /// with a bit mask of their children whose weights are recomputed,
+  /// built by the first local Block to call compute_path()
+  std::map<std::pair<long long,int>,int> path_;
+  bool path_valid_;
+
   /// Look up tables for encoding/decoding Hilbert indices
   static int HPM[12][8];
   static int HNM[12][8];
@@ -22,13 +22,24 @@
 
 //----------------------------------------------------------------------
 
-MethodOrderMorton::MethodOrderMorton(int min_level) throw ()
+MethodOrderMorton::MethodOrderMorton(int min_level, std::string weight) throw ()
   : Method(),
     is_index_(-1),
     is_weight_(-1),
     is_weight_child_(-1),
-    min_level_(min_level)
+    min_level_(min_level),
+    weight_(weight),
+    is_cost_(-1),
+    is_cost_child_(-1),
+    is_cost_self_(-1),
+    is_cost_index_(-1),
+    is_cost_total_(-1)
 {
+  ASSERT1 ("MethodOrderMorton::MethodOrderMorton()",
+           "weight \"%s\" must be \"count\", \"particles\", or \"time\"",
+           weight_.c_str(),
+           (weight_ == "count" || weight_ == "particles" || weight_ == "time"));
+
   Refresh * refresh = cello::refresh(ir_post_);
   cello::simulation()->refresh_set_name(ir_post_,name());
   refresh->add_field("density");
@@ -42,6 +53,14 @@ MethodOrderMorton::MethodOrderMorton(int min_level) throw ()
   is_weight_child_ = cello::scalar_descr_long_long()->new_value(name() + ":weight_child",n);
   is_sync_index_  = cello::scalar_descr_sync()->new_value(name() + ":sync_index");
   is_sync_weight_ = cello::scalar_descr_sync()->new_value(name() + ":sync_weight");
+
+  /// Create Scalar data for Block costs
+  ScalarDescr * scalar_descr_double = cello::scalar_descr_double();
+  is_cost_       = scalar_descr_double->new_value(name() + ":cost");
+  is_cost_child_ = scalar_descr_double->new_value(name() + ":cost_child",n);
+  is_cost_self_  = scalar_descr_double->new_value(name() + ":cost_self");
+  is_cost_index_ = scalar_descr_double->new_value(name() + ":cost_index");
+  is_cost_total_ = scalar_descr_double->new_value(name() + ":cost_total");
 }
 
 //======================================================================
@@ -57,8 +76,11 @@ void MethodOrderMorton::compute (Block * block) throw()
   *pindex_(block) = 0;
   *pcount_(block) = 0;
   *pweight_(block) = 1;
+  *pcost_self_(block) = block_cost_(block);
+  *pcost_(block) = *pcost_self_(block);
   for (int i=0; i<cello::num_children(); i++) {
     *pweight_child_(block,i) = 0;
+    *pcost_child_(block,i) = 0.0;
   }
   sync_index->reset();
   sync_weight->reset();
@@ -97,7 +119,7 @@ void MethodOrderMorton::send_weight(Block * block, int weight_child, bool self)
   int weight = *pweight_(block);
   int ic3[3] = {0,0,0};
   if (self) {
-    recv_weight(block,ic3,0,true);
+    recv_weight(block,ic3,0,0.0,true);
   }
   const int level = block->level();
   if ((!self || block->is_leaf()) && level > min_level_)  {
@@ -105,7 +127,7 @@ void MethodOrderMorton::send_weight(Block * block, int weight_child, bool self)
     block->index().child(level,ic3,ic3+1,ic3+2,min_level_);
     TRACE_ORDER_BLOCK("send_weight",block);
     cello::block_array()[index_parent].p_method_order_morton_weight
-      (ic3,weight,block->index());
+      (ic3,weight,*pcost_(block),block->index());
     send_index(block, 0, 0, self);
   } else if (level == min_level_) {
 
@@ -118,6 +140,8 @@ void MethodOrderMorton::send_weight(Block * block, int weight_child, bool self)
     *pindex_(block) = 0;
     *pcount_(block) = 0;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = 0.0;
+    *pcost_total_(block) = *pcost_(block);
 
     send_index(block, 0, weight, self);
     if (!self) {
@@ -131,16 +155,17 @@ void MethodOrderMorton::send_weight(Block * block, int weight_child, bool self)
 
 //----------------------------------------------------------------------
 
-void Block::p_method_order_morton_weight(int ic3[3], int weight, Index index_child)
+void Block::p_method_order_morton_weight
+(int ic3[3], int weight, double cost, Index index_child)
 {
   static_cast<MethodOrderMorton*>
-    (this->method())->recv_weight(this, ic3,weight,false);
+    (this->method())->recv_weight(this, ic3,weight,cost,false);
 }
 
 //----------------------------------------------------------------------
 
 void MethodOrderMorton::recv_weight
-(Block * block, int ic3[3], int weight, bool self)
+(Block * block, int ic3[3], int weight, double cost, bool self)
 {
   TRACE_ORDER_BLOCK("recv_weight",block);
   // Update children weight if needed
@@ -148,6 +173,8 @@ void MethodOrderMorton::recv_weight
     *pweight_(block) += weight;
     int i = ic3[0] + 2*(ic3[1]+2*ic3[2]);
     *pweight_child_(block,i) = weight;
+    *pcost_(block) += cost;
+    *pcost_child_(block,i) = cost;
   }
   if ((!block->is_leaf()) && psync_weight_(block)->next()) {
     // Forward weight to parent when computed
@@ -163,26 +190,33 @@ void MethodOrderMorton::send_index
   *pcount_(block) = count;
   if (!block->is_leaf()) {
     int index = *pindex_(block) + 1;
+    double cost_index = *pcost_index_(block) + *pcost_self_(block);
+    const double cost_total = *pcost_total_(block);
     for (int ic=0; ic<cello::num_children(); ic++) {
       int ic3[3];
       ic3[0] = (ic>>0) & 1;
       ic3[1] = (ic>>1) & 1;
       ic3[2] = (ic>>2) & 1;
       Index index_child = block->index().index_child(ic3,min_level_);
-      cello::block_array()[index_child].p_method_order_morton_index(index,count);
+      cello::block_array()[index_child].p_method_order_morton_index
+        (index,count,cost_index,cost_total);
       index += *pweight_child_(block,ic);
+      cost_index += *pcost_child_(block,ic);
     }
   }
 }
 
-void Block::p_method_order_morton_index(int index, int count)
+void Block::p_method_order_morton_index
+(int index, int count, double cost_index, double cost_total)
 {
   static_cast<MethodOrderMorton*>
-    (this->method())->recv_index(this, index, count, false);
+    (this->method())->recv_index(this, index, count,
+                                 cost_index, cost_total, false);
 }
 
 void MethodOrderMorton::recv_index
-(Block * block, int index, int count, bool self)
+(Block * block, int index, int count,
+ double cost_index, double cost_total, bool self)
 {
   {
     char buffer[80];
@@ -197,6 +231,8 @@ void MethodOrderMorton::recv_index
     *pindex_(block) = index;
     *pcount_(block) = count;
     *pnext_(block) = index_next;
+    *pcost_index_(block) = cost_index;
+    *pcost_total_(block) = cost_total;
   }
   if (psync_index_(block)->next()) {
     {
@@ -226,6 +262,10 @@ void MethodOrderMorton::compute_complete(Block * block)
 {
   // Update Block's index and count
   block->set_order(*pindex_(block),*pcount_(block));
+  block->set_order_cost
+    (*pcost_self_(block),*pcost_index_(block),*pcost_total_(block));
+  // restart measuring Block cost for the next ordering
+  block->reset_compute_time();
   block->compute_done();
 }
 
@@ -293,3 +333,67 @@ Sync * MethodOrderMorton::psync_weight_(Block * block)
   return scalar.value(is_sync_weight_);
 }
 
+//----------------------------------------------------------------------
+
+double * MethodOrderMorton::pcost_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderMorton::pcost_child_(Block * block, int i)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_child_)+i;
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderMorton::pcost_self_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_self_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderMorton::pcost_index_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_index_);
+}
+
+//----------------------------------------------------------------------
+
+double * MethodOrderMorton::pcost_total_(Block * block)
+{
+  Scalar<double> scalar(cello::scalar_descr_double(),
+                        block->data()->scalar_data_double());
+  return scalar.value(is_cost_total_);
+}
+
+//----------------------------------------------------------------------
+
+double MethodOrderMorton::block_cost_(Block * block) const
+{
+  if (weight_ == "particles") {
+    // particles cost relative to cells, so an empty Block costs 1
+    int nx,ny,nz;
+    block->data()->field().size(&nx,&ny,&nz);
+    const int num_particles = block->data()->particle().num_particles();
+    return 1.0 + double(num_particles)/(nx*ny*nz);
+  } else if (weight_ == "time") {
+    // measured compute time in seconds; the floor makes Blocks that
+    // have not been measured yet equally (and negligibly) costly
+    return std::max(block->compute_time(), 1e-6);
+  } else {
+    return 1.0;
+  }
+}
+
@@ -18,7 +18,7 @@ class MethodOrderMorton : public Method {
 public: // interface
 
   /// Constructor
-  MethodOrderMorton(int min_level) throw();
+  MethodOrderMorton(int min_level, std::string weight = "count") throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(MethodOrderMorton);
@@ -40,14 +40,22 @@ public: // interface
     p | is_sync_index_;
     p | is_sync_weight_;
     p | min_level_;
+    p | weight_;
+    p | is_cost_;
+    p | is_cost_child_;
+    p | is_cost_self_;
+    p | is_cost_index_;
+    p | is_cost_total_;
   }
 
   void compute_continue( Block * block);
   void compute_complete( Block * block);
   void send_weight(Block * block, int weight, bool self);
-  void recv_weight(Block * block, int ic3[3], int weight, bool self);
+  void recv_weight(Block * block, int ic3[3], int weight, double cost,
+                   bool self);
   void send_index(Block * block, int index, int count, bool self);
-  void recv_index(Block * block, int index, int count, bool self);
+  void recv_index(Block * block, int index, int count,
+                  double cost_index, double cost_total, bool self);
 
 public: // virtual methods
   
@@ -77,6 +85,24 @@ private: // methods
   /// Return the pointer to the Block's Morton ordering index 
   Sync * psync_index_(Block * block);
 
+  /// Return the pointer to the Block's cost (including descendents)
+  double * pcost_(Block * block);
+
+  /// Return the pointer to the given Block's child cost
+  double * pcost_child_(Block * block, int index);
+
+  /// Return the pointer to the Block's own cost
+  double * pcost_self_(Block * block);
+
+  /// Return the pointer to the cost of Blocks preceding the Block
+  double * pcost_index_(Block * block);
+
+  /// Return the pointer to the total cost of Blocks
+  double * pcost_total_(Block * block);
+
+  /// Return the Block's own cost for the weight type
+  double block_cost_(Block * block) const;
+
   /// Return the pointer to the Block's weight (including self)
   Sync * psync_weight_(Block * block);
 
@@ -104,6 +130,19 @@ private: // attributes
 
   /// Minimum refinement level for ordering; may be < 0
   int min_level_;
+
+  /// How Block cost is measured: "count", "particles", or "time"
+  std::string weight_;
+  /// Block Scalar<double> cost (descendent blocks + self)
+  int is_cost_;
+  /// Block Scalar<double> child cost (array of size cello::num_children())
+  int is_cost_child_;
+  /// Block Scalar<double> own cost
+  int is_cost_self_;
+  /// Block Scalar<double> cost of preceding blocks
+  int is_cost_index_;
+  /// Block Scalar<double> total cost
+  int is_cost_total_;
 };
 
 #endif /* PROBLEM_METHOD_ORDER_MORTON_HPP */
@@ -178,6 +178,12 @@ void Problem::initialize_initial(Config * config,
 	    config->initial_list[index].c_str(),
 	    (initial != nullptr) );
 
+    // parameter: Initial : <initial> : num_tasks
+
+    initial->set_num_tasks
+      (parameters->value_integer
+       ("Initial:" + config->initial_list[index] + ":num_tasks",1));
+
     initial_list_.push_back( initial );
   }
 }
@@ -220,6 +226,7 @@ void Problem::initialize_refine(Config * config,
 
     if (refine) {
       refine_list_.push_back( refine );
+      refine->set_buffer(config->adapt_buffer);
       int index_schedule = config->adapt_schedule_index[index];
 
       if (index_schedule >= 0) {
@@ -363,12 +370,19 @@ void Problem::initialize_output
         // if no fields are "*", create field index iterator
         if (! all_fields) {
           ItIndexList * it_field = new ItIndexList;
+          std::vector<std::string> derived_list;
           for (int i=0; i<num_fields; i++) {
             std::string field_name = config->output_field_list[index][i];
             int index_field = field_descr->field_id(field_name);
-            it_field->append(index_field);
+            if (index_field >= 0) {
+              it_field->append(index_field);
+            } else {
+              // not a field: a derived quantity computed as it is written
+              derived_list.push_back(field_name);
+            }
           }
           output->set_it_field_index(it_field);
+          output->set_derived_list(derived_list);
         }
       }
 
@@ -409,6 +423,27 @@ void Problem::initialize_output
       }
 
 
+      //--------------------------------------------------
+      // Level range and region of interest
+      //--------------------------------------------------
+
+      output->set_level_range (config->output_min_level[index],
+                               config->output_max_level[index]);
+
+      if (! config->output_region_lower[index].empty()) {
+        output->set_region_box (config->output_region_lower[index].data(),
+                                config->output_region_upper[index].data());
+      }
+
+      if (config->output_region_radius[index] > 0.0) {
+        double center[3];
+        for (int axis=0; axis<3; axis++) {
+          center[axis] = config->output_region_center[index][axis];
+        }
+        output->set_region_sphere
+          (new ObjectSphere (center,config->output_region_radius[index]));
+      }
+
       //--------------------------------------------------
       // Scheduling parameters
       //--------------------------------------------------
@@ -455,6 +490,11 @@ void Problem::initialize_output
           output_image->set_colormap(colormap);
         }
 
+        output_image->set_resolutions
+          (config->output_image_resolutions[index]);
+        output_image->set_compression
+          (config->output_image_compression[index]);
+
       }
 
     }
@@ -498,6 +538,63 @@ void Problem::initialize_method
 
       method_list_.push_back(method); 
 
+      method->set_batch(config->method_batch[index_method]);
+      method->set_subcycle(config->method_subcycle[index_method],
+                           config->method_max_subcycles[index_method]);
+      method->set_skip_quiescent(config->method_skip_quiescent[index_method]);
+
+      const std::string & method_name = config->method_list[index_method];
+      const std::vector<std::string> & tune_methods =
+        config->performance_tune_methods;
+      if (std::find(tune_methods.begin(),tune_methods.end(),method_name)
+          != tune_methods.end()) {
+        cello::simulation()->tuner()->add_parameter
+          ("Method:" + method_name + ":num_tasks", {1, 2, 4, 8},
+           [method] (int value) { method->set_num_tasks(value); });
+      }
+
+      Refresh * refresh = cello::refresh(method->refresh_id_post());
+      const std::string codec = config->method_codec[index_method];
+      if (codec == "auto") {
+        // accumulated faces, e.g. of deposited particle mass, are
+        // mostly zero where particles are sparse, and other faces are
+        // often uniform in an ambient medium
+        refresh->set_codec
+          (refresh->any_accumulate() ? codec_sparse : codec_constant);
+      } else if (codec == "none") {
+        refresh->set_codec(codec_none);
+      } else if (codec == "constant") {
+        refresh->set_codec(codec_constant);
+      } else if (codec == "sparse") {
+        refresh->set_codec(codec_sparse);
+      } else if (codec == "lossless") {
+        refresh->set_codec(codec_lossless);
+      } else if (codec == "lossy") {
+        refresh->set_codec(codec_lossy);
+      } else {
+        ERROR2 ("Problem::initialize_method",
+                "Method %s has unknown codec \"%s\"",
+                name.c_str(),codec.c_str());
+      }
+      refresh->set_codec_tolerance
+        (config->method_codec_tolerance[index_method]);
+      std::vector<int> codec_field_list;
+      for (const std::string & field :
+             config->method_codec_fields[index_method]) {
+        const int id_field = cello::field_descr()->field_id(field);
+        ASSERT2 ("Problem::initialize_method",
+                 "Method %s codec_fields includes unknown field \"%s\"",
+                 name.c_str(),field.c_str(),
+                 (id_field >= 0));
+        codec_field_list.push_back(id_field);
+      }
+      refresh->set_codec_field_list(codec_field_list);
+
+      refresh->set_sparse(config->method_sparse_refresh[index_method]);
+
+      refresh->set_ghost_layers
+        (config->method_refresh_ghost_depth[index_method]);
+
       int index_schedule = config->method_schedule_index[index_method];
 
       if (index_schedule != -1) {
@@ -515,6 +612,90 @@ void Problem::initialize_method
 	     "Unknown Method %s",name.c_str());
     }
   }
+
+  // Now that all fields are defined, let Methods resolve the fields
+  // they read and refresh
+
+  bool any_overlap = config->method_dataflow;
+  for (size_t index_method=0; index_method < num_method ; index_method++) {
+    any_overlap = any_overlap || config->method_overlap[index_method];
+  }
+  for (Method * method : method_list_) {
+    method->initialize_fields(any_overlap);
+  }
+
+  // Find the Methods that may run while an overlapping Method waits
+  // (offset by one for the initial MethodNull).  With Method:dataflow,
+  // every waiting Method overlaps the independent Methods after it
+  // unless it or the next Method is batched or fused
+
+  for (size_t index_method=0; index_method < num_method ; index_method++) {
+
+    const size_t i = index_method + 1;
+
+    const bool is_dataflow = config->method_dataflow &&
+      ! method_list_[i]->compute_is_synchronous() &&
+      ! config->method_batch[index_method] &&
+      ! config->method_fuse[index_method] &&
+      ! (index_method + 1 < num_method &&
+         (config->method_fuse[index_method + 1] ||
+          config->method_batch[index_method + 1]));
+
+    if (! config->method_overlap[index_method] && ! is_dataflow) continue;
+
+    size_t j = i + 1;
+    while (j < method_list_.size() &&
+           method_list_[j]->compute_is_synchronous() &&
+           method_independent(i,j)) {
+      ++j;
+    }
+
+    if (j > i + 1) {
+      method_list_[i]->set_overlap_end(j);
+    } else if (config->method_overlap[index_method]) {
+      WARNING1("Problem::initialize_method",
+               "Method %s has no following independent Method to overlap",
+               method_list_[i]->name().c_str());
+    }
+  }
+
+  // Merge refreshes of fused Methods into the refresh of the nearest
+  // preceding unfused Method, so one ghost exchange serves both
+
+  for (size_t index_method=0; index_method < num_method ; index_method++) {
+
+    if (! config->method_fuse[index_method]) continue;
+
+    const size_t j = index_method + 1;
+    size_t i = j - 1;
+    while (i > 0 && method_list_[i]->refresh_fused()) --i;
+
+    Method * method_j = method_list_[j];
+
+    if (i > 0 && method_fusable(i,j)) {
+      Refresh * refresh_i = cello::refresh(method_list_[i]->refresh_id_post());
+      const Refresh * refresh_j = cello::refresh(method_j->refresh_id_post());
+      if (! refresh_i->all_fields()) {
+        const std::vector<int> src_j = refresh_j->field_list_src();
+        const std::vector<int> dst_j = refresh_j->field_list_dst();
+        for (size_t k=0; k<src_j.size(); k++) {
+          const std::vector<int> src_i = refresh_i->field_list_src();
+          const std::vector<int> dst_i = refresh_i->field_list_dst();
+          bool is_present = false;
+          for (size_t l=0; l<src_i.size(); l++) {
+            is_present = is_present ||
+              (src_i[l] == src_j[k] && dst_i[l] == dst_j[k]);
+          }
+          if (! is_present) refresh_i->add_field_src_dst(src_j[k],dst_j[k]);
+        }
+      }
+      method_j->set_refresh_fused(true);
+    } else {
+      WARNING1("Problem::initialize_method",
+               "Method %s refresh cannot be fused with a preceding Method",
+               method_j->name().c_str());
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -531,6 +712,11 @@ void Problem::initialize_solver( Config * config ) throw()
 
     if (solver) {
 
+      solver->set_adaptive_tolerance
+        (config->solver_res_tol_change[index_solver],
+         config->solver_res_tol_level[index_solver],
+         config->solver_iter_max_level[index_solver]);
+
       solver_list_.push_back(solver); 
 
     } else {
@@ -883,6 +1069,104 @@ bool Problem::method_precedes(const std::string& name1,
 
 //----------------------------------------------------------------------
 
+bool Problem::method_independent(size_t i, size_t j) const throw()
+{
+  const Method * method_i = method(i);
+  const Method * method_j = method(j);
+
+  if (method_i == nullptr || method_j == nullptr) return false;
+  if (! (method_i->has_input_field_list() &&
+         method_i->has_output_field_list() &&
+         method_j->has_input_field_list() &&
+         method_j->has_output_field_list())) return false;
+
+  const Refresh * refresh = cello::refresh(method_j->refresh_id_post());
+  if (refresh->all_fields() ||
+      refresh->any_particles() ||
+      refresh->any_fluxes()) return false;
+
+  std::vector<int> in_i  = method_i->input_field_list();
+  std::vector<int> out_i = method_i->output_field_list();
+  std::vector<int> in_j  = method_j->input_field_list();
+  std::vector<int> out_j = method_j->output_field_list();
+  const std::vector<int> src_j = refresh->field_list_src();
+  const std::vector<int> dst_j = refresh->field_list_dst();
+  in_j.insert (in_j.end(), src_j.begin(),src_j.end());
+  out_j.insert(out_j.end(),src_j.begin(),src_j.end());
+  out_j.insert(out_j.end(),dst_j.begin(),dst_j.end());
+  in_i.insert (in_i.end(), out_i.begin(),out_i.end());
+
+  auto intersect = [] (const std::vector<int> & a,
+                       const std::vector<int> & b)
+    {
+      for (int id : a) {
+        if (std::find(b.begin(),b.end(),id) != b.end()) return true;
+      }
+      return false;
+    };
+
+  return ! (intersect(out_j,in_i) || intersect(in_j,out_i));
+}
+
+//----------------------------------------------------------------------
+
+bool Problem::method_fusable(size_t i, size_t j) const throw()
+{
+  if (! (0 < i && i < j && j < method_list_.size())) return false;
+
+  const Method * method_i = method_list_[i];
+  const Method * method_j = method_list_[j];
+
+  // fused Methods run back to back, without batching or overlap
+
+  if (method_i->overlap_end() != -1 || method_j->overlap_end() != -1 ||
+      method_i->batch() || method_j->batch()) return false;
+
+  const Refresh * refresh_i = cello::refresh(method_i->refresh_id_post());
+  const Refresh * refresh_j = cello::refresh(method_j->refresh_id_post());
+
+  if (refresh_j->all_fields() ||
+      refresh_j->any_particles() ||
+      refresh_j->any_fluxes()) return false;
+
+  const std::vector<int> src_j = refresh_j->field_list_src();
+  for (size_t k=0; k<src_j.size(); k++) {
+    if (refresh_j->accumulate(k)) return false;
+  }
+
+  if (refresh_j->ghost_depth()    >  refresh_i->ghost_depth() ||
+      refresh_j->min_face_rank()  != refresh_i->min_face_rank() ||
+      refresh_j->neighbor_type()  != refresh_i->neighbor_type() ||
+      refresh_j->sync_type()      != refresh_i->sync_type() ||
+      refresh_j->root_level()     != refresh_i->root_level() ||
+      refresh_j->index_prolong()  != refresh_i->index_prolong() ||
+      refresh_j->index_restrict() != refresh_i->index_restrict() ||
+      refresh_j->codec()          != refresh_i->codec() ||
+      refresh_j->is_sparse()      != refresh_i->is_sparse()) return false;
+
+  // Method i's refresh must send at least the ghost layers Method j needs
+
+  if (refresh_i->ghost_layers() > 0 &&
+      (refresh_j->ghost_layers() == 0 ||
+       refresh_j->ghost_layers() > refresh_i->ghost_layers())) return false;
+
+  // fields in Method j's refresh must be unchanged since Method i's
+  // refresh
+
+  for (size_t k=i; k<j; k++) {
+    const Method * method_k = method_list_[k];
+    if (! method_k->has_output_field_list()) return false;
+    const std::vector<int> out_k = method_k->output_field_list();
+    for (int id : src_j) {
+      if (std::find(out_k.begin(),out_k.end(),id) != out_k.end()) return false;
+    }
+  }
+
+  return true;
+}
+
+//----------------------------------------------------------------------
+
 Compute * Problem::create_compute
   ( std::string name,
     Config * config ) throw ()
@@ -921,6 +1205,8 @@ Method * Problem::create_method_
     method = new MethodNull(p_group);
   } else if (name == "flux_correct") {
     method = new MethodFluxCorrect(p_group);
+  } else if (name == "histogram") {
+    method = new MethodHistogram(p_group);
   } else if (name == "output") {
     // we probably don't have to directly pass factory...
     method = new MethodOutput(factory, p_group);
@@ -929,11 +1215,14 @@ Method * Problem::create_method_
     // TODO: refactor to use a factory method/default constructor
     //   - can we look up mesh_min_level from an existing object? Like Adapt or
     //     Hierarchy?
-    method = new MethodOrderMorton(config->mesh_min_level);
+    method = new MethodOrderMorton
+      (config->mesh_min_level, p_group.value_string("weight","count"));
 
   } else if (name == "order_hilbert") {
 
-    method = new MethodOrderHilbert(config->mesh_min_level);
+    method = new MethodOrderHilbert
+      (config->mesh_min_level, p_group.value_string("weight","count"),
+       p_group.value_logical("incremental",false));
 
   } else if (name == "refresh") {
     method = new MethodRefresh(p_group);
@@ -1035,6 +1324,10 @@ Output * Problem::create_output_
 
     output = new OutputData (index,factory,config);
 
+  } else if (name == "adios") {
+
+    output = new OutputAdios (index,factory,config);
+
   } else if (name == "checkpoint") {
 
     output = new OutputCheckpoint (index,factory,
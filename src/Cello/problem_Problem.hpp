@@ -130,6 +130,10 @@ public: // interface
   int num_solvers () const throw()
   { return solver_list_.size(); }
   
+  /// Return the number of method objects
+  int num_methods () const throw()
+  { return method_list_.size(); }
+
   /// Return the ith method object
   Method * method(size_t i) const throw() 
   { return (i < method_list_.size()) ? method_list_[i] : nullptr; }
@@ -145,6 +149,20 @@ public: // interface
   // method called "name2". Returns false otherwise.
   bool method_precedes(const std::string &name1, const std::string &name2) const
       throw();
+
+  /// Return whether Method j may be computed while Method i is in
+  /// progress: both must declare the fields they read and write, and
+  /// neither may write a field the other reads or writes.  Fields in
+  /// Method j's refresh count as both read and written, and a refresh
+  /// of all fields, particles, or fluxes is never independent.
+  bool method_independent(size_t i, size_t j) const throw();
+
+  /// Return whether Method j's refresh may be merged into Method i's
+  /// refresh (i < j): Methods i through j-1 must declare the fields
+  /// they write, none may write a field in Method j's refresh, and
+  /// both refreshes must exchange ghost zones the same way.  Method j's
+  /// refresh may not include particles, fluxes, or accumulated fields.
+  bool method_fusable(size_t i, size_t j) const throw();
   
   /// Return the ith prolong object
   Prolong * prolong(size_t i = 0) const throw()
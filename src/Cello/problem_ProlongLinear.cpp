@@ -77,16 +77,128 @@ void ProlongLinear::apply
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// Coarse index offset and weights of each fine cell along one
+  /// axis, computed once per call so the inner loops are branch-free
+  template <class T>
+  void prolong_weights_
+  (int nf, int gc, std::vector<int> & ic, std::vector<T> & w0,
+   std::vector<T> & w1)
+  {
+    ic.resize(nf);
+    w0.resize(nf);
+    w1.resize(nf);
+    for (int i_f=0; i_f<nf; i_f++) {
+
+      ic[i_f] = ((i_f+1) >> 1) - gc;
+
+      // Default weighting factor
+      int w[2] = { 1, 3 };
+
+      // Update weights if no ghosts and on edges
+      if (i_f==0)    { ic[i_f] += gc; }
+      if (i_f==nf-1) { ic[i_f] -= gc; }
+      if (i_f==0 || i_f==nf-1) {
+        w[0] += 4*gc;
+        w[1] -= 4*gc;
+      }
+
+      w0[i_f] = 0.25*w[ i_f&1];
+      w1[i_f] = 0.25*w[~i_f&1];
+    }
+  }
+
+  /// Prolong with the rank and accumulate flag known at compile time.
+  /// Weights are multiples of 1/64, so hoisting their products out of
+  /// the inner loop does not change the result
+  template <class T, int RANK, bool ACCUMULATE>
+  void prolong_linear_
+  (T * values_f, int mf3[3], int of3[3], int nf3[3],
+   const T * values_c, int mc3[3], int oc3[3], int nc3[3],
+   const int gc3[3])
+  {
+    const int dcx = 1;
+    const int dcy = mc3[0];
+    const int dcz = mc3[0]*mc3[1];
+
+    std::vector<int> icx,icy,icz;
+    std::vector<T> wx0,wx1,wy0,wy1,wz0,wz1;
+
+    prolong_weights_ (nf3[0],gc3[0],icx,wx0,wx1);
+    if (RANK >= 2) prolong_weights_ (nf3[1],gc3[1],icy,wy0,wy1);
+    if (RANK >= 3) prolong_weights_ (nf3[2],gc3[2],icz,wz0,wz1);
+
+    const int nfx = nf3[0];
+    const int nfy = (RANK >= 2) ? nf3[1] : 1;
+    const int nfz = (RANK >= 3) ? nf3[2] : 1;
+
+    for (int ifz=0; ifz<nfz; ifz++) {
+
+      const int jcz = (RANK >= 3) ? oc3[2]+icz[ifz] : 0;
+      const int jfz = (RANK >= 3) ? of3[2]+ifz : 0;
+      const T z0 = (RANK >= 3) ? wz0[ifz] : T(1);
+      const T z1 = (RANK >= 3) ? wz1[ifz] : T(0);
+
+      for (int ify=0; ify<nfy; ify++) {
+
+        const int jcy = (RANK >= 2) ? oc3[1]+icy[ify] : 0;
+        const int jfy = (RANK >= 2) ? of3[1]+ify : 0;
+        const T y0 = (RANK >= 2) ? wy0[ify] : T(1);
+        const T y1 = (RANK >= 2) ? wy1[ify] : T(0);
+
+        const T w00 = y0*z0;
+        const T w10 = y1*z0;
+        const T w01 = y0*z1;
+        const T w11 = y1*z1;
+
+        const int i_c0 = oc3[0] + mc3[0]*(jcy + mc3[1]*jcz);
+        const int i_f0 = of3[0] + mf3[0]*(jfy + mf3[1]*jfz);
+
+        const int * ic = icx.data();
+        const T * x0 = wx0.data();
+        const T * x1 = wx1.data();
+
+        for (int ifx=0; ifx<nfx; ifx++) {
+
+          const int i_c = i_c0 + ic[ifx];
+          const T * c = values_c + i_c;
+
+          T value;
+          if (RANK == 1) {
+            value = x0[ifx]*c[0] + x1[ifx]*c[dcx];
+          } else if (RANK == 2) {
+            value = x0[ifx]*w00*c[0]
+              +     x1[ifx]*w00*c[dcx]
+              +     x0[ifx]*w10*c[      dcy]
+              +     x1[ifx]*w10*c[dcx + dcy];
+          } else {
+            value = x0[ifx]*w00*c[0]
+              +     x1[ifx]*w00*c[dcx]
+              +     x0[ifx]*w10*c[      dcy]
+              +     x1[ifx]*w10*c[dcx + dcy]
+              +     x0[ifx]*w01*c[            dcz]
+              +     x1[ifx]*w01*c[dcx       + dcz]
+              +     x0[ifx]*w11*c[      dcy + dcz]
+              +     x1[ifx]*w11*c[dcx + dcy + dcz];
+          }
+
+          if (ACCUMULATE) values_f[i_f0 + ifx] += value;
+          else            values_f[i_f0 + ifx]  = value;
+        }
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void ProlongLinear::apply_
 (  T * values_f, int mf3[3], int of3[3], int nf3[3],
    const T * values_c, int mc3[3], int oc3[3], int nc3[3],
    bool accumulate)
 {
-  const int dcx = 1;
-  const int dcy = mc3[0];
-  const int dcz = mc3[0]*mc3[1];
-
   int rank = (mf3[1] == 1) ? 1 : ( (mf3[2] == 1) ? 2 : 3 );
 
   for (int i=0; i<rank; i++) {
@@ -95,211 +207,37 @@ void ProlongLinear::apply_
              "fine array %c-axis %d must be 2 times coarse axis %d",
              xyz[i],nf3[i],nc3[i],
              nf3[i]==2*nc3[i] || nf3[i]==2*(nc3[i]-2));
-
-    // ASSERT2 ("ProlongLinear::apply_",
-    //          "fine grid %c-axis %d must be divisible by 2",
-    //          xyz[i],nf3[i],nf3[i] % 2 == 0);
-    // ASSERT2 ("ProlongLinear::apply_",
-    //          "fine grid %c-axis %d must be at least 4",
-    //          xyz[i],nf3[i],nf3[i] >= 4);
   }
 
   // adjustment if coarse ghost cells available
   // NOTE:1 if ghosts not available , 0 if ghosts available
-  
-  int gcx = (nf3[0]==2*nc3[0]) ? 1 : 0;
-  int gcy = (nf3[1]==2*nc3[1]) ? 1 : 0;
-  int gcz = (nf3[2]==2*nc3[2]) ? 1 : 0;
+
+  const int gc3[3] = {
+    (nf3[0]==2*nc3[0]) ? 1 : 0,
+    (nf3[1]==2*nc3[1]) ? 1 : 0,
+    (nf3[2]==2*nc3[2]) ? 1 : 0 };
 
 #ifdef TRACE_SUMS
   T cmin=1e30,cmax=-1e30,cavg=0.0,ccount=0;
   T fmin=1e30,fmax=-1e30,favg=0.0,fcount=0;
 #endif
 
-  const int mf = mf3[0]*mf3[1]*mf3[2];
-  
-  T * temp_f = (accumulate) ? (new T [mf]) : values_f;
-
-  if (rank == 1) {
-
-    const int ofx = of3[0];
-    const int ocx = oc3[0];
-    const int nfx = nf3[0];
+#define PROLONG_LINEAR(RANK,ACCUMULATE)                         \
+  prolong_linear_<T,RANK,ACCUMULATE>                            \
+    (values_f,mf3,of3,nf3,values_c,mc3,oc3,nc3,gc3)
 
-    for (int ifx = 0; ifx<nfx; ifx++) {
-
-      int icx = ((ifx+1) >> 1) - gcx;
-
-      // Default weighting factor
-      int wx[2] = { 1, 3 };
-
-      // Update weights if no ghosts and on edges
-      if (ifx==0)     { icx += gcx; }
-      if (ifx==nfx-1) { icx -= gcx; }
-      if (ifx==0 || ifx==nfx-1) {
-        wx[0] += 4*gcx;
-        wx[1] -= 4*gcx;
-      }
-
-      T wx0 = 0.25*wx[ ifx&1];
-      T wx1 = 0.25*wx[~ifx&1];
-
-      int i_c = (ocx+icx) ;
-      int i_f = (ofx+ifx) ;
-
-      temp_f[i_f] = wx0*values_c[i_c]
-        +             wx1*values_c[i_c + dcx ];
-    }
-
-  } else if (rank == 2) {
-
-    const int ofy = of3[1];
-    const int ocy = oc3[1];
-    const int nfy = nf3[1];
-    
-    for (int ify = 0; ify<nfy; ify++) {
-
-      int icy = ((ify+1) >> 1) - gcy;
-
-      // Default weighting factor
-      int wy[2] = { 1, 3 };
-
-      // Update weights if no ghosts and on edges
-      if (ify==0)     { icy += gcy; }
-      if (ify==nfy-1) { icy -= gcy; }
-      if (ify==0 || ify==nfy-1) {
-        wy[0] += 4*gcy;
-        wy[1] -= 4*gcy;
-      }
-
-      T wy0 = 0.25*wy[ ify&1];
-      T wy1 = 0.25*wy[~ify&1];
-
-      const int ofx = of3[0];
-      const int ocx = oc3[0];
-      const int nfx = nf3[0];
-
-      const int mcx = mc3[0];
-      const int mfx = mf3[0];
-
-      for (int ifx = 0; ifx<nfx; ifx++) {
-
-        int icx = ((ifx+1) >> 1) - gcx;
-
-        // Default weighting factor
-        int wx[2] = { 1, 3 };
-
-        // Update weights if no ghosts and on edges
-        if (ifx==0)     { icx += gcx; }
-        if (ifx==nfx-1) { icx -= gcx; }
-        if (ifx==0 || ifx==nfx-1) {
-          wx[0] += 4*gcx;
-          wx[1] -= 4*gcx;
-        }
-
-        T wx0 = 0.25*wx[ ifx&1];
-        T wx1 = 0.25*wx[~ifx&1];
-
-        int i_c = (ocx+icx) + mcx * ( (ocy+icy) );
-        int i_f = (ofx+ifx) + mfx * ( (ofy+ify) );
-
-        temp_f[i_f] = wx0*wy0*values_c[i_c]
-          +             wx1*wy0*values_c[i_c + dcx ]
-          +             wx0*wy1*values_c[i_c       + dcy ]
-          +             wx1*wy1*values_c[i_c + dcx + dcy ];
-      }
-    }
-
-
-  } else { // rank == 3
-
-    const int ofz = of3[2];
-    const int ocz = oc3[2];
-    const int nfz = nf3[2];
-
-    for (int ifz = 0; ifz<nfz; ifz++) {
-
-      int icz = ((ifz+1) >> 1) - gcz;
-
-      // Default weighting factor
-      int wz[2] = { 1, 3 };
-
-      // Update weights if no ghosts and on edges
-      if (ifz==0)     { icz += gcz; }
-      if (ifz==nfz-1) { icz -= gcz; }
-      if (ifz==0 || ifz==nfz-1) {
-        wz[0] += 4*gcz;
-        wz[1] -= 4*gcz;
-      }
-
-      T wz0 = 0.25*wz[ ifz&1];
-      T wz1 = 0.25*wz[~ifz&1];
-
-      const int ofy = of3[1];
-      const int ocy = oc3[1];
-      const int nfy = nf3[1];
-
-      for (int ify = 0; ify<nfy; ify++) {
-
-        int icy = ((ify+1) >> 1) - gcy;
-
-        // Default weighting factor
-        int wy[2] = { 1, 3 };
-
-        // Update weights if no ghosts and on edges
-        if (ify==0)     { icy += gcy; }
-        if (ify==nfy-1) { icy -= gcy; }
-        if (ify==0 || ify==nfy-1) {
-          wy[0] += 4*gcy;
-          wy[1] -= 4*gcy;
-        }
-
-        T wy0 = 0.25*wy[ ify&1];
-        T wy1 = 0.25*wy[~ify&1];
-
-        const int ofx = of3[0];
-        const int ocx = oc3[0];
-        const int nfx = nf3[0];
-
-        const int mcx = mc3[0];
-        const int mfx = mf3[0];
-        const int mcy = mc3[1];
-        const int myf = mf3[1];
-
-        for (int ifx = 0; ifx<nfx; ifx++) {
-
-          int icx = ((ifx+1) >> 1) - gcx;
-
-          // Default weighting factor
-          int wx[2] = { 1, 3 };
-
-          // Update weights if no ghosts and on edges
-          if (ifx==0)     { icx += gcx; }
-          if (ifx==nfx-1) { icx -= gcx; }
-          if (ifx==0 || ifx==nfx-1) {
-            wx[0] += 4*gcx;
-            wx[1] -= 4*gcx;
-          }
-
-          T wx0 = 0.25*wx[ ifx&1];
-          T wx1 = 0.25*wx[~ifx&1];
-
-          int i_c = (ocx+icx) + mcx*( (ocy+icy) + mcy*(ocz+icz) );
-          int i_f = (ofx+ifx) + mfx*( (ofy+ify) + myf*(ofz+ifz) );
-	  
-          temp_f[i_f] = wx0*wy0*wz0*values_c[i_c]
-            +             wx1*wy0*wz0*values_c[i_c + dcx ]
-            +             wx0*wy1*wz0*values_c[i_c       + dcy ]
-            +             wx1*wy1*wz0*values_c[i_c + dcx + dcy ]
-            +             wx0*wy0*wz1*values_c[i_c             + dcz ]
-            +             wx1*wy0*wz1*values_c[i_c + dcx       + dcz ]
-            +             wx0*wy1*wz1*values_c[i_c       + dcy + dcz ]
-            +             wx1*wy1*wz1*values_c[i_c + dcx + dcy + dcz ];
-        }
-      }
-    }
+  if (accumulate) {
+    if      (rank == 1) PROLONG_LINEAR(1,true);
+    else if (rank == 2) PROLONG_LINEAR(2,true);
+    else                PROLONG_LINEAR(3,true);
+  } else {
+    if      (rank == 1) PROLONG_LINEAR(1,false);
+    else if (rank == 2) PROLONG_LINEAR(2,false);
+    else                PROLONG_LINEAR(3,false);
   }
 
+#undef PROLONG_LINEAR
+
 #ifdef TRACE_SUMS
   if (accumulate) {
     DEBUG_PRINT_ARRAY0("values_c",values_c,mc3,nc3,oc3);
@@ -353,18 +291,6 @@ void ProlongLinear::apply_
   }
 #endif        
 
-  if (accumulate) {
-    int i0 = of3[0] + mf3[0]*(of3[1] + mf3[1]*of3[2]);
-    for (int iz=0; iz<nf3[2]; iz++) {
-      for (int iy=0; iy<nf3[1]; iy++) {
-        for (int ix=0; ix<nf3[0]; ix++) {
-          int i = i0 + ix + mf3[0]*(iy + mf3[1]*iz);
-          values_f[i] += temp_f[i];
-        }
-      }
-    }
-    delete [] temp_f;
-  }
 }
 
 //======================================================================
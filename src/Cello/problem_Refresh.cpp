@@ -143,10 +143,12 @@ int Refresh::data_size () const
 
   SIZE_SCALAR_TYPE(count,int,all_particles_);
   SIZE_SCALAR_TYPE(count,bool,particles_are_copied_);
+  SIZE_SCALAR_TYPE(count,double,particle_copy_width_);
   SIZE_VECTOR_TYPE(count,int,particle_list_);
 
   SIZE_SCALAR_TYPE(count,int,all_fluxes_);
   SIZE_SCALAR_TYPE(count,int,ghost_depth_);
+  SIZE_SCALAR_TYPE(count,int,ghost_layers_);
   SIZE_SCALAR_TYPE(count,int,min_face_rank_);
   SIZE_SCALAR_TYPE(count,int,neighbor_type_);
   SIZE_SCALAR_TYPE(count,int,accumulate_);
@@ -160,6 +162,11 @@ int Refresh::data_size () const
   SIZE_SCALAR_TYPE(count,int,id_prolong_);
   SIZE_SCALAR_TYPE(count,int,id_restrict_);
 
+  SIZE_SCALAR_TYPE(count,int,codec_);
+  SIZE_SCALAR_TYPE(count,double,codec_tolerance_);
+  SIZE_VECTOR_TYPE(count,int,codec_field_list_);
+  SIZE_SCALAR_TYPE(count,int,sparse_);
+
   return count;
 
 }
@@ -176,10 +183,12 @@ char * Refresh::save_data (char * buffer) const
 
   SAVE_SCALAR_TYPE(p,int,all_particles_);
   SAVE_SCALAR_TYPE(p,bool,particles_are_copied_);
+  SAVE_SCALAR_TYPE(p,double,particle_copy_width_);
   SAVE_VECTOR_TYPE(p,int,particle_list_);
 
   SAVE_SCALAR_TYPE(p,int,all_fluxes_);
   SAVE_SCALAR_TYPE(p,int,ghost_depth_);
+  SAVE_SCALAR_TYPE(p,int,ghost_layers_);
   SAVE_SCALAR_TYPE(p,int,min_face_rank_);
   SAVE_SCALAR_TYPE(p,int,neighbor_type_);
   SAVE_SCALAR_TYPE(p,int,accumulate_);
@@ -193,6 +202,11 @@ char * Refresh::save_data (char * buffer) const
   SAVE_SCALAR_TYPE(p,int,id_prolong_);
   SAVE_SCALAR_TYPE(p,int,id_restrict_);
 
+  SAVE_SCALAR_TYPE(p,int,codec_);
+  SAVE_SCALAR_TYPE(p,double,codec_tolerance_);
+  SAVE_VECTOR_TYPE(p,int,codec_field_list_);
+  SAVE_SCALAR_TYPE(p,int,sparse_);
+
   ASSERT2 ("Refresh::save_data\n",
  	   "Actual size %ld does not equal computed size %d",
 	   p-buffer,data_size(),
@@ -213,10 +227,12 @@ char * Refresh::load_data (char * buffer)
 
   LOAD_SCALAR_TYPE(p,int,all_particles_);
   LOAD_SCALAR_TYPE(p,bool,particles_are_copied_);
+  LOAD_SCALAR_TYPE(p,double,particle_copy_width_);
   LOAD_VECTOR_TYPE(p,int,particle_list_);
 
   LOAD_SCALAR_TYPE(p,int,all_fluxes_);
   LOAD_SCALAR_TYPE(p,int,ghost_depth_);
+  LOAD_SCALAR_TYPE(p,int,ghost_layers_);
   LOAD_SCALAR_TYPE(p,int,min_face_rank_);
   LOAD_SCALAR_TYPE(p,int,neighbor_type_);
   LOAD_SCALAR_TYPE(p,int,accumulate_);
@@ -230,6 +246,11 @@ char * Refresh::load_data (char * buffer)
   LOAD_SCALAR_TYPE(p,int,id_prolong_);
   LOAD_SCALAR_TYPE(p,int,id_restrict_);
 
+  LOAD_SCALAR_TYPE(p,int,codec_);
+  LOAD_SCALAR_TYPE(p,double,codec_tolerance_);
+  LOAD_VECTOR_TYPE(p,int,codec_field_list_);
+  LOAD_SCALAR_TYPE(p,int,sparse_);
+
   ASSERT2 ("Refresh::load_data\n",
 	   "Actual size %ld does not equal computed size %d",
 	   p-buffer,data_size(),
@@ -28,9 +28,11 @@ public: // interface
     field_list_dst_(),
     all_particles_(false),
     particles_are_copied_(false),
+    particle_copy_width_(0.0),
     particle_list_(),
     all_fluxes_(false),
     ghost_depth_(0),
+    ghost_layers_(0),
     min_face_rank_(0),
     neighbor_type_(neighbor_leaf),
     accumulate_(false),
@@ -41,7 +43,11 @@ public: // interface
     root_level_(0),
     id_refresh_(-1),
     id_prolong_(0),
-    id_restrict_(0)
+    id_restrict_(0),
+    codec_(codec_none),
+    codec_tolerance_(0.0),
+    codec_field_list_(),
+    sparse_(false)
   {
   }
 
@@ -58,9 +64,11 @@ public: // interface
       field_list_dst_(),
       all_particles_(false),
       particles_are_copied_(false),
+      particle_copy_width_(0.0),
       particle_list_(),
       all_fluxes_(false),
       ghost_depth_(ghost_depth),
+      ghost_layers_(0),
       min_face_rank_(min_face_rank),
       neighbor_type_(neighbor_type),
       accumulate_(false),
@@ -71,7 +79,11 @@ public: // interface
       root_level_(0),
       id_refresh_(-1),
       id_prolong_(0),
-      id_restrict_(0)
+      id_restrict_(0),
+      codec_(codec_none),
+      codec_tolerance_(0.0),
+      codec_field_list_(),
+      sparse_(false)
   {
   }
 
@@ -86,9 +98,11 @@ public: // interface
     field_list_dst_(),
     all_particles_(false),
     particles_are_copied_(false),
+    particle_copy_width_(0.0),
     particle_list_(),
     all_fluxes_(false),
     ghost_depth_(0),
+    ghost_layers_(0),
     min_face_rank_(0),
     neighbor_type_(0),
     accumulate_(false),
@@ -99,7 +113,11 @@ public: // interface
     root_level_(0),
     id_refresh_(-1),
     id_prolong_(-1),
-    id_restrict_(-1)
+    id_restrict_(-1),
+    codec_(codec_none),
+    codec_tolerance_(0.0),
+    codec_field_list_(),
+    sparse_(false)
   {
   }
 
@@ -115,8 +133,10 @@ public: // interface
     p | all_particles_;
     p | particle_list_;
     p | particles_are_copied_;
+    p | particle_copy_width_;
     p | all_fluxes_;
     p | ghost_depth_;
+    p | ghost_layers_;
     p | min_face_rank_;
     p | neighbor_type_;
     p | accumulate_;
@@ -128,6 +148,10 @@ public: // interface
     p | id_refresh_;
     p | id_prolong_;
     p | id_restrict_;
+    p | codec_;
+    p | codec_tolerance_;
+    p | codec_field_list_;
+    p | sparse_;
   }
 
   //--------------------------------------------------
@@ -176,6 +200,14 @@ public: // interface
     field_list_dst_ = field_list;
   }
 
+  /// Remove all fields from the Refresh
+  void clear_fields ()
+  {
+    all_fields_ = false;
+    field_list_src_.clear();
+    field_list_dst_.clear();
+  }
+
   /// Return whether all fields are refreshed
   bool all_fields() const
   { return all_fields_; }
@@ -222,6 +254,13 @@ public: // interface
     particles_are_copied_ = particles_are_copied;
   }
 
+  /// Set the distance from the Block within which copied particles
+  /// are sent to each neighbor.  If zero, the default, all particles
+  /// are copied to all neighbouring blocks.
+  void set_particle_copy_width(double width) {
+    particle_copy_width_ = width;
+  }
+
   /// Return whether all particles are refreshed
   bool all_particles() const
   { return all_particles_; }
@@ -232,6 +271,11 @@ public: // interface
   bool particles_are_copied() const
   { return particles_are_copied_; }
 
+  /// Return the distance from the Block within which copied particles
+  /// are sent to each neighbor, or zero if all are
+  double particle_copy_width() const
+  { return particle_copy_width_; }
+
   /// Return whether any particles are refreshed
   bool any_particles() const
   { return (all_particles_ || (particle_list_.size() > 0)); }
@@ -301,6 +345,16 @@ public: // interface
   int ghost_depth() const
   { return ghost_depth_; }
 
+  /// Set the number of ghost zone layers to refresh, or 0 for each
+  /// field's full ghost depth
+  void set_ghost_layers(int ghost_layers)
+  { ghost_layers_ = ghost_layers; }
+
+  /// Return the number of ghost zone layers to refresh, or 0 for each
+  /// field's full ghost depth
+  int ghost_layers() const
+  { return ghost_layers_; }
+
   /// Return the type of neighbors to refresh with: neighbor_leaf for
   /// neighboring leaf node (may be different mesh level) or
   /// neighbor_level for neighboring block in the same level (may be
@@ -316,9 +370,10 @@ public: // interface
     return accumulate_ && (field_list_src_[i_f] != field_list_dst_[i_f]);
   }
 
-  //  bool accumulate() const
-  //  { return accumulate_; }
-  
+  /// Return whether any field is accumulated
+  bool any_accumulate() const
+  { return accumulate_; }
+
   /// Set whether to add neighbor face values to ghost zones instead of
   /// copying them.
   void set_accumulate(bool accumulate)
@@ -368,6 +423,7 @@ public: // interface
     fprintf (fp,"     all_fluxes = %d\n",all_fluxes_);
     fprintf (fp,"\n");
     fprintf (fp,"     ghost_depth = %d\n",ghost_depth_);
+    fprintf (fp,"     ghost_layers = %d\n",ghost_layers_);
     fprintf (fp,"     min_face_rank: %d\n",min_face_rank_);
     fprintf (fp,"     neighbor_type: %d\n",neighbor_type_);
     fprintf (fp,"     accumulate: %d\n",accumulate_);
@@ -377,6 +433,9 @@ public: // interface
     fprintf (fp,"     active: %d\n",active_);
     fprintf (fp,"     callback: %d\n",callback_);
     fprintf (fp,"     root_level: %d\n",root_level_);
+    fprintf (fp,"     codec: %d\n",codec_);
+    fprintf (fp,"     codec_tolerance: %g\n",codec_tolerance_);
+    fprintf (fp,"     sparse: %d\n",sparse_);
   }
 
   /// Return loop limits 0:3 for 4x4x4 particle data array indices
@@ -441,6 +500,57 @@ public: // interface
   
   /// Return the restriction operator for refresh
   Restrict * restrict ();
+  /// Return the restriction id
+  int index_restrict () const
+  { return id_restrict_; }
+
+  //--------------------------------------------------
+  // SPARSE REFRESH
+  //--------------------------------------------------
+
+  /// Set whether only fields modified since they were last sent by
+  /// this Refresh object are sent (see FieldData::set_modified())
+  void set_sparse (bool sparse)
+  { sparse_ = sparse; }
+
+  /// Return whether unmodified fields are skipped.  Refreshes that
+  /// accumulate values always send all fields.
+  bool is_sparse () const
+  { return sparse_ && ! accumulate_; }
+
+  //--------------------------------------------------
+  // FIELD FACE ENCODING
+  //--------------------------------------------------
+
+  /// Set how field face arrays are encoded when sent to remote
+  /// neighbors: codec_none, codec_lossless, codec_lossy, codec_sparse,
+  /// or codec_constant
+  void set_codec (int codec)
+  { codec_ = codec; }
+
+  /// Return how field face arrays are encoded
+  int codec () const
+  { return codec_; }
+
+  /// Set the absolute error bound for codec_lossy
+  void set_codec_tolerance (double tolerance)
+  { codec_tolerance_ = tolerance; }
+
+  /// Set the fields encoded lossily by codec_lossy; if empty (the
+  /// default) all refreshed fields are
+  void set_codec_field_list (const std::vector<int> & field_list)
+  { codec_field_list_ = field_list; }
+
+  /// Return the absolute error bound for encoding the given field, or
+  /// 0.0 if it is encoded losslessly
+  double codec_tolerance (int id_field) const
+  {
+    const bool is_lossy = (codec_ == codec_lossy) &&
+      (codec_field_list_.empty() ||
+       std::find (codec_field_list_.begin(), codec_field_list_.end(),
+                  id_field) != codec_field_list_.end());
+    return is_lossy ? codec_tolerance_ : 0.0;
+  }
   
   //--------------------------------------------------
 
@@ -480,6 +590,10 @@ private: // attributes
   /// Whether or not, for all particle types participating in the refresh,
   /// all particles are copied to all neighbouring blocks
   bool particles_are_copied_;
+
+  /// Distance from the Block within which copied particles are sent
+  /// to each neighbor, or zero to copy all particles to all neighbors
+  double particle_copy_width_;
   
   /// Indicies of particles to include
   std::vector <int> particle_list_;
@@ -490,6 +604,9 @@ private: // attributes
   /// Ghost zone depth
   int ghost_depth_;
 
+  /// Number of ghost zone layers to refresh, or 0 for all
+  int ghost_layers_;
+
   /// minimum face rank to refresh (2 include facets, 1 also edges, 0
   /// also corners)
   int min_face_rank_;
@@ -521,6 +638,18 @@ private: // attributes
   /// ids of interpolation and restriction operators
   int id_prolong_;
   int id_restrict_;
+
+  /// Encoding of field face arrays sent to remote neighbors
+  int codec_;
+
+  /// Absolute error bound for codec_lossy
+  double codec_tolerance_;
+
+  /// Fields encoded lossily by codec_lossy (all if empty)
+  std::vector<int> codec_field_list_;
+
+  /// Whether only modified fields are sent
+  int sparse_;
 };
 
 #endif /* PROBLEM_REFRESH_HPP */
@@ -53,6 +53,65 @@ int RestrictLinear::apply
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// Restrict with the rank and accumulate flag known at compile
+  /// time, so lower-rank restriction has no degenerate loops or
+  /// index terms
+  template <class T, int RANK, bool ACCUMULATE>
+  void restrict_linear_
+  ( T *       values_c, int nd3_c[3], int im3_c[3],  int n3_c[3],
+    const T * values_f, int nd3_f[3], int im3_f[3])
+  {
+    const int dx = 1;
+    const int dy = nd3_f[0];
+    const int dz = nd3_f[0]*nd3_f[1];
+
+    const T weight = (RANK == 1) ? 0.5 : ((RANK == 2) ? 0.25 : 0.125);
+
+    const int ncy = (RANK >= 2) ? n3_c[1] : 1;
+    const int ncz = (RANK >= 3) ? n3_c[2] : 1;
+
+    for (int iz_c=0; iz_c<ncz; iz_c++) {
+      const int jz_c = (RANK >= 3) ? im3_c[2]+iz_c   : 0;
+      const int jz_f = (RANK >= 3) ? im3_f[2]+iz_c*2 : 0;
+      for (int iy_c=0; iy_c<ncy; iy_c++) {
+        const int jy_c = (RANK >= 2) ? im3_c[1]+iy_c   : 0;
+        const int jy_f = (RANK >= 2) ? im3_f[1]+iy_c*2 : 0;
+
+        T *       c = values_c + im3_c[0] + nd3_c[0]*(jy_c + nd3_c[1]*jz_c);
+        const T * f = values_f + im3_f[0] + nd3_f[0]*(jy_f + nd3_f[1]*jz_f);
+
+        for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
+          const T * fx = f + ix_c*2;
+
+          T value;
+          if (RANK == 1) {
+            value = weight *
+              ( fx[0] + fx[dx] );
+          } else if (RANK == 2) {
+            value = weight *
+              ( fx[0]       + fx[dx] +
+                fx[dy]      + fx[dx + dy] );
+          } else {
+            value = weight *
+              ( fx[0]       + fx[dx] +
+                fx[dy]      + fx[dx + dy] +
+                fx[dz]      + fx[dx + dz] +
+                fx[dy + dz] + fx[dx + dy + dz] );
+          }
+
+          if (ACCUMULATE) c[ix_c] += value;
+          else            c[ix_c]  = value;
+        }
+      }
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
 template<class T>
 int RestrictLinear::apply_
 ( T *       values_c, int nd3_c[3], int im3_c[3],  int n3_c[3],
@@ -62,135 +121,22 @@ int RestrictLinear::apply_
 
   const int rank = (nd3_f[1] == 1) ? 1 : ((nd3_f[2] == 1) ? 2 : 3);
 
-  const int dx = 1;
-  const int dy = nd3_f[0];
-  const int dz = nd3_f[0]*nd3_f[1];
-
-  if (rank == 1) {
-
-    if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-
-	int i_c = (im3_c[0]+ix_c);
-	int i_f = (im3_f[0]+ix_f);
-
-	values_c[i_c] = 0.5 *
-	  ( values_f[i_f     ] + 
-	    values_f[i_f + dx] );
-      }
-    } else { // accumulate
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-
-	int i_c = (im3_c[0]+ix_c);
-	int i_f = (im3_f[0]+ix_f);
+#define RESTRICT_LINEAR(RANK,ACCUMULATE)                        \
+  restrict_linear_<T,RANK,ACCUMULATE>                           \
+    (values_c,nd3_c,im3_c,n3_c,values_f,nd3_f,im3_f)
+
+  if (accumulate) {
+    if      (rank == 1) RESTRICT_LINEAR(1,true);
+    else if (rank == 2) RESTRICT_LINEAR(2,true);
+    else                RESTRICT_LINEAR(3,true);
+  } else {
+    if      (rank == 1) RESTRICT_LINEAR(1,false);
+    else if (rank == 2) RESTRICT_LINEAR(2,false);
+    else                RESTRICT_LINEAR(3,false);
+  }
 
-	values_c[i_c] += 0.5 *
-	  ( values_f[i_f     ] + 
-	    values_f[i_f + dx] );
-      }
-    }
+#undef RESTRICT_LINEAR
 
-  } else if (rank == 2) {
-
-    if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-
-	  int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	    (       (im3_c[1]+iy_c));
-	  int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	    (       (im3_f[1]+iy_f));
-
-	  values_c[i_c] = 0.25 *
-	    ( values_f[i_f          ] + 
-	      values_f[i_f + dx     ] +
-	      values_f[i_f +      dy] + 
-	      values_f[i_f + dx + dy] );
-	}
-      }
-    } else { // accumulate
-
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-
-	  int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	    (       (im3_c[1]+iy_c));
-	  int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	    (       (im3_f[1]+iy_f));
-
-	  values_c[i_c] += 0.25 *
-	    ( values_f[i_f          ] + 
-	      values_f[i_f + dx     ] +
-	      values_f[i_f +      dy] + 
-	      values_f[i_f + dx + dy] );
-	}
-      }
-    }
-    
-  } else if (rank == 3) {
-
-    if (! accumulate) {
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-	  for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
-	    int iz_f = iz_c*2;
-	    
-	    int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	      (       (im3_c[1]+iy_c) + nd3_c[1]*
-		      (im3_c[2]+iz_c));
-	    int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	      (       (im3_f[1]+iy_f) + nd3_f[1]*
-		      (im3_f[2]+iz_f));
-
-	    values_c[i_c] = 0.125 * 
-	      ( values_f[i_f               ] + 
-		values_f[i_f + dx          ] +
-		values_f[i_f +      dy     ] + 
-		values_f[i_f + dx + dy     ] +
-		values_f[i_f           + dz] + 
-		values_f[i_f + dx      + dz] +
-		values_f[i_f +      dy + dz] + 
-		values_f[i_f + dx + dy + dz] );
-	  }
-	}
-      }
-    } else { // accumulate
-      for (int ix_c=0; ix_c<n3_c[0]; ix_c++) {
-	int ix_f = ix_c*2;
-	for (int iy_c=0; iy_c<n3_c[1]; iy_c++) {
-	  int iy_f = iy_c*2;
-	  for (int iz_c=0; iz_c<n3_c[2]; iz_c++) {
-	    int iz_f = iz_c*2;
-
-	    int i_c = (im3_c[0]+ix_c) + nd3_c[0]*
-	      (       (im3_c[1]+iy_c) + nd3_c[1]*
-		      (im3_c[2]+iz_c));
-	    int i_f = (im3_f[0]+ix_f) + nd3_f[0]*
-	      (       (im3_f[1]+iy_f) + nd3_f[1]*
-		      (im3_f[2]+iz_f));
-
-	    values_c[i_c] += 0.125 * 
-	      ( values_f[i_f               ] + 
-		values_f[i_f + dx          ] +
-		values_f[i_f +      dy     ] + 
-		values_f[i_f + dx + dy     ] +
-		values_f[i_f           + dz] + 
-		values_f[i_f + dx      + dz] +
-		values_f[i_f +      dy + dz] + 
-		values_f[i_f + dx + dy + dz] );
-	  }
-	}
-      }
-    }
-  }
   return (sizeof(T) * n3_c[0]*n3_c[1]*n3_c[2]);
 }
 
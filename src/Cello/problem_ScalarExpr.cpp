@@ -152,6 +152,18 @@ template void ScalarExpr::evaluate
 
 //----------------------------------------------------------------------
 
+void ScalarExpr::evaluate_points (double * value, double t, int n,
+                                  double * x, double * y, double * z) const
+{
+  if (param_) {
+    param_->evaluate_float(n,value,x,y,z,t);
+  } else {
+    for (int i=0; i<n; i++) value[i] = value_;
+  }
+}
+
+//----------------------------------------------------------------------
+
 std::string ScalarExpr::expr_to_string() const throw()
 {
   if (param_){
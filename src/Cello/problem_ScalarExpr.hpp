@@ -99,6 +99,10 @@ public: // interface
     evaluate(value,t,ndx,nx,x,ndy,ny,y,ndz,nz,z,0,0);
   }
 
+  /// Return values at n points with coordinates x[i], y[i], z[i]
+  void evaluate_points (double * value, double t, int n,
+                        double * x, double * y, double * z) const;
+
 
   /// method used for debugging
   std::string expr_to_string() const throw();
@@ -71,6 +71,69 @@ double Value::evaluate (double t, double x, double y, double z) const throw ()
 
 //----------------------------------------------------------------------
 
+void Value::evaluate_points
+(double t, int n, double * x, double * y, double * z,
+ std::vector<int> & point, std::vector<double> & value) const throw ()
+{
+  point.clear();
+  value.clear();
+
+  // points not yet assigned a value, and their coordinates
+  std::vector<int> pending(n);
+  for (int i=0; i<n; i++) pending[i] = i;
+  std::vector<double> xs(x,x+n), ys(y,y+n), zs(z,z+n);
+  std::vector<double> vs;
+  std::unique_ptr<bool[]> mv (new bool[n]);
+
+  const int num_expr = scalar_expr_list_.size();
+  for (int index=0; index<num_expr && ! pending.empty(); index++) {
+
+    const int m = pending.size();
+    int num_selected = m;
+
+    if (mask_list_[index]) {
+      mask_list_[index]->evaluate_points
+        (mv.get(),t,m,xs.data(),ys.data(),zs.data());
+
+      // move the selected points to the front of xs,ys,zs and keep
+      // the rest pending (both writes trail the read index j)
+      int num_pending = 0;
+      num_selected = 0;
+      for (int j=0; j<m; j++) {
+        if (mv[j]) {
+          xs[num_selected] = xs[j];
+          ys[num_selected] = ys[j];
+          zs[num_selected] = zs[j];
+          point.push_back(pending[j]);
+          ++num_selected;
+        } else {
+          pending[num_pending++] = pending[j];
+        }
+      }
+      pending.resize(num_pending);
+    } else {
+      point.insert(point.end(),pending.begin(),pending.end());
+      pending.clear();
+    }
+
+    vs.resize(num_selected);
+    scalar_expr_list_[index].evaluate_points
+      (vs.data(),t,num_selected,xs.data(),ys.data(),zs.data());
+    value.insert(value.end(),vs.begin(),vs.end());
+
+    // regather the coordinates of the points still pending
+    const int num_pending = pending.size();
+    for (int j=0; j<num_pending; j++) {
+      const int i = pending[j];
+      xs[j] = x[i];
+      ys[j] = y[i];
+      zs[j] = z[i];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 template <class T>
 void Value::evaluate
 (T * values, double t,
@@ -78,9 +141,58 @@ void Value::evaluate
  int ndy, int ny, double * y,
  int ndz, int nz, double * z) const throw ()
 {
-  for (int index = (int)scalar_expr_list_.size()-1; index>=0; index--) {
-    scalar_expr_list_[index].evaluate
-      (values,t,ndx,nx,x,ndy,ny,y,ndz,nz,z,mask_list_[index], values);
+  // If each mask preceding some expression is false everywhere in
+  // the bounding box of the points, and that expression is unmasked
+  // or its mask is true everywhere, it alone assigns all values and
+  // no points need be selected
+
+  const double lower[3] =
+    { *std::min_element(x,x+nx), *std::min_element(y,y+ny),
+      *std::min_element(z,z+nz) };
+  const double upper[3] =
+    { *std::max_element(x,x+nx), *std::max_element(y,y+ny),
+      *std::max_element(z,z+nz) };
+
+  const int num_expr = scalar_expr_list_.size();
+  bool is_mixed = false;
+  for (int index=0; index<num_expr; index++) {
+    const mask_box_type box = mask_list_[index] ?
+      mask_list_[index]->evaluate_box(t,lower,upper) : mask_box_true;
+    if (box == mask_box_true) {
+      scalar_expr_list_[index].evaluate(values,t,ndx,nx,x,ndy,ny,y,ndz,nz,z);
+      return;
+    } else if (box == mask_box_mixed) {
+      is_mixed = true;
+      break;
+    }
+  }
+
+  // all masks false: no values assigned
+  if (! is_mixed) return;
+
+  const int n = nx*ny*nz;
+  std::vector<double> xp(n), yp(n), zp(n);
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+        int i=ix + nx*(iy + ny*iz);
+        xp[i] = x[ix];
+        yp[i] = y[iy];
+        zp[i] = z[iz];
+      }
+    }
+  }
+
+  std::vector<int> point;
+  std::vector<double> value;
+  evaluate_points (t,n,xp.data(),yp.data(),zp.data(),point,value);
+
+  for (size_t k=0; k<point.size(); k++) {
+    const int i = point[k];
+    const int ix = i % nx;
+    const int iy = (i / nx) % ny;
+    const int iz = i / (nx*ny);
+    values[ix + ndx*(iy + ndy*iz)] = (T) value[k];
   }
 }
 
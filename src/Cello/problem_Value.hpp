@@ -60,6 +60,17 @@ public: // interface
 
   double evaluate (double t, double x, double y, double z) const throw ();
 
+  /// Evaluate at n points with coordinates x[i], y[i], z[i].  For
+  /// each point where some mask holds, or an unmasked expression
+  /// applies, appends its index to point and its value to value;
+  /// other points are left to the caller's default.  Masks are
+  /// evaluated in order, each only at the points not already taken
+  /// by an earlier expression.
+  void evaluate_points (double t, int n,
+                        double * x, double * y, double * z,
+                        std::vector<int> & point,
+                        std::vector<double> & value) const throw ();
+
   /// returns a string that summarizes contents (for debugging)
   std::string debug_string() const throw();
 
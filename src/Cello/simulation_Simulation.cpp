@@ -37,12 +37,15 @@ Simulation::Simulation
   cycle_initial_(-1),
   time_(0.0),
   dt_(0),
+  dt_level_(),
   stop_(false),
   phase_(phase_unknown),
   config_(&g_config),
   problem_(NULL),
   timer_(),
   performance_(NULL),
+  tuner_(NULL),
+  budget_(NULL),
 #ifdef CONFIG_USE_PROJECTIONS
   projections_tracing_(true),
   projections_schedule_on_(NULL),
@@ -50,6 +53,9 @@ Simulation::Simulation
 #endif
   schedule_balance_(NULL),
   monitor_(NULL),
+  telemetry_(NULL),
+  telemetry_time_(0.0),
+  smp_time_(0.0),
   hierarchy_(NULL),
   scalar_descr_long_double_(NULL),
   scalar_descr_double_(NULL),
@@ -69,8 +75,10 @@ Simulation::Simulation
   index_output_(-1),
   num_solver_iter_(),
   max_solver_iter_(),
+  hist_solver_iter_(),
   restart_directory_(),
   restart_num_files_(),
+  restart_num_readers_(),
   restart_stream_file_list_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
@@ -109,12 +117,15 @@ Simulation::Simulation()
   cycle_initial_(-1),
   time_(0.0),
   dt_(0),
+  dt_level_(),
   stop_(false),
   phase_(phase_unknown),
   config_(&g_config),
   problem_(NULL),
   timer_(),
   performance_(NULL),
+  tuner_(NULL),
+  budget_(NULL),
 #ifdef CONFIG_USE_PROJECTIONS
   projections_tracing_(true),
   projections_schedule_on_(NULL),
@@ -122,6 +133,9 @@ Simulation::Simulation()
 #endif
   schedule_balance_(NULL),
   monitor_(NULL),
+  telemetry_(NULL),
+  telemetry_time_(0.0),
+  smp_time_(0.0),
   hierarchy_(NULL),
   scalar_descr_long_double_(NULL),
   scalar_descr_double_(NULL),
@@ -141,8 +155,10 @@ Simulation::Simulation()
   index_output_(-1),
   num_solver_iter_(),
   max_solver_iter_(),
+  hist_solver_iter_(),
   restart_directory_(),
   restart_num_files_(),
+  restart_num_readers_(),
   restart_stream_file_list_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
@@ -169,12 +185,15 @@ Simulation::Simulation (CkMigrateMessage *m)
     cycle_initial_(-1),
     time_(0.0),
     dt_(0),
+    dt_level_(),
     stop_(false),
     phase_(phase_unknown),
     config_(&g_config),
     problem_(NULL),
     timer_(),
     performance_(NULL),
+    tuner_(NULL),
+    budget_(NULL),
 #ifdef CONFIG_USE_PROJECTIONS
     projections_tracing_(true),
     projections_schedule_on_(NULL),
@@ -182,6 +201,9 @@ Simulation::Simulation (CkMigrateMessage *m)
 #endif
     schedule_balance_(NULL),
     monitor_(NULL),
+    telemetry_(NULL),
+    telemetry_time_(0.0),
+    smp_time_(0.0),
     hierarchy_(NULL),
     scalar_descr_long_double_(NULL),
     scalar_descr_double_(NULL),
@@ -201,8 +223,10 @@ Simulation::Simulation (CkMigrateMessage *m)
     index_output_(-1),
     num_solver_iter_(),
     max_solver_iter_(),
+    hist_solver_iter_(),
     restart_directory_(),
     restart_num_files_(),
+    restart_num_readers_(),
     restart_stream_file_list_()
 {
   for (int i=0; i<256; i++) dir_checkpoint_[i] = '\0';
@@ -250,6 +274,7 @@ void Simulation::pup (PUP::er &p)
   p | cycle_initial_;
   p | time_;
   p | dt_;
+  p | dt_level_;
   p | stop_;
   p | phase_;
 
@@ -321,8 +346,10 @@ void Simulation::pup (PUP::er &p)
   p | index_output_;
   p | num_solver_iter_;
   p | max_solver_iter_;
+  p | hist_solver_iter_;
   p | restart_directory_;
   p | restart_num_files_;
+  p | restart_num_readers_;
 }
 
 //----------------------------------------------------------------------
@@ -395,7 +422,14 @@ void Simulation::initialize_memory_() throw()
     memory->set_active(config_->memory_active);
     memory->set_warning_mb (config_->memory_warning_mb);
     memory->set_limit_gb (config_->memory_limit_gb);
+    memory->set_fill_new    (config_->memory_fill ? 0xaa : 0);
+    memory->set_fill_delete (config_->memory_fill ? 0xdd : 0);
   }
+  const std::string huge_pages = config_->memory_huge_pages;
+  PageMemory::set_huge_pages
+    ((huge_pages == "transparent") ? memory_huge_transparent :
+     (huge_pages == "explicit")    ? memory_huge_explicit :
+     memory_huge_none);
 }
 //----------------------------------------------------------------------
 
@@ -404,6 +438,11 @@ void Simulation::initialize_performance_() throw()
 
   performance_ = new Performance (config_);
 
+  if (config_->performance_critical_path || config_->performance_smp ||
+      config_->performance_budget_active) {
+    performance_->idle_enable();
+  }
+
   const bool in_charm = true;
   Performance * p = performance_;
   p->new_region(perf_unknown,            "unknown");
@@ -473,6 +512,22 @@ void Simulation::initialize_performance_() throw()
 
   p->start_region(perf_simulation);
 
+  tuner_ = new Tuner (config_->performance_tune_file,
+                      config_->performance_tune_active,
+                      config_->performance_tune_cycles);
+
+  if (config_->refresh_aggregate) {
+    tuner_->add_parameter
+      ("Refresh:aggregate_buffer_size", {16384, 65536, 262144, 1048576},
+       [] (int value) { RefreshAggregator::set_buffer_size(value); });
+    tuner_->add_parameter
+      ("Refresh:aggregate_flush_count", {4, 16, 64, 256},
+       [] (int value) { RefreshAggregator::set_flush_count(value); });
+  }
+
+  if (config_->performance_budget_active) {
+    budget_ = new Budget (config_->performance_budget_interval);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -491,6 +546,12 @@ void Simulation::initialize_monitor_() throw()
   int debug_mode = debug ? monitor_mode_all : monitor_mode_none;
   monitor_->set_mode("DEBUG",debug_mode);
   monitor_->set_verbose(config_->monitor_verbose);
+
+  if (config_->monitor_telemetry_target != "" && CkMyPe() == 0) {
+    telemetry_ = new Telemetry (config_->monitor_telemetry_target,
+                                config_->monitor_telemetry_format,
+                                config_->monitor_telemetry_prefix);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -525,10 +586,10 @@ void Simulation::initialize_data_descr_() throw()
 
   field_descr_->set_default_ghost_depth (gx,gy,gz);
 
-  // Default precision
+  // Field precision, which may be set per field or per group
 
   for (int i=0; i<field_descr_->field_count(); i++) {
-    field_descr_->set_precision(i,config_->field_precision);
+    field_descr_->set_precision(i,config_->field_precision_list[i]);
   }
 
   //--------------------------------------------------
@@ -546,6 +607,21 @@ void Simulation::initialize_data_descr_() throw()
   
   field_descr_->set_padding (config_->field_padding);
 
+  //--------------------------------------------------
+  // parameter: Field : layout
+  //--------------------------------------------------
+
+  const std::string layout = config_->field_layout;
+
+  ASSERT1 ("Simulation::initialize_data_descr_",
+           "Illegal Field:layout parameter value \"%s\": "
+           "must be \"packed\" or \"staggered\"",
+           layout.c_str(),
+           (layout == "packed" || layout == "staggered"));
+
+  field_descr_->set_layout
+    ((layout == "staggered") ? field_layout_staggered : field_layout_packed);
+
   field_descr_->set_history (config_->field_history);
 
   for (int i=0; i<field_descr_->field_count(); i++) {
@@ -844,6 +920,9 @@ void Simulation::deallocate_() throw()
   delete hierarchy_;     hierarchy_ = 0;
   delete field_descr_;   field_descr_ = 0;
   delete performance_;   performance_ = 0;
+  delete tuner_;         tuner_ = 0;
+  delete budget_;        budget_ = 0;
+  delete telemetry_;     telemetry_   = 0;
 }
 
 //----------------------------------------------------------------------
@@ -925,11 +1004,39 @@ void Simulation::monitor_output()
   monitor()-> print("Simulation", "cycle %04d", cycle_);
   monitor()-> print("Simulation", "time-sim %15.12e",time_);
   monitor()-> print("Simulation", "dt %15.12e", dt_);
+  for (size_t level=0; level<dt_level_.size(); level++) {
+    if (dt_level_[level] < std::numeric_limits<double>::max()) {
+      monitor()-> print("Simulation", "dt-level %d %15.12e subcycle %g",
+                        int(level), dt_level_[level],
+                        dt_ > 0.0 ? dt_level_[level]/dt_ : 0.0);
+    }
+  }
   thisProxy.p_monitor_performance();
 }
 
 //----------------------------------------------------------------------
 
+/// Counters summed over the processing elements of each node for
+/// Performance:smp
+enum smp_counter_enum {
+  smp_counter_elapsed_usec,
+  smp_counter_idle_usec,
+  smp_counter_messages,
+  smp_counter_bytes,
+  num_smp_counter
+};
+
+//----------------------------------------------------------------------
+
+void Simulation::p_exit_clear_pools ()
+{
+  // pooled FieldFace objects are not leaks
+  FieldFacePool::clear();
+  proxy_main.p_exit(CkNumPes());
+}
+
+//----------------------------------------------------------------------
+
 void Simulation::monitor_performance()
 {
   int nr  = performance_->num_regions();
@@ -943,19 +1050,39 @@ void Simulation::monitor_performance()
   // 5 data_msg
   // 6 field_face
   // 7 particle_data
-  // 8 num-particles
-  // 9+ num_solver_iters
+  // 8 field_face_pool_hit
+  // 9 field_face_pool_miss
+  // 10 msg_refresh_part
+  // 11 msg_refresh_aggregate
+  // 12 num-particles
+  // 13 idle-usec
+  // 14+ num_solver_iters (one per solver)
+  // SH+ hist_solver_iters (SOLVER_ITER_BINS per solver)
+  // MC+ method_counters
+  // LC+ level_counters
+  // MS+ message counters
+  // MG+ memory group bytes_high
   // NL+ num-blocks-<L>
-  // 10+ num_blocks_total
-  // 11+ max_proc_blocks
-  // 12+ max_proc_particles
-  // 13+ max_node_blocks
-  // 14+ max_node_particles
-  // 15+ max_solver_iters
+  // NT  num_blocks_total
+  // RC+ region counters (nc per region)
+  // MX  max_proc_blocks
+  // MX+1 max_proc_particles
+  // MX+2 max_node_blocks
+  // MX+3 max_node_particles
+  // MX+4 max_proc_idle
+  // MX+5+ max_solver_iters (one per solver)
+  // MG+ max memory group bytes_high
+  // MG+1 max block bytes_high
   
   const int num_solver = problem()->num_solvers();
+  const int num_method_counters = config_->performance_method_counters ?
+    problem()->num_methods()*Performance::method_counters_length : 0;
+  const int num_levels = hierarchy_->max_level() - hierarchy_->min_level() + 1;
+  const int num_level_counters = config_->performance_level_counters ?
+    num_levels*num_level_counter : 0;
+  const int num_msg_counters = MsgCounter::length(refresh_count());
 
-  int n = 14 + 2*num_solver + ( hierarchy_->max_level() - hierarchy_->min_level() + 1) + nr*nc;
+  int n = 20 + (2 + SOLVER_ITER_BINS)*num_solver + num_method_counters + num_level_counters + num_msg_counters + 2*num_memory_group + 1 + num_levels + nr*nc;
 
   
   long long * counters_region = new long long [nc];
@@ -964,7 +1091,7 @@ void Simulation::monitor_performance()
   const int in = cello::index_static();
   
   int m=0;
-  const int num_max = 4 + num_solver;
+  const int num_max = 5 + num_solver + num_memory_group + 1;
   counters_reduce[m++] = n - num_max - 2;
   counters_reduce[m++] = num_max;
   
@@ -976,9 +1103,61 @@ void Simulation::monitor_performance()
   counters_reduce[m++] = DataMsg::counter[in];        // 5
   counters_reduce[m++] = FieldFace::counter[in];      // 6
   counters_reduce[m++] = ParticleData::counter[in];   // 7
-  counters_reduce[m++] = hierarchy_->num_particles(); // 8
+  counters_reduce[m++] = FieldFacePool::hits[in];     // 8
+  counters_reduce[m++] = FieldFacePool::misses[in];   // 9
+  counters_reduce[m++] = RefreshAggregator::num_parts[in]; // 10
+  counters_reduce[m++] = RefreshAggregator::num_msgs[in];  // 11
+  counters_reduce[m++] = hierarchy_->num_particles(); // 12
+  const long long idle_usec = performance_->idle_take();
+  counters_reduce[m++] = idle_usec;                   // 13
+  for (int i=0; i<num_solver; i++) {
+    counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 14+
+  }
   for (int i=0; i<num_solver; i++) {
-    counters_reduce[m++] = cello::simulation()->get_solver_num_iter(i); // 9
+    for (int ib=0; ib<SOLVER_ITER_BINS; ib++) {
+      counters_reduce[m++] =                          // SH
+        cello::simulation()->get_solver_iter_hist(i,ib);
+    }
+  }
+  if (num_method_counters > 0) {
+    if (performance_->method_counters_active()) {
+      performance_->method_counters_take(counters_reduce + m);
+    } else {
+      std::fill_n (counters_reduce + m,num_method_counters,0);
+    }
+    m += num_method_counters;                         // MC
+  }
+  if (num_level_counters > 0) {
+    if (performance_->level_counters_active()) {
+      performance_->level_counters_take(counters_reduce + m);
+    } else {
+      std::fill_n (counters_reduce + m,num_level_counters,0);
+    }
+    m += num_level_counters;                          // LC
+  }
+  if (config_->performance_smp) {
+    // per-node sums, indexed by node; messages between processes
+    // pass through the node's communication thread in SMP builds
+    std::vector<long long> counters_smp (num_smp_counter*CkNumNodes(),0);
+    long long * c = counters_smp.data() + num_smp_counter*CkMyNode();
+    const double time = timer_.value();
+    c[smp_counter_elapsed_usec] = (long long)(1e6*(time - smp_time_));
+    c[smp_counter_idle_usec] = idle_usec;
+    MsgCounter::remote_totals
+      (&c[smp_counter_messages],&c[smp_counter_bytes]);
+    smp_time_ = time;
+    contribute
+      (counters_smp.size()*sizeof(long long), counters_smp.data(),
+       CkReduction::sum_long_long,
+       CkCallback (CkIndex_Simulation::r_monitor_smp_reduce(NULL),
+                   thisProxy));
+  }
+  MsgCounter::take (counters_reduce + m,refresh_count());
+  m += num_msg_counters;                              // MS
+  Memory * memory = Memory::instance();
+  for (int i=0; i<num_memory_group; i++) {
+    counters_reduce[m++] = memory ?                   // MG
+      memory->bytes_high(Memory::default_group_name(i)) : 0;
   }
 
   const int min_level = hierarchy_->min_level();
@@ -988,25 +1167,31 @@ void Simulation::monitor_performance()
     num_blocks_total +=  hierarchy_->num_blocks(i);
     counters_reduce[m++] = hierarchy_->num_blocks(i); // NL
   }
-  counters_reduce[m++] = num_blocks_total;            // 10  num_blocks_total
+  counters_reduce[m++] = num_blocks_total;            // NT  num_blocks_total
   
   // performance region counters
   for (int ir = 0; ir < nr; ir++) {
     performance_->region_counters(ir,counters_region);
     for (int ic = 0; ic < nc; ic++) {
-      counters_reduce[m++] = counters_region[ic];
+      counters_reduce[m++] = counters_region[ic];     // RC
     }
   }
 
   // maximum metrics
   
-  counters_reduce[m++] = num_blocks_total;            // 11  max_proc_blocks
-  counters_reduce[m++] = hierarchy_->num_particles(); // 12  max_proc_particles
-  counters_reduce[m++] = Hierarchy::num_blocks_node;  // 13  max_node_blocks
-  counters_reduce[m++] = Hierarchy::num_particles_node;// 14 max_node_particles
+  counters_reduce[m++] = num_blocks_total;            // MX   max_proc_blocks
+  counters_reduce[m++] = hierarchy_->num_particles(); // MX+1 max_proc_particles
+  counters_reduce[m++] = Hierarchy::num_blocks_node;  // MX+2 max_node_blocks
+  counters_reduce[m++] = Hierarchy::num_particles_node;// MX+3 max_node_particles
+  counters_reduce[m++] = idle_usec;                   // MX+4 max_proc_idle
   for (int i=0; i<num_solver; i++) {
-    counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // 15 max_node_particles
+    counters_reduce[m++] = cello::simulation()->get_solver_max_iter(i); // MX+5+ max_solver_iters
+  }
+  for (int i=0; i<num_memory_group; i++) {
+    counters_reduce[m++] = memory ?                   // MG
+      memory->bytes_high(Memory::default_group_name(i)) : 0;
   }
+  counters_reduce[m++] = memory ? memory->block_bytes_high() : 0; // MG+1
 
   ASSERT2("Simulation::monitor_performance()",
 	  "Actual array length %d != expected array length %d", m,n,
@@ -1025,6 +1210,17 @@ void Simulation::monitor_performance()
 		 thisProxy));
   // --------------------------------------------------
 
+  if (tuner_ && tuner_->is_tuning()) {
+    performance_->region_counters(perf_compute,counters_region);
+    // counter 0 is time-usec
+    const double time = tuner_->cycle(1e-6*counters_region[0]);
+    if (time >= 0.0) {
+      contribute
+        (sizeof(double), &time, CkReduction::max_double,
+         CkCallback (CkIndex_Simulation::r_tuner_trial(NULL), thisProxy));
+    }
+  }
+
   delete [] counters_reduce;
   delete [] counters_region;
 
@@ -1032,6 +1228,64 @@ void Simulation::monitor_performance()
 
 //----------------------------------------------------------------------
 
+void Simulation::r_monitor_smp_reduce(CkReductionMsg * msg)
+{
+  if (CkMyPe() == 0) {
+    const long long * counters_smp = (const long long *)msg->getData();
+    const int num_nodes = CkNumNodes();
+
+    // minimum, average, and maximum over nodes, and the node of the
+    // maximum
+    struct Stat {
+      double min, sum, max; int node_max;
+      void add (double value, int node) {
+        if (node == 0 || value < min) min = value;
+        if (node == 0 || value > max) { max = value; node_max = node; }
+        sum = (node == 0) ? value : sum + value;
+      }
+    } busy, messages, bytes;
+
+    for (int node=0; node<num_nodes; node++) {
+      const long long * c = counters_smp + num_smp_counter*node;
+      const int num_pes = CkNodeSize(node);
+      const double elapsed = c[smp_counter_elapsed_usec];
+      // wall time of the node is the average over its PEs
+      const double seconds = 1e-6*elapsed/num_pes;
+      busy.add ((elapsed > 0.0) ?
+                1.0 - c[smp_counter_idle_usec]/elapsed : 0.0, node);
+      messages.add ((seconds > 0.0) ?
+                    c[smp_counter_messages]/seconds : 0.0, node);
+      bytes.add ((seconds > 0.0) ? c[smp_counter_bytes]/seconds : 0.0, node);
+    }
+
+    monitor()->print
+      ("Performance","smp nodes %d pes %d pes-per-node %d",
+       num_nodes, CkNumPes(), CkNodeSize(0));
+    monitor()->print
+      ("Performance","smp busy-fraction min %.4f avg %.4f max %.4f "
+       "(node %d)", busy.min, busy.sum/num_nodes, busy.max, busy.node_max);
+    monitor()->print
+      ("Performance","smp msgs-per-sec min %.1f avg %.1f max %.1f "
+       "(node %d)", messages.min, messages.sum/num_nodes, messages.max,
+       messages.node_max);
+    monitor()->print
+      ("Performance","smp bytes-per-sec min %.1f avg %.1f max %.1f "
+       "(node %d)", bytes.min, bytes.sum/num_nodes, bytes.max,
+       bytes.node_max);
+  }
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
+void Simulation::r_tuner_trial(CkReductionMsg * msg)
+{
+  tuner_->trial_result (*((double *)msg->getData()));
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
 void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
 {
   if (CkMyPe() == 0) {
@@ -1048,26 +1302,184 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     const long long data_msg    = counters_reduce[m++];   // 5
     const long long field_face  = counters_reduce[m++];   // 6
     const long long particle_data = counters_reduce[m++]; // 7
-    const long long num_particles = counters_reduce[m++]; // 8
+    const long long pool_hit    = counters_reduce[m++];   // 8
+    const long long pool_miss   = counters_reduce[m++];   // 9
+    const long long refresh_part = counters_reduce[m++];  // 10
+    const long long refresh_aggregate = counters_reduce[m++]; // 11
+    const long long num_particles = counters_reduce[m++]; // 12
+    const long long idle_usec   = counters_reduce[m++];   // 13
+
+    Telemetry * telemetry = telemetry_;
+    if (telemetry) {
+      const double time = timer_.value();
+      telemetry->metric ("cycle",cycle_);
+      telemetry->metric ("time",time_);
+      telemetry->metric ("cycle_seconds",time - telemetry_time_);
+      telemetry_time_ = time;
+      telemetry->metric ("num_particles",num_particles);
+      telemetry->metric ("msg_refresh",msg_refresh);
+      telemetry->metric ("msg_refine",msg_refine);
+      telemetry->metric ("msg_coarsen",msg_coarsen);
+      telemetry->metric ("data_msg",data_msg);
+    }
 
     const int num_solver = problem()->num_solvers();
     for (int i=0; i<num_solver; i++) {
-      const long long num_solver_iter = counters_reduce[m++]; // 15
+      const long long num_solver_iter = counters_reduce[m++]; // 14+
+      if (telemetry) {
+        telemetry->metric ("solver_iter",num_solver_iter,
+                           "solver",problem()->solver(i)->name());
+      }
       monitor()->print ("Performance","solver num-%s-iter %lld",
                         problem()->solver(i)->name().c_str(),
                         num_solver_iter);
     }
 
+    // histogram of iterations per solve, skipping empty bins
+    for (int i=0; i<num_solver; i++) {
+      std::string hist;
+      for (int ib=0; ib<SOLVER_ITER_BINS; ib++, m++) {
+        if (counters_reduce[m] == 0) continue;
+        char bin[80];
+        if (ib == 0) {
+          snprintf (bin,80," 0:%lld",counters_reduce[m]);
+        } else if (ib == SOLVER_ITER_BINS-1) {
+          snprintf (bin,80," %d+:%lld",1 << (ib-1),counters_reduce[m]);
+        } else {
+          snprintf (bin,80," %d-%d:%lld",1 << (ib-1),(1 << ib)-1,
+                    counters_reduce[m]);
+        }
+        hist += bin;
+      }
+      if (! hist.empty()) {
+        monitor()->print ("Performance","solver hist-%s-iter%s",
+                          problem()->solver(i)->name().c_str(),
+                          hist.c_str());
+      }
+    }
+
+    // hardware counters of each Method, with rates per process
+
+    if (config_->performance_method_counters) {
+      for (int i=0; i<problem()->num_methods(); i++) {
+        const long long * c = counters_reduce + m;
+        m += Performance::method_counters_length;
+        const long long time_nsec = c[0];
+        if (time_nsec == 0) continue;
+        const long long * e = c + 1;
+        const std::string name = problem()->method(i)->name();
+        monitor()->print
+          ("Performance","method %s time-usec %lld cycles %lld "
+           "instructions %lld llc-misses %lld fp-ops %lld",
+           name.c_str(), time_nsec/1000, e[hw_event_cycles],
+           e[hw_event_instructions], e[hw_event_llc_misses],
+           e[hw_event_fp_ops]);
+        // memory traffic estimated as one cache line per LLC miss
+        const double bytes =
+          double(HwCounters::cache_line_bytes)*e[hw_event_llc_misses];
+        const double ipc = (e[hw_event_cycles] > 0) ?
+          double(e[hw_event_instructions])/e[hw_event_cycles] : 0.0;
+        const double intensity = (bytes > 0.0) ?
+          e[hw_event_fp_ops] / bytes : 0.0;
+        monitor()->print
+          ("Performance","method %s ipc %.3f gflops %.3f "
+           "gbytes-per-sec %.3f intensity %.3f",
+           name.c_str(), ipc, double(e[hw_event_fp_ops])/time_nsec,
+           bytes/time_nsec, intensity);
+      }
+    }
+
+    // per-level costs, written with the Blocks per level below
+
+    const long long * level_counters = counters_reduce + m;
+    if (config_->performance_level_counters) {
+      m += (hierarchy_->max_level() - hierarchy_->min_level() + 1)
+        * num_level_counter;
+    }
+
+    // messages and bytes by message class, refresh kind, and Refresh id
+
+    for (int i=0; i<num_msg_class; i++, m+=num_msg_counter) {
+      const long long * c = counters_reduce + m;
+      if (c[msg_counter_sent] == 0 && c[msg_counter_recv] == 0) continue;
+      const char * name = MsgCounter::class_name(i);
+      monitor()->print
+        ("Performance","counter msg %s sent %lld sent-bytes %lld "
+         "recv %lld recv-bytes %lld", name,
+         c[msg_counter_sent], c[msg_counter_sent_bytes],
+         c[msg_counter_recv], c[msg_counter_recv_bytes]);
+      if (telemetry) {
+        for (int ic=0; ic<num_msg_counter; ic++) {
+          std::string counter = MsgCounter::counter_name(ic);
+          std::replace (counter.begin(),counter.end(),'-','_');
+          telemetry->metric ("msg_" + counter,c[ic],"class",name);
+        }
+      }
+    }
+    for (int i=0; i<num_refresh_counter; i++, m+=2) {
+      const long long * c = counters_reduce + m;
+      if (c[0] == 0) continue;
+      const char * name = MsgCounter::refresh_name(i);
+      monitor()->print
+        ("Performance","counter refresh-%s sent %lld sent-bytes %lld",
+         name, c[0], c[1]);
+      if (telemetry) {
+        telemetry->metric ("refresh_sent",c[0],"kind",name);
+        telemetry->metric ("refresh_sent_bytes",c[1],"kind",name);
+      }
+    }
+    for (int i=0; i<refresh_count(); i++, m+=num_msg_counter) {
+      const long long * c = counters_reduce + m;
+      if (c[msg_counter_sent] == 0 && c[msg_counter_recv] == 0) continue;
+      monitor()->print
+        ("Performance","counter refresh-id %d sent %lld sent-bytes %lld "
+         "recv %lld recv-bytes %lld", i,
+         c[msg_counter_sent], c[msg_counter_sent_bytes],
+         c[msg_counter_recv], c[msg_counter_recv_bytes]);
+    }
+    for (int i=0; i<num_msg_class; i++, m+=2) {
+      const long long * c = counters_reduce + m;
+      if (c[0] == 0) continue;
+      const char * name = MsgCounter::class_name(i);
+      monitor()->print
+        ("Performance","counter msg-delay %s local %lld delay-usec %lld "
+         "average-usec %.1f", name, c[0], c[1], double(c[1])/c[0]);
+      if (telemetry) {
+        telemetry->metric ("msg_local_delayed",c[0],"class",name);
+        telemetry->metric ("msg_local_delay_usec",c[1],"class",name);
+      }
+    }
+
+    long long memory_bytes_high[num_memory_group];
+    for (int i=0; i<num_memory_group; i++) {
+      memory_bytes_high[i] = counters_reduce[m++];
+    }
+
     monitor()->print("Performance","counter num-msg-coarsen %lld", msg_coarsen);
     monitor()->print("Performance","counter num-msg-refine %lld", msg_refine);
     monitor()->print("Performance","counter num-msg-refresh %lld", msg_refresh);
     monitor()->print("Performance","counter num-data-msg %lld", data_msg);
     monitor()->print("Performance","counter num-field-face %lld", field_face);
     monitor()->print("Performance","counter num-particle-data %lld", particle_data);
+    monitor()->print("Performance","counter num-field-face-pool-hit %lld", pool_hit);
+    monitor()->print("Performance","counter num-field-face-pool-miss %lld", pool_miss);
+    monitor()->print("Performance","counter num-msg-refresh-aggregate-parts %lld", refresh_part);
+    monitor()->print("Performance","counter num-msg-refresh-aggregate-sent %lld", refresh_aggregate);
 
     monitor()->print("Performance","simulation num-particles total %lld",
                      num_particles);
 
+    FILE * fp_level = nullptr;
+    if (config_->performance_level_counters &&
+        config_->performance_level_file != "") {
+      fp_level = fopen (config_->performance_level_file.c_str(),"a");
+      if (fp_level == nullptr) {
+        WARNING1 ("Simulation::r_monitor_performance_reduce()",
+                  "Cannot open Performance:level_file %s",
+                  config_->performance_level_file.c_str());
+      }
+    }
+
     // compute total blocks and leaf blocks
     long long num_total_blocks = 0;
     long long num_leaf_blocks = 0;
@@ -1076,6 +1488,38 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
       monitor()->print("performance","simulation num-blocks-level %d %lld",
                        i,num_blocks_level);
 
+      if (config_->performance_level_counters) {
+        const long long * c = level_counters
+          + (i - hierarchy_->min_level())*num_level_counter;
+        const long long compute_usec = c[level_counter_compute_nsec]/1000;
+        monitor()->print
+          ("Performance","level %d compute-usec %lld refresh-msgs %lld "
+           "refresh-bytes %lld num-blocks %lld num-particles %lld",
+           i, compute_usec, c[level_counter_refresh_msgs],
+           c[level_counter_refresh_bytes], num_blocks_level,
+           c[level_counter_particles]);
+        if (fp_level) {
+          fprintf (fp_level,"%d %d %lld %lld %lld %lld %lld\n",
+                   cycle_, i, compute_usec, c[level_counter_refresh_msgs],
+                   c[level_counter_refresh_bytes], num_blocks_level,
+                   c[level_counter_particles]);
+        }
+        if (telemetry) {
+          const std::string level = std::to_string(i);
+          telemetry->metric ("level_compute_usec",compute_usec,"level",level);
+          telemetry->metric ("level_refresh_msgs",
+                             c[level_counter_refresh_msgs],"level",level);
+          telemetry->metric ("level_refresh_bytes",
+                             c[level_counter_refresh_bytes],"level",level);
+          telemetry->metric ("level_num_particles",
+                             c[level_counter_particles],"level",level);
+        }
+      }
+      if (telemetry) {
+        telemetry->metric ("num_blocks",num_blocks_level,
+                           "level",std::to_string(i));
+      }
+
       num_total_blocks += num_blocks_level;
       // compute leaf blocks given number of blocks per level
       // (NOTE: num_blocks_level (i>0) is evenly divisible by num_children
@@ -1087,12 +1531,19 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
       }
     }
 
+    if (fp_level) fclose (fp_level);
+
     monitor()->print
       ("Performance","simulation num-leaf-blocks %lld",  num_leaf_blocks);
     monitor()->print
       ("Performance","simulation num-total-blocks %lld", num_total_blocks);
 
-    const long long num_blocks_total   = counters_reduce[m++]; // 10
+    const long long num_blocks_total   = counters_reduce[m++]; // NT
+
+    if (telemetry) {
+      telemetry->metric ("num_leaf_blocks",num_leaf_blocks);
+      telemetry->metric ("num_total_blocks",num_total_blocks);
+    }
 
     if (num_total_blocks != num_blocks_total) {
       WARNING2 ("Simulation::r_monitor_performance_reduce()",
@@ -1103,7 +1554,9 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
     const int num_regions  = performance_->num_regions();
     const int num_counters =  performance_->num_counters();
 
+    std::vector<long long> region_usec (num_regions);
     for (int ir = 0; ir < num_regions; ir++) {
+      region_usec[ir] = counters_reduce[m + perf_index_time];
       for (int ic = 0; ic < num_counters; ic++, m++) {
         bool do_print =
           (ir != perf_unknown) && (
@@ -1115,22 +1568,86 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
                            performance_->counter_name(ic).c_str(),
                            counters_reduce[m]);
         }
+        // cumulative time of each phase, summed over processes
+        if (telemetry && ir != perf_unknown &&
+            performance_->counter_name(ic) == "time-usec") {
+          telemetry->metric ("region_usec",counters_reduce[m],
+                             "region",performance_->region_name(ir));
+        }
       }
     }
 
-    const long long max_proc_blocks    = counters_reduce[m++]; // 11
-    const long long max_proc_particles = counters_reduce[m++]; // 12
-    const long long max_node_blocks    = counters_reduce[m++]; // 13
-    const long long max_node_particles = counters_reduce[m++]; // 14
+    const long long max_proc_blocks    = counters_reduce[m++]; // MX
+    const long long max_proc_particles = counters_reduce[m++]; // MX+1
+    const long long max_node_blocks    = counters_reduce[m++]; // MX+2
+    const long long max_node_particles = counters_reduce[m++]; // MX+3
+    const long long max_idle_usec      = counters_reduce[m++]; // MX+4
+
+    if (config_->performance_critical_path || config_->performance_smp) {
+      monitor()->print
+        ("Performance","simulation idle-usec total %lld avg %.0f max %lld",
+         idle_usec, 1.0*idle_usec/CkNumPes(), max_idle_usec);
+    }
+
+    if (budget_) {
+      // region times summed over processes, as seconds per process
+      auto seconds = [&] (std::initializer_list<int> regions) {
+        long long usec = 0;
+        for (int ir : regions) usec += region_usec[ir];
+        return 1e-6*usec/CkNumPes();
+      };
+      double totals[num_budget_part] = {0.0};
+      totals[budget_compute] = seconds({perf_compute});
+      totals[budget_refresh] = seconds
+        ({perf_refresh_store, perf_refresh_child, perf_refresh_exit,
+          perf_refresh_store_sync, perf_refresh_child_sync,
+          perf_refresh_exit_sync});
+      totals[budget_adapt] = seconds
+        ({perf_adapt_apply, perf_adapt_apply_sync, perf_adapt_notify,
+          perf_adapt_notify_sync, perf_adapt_update, perf_adapt_update_sync,
+          perf_adapt_end, perf_adapt_end_sync});
+      totals[budget_output] = seconds({perf_output});
+      totals[budget_reductions] = seconds({perf_stopping});
+      if (budget_->cycle (timer_.value(), totals,
+                          1e-6*idle_usec/CkNumPes())) {
+        budget_->write();
+      }
+    }
 
     for (int i=0; i<num_solver; i++) {
-      const long long max_solver_iters       = counters_reduce[m++]; // 15
+      const long long max_solver_iters       = counters_reduce[m++]; // MX+5+
       monitor()->print ("Performance","solver max-%s-iter %lld",
                         problem()->solver(i)->name().c_str(),
                         max_solver_iters);
     }
     cello::simulation()->clear_solver_iter(); // clear it for the next solve
 
+    // memory high-water marks since the previous report; group 0
+    // is the total over all groups
+
+    Memory * memory = Memory::instance();
+    const bool memory_active = memory && memory->is_active();
+    for (int i=0; i<num_memory_group; i++) {
+      const long long max_bytes_high = counters_reduce[m++];
+      if (memory_active) {
+        monitor()->print
+          ("Performance","memory %s bytes-high total %lld avg %.0f max %lld",
+           i ? Memory::default_group_name(i) : "total", memory_bytes_high[i],
+           1.0*memory_bytes_high[i]/CkNumPes(), max_bytes_high);
+        if (telemetry) {
+          telemetry->metric
+            ("memory_bytes_high",memory_bytes_high[i],
+             "group",i ? Memory::default_group_name(i) : "total");
+        }
+      }
+    }
+    const long long max_block_bytes_high = counters_reduce[m++];
+    if (memory_active) {
+      monitor()->print
+        ("Performance","memory block bytes-high max %lld",
+         max_block_bytes_high);
+    }
+
     monitor()->print
       ("Performance","simulation max-proc-blocks %lld",  max_proc_blocks);
     monitor()->print
@@ -1177,6 +1694,8 @@ void Simulation::r_monitor_performance_reduce(CkReductionMsg * msg)
             "Actual array length %d != expected array length 2 + %d + %d",
             m,num_sum,num_max,
             (m == 2+num_sum+num_max) );
+
+    if (telemetry) telemetry->send();
   }
 #ifdef TRACE_PROCESS_MEMORY
   Memory * memory = Memory::instance();
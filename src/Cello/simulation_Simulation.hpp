@@ -24,6 +24,11 @@ class Schedule;
 #include <fstream>
 #include "mesh.decl.h"
 #include "simulation.decl.h"
+
+/// Number of bins in solver iteration histograms: bin 0 counts solves
+/// taking 0 iterations, bin k > 0 those taking [2^(k-1),2^k), and the
+/// last bin all larger counts
+#define SOLVER_ITER_BINS 12
 class Simulation : public CBase_Simulation 
 {
   /// @class    Simulation
@@ -122,6 +127,14 @@ public: // interface
   Performance * performance() throw()
   { return performance_; }
 
+  /// Return the Tuner of tuning parameters
+  Tuner * tuner() throw()
+  { return tuner_; }
+
+  /// Return the per-cycle latency Budget, or NULL if inactive
+  Budget * budget() throw()
+  { return budget_; }
+
   /// Return the monitor object
   Monitor * monitor() const throw()
   { return monitor_; }
@@ -134,6 +147,8 @@ public: // interface
   { time_ = time; }
   void set_dt(double dt) throw()
   { dt_ = dt; }
+  void set_dt_level(const std::vector<double> & dt_level) throw()
+  { dt_level_ = dt_level; }
   void set_stop(bool stop) throw()
   { stop_ = stop; }
 
@@ -163,6 +178,12 @@ public: // interface
   double dt() const throw() 
   { return dt_; };
 
+  /// Return the minimum stable dt of leaf Blocks in the given level,
+  /// or 0 if not computed (Stopping:dt_level)
+  double dt_level(int level) const throw()
+  { return (0 <= level && level < int(dt_level_.size())) ?
+      dt_level_[level] : 0.0; }
+
   /// Return the current stopping criteria (stored from main reduction)
   bool stop() const throw() 
   { return stop_; };
@@ -290,6 +311,28 @@ public: // virtual functions
 
   void compute ();
 
+  //--------------------------------------------------
+  // Refresh
+  //--------------------------------------------------
+
+  /// Receive an aggregated refresh message and deliver its parts to
+  /// Blocks (see RefreshAggregator)
+  void p_refresh_recv_aggregate (int n, char * buffer)
+  { RefreshAggregator::deliver(n,buffer); }
+
+  /// Send any buffered refresh messages on this process
+  void p_refresh_flush ()
+  { RefreshAggregator::flush(); }
+
+  /// Release the staging buffer of a completed zero-copy send (see
+  /// NocopyPool)
+  void p_nocopy_release (CkDataMsg * msg)
+  { NocopyPool::release(msg); }
+
+  /// Delete the FieldFace objects pooled on this process, then count
+  /// this process toward exiting (see Block::exit_())
+  void p_exit_clear_pools ();
+
   //--------------------------------------------------
   // Restart
   //--------------------------------------------------
@@ -311,6 +354,15 @@ public: // virtual functions
   /// Reduction for performance data
   void r_monitor_performance_reduce (CkReductionMsg * msg);
 
+  /// Reduction for per-node busy time and message rates
+  void r_monitor_smp_reduce (CkReductionMsg * msg);
+
+  /// Reduction for the time of a Tuner trial
+  void r_tuner_trial (CkReductionMsg * msg);
+
+  /// Reduction for MethodHistogram bins
+  void r_method_histogram (CkReductionMsg * msg);
+
   float timer() { return timer_.value(); }
   
   //--------------------------------------------------
@@ -345,6 +397,21 @@ public: // virtual functions
       max_solver_iter_.resize(is+1);
     }
     max_solver_iter_[is] = std::max(max_solver_iter_[is],iter);
+    if (hist_solver_iter_.size() < size_t(SOLVER_ITER_BINS*(is+1))) {
+      hist_solver_iter_.resize(SOLVER_ITER_BINS*(is+1));
+    }
+    int bin = 0;
+    while (bin < SOLVER_ITER_BINS-1 && (iter >> bin) > 0) ++bin;
+    ++hist_solver_iter_[SOLVER_ITER_BINS*is + bin];
+  }
+
+  /// Return the number of solves of solver is in iteration bin ib
+  int get_solver_iter_hist(int is, int ib)
+  {
+    if (hist_solver_iter_.size() < size_t(SOLVER_ITER_BINS*(is+1))) {
+      hist_solver_iter_.resize(SOLVER_ITER_BINS*(is+1));
+    }
+    return hist_solver_iter_[SOLVER_ITER_BINS*is + ib];
   }
 
   int get_solver_num_iter(int is)
@@ -368,6 +435,8 @@ public: // virtual functions
       num_solver_iter_[i]=0;
     for (size_t i=0; i<max_solver_iter_.size(); i++)
       max_solver_iter_[i]=0;
+    for (size_t i=0; i<hist_solver_iter_.size(); i++)
+      hist_solver_iter_[i]=0;
   }
   
   //--------------------------------------------------
@@ -513,6 +582,9 @@ protected: // attributes
   /// Current timestep
   double dt_;
 
+  /// Minimum stable timestep of leaf Blocks in each level
+  std::vector<double> dt_level_;
+
   /// Current stopping criteria
   bool stop_;
 
@@ -535,6 +607,12 @@ protected: // attributes
   /// Simulation Performance object
   Performance * performance_;
 
+  /// Tuner choosing tuning parameters (not pupped)
+  Tuner * tuner_;
+
+  /// Per-cycle latency budget, recorded on the root process (not pupped)
+  Budget * budget_;
+
   /// Schedule for projections on / off
 
 #ifdef CONFIG_USE_PROJECTIONS
@@ -549,6 +627,15 @@ protected: // attributes
   /// Monitor object
   Monitor * monitor_;
 
+  /// Per-cycle metrics sink (root process only, or NULL)
+  Telemetry * telemetry_;
+
+  /// Simulation timer value at the previous telemetry send
+  double telemetry_time_;
+
+  /// Simulation timer value at the previous Performance:smp report
+  double smp_time_;
+
   /// AMR hierarchy
   Hierarchy * hierarchy_;
 
@@ -595,10 +682,15 @@ protected: // attributes
   std::vector<int> num_solver_iter_;
   /// Max of solver iterations over blocks for solver i
   std::vector<int> max_solver_iter_;
+  /// Histogram of solver iterations for solver i, SOLVER_ITER_BINS
+  /// bins per solver
+  std::vector<int> hist_solver_iter_;
 
   static int file_counter_;
   std::string restart_directory_;
   int         restart_num_files_;
+  /// Number of IoEnzoReader objects, at least restart_num_files_
+  int         restart_num_readers_;
   std::ifstream restart_stream_file_list_;
 };
 
@@ -1233,6 +1233,67 @@ public:
 
 //----------------------------------------------------------------------
 
+class CelloViewRefTests{
+  // these are tests that check that CelloViewRef refers to the same elements
+  // as the CelloView (or subarray) from which it is constructed
+
+private:
+  template<template<typename, std::size_t> class Builder>
+  void test_ref_(){
+    Builder<double, 3> builder(2,3,4);
+    CelloView<double, 3> *arr_ptr = builder.get_arr();
+
+    double val = 0;
+    for (int iz = 0; iz<2; iz++){
+      for (int iy = 0; iy<3; iy++){
+        for (int ix = 0; ix<4; ix++){
+          (*arr_ptr)(iz,iy,ix) = val;
+          val++;
+        }
+      }
+    }
+
+    CelloView<double, 3> sub = arr_ptr->subarray(CSlice(1,2),CSlice(1,3),
+                                                 CSlice(1,4));
+    CelloViewRef<double, 3> ref(sub);
+    CelloViewRef<const double, 3> const_ref(sub);
+
+    unit_assert(ref.shape(0) == 1 && ref.shape(1) == 2 && ref.shape(2) == 3);
+    unit_assert(ref.stride(0) == 12 && ref.stride(1) == 4 &&
+                ref.stride(2) == 1);
+    unit_assert(ref.size() == sub.size());
+    unit_assert(ref.data() == sub.data());
+    unit_assert(const_ref.data() == sub.data());
+
+    bool match = true;
+    for (int iy = 0; iy<2; iy++){
+      const double * row = const_ref.row(0,iy);
+      for (int ix = 0; ix<3; ix++){
+        match &= (sub(0,iy,ix) == ref(0,iy,ix));
+        match &= (sub(0,iy,ix) == row[ix]);
+      }
+    }
+    unit_assert(match);
+
+    // writes through the CelloViewRef are visible through the CelloView
+    ref(0,1,2) = -5.;
+    unit_assert((*arr_ptr)(1,2,3) == -5.);
+
+    CelloViewRef<const double, 3> cast_ref = ref;
+    unit_assert(cast_ref(0,1,2) == -5.);
+
+    unit_assert(CelloViewRef<double, 3>().is_null());
+  }
+
+public:
+  void run_tests(){
+    test_ref_<MemManagedArrayBuilder>();
+    test_ref_<PtrWrapArrayBuilder>();
+  }
+};
+
+//----------------------------------------------------------------------
+
 PARALLEL_MAIN_BEGIN
 {
   PARALLEL_INIT;
@@ -1268,6 +1329,12 @@ PARALLEL_MAIN_BEGIN
   SubarrayTests subarray_tests;
   subarray_tests.run_tests();
 
+  unit_class("CelloViewRef");
+  unit_func("CelloViewRef");
+
+  CelloViewRefTests ref_tests;
+  ref_tests.run_tests();
+
   unit_finalize();
 
   exit_();
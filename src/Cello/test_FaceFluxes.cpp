@@ -219,6 +219,9 @@ PARALLEL_MAIN_BEGIN
 
           if (L_1 > L_2) {
 
+            FaceFluxes face_fluxes_c;
+            face_fluxes_c.set_coarsened(*face_fluxes_1,cx,cy,cz,rank);
+
             face_fluxes_1->coarsen(cx,cy,cz,rank);
 
             face_fluxes_1->get_size (&mx,&my,&mz);
@@ -237,6 +240,17 @@ PARALLEL_MAIN_BEGIN
 
             unit_assert (sum_1 == sum_1_coarse*rvol[rank]);
 
+            unit_func("set_coarsened()");
+            {
+              const int m = face_fluxes_c.get_size();
+              auto fluxes_c = face_fluxes_c.flux_array();
+              bool match = (m == face_fluxes_1->get_size());
+              for (int i=0; match && i<m; i++) {
+                match = (fluxes_c[i] == fluxes_coarse_1[i]);
+              }
+              unit_assert (match);
+            }
+
           } else if (L_2 > L_1) {
 
             face_fluxes_2->get_size(&mx,&my,&mz);
@@ -0,0 +1,90 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_FftBench.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    Micro-benchmark for FftLevel::fft()
+///
+/// Times forward and inverse 3D transforms of an n^3 pencil-ordered
+/// array, one axis at a time as FftLevel pencils do, for several n,
+/// and reports cells per second as JSON lines.  Timings of whole
+/// distributed transforms, which depend on the number of PEs, are
+/// printed by FftLevel itself.  This is a benchmark, not a unit test:
+/// the only assertion is that a forward and inverse transform
+/// reproduce the input.
+
+#include "main.hpp"
+#include "test.hpp"
+#include "compute.hpp"
+
+//----------------------------------------------------------------------
+
+/// Number of cells processed per timing
+const long long num_cells = 1 << 23;
+
+//----------------------------------------------------------------------
+
+void fft_3d (std::vector< std::complex<double> > & a, int n, bool inverse)
+{
+  for (int iz=0; iz<n; iz++)
+    for (int iy=0; iy<n; iy++)
+      FftLevel::fft (&a[n*(iy + n*iz)], n, 1, inverse);
+  for (int iz=0; iz<n; iz++)
+    for (int ix=0; ix<n; ix++)
+      FftLevel::fft (&a[ix + n*n*iz], n, n, inverse);
+  for (int iy=0; iy<n; iy++)
+    for (int ix=0; ix<n; ix++)
+      FftLevel::fft (&a[ix + n*iy], n, n*n, inverse);
+}
+
+//----------------------------------------------------------------------
+
+void bench (int n)
+{
+  const int m = n*n*n;
+  const int num_repeat = std::max(1LL, num_cells / m);
+
+  std::vector< std::complex<double> > input (m);
+  for (int i=0; i<m; i++) input[i] = sin(0.1*i) + cos(0.37*i);
+  std::vector< std::complex<double> > values (input);
+
+  Timer timer;
+  timer.start();
+  for (int i=0; i<num_repeat; i++) {
+    fft_3d (values,n,false);
+    fft_3d (values,n,true);
+    for (int j=0; j<m; j++) values[j] /= double(m);
+  }
+  const double time = timer.stop();
+
+  char name[80];
+  snprintf (name,sizeof(name),"fft/3d/%d",n);
+  unit_bench (name, (time > 0.0) ? 1.0*num_repeat*m/time : 0.0, "cells/s");
+
+  // check: forward and normalized inverse transforms are the identity
+
+  double error = 0.0;
+  for (int i=0; i<m; i++) error = std::max(error,std::abs(values[i]-input[i]));
+  unit_func("fft()");
+  unit_assert (error < 1e-8*m);
+}
+
+//======================================================================
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("FftLevel");
+
+  for (int n : {16, 24, 32, 64}) bench(n);
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
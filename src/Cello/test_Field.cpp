@@ -334,6 +334,32 @@ PARALLEL_MAIN_BEGIN
     unit_assert (nb3 == sizeof (double)* nu3);
     unit_assert (nb4 == sizeof (double)* nu4);
 
+    // staggered layout spreads field starts over FIELD_STAGGER_BYTES
+
+    unit_func("set_layout");
+
+    field.set_layout(field_layout_staggered);
+    unit_assert(field.layout() == field_layout_staggered);
+    field.reallocate_permanent(false);
+    {
+      char * w[5] = { field.values(i1), field.values(i2), field.values(i3),
+                      field.values(i4), field.values(i5) };
+      const size_t nu[4] = { sizeof(float)*nu1, sizeof(double)*nu2,
+                             sizeof(double)*nu3, sizeof(double)*nu4 };
+      for (int i=0; i<4; i++) {
+        const size_t nb = w[i+1] - w[i];
+        const size_t stagger = ((w[i+1] - w[0]) % FIELD_STAGGER_BYTES);
+        unit_assert (nb >= nu[i]);
+        unit_assert (nb < nu[i] + FIELD_STAGGER_BYTES);
+        unit_assert (stagger ==
+                     (FIELD_STAGGER_BYTES*(i+1)/field.field_count())
+                     / field.alignment() * field.alignment());
+      }
+    }
+    field.set_layout(field_layout_packed);
+    field.reallocate_permanent(false);
+    unit_assert (field.values(i2) - field.values(i1) == nb1);
+
     //----------------------------------------------------------------------
 
     unit_func("unknowns");  // without ghosts
@@ -783,6 +809,41 @@ PARALLEL_MAIN_BEGIN
       test_view_<long double>(field, j3, "", false, 0);
     }
 
+    // ---------------------------------------------------------------------
+    unit_func("is_type");
+
+    unit_assert (field.is_type<float>(i1));
+    unit_assert (! field.is_type<double>(i1));
+    unit_assert (field.is_type<double>(i2));
+    unit_assert (! field.is_type<float>(i2));
+
+    // ---------------------------------------------------------------------
+    unit_func("copy_to_array");
+
+    field.reallocate_permanent(true);
+    {
+      int mx,my,mz;
+      field.dimensions(i1,&mx,&my,&mz);
+      const int n = mx*my*mz;
+
+      float * f1 = (float *) field.values(i1);
+      for (int i=0; i<n; i++) f1[i] = 0.25f*(i - 7);
+
+      std::vector<double> array(n);
+      field.copy_to_array(i1, array.data());
+      bool passed = true;
+      for (int i=0; i<n; i++) passed &= (array[i] == 0.25*(i - 7));
+      unit_assert (passed);
+
+      unit_func("copy_from_array");
+
+      for (int i=0; i<n; i++) array[i] = -0.5*i;
+      field.copy_from_array(i1, (const double *)array.data());
+      passed = true;
+      for (int i=0; i<n; i++) passed &= (f1[i] == -0.5f*i);
+      unit_assert (passed);
+    }
+
     //--------------------------------------------------
 
     // History
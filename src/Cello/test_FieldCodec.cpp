@@ -0,0 +1,124 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_FieldCodec.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Test program for the FieldCodec class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  //----------------------------------------------------------------------
+  unit_init(0,1);
+  //----------------------------------------------------------------------
+
+  unit_class("FieldCodec");
+
+  // packed array of a smooth double field, a single-precision field
+  // that is mostly zero, and unused padding
+
+  const int nd = 1000;
+  const int nf = 500;
+  const int n_pad = 24;
+  const int n = nd*sizeof(double) + nf*sizeof(float) + n_pad;
+
+  std::vector<char> array(n,1);
+  double * ad = (double *) array.data();
+  float  * af = (float *) (array.data() + nd*sizeof(double));
+  for (int i=0; i<nd; i++) ad[i] = 1.0 + 0.001*i;
+  for (int i=0; i<nf; i++) af[i] = (i < nf/2) ? 0.0 : sin(0.01*i);
+
+  std::vector<FieldCodec::Segment> segments =
+    { {int(nd*sizeof(double)), int(sizeof(double)), 0.0},
+      {int(nf*sizeof(float)),  int(sizeof(float)),  0.0} };
+
+  unit_func("encode");
+
+  std::vector<char> code;
+  FieldCodec::encode (array.data(),n,segments,code);
+  unit_assert (code.size() < size_t(n));
+
+  unit_func("decoded_size");
+  unit_assert (FieldCodec::decoded_size(code.data()) == n);
+
+  unit_func("decode");
+
+  std::vector<char> decoded(n,1);
+  FieldCodec::decode (code.data(),code.size(),decoded.data());
+  unit_assert (memcmp(decoded.data(),array.data(),n - n_pad) == 0);
+  bool padding_zero = true;
+  for (int i=n-n_pad; i<n; i++) padding_zero &= (decoded[i] == 0);
+  unit_assert (padding_zero);
+
+  unit_func("encode (lossy)");
+
+  const double tolerance = 1e-4;
+  segments[1].tolerance = tolerance;
+  std::vector<char> code_lossy;
+  FieldCodec::encode (array.data(),n,segments,code_lossy);
+  unit_assert (code_lossy.size() < code.size());
+
+  unit_func("decode (lossy)");
+
+  FieldCodec::decode (code_lossy.data(),code_lossy.size(),decoded.data());
+  unit_assert (memcmp(decoded.data(),array.data(),nd*sizeof(double)) == 0);
+  const float * df = (float *) (decoded.data() + nd*sizeof(double));
+  double error = 0.0;
+  for (int i=0; i<nf; i++) error = std::max(error,fabs(double(df[i]-af[i])));
+  unit_assert (error <= tolerance*(1.0 + 1e-3));
+
+  unit_func("encode (lossy non-finite)");
+
+  // segments that cannot be quantized are encoded losslessly
+  af[nf-1] = std::numeric_limits<float>::infinity();
+  FieldCodec::encode (array.data(),n,segments,code_lossy);
+  FieldCodec::decode (code_lossy.data(),code_lossy.size(),decoded.data());
+  unit_assert (memcmp(decoded.data(),array.data(),n - n_pad) == 0);
+
+  unit_func("encode (sparse)");
+
+  // the mostly-zero segment shrinks; the dense one is copied whole
+  af[nf-1] = 0.5;
+  segments[1].tolerance = 0.0;
+  segments[0].sparse = true;
+  segments[1].sparse = true;
+  std::vector<char> code_sparse;
+  FieldCodec::encode (array.data(),n,segments,code_sparse);
+  unit_assert (code_sparse.size() < size_t(n - nf*sizeof(float)/4));
+
+  unit_func("decode (sparse)");
+
+  FieldCodec::decode (code_sparse.data(),code_sparse.size(),decoded.data());
+  unit_assert (memcmp(decoded.data(),array.data(),n - n_pad) == 0);
+
+  unit_func("encode (constant)");
+
+  // a uniform segment is stored as one element; the other is copied
+  for (int i=0; i<nd; i++) ad[i] = 0.125;
+  segments[0].sparse = false;
+  segments[1].sparse = false;
+  segments[0].raw = true;
+  segments[1].raw = true;
+  std::vector<char> code_constant;
+  FieldCodec::encode (array.data(),n,segments,code_constant);
+  unit_assert (code_constant.size() < nf*sizeof(float) + 64);
+
+  unit_func("decode (constant)");
+
+  FieldCodec::decode
+    (code_constant.data(),code_constant.size(),decoded.data());
+  unit_assert (memcmp(decoded.data(),array.data(),n - n_pad) == 0);
+
+  //----------------------------------------------------------------------
+  unit_finalize();
+  //----------------------------------------------------------------------
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -540,6 +540,70 @@ PARALLEL_MAIN_BEGIN
   unit_assert(4.0 == v4[n4[0]*n4[1]*n4[2]-1]);
   unit_assert(2.0 == v5[0] );
 
+  //----------------------------------------------------------------------
+  unit_func("is_modified");
+
+  // fields are modified until sent by a sparse refresh
+
+  unit_assert(field_data->is_modified(0,i1));
+  unit_assert(field_data->is_modified(1,i1));
+
+  field_data->set_refreshed(0,i1);
+  field_data->set_refreshed(0,i2);
+  field_data->set_refreshed(1,i1);
+
+  unit_assert(! field_data->is_modified(0,i1));
+  unit_assert(! field_data->is_modified(0,i2));
+  unit_assert(field_data->is_modified(0,i3));
+  unit_assert(! field_data->is_modified(1,i1));
+  unit_assert(field_data->is_modified(1,i2));
+
+  unit_func("set_modified");
+
+  field_data->set_modified(i1);
+
+  unit_assert(field_data->is_modified(0,i1));
+  unit_assert(field_data->is_modified(1,i1));
+  unit_assert(! field_data->is_modified(0,i2));
+
+  unit_func("set_all_modified");
+
+  field_data->set_all_modified();
+
+  unit_assert(field_data->is_modified(0,i2));
+
+  //----------------------------------------------------------------------
+  unit_func("is_derived_current");
+
+  // field i3 derived from fields i1 and i2
+
+  std::vector<int> input_list = {i1,i2};
+
+  unit_assert(! field_data->is_derived_current(i3,input_list,1.0));
+
+  field_data->set_derived(i3,input_list,1.0);
+
+  unit_assert(field_data->is_derived_current(i3,input_list,1.0));
+  unit_assert(! field_data->is_derived_current(i3,input_list,2.0));
+
+  field_data->set_modified(i4);
+  unit_assert(field_data->is_derived_current(i3,input_list,1.0));
+
+  field_data->set_modified(i2);
+  unit_assert(! field_data->is_derived_current(i3,input_list,1.0));
+
+  field_data->set_derived(i3,input_list,1.0);
+  field_data->set_modified(i3);
+  unit_assert(! field_data->is_derived_current(i3,input_list,1.0));
+
+  // ghost updates invalidate derived fields but not sparse refreshes
+
+  field_data->set_derived(i3,input_list,1.0);
+  field_data->set_refreshed(0,i2);
+  field_data->set_ghosts_modified();
+  unit_assert(! field_data->is_derived_current(i3,input_list,1.0));
+  unit_assert(! field_data->is_modified(0,i2));
+
   //----------------------------------------------------------------------
   unit_func("reallocate_ghosts");
 
@@ -558,6 +622,42 @@ PARALLEL_MAIN_BEGIN
   unit_assert(4.0 == v4[nx*ny*(nz+1)-1]);
   unit_assert(2.0 == v5[0] );
   
+  //----------------------------------------------------------------------
+
+  unit_class("FieldArena");
+
+  FieldArena::clear();
+
+  unit_func("allocate");
+  char * a1 = FieldArena::allocate(1000);
+  char * a2 = FieldArena::allocate(3000);
+  unit_assert ((uintptr_t(a1) % 64) == 0);
+  unit_assert ((uintptr_t(a2) % 64) == 0);
+  unit_assert (FieldArena::bytes_used() == 1024 + 3008);
+  unit_assert (FieldArena::bytes_free() == 0);
+
+  unit_func("deallocate");
+  FieldArena::deallocate(a1,1000);
+  unit_assert (FieldArena::bytes_used() == 3008);
+  unit_assert (FieldArena::bytes_free() == 1024);
+  // same padded size reuses the released array
+  unit_assert (FieldArena::allocate(1010) == a1);
+  unit_assert (FieldArena::bytes_free() == 0);
+
+  unit_func("trim");
+  FieldArena::deallocate(a1,1010);
+  FieldArena::deallocate(a2,3000);
+  FieldArena::trim(1);
+  unit_assert (FieldArena::bytes_free() == 1024 + 3008);
+  a2 = FieldArena::allocate(3000);
+  FieldArena::deallocate(a2,3000);
+  FieldArena::trim(2);
+  unit_assert (FieldArena::bytes_free() == 3008);
+
+  unit_func("clear");
+  FieldArena::clear();
+  unit_assert (FieldArena::bytes_free() == 0);
+
   //----------------------------------------------------------------------
   unit_finalize();
   //----------------------------------------------------------------------
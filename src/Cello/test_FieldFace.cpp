@@ -387,6 +387,47 @@ PARALLEL_MAIN_BEGIN
   unit_func("face_to_array / array_to_face");
   unit_assert(test_fields(field_descr,field_data.data(),nbx,nby,nbz,mx,my,mz));
 
+  //----------------------------------------------------------------------
+  // FieldFacePool
+  //----------------------------------------------------------------------
+
+  {
+    Refresh refresh;
+    refresh.set_id(0);
+
+    unit_class("FieldFacePool");
+
+    unit_func("acquire()");
+    const long misses = FieldFacePool::misses[cello::index_static()];
+    FieldFace * face_send = FieldFacePool::acquire(3,refresh.id());
+    face_send->set_refresh(&refresh,false);
+    unit_assert (FieldFacePool::misses[cello::index_static()] == misses + 1);
+
+    unit_func("release()");
+    FieldFacePool::release(face_send);
+    unit_assert (FieldFacePool::num_free() == 1);
+
+    unit_func("acquire()");
+    const long hits = FieldFacePool::hits[cello::index_static()];
+    unit_assert (FieldFacePool::acquire(3,refresh.id()) == face_send);
+    unit_assert (FieldFacePool::hits[cello::index_static()] == hits + 1);
+    unit_assert (FieldFacePool::num_free() == 0);
+
+    unit_func("acquire_owner()");
+    // faces not owning their Refresh are not returned as owners
+    FieldFacePool::release(face_send);
+    FieldFace * face_recv = FieldFacePool::acquire_owner(3);
+    unit_assert (face_recv != face_send);
+    face_recv->set_refresh(new Refresh,true);
+    FieldFacePool::release(face_recv);
+    unit_assert (FieldFacePool::acquire_owner(3) == face_recv);
+    FieldFacePool::release(face_recv);
+
+    unit_func("clear()");
+    FieldFacePool::clear();
+    unit_assert (FieldFacePool::num_free() == 0);
+  }
+
   //----------------------------------------------------------------------	
   // clean up
   //----------------------------------------------------------------------	
@@ -0,0 +1,139 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_FieldFaceBench.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Micro-benchmark for FieldFace packing and unpacking
+///
+/// Times FieldFace::face_to_array() followed by
+/// FieldFace::array_to_face() for face, edge, and corner neighbors,
+/// for single and double precision fields and ghost depths 1 to 4,
+/// and reports the effective bandwidth in GB/s as JSON lines.  This is a
+/// benchmark, not a unit test: the only assertion is that each
+/// packed array has the expected size.
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+/// Number of fields refreshed together
+const int num_fields = 8;
+
+/// Block size excluding ghost zones
+const int mx = 32, my = 32, mz = 32;
+
+/// Number of pack/unpack repetitions per timing
+const int num_repeat = 200;
+
+//----------------------------------------------------------------------
+
+double time_face
+(FieldDescr * field_descr, int g, const int face[3], int * bytes)
+{
+  FieldData * data_src = new FieldData (field_descr, mx, my, mz);
+  FieldData * data_dst = new FieldData (field_descr, mx, my, mz);
+  data_src->allocate_permanent(field_descr,true);
+  data_dst->allocate_permanent(field_descr,true);
+
+  Field field_src (field_descr,data_src);
+  Field field_dst (field_descr,data_dst);
+
+  FieldFace face_src (3);
+  FieldFace face_dst (3);
+
+  face_src.set_refresh_type(refresh_same);
+  face_dst.set_refresh_type(refresh_same);
+  face_src.set_ghost(g,g,g);
+  face_dst.set_ghost(g,g,g);
+  face_src.set_face( face[0], face[1], face[2]);
+  face_dst.set_face(-face[0],-face[1],-face[2]);
+
+  std::vector<int> field_list;
+  for (int i=0; i<num_fields; i++) field_list.push_back(i);
+
+  Refresh refresh;
+  refresh.set_field_list(field_list);
+  face_src.set_refresh(&refresh,false);
+  face_dst.set_refresh(&refresh,false);
+
+  *bytes = face_src.num_bytes_array(field_src);
+  char * array = new char [*bytes];
+
+  Timer timer;
+  timer.start();
+  for (int i=0; i<num_repeat; i++) {
+    face_src.face_to_array (field_src,array);
+    face_dst.array_to_face (array,field_dst);
+  }
+  double time = timer.stop();
+
+  delete [] array;
+  delete data_dst;
+  delete data_src;
+
+  return time;
+}
+
+//======================================================================
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("FieldFace");
+
+  const int face_list[3][3] = { {1,0,0}, {1,1,0}, {1,1,1} };
+  const char * face_name[3] = { "face", "edge", "corner" };
+
+  const precision_type precision_list[2] =
+    { precision_single, precision_double };
+  const char * precision_name[2] = { "single", "double" };
+
+  for (int ip=0; ip<2; ip++) {
+    for (int g=1; g<=4; g++) {
+
+      FieldDescr * field_descr = new FieldDescr;
+
+      for (int i=0; i<num_fields; i++) {
+        char name[20];
+        snprintf (name,sizeof(name),"field_%d",i);
+        field_descr->insert_permanent(name);
+        field_descr->set_precision(i,precision_list[ip]);
+        field_descr->set_ghost_depth(i,g,g,g);
+      }
+
+      for (int iface=0; iface<3; iface++) {
+
+        int bytes;
+        double time = time_face (field_descr,g,face_list[iface],&bytes);
+
+        // face_to_array() reads and writes bytes, as does array_to_face()
+        const double gbytes = 4.0e-9*bytes*num_repeat;
+
+        char bench[80];
+        snprintf (bench,sizeof(bench),"pack_unpack/%s/g%d/%s",
+                  precision_name[ip],g,face_name[iface]);
+        unit_bench (bench, (time > 0.0) ? gbytes / time : 0.0, "GB/s");
+
+        const int n = g * (iface >= 1 ? g : my) * (iface >= 2 ? g : mz);
+        unit_func("num_bytes_array()");
+        unit_assert (bytes ==
+                     num_fields*n*cello::sizeof_precision(precision_list[ip]));
+      }
+
+      delete field_descr;
+    }
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,68 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_FieldHandle.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Test program for the FieldHandle class
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+
+PARALLEL_MAIN_BEGIN
+{
+
+  //----------------------------------------------------------------------
+  unit_init(0,1);
+  //----------------------------------------------------------------------
+
+  unit_class("FieldHandle");
+
+  FieldDescr * fd = new FieldDescr;
+
+  fd->insert_permanent("density");
+
+  // a handle may be created before its field is defined
+
+  FieldHandle handle_density ("density");
+  FieldHandle handle_velocity ("velocity_x");
+  FieldHandle handle_unknown ("unknown");
+
+  fd->insert_permanent("total_energy");
+  fd->insert_permanent("velocity_x");
+
+  unit_func("name");
+  unit_assert(handle_density.name() == "density");
+  unit_assert(handle_velocity.name() == "velocity_x");
+
+  unit_func("id");
+  unit_assert(handle_density.id(fd) == fd->field_id("density"));
+  unit_assert(handle_velocity.id(fd) == fd->field_id("velocity_x"));
+  unit_assert(handle_unknown.id(fd) == -1);
+
+  // cached ids are unchanged by later definitions
+
+  fd->insert_permanent("velocity_y");
+  unit_assert(handle_density.id(fd) == fd->field_id("density"));
+  unit_assert(handle_velocity.id(fd) == fd->field_id("velocity_x"));
+
+  unit_func("exists");
+  unit_assert(handle_density.exists(fd));
+  unit_assert(! handle_unknown.exists(fd));
+
+  unit_func("FieldHandle()");
+  FieldHandle handle_empty;
+  unit_assert(handle_empty.name() == "");
+  unit_assert(! handle_empty.exists(fd));
+
+  delete fd;
+
+  //----------------------------------------------------------------------
+  unit_finalize();
+  //----------------------------------------------------------------------
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
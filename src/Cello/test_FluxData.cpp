@@ -242,6 +242,26 @@ PARALLEL_MAIN_BEGIN
       }
     }
   }
+
+  unit_func ("allocate() neighbor_faces");
+
+  const bool neighbor_faces[3][2] =
+    { {true,false}, {false,false}, {false,true} };
+
+  flux_data.allocate(n3[0],n3[1],n3[2],field_list,true,
+                     nullptr,nullptr,nullptr,neighbor_faces);
+
+  for (int i_f=0; i_f<n_f; i_f++) {
+    for (int axis=0; axis<3; axis++) {
+      for (int face=0; face<2; face++) {
+        unit_assert(flux_data.block_fluxes(axis,face,i_f) != nullptr);
+        unit_assert((flux_data.neighbor_fluxes(axis,face,i_f) != nullptr)
+                    == neighbor_faces[axis][face]);
+      }
+    }
+  }
+
+  flux_data.deallocate();
   
   unit_finalize();
 
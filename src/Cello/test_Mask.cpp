@@ -96,6 +96,28 @@ PARALLEL_MAIN_BEGIN
     }
   }
 
+  double xv[nx*ny*nz], yv[nx*ny*nz], zv[nx*ny*nz];
+  for (int ix=0; ix<nx; ix++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int iz=0; iz<nz; iz++) {
+	int i=ix+nx*(iy+ny*iz);
+	xv[i] = x[ix];
+	yv[i] = y[iy];
+	zv[i] = z[iz];
+      }
+    }
+  }
+
+  bool pointmask[nx*ny*nz];
+
+  mask->evaluate_points(pointmask,t,nx*ny*nz,xv,yv,zv);
+
+  unit_func ("evaluate_points(mask,n)");
+
+  for (int i=0; i<nx*ny*nz; i++) {
+    unit_assert (pointmask[i] == bitmask[i]);
+  }
+
   exit_();
 }
 
@@ -572,6 +572,8 @@ PARALLEL_MAIN_BEGIN
 
   parameters1->read ( "test.in" );
 
+  parameters1->write_cache ( "test.cache" );
+
   check_parameters(parameters1);
 
   parameters1->write ( "test1.out", param_write_cello );
@@ -587,6 +589,18 @@ PARALLEL_MAIN_BEGIN
 
   check_parameters(parameters3);
 
+  //--------------------------------------------------
+  unit_func("read_cache");
+  //--------------------------------------------------
+
+  Parameters * parameters4 = new Parameters;
+
+  unit_assert (! parameters4->read_cache("test.cache","test1.out"));
+  unit_assert (parameters4->read_cache("test.cache","test.in"));
+
+  check_parameters(parameters4);
+
+  delete parameters4;
   delete parameters3;
   delete parameters2;
   delete parameters1;
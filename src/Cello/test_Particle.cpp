@@ -395,6 +395,20 @@ PARALLEL_MAIN_BEGIN
   }
   unit_assert(count_particles == 30000);
 
+  unit_func("attribute_view()");
+
+  for (int ib=0; ib<nb; ib++) {
+    unit_assert
+      ((uintptr_t(particle.attribute_array(it_dark,ia_dark_vx,ib))
+        % PARTICLE_ALIGN) == 0);
+    unit_assert
+      ((uintptr_t(particle.attribute_array(it_dark,ia_dark_x,ib))
+        % PARTICLE_ALIGN) == 0);
+    CelloView<float,1> x = particle.attribute_view<float>(it_dark,ia_dark_x,ib);
+    unit_assert (x.shape(0) == particle.num_particles(it_dark,ib));
+    unit_assert (x(0) == 10*(ib*mp));
+  }
+
   // test position() and velocity()
   std::vector<double> xp(mp), yp(mp), zp(mp);
   std::vector<double> vxp(mp),vyp(mp),vzp(mp);
@@ -718,8 +732,14 @@ PARALLEL_MAIN_BEGIN
   unit_assert (particle.efficiency (it_trace)   < 0.80);
   unit_assert (particle.efficiency ()           < 0.65);
 
+  const int np_dark  = particle.num_particles(it_dark);
+  const int np_trace = particle.num_particles(it_trace);
+
   particle.compress(it_dark);
 
+  unit_assert (particle.num_particles(it_dark) == np_dark);
+  unit_assert (particle.num_batches(it_dark) == (np_dark + mb - 1) / mb);
+
   unit_assert (particle.efficiency (it_dark,0)  > 0.99);
   unit_assert (particle.efficiency (it_dark)    > 0.85);
   unit_assert (particle.efficiency (it_trace,0) < 0.70);
@@ -728,12 +748,58 @@ PARALLEL_MAIN_BEGIN
 
   particle.compress(it_trace);
 
+  unit_assert (particle.num_particles(it_trace) == np_trace);
+
   unit_assert (particle.efficiency (it_dark,0)  > 0.99);
   unit_assert (particle.efficiency (it_dark)    > 0.85);
   unit_assert (particle.efficiency (it_trace,0) > 0.99);
   unit_assert (particle.efficiency (it_trace)   > 0.99);
   unit_assert (particle.efficiency ()           > 0.90);
 
+  //--------------------------------------------------
+
+  unit_func("sort()");
+
+  {
+    // label particles with their original index, sort by a scrambled
+    // key, and check that labels follow the key order
+
+    const int it3[2] = {it_dark, it_trace};
+    const int ia3[2] = {ia_dark_m, ia_trace_y};
+
+    for (int k=0; k<2; k++) {
+      const int it = it3[k];
+      const int ia = ia3[k];
+      const int np = particle.num_particles(it);
+      const int d = particle.stride(it,ia);
+      std::vector<int64_t> key(np);
+      for (int ib=0,i=0; ib<particle.num_batches(it); ib++) {
+        char * a = particle.attribute_array(it,ia,ib);
+        for (int ip=0; ip<particle.num_particles(it,ib); ip++,i++) {
+          if (k==0) ((double *) a)[ip*d] = i;
+          else      ((int64_t *)a)[ip*d] = i;
+          key[i] = (7919*int64_t(i)) % 1000;
+        }
+      }
+
+      particle.sort(it,key.data());
+
+      bool ordered = true;
+      int64_t key_prev = -1;
+      for (int ib=0; ib<particle.num_batches(it); ib++) {
+        char * a = particle.attribute_array(it,ia,ib);
+        for (int ip=0; ip<particle.num_particles(it,ib); ip++) {
+          const int64_t i = (k==0) ?
+            int64_t(((double *) a)[ip*d]) : ((int64_t *)a)[ip*d];
+          ordered = ordered && (key_prev <= key[i]);
+          key_prev = key[i];
+        }
+      }
+      unit_assert (ordered);
+      unit_assert (particle.num_particles(it) == np);
+    }
+  }
+
   //--------------------------------------------------
   //   GATHER / SCATTER
   //--------------------------------------------------
@@ -1050,7 +1116,28 @@ PARALLEL_MAIN_BEGIN
   if (buffer_next - buffer != n)
     printf ("buffer size mismatch: %ld %d\n",buffer_next - buffer,n);
   unit_assert (buffer_next - buffer == n);
-  unit_assert (p_dst == new_p);
+
+  // only particles in use are sent, so compare their attributes
+  // rather than the raw batch arrays
+
+  bool is_same = (new_p.num_types() == p_dst.num_types());
+  for (int it=0; is_same && it<p_dst.num_types(); it++) {
+    is_same = (new_p.num_batches(it) == p_dst.num_batches(it));
+    for (int ib=0; is_same && ib<p_dst.num_batches(it); ib++) {
+      const int np = p_dst.num_particles(it,ib);
+      is_same = (new_p.num_particles(it,ib) == np);
+      for (int ia=0; is_same && ia<p_dst.num_attributes(it); ia++) {
+        const int ny = p_dst.attribute_bytes(it,ia);
+        const int mp = ny*p_dst.stride(it,ia);
+        const char * a_src = p_dst.attribute_array(it,ia,ib);
+        const char * a_dst = new_p.attribute_array(it,ia,ib);
+        for (int ip=0; is_same && ip<np; ip++) {
+          is_same = (memcmp(a_src + ip*mp, a_dst + ip*mp, ny) == 0);
+        }
+      }
+    }
+  }
+  unit_assert (is_same);
 
   delete [] buffer;
   // printf ("error_gather_int %d\n",error_gather_int);
@@ -0,0 +1,114 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ParticleBench.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Micro-benchmark for ParticleData insertion and deletion
+///
+/// Times Particle::insert_particles() and masked
+/// Particle::delete_particles() of every other particle for several
+/// batch sizes, and reports particles per second as JSON lines.  This
+/// is a benchmark, not a unit test: the only assertion is that half
+/// of the particles remain after deletion.
+
+#include "main.hpp"
+#include "test.hpp"
+
+#include "data.hpp"
+
+//----------------------------------------------------------------------
+
+/// Number of particles inserted per timing
+const int num_particles = 1 << 20;
+
+/// Number of insert/delete repetitions per timing
+const int num_repeat = 10;
+
+//----------------------------------------------------------------------
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ParticleData");
+
+  const int batch_size_list[3] = { 256, 1024, 4096 };
+
+  for (int ib=0; ib<3; ib++) {
+
+    const int mb = batch_size_list[ib];
+
+    ParticleDescr * particle_descr = new ParticleDescr;
+    particle_descr->set_batch_size (mb);
+
+    ParticleData * particle_data = new ParticleData;
+    Particle particle (particle_descr, particle_data);
+
+    const int it = particle.new_type ("dark");
+    particle.new_attribute (it, "x",  type_double);
+    particle.new_attribute (it, "y",  type_double);
+    particle.new_attribute (it, "z",  type_double);
+    particle.new_attribute (it, "vx", type_double);
+    particle.new_attribute (it, "vy", type_double);
+    particle.new_attribute (it, "vz", type_double);
+    particle.new_attribute (it, "mass", type_double);
+
+    bool * mask = new bool [mb];
+    for (int ip=0; ip<mb; ip++) mask[ip] = (ip % 2);
+
+    double time_insert = 0.0;
+    double time_delete = 0.0;
+    int num_remaining = 0;
+
+    for (int repeat=0; repeat<num_repeat; repeat++) {
+
+      Timer timer;
+      timer.start();
+      particle.insert_particles (it, num_particles);
+      time_insert += timer.stop();
+
+      timer.clear();
+      timer.start();
+      for (int ibatch=0; ibatch<particle.num_batches(it); ibatch++) {
+        particle.delete_particles (it, ibatch, mask);
+      }
+      particle.compress();
+      time_delete += timer.stop();
+
+      num_remaining = particle.num_particles(it);
+
+      // remove the remaining particles for the next repetition
+
+      for (int ibatch=0; ibatch<particle.num_batches(it); ibatch++) {
+        particle.delete_particles (it, ibatch);
+      }
+      particle.compress();
+    }
+
+    char name[80];
+    snprintf (name,sizeof(name),"insert/batch%d",mb);
+    unit_bench (name, (time_insert > 0.0) ?
+                1.0*num_repeat*num_particles/time_insert : 0.0,
+                "particles/s");
+    snprintf (name,sizeof(name),"delete/batch%d",mb);
+    unit_bench (name, (time_delete > 0.0) ?
+                1.0*num_repeat*num_particles/time_delete : 0.0,
+                "particles/s");
+
+    unit_func("delete_particles()");
+    unit_assert (num_remaining == num_particles/2);
+
+    delete [] mask;
+    delete particle_data;
+    delete particle_descr;
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
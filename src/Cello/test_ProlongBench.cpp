@@ -0,0 +1,133 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_ProlongBench.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Micro-benchmark for ProlongLinear and RestrictLinear
+///
+/// Times ProlongLinear::apply() and RestrictLinear::apply() for
+/// whole 1D, 2D, and 3D blocks in single and double precision, with
+/// and without accumulation, and reports fine cells per second as
+/// JSON lines.  This is a benchmark, not a unit test: the only
+/// assertion is that a constant coarse array prolongs to the same
+/// constant.
+
+#include "main.hpp"
+#include "test.hpp"
+#include "mesh.hpp"
+
+//----------------------------------------------------------------------
+
+/// Fine block size along each axis excluding ghost zones
+const int nf = 32;
+
+/// Ghost depth of the fine and coarse arrays
+const int g = 3;
+
+/// Number of fine cells processed per timing
+const long long num_cells = 1 << 24;
+
+//----------------------------------------------------------------------
+
+template <class T>
+void bench (int rank, precision_type precision, const char * precision_name)
+{
+  // coarse array covers the fine block plus one coarse ghost cell
+  // on each side, as in refresh
+
+  int mf3[3] = {1,1,1}, of3[3] = {0,0,0}, nf3[3] = {1,1,1};
+  int mc3[3] = {1,1,1}, oc3[3] = {0,0,0}, nc3[3] = {1,1,1};
+  for (int i=0; i<rank; i++) {
+    mf3[i] = nf + 2*g;  of3[i] = g;    nf3[i] = nf;
+    mc3[i] = nf/2 + 2*g; oc3[i] = g-1; nc3[i] = nf/2 + 2;
+  }
+  const int mf = mf3[0]*mf3[1]*mf3[2];
+  const int mc = mc3[0]*mc3[1]*mc3[2];
+  const int n  = nf3[0]*nf3[1]*nf3[2];
+  const int num_repeat = std::max(1LL, num_cells / n);
+
+  std::vector<T> values_f (mf, 0.0);
+  std::vector<T> values_c (mc, 1.0);
+
+  ProlongLinear prolong;
+  RestrictLinear restrict_linear;
+
+  for (int accumulate=0; accumulate<2; accumulate++) {
+
+    char name[80];
+
+    Timer timer;
+    timer.start();
+    for (int i=0; i<num_repeat; i++) {
+      prolong.apply (precision,
+                     values_f.data(), mf3, of3, nf3,
+                     values_c.data(), mc3, oc3, nc3,
+                     accumulate);
+    }
+    double time = timer.stop();
+
+    snprintf (name,sizeof(name),"prolong/%s/%dd%s",
+              precision_name,rank,accumulate ? "/accumulate" : "");
+    unit_bench (name, (time > 0.0) ? 1.0*num_repeat*n/time : 0.0, "cells/s");
+
+    // restrict the fine block interior to the coarse interior
+
+    int ocr3[3] = {0,0,0}, ncr3[3] = {1,1,1};
+    for (int i=0; i<rank; i++) { ocr3[i] = g; ncr3[i] = nf/2; }
+
+    timer.clear();
+    timer.start();
+    for (int i=0; i<num_repeat; i++) {
+      restrict_linear.apply (precision,
+                      values_c.data(), mc3, ocr3, ncr3,
+                      values_f.data(), mf3, of3, nf3,
+                      accumulate);
+    }
+    time = timer.stop();
+
+    snprintf (name,sizeof(name),"restrict/%s/%dd%s",
+              precision_name,rank,accumulate ? "/accumulate" : "");
+    unit_bench (name, (time > 0.0) ? 1.0*num_repeat*n/time : 0.0, "cells/s");
+  }
+
+  // final check: a constant prolongs to the same constant
+
+  std::fill (values_c.begin(),values_c.end(),T(1.0));
+  prolong.apply (precision,
+                 values_f.data(), mf3, of3, nf3,
+                 values_c.data(), mc3, oc3, nc3, false);
+  bool l_equal = true;
+  for (int iz=0; iz<nf3[2]; iz++) {
+    for (int iy=0; iy<nf3[1]; iy++) {
+      for (int ix=0; ix<nf3[0]; ix++) {
+        const int i = (of3[0]+ix) + mf3[0]*((of3[1]+iy) + mf3[1]*(of3[2]+iz));
+        l_equal = l_equal && (values_f[i] == T(1.0));
+      }
+    }
+  }
+  unit_func("apply()");
+  unit_assert (l_equal);
+}
+
+//======================================================================
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class("ProlongLinear");
+
+  for (int rank=1; rank<=3; rank++) {
+    bench<float>  (rank,precision_single,"single");
+    bench<double> (rank,precision_double,"double");
+  }
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -30,6 +30,11 @@ PARALLEL_MAIN_BEGIN
   unit_func ("min_face_rank()");
   unit_assert(refresh->min_face_rank() == 2);
 
+  unit_func ("ghost_layers()");
+  unit_assert(refresh->ghost_layers() == 0);
+  refresh->set_ghost_layers(1);
+  unit_assert(refresh->ghost_layers() == 1);
+
   unit_func ("add_field()");
   refresh->add_field (12);
   refresh->add_field (9);
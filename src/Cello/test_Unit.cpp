@@ -135,5 +135,17 @@ bool Unit::assertion (int result, const char * file, int line, bool quiet)
   test_num_++;
   return result;
 }
+
+//----------------------------------------------------------------------
+
+void Unit::bench (const char * name, double value, const char * units)
+{
+  if (is_active_) {
+    PARALLEL_PRINTF
+      ("{\"benchmark\":\"%s/%s\",\"value\":%.6g,\"units\":\"%s\"}\n",
+       class_name_, name, value, units);
+    fflush(stdout);
+  }
+}
 //======================================================================
 
@@ -47,6 +47,11 @@
 #define unit_func_quiet(CLASS_NAME, FUNC_NAME)		\
   Unit::instance()->set_func(CLASS_NAME,FUNC_NAME)
 
+/// @def   unit_bench
+/// @brief Report a benchmark measurement as a line of JSON
+#define unit_bench(NAME, VALUE, UNITS)		\
+  Unit::instance()->bench(NAME, VALUE, UNITS)
+
 class Unit {
 
   /// @class    Unit
@@ -106,6 +111,10 @@ public:
   /// Assert result of test macro; called by unit_assert macro
   bool assertion (int result, const char * file, int line, bool quiet=false);
 
+  /// Print a benchmark measurement of the current class as a single
+  /// JSON object line; called by unit_bench macro
+  void bench (const char * name, double value, const char * units);
+
 private:
 
   /// Singleton instance of the Unit object
@@ -167,6 +167,29 @@ public:
     assert_allequal3D(view_map.at("velocity_x"), ValRange<int>(17, -1));
   }
 
+  void test_init_wrapped_4D(){
+    unit_func_quiet("ViewMap", "ViewMap(std::string, std::vector<std::string>, CelloView<T,4>)");
+    std::vector<std::string> keys = {"density", "velocity_x", "total_energy"};
+    std::array<int,3> shape = {4, 6, 8};
+
+    CelloView<int, 4> backing_array(3, shape[0], shape[1], shape[2]);
+    backing_array(1,2,3,4) = 5;
+
+    ViewMap<int> view_map("wrapped_4D", keys, backing_array);
+
+    unit_assert(view_map.contiguous_arrays());
+    unit_assert(view_map.name() == "wrapped_4D");
+    unit_assert(view_map.get_backing_array().is_alias(backing_array));
+    for (const std::string& key: keys) {
+      assert_shape3D(view_map.at(key), shape);
+    }
+    unit_assert(view_map.at("velocity_x")(2,3,4) == 5);
+
+    // mutations through the map are reflected in the wrapped view
+    view_map.at("total_energy")(0,1,2) = -3;
+    unit_assert(backing_array(2,0,1,2) == -3);
+  }
+
   void run_tests(){
     default_constructor();
     default_named_constructor();
@@ -174,6 +197,7 @@ public:
     test_init_simple(false);
     // it is not possible to initialize non-zero managed memory
     test_init_nonzero_wrapped();
+    test_init_wrapped_4D();
   }
 
 };
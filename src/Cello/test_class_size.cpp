@@ -20,6 +20,7 @@ PARALLEL_MAIN_BEGIN
 
   unit_init(0,1);
 
+  printf ("%4ld sizeof(Adapt)\n",sizeof(Adapt));
   printf ("%4ld sizeof(Block)\n",sizeof(Block));
   printf ("%4ld sizeof(Boundary)\n",sizeof(Boundary));
   printf ("%4ld sizeof(EnzoBlock)\n",sizeof(EnzoBlock));
@@ -0,0 +1,167 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     view_CelloViewRef.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Declaration and implementation of the CelloViewRef class template
+
+#ifndef VIEW_CELLO_VIEW_REF_HPP
+#define VIEW_CELLO_VIEW_REF_HPP
+
+//----------------------------------------------------------------------
+
+template<typename T, std::size_t D>
+class CelloViewRef
+{
+  /// @class    CelloViewRef
+  /// @ingroup  View
+  /// @brief    [\ref View] a lightweight, non-owning view of the elements
+  ///           referenced by a CelloView
+  ///
+  /// A CelloViewRef holds a raw pointer along with the shape and strides of
+  /// a CelloView. Unlike CelloView, it doesn't share ownership of the
+  /// underlying memory, so copying one never touches a reference count and
+  /// the type is trivially copyable. This makes it suitable for passing
+  /// arrays by value to inner kernels, or for creating many offset views
+  /// within loops.
+  ///
+  /// The last dimension of a CelloView always has unit stride, and
+  /// CelloViewRef encodes this in the type: the final index is added to the
+  /// address without a multiply, and ``row()`` returns a pointer to a
+  /// contiguous row of elements that inner loops can index directly.
+  ///
+  /// The data pointer is declared with ``RESTRICT``. A kernel must
+  /// therefore not write through one CelloViewRef while accessing
+  /// overlapping memory through another. Any number of CelloViewRef
+  /// instances of the same memory can be read from at once.
+  ///
+  /// @note
+  /// A CelloViewRef doesn't extend the lifetime of the memory it refers to.
+  /// It must not outlive the CelloView (and any copies of it) from which it
+  /// was constructed.
+
+public: // interface
+
+  typedef T value_type;
+  typedef typename std::add_const<T>::type const_value_type;
+  typedef typename std::remove_const<T>::type nonconst_value_type;
+
+  friend class CelloViewRef<const_value_type,D>;
+
+  /// Default constructor. Constructs a null CelloViewRef
+  CelloViewRef() noexcept
+    : data_(nullptr),
+      shape_(),
+      stride_()
+  { }
+
+  /// Construct a CelloViewRef of the elements referenced by view
+  CelloViewRef(const CelloView<T,D> &view) noexcept
+    : data_(view.data()),
+      shape_(),
+      stride_()
+  {
+    for (std::size_t i = 0; i < D; i++){
+      shape_[i] = view.shape(i);
+      stride_[i] = view.stride(i);
+    }
+    ASSERT("CelloViewRef", "the last dimension must have unit stride",
+           stride_[D-1] == 1);
+  }
+
+  /// Construct a CelloViewRef<const T,D> directly from a CelloView<T,D>
+  ///
+  /// @note
+  /// This is only defined when T is const-qualified, since the implicit cast
+  /// would otherwise require two user-defined conversions
+  template<class = std::enable_if<std::is_same<T, const_value_type>::value>>
+  CelloViewRef(const CelloView<nonconst_value_type,D> &view) noexcept
+    : CelloViewRef(CelloViewRef<nonconst_value_type,D>(view))
+  { }
+
+  /// Conversion constructor from CelloViewRef<T,D> to
+  /// CelloViewRef<const T,D>
+  template<class = std::enable_if<std::is_same<T, const_value_type>::value>>
+  CelloViewRef(const CelloViewRef<nonconst_value_type,D> &other) noexcept
+    : data_(other.data_),
+      shape_(),
+      stride_()
+  {
+    for (std::size_t i = 0; i < D; i++){
+      shape_[i] = other.shape_[i];
+      stride_[i] = other.stride_[i];
+    }
+  }
+
+  /// access array elements.
+  template<typename... Args, REQUIRE_INT(Args)>
+  FORCE_INLINE T& operator() (Args... args) const noexcept {
+    static_assert(D==sizeof...(args),
+		  "Number of indices don't match number of dimensions");
+    return data_[calc_index_(stride_,args...)];
+  }
+
+  // Specialized implementation for 3D arrays
+  FORCE_INLINE T& operator() (const int k, const int j, const int i) const
+    noexcept {
+    static_assert(D==3, "3 indices should only be specified for 3D arrays");
+    return data_[k*stride_[0] + j*stride_[1] + i];
+  }
+
+  /// Return a pointer to the first element of a row along the last
+  /// dimension. The elements of the row are contiguous.
+  ///
+  /// @param args The indices for each dimension except the last.
+  template<typename... Args, REQUIRE_INT(Args)>
+  FORCE_INLINE T* row (Args... args) const noexcept {
+    static_assert(D==sizeof...(args)+1,
+		  "Number of indices must be one less than the dimensions");
+    return data_ + calc_index_(stride_, args..., 0);
+  }
+
+  /// Returns the length of a given dimension
+  int shape(unsigned int dim) const noexcept{
+    ASSERT1("CelloViewRef::shape",
+            "%ui is greater than the number of dimensions",
+	    dim, dim<D);
+    return (int)shape_[dim];
+  }
+
+  /// Returns the stride for a given dimension
+  int stride(unsigned int dim) const noexcept{
+    ASSERT1("CelloViewRef::stride",
+            "%ui is greater than the number of dimensions",
+	    dim, dim<D);
+    return (int)stride_[dim];
+  }
+
+  /// Returns the total number of elements held by the array
+  intp size() const noexcept{
+    intp out = 1;
+    for (std::size_t i=0; i<D; i++){ out*=shape_[i]; }
+    return out;
+  }
+
+  /// Returns the number of dimensions
+  constexpr std::size_t rank() const noexcept {return D;}
+
+  /// Returns pointer to the first element
+  T* data() const noexcept { return data_; }
+
+  /// Returns whether the CelloViewRef refers to a nullptr
+  bool is_null() const noexcept { return data_ == nullptr; }
+
+private: // attributes
+
+  /// pointer to the first element
+  T* RESTRICT data_;
+
+  /// lists the length of each dimension, ordered with increasing indexing speed
+  intp shape_[D];
+
+  /// the stride of each dimension. The last value is always 1
+  intp stride_[D];
+
+};
+
+#endif /* VIEW_CELLO_VIEW_REF_HPP */
@@ -214,6 +214,13 @@ public: /// public interface
     : collec_(std::in_place_type_t<detail::ArrOfPtrsViewCollec_<T>>(), v)
   { }
 
+  /// construct a container that wraps an existing 4D view (the arrays are
+  /// the 3D subarrays along its first axis)
+  ViewCollec(const CelloView<T, 4>& backing_array) noexcept
+    : collec_(std::in_place_type_t<detail::SingleAddressViewCollec_<T>>(),
+              backing_array)
+  { }
+
   /// conversion constructor that facilitates implicit casts from
   /// ViewCollec<nonconst_value_type> to ViewCollec<const_value_type>
   ///
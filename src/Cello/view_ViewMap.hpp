@@ -84,6 +84,21 @@ public: // interface
     : ViewMap("", keys, views)
   { }
 
+  /// Constructs a map that wraps existing data, reusing the keys of
+  /// an existing StringIndRdOnlyMap (which is cheap to copy) so that
+  /// no hash table is built.
+  ///
+  /// Each view must have the same shape.
+  ViewMap(std::string name, const StringIndRdOnlyMap &str_index_map,
+          const std::vector<CelloView<T,3>> &views);
+
+  /// Constructs a map that wraps an existing 4D view.
+  ///
+  /// The nth key is associated with the nth 3D subarray along the first axis
+  /// of the view, so the map holds contiguous arrays.
+  ViewMap(std::string name, const std::vector<std::string> &keys,
+          const CelloView<T,4> &backing_array);
+
   /// conversion constructor that facilitates implicit casts from
   /// ViewMap<nonconst_value_type> to ViewMap<const_value_type>
   ///
@@ -250,6 +265,36 @@ ViewMap<T>::ViewMap(std::string name, const std::vector<std::string> &keys,
 
 //----------------------------------------------------------------------
 
+template<typename T>
+ViewMap<T>::ViewMap(std::string name, const StringIndRdOnlyMap &str_index_map,
+                    const std::vector<CelloView<T,3>> &views)
+  : name_(name),
+    str_index_map_(str_index_map),
+    views_(views)
+{
+  ASSERT2("ViewMap::ViewMap",
+          "keys and views have lengths %zu and %zu. They should be the same",
+          (std::size_t)str_index_map.size(), (std::size_t)views.size(),
+          str_index_map.size() == views.size());
+}
+
+//----------------------------------------------------------------------
+
+template<typename T>
+ViewMap<T>::ViewMap(std::string name, const std::vector<std::string> &keys,
+                    const CelloView<T,4> &backing_array)
+  : name_(name),
+    str_index_map_(keys),
+    views_(backing_array)
+{
+  ASSERT2("ViewMap::ViewMap",
+          "keys and views have lengths %zu and %zu. They should be the same",
+          (std::size_t)keys.size(), (std::size_t)backing_array.shape(0),
+          keys.size() == (std::size_t)backing_array.shape(0));
+}
+
+//----------------------------------------------------------------------
+
 template<typename T>
 bool ViewMap<T>::validate_key_order(const std::vector<std::string> &ref,
                                     bool raise_err,
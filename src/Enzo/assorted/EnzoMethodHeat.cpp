@@ -12,10 +12,34 @@
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// RKL2 coefficient b_j (Meyer, Balsara & Aslam 2014, eq. 16)
+  double rkl2_b_ (int j)
+  { return (j < 2) ? 1.0/3.0 : (j*j + j - 2.0) / (2.0*j*(j + 1.0)); }
+
+}
+
+//----------------------------------------------------------------------
+
 EnzoMethodHeat::EnzoMethodHeat (ParameterGroup p)
   : Method(),
-    alpha_(p.value_float("alpha",1.0))
+    alpha_(p.value_float("alpha",1.0)),
+    integrator_(p.value_string("integrator","explicit")),
+    max_stages_(p.value_integer("max_stages",20)),
+    ir_stage_(-1),
+    i_stage_(-1),
+    i_y0_(-1),
+    i_l0_(-1),
+    i_ym2_(-1)
 {
+  ASSERT1 ("EnzoMethodHeat::EnzoMethodHeat()",
+           "Method:heat:integrator \"%s\" must be \"explicit\" or \"rkl2\"",
+           integrator_.c_str(),
+           (integrator_ == "explicit" || integrator_ == "rkl2"));
+  ASSERT1 ("EnzoMethodHeat::EnzoMethodHeat()",
+           "Method:heat:max_stages = %d must be at least 2",
+           max_stages_, (max_stages_ >= 2));
 
   cello::define_field ("temperature");
 
@@ -25,6 +49,22 @@ EnzoMethodHeat::EnzoMethodHeat (ParameterGroup p)
   Refresh * refresh = cello::refresh(ir_post_);
   refresh->add_field("temperature");
 
+  if (integrator_ == "rkl2") {
+
+    // each stage after the first needs current ghost zones
+
+    ir_stage_ = add_refresh_();
+    cello::simulation()->refresh_set_name(ir_stage_,name()+":stage");
+    cello::refresh(ir_stage_)->add_field("temperature");
+
+    i_stage_ = cello::scalar_descr_int()->new_value("heat:stage");
+
+    FieldDescr * field_descr = cello::field_descr();
+    i_y0_  = field_descr->insert_temporary();
+    i_l0_  = field_descr->insert_temporary();
+    i_ym2_ = field_descr->insert_temporary();
+  }
+
   this->set_courant(p.value_float("courant",1.0));
 }
 
@@ -40,6 +80,13 @@ void EnzoMethodHeat::pup (PUP::er &p)
   Method::pup(p);
 
   p | alpha_;
+  p | integrator_;
+  p | max_stages_;
+  p | ir_stage_;
+  p | i_stage_;
+  p | i_y0_;
+  p | i_l0_;
+  p | i_ym2_;
 }
 
 //----------------------------------------------------------------------
@@ -47,7 +94,15 @@ void EnzoMethodHeat::pup (PUP::er &p)
 void EnzoMethodHeat::compute ( Block * block) throw()
 {
 
-  if (block->is_leaf()) {
+  if (block->is_leaf() && integrator_ == "rkl2") {
+
+    // remaining stages continue in p_method_heat_stage()
+
+    s_stage_(block) = 0;
+    rkl2_stage (block);
+    return;
+
+  } else if (block->is_leaf()) {
 
     Field field = block->data()->field();
 
@@ -63,6 +118,12 @@ void EnzoMethodHeat::compute ( Block * block) throw()
 
 double EnzoMethodHeat::timestep ( Block * block ) throw()
 {
+  if (integrator_ == "rkl2") {
+    // the largest timestep max_stages_ stages can cover
+    const double s = max_stages_;
+    return courant_*dt_explicit_()*(s*s + s - 2.0)/4.0;
+  }
+
   // initialize_(block);
 
   Data * data = block->data();
@@ -172,3 +233,172 @@ void EnzoMethodHeat::compute_ (Block * block,enzo_float * Unew) throw()
   delete [] U;
 
 }
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_heat_stage()
+{
+  EnzoMethodHeat * method = static_cast<EnzoMethodHeat*> (this->method());
+  method->rkl2_stage(this);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::rkl2_stage (Block * block) throw()
+{
+  Field field = block->data()->field();
+
+  enzo_float * U = (enzo_float *) field.values ("temperature");
+
+  const int id_temp = field.field_id ("temperature");
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions  (id_temp,&mx,&my,&mz);
+  field.ghost_depth (id_temp,&gx,&gy,&gz);
+  const int m = mx*my*mz;
+
+  const double tau = block->dt();
+  const int s = num_stages_(tau);
+  const double w1 = 4.0/(s*s + s - 2.0);
+
+  int & j = s_stage_(block);
+  ++j;
+
+  if (j == 1) {
+
+    field.allocate_temporary(i_y0_);
+    field.allocate_temporary(i_l0_);
+    field.allocate_temporary(i_ym2_);
+
+    enzo_float * Y0  = (enzo_float *) field.values (i_y0_);
+    enzo_float * L0  = (enzo_float *) field.values (i_l0_);
+    enzo_float * Ym2 = (enzo_float *) field.values (i_ym2_);
+
+    for (int i=0; i<m; i++) Y0[i]  = U[i];
+    for (int i=0; i<m; i++) Ym2[i] = U[i];
+
+    laplacian_ (block,Y0,L0);
+
+    // Y_1 = Y_0 + mu~_1 tau L(Y_0); L0 is zero at ghost cells
+
+    const double mu1 = rkl2_b_(1)*w1;
+    for (int i=0; i<m; i++) U[i] = Y0[i] + mu1*tau*L0[i];
+
+  } else {
+
+    const enzo_float * Y0  = (enzo_float *) field.values (i_y0_);
+    const enzo_float * L0  = (enzo_float *) field.values (i_l0_);
+    enzo_float *       Ym2 = (enzo_float *) field.values (i_ym2_);
+
+    std::vector<enzo_float> L(m);
+    laplacian_ (block,U,L.data());
+
+    const double b  = rkl2_b_(j);
+    const double mu = (2.0*j - 1.0)/j * b/rkl2_b_(j-1);
+    const double nu = -(j - 1.0)/j * b/rkl2_b_(j-2);
+    const double mu_t = mu*w1;
+    const double gamma_t = -(1.0 - rkl2_b_(j-1))*mu_t;
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        for (int ix=gx; ix<mx-gx; ix++) {
+          const int i = ix + mx*(iy + my*iz);
+          const enzo_float y = mu*U[i] + nu*Ym2[i] + (1.0 - mu - nu)*Y0[i]
+            + mu_t*tau*L[i] + gamma_t*tau*L0[i];
+          Ym2[i] = U[i];
+          U[i] = y;
+        }
+      }
+    }
+  }
+
+  if (j < s) {
+
+    block->refresh_start (ir_stage_,CkIndex_EnzoBlock::p_method_heat_stage());
+
+  } else {
+
+    field.deallocate_temporary(i_y0_);
+    field.deallocate_temporary(i_l0_);
+    field.deallocate_temporary(i_ym2_);
+    j = 0;
+
+    block->compute_done();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodHeat::laplacian_
+(Block * block, const enzo_float * U, enzo_float * L) throw()
+{
+  Field field = block->data()->field();
+
+  const int id_temp = field.field_id ("temperature");
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions  (id_temp,&mx,&my,&mz);
+  field.ghost_depth (id_temp,&gx,&gy,&gz);
+
+  const int rank = cello::rank();
+
+  double hx,hy,hz;
+  block->cell_width(&hx,&hy,&hz);
+
+  const double dxi = alpha_/(hx*hx);
+  const double dyi = (rank >= 2) ? alpha_/(hy*hy) : 0.0;
+  const double dzi = (rank >= 3) ? alpha_/(hz*hz) : 0.0;
+
+  const int idx = 1;
+  const int idy = (rank >= 2) ? mx : 0;
+  const int idz = (rank >= 3) ? mx*my : 0;
+
+  for (int i=0; i<mx*my*mz; i++) L[i] = 0.0;
+
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+        const int i = ix + mx*(iy + my*iz);
+        L[i] = dxi*(U[i-idx] - 2*U[i] + U[i+idx])
+          +    dyi*(U[i-idy] - 2*U[i] + U[i+idy])
+          +    dzi*(U[i-idz] - 2*U[i] + U[i+idz]);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+double EnzoMethodHeat::dt_explicit_ () const throw()
+{
+  // finest cell width allowed by Adapt:max_level, so that every Block
+  // takes the same number of stages
+
+  const Config * config = cello::config();
+  const int rank = cello::rank();
+
+  double lower[3], upper[3];
+  cello::hierarchy()->lower(lower,lower+1,lower+2);
+  cello::hierarchy()->upper(upper,upper+1,upper+2);
+
+  const double refine = std::pow(2.0,config->mesh_max_level);
+  double h_min = std::numeric_limits<double>::max();
+  for (int axis=0; axis<rank; axis++) {
+    const double h = (upper[axis] - lower[axis]) /
+      (config->mesh_root_size[axis]*refine);
+    h_min = std::min(h_min,h);
+  }
+
+  return h_min*h_min/(2.0*rank*alpha_);
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMethodHeat::num_stages_ (double dt) const throw()
+{
+  // smallest s with dt <= dt_explicit (s^2 + s - 2) / 4
+
+  const double ratio = dt / dt_explicit_();
+  const int s = int(std::ceil(0.5*(std::sqrt(9.0 + 16.0*ratio) - 1.0)));
+  return std::max(s,2);
+}
@@ -4,7 +4,7 @@
 /// @author   James Bordner (jobordner@ucsd.edu) 
 /// @date     Thu Apr  1 16:14:38 PDT 2010
 /// @brief    [\ref Enzo] Declaration of EnzoMethodHeat
-///           forward Euler solver for the heat equation
+///           forward Euler or RKL2 solver for the heat equation
 
 #ifndef ENZO_ENZO_METHOD_HEAT_HPP
 #define ENZO_ENZO_METHOD_HEAT_HPP
@@ -16,6 +16,12 @@ class EnzoMethodHeat : public Method {
   ///
   /// @brief [\ref Enzo] Demonstration method to solve heat equation
   /// using forward Euler method
+  ///
+  /// With integrator "rkl2" the equation is instead advanced by the
+  /// second-order Runge-Kutta-Legendre super-time-stepping scheme of
+  /// Meyer, Balsara & Aslam (2014), which takes s stages, each
+  /// preceded by a refresh, to cover a timestep about s^2/4 times the
+  /// explicit limit.
 
 public: // interface
 
@@ -24,7 +30,14 @@ public: // interface
 
   EnzoMethodHeat()
     : Method(),
-      alpha_(0.0)
+      alpha_(0.0),
+      integrator_("explicit"),
+      max_stages_(0),
+      ir_stage_(-1),
+      i_stage_(-1),
+      i_y0_(-1),
+      i_l0_(-1),
+      i_ym2_(-1)
   { }
 
   /// Charm++ PUP::able declarations
@@ -33,7 +46,14 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodHeat (CkMigrateMessage *m)
     : Method (m),
-      alpha_(0.0)
+      alpha_(0.0),
+      integrator_("explicit"),
+      max_stages_(0),
+      ir_stage_(-1),
+      i_stage_(-1),
+      i_y0_(-1),
+      i_l0_(-1),
+      i_ym2_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -48,14 +68,51 @@ public: // interface
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Perform the next RKL2 stage, then refresh or end the method
+  void rkl2_stage (Block * block) throw();
+
 protected: // methods
 
   void compute_ (Block * block, enzo_float * Unew ) throw();
 
+  /// Compute alpha times the Laplacian of U at interior cells, and
+  /// zero at ghost cells
+  void laplacian_ (Block * block, const enzo_float * U,
+                   enzo_float * L) throw();
+
+  /// Explicit timestep limit at the finest allowed mesh level, the
+  /// same on all Blocks
+  double dt_explicit_ () const throw();
+
+  /// Number of RKL2 stages needed for timestep dt
+  int num_stages_ (double dt) const throw();
+
+  /// Current RKL2 stage of the Block
+  int & s_stage_(Block * block) const
+  { return *block->data()->scalar_int().value(i_stage_); }
+
 protected: // attributes
 
   /// Thermal diffusivity
   double alpha_;
+
+  /// Time integrator: "explicit" or "rkl2"
+  std::string integrator_;
+
+  /// Maximum number of RKL2 stages per timestep
+  int max_stages_;
+
+  /// Refresh between RKL2 stages
+  int ir_stage_;
+
+  /// Block scalar index of the current RKL2 stage
+  int i_stage_;
+
+  /// Temporary fields for the RKL2 initial values, their Laplacian,
+  /// and the values two stages back
+  int i_y0_;
+  int i_l0_;
+  int i_ym2_;
 };
 
 #endif /* ENZO_ENZO_METHOD_HEAT_HPP */
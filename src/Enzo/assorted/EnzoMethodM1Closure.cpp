@@ -10,7 +10,6 @@
 #include "Cello/cello.hpp"
 #include "Enzo/enzo.hpp"
 
-//#define DEBUG_PRINT_REDUCED_VARIABLES
 //#define DEBUG_PRINT_GROUP_PARAMETERS
 //#define DEBUG_RECOMBINATION
 //#define DEBUG_INJECTION
@@ -52,6 +51,11 @@ EnzoMethodM1Closure::EnzoMethodM1Closure(ParameterGroup p)
 
   this->set_courant(p.value_float("courant",1.0));
 
+  ASSERT1("EnzoMethodM1Closure::EnzoMethodM1Closure",
+          "flux_function type \"%s\" not recognized",
+          flux_function_.c_str(),
+          (flux_function_ == "GLF" || flux_function_ == "HLL"));
+
   // finish parsing parameters (since this logic was moved here after the rest
   // of the function was written, we are putting it into its own scope to avoid
   // conflicts in variable names)
@@ -207,7 +211,11 @@ EnzoMethodM1Closure::EnzoMethodM1Closure(ParameterGroup p)
   }
 
   // read in data tables
-  M1_tables = (flux_function_ == "HLL") ? new M1Tables(hll_file_) : nullptr;
+  if (flux_function_ == "HLL") {
+    M1_tables = cello::node_shared<M1Tables>
+      ("M1Tables:" + hll_file_,
+       [this] () { return new M1Tables(hll_file_); });
+  }
 
   refresh_injection->set_callback(CkIndex_EnzoBlock::p_method_m1_closure_solve_transport_eqn()); 
 }
@@ -734,91 +742,127 @@ void M1Tables::read_hll_eigenvalues(std::string hll_file) throw()
 
 
 
-void EnzoMethodM1Closure::compute_hll_eigenvalues (double f, double theta, double * lmin, double * lmax, 
-                                                    double clight) throw() 
+void M1Tables::hll_eigenvalues (double f, const double * theta,
+                                double * lmin, double * lmax,
+                                int stride) const throw()
 {
-  double lf = f*100;
-  double lt = theta/cello::pi * 100;
-
-  int i = std::min(int(lf),99);
-  int j = std::min(int(lt),99);
-
-  double dd1 = lf - i;
-  double dd2 = lt - j;
-  double de1 = 1 - dd1; 
-  double de2 = 1 - dd2;
-
-  *lmin = 0.0;
-  *lmin += de1*de2*M1_tables->hll_table_lambda_min(i  ,j  );
-  *lmin += dd1*de2*M1_tables->hll_table_lambda_min(i+1,j  );
-  *lmin += de1*dd2*M1_tables->hll_table_lambda_min(i  ,j+1);
-  *lmin += dd1*dd2*M1_tables->hll_table_lambda_min(i+1,j+1);
-
-  *lmax = 0.0;
-  *lmax += de1*de2*M1_tables->hll_table_lambda_max(i  ,j  );
-  *lmax += dd1*de2*M1_tables->hll_table_lambda_max(i+1,j  );
-  *lmax += de1*dd2*M1_tables->hll_table_lambda_max(i  ,j+1);
-  *lmax += dd1*dd2*M1_tables->hll_table_lambda_max(i+1,j+1);
+  // the interpolation weights in f are shared by all angles
+  const double lf = f*100;
+  const int i = std::min(int(lf),99);
+  const double dd1 = lf - i;
+  const double de1 = 1 - dd1;
+
+  const double * tmin = hll_table_lambda_min_.data();
+  const double * tmax = hll_table_lambda_max_.data();
+
+  for (int axis=0; axis<3; axis++) {
+    const double lt = theta[axis]/cello::pi * 100;
+    const int j = std::min(int(lt),99);
+    const double dd2 = lt - j;
+    const double de2 = 1 - dd2;
+
+    const int k00 = 100*i+j;
+    const int k10 = k00 + 100;
+
+    double l = 0.0;
+    l += de1*de2*tmin[k00  ];
+    l += dd1*de2*tmin[k10  ];
+    l += de1*dd2*tmin[k00+1];
+    l += dd1*dd2*tmin[k10+1];
+    lmin[axis*stride] = l;
+
+    l = 0.0;
+    l += de1*de2*tmax[k00  ];
+    l += dd1*de2*tmax[k10  ];
+    l += de1*dd2*tmax[k00+1];
+    l += dd1*dd2*tmax[k10+1];
+    lmax[axis*stride] = l;
+  }
 }
 
 //----------------------------------------------------------------------
 
-double EnzoMethodM1Closure::flux_function (double U_l, double U_lplus1,
-					    double Q_l, double Q_lplus1, double clight,
-                                            double lmin, double lmax,  
-					    std::string type) throw()
-{
-  // returns face-flux of a cell at index idx
-  if (type == "GLF") {
-    return 0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) ); 
-  }
+namespace {
 
-  else if (type == "HLL") {
-    return (lmax*Q_l - lmin*Q_lplus1 + lmax*lmin*clight*(U_lplus1-U_l)) / (lmax - lmin);
+  /// face flux between cells l and l+1: HLL, or GLF if HLL is false
+  template <bool HLL>
+  inline double m1_flux (double U_l, double U_lplus1,
+                         double Q_l, double Q_lplus1,
+                         double clight, double lmin, double lmax)
+  {
+    if (HLL) {
+      return (lmax*Q_l - lmin*Q_lplus1 + lmax*lmin*clight*(U_lplus1-U_l)) / (lmax - lmin);
+    } else {
+      return 0.5*(  Q_l+Q_lplus1 - clight*(U_lplus1-U_l) );
+    }
   }
 
-  else {
-    ERROR("EnzoMethodM1Closure::flux_function",
-	     "flux_function type not recognized");
-    return 0.0; 
+  /// Q_{i-1/2} - Q_{i+1/2} along the axis with index increment d
+  template <bool HLL>
+  inline double m1_delta_q (const enzo_float * U, const enzo_float * Q,
+                            int i, int d, double clight,
+                            double lmin, double lmax)
+  {
+    return m1_flux<HLL>(U[i-d], U[i  ], Q[i-d], Q[i  ], clight, lmin, lmax) -
+           m1_flux<HLL>(U[i  ], U[i+d], Q[i  ], Q[i+d], clight, lmin, lmax);
   }
-}
-
-//--------------------------------------------------------------------------
-
-double EnzoMethodM1Closure::deltaQ_faces (double U_l, double U_lplus1, double U_lminus1,
-                                                  double Q_l, double Q_lplus1, double Q_lminus1,
-                                                  double clight, double lmin, double lmax, 
-                                                  std::string flux_type) throw()
-{
-  // calls flux_function(), and calculates Q_{i-1/2} - Q_{i+1/2}
-  
-  return flux_function(U_lminus1, U_l     , Q_lminus1, Q_l     , clight, lmin, lmax, flux_type) - 
-         flux_function(U_l      , U_lplus1, Q_l      , Q_lplus1, clight, lmin, lmax, flux_type); 
-}
-
-//--------------------------------------------------------------------------
 
-void EnzoMethodM1Closure::get_reduced_variables (double * chi, double (*n)[3], int i, double clight,
-                               enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz) throw()
-{
-  double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
-  double f = N[i] > 0 ? std::min(Fnorm / (clight*N[i] ), 1.0) : 0.0; // reduced flux ( 0 < f < 1)
-  *chi = (3 + 4*f*f) / (5 + 2*sqrt(4-3*f*f)); // isotropy measure (1/3 < chi < 1)
-  if (Fnorm > 0.0) {
-    (*n)[0] = Fx[i]/Fnorm;
-    (*n)[1] = Fy[i]/Fnorm; 
-    (*n)[2] = Fz[i]/Fnorm;
+  /// flux divergence of the n cells of a row starting at index i0,
+  /// given the HLL eigenvalues lmin[axis*n + k] and lmax[axis*n + k]
+  /// of each cell k along each axis (unused for GLF)
+  template <bool HLL>
+  void m1_update_row (int n, int i0, int idx, int idy, int idz,
+                      double dtx, double dty, double dtz, double clight,
+                      const enzo_float * N,  const enzo_float * Fx,
+                      const enzo_float * Fy, const enzo_float * Fz,
+                      enzo_float * const * P,
+                      const double * lmin, const double * lmax,
+                      double * N_update,  double * Fx_update,
+                      double * Fy_update, double * Fz_update)
+  {
+    const enzo_float * P00 = P[0];
+    const enzo_float * P10 = P[1];
+    const enzo_float * P01 = P[2];
+    const enzo_float * P11 = P[3];
+    const enzo_float * P02 = P[4];
+    const enzo_float * P12 = P[5];
+    const enzo_float * P20 = P[6];
+    const enzo_float * P21 = P[7];
+    const enzo_float * P22 = P[8];
+
+    for (int k=0; k<n; k++) {
+      const int i = i0 + k;
+      const double lmin_x = lmin[k], lmin_y = lmin[n+k], lmin_z = lmin[2*n+k];
+      const double lmax_x = lmax[k], lmax_y = lmax[n+k], lmax_z = lmax[2*n+k];
+
+      N_update[k] =
+        dtx * m1_delta_q<HLL>(N, Fx, i, idx, clight, lmin_x, lmax_x)
+        + dty * m1_delta_q<HLL>(N, Fy, i, idy, clight, lmin_y, lmax_y)
+        + dtz * m1_delta_q<HLL>(N, Fz, i, idz, clight, lmin_z, lmax_z);
+
+      Fx_update[k] =
+        dtx * m1_delta_q<HLL>(Fx, P00, i, idx, clight, lmin_x, lmax_x)
+        + dty * m1_delta_q<HLL>(Fx, P10, i, idy, clight, lmin_y, lmax_y)
+        + dtz * m1_delta_q<HLL>(Fx, P20, i, idz, clight, lmin_z, lmax_z);
+
+      Fy_update[k] =
+        dtx * m1_delta_q<HLL>(Fy, P01, i, idx, clight, lmin_x, lmax_x)
+        + dty * m1_delta_q<HLL>(Fy, P11, i, idy, clight, lmin_y, lmax_y)
+        + dtz * m1_delta_q<HLL>(Fy, P21, i, idz, clight, lmin_z, lmax_z);
+
+      Fz_update[k] =
+        dtx * m1_delta_q<HLL>(Fz, P02, i, idx, clight, lmin_x, lmax_x)
+        + dty * m1_delta_q<HLL>(Fz, P12, i, idy, clight, lmin_y, lmax_y)
+        + dtz * m1_delta_q<HLL>(Fz, P22, i, idz, clight, lmin_z, lmax_z);
+    }
   }
 
-  #ifdef DEBUG_PRINT_REDUCED_VARIABLES
-    CkPrintf("i = %d; N = %1.2e; Fx = %1.2e; Fy = %1.2e; Fz = %1.2e; f = %1.2e; chi = %1.2e; n=[%1.2e,%1.2e,%1.2e]\n", i, N[i], Fx[i], Fy[i], Fz[i], f, *chi, (*n)[0], (*n)[1], (*n)[2]); 
-  #endif
 }
 
 //--------------------------------------------------------------------------
 
 void EnzoMethodM1Closure::get_pressure_tensor (EnzoBlock * enzo_block, 
+                       enzo_float * const * P,
                        enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz, double clight) 
                        throw()
 {
@@ -828,18 +872,15 @@ void EnzoMethodM1Closure::get_pressure_tensor (EnzoBlock * enzo_block,
   int gx,gy,gz;
   field.ghost_depth(0,&gx, &gy, &gz);
 
-  // if rank >= 1
-  enzo_float * P00 = (enzo_float *) field.values("P00");
-  // if rank >= 2
-  enzo_float * P10 = (enzo_float *) field.values("P10");
-  enzo_float * P01 = (enzo_float *) field.values("P01");
-  enzo_float * P11 = (enzo_float *) field.values("P11");
-  // if rank >= 3
-  enzo_float * P02 = (enzo_float *) field.values("P02");
-  enzo_float * P12 = (enzo_float *) field.values("P12");
-  enzo_float * P20 = (enzo_float *) field.values("P20");
-  enzo_float * P21 = (enzo_float *) field.values("P21"); 
-  enzo_float * P22 = (enzo_float *) field.values("P22"); 
+  enzo_float * P00 = P[0];
+  enzo_float * P10 = P[1];
+  enzo_float * P01 = P[2];
+  enzo_float * P11 = P[3];
+  enzo_float * P02 = P[4];
+  enzo_float * P12 = P[5];
+  enzo_float * P20 = P[6];
+  enzo_float * P21 = P[7];
+  enzo_float * P22 = P[8];
 
   // Need to directly calculate pressure tensor elements 
   // one layer deep into the ghost zones because active cells
@@ -849,136 +890,38 @@ void EnzoMethodM1Closure::get_pressure_tensor (EnzoBlock * enzo_block,
   //
   // Note that we're actually storing c^P, since that's the actual
   // value that's being converted to a flux 
+  const double cc = clight * clight;
   for (int iz=gz-1; iz<mz-gz+1; iz++) { 
    for (int iy=gy-1; iy<my-gy+1; iy++) {
-    for (int ix=gx-1; ix<mx-gx+1; ix++) {
-      int i = INDEX(ix,iy,iz,mx,my); //index of current cell
-      double chi;
-      double n[3] = {0.0, 0.0, 0.0}; 
-      get_reduced_variables( &chi, &n, i, clight, 
-                            N, Fx, Fy, Fz);
-      double iterm = 0.5*(1.0-chi);   // identity term
-      double oterm = 0.5*(3.0*chi-1); // outer product term
-      double cc = clight * clight;
-      P00[i] = cc * N[i] * (oterm *n[0]*n[0] + iterm );
-      P10[i] = cc * N[i] *  oterm *n[1]*n[0];
-      P01[i] = cc * N[i] *  oterm *n[0]*n[1];
-      P11[i] = cc * N[i] * (oterm *n[1]*n[1] + iterm );
-      P02[i] = cc * N[i] *  oterm *n[0]*n[2];
-      P12[i] = cc * N[i] *  oterm *n[1]*n[2];
-      P20[i] = cc * N[i] *  oterm *n[2]*n[0];
-      P21[i] = cc * N[i] *  oterm *n[2]*n[1];
-      P22[i] = cc * N[i] * (oterm *n[2]*n[2] + iterm );
+    const int i0 = INDEX(gx-1,iy,iz,mx,my);
+    const int n = mx - 2*gx + 2;
+    for (int i=i0; i<i0+n; i++) {
+      // reduced variables: isotropy measure chi and flux direction n
+      const double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
+      const double f = N[i] > 0 ? std::min(Fnorm / (clight*N[i] ), 1.0) : 0.0; // reduced flux ( 0 < f < 1)
+      const double chi = (3 + 4*f*f) / (5 + 2*sqrt(4-3*f*f)); // isotropy measure (1/3 < chi < 1)
+      const double n0 = (Fnorm > 0.0) ? Fx[i]/Fnorm : 0.0;
+      const double n1 = (Fnorm > 0.0) ? Fy[i]/Fnorm : 0.0;
+      const double n2 = (Fnorm > 0.0) ? Fz[i]/Fnorm : 0.0;
+
+      const double iterm = 0.5*(1.0-chi);   // identity term
+      const double oterm = 0.5*(3.0*chi-1); // outer product term
+      const double ccN = cc * N[i];
+      P00[i] = ccN * (oterm *n0*n0 + iterm );
+      P10[i] = ccN *  oterm *n1*n0;
+      P01[i] = ccN *  oterm *n0*n1;
+      P11[i] = ccN * (oterm *n1*n1 + iterm );
+      P02[i] = ccN *  oterm *n0*n2;
+      P12[i] = ccN *  oterm *n1*n2;
+      P20[i] = ccN *  oterm *n2*n0;
+      P21[i] = ccN *  oterm *n2*n1;
+      P22[i] = ccN * (oterm *n2*n2 + iterm );
     }
    }
   }
 
 }
 
-//--------------------------------------------------------------------------
-
-
-void EnzoMethodM1Closure::get_U_update (EnzoBlock * enzo_block, double * N_update, 
-                       double * Fx_update, double * Fy_update, double * Fz_update, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
-                       double hx, double hy, double hz, double dt, double clight, 
-                       int i, int idx, int idy, int idz) throw()
-{
-  Field field = enzo_block->data()->field();
-  // if rank >= 1
-  enzo_float * P00 = (enzo_float *) field.values("P00");
-  // if rank >= 2
-  enzo_float * P10 = (enzo_float *) field.values("P10");
-  enzo_float * P01 = (enzo_float *) field.values("P01");
-  enzo_float * P11 = (enzo_float *) field.values("P11");
-  // if rank >= 3
-  enzo_float * P02 = (enzo_float *) field.values("P02");
-  enzo_float * P12 = (enzo_float *) field.values("P12");
-  enzo_float * P20 = (enzo_float *) field.values("P20");
-  enzo_float * P21 = (enzo_float *) field.values("P21"); 
-  enzo_float * P22 = (enzo_float *) field.values("P22"); 
-
-  // if using HLL flux function, compute eigenvalues here
-  std::string flux_type = this->flux_function_;
-
-  // HLL min and max eigenvalues
-  // +/- clight corresponds to GLF flux function
-  double lmin_x = -1.0, lmin_y = -1.0, lmin_z = -1.0;
-  double lmax_x =  1.0, lmax_y =  1.0, lmax_z =  1.0;
-
-  if (flux_type == "HLL") {
-    double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
-    double f = std::min(Fnorm / (N[i]*clight), 1.0);
-
-    double theta_x = acos(std::min(Fx[i] / Fnorm, -1.0));
-    double theta_y = acos(std::min(Fy[i] / Fnorm, -1.0));
-    double theta_z = acos(std::min(Fz[i] / Fnorm, -1.0));
-
-    compute_hll_eigenvalues(f, theta_x, &lmin_x, &lmax_x, clight);
-    compute_hll_eigenvalues(f, theta_y, &lmin_y, &lmax_y, clight);
-    compute_hll_eigenvalues(f, theta_z, &lmin_z, &lmax_z, clight);
-  } 
-  
-  // if rank >= 1
-  *N_update += dt/hx * deltaQ_faces( N[i],  N[i+idx],  N[i-idx],
-                                   Fx[i], Fx[i+idx], Fx[i-idx], clight, lmin_x, lmax_x, flux_type );
-    
-  *Fx_update += dt/hx * deltaQ_faces(Fx[i], Fx[i+idx], Fx[i-idx],
-                                   P00[i],
-                                   P00[i+idx],
-                                   P00[i-idx], clight, lmin_x, lmax_x, flux_type );
-
-  // if rank >= 2
-  *N_update += dt/hy * deltaQ_faces( N[i],  N[i+idy],  N[i-idy],
-                                   Fy[i], Fy[i+idy], Fy[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-  *Fx_update += dt/hy * deltaQ_faces(Fx[i], Fx[i+idy], Fx[i-idy],
-                                   P10[i],
-                                   P10[i+idy],
-                                   P10[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-  *Fy_update += dt/hx * deltaQ_faces(Fy[i], Fy[i+idx], Fy[i-idx],
-                                   P01[i],
-                                   P01[i+idx],
-                                   P01[i-idx], clight, lmin_x, lmax_x, flux_type );
-
-  *Fy_update += dt/hy * deltaQ_faces(Fy[i], Fy[i+idy], Fy[i-idy],
-                                   P11[i],
-                                   P11[i+idy],
-                                   P11[i-idy], clight, lmin_y, lmax_y, flux_type );
-
-
-   // if rank >= 3
-  *N_update += dt/hz * deltaQ_faces( N[i],  N[i+idz],  N[i-idz],
-                                   Fz[i], Fz[i+idz], Fz[i-idz], clight, lmin_z, lmax_z, flux_type );
-
-  *Fx_update += dt/hz * deltaQ_faces(Fx[i], Fx[i+idz], Fx[i-idz],
-                                   P20[i],
-                                   P20[i+idz],
-                                   P20[i-idz], clight, lmin_z, lmax_z, flux_type );
-
-  *Fy_update += dt/hz * deltaQ_faces(Fy[i], Fy[i+idz], Fy[i-idz],
-                                   P21[i],
-                                   P21[i+idz],
-                                   P21[i-idz], clight, lmin_z, lmax_z, flux_type);
-
-  *Fz_update += dt/hx * deltaQ_faces(Fz[i], Fz[i+idx], Fz[i-idx],
-                                   P02[i],
-                                   P02[i+idx],
-                                   P02[i-idx], clight, lmin_x, lmax_x, flux_type);
-
-  *Fz_update += dt/hy * deltaQ_faces(Fz[i], Fz[i+idy], Fz[i-idy],
-                                   P12[i],
-                                   P12[i+idy],
-                                   P12[i-idy], clight, lmin_y, lmax_y, flux_type);
-
-  *Fz_update += dt/hz * deltaQ_faces(Fz[i], Fz[i+idz], Fz[i-idz],
-                                   P22[i],
-                                   P22[i+idz],
-                                   P22[i-idz], clight, lmin_z, lmax_z, flux_type);
-
-}
-
 //----------------------------------
 
 double EnzoMethodM1Closure::sigma_vernier (double energy, int type) throw()
@@ -1112,6 +1055,21 @@ void EnzoMethodM1Closure::get_photoionization_and_heating_rates (EnzoBlock * enz
   }
 
   int N_species = 3; // HI, HeI, HeII
+
+  // group cross sections and energies, looked up once rather than per cell
+  std::vector<double> sigmaN_ij(this->N_groups_*N_species); // cm^2
+  std::vector<double> sigmaE_ij(this->N_groups_*N_species); // cm^2
+  std::vector<double> eps_i(this->N_groups_);               // erg
+  for (int igroup=0; igroup<this->N_groups_; igroup++) {
+    eps_i[igroup] = *(scalar.value( scalar.index( eps_string(igroup) )));
+    for (int j=0; j<N_species; j++) {
+      sigmaN_ij[j*this->N_groups_ + igroup] =
+        *(scalar.value( scalar.index( sigN_string(igroup,j) )));
+      sigmaE_ij[j*this->N_groups_ + igroup] =
+        *(scalar.value( scalar.index( sigE_string(igroup,j) )));
+    }
+  }
+
   // loop through cells
   for (int i=0; i<mx*my*mz; i++) {
     double nHI = std::max(HI_density[i] * rhounit / mH, 1e-20); // cgs 
@@ -1119,9 +1077,9 @@ void EnzoMethodM1Closure::get_photoionization_and_heating_rates (EnzoBlock * enz
     for (int j=0; j<N_species; j++) { //loop over species
       double ionization_rate = 0.0;
       for (int igroup=0; igroup<this->N_groups_; igroup++) { //loop over groups
-        double sigmaN = *(scalar.value( scalar.index( sigN_string(igroup,j) ))); // cm^2 
-        double sigmaE = *(scalar.value( scalar.index( sigE_string(igroup,j) ))); // cm^2
-        double eps    = *(scalar.value( scalar.index(  eps_string(igroup  ) ))); // erg 
+        double sigmaN = sigmaN_ij[j*this->N_groups_ + igroup];
+        double sigmaE = sigmaE_ij[j*this->N_groups_ + igroup];
+        double eps    = eps_i[igroup];
 
         double N_i = (photon_densities[igroup])[i] * Nunit; // cm^-3
         double n_j = (chemistry_fields[j])[i] * rhounit / masses[j]; //number density of species j
@@ -1141,9 +1099,9 @@ void EnzoMethodM1Closure::get_photoionization_and_heating_rates (EnzoBlock * enz
   // H2 photodissociation from LW radiation
   if (this->H2_photodissociation_) {
     enzo_float * RT_H2_photodissociation_rate = (enzo_float *) field.values("RT_H2_dissociation_rate");
+    double sigmaN = *(scalar.value( scalar.index( sigN_string(0,3) ))); // cm^2 
     for (int i=0; i<mx*my*mz; i++) {
       double N = (photon_densities[0])[i] * Nunit; // LW-group assumed to be group 0
-      double sigmaN = *(scalar.value( scalar.index( sigN_string(0,3) ))); // cm^2 
       RT_H2_photodissociation_rate[i] = sigmaN*clight*N * tunit;
     }
   }
@@ -1241,16 +1199,23 @@ int EnzoMethodM1Closure::get_b_boolean (double E_lower, double E_upper, int spec
 
 //---------------------------------
 
-double EnzoMethodM1Closure::C_add_recombination (EnzoBlock * enzo_block,
-                                                enzo_float * T, int i, int igroup,
-                                                double E_lower, double E_upper) throw()
+void EnzoMethodM1Closure::get_recombination_rates (EnzoBlock * enzo_block,
+                                                    enzo_float * T,
+                                                    std::vector<double> & rate) throw()
 {
-  // update photon_density to account for recombination
-  // 2nd half of eq 25, using backwards-in-time quantities for all variables.
-  // this is called once for each group.
+  // photon creation rate from recombination for each species j,
+  // (alpha_A - alpha_B) n_j n_e, using backwards-in-time quantities for
+  // all variables (2nd half of eq 25).  This does not depend on the
+  // photon group, so it is computed once for all groups and combined
+  // with get_b_boolean() for each group.  Stored as rate[j*m + i].
 
   Field field = enzo_block->data()->field();
-  if (! field.is_field("density")) return 0.0;
+  int mx,my,mz;  
+  field.dimensions(0,&mx, &my, &mz); //field dimensions, including ghost zones
+  int gx,gy,gz;
+  field.ghost_depth(0,&gx, &gy, &gz);
+
+  const int m = mx*my*mz;
 
   EnzoUnits * enzo_units = enzo::units();
   double rhounit = enzo_units->density();
@@ -1264,38 +1229,47 @@ double EnzoMethodM1Closure::C_add_recombination (EnzoBlock * enzo_block,
 
   std::vector<double> masses = {mH,4*mH, 4*mH};
 
-  double C = 0.0;
-  for (std::size_t j=0; j<chemistry_fields.size(); j++) {  
+  const int N_species = chemistry_fields.size();
+  rate.assign(N_species*m, 0.0);
+
+  for (int j=0; j<N_species; j++) {  
     enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
-     
-    int b = get_b_boolean(E_lower, E_upper, j);
+    double * rate_j = rate.data() + j*m;
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        for (int ix=gx; ix<mx-gx; ix++) {
+          int i = INDEX(ix,iy,iz,mx,my);
 
-    double alpha_A = get_alpha(T[i], j, 'A');  // cgs
-    double alpha_B = get_alpha(T[i], j, 'B');
+          double alpha_A = get_alpha(T[i], j, 'A');  // cgs
+          double alpha_B = get_alpha(T[i], j, 'B');
 
-    double n_j = density_j[i]*rhounit/masses[j];
-    double n_e = e_density[i]*rhounit/mH; // electrons have same mass as protons in code units
+          double n_j = density_j[i]*rhounit/masses[j];
+          double n_e = e_density[i]*rhounit/mH; // electrons have same mass as protons in code units
 
-    C += b*(alpha_A-alpha_B) * n_j*n_e / Cunit;
+          rate_j[i] = (alpha_A-alpha_B) * n_j*n_e / Cunit;
 
 #ifdef DEBUG_RECOMBINATION
-    CkPrintf("MethodM1Closure::C_add_recombination -- j=%d; alpha_A = %1.3e; alpha_B = %1.3e; n_j = %1.3e; n_e = %1.3e; b_boolean = %d\n", j, alpha_A, alpha_B, n_j, n_e, b);
+          CkPrintf("MethodM1Closure::get_recombination_rates -- j=%d; alpha_A = %1.3e; alpha_B = %1.3e; n_j = %1.3e; n_e = %1.3e\n", j, alpha_A, alpha_B, n_j, n_e);
 #endif
+        }
+      }
+    }
   }
-
-#ifdef DEBUG_RECOMBINATION
-  CkPrintf("MethodM1Closure::C_add_recombination -- [E_lower, E_upper] = [%.2f, %.2f]; dN_dt[i] = %1.3e; dt = %1.3e\n", E_lower, E_upper, C, enzo_block->dt);
-#endif 
-
-  return C;
 }
 
 //---------------------------------
 
-double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block, 
-                                             double clight, int i, int igroup) throw()
+void EnzoMethodM1Closure::get_attenuation_coefficients (EnzoBlock * enzo_block,
+                                                         double clight,
+                                                         std::vector<enzo_float *> & density,
+                                                         std::vector<double> & kappa) throw()
 {
-  // Attenuate radiation
+  // Attenuate radiation: the photon destruction rate of group igroup is
+  //
+  //    D = sum_j kappa[igroup*N_species + j] * density[j][i]  (code_time^-1)
+  //
+  // with kappa = clight*sigN_ij / m_j in code units, so the ScalarData
+  // cross sections are looked up once per block rather than per cell
 
   EnzoUnits * enzo_units = enzo::units();
   double rhounit = enzo_units->density();
@@ -1303,42 +1277,43 @@ double EnzoMethodM1Closure::D_add_attenuation ( EnzoBlock * enzo_block,
 
   Field field = enzo_block->data()->field();
 
-  if (! field.is_field("density")) return 0.0;
- 
   std::vector<std::string> chemistry_fields = {"HI_density", 
                                                "HeI_density", "HeII_density"};
 
   double mH = enzo_constants::mass_hydrogen;
   std::vector<double> masses = {mH,4*mH, 4*mH};
- 
-  Scalar<double> scalar = enzo_block->data()->scalar_double();
-  double D = 0.0;
-  for (std::size_t j=0; j<chemistry_fields.size(); j++) {  
-    enzo_float * density_j = (enzo_float *) field.values(chemistry_fields[j]);
-    double n_j = density_j[i]*rhounit / masses[j];     
-    double sigN_ij = *(scalar.value( scalar.index( sigN_string(igroup, j) )));
-    
-    D += n_j * clight*sigN_ij * tunit; // code_time^-1
 
-    #ifdef DEBUG_ATTENUATION
-      CkPrintf("[i,j]=[%d,%d]; sigN_ij=%1.2e; n_j=%1.2e; clight=%1.2e\n", igroup, j, sigN_ij, n_j, clight);
-    #endif
-  }
+  const int N_species = chemistry_fields.size();
+  density.resize(N_species);
+  kappa.resize(N_groups_*N_species);
+
+  Scalar<double> scalar = enzo_block->data()->scalar_double();
+  for (int j=0; j<N_species; j++) {  
+    density[j] = (enzo_float *) field.values(chemistry_fields[j]);
+    for (int igroup=0; igroup<N_groups_; igroup++) {
+      double sigN_ij = *(scalar.value( scalar.index( sigN_string(igroup, j) )));
+      kappa[igroup*N_species + j] = rhounit / masses[j] * clight*sigN_ij * tunit;
 
 #ifdef DEBUG_ATTENUATION
-    CkPrintf("i=%d; D=%e s^-1; dt = %e\n",i, D / tunit, enzo_block->dt*enzo_units->time());
-#endif 
-  return D; 
+      CkPrintf("[i,j]=[%d,%d]; sigN_ij=%1.2e; clight=%1.2e\n", igroup, j, sigN_ij, clight);
+#endif
+    }
+  }
 }
 
 //----------------------
 
-void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igroup ) throw()
+void EnzoMethodM1Closure::solve_transport_eqns ( EnzoBlock * enzo_block ) throw()
 {
   // Solve dU/dt + del[F(U)] = 0; F(U) = { (Fx,Fy,Fz), c^2 P }
   //                                U  = { N, (Fx,Fy,Fz) }
   // M1 closure: P_i = D_i * N_i, where D_i is the Eddington tensor for 
   // photon group i
+  //
+  // All photon groups are updated in one pass: field and scalar
+  // lookups, temporary arrays, and the group-independent parts of
+  // the matter interaction terms are set up once per block, so the
+  // per-group work is only the spatial sweeps below
 
   EnzoUnits * enzo_units = enzo::units();
 
@@ -1358,26 +1333,15 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
   const int idy = mx;
   const int idz = mx*my; 
 
-  // energy bounds for this group (leave in eV)
-  double E_lower = this->energy_lower_[igroup];
-  double E_upper = this->energy_upper_[igroup];
-  
-  std::string istring = std::to_string(igroup);
-  enzo_float * N  = (enzo_float *) field.values("photon_density_" + istring);
-  enzo_float * Fx = (enzo_float *) field.values("flux_x_" + istring);
-  enzo_float * Fy = (enzo_float *) field.values("flux_y_" + istring);
-  enzo_float * Fz = (enzo_float *) field.values("flux_z_" + istring);
-
-  enzo_float * T = (enzo_float *) field.values("temperature");
-
   const int m = mx*my*mz;
 
-  // extra copy of fields needed to store
-  // the evolved values until the end
-  enzo_float * Nnew  = new enzo_float[m]; 
-  enzo_float * Fxnew = new enzo_float[m];
-  enzo_float * Fynew = new enzo_float[m];
-  enzo_float * Fznew = new enzo_float[m];
+  // radiation pressure tensor, reused by each group in turn
+  const char * P_names[9] = {"P00","P10","P01","P11",
+                             "P02","P12","P20","P21","P22"};
+  enzo_float * P[9];
+  for (int k=0; k<9; k++) P[k] = (enzo_float *) field.values(P_names[k]);
+
+  enzo_float * T = (enzo_float *) field.values("temperature");
 
   double lunit = enzo_units->length();
   double tunit = enzo_units->time();
@@ -1389,93 +1353,180 @@ void EnzoMethodM1Closure::solve_transport_eqn ( EnzoBlock * enzo_block, int igro
   double hz = (zp-zm)/(mz-2*gz);
   double clight_cgs = this->clight_frac_*enzo_constants::clight;
   double clight_code = clight_cgs * tunit/lunit;
-  
-  for (int i=0; i<m; i++)
-  {
-    Nnew [i] = N [i];
-    Fxnew[i] = Fx[i];
-    Fynew[i] = Fy[i];
-    Fznew[i] = Fz[i];
-  }
-
 
-  //calculate the radiation pressure tensor
-  get_pressure_tensor(enzo_block, N, Fx, Fy, Fz, clight_code);
+  const bool hll = (this->flux_function_ == "HLL");
   
   double Nmin = this->min_photon_density_ / Nunit;
 
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-        int i = INDEX(ix,iy,iz,mx,my); //index of current cell
-        double N_update=0, Fx_update=0, Fy_update=0, Fz_update=0;
-      
-        get_U_update( enzo_block, &N_update, &Fx_update, &Fy_update, &Fz_update,
-                             N, Fx, Fy, Fz, hx, hy, hz, dt, clight_code,
-                             i, idx, idy, idz ); 
-        
-        // get updated fluxes
-        Fxnew[i] += Fx_update;
-        Fynew[i] += Fy_update;
-        Fznew[i] += Fz_update;
+  // interactions with matter
 
-        // now get updated photon densities
-        Nnew[i] = std::max(Nnew[i] + N_update, Nmin);
+  const bool has_density = field.is_field("density");
+  const bool attenuation = this->attenuation_ && has_density;
+  // Grackle does recombination chemistry, but doesn't
+  // do anything about the radiation that comes out of recombination
+  const bool recombination = this->recombination_radiation_ && has_density;
 
+  std::vector<enzo_float *> density;
+  std::vector<double> kappa;
+  if (attenuation) {
+    get_attenuation_coefficients(enzo_block, clight_cgs, density, kappa);
+  }
 
-      #ifdef DEBUG_TRANSPORT
-        CkPrintf("i = %d; N_update = %f; Fx_update = %f; Nnew[i] = %f; hx = %f; dt = %f \n", i, N_update, Fx_update, Nnew[i], hx, dt);
-      #endif
+  std::vector<double> rate;
+  if (recombination) {
+    get_recombination_rates(enzo_block, T, rate);
+  }
 
+  const int N_species = 3;
 
-        // add interactions with matter 
+  // extra copy of fields needed to store
+  // the evolved values until the end
+  std::vector<enzo_float> Nnew(m), Fxnew(m), Fynew(m), Fznew(m);
+
+  // per-row flux divergences, and HLL eigenvalues along each axis
+  // (+/- 1 corresponds to the GLF flux function)
+  const int nx = mx - 2*gx;
+  std::vector<double> N_update(nx), Fx_update(nx), Fy_update(nx), Fz_update(nx);
+  std::vector<double> lmin(3*nx, -1.0), lmax(3*nx, 1.0);
+
+  for (int igroup=0; igroup<N_groups_; igroup++) {
+
+    std::string istring = std::to_string(igroup);
+    enzo_float * N  = (enzo_float *) field.values("photon_density_" + istring);
+    enzo_float * Fx = (enzo_float *) field.values("flux_x_" + istring);
+    enzo_float * Fy = (enzo_float *) field.values("flux_y_" + istring);
+    enzo_float * Fz = (enzo_float *) field.values("flux_z_" + istring);
+
+    // attenuation coefficients and recombination switches for this group
+    const double * kappa_g = attenuation ? &kappa[igroup*N_species] : nullptr;
+    int b[N_species] = {0, 0, 0};
+    if (recombination) {
+      for (int j=0; j<N_species; j++) {
+        b[j] = get_b_boolean(energy_lower_[igroup], energy_upper_[igroup], j);
+      }
+    }
 
-        double C = 0.0; // photon creation term
-        double D = 0.0; // photon destruction term
+    // a group with no photons above the floor and no flux in or next to
+    // the block, and no recombination radiation, is unchanged by the
+    // update below, so it is skipped
+    if (! (recombination && (b[0] || b[1] || b[2])) &&
+        is_quiescent_(N, Fx, Fy, Fz, Nmin, mx, my, mz, gx, gy, gz)) {
+      continue;
+    }
 
-        if (this->attenuation_) {
-          D = D_add_attenuation(enzo_block, clight_cgs, i, igroup);
+    std::copy_n(N,  m, Nnew.begin());
+    std::copy_n(Fx, m, Fxnew.begin());
+    std::copy_n(Fy, m, Fynew.begin());
+    std::copy_n(Fz, m, Fznew.begin());
+
+    //calculate the radiation pressure tensor
+    get_pressure_tensor(enzo_block, P, N, Fx, Fy, Fz, clight_code);
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        const int i0 = INDEX(gx,iy,iz,mx,my);
+
+        // HLL eigenvalues of each cell in the row along each axis
+        if (hll) {
+          for (int k=0; k<nx; k++) {
+            const int i = i0 + k;
+            const double Fnorm = sqrt(Fx[i]*Fx[i] + Fy[i]*Fy[i] + Fz[i]*Fz[i]);
+            const double f = std::min(Fnorm / (N[i]*clight_code), 1.0);
+            const double theta[3] = {acos(std::min(Fx[i] / Fnorm, -1.0)),
+                                     acos(std::min(Fy[i] / Fnorm, -1.0)),
+                                     acos(std::min(Fz[i] / Fnorm, -1.0))};
+            M1_tables->hll_eigenvalues(f, theta, &lmin[k], &lmax[k], nx);
+          }
+          m1_update_row<true>
+            (nx, i0, idx, idy, idz, dt/hx, dt/hy, dt/hz, clight_code,
+             N, Fx, Fy, Fz, P, lmin.data(), lmax.data(),
+             N_update.data(), Fx_update.data(), Fy_update.data(), Fz_update.data());
+        } else {
+          m1_update_row<false>
+            (nx, i0, idx, idy, idz, dt/hx, dt/hy, dt/hz, clight_code,
+             N, Fx, Fy, Fz, P, lmin.data(), lmax.data(),
+             N_update.data(), Fx_update.data(), Fy_update.data(), Fz_update.data());
         }
 
-        if (this->recombination_radiation_) {
-          // update photon density due to recombinations
-          // Grackle does recombination chemistry, but doesn't
-          // do anything about the radiation that comes out of recombination
-          C = C_add_recombination(enzo_block, T, i, igroup, E_lower, E_upper);
-        }
+        for (int k=0; k<nx; k++) {
+          const int i = i0 + k;
+
+          // get updated fluxes
+          Fxnew[i] += Fx_update[k];
+          Fynew[i] += Fy_update[k];
+          Fznew[i] += Fz_update[k];
+
+          // now get updated photon densities
+          Nnew[i] = std::max(Nnew[i] + N_update[k], Nmin);
+
+#ifdef DEBUG_TRANSPORT
+          CkPrintf("i = %d; N_update = %f; Fx_update = %f; Nnew[i] = %f; hx = %f; dt = %f \n", i, N_update[k], Fx_update[k], Nnew[i], hx, dt);
+#endif
+
+          // add interactions with matter 
+
+          double C = 0.0; // photon creation term
+          double D = 0.0; // photon destruction term
+
+          if (attenuation) {
+            for (int j=0; j<N_species; j++) D += kappa_g[j] * density[j][i];
+          }
+
+          if (recombination) {
+            for (int j=0; j<N_species; j++) C += b[j] * rate[j*m + i];
+          }
         
-        // update radiation fields due to thermochemistry (see appendix A)
-        double mult = 1.0/(1+dt*D);
-        Nnew [i] = std::max((Nnew [i] + dt*C) * mult, Nmin);
-        Fxnew[i] = Fxnew[i] * mult;
-        Fynew[i] = Fynew[i] * mult;
-        Fznew[i] = Fznew[i] * mult;
-      }
+          // update radiation fields due to thermochemistry (see appendix A)
+          double mult = 1.0/(1+dt*D);
+          Nnew [i] = std::max((Nnew [i] + dt*C) * mult, Nmin);
+          Fxnew[i] = Fxnew[i] * mult;
+          Fynew[i] = Fynew[i] * mult;
+          Fznew[i] = Fznew[i] * mult;
+        }
+      } 
     } 
-  } 
   
-  // now copy values over  
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-        int i = INDEX(ix,iy,iz,mx,my); //index of current cell
-        N [i] = Nnew [i];
-        Fx[i] = Fxnew[i];
-        Fy[i] = Fynew[i];
-        Fz[i] = Fznew[i];
+    // now copy values over  
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        for (int ix=gx; ix<mx-gx; ix++) {
+          int i = INDEX(ix,iy,iz,mx,my); //index of current cell
+          N [i] = Nnew [i];
+          Fx[i] = Fxnew[i];
+          Fy[i] = Fynew[i];
+          Fz[i] = Fznew[i];
   
-        if ( isnan(N[i]) ) {
-          ERROR("EnzoMethodM1Closure::solve_transport_eqn()", 
-                "N[i] is NaN!\n");
+          if ( isnan(N[i]) ) {
+            ERROR("EnzoMethodM1Closure::solve_transport_eqns()", 
+                  "N[i] is NaN!\n");
+          }
         }
       }
-    }
-  } 
+    } 
+  }
+}
+
+//----------------------------------------------------------------------
 
-  delete [] Nnew;
-  delete [] Fxnew;
-  delete [] Fynew;
-  delete [] Fznew;
+bool EnzoMethodM1Closure::is_quiescent_
+(const enzo_float * N,  const enzo_float * Fx,
+ const enzo_float * Fy, const enzo_float * Fz, double Nmin,
+ int mx, int my, int mz, int gx, int gy, int gz) throw()
+{
+  // the update of the active cells reads one layer of ghost zones
+  const enzo_float N_floor = Nmin;
+  for (int iz=gz-1; iz<mz-gz+1; iz++) {
+    for (int iy=gy-1; iy<my-gy+1; iy++) {
+      const int i0 = INDEX(gx-1,iy,iz,mx,my);
+      const int n = mx - 2*gx + 2;
+      bool active = false;
+      for (int i=i0; i<i0+n; i++) {
+        active |= (N[i] != N_floor) | (Fx[i] != 0.0) | (Fy[i] != 0.0) | (Fz[i] != 0.0);
+      }
+      if (active) return false;
+    }
+  }
+  return true;
 }
 
 //----------------------------------------------------------------------
@@ -1731,13 +1782,10 @@ void EnzoMethodM1Closure::call_solve_transport_eqn(EnzoBlock * enzo_block) throw
 {
   EnzoUnits * enzo_units = enzo::units();
 
-  int N_groups = this->N_groups_;
   double clight = this->clight_frac_ * enzo_constants::clight;
 
-  // loop through groups and solve transport equation for each group
-  for (int igroup=0; igroup<N_groups; igroup++) {
-    this->solve_transport_eqn(enzo_block, igroup);
-  }
+  // solve transport equation for all groups
+  this->solve_transport_eqns(enzo_block);
 
   if (this->thermochemistry_) {
     // Calculate photoheating and photoionization rates.
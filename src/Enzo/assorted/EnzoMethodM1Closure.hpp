@@ -26,6 +26,12 @@ public:
   double hll_table_col3       (int i, int j) const throw() { return hll_table_col3_[100*i+j]; }
   double hll_table_col4       (int i, int j) const throw() { return hll_table_col4_[100*i+j]; }
 
+  /// interpolate the minimum and maximum HLL eigenvalues at reduced
+  /// flux f for the angles theta[3] along each axis, into
+  /// lmin[axis*stride] and lmax[axis*stride]
+  void hll_eigenvalues (double f, const double * theta,
+                        double * lmin, double * lmax, int stride) const throw();
+
 private:
   void read_hll_eigenvalues(std::string hll_file) throw(); 
  
@@ -85,8 +91,6 @@ public: // interface
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
 
-  ~EnzoMethodM1Closure()
-  { if (M1_tables != nullptr) { delete M1_tables; } }
   
   /// Apply the method to advance a block one timestep 
   virtual void compute( Block * block) throw();
@@ -101,7 +105,8 @@ public: // interface
   //--------- CONTROL FLOW --------
   //  compute_ -> call_inject_photons -> inject_photons ->
   //  refresh -> call_solve_transport_eqn -> 
-  //  solve_transport_eqn, C_add_recombination, D_add_attenuation, 
+  //  solve_transport_eqns, get_recombination_rates,
+  //    get_attenuation_coefficients, 
   //    get_photoionization_and_heating_rates 
 
 
@@ -203,49 +208,45 @@ protected: // methods
   //--------- TRANSPORT STEP --------
 
 
-  double flux_function (double U_l, double U_lplus1,
-                        double Q_l, double Q_lplus1,
-                        double clight, double lmin, double lmax, std::string type) throw();
-
-  void compute_hll_eigenvalues(double f, double theta, double * lmin, double * lmax, double clight) throw();
-
-  double deltaQ_faces (double U_l, double U_lplus1, double U_lminus1, 
-                       double Q_l, double Q_lplus1, double Q_lminus1,
-                       double clight, double lmin, double lmax, std::string flux_type) throw();
-
-  void get_reduced_variables (double * chi_idx, double (*n_idx)[3], int i, double clight,
-                              enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz) 
-                              throw(); 
-
+  /// compute the (c^2 scaled) pressure tensor P[0..8] = P00, P10, P01,
+  /// P11, P02, P12, P20, P21, P22 of one photon group
   void get_pressure_tensor (EnzoBlock * enzo_block, 
+                       enzo_float * const * P,
                        enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
                        double clight) throw();
 
-  void get_U_update (EnzoBlock * enzo_block, double * N_update, 
-                       double * Fx_update, double * Fy_update, double * Fz_update, 
-                       enzo_float * N, enzo_float * Fx, enzo_float * Fy, enzo_float * Fz,
-                       double hx, double hy, double hz, double dt, double clight, 
-                       int i, int idx, int idy, int idz) throw();
+  /// solve the transport equation for all photon groups in one pass
+  void solve_transport_eqns (EnzoBlock * enzo_block) throw();
 
-  void solve_transport_eqn (EnzoBlock * enzo_block, int igroup) throw();
+  /// whether a photon group is at the density floor Nmin with no flux
+  /// in the active cells and the first layer of ghost zones around
+  /// them, where its transport update has no effect
+  static bool is_quiescent_ (const enzo_float * N,  const enzo_float * Fx,
+                             const enzo_float * Fy, const enzo_float * Fz,
+                             double Nmin, int mx, int my, int mz,
+                             int gx, int gy, int gz) throw();
 
   void add_LWB (EnzoBlock * enzo_block, double J21);
 
   //---------- THERMOCHEMISTRY STEP ------------
   // Interaction with matter is completely local, so don't need a refresh before this step
 
-  /// computes the photon-loss term from attenuation by local gas
-  double D_add_attenuation ( EnzoBlock * enzo_block, double clight, int i, int igroup) throw(); 
+  /// computes the coefficients of the photon-loss term from attenuation
+  /// by local gas for all groups: D = sum_j kappa[igroup*3+j]*density[j][i]
+  void get_attenuation_coefficients (EnzoBlock * enzo_block, double clight,
+                                     std::vector<enzo_float *> & density,
+                                     std::vector<double> & kappa) throw();
 
-  /// helper function used in C_add_recombination
+  /// helper function used in get_recombination_rates
   double get_alpha (double T, int species, char rec_case) throw();
 
-  /// helper function used in C_add_recombination
+  /// helper function used with get_recombination_rates
   int get_b_boolean (double E_lower, double E_upper, int species) throw();
 
-  /// computes the photon-creation term from recombination in local gas
-  double C_add_recombination (EnzoBlock * enzo_block, 
-                              enzo_float * T, int i, int igroup, double E_lower, double E_uppe) throw();
+  /// computes the group-independent photon-creation rate from
+  /// recombination in local gas for each species, rate[j*m + i]
+  void get_recombination_rates (EnzoBlock * enzo_block, enzo_float * T,
+                                std::vector<double> & rate) throw();
 
   /// Computes the photoionization cross-section of particles in a given gas
   /// species (specified by type) and for photons of energy E
@@ -303,8 +304,9 @@ protected: // attributes
   /// Refresh id's
   int ir_injection_;
 
-  /// Tables relevant to M1 closure method
-  M1Tables * M1_tables;
+  /// Tables relevant to M1 closure method, shared by all PEs of the
+  /// process
+  std::shared_ptr<const M1Tables> M1_tables;
 };
 
 
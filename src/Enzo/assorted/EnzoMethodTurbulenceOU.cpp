@@ -0,0 +1,405 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodTurbulenceOU.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implements the EnzoMethodTurbulenceOU class
+
+#include "Enzo/assorted/assorted.hpp"
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+
+#include <random>
+
+//----------------------------------------------------------------------
+
+EnzoMethodTurbulenceOU::EnzoMethodTurbulenceOU (ParameterGroup p)
+  : Method(),
+    k_min_(p.value_float("k_min",1.0)),
+    k_max_(p.value_float("k_max",3.0)),
+    amplitude_(p.value_float("amplitude",1.0)),
+    correlation_time_(p.value_float("correlation_time",1.0)),
+    update_interval_(p.value_float("update_interval",0.0)),
+    solenoidal_weight_(p.value_float("solenoidal_weight",1.0)),
+    seed_(p.value_integer("seed",1)),
+    sigma_(0.0),
+    mode_k_(),
+    mode_amp_(),
+    update_index_(-1)
+{
+  const int rank = cello::rank();
+
+  ASSERT2 ("EnzoMethodTurbulenceOU::EnzoMethodTurbulenceOU()",
+           "k_min = %g and k_max = %g must satisfy 0 < k_min <= k_max",
+           k_min_,k_max_, (0.0 < k_min_ && k_min_ <= k_max_));
+  ASSERT1 ("EnzoMethodTurbulenceOU::EnzoMethodTurbulenceOU()",
+           "correlation_time = %g must be positive",
+           correlation_time_, (correlation_time_ > 0.0));
+  ASSERT1 ("EnzoMethodTurbulenceOU::EnzoMethodTurbulenceOU()",
+           "solenoidal_weight = %g must be between 0 and 1",
+           solenoidal_weight_,
+           (0.0 <= solenoidal_weight_ && solenoidal_weight_ <= 1.0));
+  ASSERT ("EnzoMethodTurbulenceOU::EnzoMethodTurbulenceOU()",
+          "solenoidal_weight must be less than 1 in one dimension",
+          (rank > 1 || solenoidal_weight_ < 1.0));
+
+  if (update_interval_ <= 0.0) update_interval_ = correlation_time_ / 16.0;
+
+  // Enumerate one of each pair of wavenumbers +k and -k, since the
+  // cos and sin parts of +k already cover -k
+
+  const int kn = int(k_max_);
+  const int ky_max = (rank >= 2) ? kn : 0;
+  const int kz_max = (rank >= 3) ? kn : 0;
+  for (int kz=-kz_max; kz<=kz_max; kz++) {
+    for (int ky=-ky_max; ky<=ky_max; ky++) {
+      for (int kx=-kn; kx<=kn; kx++) {
+        const bool is_half = (kx > 0) || (kx == 0 && ky > 0) ||
+          (kx == 0 && ky == 0 && kz > 0);
+        const double k = sqrt(double(kx*kx + ky*ky + kz*kz));
+        if (is_half && k_min_ <= k && k <= k_max_) {
+          mode_k_.push_back(kx);
+          mode_k_.push_back(ky);
+          mode_k_.push_back(kz);
+        }
+      }
+    }
+  }
+
+  const int num_modes = mode_k_.size() / 3;
+
+  ASSERT2 ("EnzoMethodTurbulenceOU::EnzoMethodTurbulenceOU()",
+           "No wavenumbers between k_min = %g and k_max = %g",
+           k_min_,k_max_, (num_modes > 0));
+
+  // Each mode contributes sigma^2 * w to the mean squared
+  // acceleration, where w is the variance retained by the projection
+  // onto the solenoidal and compressive parts
+
+  const double zeta = solenoidal_weight_;
+  const double w = zeta*zeta*(rank - 1) + (1.0 - zeta)*(1.0 - zeta);
+  sigma_ = amplitude_ / sqrt(num_modes * w);
+
+  mode_amp_.resize(6*num_modes,0.0);
+
+  cello::define_field("density");
+  cello::define_field("total_energy");
+  cello::define_field("velocity_x");
+  if (rank >= 2) cello::define_field("velocity_y");
+  if (rank >= 3) cello::define_field("velocity_z");
+
+  // Initialize default Refresh object
+
+  cello::simulation()->refresh_set_name(ir_post_,name());
+  Refresh * refresh = cello::refresh(ir_post_);
+  refresh->add_field("total_energy");
+  refresh->add_field("velocity_x");
+  if (rank >= 2) refresh->add_field("velocity_y");
+  if (rank >= 3) refresh->add_field("velocity_z");
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulenceOU::pup (PUP::er &p)
+{
+
+  // NOTE: change this function whenever attributes change
+
+  TRACEPUP;
+
+  Method::pup(p);
+
+  p | k_min_;
+  p | k_max_;
+  p | amplitude_;
+  p | correlation_time_;
+  p | update_interval_;
+  p | solenoidal_weight_;
+  p | seed_;
+  p | sigma_;
+  p | mode_k_;
+  p | mode_amp_;
+  p | update_index_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulenceOU::compute ( Block * block) throw()
+{
+  if (block->is_leaf()) {
+
+    update_modes_ (block->time());
+
+    Field field = block->data()->field();
+
+    const int rank = cello::rank();
+    enzo_float * te = (enzo_float *) field.values ("total_energy");
+    enzo_float * v3[3] = {
+      (enzo_float *) field.values ("velocity_x"),
+      (rank >= 2) ? (enzo_float *) field.values ("velocity_y") : nullptr,
+      (rank >= 3) ? (enzo_float *) field.values ("velocity_z") : nullptr };
+
+    int mx,my,mz;
+    int gx,gy,gz;
+    field.dimensions  (field.field_id("density"),&mx,&my,&mz);
+    field.ghost_depth (field.field_id("density"),&gx,&gy,&gz);
+    const int nx = mx - 2*gx;
+    const int ny = my - 2*gy;
+    const int nz = mz - 2*gz;
+
+    std::vector<double> a3[3];
+    acceleration_ (block,a3);
+
+    const double dt = block->dt();
+
+    for (int iz=0; iz<nz; iz++) {
+      for (int iy=0; iy<ny; iy++) {
+        for (int ix=0; ix<nx; ix++) {
+          const int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+          const int ia = ix + nx*(iy + ny*iz);
+          // specific energy change from v -> v + a dt
+          double de = 0.0;
+          for (int axis=0; axis<rank; axis++) {
+            const double dv = a3[axis][ia]*dt;
+            de += (v3[axis][i] + 0.5*dv)*dv;
+            v3[axis][i] += dv;
+          }
+          te[i] += de;
+        }
+      }
+    }
+  }
+
+  block->compute_done();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulenceOU::stopping_values
+(Block * block,
+ std::vector<double> & values_min,
+ std::vector<double> & values_max,
+ std::vector<double> & values_sum) throw()
+{
+  // Every Block appends the same number of values: kinetic energy
+  // and mass, zero for non-leaf Blocks
+
+  double ke = 0.0;
+  double mass = 0.0;
+
+  if (block->is_leaf()) {
+
+    Field field = block->data()->field();
+
+    const int rank = cello::rank();
+    enzo_float * d  = (enzo_float *) field.values ("density");
+    enzo_float * v3[3] = {
+      (enzo_float *) field.values ("velocity_x"),
+      (rank >= 2) ? (enzo_float *) field.values ("velocity_y") : nullptr,
+      (rank >= 3) ? (enzo_float *) field.values ("velocity_z") : nullptr };
+
+    int mx,my,mz;
+    int gx,gy,gz;
+    field.dimensions  (field.field_id("density"),&mx,&my,&mz);
+    field.ghost_depth (field.field_id("density"),&gx,&gy,&gz);
+
+    double hx,hy,hz;
+    block->cell_width(&hx,&hy,&hz);
+    const double dv = hx * ((rank >= 2) ? hy : 1.0) * ((rank >= 3) ? hz : 1.0);
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        for (int ix=gx; ix<mx-gx; ix++) {
+          const int i = ix + mx*(iy + my*iz);
+          double v2 = 0.0;
+          for (int axis=0; axis<rank; axis++) v2 += v3[axis][i]*v3[axis][i];
+          ke   += 0.5*d[i]*v2;
+          mass += d[i];
+        }
+      }
+    }
+    ke   *= dv;
+    mass *= dv;
+  }
+
+  values_sum.push_back(ke);
+  values_sum.push_back(mass);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulenceOU::stopping_reduced
+(Block * block,
+ const double *& values_min,
+ const double *& values_max,
+ const double *& values_sum) throw()
+{
+  const double ke   = values_sum[0];
+  const double mass = values_sum[1];
+  values_sum += 2;
+
+  if (block->index().is_root()) {
+
+    // rms acceleration follows from the amplitudes, which are the
+    // same on every process
+
+    double a2 = 0.0;
+    for (size_t i=0; i<mode_amp_.size(); i++) {
+      a2 += 0.5*mode_amp_[i]*mode_amp_[i];
+    }
+
+    Monitor * monitor = cello::monitor();
+    monitor->print ("Method", "turbulence_ou kinetic energy %g",ke);
+    monitor->print ("Method", "turbulence_ou rms velocity %g",
+                    (mass > 0.0) ? sqrt(2.0*ke/mass) : 0.0);
+    monitor->print ("Method", "turbulence_ou rms acceleration %g",sqrt(a2));
+  }
+}
+
+//======================================================================
+
+void EnzoMethodTurbulenceOU::update_modes_ (double time) throw()
+{
+  const long long index = (long long) floor(time / update_interval_);
+
+  // processes that had no Blocks for some intervals catch up here,
+  // drawing the same numbers as every other process
+
+  if (update_index_ < 0) {
+    update_index_ = 0;
+    step_modes_ (0);
+  }
+  while (update_index_ < index) {
+    step_modes_ (++update_index_);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulenceOU::step_modes_ (long long index) throw()
+{
+  const int rank = cello::rank();
+  const int num_modes = mode_k_.size() / 3;
+
+  // the random stream depends only on the seed and interval index
+
+  std::seed_seq seq { seed_, int(index & 0x7fffffff), int(index >> 31) };
+  std::mt19937_64 generator (seq);
+  std::normal_distribution<double> normal (0.0,1.0);
+
+  // index 0 draws from the stationary distribution
+
+  const double f = (index == 0) ? 0.0 : exp(-update_interval_/correlation_time_);
+  const double s = sigma_*sqrt(1.0 - f*f);
+  const double zeta = solenoidal_weight_;
+
+  for (int m=0; m<num_modes; m++) {
+    const double k[3] = { double(mode_k_[3*m]),
+                          double(mode_k_[3*m+1]),
+                          double(mode_k_[3*m+2]) };
+    const double k2 = k[0]*k[0] + k[1]*k[1] + k[2]*k[2];
+    for (int part=0; part<2; part++) {
+      double xi[3] = {0.0, 0.0, 0.0};
+      for (int axis=0; axis<rank; axis++) xi[axis] = normal(generator);
+
+      // weight the solenoidal and compressive parts of the increment
+
+      const double kxi = (k[0]*xi[0] + k[1]*xi[1] + k[2]*xi[2]) / k2;
+      for (int axis=0; axis<3; axis++) {
+        const double par = k[axis]*kxi;
+        const double inc = zeta*(xi[axis] - par) + (1.0 - zeta)*par;
+        double & a = mode_amp_[6*m + 2*axis + part];
+        a = f*a + s*inc;
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodTurbulenceOU::acceleration_
+(Block * block, std::vector<double> a3[3]) throw()
+{
+  Field field = block->data()->field();
+
+  const int rank = cello::rank();
+  const int num_modes = mode_k_.size() / 3;
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions  (field.field_id("density"),&mx,&my,&mz);
+  field.ghost_depth (field.field_id("density"),&gx,&gy,&gz);
+  const int n3[3] = { mx - 2*gx, my - 2*gy, mz - 2*gz };
+
+  double lower[3], h3[3], dm[3], dp[3];
+  block->lower(lower,lower+1,lower+2);
+  block->cell_width(h3,h3+1,h3+2);
+  cello::hierarchy()->lower(dm,dm+1,dm+2);
+  cello::hierarchy()->upper(dp,dp+1,dp+2);
+
+  // one-dimensional tables of cos and sin(2 pi k x / L) at cell
+  // centers for k = 0 .. kn along each axis; -k follows by symmetry
+
+  const int kn = int(k_max_);
+  std::vector<double> c3[3], s3[3];
+  for (int axis=0; axis<3; axis++) {
+    const int n = n3[axis];
+    c3[axis].resize((kn+1)*n);
+    s3[axis].resize((kn+1)*n);
+    for (int i=0; i<n; i++) {
+      double theta = 0.0;
+      if (axis < rank) {
+        const double x = lower[axis] + (i + 0.5)*h3[axis];
+        theta = 2.0*cello::pi*(x - dm[axis]) / (dp[axis] - dm[axis]);
+      }
+      for (int k=0; k<=kn; k++) {
+        c3[axis][k*n+i] = cos(k*theta);
+        s3[axis][k*n+i] = sin(k*theta);
+      }
+    }
+  }
+
+  const int nx = n3[0];
+  const int ny = n3[1];
+  const int nz = n3[2];
+  for (int axis=0; axis<3; axis++) {
+    a3[axis].assign((axis < rank) ? nx*ny*nz : 0, 0.0);
+  }
+
+  // phase factor exp(i k.x) of each mode in the current (y,z) row
+
+  std::vector<double> yz_re(num_modes), yz_im(num_modes);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+
+      for (int m=0; m<num_modes; m++) {
+        const int ky = mode_k_[3*m+1];
+        const int kz = mode_k_[3*m+2];
+        const double cy = c3[1][std::abs(ky)*ny+iy];
+        const double sy = (ky < 0 ? -1.0 : 1.0)*s3[1][std::abs(ky)*ny+iy];
+        const double cz = c3[2][std::abs(kz)*nz+iz];
+        const double sz = (kz < 0 ? -1.0 : 1.0)*s3[2][std::abs(kz)*nz+iz];
+        yz_re[m] = cy*cz - sy*sz;
+        yz_im[m] = cy*sz + sy*cz;
+      }
+
+      for (int ix=0; ix<nx; ix++) {
+        const int i = ix + nx*(iy + ny*iz);
+        for (int m=0; m<num_modes; m++) {
+          // kx >= 0 for every mode
+          const int kx = mode_k_[3*m];
+          const double cx = c3[0][kx*nx+ix];
+          const double sx = s3[0][kx*nx+ix];
+          const double re = cx*yz_re[m] - sx*yz_im[m];
+          const double im = cx*yz_im[m] + sx*yz_re[m];
+          const double * amp = &mode_amp_[6*m];
+          for (int axis=0; axis<rank; axis++) {
+            a3[axis][i] += amp[2*axis]*re + amp[2*axis+1]*im;
+          }
+        }
+      }
+    }
+  }
+}
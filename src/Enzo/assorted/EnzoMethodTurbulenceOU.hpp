@@ -0,0 +1,128 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodTurbulenceOU.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of EnzoMethodTurbulenceOU
+///           Ornstein-Uhlenbeck spectral forcing for driven turbulence
+
+#ifndef ENZO_ENZO_METHOD_TURBULENCE_OU_HPP
+#define ENZO_ENZO_METHOD_TURBULENCE_OU_HPP
+
+class EnzoMethodTurbulenceOU : public Method {
+
+  /// @class    EnzoMethodTurbulenceOU
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Drive turbulence with a sum of Fourier modes
+  /// whose amplitudes follow an Ornstein-Uhlenbeck process
+  ///
+  /// The acceleration is a sum over wavenumbers k with k_min <= |k|
+  /// <= k_max of A_k cos(k.x) + B_k sin(k.x).  The amplitudes are
+  /// advanced at fixed intervals of simulation time from a random
+  /// stream keyed by the interval index, so every process evolves
+  /// identical amplitudes without communication, and a process that
+  /// had no Blocks for a while catches up exactly.  On each Block the
+  /// phases are built from one-dimensional cos/sin tables along each
+  /// axis, so no trigonometric functions are evaluated per cell.
+  /// Forcing statistics are added to the stopping reduction.
+
+public: // interface
+
+  /// Create a new EnzoMethodTurbulenceOU object
+  EnzoMethodTurbulenceOU(ParameterGroup p);
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMethodTurbulenceOU);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoMethodTurbulenceOU (CkMigrateMessage *m)
+    : Method (m),
+      k_min_(0.0),
+      k_max_(0.0),
+      amplitude_(0.0),
+      correlation_time_(0.0),
+      update_interval_(0.0),
+      solenoidal_weight_(0.0),
+      seed_(0),
+      sigma_(0.0),
+      mode_k_(),
+      mode_amp_(),
+      update_index_(-1)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Apply the method to advance a block one timestep
+  virtual void compute( Block * block) throw();
+
+  /// compute() does nothing on non-leaf Blocks
+  virtual bool leaf_only () const throw()
+  { return true; }
+
+  virtual std::string name () throw ()
+  { return "turbulence_ou"; }
+
+  /// Add kinetic energy, forcing power, and mass to the stopping
+  /// reduction
+  virtual void stopping_values (Block * block,
+                                std::vector<double> & values_min,
+                                std::vector<double> & values_max,
+                                std::vector<double> & values_sum) throw();
+
+  /// Print the reduced forcing statistics
+  virtual void stopping_reduced (Block * block,
+                                 const double *& values_min,
+                                 const double *& values_max,
+                                 const double *& values_sum) throw();
+
+protected: // methods
+
+  /// Advance the mode amplitudes to the interval containing time
+  void update_modes_ (double time) throw();
+
+  /// Advance the mode amplitudes by one interval, or draw the initial
+  /// amplitudes if index is 0
+  void step_modes_ (long long index) throw();
+
+  /// Compute the acceleration along each axis at the Block's interior
+  /// cells, in arrays of nx*ny*nz values
+  void acceleration_ (Block * block, std::vector<double> a3[3]) throw();
+
+protected: // attributes
+
+  /// Range of wavenumber magnitudes forced, in units of 2 pi / L
+  double k_min_;
+  double k_max_;
+
+  /// Target rms acceleration
+  double amplitude_;
+
+  /// Correlation time of the Ornstein-Uhlenbeck process
+  double correlation_time_;
+
+  /// Simulation time between updates of the mode amplitudes
+  double update_interval_;
+
+  /// Weight of the solenoidal part of the forcing, from 0
+  /// (compressive) to 1 (solenoidal)
+  double solenoidal_weight_;
+
+  /// Seed of the random stream
+  int seed_;
+
+  /// Standard deviation of each mode amplitude component
+  double sigma_;
+
+  /// Integer wavenumbers of the modes, 3 per mode
+  std::vector<int> mode_k_;
+
+  /// Amplitudes of the cos and sin parts of each mode, 6 per mode:
+  /// [cos x, sin x, cos y, sin y, cos z, sin z]
+  std::vector<double> mode_amp_;
+
+  /// Index of the update interval of mode_amp_, or -1 if not drawn
+  long long update_index_;
+};
+
+#endif /* ENZO_ENZO_METHOD_TURBULENCE_OU_HPP */
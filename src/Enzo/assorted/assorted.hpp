@@ -35,5 +35,6 @@
 #include "assorted/EnzoMethodHeat.hpp"
 #include "assorted/EnzoMethodM1Closure.hpp"
 #include "assorted/EnzoMethodTurbulence.hpp"
+#include "assorted/EnzoMethodTurbulenceOU.hpp"
 
 #endif /* ENZO_ASSORTED_ASSORTED_HPP */
@@ -71,6 +71,16 @@ void EnzoComputeCoolingTime::compute_(Block * block,
   ASSERT("EnzoComputeCoolingTime::compute_()",
          "Grackle must be enabled in order to compute the cooling time",
          grackle_method != nullptr);
+
+#ifdef CONFIG_USE_GRACKLE
+  // use the Block's cached grackle_field_data when possible
+  grackle_field_data cached_fields;
+  if ((grackle_fields == nullptr) && (i_hist_ == 0) &&
+      grackle_method->cached_grackle_fields(block, &cached_fields)) {
+    grackle_fields = &cached_fields;
+  }
+#endif
+
   grackle_method->calculate_cooling_time(EnzoFieldAdaptor(block, i_hist_), ct,
                                          0, grackle_fields);
 }
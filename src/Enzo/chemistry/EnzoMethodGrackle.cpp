@@ -39,7 +39,7 @@ GrackleChemistryData parse_chemistry(ParameterGroup p)
   //      be updated if we introduce additional parameters for configuring
   //      EnzoMethodGrackle)
   const std::unordered_set<std::string> ignore_leaf_names =
-    {"use_cooling_timestep", "radiation_redshift",
+    {"use_cooling_timestep", "radiation_redshift", "explicit_ratio",
      // the next option is deprecated and is only listed in the short-term
      // for backwards compatability (it should now be replaced by
      // "Physics:fluid_props:floors:metallicity")
@@ -113,11 +113,27 @@ EnzoMethodGrackle::EnzoMethodGrackle
                     // the next parameter is relevant when using cosmology
                     physics_cosmology_initial_redshift,
                     time),
-    use_cooling_timestep_(p.value_logical("use_cooling_timestep", false))
+    use_cooling_timestep_(p.value_logical("use_cooling_timestep", false)),
+    explicit_ratio_(p.value_float("explicit_ratio", 0.0))
 {
   // courant is only meaningful when use_cooling_timestep is true
   this->set_courant(p.value_float("courant", 1.0));
 
+  // loops over the block may be divided between tasks
+  this->set_num_tasks(p.value_integer("num_tasks", 1));
+
+  // only stiff cells are passed to Grackle when explicit_ratio > 0
+  ASSERT1("EnzoMethodGrackle::EnzoMethodGrackle",
+          "Method:grackle:explicit_ratio is %g, but must be 0 (disabled) "
+          "or at least 1",
+          explicit_ratio_,
+          (explicit_ratio_ == 0.0) || (explicit_ratio_ >= 1.0));
+  ASSERT("EnzoMethodGrackle::EnzoMethodGrackle",
+         "Method:grackle:explicit_ratio requires primordial_chemistry = 0, "
+         "since species are not updated in the explicitly updated cells",
+         (explicit_ratio_ == 0.0) ||
+         (try_get_chemistry()->get<int>("primordial_chemistry") == 0));
+
   // Gather list of fields that MUST be defined for this
   // method and check that they are permanent. If not,
   // define them.
@@ -125,12 +141,67 @@ EnzoMethodGrackle::EnzoMethodGrackle
   define_required_grackle_fields();
 
   /// Initialize default Refresh
+
   cello::simulation()->refresh_set_name(ir_post_,name());
   Refresh * refresh = cello::refresh(ir_post_);
   refresh->add_all_fields();
 
 }
 
+//----------------------------------------------------------------------
+
+void EnzoMethodGrackle::initialize_fields (bool overlap) throw()
+{
+  // Field ids are resolved here rather than in the constructor, since
+  // later Methods may define more color fields
+
+  const FieldDescr * field_descr = cello::field_descr();
+  Grouping * field_groups = cello::field_groups();
+  const int num_color = field_groups->size("color");
+
+  // Declare the fields modified by compute(), so that sparse
+  // refreshes (Method:<method>:sparse_refresh) can skip the others
+
+  this->add_output_field_(field_descr->field_id("internal_energy"));
+  this->add_output_field_(field_descr->field_id("total_energy"));
+  for (int i=0; i<num_color; i++) {
+    this->add_output_field_
+      (field_descr->field_id(field_groups->item("color",i)));
+  }
+
+  // Declare the fields read by compute(), so that it may run while an
+  // earlier independent Method waits (Method:<method>:overlap)
+
+  for (std::string field : {"density", "internal_energy", "total_energy",
+                            "velocity_x", "velocity_y", "velocity_z",
+                            "bfield_x", "bfield_y", "bfield_z",
+                            "metal_density",
+                            "specific_heating_rate",
+                            "volumetric_heating_rate",
+                            "RT_heating_rate", "RT_HI_ionization_rate",
+                            "RT_HeI_ionization_rate",
+                            "RT_HeII_ionization_rate"}) {
+    this->add_input_field_(field_descr->field_id(field));
+  }
+  for (int i=0; i<num_color; i++) {
+    this->add_input_field_
+      (field_descr->field_id(field_groups->item("color",i)));
+  }
+
+  // Refresh only the fields read by compute(), including ghost zones,
+  // when that may let it overlap an earlier Method; otherwise keep
+  // refreshing all fields
+
+  if (overlap) {
+    Refresh * refresh = cello::refresh(ir_post_);
+    refresh->clear_fields();
+    for (int id_field : input_field_list()) {
+      refresh->add_field(id_field);
+    }
+  }
+
+}
+
 //----------------------------------------------------------------------
  
 void EnzoMethodGrackle::define_required_grackle_fields
@@ -242,7 +313,11 @@ void EnzoMethodGrackle::compute ( Block * block) throw()
     if (simulation)
       simulation->performance()->start_region(perf_grackle,__FILE__,__LINE__);
 
-    this->compute_(block);
+    if (subcycle()) {
+      this->compute_subcycled(block);
+    } else {
+      this->compute_(block, block->time(), block->dt());
+    }
 
     if (simulation)
       simulation->performance()->stop_region(perf_grackle,__FILE__,__LINE__);
@@ -277,10 +352,12 @@ void EnzoMethodGrackle::update_grackle_density_fields(
          my_chemistry != nullptr);
 
   grackle_field_data tmp_grackle_fields;
+  EnzoFieldStaging staging(block);
   bool cleanup_grackle_fields = false;
   if (grackle_fields == nullptr){
     grackle_fields = &tmp_grackle_fields;
-    setup_grackle_fields(block, grackle_fields);
+    setup_grackle_fields(EnzoFieldAdaptor(block,0), grackle_fields, 0, false,
+                         &staging);
     cleanup_grackle_fields = true;
   }
 
@@ -346,6 +423,7 @@ void EnzoMethodGrackle::update_grackle_density_fields(
   }
 
   if (cleanup_grackle_fields){
+    staging.write_back();
     EnzoMethodGrackle::delete_grackle_fields(grackle_fields);
   }
 
@@ -356,7 +434,8 @@ void EnzoMethodGrackle::update_grackle_density_fields(
 
 //----------------------------------------------------------------------
 
-void EnzoMethodGrackle::compute_ ( Block * block) throw()
+void EnzoMethodGrackle::compute_
+( Block * block, double time, double dt) throw()
 {
 #ifndef CONFIG_USE_GRACKLE
   ERROR("EnzoMethodGrackle::compute_", "Enzo-E isn't linked to grackle");
@@ -376,15 +455,21 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
   // Solve chemistry
   // NOTE: should we set compute_time to `block->time() + 0.5*block->dt()`?
   //       I think that's what enzo-classic does...
-  double compute_time = block->time(); // only matters in cosmological sims
-  grackle_facade_.solve_chemistry(block, compute_time, block->dt());
+  double compute_time = time; // only matters in cosmological sims
+  grackle_facade_.solve_chemistry(block, compute_time, dt,
+                                  num_tasks(), explicit_ratio_);
 
   // now we have to do some extra-work after the fact (such as adjusting total
   // energy density and applying floors...)
 
-  // todo: avoid constructing this instance of grackle_fields
+  // (fields are only read, so staged copies aren't written back)
   grackle_field_data grackle_fields;
-  setup_grackle_fields(EnzoFieldAdaptor(block,0), &grackle_fields);
+  EnzoFieldStaging staging(block);
+  const bool is_cached = cached_grackle_fields(block, &grackle_fields);
+  if (! is_cached) {
+    setup_grackle_fields(EnzoFieldAdaptor(block,0), &grackle_fields, 0, false,
+                         &staging);
+  }
 
   Field field = block->data()->field();
 
@@ -429,7 +514,7 @@ void EnzoMethodGrackle::compute_ ( Block * block) throw()
     }
   }
 
-  delete_grackle_fields(&grackle_fields);
+  if (! is_cached) delete_grackle_fields(&grackle_fields);
 
   return;
 #endif // CONFIG_USE_GRACKLE
@@ -447,42 +532,18 @@ double EnzoMethodGrackle::timestep ( Block * block ) throw()
     enzo_float * cooling_time = field.is_field("cooling_time") ?
                         (enzo_float *) field.values("cooling_time") : NULL;
 
-    // make it if it doesn't exist
-    bool delete_cooling_time = false;
-    int gx,gy,gz;
-    field.ghost_depth (0,&gx,&gy,&gz);
-
-    int nx,ny,nz;
-    field.size (&nx,&ny,&nz);
-
-    int ngx = nx + 2*gx;
-    int ngy = ny + 2*gy;
-    int ngz = nz + 2*gz;
-
-    int size = ngx*ngy*ngz;
-
+    // use scratch space if it doesn't exist
     if (!(cooling_time)){
-      cooling_time = new enzo_float [size];
-      delete_cooling_time = true;
+      int mx,my,mz;
+      field.dimensions(field.field_id("density"),&mx,&my,&mz);
+      cooling_time_scratch_.resize(mx*my*mz);
+      cooling_time = cooling_time_scratch_.data();
     }
 
-    this->calculate_cooling_time(EnzoFieldAdaptor(block,0), cooling_time, 0);
-
-    // make sure to exclude the ghost zone. Because there is no refresh before
-    // this method is called (at least during the very first cycle) - this can
-    // including ghost zones can lead to timesteps of 0
-    for (int iz = gz; iz < ngz - gz; iz++) {   // if rank < 3: gz = 0, ngz = 1
-      for (int iy = gy; iy < ngy - gy; iy++) { // if rank < 2: gy = 0, ngy = 1
-        for (int ix = gx; ix < ngx - gx; ix++) {
-	  int i = INDEX(ix, iy, iz, ngx, ngy);
-          dt = std::min(enzo_float(dt), std::abs(cooling_time[i]));
-        }
-      }
-    }
-
-    if (delete_cooling_time){
-      delete [] cooling_time;
-    }
+    // ghost zones are excluded: because there is no refresh before this
+    // method is called (at least during the very first cycle) - including
+    // ghost zones can lead to timesteps of 0
+    dt = grackle_facade_.min_cooling_time(block, cooling_time);
   }
 
   return dt * courant_;
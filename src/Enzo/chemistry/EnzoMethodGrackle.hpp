@@ -44,7 +44,8 @@ public: // interface
   EnzoMethodGrackle (CkMigrateMessage *m)
     : Method (m),
       grackle_facade_(m),
-      use_cooling_timestep_(false)
+      use_cooling_timestep_(false),
+      explicit_ratio_(0.0)
   {  }
 
   /// CHARM++ Pack / Unpack function
@@ -57,17 +58,38 @@ public: // interface
     Method::pup(p);
     p | grackle_facade_;
     p | use_cooling_timestep_;
+    p | explicit_ratio_;
   }
 
   /// Apply the method to advance a block one timestep
   virtual void compute( Block * block) throw();
 
+  /// compute() does nothing on non-leaf Blocks
+  virtual bool leaf_only () const throw()
+  { return true; }
+
+  /// compute() calls compute_done() before returning
+  virtual bool compute_is_synchronous () const throw()
+  { return true; }
+
+  /// Declare the fields read by compute(), and refresh only those if
+  /// it may be overlapped
+  virtual void initialize_fields (bool overlap) throw();
+
   virtual std::string name () throw ()
   { return "grackle"; }
 
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+  /// Chemistry and cooling may be subcycled within each Block
+  virtual bool supports_subcycle () const throw()
+  { return true; }
+
+  /// Solve chemistry and cooling from time to time + dt
+  virtual void compute_source (Block * block, double time, double dt) throw()
+  { compute_(block, time, dt); }
+
   /// returns the stored instance of GrackleChemistryData, if the simulation is
   /// configured to actually use grackle
   ///
@@ -83,10 +105,12 @@ public: // interface
   void setup_grackle_fields(const EnzoFieldAdaptor& fadaptor,
                             grackle_field_data * grackle_fields,
                             int stale_depth = 0,
-                            bool omit_cell_width = false) const throw()
+                            bool omit_cell_width = false,
+                            EnzoFieldStaging * staging = nullptr) const throw()
   {
     grackle_facade_.setup_grackle_fields(fadaptor, grackle_fields,
-                                         stale_depth, omit_cell_width);
+                                         stale_depth, omit_cell_width,
+                                         staging);
   }
 
   void setup_grackle_fields(Block * block,
@@ -111,6 +135,14 @@ public: // interface
     grackle_facade_.delete_grackle_fields(grackle_fields);
   }
 
+  /// Copy the cached grackle_field_data of the Block's current fields, if
+  /// possible (see GrackleFacade::cached_grackle_fields)
+  bool cached_grackle_fields(Block * block,
+                             grackle_field_data * grackle_fields) const throw()
+  {
+    return grackle_facade_.cached_grackle_fields(block, grackle_fields);
+  }
+
 
   void enforce_metallicity_floor(Block * block) throw();
 
@@ -144,7 +176,7 @@ public: // interface
 
 protected: // methods
 
-  void compute_( Block * block) throw();
+  void compute_( Block * block, double time, double dt) throw();
 
 protected: // attributes
   /// the GrackleFacade instance provides an interface to all operations in the
@@ -152,6 +184,14 @@ protected: // attributes
   /// this is always correctly initialized
   GrackleFacade grackle_facade_;
   bool use_cooling_timestep_;
+
+  /// Cells whose cooling time exceeds this multiple of dt are updated
+  /// explicitly rather than by Grackle (0 if disabled)
+  double explicit_ratio_;
+
+  /// Cooling time of a Block in timestep() when there's no "cooling_time"
+  /// field (not packed)
+  std::vector<enzo_float> cooling_time_scratch_;
 };
 
 #endif /* ENZO_ENZO_METHOD_GRACKLE_HPP */
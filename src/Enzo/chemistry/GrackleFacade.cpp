@@ -22,6 +22,131 @@ extern "C" {
   struct code_units { int dummy; };
   struct chemistry_data_storage { int dummy; };
 }
+struct GrackleFieldCache { int dummy; };
+#else
+
+namespace {
+
+  /// Fields passed to Grackle by GrackleFacade::setup_grackle_fields
+  struct GrackleFieldEntry {
+    gr_float * grackle_field_data::* member;
+    const char * name;
+    bool require_exists;
+  };
+
+  const GrackleFieldEntry grackle_field_entries[] = {
+    { &grackle_field_data::density,         "density",         true },
+    { &grackle_field_data::internal_energy, "internal_energy", true },
+    { &grackle_field_data::x_velocity,      "velocity_x",      false },
+    { &grackle_field_data::y_velocity,      "velocity_y",      false },
+    { &grackle_field_data::z_velocity,      "velocity_z",      false },
+
+    // chemical species fields, if they exist
+
+    // primordial_chemistry > 0 fields
+    { &grackle_field_data::HI_density,      "HI_density",      false },
+    { &grackle_field_data::HII_density,     "HII_density",     false },
+    { &grackle_field_data::HeI_density,     "HeI_density",     false },
+    { &grackle_field_data::HeII_density,    "HeII_density",    false },
+    { &grackle_field_data::HeIII_density,   "HeIII_density",   false },
+    { &grackle_field_data::e_density,       "e_density",       false },
+
+    // primordial_chemistry > 1 fields
+    { &grackle_field_data::HM_density,      "HM_density",      false },
+    { &grackle_field_data::H2I_density,     "H2I_density",     false },
+    { &grackle_field_data::H2II_density,    "H2II_density",    false },
+
+    // primordial_chemistry > 2 fields
+    { &grackle_field_data::DI_density,      "DI_density",      false },
+    { &grackle_field_data::DII_density,     "DII_density",     false },
+    { &grackle_field_data::HDI_density,     "HDI_density",     false },
+
+    { &grackle_field_data::metal_density,   "metal_density",   false },
+
+    // radiative transfer heating and ionization rates
+    { &grackle_field_data::RT_heating_rate,
+      "RT_heating_rate",         false },
+    { &grackle_field_data::RT_HI_ionization_rate,
+      "RT_HI_ionization_rate",   false },
+    { &grackle_field_data::RT_HeI_ionization_rate,
+      "RT_HeI_ionization_rate",  false },
+    { &grackle_field_data::RT_HeII_ionization_rate,
+      "RT_HeII_ionization_rate", false },
+    { &grackle_field_data::RT_H2_dissociation_rate,
+      "RT_H2_dissociation_rate", false },
+  };
+
+  /// Copies of the fields of a list of cells, passed to Grackle as a
+  /// contiguous 1D grid
+  struct GracklePackedCells {
+    std::vector<gr_float> values;
+    int dimension[3];
+    int start[3];
+    int end[3];
+    grackle_field_data fields;
+  };
+
+  /// Gather the given cells (linear indices into grid's arrays) of each
+  /// field of grid into packed
+  void pack_cells_(const grackle_field_data& grid,
+                   const std::vector<int>& cells, GracklePackedCells& packed)
+  {
+    const int n = cells.size();
+    packed.fields = grid;
+    packed.fields.grid_rank = 1;
+    for (int i = 0; i < 3; i++){
+      packed.dimension[i] = (i == 0) ? n : 1;
+      packed.start[i] = 0;
+      packed.end[i] = (i == 0) ? n - 1 : 0;
+    }
+    packed.fields.grid_dimension = packed.dimension;
+    packed.fields.grid_start = packed.start;
+    packed.fields.grid_end = packed.end;
+
+    int num_arrays = 0;
+    for (const GrackleFieldEntry& entry : grackle_field_entries){
+      if (grid.*(entry.member) != nullptr) num_arrays++;
+    }
+    packed.values.resize(std::size_t(num_arrays) * n);
+
+    int k = 0;
+    for (const GrackleFieldEntry& entry : grackle_field_entries){
+      const gr_float * src = grid.*(entry.member);
+      if (src == nullptr) continue;
+      gr_float * dst = packed.values.data() + std::size_t(k++) * n;
+      for (int i = 0; i < n; i++) dst[i] = src[cells[i]];
+      packed.fields.*(entry.member) = dst;
+    }
+  }
+
+  /// Scatter the fields of packed back to the given cells of grid
+  void unpack_cells_(const GracklePackedCells& packed,
+                     const std::vector<int>& cells, grackle_field_data& grid)
+  {
+    const int n = cells.size();
+    for (const GrackleFieldEntry& entry : grackle_field_entries){
+      gr_float * dst = grid.*(entry.member);
+      if (dst == nullptr) continue;
+      const gr_float * src = packed.fields.*(entry.member);
+      for (int i = 0; i < n; i++) dst[cells[i]] = src[i];
+    }
+  }
+
+}
+
+/// grackle_field_data of a Block, with the arrays it points to
+struct GrackleFieldCache {
+  /// FieldData::permanent() and permanent_size() when the entry was built
+  const char * permanent;
+  std::size_t permanent_size;
+  /// Whether the fields can be passed to Grackle without staging
+  bool is_valid;
+  int dimension[3];
+  int start[3];
+  int end[3];
+  grackle_field_data fields;
+};
+
 #endif
 
 //----------------------------------------------------------------------------
@@ -167,7 +292,9 @@ GrackleFacade::GrackleFacade(GrackleChemistryData&& my_chemistry,
   : my_chemistry_(std::move(my_chemistry)),
     grackle_units_(nullptr),
     grackle_rates_(nullptr),
-    radiation_redshift_(radiation_redshift)
+    radiation_redshift_(radiation_redshift),
+    field_handles_(),
+    field_cache_()
 {
   if ((radiation_redshift >= 0) && (enzo::cosmology() != nullptr)){
     ERROR("GrackleFacade::GrackleFacade",
@@ -185,7 +312,9 @@ GrackleFacade::GrackleFacade(CkMigrateMessage *m)
     my_chemistry_(),
     grackle_units_(nullptr),
     grackle_rates_(nullptr),
-    radiation_redshift_(-1)
+    radiation_redshift_(-1),
+    field_handles_(),
+    field_cache_()
 { }
 
 //----------------------------------------------------------------------------
@@ -243,7 +372,8 @@ void GrackleFacade::setup_grackle_fields
 (const EnzoFieldAdaptor& fadaptor,
  grackle_field_data * grackle_fields,
  int stale_depth, /* default: 0 */
- bool omit_cell_width /* default false */
+ bool omit_cell_width, /* default false */
+ EnzoFieldStaging * staging /* default nullptr */
  ) const noexcept
 {
 #ifndef CONFIG_USE_GRACKLE
@@ -285,42 +415,21 @@ void GrackleFacade::setup_grackle_fields
     grackle_fields->grid_dx = hx;
   }
 
-  // Setup all fields to be passed into grackle
-  grackle_fields->density         = fadaptor.ptr_for_grackle("density", true);
-  grackle_fields->internal_energy = fadaptor.ptr_for_grackle("internal_energy",
-                                                             true);
-  grackle_fields->x_velocity      = fadaptor.ptr_for_grackle("velocity_x");
-  grackle_fields->y_velocity      = fadaptor.ptr_for_grackle("velocity_y");
-  grackle_fields->z_velocity      = fadaptor.ptr_for_grackle("velocity_z");
-
-  // Get chemical species fields if they exist
-
-  // primordial_chemistry > 0 fields
-  grackle_fields->HI_density      = fadaptor.ptr_for_grackle("HI_density");
-  grackle_fields->HII_density     = fadaptor.ptr_for_grackle("HII_density");
-  grackle_fields->HeI_density     = fadaptor.ptr_for_grackle("HeI_density");
-  grackle_fields->HeII_density    = fadaptor.ptr_for_grackle("HeII_density");
-  grackle_fields->HeIII_density   = fadaptor.ptr_for_grackle("HeIII_density");
-  grackle_fields->e_density       = fadaptor.ptr_for_grackle("e_density");
-
-  // primordial_chemistry > 1 fields
-  grackle_fields->HM_density      = fadaptor.ptr_for_grackle("HM_density");
-  grackle_fields->H2I_density     = fadaptor.ptr_for_grackle("H2I_density");
-  grackle_fields->H2II_density    = fadaptor.ptr_for_grackle("H2II_density");
-
-  // primordial_chemistry > 2 fields
-  grackle_fields->DI_density      = fadaptor.ptr_for_grackle("DI_density");
-  grackle_fields->DII_density     = fadaptor.ptr_for_grackle("DII_density");
-  grackle_fields->HDI_density     = fadaptor.ptr_for_grackle("HDI_density");
-
-  grackle_fields->metal_density   = fadaptor.ptr_for_grackle("metal_density");
-
-  //  RADIATIVE TRANSFER HEATING AND IONIZATION RATES
-  grackle_fields->RT_heating_rate         = fadaptor.ptr_for_grackle("RT_heating_rate");
-  grackle_fields->RT_HI_ionization_rate   = fadaptor.ptr_for_grackle("RT_HI_ionization_rate");
-  grackle_fields->RT_HeI_ionization_rate  = fadaptor.ptr_for_grackle("RT_HeI_ionization_rate");
-  grackle_fields->RT_HeII_ionization_rate = fadaptor.ptr_for_grackle("RT_HeII_ionization_rate");
-  grackle_fields->RT_H2_dissociation_rate = fadaptor.ptr_for_grackle("RT_H2_dissociation_rate");
+  // Setup all fields to be passed into grackle. Field ids are looked up
+  // once, rather than by name for every Block
+  if (field_handles_.empty()){
+    for (const GrackleFieldEntry& entry : grackle_field_entries){
+      field_handles_.emplace_back(entry.name);
+    }
+  }
+  for (std::size_t i = 0; i < field_handles_.size(); i++){
+    const GrackleFieldEntry& entry = grackle_field_entries[i];
+    const FieldHandle& handle = field_handles_[i];
+    grackle_fields->*(entry.member) =
+      ((staging != nullptr) && handle.exists()) ?
+      staging->values(handle.id()) :
+      fadaptor.ptr_for_grackle(handle, entry.require_exists);
+  }
 
   /* Leave these as NULL for now and save for future development */
   gr_float * volumetric_heating_rate = NULL;
@@ -348,8 +457,81 @@ void GrackleFacade::delete_grackle_fields(grackle_field_data * grackle_fields)
 
 //----------------------------------------------------------------------------
 
+bool GrackleFacade::cached_grackle_fields
+(Block* block, grackle_field_data * grackle_fields) const noexcept
+{
+#ifndef CONFIG_USE_GRACKLE
+  ERROR("GrackleFacade::cached_grackle_fields", "grackle isn't being used");
+#else
+
+  auto it = field_cache_.find(block);
+  if (it == field_cache_.end()) {
+    // deleted Blocks leave their entries behind, so the cache is cleared
+    // when it outgrows the Blocks on this process
+    if (field_cache_.size() > 2*cello::hierarchy()->num_blocks()) {
+      field_cache_.clear();
+    }
+    std::unique_ptr<GrackleFieldCache> entry(new GrackleFieldCache);
+    entry->permanent = nullptr;
+    entry->permanent_size = 0;
+    entry->is_valid = false;
+    it = field_cache_.emplace(block, std::move(entry)).first;
+  }
+  GrackleFieldCache & cache = *(it->second);
+
+  // field pointers depend only on the address and size of the permanent
+  // field storage, since the field layout is the same for all Blocks
+
+  const FieldData * field_data = block->data()->field_data();
+  EnzoFieldAdaptor fadaptor(block, 0);
+
+  if ((cache.permanent != field_data->permanent()) ||
+      (cache.permanent_size != field_data->permanent_size())) {
+
+    EnzoFieldStaging staging(block, 0);
+    grackle_field_data fields;
+    setup_grackle_fields(fadaptor, &fields, 0, false, &staging);
+
+    const FieldDescr * field_descr = cello::field_descr();
+    cache.is_valid = (staging.num_staged() == 0);
+    for (const FieldHandle& handle : field_handles_) {
+      if (handle.exists() && ! field_descr->is_permanent(handle.id())) {
+        cache.is_valid = false;
+      }
+    }
+
+    for (int i = 0; i < 3; i++){
+      cache.dimension[i] = fields.grid_dimension[i];
+      cache.start[i] = fields.grid_start[i];
+      cache.end[i] = fields.grid_end[i];
+    }
+    cache.fields = fields;
+    cache.fields.grid_dimension = cache.dimension;
+    cache.fields.grid_start = cache.start;
+    cache.fields.grid_end = cache.end;
+    delete_grackle_fields(&fields);
+    cache.permanent = field_data->permanent();
+    cache.permanent_size = field_data->permanent_size();
+  }
+
+  if (! cache.is_valid) return false;
+
+  *grackle_fields = cache.fields;
+
+  // a new Block at the address of a deleted one may be on another level
+  double hx, hy, hz;
+  fadaptor.cell_width(&hx,&hy,&hz);
+  grackle_fields->grid_dx = hx;
+
+  return true;
+#endif /* CONFIG_USE_GRACKLE */
+}
+
+//----------------------------------------------------------------------------
+
 void GrackleFacade::solve_chemistry(Block* block, double compute_time,
-                                    double dt) const noexcept
+                                    double dt, int num_tasks,
+                                    double explicit_ratio) const noexcept
 {
 #ifndef CONFIG_USE_GRACKLE
   ERROR("GrackleFacade::solve_chemistry", "grackle isn't being used");
@@ -358,9 +540,15 @@ void GrackleFacade::solve_chemistry(Block* block, double compute_time,
   code_units grackle_units;
   setup_grackle_u_(compute_time, radiation_redshift_, &grackle_units);
 
-  EnzoFieldAdaptor fadaptor(block, 0);
+  // fields that aren't stored with enzo_float precision (e.g. species
+  // densities in single precision) are converted before and after
+  EnzoFieldStaging staging(block, 0);
   grackle_field_data grackle_fields;
-  setup_grackle_fields(fadaptor, &grackle_fields);
+  const bool is_cached = cached_grackle_fields(block, &grackle_fields);
+  if (! is_cached) {
+    setup_grackle_fields(EnzoFieldAdaptor(block, 0), &grackle_fields, 0,
+                         false, &staging);
+  }
 
   // because this function is const-qualified, my_chemistry_.get_ptr()
   // currently returns a pointer to a `const`. we need to drop the `const` to
@@ -369,13 +557,106 @@ void GrackleFacade::solve_chemistry(Block* block, double compute_time,
   chemistry_data * chemistry_data_ptr
     = const_cast<chemistry_data *>(my_chemistry_.get_ptr());
 
-  if (local_solve_chemistry(chemistry_data_ptr, grackle_rates_.get(),
-			    &grackle_units, &grackle_fields, dt)
-      == ENZO_FAIL) {
-    ERROR("GrackleFacade::solve_chemistry", "Error in local_solve_chemistry.");
+  // each task passes Grackle a slab of the block along its last axis, by
+  // restricting grid_start and grid_end (grid_end is inclusive)
+  const int axis = grackle_fields.grid_rank - 1;
+  auto solve_slabs = [&](int task, int first, int last)
+  {
+    code_units slab_units = grackle_units;
+    grackle_field_data slab_fields = grackle_fields;
+    int slab_start[3], slab_end[3];
+    for (int i = 0; i < 3; i++){
+      slab_start[i] = grackle_fields.grid_start[i];
+      slab_end[i] = grackle_fields.grid_end[i];
+    }
+    slab_start[axis] = first;
+    slab_end[axis] = last - 1;
+    slab_fields.grid_start = slab_start;
+    slab_fields.grid_end = slab_end;
+
+    if (local_solve_chemistry(chemistry_data_ptr, grackle_rates_.get(),
+                              &slab_units, &slab_fields, dt)
+        == ENZO_FAIL) {
+      ERROR("GrackleFacade::solve_chemistry",
+            "Error in local_solve_chemistry.");
+    }
+  };
+
+  if (explicit_ratio <= 0.0) {
+
+    cello::parallel_for(grackle_fields.grid_start[axis],
+                        grackle_fields.grid_end[axis] + 1, num_tasks,
+                        solve_slabs);
+
+  } else {
+
+    // classify the active cells by cooling time: cells that cool
+    // slowly compared to dt get an explicit update, and only the stiff
+    // cells are packed contiguously and passed to Grackle, so that
+    // the tasks get equal shares of the stiff cells
+
+    const int * dim   = grackle_fields.grid_dimension;
+    const int * start = grackle_fields.grid_start;
+    const int * end   = grackle_fields.grid_end;
+    std::vector<int> cells;
+    for (int iz = start[2]; iz <= end[2]; iz++){
+      for (int iy = start[1]; iy <= end[1]; iy++){
+        for (int ix = start[0]; ix <= end[0]; ix++){
+          cells.push_back(ix + dim[0]*(iy + dim[1]*iz));
+        }
+      }
+    }
+
+    GracklePackedCells active;
+    pack_cells_(grackle_fields, cells, active);
+    std::vector<gr_float> cooling_time(cells.size());
+    if (local_calculate_cooling_time(chemistry_data_ptr, grackle_rates_.get(),
+                                     &grackle_units, &active.fields,
+                                     cooling_time.data()) == ENZO_FAIL) {
+      ERROR("GrackleFacade::solve_chemistry",
+            "Error in local_calculate_cooling_time.");
+    }
+
+    // cooling_time = e / (de/dt), which is negative when cooling
+    gr_float * internal_energy = grackle_fields.internal_energy;
+    std::vector<int> stiff;
+    for (std::size_t i = 0; i < cells.size(); i++){
+      if (std::fabs(cooling_time[i]) < explicit_ratio * dt) {
+        stiff.push_back(cells[i]);
+      } else {
+        internal_energy[cells[i]] +=
+          dt * internal_energy[cells[i]] / cooling_time[i];
+      }
+    }
+
+    if (! stiff.empty()) {
+      GracklePackedCells packed;
+      pack_cells_(grackle_fields, stiff, packed);
+
+      auto solve_stiff = [&](int task, int first, int last)
+      {
+        code_units batch_units = grackle_units;
+        grackle_field_data batch_fields = packed.fields;
+        int batch_start[3] = {first, 0, 0};
+        int batch_end[3] = {last - 1, 0, 0};
+        batch_fields.grid_start = batch_start;
+        batch_fields.grid_end = batch_end;
+
+        if (local_solve_chemistry(chemistry_data_ptr, grackle_rates_.get(),
+                                  &batch_units, &batch_fields, dt)
+            == ENZO_FAIL) {
+          ERROR("GrackleFacade::solve_chemistry",
+                "Error in local_solve_chemistry.");
+        }
+      };
+
+      cello::parallel_for(0, int(stiff.size()), num_tasks, solve_stiff);
+      unpack_cells_(packed, stiff, grackle_fields);
+    }
   }
 
-  delete_grackle_fields(&grackle_fields);
+  staging.write_back();
+  if (! is_cached) delete_grackle_fields(&grackle_fields);
 #endif
 }
 
@@ -492,3 +773,67 @@ void GrackleFacade::compute_property
   }
 #endif /* CONFIG_USE_GRACKLE */
 }
+
+//----------------------------------------------------------------------------
+
+double GrackleFacade::min_cooling_time(Block* block, enzo_float* values)
+  const noexcept
+{
+#ifndef CONFIG_USE_GRACKLE
+  ERROR("GrackleFacade::min_cooling_time", "grackle isn't being used");
+#else
+
+  code_units my_units;
+  double compute_time = (enzo::cosmology() != nullptr) ? block->time() : -1.0;
+  setup_grackle_u_(compute_time, radiation_redshift_, &my_units);
+
+  // fields are only read, so staged copies aren't written back
+  EnzoFieldStaging staging(block, 0);
+  grackle_field_data grackle_fields;
+  const bool is_cached = cached_grackle_fields(block, &grackle_fields);
+  if (! is_cached) {
+    setup_grackle_fields(EnzoFieldAdaptor(block, 0), &grackle_fields, 0,
+                         true, &staging);
+  }
+
+  // ghost zones may not have been refreshed yet (e.g. on the first cycle),
+  // and would be excluded from the minimum anyway, so skip them
+  int g3[3];
+  block->data()->field().ghost_depth(0, g3, g3+1, g3+2);
+  int start[3], end[3];
+  for (int i = 0; i < 3; i++){
+    start[i] = grackle_fields.grid_start[i] + g3[i];
+    end[i] = grackle_fields.grid_end[i] - g3[i];
+  }
+  grackle_field_data active_fields = grackle_fields;
+  active_fields.grid_start = start;
+  active_fields.grid_end = end;
+
+  chemistry_data * chemistry_data_ptr
+    = const_cast<chemistry_data *>(my_chemistry_.get_ptr());
+  chemistry_data_storage * grackle_rates_ptr
+    = const_cast<chemistry_data_storage *>(grackle_rates_.get());
+
+  if (local_calculate_cooling_time(chemistry_data_ptr, grackle_rates_ptr,
+                                   &my_units, &active_fields, values)
+      == ENZO_FAIL) {
+    ERROR("GrackleFacade::min_cooling_time",
+          "Error in local_calculate_cooling_time.");
+  }
+
+  const int * dim = grackle_fields.grid_dimension;
+  double min_time = std::numeric_limits<double>::max();
+  for (int iz = start[2]; iz <= end[2]; iz++){
+    for (int iy = start[1]; iy <= end[1]; iy++){
+      for (int ix = start[0]; ix <= end[0]; ix++){
+        const int i = ix + dim[0]*(iy + dim[1]*iz);
+        min_time = std::min(min_time, double(std::abs(values[i])));
+      }
+    }
+  }
+
+  if (! is_cached) delete_grackle_fields(&grackle_fields);
+
+  return min_time;
+#endif /* CONFIG_USE_GRACKLE */
+}
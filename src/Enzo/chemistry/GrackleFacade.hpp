@@ -14,6 +14,10 @@
 enum class GracklePropertyEnum
   { cooling_time, dust_temperature, gamma, pressure, temperature };
 
+/// grackle_field_data of a Block cached by GrackleFacade (defined in
+/// GrackleFacade.cpp)
+struct GrackleFieldCache;
+
 class GrackleFacade : public PUP::able {
 
   /// @class    GrackleFacade
@@ -127,10 +131,16 @@ public: // interface
 public: // low-level legacy methods - these will (probably) be removed or made
         // private in the near future
 
+  /// When staging is provided, it must wrap the Block wrapped by fadaptor,
+  /// and fields that aren't stored with enzo_float precision are passed to
+  /// Grackle as staged copies (the caller is responsible for calling
+  /// staging->write_back() if they are modified).
   void setup_grackle_fields(const EnzoFieldAdaptor& fadaptor,
                             grackle_field_data * grackle_fields,
                             int stale_depth = 0,
-                            bool omit_cell_width = false) const noexcept;
+                            bool omit_cell_width = false,
+                            EnzoFieldStaging * staging = nullptr)
+    const noexcept;
 
   void setup_grackle_fields(Block * block, grackle_field_data* grackle_fields,
                             int i_hist = 0 ) const noexcept
@@ -141,6 +151,19 @@ public: // low-level legacy methods - these will (probably) be removed or made
 
   void delete_grackle_fields(grackle_field_data* grackle_fields) const noexcept;
 
+  /// Copy into grackle_fields the grackle_field_data of the current fields
+  /// of block, which is cached and only rebuilt when the Block's field
+  /// storage is reallocated (e.g. after adapt or migration).
+  ///
+  /// Returns false, leaving grackle_fields unset, if the fields can't be
+  /// passed to Grackle directly because some are temporary or need staging;
+  /// setup_grackle_fields must then be used instead. The arrays of the copy
+  /// are owned by the cache, so it must NOT be passed to
+  /// delete_grackle_fields.
+  bool cached_grackle_fields(Block* block,
+                             grackle_field_data* grackle_fields)
+    const noexcept;
+
 public: // wrapped grackle functions:
 
   /// light-weight wrapper around local_solve_chemistry function from grackle
@@ -161,8 +184,27 @@ public: // wrapped grackle functions:
   ///       reverts the transformation before returning, floating point errors
   ///       could lead to slightly different field values at the end.
   ///    2. Grackle may also apply some floors to other field values
+  ///
+  /// @param[in] num_tasks The block is divided into this many slabs along
+  ///     its last axis, which are passed to Grackle separately (and run
+  ///     concurrently when built with CkLoop; see cello::parallel_for).
+  ///     Grackle's calculations are local to each cell, so the result
+  ///     doesn't depend on this value.
+  /// @param[in] explicit_ratio If positive, cells whose cooling time
+  ///     exceeds this multiple of dt get a single explicit energy update,
+  ///     and only the remaining cells are packed together and passed to
+  ///     Grackle (split into num_tasks batches). This is only valid when
+  ///     primordial_chemistry is 0, so no species are evolved.
   void solve_chemistry(Block* block, double compute_time,
-                       double dt) const noexcept;
+                       double dt, int num_tasks = 1,
+                       double explicit_ratio = 0.0) const noexcept;
+
+  /// Return the minimum absolute cooling time of the active cells of block
+  ///
+  /// The cooling time of the active cells is written to values, which must
+  /// have space for the whole block including ghost zones (ghost zones are
+  /// left unchanged).
+  double min_cooling_time(Block* block, enzo_float* values) const noexcept;
 
   /// wrapper around the various methods for computing various grackle
   /// properties.
@@ -201,6 +243,15 @@ private: // attributes
   /// this is unset
   double radiation_redshift_;
 
+  /// Handles of the fields passed to Grackle by setup_grackle_fields, which
+  /// builds them on first use (this is a cache, so it isn't packed)
+  mutable std::vector<FieldHandle> field_handles_;
+
+  /// grackle_field_data of each Block used by cached_grackle_fields (this is
+  /// a cache, so it isn't packed)
+  mutable std::map<const Block*, std::unique_ptr<GrackleFieldCache>>
+  field_cache_;
+
 };
 
 #endif /* ENZO_ENZO_GRACKLE_FACADE_HPP */
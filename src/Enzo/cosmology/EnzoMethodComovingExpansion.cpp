@@ -12,7 +12,11 @@
 EnzoMethodComovingExpansion::EnzoMethodComovingExpansion
 ( bool comoving_coordinates )
   : Method(),
-    comoving_coordinates_(comoving_coordinates)
+    comoving_coordinates_(comoving_coordinates),
+    cosmo_time_(-1.0),
+    cosmo_a_(1.0),
+    cosmo_dadt_(0.0),
+    pressure_old_()
 {
   cello::simulation()->refresh_set_name(ir_post_,name());
 
@@ -93,9 +97,17 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
       }
 
       //      printf ("DEBUG_VELOCITY time old new = %g %g\n",field.history_time(1),enzo_block->time());
-      enzo_float cosmo_a=1.0;
-      enzo_float cosmo_dadt=0.0;
-      cosmology->compute_expansion_factor (&cosmo_a, &cosmo_dadt, compute_time);
+      // all Blocks in a cycle share compute_time, so only the first
+      // Block on this process evaluates the expansion factor
+      if (compute_time != cosmo_time_) {
+        cosmo_a_ = 1.0;
+        cosmo_dadt_ = 0.0;
+        cosmology->compute_expansion_factor
+          (&cosmo_a_, &cosmo_dadt_, compute_time);
+        cosmo_time_ = compute_time;
+      }
+      const enzo_float cosmo_a = cosmo_a_;
+      const enzo_float cosmo_dadt = cosmo_dadt_;
       //      double dt = enzo_block->time() - field.history_time(1);
       double dt = block->dt();
       enzo_float Coefficient = dt*cosmo_dadt/cosmo_a;
@@ -113,14 +125,6 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
       const int in = cello::index_static();
       enzo_float gamma = enzo::fluid_props()->gamma();
 
-      // hard-code hydromethod for PPM for now
-      int HydroMethod = 0;
-
-      // hard-code CR method to off
-      int CRModel = 0;
-      enzo_float * cr_field_new = NULL;
-      enzo_float * cr_field_old = NULL;
-
       /* Get the necessary fields.
   	 field.values(<field_name>, 0) is the field at the current time.
   	 field.values(<field_name>, 1) is the field at the previous time.
@@ -131,33 +135,21 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
 
       enzo_float * density_new         =
   	(enzo_float *) field.values("density", i_new);
-      enzo_float * density_old         =
-  	(enzo_float *) field.values("density", i_old);
       enzo_float * total_energy_new    =
   	(enzo_float *) field.values("total_energy", i_new);
-      enzo_float * total_energy_old    =
-  	(enzo_float *) field.values("total_energy", i_old);
       enzo_float * internal_energy_new =
   	(enzo_float *) field.values("internal_energy", i_new);
-      enzo_float * internal_energy_old =
-  	(enzo_float *) field.values("internal_energy", i_old);
 
       enzo_float * velocity_x_new = NULL;
       enzo_float * velocity_y_new = NULL;
       enzo_float * velocity_z_new = NULL;
-      enzo_float * velocity_x_old = NULL;
-      enzo_float * velocity_y_old = NULL;
-      enzo_float * velocity_z_old = NULL;
 
       velocity_x_new   = (enzo_float *) field.values("velocity_x", i_new);
-      velocity_x_old   = (enzo_float *) field.values("velocity_x", i_old);
       if (rank >= 2) {
   	velocity_y_new = (enzo_float *) field.values("velocity_y", i_new);
-  	velocity_y_old = (enzo_float *) field.values("velocity_y", i_old);
       }
       if (rank >= 3) {
   	velocity_z_new = (enzo_float *) field.values("velocity_z", i_new);
-  	velocity_z_old = (enzo_float *) field.values("velocity_z", i_old);
       }
 
       // Compute the pressure *now*
@@ -165,47 +157,56 @@ void EnzoMethodComovingExpansion::compute ( Block * block) throw()
       EnzoComputePressure compute_pressure (gamma, comoving_coordinates_);
       compute_pressure.compute(block, pressure_now);
 
-      // If history is present, compute time-centered pressure
-      enzo_float * pressure = NULL;
+      // If history is present, compute the old pressure so that the
+      // expansion terms below can use the time-centered average
+      const enzo_float * pressure_old = nullptr;
 
       if (has_history) {
         EnzoComputePressure compute_pressure_old (gamma, comoving_coordinates_);
         compute_pressure_old.set_history(i_old);
 
-        pressure = new enzo_float[m];
+        if ((int)pressure_old_.size() < m) pressure_old_.resize(m);
 
-        compute_pressure_old.compute(block, pressure);
+        compute_pressure_old.compute(block, pressure_old_.data());
+        pressure_old = pressure_old_.data();
+      }
 
-        // now compute the time-centered average of the two
-        for (int i = 0; i < m; i ++){
-          pressure[i] = 0.5*(pressure_now[i] + pressure[i]);
+      const bool idual =
+        ! enzo::fluid_props()->dual_energy_config().is_disabled();
+
+      /* Apply the expansion terms in a single pass over the fields.
+         This is expand_terms() from Enzo with ENERGY_METHOD3 and
+         VELOCITY_METHOD3 (semi-implicit), PPM-type hydro (not Zeus),
+         and no cosmic rays.  Only the old pressure is needed from the
+         previous time. */
+
+      const enzo_float energy_factor = 3.0 - enzo_float(2.0/(gamma - 1.0));
+      const enzo_float energy_coef = Coefficient*energy_factor;
+      const enzo_float energy_minus = 1.0 - Coefficient;
+      const enzo_float energy_plus  = 1.0 + Coefficient;
+      const enzo_float velocity_minus = 1.0 - enzo_float(0.5*Coefficient);
+      const enzo_float velocity_plus  = 1.0 + enzo_float(0.5*Coefficient);
+
+      for (int i = 0; i < m; i++) {
+        const enzo_float p = (pressure_old != nullptr) ?
+          0.5*(pressure_now[i] + pressure_old[i]) : pressure_now[i];
+
+        if (idual) {
+          internal_energy_new[i] =
+            internal_energy_new[i]*energy_minus/energy_plus;
         }
 
-      } else {
+        const enzo_float e = total_energy_new[i]*energy_minus/energy_plus;
+        total_energy_new[i] = std::max(e - energy_coef*p/density_new[i],
+                                       enzo_float(0.5*e));
 
-        // if not, just use current pressure
-        pressure = pressure_now;
-      }
-
-      int idual = static_cast<int>
-        (! enzo::fluid_props()->dual_energy_config().is_disabled());
-      /* Call fortran routine to do the real work. */
-
-      FORTRAN_NAME(expand_terms)
-	(
-	 &rank, &m, &idual, &Coefficient,
-	 (int*) &HydroMethod, &gamma,
-	 pressure,
-	 density_new, total_energy_new, internal_energy_new,
-	 velocity_x_new, velocity_y_new, velocity_z_new,
-	 density_old, total_energy_old, internal_energy_old,
-	 velocity_x_old, velocity_y_old, velocity_z_old,
-	 &CRModel, cr_field_new, cr_field_old);
-
-
-      if (has_history){
-	delete [] pressure;
-	pressure = NULL;
+        velocity_x_new[i] = velocity_x_new[i]*velocity_minus/velocity_plus;
+        if (rank >= 2) {
+          velocity_y_new[i] = velocity_y_new[i]*velocity_minus/velocity_plus;
+        }
+        if (rank >= 3) {
+          velocity_z_new[i] = velocity_z_new[i]*velocity_minus/velocity_plus;
+        }
       }
     }
 
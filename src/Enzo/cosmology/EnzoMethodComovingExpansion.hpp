@@ -25,7 +25,11 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodComovingExpansion (CkMigrateMessage *m)
     : Method (m),
-      comoving_coordinates_(false)
+      comoving_coordinates_(false),
+      cosmo_time_(-1.0),
+      cosmo_a_(1.0),
+      cosmo_dadt_(0.0),
+      pressure_old_()
   {}
 
   /// CHARM++ Pack / Unpack function
@@ -45,6 +49,16 @@ public: // virtual methods
 private: // attributes
 
   bool comoving_coordinates_;
+
+  /// Time at which cosmo_a_ and cosmo_dadt_ were last computed (not packed)
+  enzo_float cosmo_time_;
+
+  /// Expansion factor and its derivative at cosmo_time_ (not packed)
+  enzo_float cosmo_a_;
+  enzo_float cosmo_dadt_;
+
+  /// Scratch array for the pressure at the previous time (not packed)
+  std::vector<enzo_float> pressure_old_;
 };
 
 #endif /* ENZO_ENZO_METHOD_COMOVING_EXPANSION_HPP */
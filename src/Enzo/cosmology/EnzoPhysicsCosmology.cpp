@@ -61,6 +61,20 @@ enzo_float EnzoPhysicsCosmology::time_from_redshift (enzo_float redshift) const
 
 void EnzoPhysicsCosmology::compute_expansion_factor
 (enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const
+{
+  if (! (cache_valid_ && cache_time_ == time)) {
+    compute_expansion_factor_ (&cache_a_, &cache_dadt_, time);
+    cache_time_  = time;
+    cache_valid_ = (cache_a_ != -1.0);
+  }
+  *cosmo_a    = cache_a_;
+  *cosmo_dadt = cache_dadt_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoPhysicsCosmology::compute_expansion_factor_
+(enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const
 {
 
   //   *a = 1.0;
@@ -30,7 +30,11 @@ public: // interface
     final_redshift_(0.0),
     cosmo_a_(0.0),
     cosmo_dadt_(0.0),
-    current_redshift_(-1.0)
+    current_redshift_(-1.0),
+    cache_valid_(false),
+    cache_time_(0.0),
+    cache_a_(0.0),
+    cache_dadt_(0.0)
   {
   }
 
@@ -59,7 +63,11 @@ public: // interface
       final_redshift_(final_redshift),
       cosmo_a_(0.0),
       cosmo_dadt_(0.0),
-      current_redshift_(-1.0)
+      current_redshift_(-1.0),
+      cache_valid_(false),
+      cache_time_(0.0),
+      cache_a_(0.0),
+      cache_dadt_(0.0)
   {
     ASSERT3 ("EnzoPhysicsCosmology::EnzoPhysicsCosmology()",
 	     "omega_matter_now (%g) must equal "
@@ -86,7 +94,11 @@ public: // interface
       final_redshift_(0.0),
       cosmo_a_(0.0),
       cosmo_dadt_(0.0),
-      current_redshift_(-1.0)
+      current_redshift_(-1.0),
+      cache_valid_(false),
+      cache_time_(0.0),
+      cache_a_(0.0),
+      cache_dadt_(0.0)
   {}
 
   /// Virtual destructor
@@ -114,6 +126,8 @@ public: // interface
     p | cosmo_dadt_;
     p | current_redshift_;
 
+    if (p.isUnpacking()) cache_valid_ = false;
+
   };
 
   enzo_float hubble_constant_now()   { return hubble_constant_now_; }
@@ -129,23 +143,23 @@ public: // interface
 
   /// Set Cosmology parameters (used by testing only)
   void set_hubble_constant_now(enzo_float value)
-  { hubble_constant_now_=value; }
+  { hubble_constant_now_=value; cache_valid_=false; }
   void set_omega_matter_now(enzo_float value)
-  { omega_matter_now_=value; }
+  { omega_matter_now_=value; cache_valid_=false; }
   void set_omega_baryon_now(enzo_float value)
-  { omega_baryon_now_=value; }
+  { omega_baryon_now_=value; cache_valid_=false; }
   void set_omega_cdm_now(enzo_float value)
-  { omega_cdm_now_=value; }
+  { omega_cdm_now_=value; cache_valid_=false; }
   void set_omega_lambda_now(enzo_float value)
-  { omega_lambda_now_=value; }
+  { omega_lambda_now_=value; cache_valid_=false; }
   void set_comoving_box_size(enzo_float value)
-  { comoving_box_size_=value; }
+  { comoving_box_size_=value; cache_valid_=false; }
   void set_max_expansion_rate(enzo_float value)
-  { max_expansion_rate_=value; }
+  { max_expansion_rate_=value; cache_valid_=false; }
   void set_initial_redshift(enzo_float value)
-  { initial_redshift_=value; }
+  { initial_redshift_=value; cache_valid_=false; }
   void set_final_redshift(enzo_float value)
-  { final_redshift_=value; }
+  { final_redshift_=value; cache_valid_=false; }
 
   enzo_float initial_time_in_code_units() const
   { return time_from_redshift (initial_redshift_); }
@@ -177,6 +191,9 @@ public: // interface
   void compute_expansion_timestep
   (enzo_float *dt_expansion, enzo_float time) const;
 
+  /// Compute the expansion factor and its derivative at the given
+  /// time.  The result for the most recent time is cached, since all
+  /// Blocks on a process ask for the same time each cycle
   void compute_expansion_factor
   (enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const;
 
@@ -317,6 +334,12 @@ public: // interface
     fflush(stdout);
   }
 
+protected: // functions
+
+  /// Compute the expansion factor and its derivative without the cache
+  void compute_expansion_factor_
+  (enzo_float *cosmo_a, enzo_float *cosmo_dadt, enzo_float time) const;
+
 public: // virtual methods
 
   virtual std::string type() const { return "cosmology"; }
@@ -341,6 +364,12 @@ protected: // attributes
   enzo_float cosmo_dadt_;
   enzo_float current_redshift_;
 
+  // Most recent compute_expansion_factor() result (not pupped)
+  mutable bool cache_valid_;
+  mutable enzo_float cache_time_;
+  mutable enzo_float cache_a_;
+  mutable enzo_float cache_dadt_;
+
 };
 
 #endif /* ENZO_ENZO_PHYSICS_COSMOLOGY_HPP */
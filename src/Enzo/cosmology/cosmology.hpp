@@ -12,7 +12,9 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <algorithm> // std::max
 #include <string>
+#include <vector>
 
 //----------------------------------------------------------------------
 // Component dependencies
@@ -25,21 +27,6 @@
 
 #include "Enzo/enzo.hpp" // enzo_float, EnzoBlock, EnzoEFltArrayMap
 
-//----------------------------------------------------------------------
-// Assorted Public Functions
-//----------------------------------------------------------------------
-
-// TODO: potentially move this into its own private header file (or just
-//       declare it in the source file where its used)
-extern "C" void FORTRAN_NAME(expand_terms)(
-   int *rank, int *isize, int *idual, enzo_float *coef,
-   int *imethod, enzo_float *gamma,
-   enzo_float *p,  enzo_float *d, enzo_float *e, enzo_float *ge,
-   enzo_float *u, enzo_float *v, enzo_float *w,
-   enzo_float *dold, enzo_float *eold, enzo_float *geold,
-   enzo_float *uold, enzo_float *vold, enzo_float *wold,
-   int *icr, enzo_float *ecr, enzo_float *ecrold);
-
 //----------------------------------------------------------------------
 // Component headers
 //----------------------------------------------------------------------
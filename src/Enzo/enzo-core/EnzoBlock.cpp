@@ -286,11 +286,21 @@ void EnzoBlock::instantiate_children() throw()
   int nx, ny, nz;
   data()->field().size(&nx, &ny, &nz);
 
+  // with Mesh:initial_bulk_insert the children were already inserted
+  // by EnzoFactory::create_block_array()
+  const bool insert = ! cello::config()->mesh_initial_bulk_insert;
+
   const int rank = cello::rank();
   ItChild it_child(rank);
   int ic3[3];
   while (it_child.next(ic3)) {
     Index index_child = index_.index_child(ic3);
+
+    if (! insert) {
+      children_.push_back(index_child);
+      continue;
+    }
+
     DataMsg * data_msg = NULL;
 
     MsgRefine * msg = new MsgRefine
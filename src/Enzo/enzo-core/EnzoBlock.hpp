@@ -123,6 +123,7 @@ public: /// entry methods
   //--------------------------------------------------
 
   // EnzoMethodBalance
+  void p_method_balance_load(int n, double * loads);
   void p_method_balance_migrate();
   void p_method_balance_done();
 
@@ -151,10 +152,17 @@ public: /// entry methods
 
   /// Call to Block array to self-identify as "first" when writing
   /// checkpoint files based on Ordering object
-  void p_check_write_first(int num_files, std::string ordering, std::string);
+  void p_check_write_first(int num_files, std::string ordering,
+                           bool is_delta, std::string);
 
   /// Call to single Block to return data for checkpoint
-  void p_check_write_next(int num_files, std::string ordering);
+  void p_check_write_next(int num_files, std::string ordering,
+                          bool is_delta);
+
+  /// Call to Block array to stage a snapshot of each Block and send
+  /// it to its IoEnzoWriter without waiting for it to be written
+  void p_check_write_async(int num_files, std::string ordering,
+                           bool is_delta, std::string name_dir);
 
   /// Exit EnzoMethodCheck
   void p_check_done();
@@ -194,6 +202,15 @@ public: /// entry methods
   /// EnzoSolverCg entry method: DOT(R,R)
   void r_solver_cg_loop_5 (CkReductionMsg * msg);
 
+  /// EnzoSolverCg (pipelined) entry method: W = MATVEC (A,R)
+  void p_solver_cg_pipe_w ();
+
+  /// EnzoSolverCg (pipelined) entry method: Q = MATVEC (A,W)
+  void p_solver_cg_pipe_q ();
+
+  /// EnzoSolverCg (pipelined) entry method: fused DOT(R,R), DOT(W,R)
+  void r_solver_cg_pipe_dot (CkReductionMsg * msg);
+
   /// EnzoSolverCg entry method:
   /// perform the necessary reductions for shift
   CkReductionMsg * r_solver_cg_shift(int n, CkReductionMsg ** msgs);
@@ -250,6 +267,14 @@ public: /// entry methods
   void r_solver_dd_barrier(CkReductionMsg* msg);
   void r_solver_dd_end(CkReductionMsg* msg);
 
+  // EnzoSolverBlockMg
+
+  void p_solver_block_mg_continue();
+
+  // EnzoSolverChebyshev
+
+  void p_solver_chebyshev_continue();
+
   // EnzoSolverJacobi
 
   void p_solver_jacobi_continue();
@@ -269,6 +294,13 @@ public: /// entry methods
   // EnzoMethodFeedbackSTARSS
   void p_method_feedback_starss_end();
 
+  // EnzoMethodFofHalos
+  void p_method_fof_halos_link();
+  void r_method_fof_halos_linked(CkReductionMsg * msg);
+
+  // EnzoMethodHeat
+  void p_method_heat_stage();
+
   //EnzoMethodM1Closure
   void p_method_m1_closure_solve_transport_eqn();
   void p_method_m1_closure_set_global_averages(CkReductionMsg * msg);
@@ -292,13 +324,21 @@ protected: // methods
   /// Create EnzoMsgCheck, returning file index
   int create_msg_check_
   ( EnzoMsgCheck ** msg_check, int num_files, std::string ordering,
-    std::string name_dir = "", bool * is_first = nullptr);
+    bool is_delta, std::string name_dir = "", bool * is_first = nullptr);
+
+  /// Compare field hashes with those saved at the last full
+  /// checkpoint, setting the base file of unchanged fields for a
+  /// delta checkpoint, or saving new hashes for a full one
+  void check_delta_fields_
+  ( EnzoMsgCheck * msg_check, bool is_delta, int index_file);
 
   /// Initialize restart data in Block
   void restart_set_data_(EnzoMsgCheck * );
 
-  /// Create a DataMsg object for this block
-  DataMsg *create_data_msg_();
+  /// Create a DataMsg object for this block with the Block's data, omitting fields with
+  /// non-negative field_base_file entries
+  DataMsg *create_data_msg_
+  (const std::vector<int> & field_base_file = std::vector<int>());
 
 protected: // attributes
 
@@ -15,7 +15,8 @@ EnzoBoundary::EnzoBoundary
 (axis_enum axis, face_enum face, std::shared_ptr<Mask> mask,
  boundary_type type) throw()
   : Boundary(axis,face,mask),
-    boundary_type_ (type)
+    boundary_type_ (type),
+    coords_()
 {  }
 
 //----------------------------------------------------------------------
@@ -89,6 +90,81 @@ bool EnzoBoundary::has_vector_name_(std::string field_name,
 }
 
 
+//----------------------------------------------------------------------
+
+void EnzoBoundary::ghost_coordinates_
+(Block * block, int index_field,
+ double ** x, double ** y, double ** z) const throw()
+{
+  // coordinates are only needed to evaluate the mask
+  if (! mask_) {
+    (*x) = (*y) = (*z) = nullptr;
+    return;
+  }
+
+  Data * data = block->data();
+  Field field = data->field();
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+  int gx,gy,gz;
+  field.ghost_depth(index_field,&gx,&gy,&gz);
+  int cx,cy,cz;
+  field.centering(index_field,&cx,&cy,&cz);
+
+  coords_[0].resize(nx+2*gx+cx);
+  coords_[1].resize(ny+2*gy+cy);
+  coords_[2].resize(nz+2*gz+cz);
+
+  data->field_cell_faces(coords_[0].data(),coords_[1].data(),
+                         coords_[2].data(),gx,gy,gz,cx,cy,cz);
+
+  (*x) = coords_[0].data();
+  (*y) = coords_[1].data();
+  (*z) = coords_[2].data();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBoundary::copy_plane_
+(enzo_float * array, int mx, int my, int mz,
+ axis_enum axis, int i_dst, int i_src, enzo_float sign,
+ const double * x, const double * y, const double * z,
+ double face_coord, double t) const throw()
+{
+  // stride along the axis, and counts and strides of the inner and
+  // outer loops over the plane, with the inner loop unit stride when
+  // possible
+
+  const int da = (axis == axis_x) ? 1 : ((axis == axis_y) ? mx : mx*my);
+  const int n1 = (axis == axis_x) ? my : mx;
+  const int d1 = (axis == axis_x) ? mx : 1;
+  const int n2 = (axis == axis_z) ? my : mz;
+  const int d2 = (axis == axis_z) ? mx : mx*my;
+
+  enzo_float * dst = array + i_dst*da;
+  const enzo_float * src = array + i_src*da;
+
+  if (! mask_) {
+    for (int i2=0; i2<n2; i2++) {
+      for (int i1=0; i1<n1; i1++) {
+        dst[i1*d1 + i2*d2] = sign*src[i1*d1 + i2*d2];
+      }
+    }
+  } else {
+    for (int i2=0; i2<n2; i2++) {
+      for (int i1=0; i1<n1; i1++) {
+        const double xc = (axis == axis_x) ? face_coord : x[i1];
+        const double yc = (axis == axis_x) ? y[i1] :
+          ((axis == axis_y) ? face_coord : y[i2]);
+        const double zc = (axis == axis_z) ? face_coord : z[i2];
+        if (mask_->evaluate(t,xc,yc,zc))
+          dst[i1*d1 + i2*d2] = sign*src[i1*d1 + i2*d2];
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------
 
 void EnzoBoundary::enforce_reflecting_
@@ -105,18 +181,6 @@ void EnzoBoundary::enforce_reflecting_
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
 
-  double * xc = new double [nx];
-  double * yc = new double [ny];
-  double * zc = new double [nz];
-
-  data->field_cells(xc,yc,zc);
-
-  double * xf = new double [nx+1];
-  double * yf = new double [ny+1];
-  double * zf = new double [nz+1];
-
-  data->field_cell_faces(xf,yf,zf);
-
   double xm,ym,zm;
   double xp,yp,zp;
   data -> lower(&xm,&ym,&zm);
@@ -137,10 +201,11 @@ void EnzoBoundary::enforce_reflecting_
     field.ghost_depth(index,&gx,&gy,&gz);
     int cx,cy,cz;
     field.centering(index, &cx,&cy,&cz);
-    double * x = (cx == 1) ? xf : xc;
-    double * y = (cy == 1) ? yf : yc;
-    double * z = (cz == 1) ? zf : zc;
- 
+
+    // coordinates of all cells including ghosts, or null if no mask
+    double *x, *y, *z;
+    ghost_coordinates_(block,index,&x,&y,&z);
+
     enzo_float * array = (enzo_float * ) field.values(index);
     bool vx = (rank >= 1) && has_vector_name_(field.field_name(index), "x");
     bool vy = (rank >= 2) && has_vector_name_(field.field_name(index), "y");
@@ -149,13 +214,6 @@ void EnzoBoundary::enforce_reflecting_
 				  nx,ny,nz, gx,gy,gz, cx,cy,cz, vx,vy,vz,
 				  x,y,z,    xm,ym,zm, xp,yp,zp, t);
   }
-
-  delete [] xc;
-  delete [] yc;
-  delete [] zc;
-  delete [] xf;
-  delete [] yf;
-  delete [] zf;
 }
 
 //----------------------------------------------------------------------
@@ -175,111 +233,38 @@ void EnzoBoundary::enforce_reflecting_precision_
  double t
  ) const throw()
 {
-  int mx = nx + 2*gx + cx;
-  int my = ny + 2*gy + cy;
-  int mz = nz + 2*gz + cz;
-
-  int ix,iy,iz,ig;
-  enzo_float sign;
-
-  if (nx > 1) {
-    if (face == face_lower && axis == axis_x) {
-      ix = gx+cx;
-      sign = vx ? -1.0 : 1.0;
-      for (ig=0; ig<gx; ig++) {
-	for (iy=0; iy<my; iy++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix+ig,     iy,iz,mx,my);
-	    int i_external = INDEX(ix-ig-1-cx,iy,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,xm,y[iy],z[iz]))
-	      array[i_external] = sign*array[i_internal];
-	  }
-	}
-      }
-    }
-    if (face == face_upper &&  axis == axis_x) {
-      ix = nx+gx-1;
-      sign = vx ? -1.0 : 1.0;
-      for (ig=0; ig<gx; ig++) {
-	for (iy=0; iy<my; iy++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix-ig,     iy,iz,mx,my);
-	    int i_external = INDEX(ix+ig+1+cx,iy,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,xp,y[iy],z[iz]))
-	      array[i_external] = sign*array[i_internal];
-	  }
-	}
-      }
-    }
-  } 
-
-  if (ny > 1) {
-    if (face == face_lower && axis == axis_y) {
-      iy = gy+cy;
-      sign = vy ? -1.0 : 1.0;
-      for (ig=0; ig<gy; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix,iy+ig,     iz,mx,my);
-	    int i_external = INDEX(ix,iy-ig-1-cy,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],ym,z[iz]))
-	      array[i_external] = sign*array[i_internal];
-	  }
-	}
-      }
-    } 
-    if (face == face_upper && axis == axis_y) {
-      iy = ny+gy-1;
-      sign = vy ? -1.0 : 1.0;
-      for (ig=0; ig<gy; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix,iy-ig,     iz,mx,my);
-	    int i_external = INDEX(ix,iy+ig+1+cy,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],yp,z[iz]))
-	      array[i_external] = sign*array[i_internal];
-	  }
-	}
-      }
-    }
-  }
-
-  if (nz > 1) {
-    if (face == face_lower && axis == axis_z) {
-      iz = gz+cz;
-      sign = vz ? -1.0 : 1.0;
-      for (ig=0; ig<gz; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iy=0; iy<my; iy++) {
-	    int i_internal = INDEX(ix,iy,iz+ig,     mx,my);
-	    int i_external = INDEX(ix,iy,iz-ig-1-cz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],y[iy],zm))
-	      array[i_external] = sign*array[i_internal];
-	  }
-	}
-      }
-    }
-    if (face == face_upper && axis == axis_z) {
-      iz = nz+gz-1;
-      sign = vz ? -1.0 : 1.0;
-      for (ig=0; ig<gz; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iy=0; iy<my; iy++) {
-	    int i_internal = INDEX(ix,iy,iz-ig,     mx,my);
-	    int i_external = INDEX(ix,iy,iz+ig+1+cz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],y[iy],zp))
-	      array[i_external] = sign*array[i_internal];
-	  }
-	}
-      }
-    }
-  }
-
   if (face == face_all) {
     ERROR("EnzoBoundary::enforce_reflecting_precision_",
 	  "Cannot be called with face_all");
   }
 
+  int mx = nx + 2*gx + cx;
+  int my = ny + 2*gy + cy;
+  int mz = nz + 2*gz + cz;
+
+  const int n3[3] = {nx,ny,nz};
+  const int g3[3] = {gx,gy,gz};
+  const int c3[3] = {cx,cy,cz};
+  const bool v3[3] = {vx,vy,vz};
+
+  if (axis == axis_all || n3[axis] <= 1) return;
+
+  const int n = n3[axis];
+  const int g = g3[axis];
+  const int c = c3[axis];
+  const enzo_float sign = v3[axis] ? -1.0 : 1.0;
+  const double face_coord = (face == face_lower) ?
+    ((axis == axis_x) ? xm : ((axis == axis_y) ? ym : zm)) :
+    ((axis == axis_x) ? xp : ((axis == axis_y) ? yp : zp));
+
+  for (int ig=0; ig<g; ig++) {
+    // ghost zone ig mirrors the interior zone the same distance from
+    // the face
+    const int i_internal = (face == face_lower) ? g+c+ig   : n+g-1-ig;
+    const int i_external = (face == face_lower) ? g-ig-1   : n+g+ig+c;
+    copy_plane_(array,mx,my,mz,axis,i_external,i_internal,sign,
+                x,y,z,face_coord,t);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -298,18 +283,6 @@ void EnzoBoundary::enforce_outflow_
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
 
-  double * xc = new double [nx];
-  double * yc = new double [ny];
-  double * zc = new double [nz];
-
-  data->field_cells(xc,yc,zc);
-
-  double * xf = new double [nx+1];
-  double * yf = new double [ny+1];
-  double * zf = new double [nz+1];
-
-  data->field_cell_faces(xf,yf,zf);
-
   double xm,ym,zm;
   double xp,yp,zp;
   data -> lower(&xm,&ym,&zm);
@@ -331,9 +304,10 @@ void EnzoBoundary::enforce_outflow_
 
     int cx,cy,cz;
     field.centering(index, &cx,&cy,&cz);
-    double * x = (cx == 1) ? xf : xc;
-    double * y = (cy == 1) ? yf : yc;
-    double * z = (cz == 1) ? zf : zc;
+
+    // coordinates of all cells including ghosts, or null if no mask
+    double *x, *y, *z;
+    ghost_coordinates_(block,index,&x,&y,&z);
     
     enzo_float * array = (enzo_float * ) field.values(index);
 
@@ -342,13 +316,6 @@ void EnzoBoundary::enforce_outflow_
 			       x,y,z,    xm,ym,zm, xp,yp,zp, t);
     
   }
-  delete [] xc;
-  delete [] yc;
-  delete [] zc;
-
-  delete [] xf;
-  delete [] yf;
-  delete [] zf;
 }
 
 //----------------------------------------------------------------------
@@ -367,101 +334,35 @@ void EnzoBoundary::enforce_outflow_precision_
  double t
 ) const throw()
 {
+  if (face == face_all || axis == axis_all) {
+    ERROR("EnzoBoundary::enforce_outflow_precision_",
+	  "Cannot be called with face_all");
+  }
+
   int mx = nx + 2*gx + cx;
   int my = ny + 2*gy + cy;
   int mz = nz + 2*gz + cz;
 
-  int ix,iy,iz,ig;
-
-  if (face == face_lower && axis == axis_x) {
-    if (nx > 1) {
-      ix = gx;
-      for (ig=0; ig<gx; ig++) {
-	for (iy=0; iy<my; iy++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix,     iy,iz,mx,my);
-	    int i_external = INDEX(ix-ig-1,iy,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,xm,y[iy],z[iz]))
-	      array[i_external] = array[i_internal];
-	  }
-	}
-      }
-    }
-  } else if (face == face_upper && axis == axis_x) {
-    if (nx > 1) {
-      ix = nx+gx-1+cx;
-      for (ig=0; ig<gx; ig++) {
-	for (iy=0; iy<my; iy++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix,     iy,iz,mx,my);
-	    int i_external = INDEX(ix+ig+1,iy,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,xp,y[iy],z[iz]))
-	      array[i_external] = array[i_internal];
-	  }
-	}
-      }
-    }
-  } else if (face == face_lower && axis == axis_y) {
-    if (ny > 1) {
-      iy = gy;
-      for (ig=0; ig<gy; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix,iy,     iz,mx,my);
-	    int i_external = INDEX(ix,iy-ig-1,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],ym,z[iz]))
-	      array[i_external] = array[i_internal];
-	  }
-	}
-      }
-    }
-  } else if (face == face_upper && axis == axis_y) {
-    if (ny > 1) {
-      iy = ny+gy-1+cy;
-      for (ig=0; ig<gy; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iz=0; iz<mz; iz++) {
-	    int i_internal = INDEX(ix,iy,     iz,mx,my);
-	    int i_external = INDEX(ix,iy+ig+1,iz,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],yp,z[iz]))
-	      array[i_external] = array[i_internal];
-	  }
-	}
-      }
-    }
-  } else if (face == face_lower && axis == axis_z) {
-    if (nz > 1) {
-      iz = gz;
-      for (ig=0; ig<gz; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iy=0; iy<my; iy++) {
-	    int i_internal = INDEX(ix,iy,iz,     mx,my);
-	    int i_external = INDEX(ix,iy,iz-ig-1,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],y[iy],zm))
-	      array[i_external] = array[i_internal];
-	  }
-	}
-      }
-    }
-  } else if (face == face_upper && axis == axis_z) {
-    if (nz > 1) {
-      iz = nz+gz-1+cz;
-      for (ig=0; ig<gz; ig++) {
-	for (ix=0; ix<mx; ix++) {
-	  for (iy=0; iy<my; iy++) {
-	    int i_internal = INDEX(ix,iy,iz,     mx,my);
-	    int i_external = INDEX(ix,iy,iz+ig+1,mx,my);
-	    if (! mask_ || mask_->evaluate(t,x[ix],y[iy],zp))
-	      array[i_external] = array[i_internal];
-	  }
-	}
-      }
-    }
-  } else {
-    ERROR("EnzoBoundary::enforce_outflow_precision_",
-	  "Cannot be called with face_all");
+  const int n3[3] = {nx,ny,nz};
+  const int g3[3] = {gx,gy,gz};
+  const int c3[3] = {cx,cy,cz};
+
+  if (n3[axis] <= 1) return;
+
+  const int n = n3[axis];
+  const int g = g3[axis];
+  const int c = c3[axis];
+  const double face_coord = (face == face_lower) ?
+    ((axis == axis_x) ? xm : ((axis == axis_y) ? ym : zm)) :
+    ((axis == axis_x) ? xp : ((axis == axis_y) ? yp : zp));
+
+  // all ghost zones copy the interior zone adjacent to the face
+  const int i_internal = (face == face_lower) ? g : n+g-1+c;
+  for (int ig=0; ig<g; ig++) {
+    const int i_external = (face == face_lower) ? g-ig-1 : n+g+c+ig;
+    copy_plane_(array,mx,my,mz,axis,i_external,i_internal,1.0,
+                x,y,z,face_coord,t);
   }
 }
 
 //----------------------------------------------------------------------
-
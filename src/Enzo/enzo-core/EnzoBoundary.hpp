@@ -39,7 +39,8 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoBoundary (CkMigrateMessage *m)
     : Boundary(m),
-      boundary_type_(boundary_type_undefined)
+      boundary_type_(boundary_type_undefined),
+      coords_()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -77,6 +78,20 @@ protected: // functions
     double xp, double yp, double zp,
     double t) const throw();
 
+  /// Copy plane i_src along the axis to plane i_dst, scaled by sign,
+  /// where the mask is true at (x,y,z) with face_coord along the axis
+  void copy_plane_
+  ( enzo_float * array, int mx, int my, int mz,
+    axis_enum axis, int i_dst, int i_src, enzo_float sign,
+    const double * x, const double * y, const double * z,
+    double face_coord, double t) const throw();
+
+  /// Return coordinates of the field's cells including ghost zones in
+  /// x,y,z, or null if there is no mask to evaluate
+  void ghost_coordinates_
+  ( Block * block, int index_field,
+    double ** x, double ** y, double ** z) const throw();
+
   /// Checks if the field name matches one of the vector fields
   bool has_vector_name_(std::string field_name,
 			std::string component) const throw();
@@ -117,6 +132,9 @@ protected: // attributes
   // Type of boundary conditions
   boundary_type boundary_type_;
 
+  /// Scratch cell coordinates for evaluating the mask (not packed)
+  mutable std::vector<double> coords_[3];
+
 };
 
 #endif /* ENZO_ENZO_BOUNDARY_HPP */
@@ -57,6 +57,7 @@ EnzoConfig::EnzoConfig() throw ()
   initial_hdf5_format(),
   initial_hdf5_blocking(),
   initial_hdf5_monitor_iter(),
+  initial_hdf5_mmap(false),
   initial_hdf5_field_files(),
   initial_hdf5_field_datasets(),
   initial_hdf5_field_names(),
@@ -137,6 +138,13 @@ EnzoConfig::EnzoConfig() throw ()
   method_check_dir(),
   method_check_monitor_iter(0),
   method_check_include_ghosts(false),
+  method_check_async(false),
+  method_check_max_staged_mb(0),
+  method_check_delta_interval(0),
+  method_check_memory_interval(0),
+  method_check_num_aggregators(0),
+  method_check_stripe_size(0),
+  method_check_format("hdf5"),
   // EnzoInitialMergeSinksTest
   initial_merge_sinks_test_particle_data_filename(""),
   // EnzoInitialAccretionTest
@@ -171,11 +179,17 @@ EnzoConfig::EnzoConfig() throw ()
   solver_coarse_solve(),
   solver_domain_solve(),
   solver_weight(),
+  solver_sweeps_per_refresh(),
+  solver_eigenvalue_ratio(),
+  solver_num_cycles(),
   solver_restart_cycle(),
   /// EnzoSolver<Krylov>
   solver_precondition(),
+  solver_pipelined(),
   solver_coarse_level(),
   solver_is_unigrid(),
+  solver_isolated(),
+  solver_overlap(),
   stopping_redshift()
 
 {
@@ -259,6 +273,7 @@ void EnzoConfig::pup (PUP::er &p)
   p | initial_hdf5_format;
   PUParray(p, initial_hdf5_blocking,3);
   p | initial_hdf5_monitor_iter;
+  p | initial_hdf5_mmap;
   p | initial_hdf5_field_files;
   p | initial_hdf5_field_datasets;
   p | initial_hdf5_field_names;
@@ -334,6 +349,13 @@ void EnzoConfig::pup (PUP::er &p)
   p | method_check_dir;
   p | method_check_monitor_iter;
   p | method_check_include_ghosts;
+  p | method_check_async;
+  p | method_check_max_staged_mb;
+  p | method_check_delta_interval;
+  p | method_check_memory_interval;
+  p | method_check_num_aggregators;
+  p | method_check_stripe_size;
+  p | method_check_format;
 
   p | method_inference_level_base;
   p | method_inference_level_array;
@@ -369,10 +391,16 @@ void EnzoConfig::pup (PUP::er &p)
   p | solver_coarse_solve;
   p | solver_domain_solve;
   p | solver_weight;
+  p | solver_sweeps_per_refresh;
+  p | solver_eigenvalue_ratio;
+  p | solver_num_cycles;
   p | solver_restart_cycle;
   p | solver_precondition;
+  p | solver_pipelined;
   p | solver_coarse_level;
   p | solver_is_unigrid;
+  p | solver_isolated;
+  p | solver_overlap;
 
   p | stopping_redshift;
 
@@ -518,6 +546,8 @@ void EnzoConfig::read_initial_hdf5_(Parameters * p)
 
   initial_hdf5_monitor_iter = p->value_integer (name_initial + "monitor_iter", 0);
 
+  initial_hdf5_mmap = p->value_logical (name_initial + "mmap", false);
+
   const int num_files = p->list_length (name_initial + "file_list");
 
   for (int index_file=0; index_file<num_files; index_file++) {
@@ -890,6 +920,58 @@ void EnzoConfig::read_method_check_(Parameters * p)
   }
   method_check_monitor_iter   = p->value_integer("monitor_iter",0);
   method_check_include_ghosts = p->value_logical("include_ghosts",false);
+  method_check_async          = p->value_logical("async",false);
+  method_check_max_staged_mb  = p->value_integer("max_staged_mb",0);
+  method_check_delta_interval = p->value_integer("delta_interval",0);
+  method_check_memory_interval = p->value_integer("memory_interval",0);
+  method_check_num_aggregators = p->value_integer("num_aggregators",0);
+  method_check_stripe_size     = p->value_integer("stripe_size",0);
+  method_check_format          = p->value_string("format","hdf5");
+
+  ASSERT1 ("EnzoConfig::read_method_check_()",
+           "Method:check:max_staged_mb = %d must be non-negative",
+           method_check_max_staged_mb,
+           method_check_max_staged_mb >= 0);
+
+  ASSERT1 ("EnzoConfig::read_method_check_()",
+           "Method:check:delta_interval = %d must be non-negative",
+           method_check_delta_interval,
+           method_check_delta_interval >= 0);
+
+  ASSERT1 ("EnzoConfig::read_method_check_()",
+           "Method:check:memory_interval = %d must be non-negative",
+           method_check_memory_interval,
+           method_check_memory_interval >= 0);
+
+  ASSERT2 ("EnzoConfig::read_method_check_()",
+           "Method:check:num_aggregators = %d must be 0 or a multiple "
+           "of Method:check:num_files = %d",
+           method_check_num_aggregators,method_check_num_files,
+           (method_check_num_aggregators >= 0 &&
+            method_check_num_aggregators % method_check_num_files == 0));
+
+  ASSERT ("EnzoConfig::read_method_check_()",
+          "Method:check:num_aggregators cannot be used with "
+          "Method:check:async",
+          ! (method_check_num_aggregators > 0 && method_check_async));
+
+  ASSERT1 ("EnzoConfig::read_method_check_()",
+           "Method:check:stripe_size = %d must be non-negative",
+           method_check_stripe_size,
+           method_check_stripe_size >= 0);
+
+  ASSERT1 ("EnzoConfig::read_method_check_()",
+           "Method:check:format = \"%s\" must be \"hdf5\" or \"native\"",
+           method_check_format.c_str(),
+           (method_check_format == "hdf5" ||
+            method_check_format == "native"));
+
+  ASSERT ("EnzoConfig::read_method_check_()",
+          "Method:check:format = \"native\" cannot be used with "
+          "Method:check:num_aggregators or Method:check:delta_interval",
+          ! (method_check_format == "native" &&
+             (method_check_num_aggregators > 0 ||
+              method_check_delta_interval > 0)));
 }
 
 //----------------------------------------------------------------------
@@ -1403,10 +1485,16 @@ void EnzoConfig::read_solvers_(Parameters * p)
   solver_post_smooth. resize(num_solvers);
   solver_last_smooth. resize(num_solvers);
   solver_weight.      resize(num_solvers);
+  solver_sweeps_per_refresh.resize(num_solvers);
+  solver_eigenvalue_ratio.resize(num_solvers);
+  solver_num_cycles.resize(num_solvers);
   solver_restart_cycle.resize(num_solvers);
   solver_precondition.resize(num_solvers);
+  solver_pipelined.resize(num_solvers);
   solver_coarse_level.resize(num_solvers);
   solver_is_unigrid.resize(num_solvers);
+  solver_isolated.resize(num_solvers);
+  solver_overlap.resize(num_solvers);
 
   for (int index_solver=0; index_solver<num_solvers; index_solver++) {
 
@@ -1460,9 +1548,21 @@ void EnzoConfig::read_solvers_(Parameters * p)
     solver_weight[index_solver] =
       p->value_float(solver_name + ":weight",1.0);
 
+    solver_sweeps_per_refresh[index_solver] =
+      p->value_integer(solver_name + ":sweeps_per_refresh",1);
+
+    solver_eigenvalue_ratio[index_solver] =
+      p->value_float(solver_name + ":eigenvalue_ratio",30.0);
+
+    solver_num_cycles[index_solver] =
+      p->value_integer(solver_name + ":num_cycles",1);
+
     solver_restart_cycle[index_solver] =
       p->value_integer(solver_name + ":restart_cycle",1);
 
+    solver_pipelined[index_solver] =
+      p->value_logical (solver_name + ":pipelined",false);
+
     solver_coarse_level[index_solver] =
       p->value_integer (solver_name + ":coarse_level",
                         solver_min_level[index_solver]);
@@ -1470,6 +1570,12 @@ void EnzoConfig::read_solvers_(Parameters * p)
     solver_is_unigrid[index_solver] =
       p->value_logical (solver_name + ":is_unigrid",false);
 
+    solver_isolated[index_solver] =
+      p->value_logical (solver_name + ":isolated",false);
+
+    solver_overlap[index_solver] =
+      p->value_integer (solver_name + ":overlap",0);
+
   }
 }
 
@@ -105,6 +105,7 @@ public: // interface
       initial_hdf5_format(),
       initial_hdf5_max_level(),
       initial_hdf5_monitor_iter(),
+      initial_hdf5_mmap(false),
       initial_hdf5_particle_attributes(),
       initial_hdf5_particle_levels(),
       initial_hdf5_particle_coords(),
@@ -188,6 +189,14 @@ public: // interface
       method_check_ordering("order_morton"),
       method_check_dir(),
       method_check_monitor_iter(0),
+      method_check_include_ghosts(false),
+      method_check_async(false),
+      method_check_max_staged_mb(0),
+      method_check_delta_interval(0),
+      method_check_memory_interval(0),
+      method_check_num_aggregators(0),
+      method_check_stripe_size(0),
+      method_check_format("hdf5"),
       // EnzoMethodCheckGravity
       method_check_gravity_particle_type(),
       // EnzoMethodTurbulence
@@ -210,11 +219,17 @@ public: // interface
       solver_coarse_solve(),
       solver_domain_solve(),
       solver_weight(),
+      solver_sweeps_per_refresh(),
+      solver_eigenvalue_ratio(),
+      solver_num_cycles(),
       solver_restart_cycle(),
       // EnzoSolver<Krylov>
       solver_precondition(),
+      solver_pipelined(),
       solver_coarse_level(),
       solver_is_unigrid(),
+      solver_isolated(),
+      solver_overlap(),
       // EnzoStopping
       stopping_redshift()
 
@@ -337,6 +352,7 @@ public: // attributes
   std::string                 initial_hdf5_format;
   int                         initial_hdf5_blocking[3];
   int                         initial_hdf5_monitor_iter;
+  bool                        initial_hdf5_mmap;
   std::vector < std::string > initial_hdf5_field_files;
   std::vector < std::string > initial_hdf5_field_datasets;
   std::vector < std::string > initial_hdf5_field_names;
@@ -454,6 +470,13 @@ public: // attributes
   std::vector<std::string>   method_check_dir;
   int                        method_check_monitor_iter;
   bool                       method_check_include_ghosts;
+  bool                       method_check_async;
+  int                        method_check_max_staged_mb;
+  int                        method_check_delta_interval;
+  int                        method_check_memory_interval;
+  int                        method_check_num_aggregators;
+  int                        method_check_stripe_size;
+  std::string                method_check_format;
 
   /// EnzoMethodCheckGravity
   std::string                method_check_gravity_particle_type;
@@ -501,6 +524,18 @@ public: // attributes
 
   std::vector<double>        solver_weight;
 
+  /// Number of smoothing sweeps between ghost zone refreshes
+
+  std::vector<int>           solver_sweeps_per_refresh;
+
+  /// Ratio of largest to smallest eigenvalue targeted by Chebyshev smoother
+
+  std::vector<double>        solver_eigenvalue_ratio;
+
+  /// Number of V-cycles per application of a Block-local multigrid solver
+
+  std::vector<int>           solver_num_cycles;
+
   /// Whether to start the iterative solver using the previous solution
 
   std::vector<int>           solver_restart_cycle;
@@ -510,11 +545,20 @@ public: // attributes
   /// Solver index for Krylov solver preconditioner
   std::vector<int>           solver_precondition;
 
+  /// Whether to use the pipelined (single-reduction) Krylov variant
+  std::vector<int>           solver_pipelined;
+
   /// Mg0 coarse grid solver
 
   std::vector<int>           solver_coarse_level;
   std::vector<int>           solver_is_unigrid;
 
+  /// EnzoSolverFft: whether to compute the isolated solution
+  std::vector<int>           solver_isolated;
+
+  /// EnzoSolverBlockMg: ghost layers of overlap between Blocks
+  std::vector<int>           solver_overlap;
+
   /// Stop at specified redshift for cosmology
   double                     stopping_redshift;
 
@@ -102,6 +102,11 @@ void EnzoFactory::create_block_array
           // Use MappingArray initial mapping
           //  proxy_enzo_simulation[ip].p_refine_create_block (msg);
           enzo::simulation()->refine_create_block(msg);
+
+          if (cello::config()->mesh_initial_bulk_insert) {
+            create_initial_descendants_
+              (index,nx,ny,nz,num_field_blocks);
+          }
         }
       }
     }
@@ -112,6 +117,71 @@ void EnzoFactory::create_block_array
 
 //----------------------------------------------------------------------
 
+void EnzoFactory::create_initial_descendants_
+(Index index,
+ int nx, int ny, int nz,
+ int num_field_blocks) const throw()
+{
+  if (! is_initial_refined_(index)) return;
+
+  // Same messages as EnzoBlock::instantiate_children(), whose
+  // children's face levels are all zero and whose Adapt neighbors
+  // are rebuilt by Block::init_adapt_() when not given
+
+  int face_level[27] = {0};
+
+  const int rank = cello::rank();
+  ItChild it_child(rank);
+  int ic3[3];
+  while (it_child.next(ic3)) {
+    Index index_child = index.index_child(ic3);
+
+    MsgRefine * msg = new MsgRefine
+      (index_child,
+       nx,ny,nz,
+       num_field_blocks,
+       0,
+       0,0.0,0.0,
+       refresh_fine,
+       27, face_level,
+       nullptr);
+
+    msg->set_data_msg(NULL);
+
+    enzo::simulation()->refine_create_block(msg);
+
+    create_initial_descendants_(index_child,nx,ny,nz,num_field_blocks);
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoFactory::is_initial_refined_ (Index index) const throw()
+{
+  // see Block::refine_during_initialization()
+  const int level = index.level();
+  const auto & regions_lower = cello::config()->refined_regions_lower;
+  const auto & regions_upper = cello::config()->refined_regions_upper;
+  if (level < 0 || level + 1 > (int) regions_lower.size()) return false;
+
+  // global Block index at this level
+  int i3[3];
+  index.array(i3,i3+1,i3+2);
+  for (int i=0; i<level; i++) {
+    int ic3[3];
+    index.child(i+1,ic3,ic3+1,ic3+2);
+    for (int axis=0; axis<3; axis++) i3[axis] = (i3[axis] << 1) | ic3[axis];
+  }
+
+  const std::vector<int> & lower = regions_lower.at(level);
+  const std::vector<int> & upper = regions_upper.at(level);
+  return ((lower.at(0) <= i3[0] && i3[0] < upper.at(0)) &&
+          (lower.at(1) <= i3[1] && i3[1] < upper.at(1)) &&
+          (lower.at(2) <= i3[2] && i3[2] < upper.at(2)));
+}
+
+//----------------------------------------------------------------------
+
 void EnzoFactory::create_subblock_array
 (
  DataMsg * data_msg,
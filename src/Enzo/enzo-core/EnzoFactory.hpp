@@ -81,6 +81,18 @@ public: // interface
    Simulation * simulation = 0,
    int io_reader = -1,
    int ip = -1) const throw();
+
+private: // functions
+
+  /// Insert the descendants of the given Block in the initially
+  /// refined regions on this process (Mesh:initial_bulk_insert)
+  void create_initial_descendants_
+  (Index index,
+   int nx, int ny, int nz,
+   int num_field_blocks) const throw();
+
+  /// Whether the given Block is in its level's initially refined region
+  bool is_initial_refined_ (Index index) const throw();
 };
 
 #endif /* ENZO_ENZO_FACTORY_HPP */
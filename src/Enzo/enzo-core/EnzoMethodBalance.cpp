@@ -11,9 +11,23 @@
 // #define TRACE_BALANCE
 //----------------------------------------------------------------------
 
-EnzoMethodBalance::EnzoMethodBalance()
-  : Method()
+EnzoMethodBalance::EnzoMethodBalance(ParameterGroup p)
+  : Method(),
+    ip_next_(-1),
+    incremental_(false),
+    tolerance_(p.value_float("tolerance",0.05)),
+    max_migrate_fraction_(p.value_float("max_migrate_fraction",0.1)),
+    is_count_(-2),
+    is_index_(-2),
+    is_cost_self_(-2),
+    is_cost_index_(-2),
+    is_cost_total_(-2)
 {
+  const std::string mode = p.value_string("mode","full");
+  ASSERT1 ("EnzoMethodBalance::EnzoMethodBalance()",
+           "Method:balance:mode \"%s\" must be \"full\" or \"incremental\"",
+           mode.c_str(), (mode == "full" || mode == "incremental"));
+  incremental_ = (mode == "incremental");
 
   cello::define_field("density");
   // Initialize default Refresh object
@@ -33,6 +47,9 @@ void EnzoMethodBalance::pup (PUP::er &p)
 
   Method::pup(p);
 
+  p | incremental_;
+  p | tolerance_;
+  p | max_migrate_fraction_;
 }
 
 //----------------------------------------------------------------------
@@ -49,46 +66,224 @@ void EnzoMethodBalance::compute ( Block * block) throw()
   if (block->index().is_root())
     monitor->print("Method", "Calling Cello load-balancer");
 
-  ScalarDescr * sd = cello::scalar_descr_long_long();
-  const int is_count = sd->index("order_hilbert:count") == -1 ? sd->index("order_morton:count") : sd->index("order_hilbert:count");
-  const int is_index = sd->index("order_hilbert:index") == -1 ? sd->index("order_morton:index") : sd->index("order_hilbert:index");
+  if (incremental_) {
+
+    // Sum Block costs on each process to find process loads
+
+    double cost_self, cost_index, cost_total;
+    block_cost_(block,&cost_self,&cost_index,&cost_total);
+
+    std::vector<double> loads (CkNumPes(),0.0);
+    loads[CkMyPe()] = cost_self;
+
+    CkCallback callback
+      (CkIndex_EnzoSimulation::r_method_balance_load(nullptr), 0,
+       proxy_enzo_simulation);
+
+    block->contribute(loads.size()*sizeof(double), loads.data(),
+                      CkReduction::sum_double, callback);
+    return;
+  }
+
+  double cost_self, cost_index, cost_total;
+  block_cost_(block,&cost_self,&cost_index,&cost_total);
+
+  find_scalars_();
   Scalar<long long> scalar(cello::scalar_descr_long_long(),
                      block->data()->scalar_data_long_long());
 
-  int count = *scalar.value(is_count);
-  int index = *scalar.value(is_index);
+  int count = *scalar.value(is_count_);
+  int index = *scalar.value(is_index_);
   int ip_next = (long long) CkNumPes()*index/count;
 
-  block->set_ip_next(ip_next);
+  // If the ordering measured Block costs, partition the curve by
+  // cumulative cost instead of Block count, placing each Block by the
+  // midpoint of its cost interval
+
+  if (is_cost_total_ >= 0) {
+    if (cost_total > 0.0) {
+      ip_next = CkNumPes()*(cost_index + 0.5*cost_self)/cost_total;
+      ip_next = std::min(std::max(ip_next,0),CkNumPes()-1);
+    }
+  }
+
 #ifdef TRACE_BALANCE
   CkPrintf ("self_balance %d %d %d %d\n", count, index,ip_next,CkMyPe());
 #endif
 
-  int count_local = 0;
+  count_migrate_(block,ip_next);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::r_method_balance_load(CkReductionMsg * msg)
+{
+  const int n = msg->getSize()/sizeof(double);
+  double * loads = (double *)msg->getData();
+  enzo::block_array().p_method_balance_load(n,loads);
+  delete msg;
+}
+
+void EnzoBlock::p_method_balance_load(int n, double * loads)
+{
+  static_cast<EnzoMethodBalance*> (method())->do_load(this,n,loads);
+}
+
+void EnzoMethodBalance::do_load
+(EnzoBlock * enzo_block, int n, const double * loads)
+{
+  count_migrate_(enzo_block,ip_incremental_(enzo_block,n,loads));
+}
+
+//----------------------------------------------------------------------
+
+int EnzoMethodBalance::ip_incremental_
+(Block * block, int n, const double * loads) const
+{
+  double cost_self, cost_index, cost_total;
+  block_cost_(block,&cost_self,&cost_index,&cost_total);
+
+  const int ip = CkMyPe();
+  const double position = cost_index + 0.5*cost_self;
+
+  // Segment of the curve held by this process, assuming processes
+  // hold consecutive segments in process order
+
+  double lower = 0.0;
+  double load_total = 0.0;
+  for (int i=0; i<n; i++) {
+    if (i < ip) lower += loads[i];
+    load_total += loads[i];
+  }
+  const double upper = lower + loads[ip];
+
+  if (! (lower <= position && position <= upper)) {
+    // Block is not in this process's segment (e.g. the curve changed
+    // after refinement), so place it as in full mode
+    const int ip_next = n*position/cost_total;
+    return std::min(std::max(ip_next,0),n-1);
+  }
+
+  // Shift half the load difference across each boundary whose
+  // neighbors differ by more than the tolerance
+
+  const double mean = load_total / n;
+  std::vector<double> flow (n,0.0);
+  double flow_total = 0.0;
+  for (int i=0; i<n-1; i++) {
+    const double difference = loads[i] - loads[i+1];
+    if (std::abs(difference) > tolerance_*mean) {
+      flow[i] = 0.5*difference;
+      flow_total += std::abs(flow[i]);
+    }
+  }
+
+  // Scale flows to keep within the migration budget
+
+  const double budget = max_migrate_fraction_*load_total;
+  const double scale = (flow_total > budget) ? budget / flow_total : 1.0;
+
+  const double flow_up   = (ip < n-1) ?  scale*flow[ip]   : 0.0;
+  const double flow_down = (ip > 0)   ? -scale*flow[ip-1] : 0.0;
+
+  if (flow_up > 0.0 && position > upper - flow_up) return ip + 1;
+  if (flow_down > 0.0 && position < lower + flow_down) return ip - 1;
+  return ip;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodBalance::block_cost_
+(Block * block, double * cost_self,
+ double * cost_index, double * cost_total) const
+{
+  find_scalars_();
+
+  if (is_cost_total_ >= 0) {
+    Scalar<double> scalar(cello::scalar_descr_double(),
+                          block->data()->scalar_data_double());
+    *cost_self  = *scalar.value(is_cost_self_);
+    *cost_index = *scalar.value(is_cost_index_);
+    *cost_total = *scalar.value(is_cost_total_);
+  } else {
+    Scalar<long long> scalar(cello::scalar_descr_long_long(),
+                             block->data()->scalar_data_long_long());
+    *cost_self  = 1.0;
+    *cost_index = *scalar.value(is_index_);
+    *cost_total = *scalar.value(is_count_);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodBalance::find_scalars_() const
+{
+  if (is_count_ != -2) return;
+
+  // scalars of the ordering Method, either "order_hilbert" or
+  // "order_morton"
+  auto find = [] (const ScalarDescr * sd, std::string suffix)
+  {
+    const int i = sd->index("order_hilbert:" + suffix);
+    return (i == -1) ? sd->index("order_morton:" + suffix) : i;
+  };
+  const ScalarDescr * sd = cello::scalar_descr_long_long();
+  const ScalarDescr * sd_double = cello::scalar_descr_double();
+  is_index_      = find(sd,"index");
+  is_cost_self_  = find(sd_double,"cost_self");
+  is_cost_index_ = find(sd_double,"cost_index");
+  is_cost_total_ = find(sd_double,"cost_total");
+  is_count_      = find(sd,"count");
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodBalance::count_migrate_(Block * block, int ip_next)
+{
+  block->set_ip_next(ip_next);
+
+  // count migrating Blocks and their bytes
+
+  double count_local[2] = {0.0, 0.0};
   if (ip_next != CkMyPe()) {
 #ifdef TRACE_BALANCE
     CkPrintf ("TRACE_MIGRATE Method Counting %s from %d to %d\n",block->name().c_str(),CkMyPe(),ip_next);
 #endif
-    count_local = 1;
+    // bytes actually serialized by migrateMe(), which excludes
+    // reconstructible data such as coarse arrays
+    PUP::sizer sizer;
+    block->pup(sizer);
+    count_local[0] = 1.0;
+    count_local[1] = sizer.size();
+#ifdef TRACE_BALANCE
+    CkPrintf ("TRACE_MIGRATE Method Size %s %ld bytes\n",
+              block->name().c_str(),long(sizer.size()));
+#endif
   }
 
   CkCallback callback
     (CkIndex_EnzoSimulation::r_method_balance_count(nullptr), 0,
      proxy_enzo_simulation);
 
-  block->contribute(sizeof(int), &count_local,
-                    CkReduction::sum_int, callback);
+  block->contribute(2*sizeof(double), count_local,
+                    CkReduction::sum_double, callback);
 
 }
 
 void EnzoSimulation::r_method_balance_count(CkReductionMsg * msg)
 {
-  int * count_total = (int * )msg->getData();
+  double * count_total = (double * )msg->getData();
+  const int count = count_total[0];
+  const long long bytes = count_total[1];
+  delete msg;
 #ifdef TRACE_BALANCE
-  CkPrintf ("DEBUG_BALANCE block_count = %d\n",*count_total);
+  CkPrintf ("DEBUG_BALANCE block_count = %d\n",count);
   fflush(stdout);
 #endif
-  sync_method_balance_.set_stop(*count_total + 1);
+  cello::monitor()->print
+    ("Method", "balance migrating %d Blocks %lld bytes (%lld per Block)",
+     count,bytes,(count > 0) ? bytes/count : 0ll);
+  sync_method_balance_.set_stop(count + 1);
   // Initiate migration
   enzo::block_array().p_method_balance_migrate();
   // Include self-call of balance check to prevent hanging of
@@ -12,24 +12,42 @@ class EnzoMethodBalance : public Method {
 
   /// @class    EnzoMethodBalance
   /// @ingroup  Enzo
-  /// @brief    [\ref Enzo] Encapsulate Enzo's PPM hydro method
+  /// @brief    [\ref Enzo] Assign Blocks to processes along the
+  ///           space-filling curve of the ordering Method
+  ///
+  /// In "full" mode the curve is cut into equal-cost segments, one per
+  /// process.  In "incremental" mode only the boundaries between
+  /// processes adjacent along the curve move: where the load
+  /// difference between two neighbors exceeds the tolerance, half of
+  /// it is shifted across their boundary, and all shifts are scaled
+  /// to keep the migrated cost within a budget.  This avoids
+  /// migrating most Blocks by one process to fix a small imbalance.
 
 public: // interface
 
   /// Create a new EnzoMethodBalance object
-  EnzoMethodBalance();
+  EnzoMethodBalance(ParameterGroup p);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoMethodBalance);
 
   /// Charm++ PUP::able migration constructor
   EnzoMethodBalance (CkMigrateMessage *m)
-    : Method (m), ip_next_(-1)
+    : Method (m), ip_next_(-1),
+      incremental_(false),
+      tolerance_(0.0),
+      max_migrate_fraction_(0.0),
+      is_count_(-2),
+      is_index_(-2),
+      is_cost_self_(-2),
+      is_cost_index_(-2),
+      is_cost_total_(-2)
   {}
 
   /// CHARM++ Pack / Unpack function
   void pup (PUP::er &p);
 
+  void do_load(EnzoBlock * enzo_block, int n, const double * loads);
   void do_migrate(EnzoBlock * enzo_block);
   void done(EnzoBlock * enzo_block);
 
@@ -41,11 +59,47 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "balance"; }
 
+protected: // methods
+
+  /// Return the Block's cost, the cost of Blocks preceding it along
+  /// the curve, and the total cost, from the ordering Method's costs
+  /// if available or Block counts otherwise
+  void block_cost_(Block * block, double * cost_self,
+                   double * cost_index, double * cost_total) const;
+
+  /// Process for the Block in incremental mode given process loads
+  int ip_incremental_(Block * block, int n, const double * loads) const;
+
+  /// Set the Block's next process and count migrating Blocks
+  void count_migrate_(Block * block, int ip_next);
+
+  /// Look up the ordering Method's scalar indices, once per process
+  void find_scalars_() const;
+
 protected: // attributes
 
   /// Process to migrate to
   int ip_next_;
 
+  /// Whether to shift boundaries between neighboring processes only
+  bool incremental_;
+
+  /// Relative load difference between neighbors below which their
+  /// boundary is not moved
+  double tolerance_;
+
+  /// Maximum fraction of the total cost migrated in one step
+  double max_migrate_fraction_;
+
+  /// Indices of the ordering Method's Block count and index
+  /// (long long) and cost (double) scalars, -1 if absent, or -2 if
+  /// not yet looked up (not packed)
+  mutable int is_count_;
+  mutable int is_index_;
+  mutable int is_cost_self_;
+  mutable int is_cost_index_;
+  mutable int is_cost_total_;
+
 };
 
 #endif /* ENZO_ENZO_METHOD_BALANCE_HPP */
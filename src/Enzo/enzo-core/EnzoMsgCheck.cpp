@@ -22,6 +22,7 @@ EnzoMsgCheck::EnzoMsgCheck()
     index_send_(),
     data_msg_(nullptr),
     buffer_(nullptr),
+    buffer_size_(0),
     block_name_(),
     block_level_(),
     block_lower_(),
@@ -36,10 +37,15 @@ EnzoMsgCheck::EnzoMsgCheck()
     index_block_(),
     is_first_(),
     is_last_(),
+    count_block_(0),
     name_dir_(),
     index_file_(-1),
     index_order_(-1),
-    count_order_(-1)
+    count_order_(-1),
+    stage_pe_(-1),
+    stage_bytes_(0),
+    is_delta_(false),
+    field_base_file_()
 {
   ++counter[cello::index_static()];
   cello::hex_string(tag_,TAG_LEN);
@@ -88,6 +94,8 @@ void * EnzoMsgCheck::pack (EnzoMsgCheck * msg)
 
   char * buffer = (char *) CkAllocBuffer (msg,size);
 
+  MsgCounter::sent (msg_class_check,size);
+
   // serialize message data into buffer
 
   char * pc = buffer;
@@ -124,9 +132,12 @@ EnzoMsgCheck * EnzoMsgCheck::unpack(void * buffer)
 
   pc = msg->load_(pc);
 
+  MsgCounter::received (msg_class_check,pc - (char *) buffer);
+
   // Save the input buffer for freeing later
 
   msg->buffer_ = buffer;
+  msg->buffer_size_ = pc - (char *) buffer;
 
   return msg;
 }
@@ -150,6 +161,7 @@ int EnzoMsgCheck::size_()
   SIZE_STRING_TYPE(size,name_this_);
   SIZE_STRING_TYPE(size,name_next_);
   SIZE_SCALAR_TYPE(size,long long,index_block_);
+  SIZE_SCALAR_TYPE(size,long long,count_block_);
   SIZE_SCALAR_TYPE(size,bool,is_first_);
   SIZE_SCALAR_TYPE(size,bool,is_last_);
   SIZE_STRING_TYPE(size,name_dir_);
@@ -157,6 +169,10 @@ int EnzoMsgCheck::size_()
   SIZE_ARRAY_TYPE (size,int,adapt_buffer_,ADAPT_BUFFER_SIZE);
   SIZE_SCALAR_TYPE(size,int,index_order_);
   SIZE_SCALAR_TYPE(size,int,count_order_);
+  SIZE_SCALAR_TYPE(size,int,stage_pe_);
+  SIZE_SCALAR_TYPE(size,long long,stage_bytes_);
+  SIZE_SCALAR_TYPE(size,bool,is_delta_);
+  SIZE_VECTOR_TYPE(size,int,field_base_file_);
   return size;
 }
 
@@ -178,6 +194,7 @@ char * EnzoMsgCheck::save_(char * pc)
   SAVE_STRING_TYPE(pc,name_this_);
   SAVE_STRING_TYPE(pc,name_next_);
   SAVE_SCALAR_TYPE(pc,long long,index_block_);
+  SAVE_SCALAR_TYPE(pc,long long,count_block_);
   SAVE_SCALAR_TYPE(pc,bool,is_first_);
   SAVE_SCALAR_TYPE(pc,bool,is_last_);
   SAVE_STRING_TYPE(pc,name_dir_);
@@ -185,6 +202,10 @@ char * EnzoMsgCheck::save_(char * pc)
   SAVE_ARRAY_TYPE (pc,int,adapt_buffer_,ADAPT_BUFFER_SIZE);
   SAVE_SCALAR_TYPE(pc,int,index_order_);
   SAVE_SCALAR_TYPE(pc,int,count_order_);
+  SAVE_SCALAR_TYPE(pc,int,stage_pe_);
+  SAVE_SCALAR_TYPE(pc,long long,stage_bytes_);
+  SAVE_SCALAR_TYPE(pc,bool,is_delta_);
+  SAVE_VECTOR_TYPE(pc,int,field_base_file_);
   return pc;
 }
 
@@ -206,6 +227,7 @@ char * EnzoMsgCheck::load_(char * pc)
   LOAD_STRING_TYPE(pc,name_this_);
   LOAD_STRING_TYPE(pc,name_next_);
   LOAD_SCALAR_TYPE(pc,long long,index_block_);
+  LOAD_SCALAR_TYPE(pc,long long,count_block_);
   LOAD_SCALAR_TYPE(pc,bool,is_first_);
   LOAD_SCALAR_TYPE(pc,bool,is_last_);
   LOAD_STRING_TYPE(pc,name_dir_);
@@ -213,6 +235,10 @@ char * EnzoMsgCheck::load_(char * pc)
   LOAD_ARRAY_TYPE (pc,int,adapt_buffer_,ADAPT_BUFFER_SIZE);
   LOAD_SCALAR_TYPE(pc,int,index_order_);
   LOAD_SCALAR_TYPE(pc,int,count_order_);
+  LOAD_SCALAR_TYPE(pc,int,stage_pe_);
+  LOAD_SCALAR_TYPE(pc,long long,stage_bytes_);
+  LOAD_SCALAR_TYPE(pc,bool,is_delta_);
+  LOAD_VECTOR_TYPE(pc,int,field_base_file_);
   return pc;
 }
 //----------------------------------------------------------------------
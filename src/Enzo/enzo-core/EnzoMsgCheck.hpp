@@ -151,6 +151,7 @@ protected: // methods
     index_send_    = enzo_msg_check.index_send_;
     data_msg_      = enzo_msg_check.data_msg_;
     buffer_        = nullptr;
+    buffer_size_   = 0;
     block_name_    = enzo_msg_check.block_name_;
     block_level_   = enzo_msg_check.block_level_;
     for (int i=0; i<3; i++) {
@@ -165,6 +166,7 @@ protected: // methods
     name_this_   = enzo_msg_check.name_this_;
     name_next_   = enzo_msg_check.name_next_;
     index_block_ = enzo_msg_check.index_block_;
+    count_block_ = enzo_msg_check.count_block_;
     is_first_    = enzo_msg_check.is_first_;
     is_last_     = enzo_msg_check.is_last_;
     name_dir_    = enzo_msg_check.name_dir_;
@@ -174,6 +176,12 @@ protected: // methods
 
     index_order_ = enzo_msg_check.index_order_;
     count_order_ = enzo_msg_check.count_order_;
+
+    stage_pe_    = enzo_msg_check.stage_pe_;
+    stage_bytes_ = enzo_msg_check.stage_bytes_;
+
+    is_delta_        = enzo_msg_check.is_delta_;
+    field_base_file_ = enzo_msg_check.field_base_file_;
   }
 
 protected: // attributes
@@ -190,6 +198,9 @@ protected: // attributes
   /// Saved Charm++ buffers for deleting after unpack()
   void * buffer_;
 
+  /// Size of the serialized message in buffer_; not serialized
+  int buffer_size_;
+
   /// Random hex tag for tracking messages for debugging
   char tag_[TAG_LEN+1];
 
@@ -217,6 +228,10 @@ protected: // attributes
   bool is_first_;
   bool is_last_;
 
+  /// Number of Blocks in the ordering, for locating the aggregator
+  /// segments of aggregated checkpoints
+  long long count_block_;
+
   std::string name_dir_;
 
   /// Array holding serialized Array object
@@ -228,6 +243,19 @@ protected: // attributes
   /// index/count for load balancing
   long long index_order_;
   long long count_order_;
+
+  /// Process and size of the staged Block snapshot for asynchronous
+  /// checkpointing; stage_pe_ is -1 if not staged
+  int stage_pe_;
+  long long stage_bytes_;
+
+  /// Whether this message is for a delta checkpoint
+  bool is_delta_;
+
+  /// For delta checkpoints, the index of the file in the last full
+  /// checkpoint holding each unchanged field, or -1 if the field is
+  /// written
+  std::vector<int> field_base_file_;
 };
 
 #endif /* CHARM_ENZO_MSG_CHECK_HPP */
@@ -134,7 +134,8 @@ Initial * EnzoProblem::create_initial_
        enzo_config->initial_hdf5_particle_coords,
        enzo_config->initial_hdf5_particle_types,
        enzo_config->initial_hdf5_particle_attributes,
-       enzo_config->initial_hdf5_particle_levels
+       enzo_config->initial_hdf5_particle_levels,
+       enzo_config->initial_hdf5_mmap
        );
 
   } else if (type == "music") {
@@ -386,7 +387,36 @@ Solver * EnzoProblem::create_solver_
        enzo_config->solver_max_level[index_solver],
        enzo_config->solver_iter_max[index_solver],
        enzo_config->solver_res_tol[index_solver],
-       enzo_config->solver_precondition[index_solver]);
+       enzo_config->solver_precondition[index_solver],
+       enzo_config->solver_pipelined[index_solver]);
+
+  } else if (solver_type == "block_mg") {
+
+    solver = new EnzoSolverBlockMg
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       index_prolong,
+       index_restrict,
+       enzo_config->solver_num_cycles[index_solver],
+       enzo_config->solver_overlap[index_solver]);
+
+  } else if (solver_type == "chebyshev") {
+
+    solver = new EnzoSolverChebyshev
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       index_prolong,
+       index_restrict,
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_eigenvalue_ratio[index_solver]);
 
   } else if (solver_type == "dd") {
 
@@ -436,6 +466,21 @@ Solver * EnzoProblem::create_solver_
        index_prolong,
        index_restrict);
 
+  } else if (solver_type == "fft") {
+
+    solver = new EnzoSolverFft
+      (enzo_config->solver_list[index_solver],
+       enzo_config->solver_field_x[index_solver],
+       enzo_config->solver_field_b[index_solver],
+       enzo_config->solver_monitor_iter[index_solver],
+       enzo_config->solver_restart_cycle[index_solver],
+       solve_type,
+       index_prolong,
+       index_restrict,
+       enzo_config->solver_min_level[index_solver],
+       enzo_config->solver_max_level[index_solver],
+       enzo_config->solver_isolated[index_solver]);
+
   } else if (solver_type == "jacobi") {
 
     solver = new EnzoSolverJacobi
@@ -448,7 +493,8 @@ Solver * EnzoProblem::create_solver_
        index_prolong,
        index_restrict,
        enzo_config->solver_weight[index_solver],
-       enzo_config->solver_iter_max[index_solver]);
+       enzo_config->solver_iter_max[index_solver],
+       enzo_config->solver_sweeps_per_refresh[index_solver]);
 
   } else if (solver_type == "mg0") {
 
@@ -612,7 +658,7 @@ Method * EnzoProblem::create_method_
 
   } else if (name == "balance") {
 
-    method = new EnzoMethodBalance;
+    method = new EnzoMethodBalance(p_group);
 
   } else if (name == "turbulence") {
 
@@ -623,6 +669,10 @@ Method * EnzoProblem::create_method_
        enzo_config->method_turbulence_mach_number,
        enzo_config->physics_cosmology);
 
+  } else if (name == "turbulence_ou") {
+
+    method = new EnzoMethodTurbulenceOU(p_group);
+
   } else if (name == "cosmology") {
 
     method = new EnzoMethodCosmology;
@@ -716,6 +766,10 @@ Method * EnzoProblem::create_method_
 
     method = new EnzoMethodMergeSinks(p_group);
 
+  } else if (name == "fof_halos") {
+
+    method = new EnzoMethodFofHalos(p_group);
+
   } else if (name == "accretion") {
 
     // TODO: maybe make a factory method, EnzoMethodAccretion::from_parameters,
@@ -768,6 +822,32 @@ Method * EnzoProblem::create_method_
 
 //----------------------------------------------------------------------
 
+Output * EnzoProblem::create_output_
+( std::string  type,
+  int index,
+  Config *     config,
+  const Factory * factory ) throw ()
+{
+  Output * output = nullptr;
+
+  if (type == "lightcone") {
+
+    Parameters* parameters = cello::simulation()->parameters();
+    ParameterGroup p_group(*parameters, "Output:" + config->output_list[index]);
+
+    output = new EnzoOutputLightcone (index,factory,config,p_group);
+
+  } else {
+
+    output = Problem::create_output_(type,index,config,factory);
+
+  }
+
+  return output;
+}
+
+//----------------------------------------------------------------------
+
 Prolong * EnzoProblem::create_prolong_
 ( std::string  type,
   Config *     config ) throw ()
@@ -85,6 +85,13 @@ private: // functions
    Config * config,
    const Factory * factory) throw ();
 
+  /// Create named output object
+  virtual Output * create_output_
+  (std::string type,
+   int index,
+   Config * config,
+   const Factory * factory) throw ();
+
   /// Create named interpolation object
   virtual Prolong * create_prolong_
   (std::string type, Config * config) throw ();
@@ -39,6 +39,18 @@ EnzoSimulation::EnzoSimulation
     check_num_files_(0),
     check_ordering_(""),
     check_directory_(),
+    sync_check_opened_(),
+    check_async_(false),
+    check_async_active_(false),
+    check_async_deferred_(false),
+    check_exit_deferred_(false),
+    check_name_dir_(""),
+    check_staged_bytes_(0),
+    check_stage_wait_(),
+    check_is_delta_(false),
+    check_delta_count_(0),
+    check_base_dir_(""),
+    check_memory_count_(0),
     restart_level_(0)
 {
 #ifdef CHECK_MEMORY
@@ -92,6 +104,18 @@ void EnzoSimulation::pup (PUP::er &p)
   p | check_num_files_;
   p | check_ordering_;
   p | check_directory_;
+  p | sync_check_opened_;
+  p | check_async_;
+  p | check_async_active_;
+  p | check_async_deferred_;
+  p | check_exit_deferred_;
+  p | check_name_dir_;
+  p | check_staged_bytes_;
+  p | check_stage_wait_;
+  p | check_is_delta_;
+  p | check_delta_count_;
+  p | check_base_dir_;
+  p | check_memory_count_;
   p | restart_level_;
 }
 
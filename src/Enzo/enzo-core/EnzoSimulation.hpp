@@ -58,6 +58,8 @@ public: // functions
 
   // EnzoMethodBalance
 
+  /// Broadcast process loads for incremental load-balancing
+  void r_method_balance_load(CkReductionMsg * msg);
   /// Count number of Blocks that are planning on load-balancing
   void r_method_balance_count(CkReductionMsg * msg);
   /// Count down of migrating blocks (plus root-Block in case none)
@@ -65,7 +67,19 @@ public: // functions
 
   /// EnzoMethodCheck
   void r_method_check_enter (CkReductionMsg *);
+  void p_check_opened();
   void p_check_done();
+  /// Resume Blocks after an in-memory checkpoint, or after restarting
+  /// from one
+  void r_check_memory_done();
+  /// Release staged bytes of an asynchronous checkpoint after they are
+  /// written, resuming Blocks waiting on the staging budget
+  void p_check_unstage(long long bytes);
+  /// Account for a Block's staged checkpoint snapshot; returns false
+  /// if the Block must wait for p_check_done() before continuing
+  bool check_stage(Index index, long long bytes);
+  /// Whether exit must wait for an asynchronous checkpoint to drain
+  bool check_defer_exit();
   void p_set_io_reader(CProxy_IoEnzoReader proxy);
   void p_set_io_writer(CProxy_IoEnzoWriter proxy);
   void p_set_level_array(CProxy_EnzoLevelArray proxy);
@@ -82,6 +96,10 @@ public: // functions
 
   void p_io_reader_created();
 
+  /// EnzoMethodFofHalos
+  /// Write the halo catalog on the root process
+  void r_method_fof_halos_catalog (CkReductionMsg *);
+
   /// EnzoMethodInference
   /// Set count of inference arrays to be created
   void p_infer_set_array_count(int count);
@@ -107,6 +125,9 @@ private: // functions
 
   void infer_check_create_();
 
+  /// Create the checkpoint directory and start writing Blocks
+  void check_start_();
+
 private: // virtual functions
 
   virtual void initialize_config_() throw();
@@ -128,6 +149,31 @@ private: // attributes
   std::string              check_ordering_;
   std::vector<std::string> check_directory_;
 
+  /// Asynchronous checkpoint synchronization and staging state
+  Sync                     sync_check_opened_;
+  bool                     check_async_;
+  /// Whether an asynchronous checkpoint is still being written [ip=0]
+  bool                     check_async_active_;
+  /// Whether the next checkpoint is waiting for the active one [ip=0]
+  bool                     check_async_deferred_;
+  /// Whether exit is waiting for the active checkpoint [ip=0]
+  bool                     check_exit_deferred_;
+  std::string              check_name_dir_;
+  /// Bytes of Block snapshots staged on this process but not written
+  long long                check_staged_bytes_;
+  /// Blocks on this process waiting for staged bytes to drain
+  std::vector<Index>       check_stage_wait_;
+
+  /// Delta checkpoint state [ip=0]: whether the current checkpoint is
+  /// a delta, the number of deltas written since the last full
+  /// checkpoint, and the directory of that full checkpoint
+  bool                     check_is_delta_;
+  int                      check_delta_count_;
+  std::string              check_base_dir_;
+
+  /// Number of in-memory checkpoints since the last disk checkpoint [ip=0]
+  int                      check_memory_count_;
+
   /// Balance Method synchronization
   Sync sync_method_balance_;
   /// Current restart level
@@ -36,6 +36,10 @@
 #include "main.hpp"
 #include "charm_enzo.hpp"
 
+#ifdef CONFIG_USE_CKLOOP
+#  include "CkLoopAPI.h"
+#endif
+
 #include "../../auto_config.def"
 
 //----------------------------------------------------------------------
@@ -48,7 +52,7 @@ extern CProxy_Simulation     proxy_simulation;
 static const char* help_message_ = R"HELP(
 USAGE:
 
-    charmrun [charm args] %s [-dryrun] <parameter-file>
+    charmrun [charm args] %s [-dryrun] [-parameter-cache] <parameter-file>
     charmrun [charm args] %s [-grackle-version | -help | -precision | -version]
 
 DESCRIPTION:
@@ -65,6 +69,11 @@ OPTIONS:
     -dryrun
         Write parameter file to parameters.[out|libconfig] and exit immediately
 
+    -parameter-cache
+        Read parameters from parameters.cache if it was written from the same
+        parameter file and neither it nor any included file has changed since;
+        otherwise parse the parameter file and write parameters.cache
+
     -grackle-version
         When this flag is specified, the program prints out the version of
         Grackle that it was linked against and exits. If the program was not
@@ -103,9 +112,10 @@ struct Args {
 
   Mode mode;
   const char* param_fname;
+  bool parameter_cache;
 
-  static Args help() { return { Mode::Help,  nullptr }; }
-  static Args err()  { return { Mode::Error, nullptr }; }
+  static Args help() { return { Mode::Help,  nullptr, false }; }
+  static Args err()  { return { Mode::Error, nullptr, false }; }
 };
 
 //----------------------------------------------------------------------
@@ -126,6 +136,7 @@ static Args parse_args_(int argc, char** argv) {
 
   Args::Mode mode = Args::Mode::Run;
   const char* positional_arg_ptr = nullptr;
+  bool parameter_cache = false;
 
   for (int i = 1; i < argc; i++) {
     bool is_positional = argv[i][0] != '-';
@@ -139,6 +150,9 @@ static Args parse_args_(int argc, char** argv) {
       CkPrintf("ERR: invalid option: \"%s\". All options (even long options) "
                "are prefixed by a single hyphen\n", argv[i]);
       return Args::err();
+    } else if (eq(i, "-parameter-cache")) {
+      // may be combined with the mode flags
+      parameter_cache = true;
     } else if (mode != Args::Mode::Run) {
       CkPrintf("ERR: too many flags provided\n");           return Args::err();
     } else {
@@ -153,7 +167,7 @@ static Args parse_args_(int argc, char** argv) {
     }
   }
 
-  return {mode, positional_arg_ptr};
+  return {mode, positional_arg_ptr, parameter_cache};
 }
 
 //----------------------------------------------------------------------
@@ -234,7 +248,13 @@ PARALLEL_MAIN_BEGIN
 
   // Read parameter file
 
-  g_parameters.read(parsed_args.param_fname);
+  const char * cache_name = "parameters.cache";
+  if (! parsed_args.parameter_cache) {
+    g_parameters.read(parsed_args.param_fname);
+  } else if (! g_parameters.read_cache(cache_name,parsed_args.param_fname)) {
+    g_parameters.read(parsed_args.param_fname);
+    g_parameters.write_cache(cache_name);
+  }
   g_parameters.write("parameters.out",      param_write_cello);
   g_parameters.write("parameters.libconfig",param_write_libconfig);
   g_parameters.write(stdout,param_write_monitor);
@@ -279,6 +299,11 @@ PARALLEL_MAIN_BEGIN
 
   proxy_main     = thishandle;
 
+#ifdef CONFIG_USE_CKLOOP
+  // create the CkLoop helpers used by cello::parallel_for()
+  CkLoop_Init();
+#endif
+
   // --------------------------------------------------
   // ENTRY: #1 Main::Main() -> EnzoSimulation::EnzoSimulation()
   // ENTRY: create
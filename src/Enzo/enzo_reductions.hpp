@@ -2,4 +2,8 @@ extern CkReduction::reducerType r_method_turbulence_type;
 extern CkReductionMsg * r_method_turbulence(int n, CkReductionMsg ** msgs);
 extern void register_method_turbulence(void);
 
+extern CkReduction::reducerType r_method_fof_halos_type;
+extern CkReductionMsg * r_method_fof_halos(int n, CkReductionMsg ** msgs);
+extern void register_method_fof_halos(void);
+
 
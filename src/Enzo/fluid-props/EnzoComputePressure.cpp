@@ -79,40 +79,60 @@ void EnzoComputePressure::compute (Block * block, enzo_float *p,
 
 //----------------------------------------------------------------------
 
-void EnzoComputePressure::compute_pressure
-(const EnzoFieldAdaptor& fadaptor,
- const CelloView<enzo_float, 3>& p,
- bool mhd,
- bool dual_energy,
- double gamma,
- int stale_depth, /* 0 */
- bool ignore_grackle /*false*/
- ) throw()
+bool EnzoComputePressure::is_streamed () throw()
 {
+  return enzo::grackle_method() == nullptr;
+}
 
-  const EnzoMethodGrackle* grackle_method = enzo::grackle_method();
-
-  if ((grackle_method != nullptr) & !ignore_grackle){
-
-    // ToDo: earlier versions of grackle didn't work right when stale_depth >
-    //       0. We should probably test it in Enzo-E.
-    ASSERT("EnzoMethodGrackle::calculate_pressure",
-           "untested when stale_depth exceeds 0 (but this should work!)",
-           stale_depth == 0);
-
-    if (!fadaptor.consistent_with_field_strides(p)){
-      ERROR("EnzoMethodGrackle::calculate_pressure",
-            "When using grackle to compute pressure, the output array must "
-            "have identical strides to the fields.");
-    }
-
-    grackle_method->calculate_pressure(fadaptor, p.data(), stale_depth);
+//----------------------------------------------------------------------
 
-  } else {
+namespace {
+
+  /// Ideal gas pressure from total energy, specialized on rank and on
+  /// whether magnetic fields are present: velocity and magnetic field
+  /// components beyond rank are not read
+  template <int rank, bool mhd>
+  void pressure_from_total_energy_
+  (const CelloView<enzo_float, 3>& p,
+   const CelloView<const enzo_float, 3>& d,
+   const CelloView<const enzo_float, 3>& te,
+   const CelloView<const enzo_float, 3>& vx,
+   const CelloView<const enzo_float, 3>& vy,
+   const CelloView<const enzo_float, 3>& vz,
+   const CelloView<const enzo_float, 3>& bx,
+   const CelloView<const enzo_float, 3>& by,
+   const CelloView<const enzo_float, 3>& bz,
+   const enzo_float gm1, const int stale_depth)
+  {
+    auto loop_body = [=](int iz, int iy, int ix)
+      {
+        enzo_float v2 = vx(iz,iy,ix) * vx(iz,iy,ix);
+        if (rank >= 2) v2 += vy(iz,iy,ix) * vy(iz,iy,ix);
+        if (rank >= 3) v2 += vz(iz,iy,ix) * vz(iz,iy,ix);
+        enzo_float b2 = 0.;
+        if (mhd) {
+          b2 = bx(iz,iy,ix) * bx(iz,iy,ix);
+          if (rank >= 2) b2 += by(iz,iy,ix) * by(iz,iy,ix);
+          if (rank >= 3) b2 += bz(iz,iy,ix) * bz(iz,iy,ix);
+        }
+        const enzo_float ke = 0.5 * v2;
+        const enzo_float me_den = 0.5 * b2;
+        p(iz,iy,ix) = gm1 * (d(iz,iy,ix) * (te(iz,iy,ix) - ke) - me_den);
+      };
+    enzo_utils::exec_loop(d.shape(0), d.shape(1), d.shape(2),
+                          stale_depth, loop_body);
+  }
 
+  /// Pressure of an ideal gas, from the arrays returned by view(name),
+  /// which may be a slab of the Block's fields
+  template <class ViewFn>
+  void pressure_ideal_
+  (ViewFn view, const CelloView<enzo_float, 3>& p,
+   bool mhd, bool dual_energy, double gamma, int stale_depth)
+  {
     using RdOnlyEFltArr = CelloView<const enzo_float, 3>;
 
-    const RdOnlyEFltArr d = fadaptor.view("density");
+    const RdOnlyEFltArr d = view("density");
 
     enzo_float gm1 = gamma - 1.0;
 
@@ -126,7 +146,7 @@ void EnzoComputePressure::compute_pressure
 
     if (dual_energy) {
 
-      const RdOnlyEFltArr ie = fadaptor.view("internal_energy");
+      const RdOnlyEFltArr ie = view("internal_energy");
 
       auto loop_body = [=](int iz, int iy, int ix)
         { p(iz,iy,ix) = gm1 * d(iz,iy,ix) * ie(iz,iy,ix); };
@@ -135,63 +155,107 @@ void EnzoComputePressure::compute_pressure
     } else { // not using dual energy formalism
 
       const int rank = cello::rank();
-      const RdOnlyEFltArr te = fadaptor.view("total_energy");
+      const RdOnlyEFltArr te = view("total_energy");
 
       // fetch velocity arrays
-      const RdOnlyEFltArr vx = fadaptor.view("velocity_x");
+      const RdOnlyEFltArr vx = view("velocity_x");
       const RdOnlyEFltArr vy = (rank >= 2)
-        ? fadaptor.view("velocity_y") : RdOnlyEFltArr();
+        ? view("velocity_y") : RdOnlyEFltArr();
       const RdOnlyEFltArr vz = (rank >= 3)
-        ? fadaptor.view("velocity_z") : RdOnlyEFltArr();
+        ? view("velocity_z") : RdOnlyEFltArr();
 
       // fetch bfield arrays
       const RdOnlyEFltArr bx = (mhd)
-        ? fadaptor.view("bfield_x") : RdOnlyEFltArr();
+        ? view("bfield_x") : RdOnlyEFltArr();
       const RdOnlyEFltArr by = (mhd & (rank >= 2))
-        ? fadaptor.view("bfield_y") : RdOnlyEFltArr();
+        ? view("bfield_y") : RdOnlyEFltArr();
       const RdOnlyEFltArr bz = (mhd & (rank >= 3))
-        ? fadaptor.view("bfield_z") : RdOnlyEFltArr();
-
-      if (rank == 1) {
-
-        auto loop_body = [=](int iz, int iy, int ix)
-          {
-            enzo_float ke = 0.5 * (vx(iz,iy,ix) * vx(iz,iy,ix));
-            enzo_float me_den = mhd ? 0.5*(bx(iz,iy,ix) * bx(iz,iy,ix)) : 0.;
-            p(iz,iy,ix) = gm1 * (d(iz,iy,ix) * (te(iz,iy,ix) - ke) - me_den);
-          };
-        enzo_utils::exec_loop(mz, my, mx, stale_depth, loop_body);
-
-      } else if (rank == 2) {
-
-        auto loop_body = [=](int iz, int iy, int ix)
-          {
-            enzo_float ke = 0.5*(vx(iz,iy,ix) * vx(iz,iy,ix) +
-                                 vy(iz,iy,ix) * vy(iz,iy,ix));
-            enzo_float me_den = mhd ? 0.5*(bx(iz,iy,ix) * bx(iz,iy,ix) +
-                                           by(iz,iy,ix) * by(iz,iy,ix)) : 0.;
-            p(iz,iy,ix) = gm1 * (d(iz,iy,ix) * (te(iz,iy,ix) - ke) - me_den);
-          };
-        enzo_utils::exec_loop(mz, my, mx, stale_depth, loop_body);
-
-      } else if (rank == 3) {
-
-        auto loop_body = [=](int iz, int iy, int ix)
-          {
-            enzo_float ke = 0.5*(vx(iz,iy,ix) * vx(iz,iy,ix) +
-                                 vy(iz,iy,ix) * vy(iz,iy,ix) +
-                                 vz(iz,iy,ix) * vz(iz,iy,ix));
-            enzo_float me_den = mhd ? 0.5*(bx(iz,iy,ix) * bx(iz,iy,ix) +
-                                           by(iz,iy,ix) * by(iz,iy,ix) +
-                                           bz(iz,iy,ix) * bz(iz,iy,ix)) : 0.;
-            p(iz,iy,ix) = gm1 * (d(iz,iy,ix) * (te(iz,iy,ix) - ke) - me_den);
-          };
-        enzo_utils::exec_loop(mz, my, mx, stale_depth, loop_body);
-
+        ? view("bfield_z") : RdOnlyEFltArr();
+
+      // dispatch to a kernel specialized on rank and mhd, so that the
+      // inner loop is free of branches and can be vectorized
+
+      if (mhd) {
+        if      (rank == 1) pressure_from_total_energy_<1,true>
+                              (p,d,te,vx,vy,vz,bx,by,bz,gm1,stale_depth);
+        else if (rank == 2) pressure_from_total_energy_<2,true>
+                              (p,d,te,vx,vy,vz,bx,by,bz,gm1,stale_depth);
+        else if (rank == 3) pressure_from_total_energy_<3,true>
+                              (p,d,te,vx,vy,vz,bx,by,bz,gm1,stale_depth);
+      } else {
+        if      (rank == 1) pressure_from_total_energy_<1,false>
+                              (p,d,te,vx,vy,vz,bx,by,bz,gm1,stale_depth);
+        else if (rank == 2) pressure_from_total_energy_<2,false>
+                              (p,d,te,vx,vy,vz,bx,by,bz,gm1,stale_depth);
+        else if (rank == 3) pressure_from_total_energy_<3,false>
+                              (p,d,te,vx,vy,vz,bx,by,bz,gm1,stale_depth);
       }
     }
   }
 
+}
+
+//----------------------------------------------------------------------
+
+void EnzoComputePressure::compute_slab
+(Block * block, int iz0, int nz, cello_float * values) throw()
+{
+  EnzoFieldAdaptor f_adaptor(block, i_hist_);
+  Field field = block->data()->field();
+
+  const CelloView<const enzo_float,3> d = f_adaptor.view("density");
+  CelloView<enzo_float,3> p_slab ((enzo_float *)values,
+                                  nz, d.shape(1), d.shape(2));
+
+  const bool dual_energy =
+    !enzo::fluid_props()->dual_energy_config().is_disabled();
+  const bool mhd = field.is_field("bfield_x");
+
+  const CSlice slab (iz0, iz0 + nz);
+  pressure_ideal_ ([&f_adaptor,&slab] (const std::string & name)
+                   { return f_adaptor.view(name).subarray
+                       (slab, CSlice(0, nullptr), CSlice(0, nullptr)); },
+                   p_slab, mhd, dual_energy, gamma_, 0);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoComputePressure::compute_pressure
+(const EnzoFieldAdaptor& fadaptor,
+ const CelloView<enzo_float, 3>& p,
+ bool mhd,
+ bool dual_energy,
+ double gamma,
+ int stale_depth, /* 0 */
+ bool ignore_grackle /*false*/
+ ) throw()
+{
+
+  const EnzoMethodGrackle* grackle_method = enzo::grackle_method();
+
+  if ((grackle_method != nullptr) & !ignore_grackle){
+
+    // ToDo: earlier versions of grackle didn't work right when stale_depth >
+    //       0. We should probably test it in Enzo-E.
+    ASSERT("EnzoMethodGrackle::calculate_pressure",
+           "untested when stale_depth exceeds 0 (but this should work!)",
+           stale_depth == 0);
+
+    if (!fadaptor.consistent_with_field_strides(p)){
+      ERROR("EnzoMethodGrackle::calculate_pressure",
+            "When using grackle to compute pressure, the output array must "
+            "have identical strides to the fields.");
+    }
+
+    grackle_method->calculate_pressure(fadaptor, p.data(), stale_depth);
+
+  } else {
+
+    pressure_ideal_ ([&fadaptor] (const std::string & name)
+                     { return fadaptor.view(name); },
+                     p, mhd, dual_energy, gamma, stale_depth);
+  }
+
   // Place any additional pressure computation here
 
  return;
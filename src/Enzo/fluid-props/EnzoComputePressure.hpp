@@ -62,6 +62,13 @@ public: // interface
                 enzo_float* p,
                 int stale_depth = 0) throw();
 
+  /// The pressure can be evaluated in slabs unless Grackle computes it
+  bool is_streamed () throw();
+
+  /// Compute the pressure in planes iz0 <= iz < iz0 + nz of the Block
+  void compute_slab (Block * block, int iz0, int nz,
+                     cello_float * values) throw();
+
   /// static method to compute thermal pressure
   ///
   /// @param[in]  fadaptor Contains arrays of quantities used to compute the
@@ -76,6 +76,41 @@ void EnzoComputeTemperature::compute ( Block * block, enzo_float * t) throw()
 
 //----------------------------------------------------------------------
 
+bool EnzoComputeTemperature::is_streamed () throw()
+{
+  return enzo::grackle_method() == nullptr;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoComputeTemperature::compute_slab
+(Block * block, int iz0, int nz, cello_float * values) throw()
+{
+  // pressure of the slab, converted to temperature in place
+
+  EnzoComputePressure compute_pressure
+    (enzo::fluid_props()->gamma(),comoving_coordinates_);
+  compute_pressure.set_history(i_hist_);
+  compute_pressure.compute_slab(block, iz0, nz, values);
+
+  Field field = block->data()->field();
+  int mx,my,mz;
+  field.dimensions(0,&mx,&my,&mz);
+
+  const enzo_float * d = (enzo_float*) field.values("density", i_hist_)
+    + size_t(mx)*my*iz0;
+  enzo_float * t = (enzo_float *) values;
+
+  const int m = mx*my*nz;
+  for (int i=0; i<m; i++) {
+    enzo_float density     = std::max(d[i], (enzo_float) density_floor_);
+    enzo_float temperature = t[i] * mol_weight_ / density;
+    t[i] = std::max(temperature, (enzo_float)temperature_floor_);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoComputeTemperature::compute_(Block * block,
                                       enzo_float * t,
                                       bool recompute_pressure, /* true */
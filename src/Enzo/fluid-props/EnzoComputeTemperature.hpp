@@ -70,6 +70,13 @@ public: // interface
 
   virtual void compute( Block * block, enzo_float * t) throw();
 
+  /// The temperature can be evaluated in slabs unless Grackle computes it
+  virtual bool is_streamed () throw();
+
+  /// Compute the temperature in planes iz0 <= iz < iz0 + nz of the Block
+  virtual void compute_slab (Block * block, int iz0, int nz,
+                             cello_float * values) throw();
+
   // name of derived field that this function calculates
   std::string name () throw() {
     return "temperature";
@@ -157,6 +157,84 @@ void EnzoPhysicsFluidProps::pressure_from_integration
 
 //----------------------------------------------------------------------
 
+namespace {
+
+  /// Applies the energy floor and synchronizes the internal energy with the
+  /// total energy, specialized on whether the dual energy formalism is used
+  /// and whether magnetic fields are present, so that the inner loop is free
+  /// of branches on either and never touches arrays that aren't needed
+  template <bool idual, bool mag>
+  void floor_and_sync_energy_
+  (const EFlt3DArray& etot, const EFlt3DArray& eint,
+   const CelloView<const enzo_float, 3>& density,
+   const CelloView<const enzo_float, 3>& vx,
+   const CelloView<const enzo_float, 3>& vy,
+   const CelloView<const enzo_float, 3>& vz,
+   const CelloView<const enzo_float, 3>& bx,
+   const CelloView<const enzo_float, 3>& by,
+   const CelloView<const enzo_float, 3>& bz,
+   const double eta, const enzo_float ggm1, const enzo_float pressure_floor,
+   const enzo_float inv_gm1, const int stale_depth)
+  {
+    // a requirement for an element of the internal energy field, cur_eint,
+    // to be updated to the value computed from the total energy field,
+    // eint_1, is that cur_eint > half_factor * cur_eint, where half_factor
+    // is 0.5. To allow eta = 0, to specify that this update should always
+    // occur, we set half_factor = 0 when eta = 0.
+    const double half_factor = (eta != 0.) ? 0.5 : 0.;
+
+    for (int iz = stale_depth; iz < (density.shape(0) - stale_depth); iz++) {
+      for (int iy = stale_depth; iy < (density.shape(1) - stale_depth); iy++) {
+        for (int ix = stale_depth; ix < (density.shape(2) - stale_depth); ix++) {
+
+          enzo_float inv_rho = 1./density(iz,iy,ix);
+          enzo_float eint_floor = pressure_floor*inv_gm1*inv_rho;
+
+          enzo_float v2 = (vx(iz,iy,ix) * vx(iz,iy,ix) +
+                           vy(iz,iy,ix) * vy(iz,iy,ix) +
+                           vz(iz,iy,ix) * vz(iz,iy,ix));
+          enzo_float non_thermal_e =  0.5*v2;
+          enzo_float b2 = 0;
+          if constexpr (mag) {
+            b2 = (bx(iz,iy,ix) * bx(iz,iy,ix) +
+                  by(iz,iy,ix) * by(iz,iy,ix) +
+                  bz(iz,iy,ix) * bz(iz,iy,ix));
+            non_thermal_e += (0.5 * b2 *inv_rho);
+          }
+
+          if constexpr (idual) {
+            enzo_float eint_1 = etot(iz,iy,ix) - non_thermal_e;
+            enzo_float cur_eint = eint(iz,iy,ix);
+
+            // compute cs^2 with estimate of eint from etot
+            // p = rho*(gamma-1)*eint
+            // cs^2 = gamma * p / rho = gamma*(gamma-1)*eint
+            enzo_float cs2_1 = std::fmax(0., ggm1*eint_1);
+
+            // half_factor = 0.5 when eta !=0. Otherwise it's 0.
+            if ( (cs2_1 > std::fmax(eta*v2, eta*b2*inv_rho)) &&
+                 (eint_1 > half_factor*cur_eint) ){
+              cur_eint = eint_1;
+            }
+            cur_eint = enzo_utils::apply_floor(cur_eint, eint_floor);
+
+            eint(iz,iy,ix) = cur_eint;
+            etot(iz,iy,ix) = cur_eint + non_thermal_e;
+          } else {
+
+            enzo_float etot_floor = eint_floor + non_thermal_e;
+            etot(iz,iy,ix) = enzo_utils::apply_floor(etot(iz,iy,ix),
+                                                     etot_floor);
+          }
+        }
+      }
+    }
+  }
+
+}
+
+//----------------------------------------------------------------------
+
 // based on the enzo's hydro_rk implementation of synchronization (found in the
 // Grid_UpdateMHD.C file)
 void EnzoPhysicsFluidProps::apply_floor_to_energy_and_sync
@@ -235,56 +313,20 @@ void EnzoPhysicsFluidProps::apply_floor_to_energy_and_sync
   enzo_float pressure_floor = this->fluid_floor_config().pressure();
   enzo_float inv_gm1 = 1./(this->gamma()-1.);
 
-  // a requirement for an element of the internal energy field, cur_eint,
-  // to be updated to the value computed from the total energy field, eint_1,
-  // is that cur_eint > half_factor * cur_eint, where half_factor is 0.5. To
-  // allow eta = 0, to specify that this update should always occur, we set
-  // half_factor = 0 when eta = 0.
-  const double half_factor = (eta != 0.) ? 0.5 : 0.;
-
-  for (int iz = stale_depth; iz < (density.shape(0) - stale_depth); iz++) {
-    for (int iy = stale_depth; iy < (density.shape(1) - stale_depth); iy++) {
-      for (int ix = stale_depth; ix < (density.shape(2) - stale_depth); ix++) {
-
-	enzo_float inv_rho = 1./density(iz,iy,ix);
-	enzo_float eint_floor = pressure_floor*inv_gm1*inv_rho;
-
-	enzo_float v2 = (vx(iz,iy,ix) * vx(iz,iy,ix) +
-			 vy(iz,iy,ix) * vy(iz,iy,ix) +
-			 vz(iz,iy,ix) * vz(iz,iy,ix));
-        enzo_float non_thermal_e =  0.5*v2;
-        enzo_float b2 = 0;
-        if (mag){
-          b2 = (bx(iz,iy,ix) * bx(iz,iy,ix) +
-                by(iz,iy,ix) * by(iz,iy,ix) +
-                bz(iz,iy,ix) * bz(iz,iy,ix));
-          non_thermal_e += (0.5 * b2 *inv_rho);
-        }
-
-	if (idual){
-	  enzo_float eint_1 = etot(iz,iy,ix) - non_thermal_e;
-	  enzo_float cur_eint = eint(iz,iy,ix);
-
-	  // compute cs^2 with estimate of eint from etot
-	  // p = rho*(gamma-1)*eint
-	  // cs^2 = gamma * p / rho = gamma*(gamma-1)*eint
-	  enzo_float cs2_1 = std::fmax(0., ggm1*eint_1);
-
-	  // half_factor = 0.5 when eta !=0. Otherwise it's 0.
-	  if ( (cs2_1 > std::fmax(eta*v2, eta*b2*inv_rho)) &&
-	       (eint_1 > half_factor*cur_eint) ){
-	    cur_eint = eint_1;
-	  }
-	  cur_eint = enzo_utils::apply_floor(cur_eint, eint_floor);
-
-	  eint(iz,iy,ix) = cur_eint;
-	  etot(iz,iy,ix) = cur_eint + non_thermal_e;
-	} else {
-
-	  enzo_float etot_floor = eint_floor + non_thermal_e;
-	  etot(iz,iy,ix) = enzo_utils::apply_floor(etot(iz,iy,ix), etot_floor);
-	}
-      }
-    }
+  // dispatch to a kernel specialized on idual and mag
+  if (idual) {
+    if (mag) floor_and_sync_energy_<true,true>
+               (etot, eint, density, vx, vy, vz, bx, by, bz,
+                eta, ggm1, pressure_floor, inv_gm1, stale_depth);
+    else     floor_and_sync_energy_<true,false>
+               (etot, eint, density, vx, vy, vz, bx, by, bz,
+                eta, ggm1, pressure_floor, inv_gm1, stale_depth);
+  } else {
+    if (mag) floor_and_sync_energy_<false,true>
+               (etot, eint, density, vx, vy, vz, bx, by, bz,
+                eta, ggm1, pressure_floor, inv_gm1, stale_depth);
+    else     floor_and_sync_energy_<false,false>
+               (etot, eint, density, vx, vy, vz, bx, by, bz,
+                eta, ggm1, pressure_floor, inv_gm1, stale_depth);
   }
 }
@@ -175,13 +175,12 @@ private:
 
 
 template<typename T>
-void compute_accel_(const T functor,
-                    enzo_float * ax, enzo_float * ay, enzo_float * az,
-                    double G_code, Particle * particle,
-                    const BlockInfo block_info, const int rank,
-                    const enzo_float cosmo_a,
-                    const std::array<double, 3> accel_center,
-                    const double dt) noexcept
+void compute_accel_grid_(const T functor,
+                         enzo_float * ax, enzo_float * ay, enzo_float * az,
+                         double G_code,
+                         const BlockInfo block_info, const int rank,
+                         const enzo_float cosmo_a,
+                         const std::array<double, 3> accel_center) noexcept
 {
   const int mx = block_info.dimensions[0];
   const int my = block_info.dimensions[1];
@@ -205,7 +204,17 @@ void compute_accel_(const T functor,
         }
      }
   } // end loop over grid cells
+}
+
+//---------------------------------------------------------------------
 
+template<typename T>
+void compute_accel_particles_(const T functor, double G_code,
+                              Particle * particle, const int rank,
+                              const enzo_float cosmo_a,
+                              const std::array<double, 3> accel_center)
+  noexcept
+{
   // Update particle accelerations for gravitating particles
 
   ParticleDescr * particle_descr = cello::particle_descr();
@@ -272,6 +281,60 @@ void compute_accel_(const T functor,
 
 }
 
+//---------------------------------------------------------------------
+
+template<typename T>
+void compute_accel_(const T functor,
+                    enzo_float * ax, enzo_float * ay, enzo_float * az,
+                    double G_code, Particle * particle,
+                    const BlockInfo block_info, const int rank,
+                    const enzo_float cosmo_a,
+                    const std::array<double, 3> accel_center,
+                    const double dt) noexcept
+{
+  compute_accel_grid_(functor, ax, ay, az, G_code, block_info, rank,
+                      cosmo_a, accel_center);
+  compute_accel_particles_(functor, G_code, particle, rank, cosmo_a,
+                           accel_center);
+}
+
+//---------------------------------------------------------------------
+
+template<typename T>
+void compute_accel_cached_(const T functor, enzo_float * cache[3],
+                           bool is_current,
+                           enzo_float * ax, enzo_float * ay, enzo_float * az,
+                           double G_code, Particle * particle,
+                           const BlockInfo block_info, const int rank,
+                           const std::array<double, 3> accel_center) noexcept
+{
+  const int m = (block_info.dimensions[0] * block_info.dimensions[1] *
+                 block_info.dimensions[2]);
+
+  // static potentials only: the cache holds the (negated) background
+  // acceleration, evaluated once for the Block's geometry
+
+  if (! is_current) {
+    for (int i_axis = 0; i_axis < 3; i_axis++) {
+      if (cache[i_axis]) std::fill_n(cache[i_axis], m, enzo_float(0.0));
+    }
+    compute_accel_grid_(functor, cache[0], cache[1], cache[2], G_code,
+                        block_info, rank, 1.0, accel_center);
+  }
+
+  enzo_float * a3[3] = {ax, ay, az};
+  for (int i_axis = 0; i_axis < 3; i_axis++) {
+    enzo_float * a = a3[i_axis];
+    const enzo_float * c = cache[i_axis];
+    if (a && c) { for (int i = 0; i < m; i++) a[i] += c[i]; }
+  }
+
+  // particles move, so their accelerations are always evaluated
+
+  compute_accel_particles_(functor, G_code, particle, rank, 1.0,
+                           accel_center);
+}
+
 } // close anonymous namespace
 
 //---------------------------------------------------------------------
@@ -283,7 +346,9 @@ EnzoMethodBackgroundAcceleration::EnzoMethodBackgroundAcceleration
    potential_center_xyz_{}, // fills array with zeros
    flavor_(p.value_string("flavor","unknown")),
    galaxy_pack_dfltU_(nullptr),
-   point_mass_pack_dfltU_(nullptr)
+   point_mass_pack_dfltU_(nullptr),
+   cache_(false),
+   i_cached_(-1)
 {
 
   // If self-gravity is calculated, we do not need to zero out the acceleration
@@ -311,6 +376,26 @@ EnzoMethodBackgroundAcceleration::EnzoMethodBackgroundAcceleration
            flavor_.c_str());
   }
 
+  // The potential is static unless cosmology changes the expansion
+  // factor and code units, so accelerations on the grid can be
+  // cached per Block until it is replaced by adapt.  The cache is
+  // allocated only on Blocks that reach compute(), and is not
+  // output, refreshed, or interpolated
+
+  cache_ = p.value_logical("cache",true) && (enzo::cosmology() == nullptr);
+
+  if (cache_) {
+    const int rank = cello::rank();
+    if (rank >= 1) cello::define_field_lazy
+        ("background_acceleration_x",field_lifecycle_demand);
+    if (rank >= 2) cello::define_field_lazy
+        ("background_acceleration_y",field_lifecycle_demand);
+    if (rank >= 3) cello::define_field_lazy
+        ("background_acceleration_z",field_lifecycle_demand);
+    i_cached_ = cello::scalar_descr_int()->new_value
+      ("background_acceleration:cached");
+  }
+
   FieldDescr * field_descr = cello::field_descr();
 
   const int iax = field_descr->field_id("acceleration_x");
@@ -319,12 +404,15 @@ EnzoMethodBackgroundAcceleration::EnzoMethodBackgroundAcceleration
 
 
   // Do not need to refresh acceleration fields in this method
-  // since we do not need to know any ghost zone information
+  // since we do not need to know any ghost zone information.  If
+  // preceded by gravity, accelerations are read from its cache
   cello::simulation()->refresh_set_name(ir_post_,name());
   Refresh * refresh = cello::refresh(ir_post_);
-  refresh->add_field(iax);
-  refresh->add_field(iay);
-  refresh->add_field(iaz);
+  if (! preceded_by_gravity) {
+    refresh->add_field(iax);
+    refresh->add_field(iay);
+    refresh->add_field(iaz);
+  }
 
   return;
 
@@ -335,6 +423,11 @@ EnzoMethodBackgroundAcceleration::EnzoMethodBackgroundAcceleration
 void EnzoMethodBackgroundAcceleration::compute ( Block * block) throw()
 {
   if (block->is_leaf()){
+    if (! zero_acceleration_) {
+      // add to accelerations computed from the current potential
+      static_cast<EnzoMethodGravity*>(enzo::problem()->method("gravity"))
+        ->update_accelerations(block);
+    }
     this->compute_(block);
   }
 
@@ -389,6 +482,14 @@ void EnzoMethodBackgroundAcceleration::compute_ (Block * block) throw()
 
   Particle particle = enzo_block->data()->particle();
 
+  // a cache allocated just now (e.g. after restart) is not current
+  const bool is_allocated = field.values ("background_acceleration_x");
+  enzo_float * cache[3] = {
+    (enzo_float*) field.values_demand ("background_acceleration_x"),
+    (enzo_float*) field.values_demand ("background_acceleration_y"),
+    (enzo_float*) field.values_demand ("background_acceleration_z") };
+  const bool is_current = cache_ && is_allocated && (s_cached_(block) != 0);
+
   // unclear why the gravitational constant is different in each branch!
 
   if (galaxy_pack_dfltU_ != nullptr) {
@@ -396,8 +497,14 @@ void EnzoMethodBackgroundAcceleration::compute_ (Block * block) throw()
     double G_code = enzo::grav_constant_cgs() * units->density() * units->time() * units->time();
     const GalaxyModel functor(*galaxy_pack_dfltU_, units);
 
-    compute_accel_(functor, ax, ay, az, G_code, &particle, block_info, rank,
-                   cosmo_a, potential_center_xyz_, enzo_block->dt);
+    if (cache_) {
+      compute_accel_cached_(functor, cache, is_current, ax, ay, az, G_code,
+                            &particle, block_info, rank,
+                            potential_center_xyz_);
+    } else {
+      compute_accel_(functor, ax, ay, az, G_code, &particle, block_info, rank,
+                     cosmo_a, potential_center_xyz_, enzo_block->dt);
+    }
 
   } else if (point_mass_pack_dfltU_ != nullptr) {
 
@@ -406,8 +513,14 @@ void EnzoMethodBackgroundAcceleration::compute_ (Block * block) throw()
     const PointMassModel functor(*point_mass_pack_dfltU_, units,
                                  cosmo_a, block_info.cell_width);
 
-    compute_accel_(functor, ax, ay, az, G_code, &particle, block_info, rank,
-                   cosmo_a, potential_center_xyz_, enzo_block->dt);
+    if (cache_) {
+      compute_accel_cached_(functor, cache, is_current, ax, ay, az, G_code,
+                            &particle, block_info, rank,
+                            potential_center_xyz_);
+    } else {
+      compute_accel_(functor, ax, ay, az, G_code, &particle, block_info, rank,
+                     cosmo_a, potential_center_xyz_, enzo_block->dt);
+    }
 
   } else {
 
@@ -416,6 +529,8 @@ void EnzoMethodBackgroundAcceleration::compute_ (Block * block) throw()
 
   }
 
+  if (cache_) s_cached_(block) = 1;
+
 
   return;
 
@@ -34,7 +34,9 @@ public: // interface
       potential_center_xyz_{}, // fills array with zeros
       flavor_(""),
       galaxy_pack_dfltU_(nullptr),
-      point_mass_pack_dfltU_(nullptr)
+      point_mass_pack_dfltU_(nullptr),
+      cache_(false),
+      i_cached_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -51,11 +53,17 @@ public: // interface
     p | flavor_;
     p | galaxy_pack_dfltU_;
     p | point_mass_pack_dfltU_;
+    p | cache_;
+    p | i_cached_;
   }
 
   ///
   virtual void compute (Block *block) throw();
 
+  /// compute() does nothing on non-leaf Blocks
+  virtual bool leaf_only () const throw()
+  { return true; }
+
   virtual std::string name () throw()
   { return "background_acceleration"; }
 
@@ -68,6 +76,11 @@ protected: // methods
 
   void compute_ (Block *block) throw();
 
+  /// Whether the Block's background_acceleration_* fields are current;
+  /// new Blocks start with 0
+  int & s_cached_(Block * block) const
+  { return *block->data()->scalar_int().value(i_cached_); }
+
 protected: // attributes
 
   /// Convenience. Gravitational constant times 4 pi
@@ -88,6 +101,13 @@ protected: // attributes
   ///
   /// (either this or galaxy_pack_dfltU_ must be non-null -- but not both)
   std::unique_ptr<EnzoPotentialConfigPointMass> point_mass_pack_dfltU_;
+
+  /// Whether grid accelerations are cached in background_acceleration_*
+  /// fields, which requires a static potential (no cosmology)
+  bool cache_;
+
+  /// Index of the Block scalar marking the cache as current
+  int i_cached_;
 };
 
 
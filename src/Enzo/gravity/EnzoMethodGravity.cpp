@@ -26,13 +26,32 @@ EnzoMethodGravity::EnzoMethodGravity(ParameterGroup p, int index_solver,
     order_(p.value_integer("order",4)),
     ir_exit_(-1),
     index_prolong_(index_prolong),
-    dt_max_(p.value_float("dt_max",1.0e10))
+    dt_max_(p.value_float("dt_max",1.0e10)),
+    warm_start_(p.value_integer("warm_start",0)),
+    ix0_(-1),
+    i_num_solve_(-1),
+    i_accel_cycle_(-1)
 {
   const bool accumulate = p.value_logical("accumulate",true);
 
+  ASSERT1 ("EnzoMethodGravity::EnzoMethodGravity()",
+           "Method:gravity:warm_start = %d must be 0, 1, or 2",
+           warm_start_,
+           (0 <= warm_start_ && warm_start_ <= 2));
+  ASSERT ("EnzoMethodGravity::EnzoMethodGravity()",
+          "Method:gravity:warm_start = 2 requires Field:history >= 2",
+          (warm_start_ < 2 || cello::config()->field_history >= 2));
+
+  if (warm_start_ > 0) {
+    ix0_ = cello::field_descr()->insert_temporary();
+    i_num_solve_ = cello::scalar_descr_int()->new_value("gravity:num_solve");
+  }
+
+  i_accel_cycle_ = cello::scalar_descr_int()->new_value("acceleration:cycle");
+
   // Change this if fields used in this routine change
-  // declare required fields
-  cello::define_field ("density");
+  // declare required fields; "density" is not required since the
+  // gas density, if any, is added to density_total by pm_deposit
   cello::define_field ("density_total");
   cello::define_field ("B");
   cello::define_field ("potential");
@@ -71,9 +90,9 @@ EnzoMethodGravity::EnzoMethodGravity(ParameterGroup p, int index_solver,
   Refresh * refresh = cello::refresh(ir_post_);
   refresh->set_prolong(index_prolong_);
 
-  refresh->add_field("acceleration_x");
-  refresh->add_field("acceleration_y");
-  refresh->add_field("acceleration_z");
+  // Acceleration fields are not refreshed since they are recomputed,
+  // including ghost zones, from the refreshed potential
+
   // Accumulate is used when particles are deposited into density_total
 
   if (accumulate) {
@@ -101,6 +120,21 @@ EnzoMethodGravity::EnzoMethodGravity(ParameterGroup p, int index_solver,
   refresh_exit->add_field("potential");
 
   refresh_exit->set_callback(CkIndex_EnzoBlock::p_method_gravity_end());
+
+  // Declare fields read and written, so that independent Methods can
+  // run while the solver waits (Method:<method>:overlap)
+
+  const FieldDescr * field_descr = cello::field_descr();
+  for (std::string field : {"density", "density_total", "density_particle",
+                            "density_particle_accumulate", "B", "potential",
+                            "acceleration_x", "acceleration_y",
+                            "acceleration_z"}) {
+    const int id_field = field_descr->field_id(field);
+    this->add_input_field_(id_field);
+    if (field != "density" && field != "density_particle") {
+      this->add_output_field_(id_field);
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -112,6 +146,9 @@ void EnzoMethodGravity::compute(Block * block) throw()
            "Error: pm_deposit method must precede gravity method.",
            enzo::problem()->method_precedes("pm_deposit", "gravity"));
   }
+  // accelerations are invalid until recomputed from the new potential
+  s_accel_cycle_(block) = 0;
+
   // Initialize the linear system
 
   Field field = block->data()->field();
@@ -189,6 +226,8 @@ void EnzoMethodGravity::compute(Block * block) throw()
   std::shared_ptr<Matrix> A (std::make_shared<EnzoMatrixLaplace>(order_));
   solver->set_field_x(ix);
   solver->set_field_b(ib);
+  if (warm_start_ > 0) compute_guess_(block);
+  solver->set_field_x0(ix0_);
 #ifdef DEBUG_COPY_B
   if (B_copy) for (int i=0; i<m; i++) B_copy[i] = B[i];
 #endif	
@@ -202,6 +241,65 @@ void EnzoMethodGravity::compute(Block * block) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodGravity::compute_guess_ (Block * block) throw()
+///   warm_start_ == 1:  X0 = P(1)
+///   warm_start_ == 2:  X0 = P(1) + (t - t(1)) / (t(1) - t(2)) * (P(1) - P(2))
+///
+/// where P(k) and t(k) are the potential and time saved in Field
+/// history k.  Blocks created by refinement or coarsening have no
+/// history, but their "potential" field was prolonged or restricted
+/// from the previous mesh, so it is used until enough history has
+/// been saved on the Block.
+{
+  Field field = block->data()->field();
+
+  field.allocate_temporary(ix0_);
+
+  int mx,my,mz;
+  field.dimensions (0,&mx,&my,&mz);
+  const int m = mx*my*mz;
+
+  enzo_float * X0 = (enzo_float*) field.values (ix0_);
+
+  if (! block->is_leaf()) {
+    for (int i=0; i<m; i++) X0[i] = 0.0;
+    return;
+  }
+
+  const int ip = field.field_id ("potential");
+  const int num_solve = s_num_solve_(block);
+  ++s_num_solve_(block);
+
+  const double t1 = field.history_time(1);
+  const double t2 = field.history_time(2);
+
+  if (warm_start_ == 2 && num_solve >= 2 && t1 > t2) {
+    const enzo_float * P1 = (enzo_float*) field.values (ip,1);
+    const enzo_float * P2 = (enzo_float*) field.values (ip,2);
+    const enzo_float f = (block->time() - t1) / (t1 - t2);
+    for (int i=0; i<m; i++) X0[i] = P1[i] + f*(P1[i] - P2[i]);
+  } else {
+    const enzo_float * P = (enzo_float*) field.values (ip);
+    for (int i=0; i<m; i++) X0[i] = P[i];
+  }
+
+  // Undo the 1/a scaling applied to the potential in
+  // compute_accelerations()
+
+  EnzoPhysicsCosmology * cosmology = enzo::cosmology();
+
+  if (cosmology) {
+    enzo_float cosmo_a = 1.0;
+    enzo_float cosmo_dadt = 0.0;
+    double dt   = block->dt();
+    double time = block->time();
+    cosmology-> compute_expansion_factor (&cosmo_a,&cosmo_dadt,time+0.5*dt);
+    for (int i=0; i<m; i++) X0[i] *= cosmo_a;
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoBlock::p_method_gravity_continue()
 {
   // So do refresh with barrier synch (note barrier instead of
@@ -265,6 +363,8 @@ void EnzoMethodGravity::compute_accelerations (EnzoBlock * enzo_block) throw()
 
   compute_acceleration.compute(enzo_block);
 
+  s_accel_cycle_(enzo_block) = enzo_block->cycle() + 1;
+
   // Clear "B" and "density_total" fields for next call
   // Note density_total may not be defined
 
@@ -274,6 +374,8 @@ void EnzoMethodGravity::compute_accelerations (EnzoBlock * enzo_block) throw()
   enzo_float * de_t = (enzo_float*) field.values("density_total");
   if (de_t) for (int i=0; i<m; i++) de_t[i] = 0.0;
 
+  if (warm_start_ > 0) field.deallocate_temporary(ix0_);
+
 #ifdef DEBUG_COPY_POTENTIAL
   enzo_float * potential_copy = (enzo_float*) field.values ("potential_copy");
   if (potential_copy) {
@@ -284,6 +386,34 @@ void EnzoMethodGravity::compute_accelerations (EnzoBlock * enzo_block) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodGravity::update_accelerations (Block * block) throw()
+{
+  // potential is already scaled by 1/a in cosmological simulations
+
+  if (block->is_leaf() && ! acceleration_is_current(block)) {
+    EnzoComputeAcceleration compute_acceleration(cello::rank(), order_);
+    compute_acceleration.compute(block);
+    s_accel_cycle_(block) = block->cycle() + 1;
+  }
+}
+
+//----------------------------------------------------------------------
+
+EnzoMethodGravity * EnzoMethodGravity::acceleration_cache
+(const std::string & consumer, int ghost_depth) throw()
+{
+  Problem * problem = enzo::problem();
+  EnzoMethodGravity * gravity = static_cast<EnzoMethodGravity*>
+    (problem->method("gravity"));
+  // accelerations computed after the consumer would be a cycle stale
+  return (gravity &&
+          problem->method_precedes("gravity",consumer) &&
+          gravity->acceleration_ghost_depth() >= ghost_depth) ?
+    gravity : nullptr;
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodGravity::timestep (Block * block) throw()
 {
   return timestep_(block);
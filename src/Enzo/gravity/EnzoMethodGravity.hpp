@@ -31,7 +31,11 @@ public: // interface
       order_(4),
       ir_exit_(-1),
       index_prolong_(0),
-      dt_max_(0.0)
+      dt_max_(0.0),
+      warm_start_(0),
+      ix0_(-1),
+      i_num_solve_(-1),
+      i_accel_cycle_(-1)
   {};
 
   /// Destructor
@@ -47,8 +51,11 @@ public: // interface
       order_(4),
       ir_exit_(-1),
       index_prolong_(0),
-      dt_max_(0.0)
-
+      dt_max_(0.0),
+      warm_start_(0),
+      ix0_(-1),
+      i_num_solve_(-1),
+      i_accel_cycle_(-1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -67,6 +74,10 @@ public: // interface
     p | order_;
     p | dt_max_;
     p | ir_exit_;
+    p | warm_start_;
+    p | ix0_;
+    p | i_num_solve_;
+    p | i_accel_cycle_;
 
   }
 
@@ -84,10 +95,45 @@ public: // interface
 
   void refresh_potential (EnzoBlock * enzo_block) throw();
 
+  /// Whether the acceleration fields on the block were computed from
+  /// the potential in the current cycle
+  bool acceleration_is_current (Block * block) const throw()
+  { return s_accel_cycle_(block) == block->cycle() + 1; }
+
+  /// Recompute the acceleration fields from the potential unless they
+  /// are current.  Methods following this one call this instead of
+  /// refreshing the acceleration fields
+  void update_accelerations (Block * block) throw();
+
+  /// Return the depth of ghost zones in which accelerations are
+  /// computed from the refreshed potential, so need no refresh
+  int acceleration_ghost_depth () const throw()
+  { return cello::config()->field_ghost_depth[0] - order_/2; }
+
+  /// Return the gravity Method if it precedes the named Method and
+  /// caches accelerations deep enough for it to use ghost_depth layers
+  /// of ghost zones, otherwise nullptr.  Must be called after all
+  /// Methods have been created, e.g. from Method::initialize_fields()
+  static EnzoMethodGravity * acceleration_cache
+  (const std::string & consumer, int ghost_depth) throw();
+
   protected: // methods
 
   void compute_ (EnzoBlock * enzo_block) throw();
 
+  /// Initialize the initial guess field for the solver from the
+  /// previous potential(s)
+  void compute_guess_ (Block * block) throw();
+
+  /// Return the number of previous solves on the block
+  int & s_num_solve_(Block * block)
+  { return *block->data()->scalar_int().value(i_num_solve_); }
+
+  /// Return one more than the cycle in which accelerations were last
+  /// computed on the block, or 0 if not computed since its creation
+  int & s_accel_cycle_(Block * block) const
+  { return *block->data()->scalar_int().value(i_accel_cycle_); }
+
   /// Compute maximum timestep for this method
   double timestep_ (Block * block) throw() ;
   
@@ -108,6 +154,19 @@ protected: // attributes
 
   /// Maximum timestep
   double dt_max_;
+
+  /// Initial guess: 0 zero, 1 previous potential, 2 linear
+  /// extrapolation from the previous two potentials
+  int warm_start_;
+
+  /// Temporary field for the initial guess
+  int ix0_;
+
+  /// Scalar index for the number of solves since the block was created
+  int i_num_solve_;
+
+  /// Scalar index for the cycle stamp of the acceleration fields
+  int i_accel_cycle_;
 };
 
 
@@ -36,8 +36,16 @@ extern "C" void  FORTRAN_NAME(dep_grid_cic)
 EnzoMethodPmDeposit::EnzoMethodPmDeposit (ParameterGroup p)
   : Method(),
     // read value from "Method:pm_deposit:alpha"
-    alpha_(p.value_float ("alpha",0.5))
+    alpha_(p.value_float ("alpha",0.5)),
+    // read value from "Method:pm_deposit:assignment"
+    assignment_(enzo_pm::assignment_from_string
+                (p.value_string ("assignment","cic"))),
+    // read value from "Method:pm_deposit:include_gas"
+    include_gas_(p.value_logical ("include_gas",true))
 {
+  // read value from "Method:pm_deposit:num_tasks"
+  this->set_num_tasks(p.value_integer("num_tasks", 1));
+
   // Check if particle types in "is_gravitating" group have either a constant
   // or an attribute called "mass" (but not both).
   ParticleDescr * particle_descr = cello::particle_descr();
@@ -62,13 +70,9 @@ EnzoMethodPmDeposit::EnzoMethodPmDeposit (ParameterGroup p)
   
   const int rank = cello::rank();
 
-  cello::define_field ("density");
   cello::define_field ("density_total");
   cello::define_field ("density_particle");
   cello::define_field ("density_particle_accumulate");
-  if (rank >= 1) cello::define_field ("velocity_x");
-  if (rank >= 2) cello::define_field ("velocity_y");
-  if (rank >= 3) cello::define_field ("velocity_z");
 
   // Initialize default Refresh object
 
@@ -76,10 +80,20 @@ EnzoMethodPmDeposit::EnzoMethodPmDeposit (ParameterGroup p)
 
   Refresh * refresh = cello::refresh(ir_post_);
 
-  refresh->add_field("density");
-  refresh->add_field("velocity_x");
-  refresh->add_field("velocity_y");
-  refresh->add_field("velocity_z");
+  // Gas fields are only needed to deposit the gas density; without
+  // them the refresh is empty, which is the dark-matter-only case
+
+  if (include_gas_) {
+    cello::define_field ("density");
+    if (rank >= 1) cello::define_field ("velocity_x");
+    if (rank >= 2) cello::define_field ("velocity_y");
+    if (rank >= 3) cello::define_field ("velocity_z");
+
+    refresh->add_field("density");
+    refresh->add_field("velocity_x");
+    refresh->add_field("velocity_y");
+    refresh->add_field("velocity_z");
+  }
 }
 
 //----------------------------------------------------------------------
@@ -93,6 +107,10 @@ void EnzoMethodPmDeposit::pup (PUP::er &p)
   Method::pup(p);
 
   p | alpha_;
+  int assignment = int(assignment_);
+  p | assignment;
+  assignment_ = pm_assignment(assignment);
+  p | include_gas_;
 }
 
 //----------------------------------------------------------------------
@@ -115,10 +133,14 @@ namespace { // define local helper functions in anonymous namespace
   ///     dimension of an array (including ghost cells)
   /// @param[in]      gx,gy,gz Specifies the number of cells in the ghost zone
   ///     for each dimensions
+  /// @param[in]  assignment The particle-mesh assignment scheme
+  /// @param[in]  num_tasks Number of tasks the batches of each particle
+  ///     type are divided between
   void deposit_particles_(const CelloView<enzo_float,3>& density_particle_arr,
                           Block* block, double dt_div_cosmoa, double inv_vol,
                           int mx, int my, int mz,
-                          int gx, int gy, int gz)
+                          int gx, int gy, int gz,
+                          pm_assignment assignment, int num_tasks)
   {
     Particle particle (block->data()->particle());
     Field    field    (block->data()->field());
@@ -138,33 +160,42 @@ namespace { // define local helper functions in anonymous namespace
     block->lower(&xm,&ym,&zm);
     block->upper(&xp,&yp,&zp);
 
+    enzo_pm::PmGeometry<enzo_float> geometry;
+    geometry.mx = mx;
+    geometry.my = my;
+    geometry.mz = mz;
+    geometry.gx = gx;
+    geometry.gy = gy;
+    geometry.gz = gz;
+    geometry.lower[0] = xm;
+    geometry.lower[1] = ym;
+    geometry.lower[2] = zm;
+    geometry.scale[0] = nx / (xp - xm);
+    geometry.scale[1] = ny / (yp - ym);
+    geometry.scale[2] = nz / (zp - zm);
+    geometry.dt = dt_div_cosmoa;
+
     // Get the number of particle types in the "is_gravitating" group
     ParticleDescr * particle_descr = cello::particle_descr();
     Grouping * particle_groups = particle_descr->groups();
     const int num_is_grav = particle_groups->size("is_gravitating");
 
-    // For particle types where "mass" is an attribute,
-    // pmass will be set to point to array of particle masses
-    // For particle types where "mass" is a constant,
-    // pmass will point to the constant value.
-    enzo_float * pmass = NULL;
-
-    // The for the mass "array" (if "mass" is a constant, then
-    // there won't be a mass array, and the stride will be set
-    // to zero.
-    int dm;
+    // Batches are divided between num_tasks tasks, each depositing
+    // into its own array, which are summed after all particle types
+    // are deposited.  Task 0 deposits directly into de_p
+    const int m = mx*my*mz;
+    std::vector< std::vector<enzo_float> > de_task (num_tasks - 1);
 
     // Loop over particle types in "is_gravitating" group
     for (int ipt = 0; ipt < num_is_grav; ipt++) {
       const int it = particle.type_index(particle_groups->item("is_gravitating",ipt));
 
-      // Index for mass attribute / constant
-      int imass = 0;
-
-      // check correct precision for position
+      // check correct precision for position; integer positions are
+      // converted to enzo_float below
       int ia = particle.attribute_index(it,"x");
       int ba = particle.attribute_bytes(it,ia); // "bytes (actual)"
       int be = sizeof(enzo_float);                // "bytes (expected)"
+      const bool is_int = particle.position_is_int(it);
 
       ASSERT4 ("EnzoMethodPmUpdate::compute()",
 	       "Particle type %s attribute %s defined as %s but expecting %s",
@@ -172,260 +203,124 @@ namespace { // define local helper functions in anonymous namespace
 	       particle.attribute_name(it,ia).c_str(),
 	       ((ba == 4) ? "single" : ((ba == 8) ? "double" : "quadruple")),
 	       ((be == 4) ? "single" : ((be == 8) ? "double" : "quadruple")),
-	       (ba == be));
-
-
-      // Loop over batches
-      for (int ib=0; ib<particle.num_batches(it); ib++) {
-
-	const int np = particle.num_particles(it,ib);
-
-	if (particle.has_attribute(it,"mass")) {
-
-	  // Particle type has an attribute called "mass".
-	  // In this case we set pmass to point to the mass attribute array
-	  // Also set dm to be the stride for the "mass" attribute
-	  imass = particle.attribute_index(it,"mass");
-	  pmass = (enzo_float *) particle.attribute_array( it, imass, ib);
-	  dm = particle.stride(it,imass);
-
-	} else {
-
-	  // Particle type has a constant called "mass".
-	  // In this case we set pmass to point to the value
-	  // of the mass constant.
-	  // dm is set to 0, which will mean that we can loop through an
-	  // "array" of length 1.
-	  imass = particle.constant_index(it,"mass");
-	  pmass = (enzo_float*)particle.constant_value(it,imass);
-	  dm = 0;
-	}
-
-	// Deposit densities to the grid with CIC scheme
-	if (rank == 1) {
-
-	  const int ia_x  = particle.attribute_index(it,"x");
-	  const int ia_vx = particle.attribute_index(it,"vx");
-
-	  enzo_float * xa =  (enzo_float *)particle.attribute_array (it,ia_x,ib);
-	  enzo_float * vxa = (enzo_float *)particle.attribute_array (it,ia_vx,ib);
-	  const int dp =  particle.stride(it,ia_x);
-	  const int dv =  particle.stride(it,ia_vx);
-#ifdef DEBUG_COLLAPS
-	  CkPrintf ("DEBUG_COLLAPSE vxa[0] = %lg\n",vxa[0]);
-#endif
-	  for (int ip=0; ip<np; ip++) {
-	    double x = xa[ip*dp] + vxa[ip*dv]*dt_div_cosmoa;
-
-	    double tx = nx*(x - xm) / (xp - xm) - 0.5;
-
-	    int ix0 = gx + floor(tx);
-	    int ix1 = ix0 + 1;
-	    double x0 = 1.0 - (tx - floor(tx));
-	    double x1 = 1.0 - x0;
-
-	    // Density is mass times inverse volume
-	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
-	    // just dereferences pmass.
-	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0] += pdens * x0;
-	    de_p[ix1] += pdens * x1;
-
-	    if (de_p[ix0] < 0.0)
-	      WARNING3("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d] = %g",
-		       block->name().c_str(),ix0,de_p[ix0]);
-
-	    if (de_p[ix1] < 0.0)
-	      WARNING3("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d] = %g",
-		       block->name().c_str(),ix1,de_p[ix1]);
-
-	  } // Loop over particles in batch
-
-	} else if (rank == 2) {
-
-	  const int ia_x  = particle.attribute_index(it,"x");
-	  const int ia_y  = particle.attribute_index(it,"y");
-	  const int ia_vx = particle.attribute_index(it,"vx");
-	  const int ia_vy = particle.attribute_index(it,"vy");
-	  // Batch arrays
-	  enzo_float * xa  = (enzo_float *)particle.attribute_array (it,ia_x,ib);
-	  enzo_float * ya  = (enzo_float *)particle.attribute_array (it,ia_y,ib);
-	  enzo_float * vxa = (enzo_float *)particle.attribute_array (it,ia_vx,ib);
-	  enzo_float * vya = (enzo_float *)particle.attribute_array (it,ia_vy,ib);
-
-	  const int dp =  particle.stride(it,ia_x);
-	  const int dv =  particle.stride(it,ia_vx);
-
-	  for (int ip=0; ip<np; ip++) {
-
-	    double x = xa[ip*dp] + vxa[ip*dv]*dt_div_cosmoa;
-	    double y = ya[ip*dp] + vya[ip*dv]*dt_div_cosmoa;
-
-	    double tx = nx*(x - xm) / (xp - xm) - 0.5;
-	    double ty = ny*(y - ym) / (yp - ym) - 0.5;
-	    int ix0 = gx + floor(tx);
-	    int iy0 = gy + floor(ty);
-	    int ix1 = ix0 + 1;
-	    int iy1 = iy0 + 1;
-	    double x0 = 1.0 - (tx - floor(tx));
-	    double y0 = 1.0 - (ty - floor(ty));
-	    double x1 = 1.0 - x0;
-	    double y1 = 1.0 - y0;
-
-	    // Density is mass times inverse volume
-	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
-	    // just dereferences pmass.
-	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0+mx*iy0] += pdens * x0 * y0;
-	    de_p[ix1+mx*iy0] += pdens * x1 * y0;
-	    de_p[ix0+mx*iy1] += pdens * x0 * y1;
-	    de_p[ix1+mx*iy1] += pdens * x1 * y1;
-
-	    if (de_p[ix0+mx*iy0] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,de_p[ix0+mx*iy0]);
-
-	    if (de_p[ix1+mx*iy0] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,de_p[ix1+mx*iy0]);
-
-	    if (de_p[ix0+mx*iy1] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,de_p[ix0+mx*iy1]);
-
-	    if (de_p[ix1+mx*iy1] < 0.0)
-	      WARNING4("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,de_p[ix1+mx*iy1]);
-
-
-	  } // Loop over particles in batch
-
-	} else if (rank == 3) {
-
-	  const int ia_x  = particle.attribute_index(it,"x");
-	  const int ia_y  = particle.attribute_index(it,"y");
-	  const int ia_z  = particle.attribute_index(it,"z");
-	  const int ia_vx = particle.attribute_index(it,"vx");
-	  const int ia_vy = particle.attribute_index(it,"vy");
-	  const int ia_vz = particle.attribute_index(it,"vz");
-	  enzo_float * xa  = (enzo_float *) particle.attribute_array (it,ia_x,ib);
-	  enzo_float * ya  = (enzo_float *) particle.attribute_array (it,ia_y,ib);
-	  enzo_float * za  = (enzo_float *) particle.attribute_array (it,ia_z,ib);
-
-	  // Particle batch velocities
-	  enzo_float * vxa = (enzo_float *) particle.attribute_array (it,ia_vx,ib);
-	  enzo_float * vya = (enzo_float *) particle.attribute_array (it,ia_vy,ib);
-	  enzo_float * vza = (enzo_float *) particle.attribute_array (it,ia_vz,ib);
-
-#ifdef DEBUG_COLLAPSE
-	  CkPrintf ("DEBUG_COLLAPSE vxa[0] = %lg\n",vxa[0]);
-#endif
-
-	  const int dp =  particle.stride(it,ia_x);
-	  const int dv =  particle.stride(it,ia_vx);
-
-	  for (int ip=0; ip<np; ip++) {
-
-	    // Copy batch particle velocities to temporary block field velocities
-
-	    double x = xa[ip*dp] + vxa[ip*dv]*dt_div_cosmoa;
-	    double y = ya[ip*dp] + vya[ip*dv]*dt_div_cosmoa;
-	    double z = za[ip*dp] + vza[ip*dv]*dt_div_cosmoa;
-
-	    double tx = nx*(x - xm) / (xp - xm) - 0.5;
-	    double ty = ny*(y - ym) / (yp - ym) - 0.5;
-	    double tz = nz*(z - zm) / (zp - zm) - 0.5;
-
-	    int ix0 = gx + floor(tx);
-	    int iy0 = gy + floor(ty);
-	    int iz0 = gz + floor(tz);
-
-	    int ix1 = ix0 + 1;
-	    int iy1 = iy0 + 1;
-	    int iz1 = iz0 + 1;
-
-	    double x0 = 1.0 - (tx - floor(tx));
-	    double y0 = 1.0 - (ty - floor(ty));
-	    double z0 = 1.0 - (tz - floor(tz));
-
-	    double x1 = 1.0 - x0;
-	    double y1 = 1.0 - y0;
-	    double z1 = 1.0 - z0;
-
-	    // Density is mass times inverse volume
-	    // If mass is a constant, then dm is 0, pmass[ip * dm] is pmass[0], which
-	    // just dereferences pmass.
-	    enzo_float pdens = pmass[ip*dm] * inv_vol;
-	    de_p[ix0+mx*(iy0+my*iz0)] += pdens * x0 * y0 * z0;
-	    de_p[ix1+mx*(iy0+my*iz0)] += pdens * x1 * y0 * z0;
-	    de_p[ix0+mx*(iy1+my*iz0)] += pdens * x0 * y1 * z0;
-	    de_p[ix1+mx*(iy1+my*iz0)] += pdens * x1 * y1 * z0;
-	    de_p[ix0+mx*(iy0+my*iz1)] += pdens * x0 * y0 * z1;
-	    de_p[ix1+mx*(iy0+my*iz1)] += pdens * x1 * y0 * z1;
-	    de_p[ix0+mx*(iy1+my*iz1)] += pdens * x0 * y1 * z1;
-	    de_p[ix1+mx*(iy1+my*iz1)] += pdens * x1 * y1 * z1;
-
-	    if (de_p[ix0+mx*(iy0+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,iz0,
-		       de_p[ix0+mx*(iy0+my*iz0)]);
-
-	    if (de_p[ix1+mx*(iy0+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,iz0,
-		       de_p[ix1+mx*(iy0+my*iz0)]);
-
-	    if (de_p[ix0+mx*(iy1+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,iz0,
-		       de_p[ix0+mx*(iy1+my*iz0)]);
-
-	    if (de_p[ix1+mx*(iy1+my*iz0)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,iz0,
-		       de_p[ix1+mx*(iy1+my*iz0)]);
-
-	    if (de_p[ix0+mx*(iy0+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy0,iz1,
-		       de_p[ix0+mx*(iy0+my*iz1)]);
-
-	    if (de_p[ix1+mx*(iy0+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy0,iz1,
-		       de_p[ix1+mx*(iy0+my*iz1)]);
-
-	    if (de_p[ix0+mx*(iy1+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix0,iy1,iz1,
-		       de_p[ix0+mx*(iy1+my*iz1)]);
-
-	    if (de_p[ix1+mx*(iy1+my*iz1)] < 0.0)
-	      WARNING5("EnzoMethodPmDeposit",
-		       "Block %s: de_p[%d,%d,%d] = %g",
-		       block->name().c_str(),ix1,iy1,iz1,
-		       de_p[ix1+mx*(iy1+my*iz1)]);
-
-	  } // Loop over particles in batch
-	} // if rank == 3
-
-      } // Loop over batches
+	       (is_int || ba == be));
+
+
+      const char * position[3] = {"x","y","z"};
+      const char * velocity[3] = {"vx","vy","vz"};
+      int ia_x3[3] = {-1,-1,-1};
+      int ia_v3[3] = {-1,-1,-1};
+      for (int axis=0; axis<rank; axis++) {
+	ia_x3[axis] = particle.attribute_index(it,position[axis]);
+	ia_v3[axis] = particle.attribute_index(it,velocity[axis]);
+      }
+      geometry.dp = particle.stride(it,ia_x3[0]);
+      geometry.dv = particle.stride(it,ia_v3[0]);
+
+      // Deposit batches [ib0,ib1)
+      auto deposit_batches = [&] (int task, int ib0, int ib1) {
+
+        enzo_float * de = de_p;
+        if (task > 0) {
+          de_task[task-1].resize(m,0.0);
+          de = de_task[task-1].data();
+        }
+
+        enzo_pm::PmGeometry<enzo_float> geometry_task = geometry;
+
+        // For particle types where "mass" is an attribute,
+        // pmass will be set to point to array of particle masses
+        // For particle types where "mass" is a constant,
+        // pmass will point to the constant value.
+        enzo_float * pmass = NULL;
+
+        // The for the mass "array" (if "mass" is a constant, then
+        // there won't be a mass array, and the stride will be set
+        // to zero.
+        int dm;
+
+        // Global positions, for particle types with integer positions
+        std::vector<double> position_global;
+        std::vector<enzo_float> position_float;
+
+        for (int ib=ib0; ib<ib1; ib++) {
+
+          const int np = particle.num_particles(it,ib);
+
+          if (particle.has_attribute(it,"mass")) {
+
+            // Particle type has an attribute called "mass".
+            // In this case we set pmass to point to the mass attribute array
+            // Also set dm to be the stride for the "mass" attribute
+            const int imass = particle.attribute_index(it,"mass");
+            pmass = (enzo_float *) particle.attribute_array( it, imass, ib);
+            dm = particle.stride(it,imass);
+
+          } else {
+
+            // Particle type has a constant called "mass".
+            // In this case we set pmass to point to the value
+            // of the mass constant.
+            // dm is set to 0, which will mean that we can loop through an
+            // "array" of length 1.
+            const int imass = particle.constant_index(it,"mass");
+            pmass = (enzo_float*)particle.constant_value(it,imass);
+            dm = 0;
+          }
+
+          // Deposit densities to the grid
+          // If mass is a constant, then dm is 0 and pmass[ip * dm] is pmass[0]
+          for (int axis=0; axis<3; axis++) {
+            geometry_task.x[axis] = (axis < rank) ? (enzo_float *)
+              particle.attribute_array (it,ia_x3[axis],ib) : nullptr;
+            geometry_task.v[axis] = (axis < rank) ? (enzo_float *)
+              particle.attribute_array (it,ia_v3[axis],ib) : nullptr;
+          }
+
+          if (is_int) {
+            // integer positions are relative to the Block: deposit from
+            // contiguous global positions instead
+            const double lower[3] = {xm,ym,zm};
+            const double upper[3] = {xp,yp,zp};
+            position_global.resize(3*np);
+            position_float.resize(3*np);
+            double * xd = position_global.data();
+            particle.position (it,ib, xd, (rank >= 2) ? xd + np : nullptr,
+                               (rank >= 3) ? xd + 2*np : nullptr, lower,upper);
+            for (int i=0; i<rank*np; i++) position_float[i] = xd[i];
+            for (int axis=0; axis<rank; axis++) {
+              geometry_task.x[axis] = position_float.data() + axis*np;
+            }
+            geometry_task.dp = 1;
+          }
+
+          enzo_pm::deposit (assignment, rank, de, geometry_task, np,
+                            pmass, dm, inv_vol);
+        }
+      };
+
+      cello::parallel_for (0, particle.num_batches(it), num_tasks,
+                           deposit_batches);
+
 
     } // Loop over particle types in "is_gravitating" group
 
+    for (size_t task=0; task<de_task.size(); task++) {
+      const enzo_float * de = de_task[task].data();
+      if (de_task[task].size() == 0) continue;
+      for (int i=0; i<m; i++) de_p[i] += de[i];
+    }
+
+    // check for negative densities once after depositing, rather than
+    // after each particle, so that the deposit loops stay vectorizable
+    for (int i=0; i<m; i++) {
+      if (de_p[i] < 0.0) {
+	WARNING3("EnzoMethodPmDeposit",
+		 "Block %s: de_p[%d] = %g",
+		 block->name().c_str(),i,de_p[i]);
+	break;
+      }
+    }
   }
 
   //----------------------------------------------------------------------
@@ -594,7 +489,7 @@ void EnzoMethodPmDeposit::compute ( Block * block) throw()
 
       deposit_particles_(density_particle_arr, block, dt_div_cosmoa, inv_vol,
                          mx, my, mz,
-                         gx, gy, gz);
+                         gx, gy, gz, assignment_, num_tasks());
 
       // update density_tot_arr
       density_particle_arr.copy_to(density_tot_arr);
@@ -603,7 +498,7 @@ void EnzoMethodPmDeposit::compute ( Block * block) throw()
 
 
     // add mass from gas
-    {
+    if (include_gas_) {
       // Grid_DepositBaryons.C from enzo-dev overrides the drift time for the
       // gas density to be zero when using the PPM and Zeus solvers.
       //
@@ -25,7 +25,9 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodPmDeposit (CkMigrateMessage *m)
     : Method (m),
-      alpha_(0.0)
+      alpha_(0.0),
+      assignment_(pm_assignment::cic),
+      include_gas_(true)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -45,6 +47,13 @@ protected: // attributes
   /// Deposit at time + alpha*dt
   double alpha_;
 
+  /// Particle-mesh assignment scheme (NGP, CIC or TSC)
+  pm_assignment assignment_;
+
+  /// Whether gas density is added to density_total; if not, no gas
+  /// fields are defined or refreshed
+  bool include_gas_;
+
 };
 
 #endif /* ENZO_ENZO_METHOD_PM_DEPOSIT_HPP */
@@ -12,6 +12,7 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <complex>
 #include <string>
 #include <vector>
 
@@ -44,9 +45,12 @@
 #include "gravity/EnzoComputeAcceleration.hpp"
 
 #include "gravity/solvers/EnzoSolverBiCgStab.hpp"
+#include "gravity/solvers/EnzoSolverBlockMg.hpp"
 #include "gravity/solvers/EnzoSolverCg.hpp"
+#include "gravity/solvers/EnzoSolverChebyshev.hpp"
 #include "gravity/solvers/EnzoSolverDd.hpp"
 #include "gravity/solvers/EnzoSolverDiagonal.hpp"
+#include "gravity/solvers/EnzoSolverFft.hpp"
 #include "gravity/solvers/EnzoSolverJacobi.hpp"
 #include "gravity/solvers/EnzoSolverMg0.hpp"
 
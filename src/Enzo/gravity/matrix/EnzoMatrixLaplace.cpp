@@ -363,3 +363,109 @@ void EnzoMatrixLaplace::diagonal_ (enzo_float * X, int g0) const throw()
   
 }
 
+
+//----------------------------------------------------------------------
+
+bool EnzoMatrixLaplace::jacobi
+(int i_x, int i_b, double w, int n, Block * block, int g0) throw()
+{
+  Field field = block->data()->field();
+
+  field.dimensions(0,&mx_,&my_,&mz_);
+  block->cell_width (&hx_,&hy_,&hz_);
+
+  enzo_float * X = (enzo_float * ) field.values(i_x);
+  enzo_float * B = (enzo_float * ) field.values(i_b);
+
+  const int rank = cello::rank();
+
+  // stencil coefficients and normalization, as in matvec_()
+
+  const double c2[] = {-2.0, 1.0};
+  const double c4[] = {-30.0, 16.0, -1.0};
+  const double c6[] = {-2720.0, 1455.0, -96.0, 1.0};
+  const double norm = (order_ == 2) ? 1.0 : ((order_ == 4) ? 12.0 : 1080.0);
+
+  const double d[3] = {
+    (rank >= 1) ? 1.0/(norm*hx_*hx_) : 0.0,
+    (rank >= 2) ? 1.0/(norm*hy_*hy_) : 0.0,
+    (rank >= 3) ? 1.0/(norm*hz_*hz_) : 0.0 };
+
+  const int s = ghost_depth();
+  g0 = std::max(s,g0);
+
+  for (int k=0; k<n; k++) {
+    const int g = g0 + k*s;
+    const int gx = (mx_ > 1) ? g : 0;
+    const int gy = (my_ > 1) ? g : 0;
+    const int gz = (mz_ > 1) ? g : 0;
+    if (order_ == 2) {
+      jacobi_sweep_<1>(X,B,c2,d,w,gx,gy,gz);
+    } else if (order_ == 4) {
+      jacobi_sweep_<2>(X,B,c4,d,w,gx,gy,gz);
+    } else if (order_ == 6) {
+      jacobi_sweep_<3>(X,B,c6,d,w,gx,gy,gz);
+    } else {
+      ERROR1 ("EnzoMatrixLaplace::jacobi()",
+              "Order %d operator is not supported",
+              order_);
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------
+
+template <int S>
+void EnzoMatrixLaplace::jacobi_sweep_
+(enzo_float * X, const enzo_float * B,
+ const double c[], const double d[3], double w,
+ int gx, int gy, int gz) const throw()
+{
+  // offsets for unused dimensions are 0: their terms are multiplied by
+  // d[axis] == 0 but stay in bounds
+
+  const int idx = 1;
+  const int idy = (my_ > 1) ? mx_ : 0;
+  const int idz = (mz_ > 1) ? mx_*my_ : 0;
+
+  enzo_float ck[S+1][3];
+  for (int k=0; k<=S; k++) {
+    for (int axis=0; axis<3; axis++) ck[k][axis] = c[k]*d[axis];
+  }
+  const enzo_float diag = ck[0][0] + ck[0][1] + ck[0][2];
+  const enzo_float wd = w / diag;
+
+  const int mp = mx_*my_;
+  std::vector<enzo_float> ring ((S+1)*mp);
+
+  auto write_back = [&] (int iz) {
+    const enzo_float * P = &ring[(iz % (S+1))*mp];
+    for (int iy=gy; iy<my_-gy; iy++) {
+      for (int ix=gx; ix<mx_-gx; ix++) {
+        const int ip = ix + mx_*iy;
+        X[ip + mp*iz] = P[ip];
+      }
+    }
+  };
+
+  for (int iz=gz; iz<mz_-gz; iz++) {
+    enzo_float * P = &ring[(iz % (S+1))*mp];
+    for (int iy=gy; iy<my_-gy; iy++) {
+      for (int ix=gx; ix<mx_-gx; ix++) {
+        const int ip = ix + mx_*iy;
+        const enzo_float * xp = X + ip + mp*iz;
+        enzo_float ax = diag*xp[0];
+        for (int k=1; k<=S; k++) {
+          ax += ck[k][0]*(xp[-k*idx] + xp[k*idx])
+            +   ck[k][1]*(xp[-k*idy] + xp[k*idy])
+            +   ck[k][2]*(xp[-k*idz] + xp[k*idz]);
+        }
+        P[ip] = xp[0] + wd*(B[ip + mp*iz] - ax);
+      }
+    }
+    // plane iz-S is no longer read by later planes
+    if (iz - S >= gz) write_back(iz - S);
+  }
+  for (int iz=std::max(gz,mz_-gz-S); iz<mz_-gz; iz++) write_back(iz);
+}
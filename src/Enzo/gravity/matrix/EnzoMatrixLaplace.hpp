@@ -99,8 +99,21 @@ public: // virtual functions
   virtual int ghost_depth() const throw()
   { return (order_ == 2) ? 1 : ( (order_ == 4) ? 2 : 3); }
 
+  /// Fused Jacobi sweeps: residual, diagonal, and update in one pass
+  virtual bool jacobi (int ix, int ib, double w, int n,
+                       Block * block, int g0=1) throw();
+
 protected: // functions
 
+  /// One Jacobi sweep for a stencil of half-width S with coefficients
+  /// c[0..S] scaled by d[axis], excluding (gx,gy,gz) layers.  New values
+  /// are held in a ring of S+1 planes, each written back once it is no
+  /// longer needed as input
+  template <int S>
+  void jacobi_sweep_ (enzo_float * X, const enzo_float * B,
+                      const double c[], const double d[3], double w,
+                      int gx, int gy, int gz) const throw();
+
   void matvec_ (enzo_float * Y, enzo_float * X, int g0) const throw();
 
   void diagonal_ (enzo_float * X, int g0) const throw();
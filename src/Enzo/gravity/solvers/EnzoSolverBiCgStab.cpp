@@ -443,13 +443,15 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
   if (is_finest_(block)) {
 
     const bool reuse_x = reuse_solution_ (block->cycle());
+    // initial guess supplied by the caller takes precedence over X_copy
+    const bool guess_x = (ix0_ >= 0);
 #ifdef TRACE_SOLVER_BCG      
     if (CkMyPe()==0) {
       CkPrintf ("DEBUG_SOLVER_BCG reusing solution X <- X_copy \n");
       fflush(stdout);
     }
 #endif    
-    if ( reuse_x ) {
+    if ( reuse_x || guess_x ) {
 #ifdef TRACE_SOLVER_BCG      
 
       if (CkMyPe()==0) {
@@ -458,7 +460,9 @@ void EnzoSolverBiCgStab::compute_(EnzoBlock* block) throw() {
       }
 #endif      
 
-      enzo_float* X_copy  = (enzo_float*) field.values("X_copy");
+      enzo_float* X_copy  = guess_x ?
+        (enzo_float*) field.values(ix0_) :
+        (enzo_float*) field.values("X_copy");
 
       for (int i=0; i<m_; i++) X[i] = X_copy[i];
 
@@ -766,8 +770,12 @@ void EnzoSolverBiCgStab::loop_0(EnzoBlock* block) throw() {
   TRACE_SCALAR(block,"err_",S(err));
 
 
-  const bool is_converged = (S(err) < res_tol_);
-  const bool is_diverged  = (iter >= iter_max_);
+  // error is relative to ||B||, so err0 measures how far the initial
+  // guess (e.g. the previous solution) is from the solution
+
+  const bool is_converged =
+    (S(err) < adaptive_res_tol_(block,res_tol_,S(err0)));
+  const bool is_diverged  = (iter >= adaptive_iter_max_(block,iter_max_));
 
   if (is_converged) {
     if (block->level() == coarse_level_) {
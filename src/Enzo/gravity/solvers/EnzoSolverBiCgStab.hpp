@@ -174,6 +174,7 @@ public: // interface
   /// Allocate temporary Fields
   void allocate_temporary_(Block * block)
   {
+    MemoryGroup memory_group (memory_group_solver);
     Field field = block->data()->field();
     field.allocate_temporary(ir_);
     field.allocate_temporary(ir0_);
@@ -0,0 +1,374 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverBlockMg.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Block-local multigrid preconditioner: X ~ A^-1 B per Block
+///
+/// Values live at cell centers of the Block interior.  The Dirichlet
+/// condition X = 0 on Block faces is imposed through an antisymmetric
+/// ghost value, -u at the cell next to the face, which is consistent
+/// on all levels since each face stays at the same position.
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/gravity/gravity.hpp"
+
+/// Red-black Gauss-Seidel sweeps before and after coarse correction
+#define BLOCK_MG_SMOOTH 2
+
+/// Red-black Gauss-Seidel sweeps on the coarsest level
+#define BLOCK_MG_COARSE_SMOOTH 16
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// One level of the Block-local hierarchy
+  struct MgLevel {
+
+    /// interior cells along each axis (1 for unused axes)
+    int n[3];
+
+    /// 1/h^2 along each axis (0 for unused axes)
+    double d[3];
+
+    /// solution, right-hand side, and residual
+    std::vector<double> u, f, r;
+
+    int size() const { return n[0]*n[1]*n[2]; }
+
+    int index (int ix, int iy, int iz) const
+    { return ix + n[0]*(iy + n[1]*iz); }
+
+    /// Laplacian of u at (ix,iy,iz) excluding the u(ix,iy,iz) term,
+    /// and the coefficient of that term
+    void stencil (int ix, int iy, int iz, double & sum, double & diag) const
+    {
+      const int i3[3] = {ix, iy, iz};
+      const int di[3] = {1, n[0], n[0]*n[1]};
+      const int i = index(ix,iy,iz);
+      sum = 0.0;
+      diag = 0.0;
+      for (int axis=0; axis<3; axis++) {
+        if (n[axis] == 1 && d[axis] == 0.0) continue;
+        diag -= 2.0*d[axis];
+        if (i3[axis] > 0)         sum  += d[axis]*u[i-di[axis]];
+        else                      diag -= d[axis];
+        if (i3[axis] < n[axis]-1) sum  += d[axis]*u[i+di[axis]];
+        else                      diag -= d[axis];
+      }
+    }
+
+    void smooth (int sweeps)
+    {
+      for (int sweep=0; sweep<sweeps; sweep++) {
+        for (int color=0; color<2; color++) {
+          for (int iz=0; iz<n[2]; iz++) {
+            for (int iy=0; iy<n[1]; iy++) {
+              for (int ix=(iy+iz+color)%2; ix<n[0]; ix+=2) {
+                double sum, diag;
+                stencil(ix,iy,iz,sum,diag);
+                u[index(ix,iy,iz)] = (f[index(ix,iy,iz)] - sum) / diag;
+              }
+            }
+          }
+        }
+      }
+    }
+
+    void residual ()
+    {
+      for (int iz=0; iz<n[2]; iz++) {
+        for (int iy=0; iy<n[1]; iy++) {
+          for (int ix=0; ix<n[0]; ix++) {
+            double sum, diag;
+            stencil(ix,iy,iz,sum,diag);
+            const int i = index(ix,iy,iz);
+            r[i] = f[i] - (sum + diag*u[i]);
+          }
+        }
+      }
+    }
+  };
+
+  //--------------------------------------------------
+
+  /// f(coarse) = average of r(fine) over the children of each cell
+  void restrict_ (const MgLevel & fine, MgLevel & coarse)
+  {
+    const int rx = fine.n[0] / coarse.n[0];
+    const int ry = fine.n[1] / coarse.n[1];
+    const int rz = fine.n[2] / coarse.n[2];
+    const double w = 1.0 / (rx*ry*rz);
+    std::fill(coarse.f.begin(),coarse.f.end(),0.0);
+    for (int iz=0; iz<fine.n[2]; iz++) {
+      for (int iy=0; iy<fine.n[1]; iy++) {
+        for (int ix=0; ix<fine.n[0]; ix++) {
+          coarse.f[coarse.index(ix/rx,iy/ry,iz/rz)] +=
+            w*fine.r[fine.index(ix,iy,iz)];
+        }
+      }
+    }
+  }
+
+  //--------------------------------------------------
+
+  /// u(fine) += linear interpolation of u(coarse), with weights 3/4
+  /// and 1/4 along each coarsened axis
+  void prolong_add_ (const MgLevel & coarse, MgLevel & fine)
+  {
+    int r3[3];
+    for (int axis=0; axis<3; axis++) r3[axis] = fine.n[axis] / coarse.n[axis];
+
+    // coarse value, with antisymmetric ghost values outside the Block
+    auto value = [&coarse] (int i3[3], int ic3[3]) {
+      double sign = 1.0;
+      for (int axis=0; axis<3; axis++) {
+        if (ic3[axis] < 0 || ic3[axis] >= coarse.n[axis]) {
+          sign = -sign;
+          ic3[axis] = i3[axis];
+        }
+      }
+      return sign*coarse.u[coarse.index(ic3[0],ic3[1],ic3[2])];
+    };
+
+    for (int iz=0; iz<fine.n[2]; iz++) {
+      for (int iy=0; iy<fine.n[1]; iy++) {
+        for (int ix=0; ix<fine.n[0]; ix++) {
+          const int if3[3] = {ix, iy, iz};
+          int ic3[3], in3[3];
+          for (int axis=0; axis<3; axis++) {
+            ic3[axis] = if3[axis] / r3[axis];
+            in3[axis] = (r3[axis] == 1) ? ic3[axis] :
+              ic3[axis] + ((if3[axis] % 2) ? 1 : -1);
+          }
+          double sum = 0.0;
+          for (int k=0; k<8; k++) {
+            double w = 1.0;
+            int i3[3];
+            bool skip = false;
+            for (int axis=0; axis<3; axis++) {
+              const bool far = (k >> axis) & 1;
+              if (r3[axis] == 1) {
+                if (far) skip = true;
+                i3[axis] = ic3[axis];
+              } else {
+                w *= far ? 0.25 : 0.75;
+                i3[axis] = far ? in3[axis] : ic3[axis];
+              }
+            }
+            if (skip) continue;
+            sum += w * value(ic3,i3);
+          }
+          fine.u[fine.index(ix,iy,iz)] += sum;
+        }
+      }
+    }
+  }
+
+  //--------------------------------------------------
+
+  void vcycle_ (std::vector<MgLevel> & levels, size_t l)
+  {
+    MgLevel & level = levels[l];
+    if (l + 1 == levels.size()) {
+      level.smooth(BLOCK_MG_COARSE_SMOOTH);
+      return;
+    }
+    level.smooth(BLOCK_MG_SMOOTH);
+    level.residual();
+    MgLevel & coarse = levels[l+1];
+    restrict_(level,coarse);
+    std::fill(coarse.u.begin(),coarse.u.end(),0.0);
+    vcycle_(levels,l+1);
+    prolong_add_(coarse,level);
+    level.smooth(BLOCK_MG_SMOOTH);
+  }
+}
+
+//----------------------------------------------------------------------
+
+EnzoSolverBlockMg::EnzoSolverBlockMg
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int index_prolong,
+ int index_restrict,
+ int num_cycles,
+ int overlap) throw()
+  : Solver
+    (name,
+     field_x,
+     field_b,
+     monitor_iter,
+     restart_cycle,
+     solve_type,
+     index_prolong,
+     index_restrict),
+    num_cycles_(num_cycles),
+    overlap_(overlap),
+    ir_overlap_(-1)
+{
+  ASSERT2 ("EnzoSolverBlockMg::EnzoSolverBlockMg()",
+           "Solver %s: num_cycles = %d must be at least 1",
+           name.c_str(), num_cycles, (num_cycles >= 1));
+
+  ASSERT2 ("EnzoSolverBlockMg::EnzoSolverBlockMg()",
+           "Solver %s: overlap = %d must not be negative",
+           name.c_str(), overlap, (overlap >= 0));
+
+  if (overlap_ > 0) {
+    ir_overlap_ = add_refresh_();
+    Refresh * refresh = cello::refresh(ir_overlap_);
+    cello::simulation()->refresh_set_name(ir_overlap_,name+":overlap");
+    refresh->add_field (ib_);
+    refresh->set_min_face_rank(0);
+    refresh->set_ghost_layers(overlap_);
+    refresh->set_callback(CkIndex_EnzoBlock::p_solver_block_mg_continue());
+  }
+}
+
+//======================================================================
+
+void EnzoSolverBlockMg::apply (std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  if (overlap_ > 0) {
+
+    // refresh B in the overlap, then continue in compute_overlap()
+
+    Refresh * refresh = cello::refresh(ir_overlap_);
+    refresh->set_active(is_finest_(block));
+    block->refresh_start
+      (ir_overlap_, CkIndex_EnzoBlock::p_solver_block_mg_continue());
+
+  } else {
+
+    if (is_finest_(block)) {
+      compute_(block);
+    }
+
+    Solver::end_(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_block_mg_continue()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverBlockMg * solver =
+    static_cast<EnzoSolverBlockMg *> (this->solver());
+
+  solver->compute_overlap(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverBlockMg::compute_overlap (Block * block) throw()
+{
+  if (is_finest_(block)) {
+    compute_(block);
+  }
+
+  Solver::end_(block);
+}
+
+//======================================================================
+
+void EnzoSolverBlockMg::compute_ (Block * block) throw()
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.dimensions  (ib_,&mx,&my,&mz);
+  field.ghost_depth (ib_,&gx,&gy,&gz);
+  if (mx == 1) gx = 0;
+  if (my == 1) gy = 0;
+  if (mz == 1) gz = 0;
+
+  // local problem includes overlap ghost layers of B
+
+  const int ox = (mx == 1) ? 0 : overlap_;
+  const int oy = (my == 1) ? 0 : overlap_;
+  const int oz = (mz == 1) ? 0 : overlap_;
+
+  ASSERT4 ("EnzoSolverBlockMg::compute_()",
+           "Solver %s: overlap = %d exceeds ghost depth (%d %d)",
+           name_.c_str(), overlap_, gx, gy,
+           (ox <= gx && oy <= gy && oz <= gz));
+
+  const int rank = cello::rank();
+
+  double h3[3];
+  block->cell_width(h3,h3+1,h3+2);
+
+  // build the hierarchy, coarsening all axes together
+
+  std::vector<MgLevel> levels(1);
+  MgLevel & finest = levels[0];
+  finest.n[0] = mx - 2*(gx-ox);
+  finest.n[1] = my - 2*(gy-oy);
+  finest.n[2] = mz - 2*(gz-oz);
+  for (int axis=0; axis<3; axis++) {
+    finest.d[axis] = (axis < rank) ? 1.0/(h3[axis]*h3[axis]) : 0.0;
+  }
+
+  while (true) {
+    const MgLevel & fine = levels.back();
+    bool can_coarsen = true;
+    for (int axis=0; axis<rank; axis++) {
+      can_coarsen = can_coarsen && (fine.n[axis] % 2 == 0 && fine.n[axis] > 2);
+    }
+    if (! can_coarsen) break;
+    MgLevel coarse;
+    for (int axis=0; axis<3; axis++) {
+      coarse.n[axis] = (axis < rank) ? fine.n[axis]/2 : 1;
+      coarse.d[axis] = 0.25*fine.d[axis];
+    }
+    levels.push_back(coarse);
+  }
+
+  for (MgLevel & level : levels) {
+    level.u.assign(level.size(),0.0);
+    level.f.assign(level.size(),0.0);
+    level.r.assign(level.size(),0.0);
+  }
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+  enzo_float * B = (enzo_float*) field.values(ib_);
+
+  for (int iz=0; iz<finest.n[2]; iz++) {
+    for (int iy=0; iy<finest.n[1]; iy++) {
+      for (int ix=0; ix<finest.n[0]; ix++) {
+        const int i = (ix+gx-ox) + mx*((iy+gy-oy) + my*(iz+gz-oz));
+        finest.f[finest.index(ix,iy,iz)] = B[i];
+      }
+    }
+  }
+
+  for (int cycle=0; cycle<num_cycles_; cycle++) {
+    vcycle_(levels,0);
+  }
+
+  // keep only the Block interior (restricted Schwarz)
+
+  std::fill_n(X,mx*my*mz,0.0);
+  for (int iz=oz; iz<finest.n[2]-oz; iz++) {
+    for (int iy=oy; iy<finest.n[1]-oy; iy++) {
+      for (int ix=ox; ix<finest.n[0]-ox; ix++) {
+        const int i = (ix+gx-ox) + mx*((iy+gy-oy) + my*(iz+gz-oz));
+        X[i] = finest.u[finest.index(ix,iy,iz)];
+      }
+    }
+  }
+}
@@ -0,0 +1,97 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverBlockMg.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverBlockMg class
+
+#ifndef ENZO_ENZO_SOLVER_BLOCK_MG_HPP
+#define ENZO_ENZO_SOLVER_BLOCK_MG_HPP
+
+class EnzoSolverBlockMg : public Solver {
+
+  /// @class    EnzoSolverBlockMg
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Block-Jacobi multigrid preconditioner
+  ///
+  /// Approximately solves A X = B on each Block independently with
+  /// num_cycles geometric multigrid V-cycles over the Block interior,
+  /// treating the Block faces as homogeneous Dirichlet boundaries.
+  /// Levels are coarsened by factors of two while the interior size
+  /// along each axis is even and larger than 2.  The operator on
+  /// every level is the second-order Laplacian of EnzoMatrixLaplace,
+  /// smoothed by red-black Gauss-Seidel, with averaging restriction
+  /// and linear prolongation.  There is no communication,
+  /// so it is intended as the preconditioner of a Krylov solver.
+  ///
+  /// With overlap > 0 it is instead a restricted additive Schwarz
+  /// preconditioner: B is first refreshed in overlap ghost layers,
+  /// each Block solves on its interior extended by overlap cells, and
+  /// only the interior of the solution is kept.  This costs one
+  /// neighbor exchange per application and still no reductions.
+
+public: // interface
+
+  /// Constructor
+  EnzoSolverBlockMg(std::string name,
+                    std::string field_x,
+                    std::string field_b,
+                    int monitor_iter,
+                    int restart_cycle,
+                    int solve_type,
+                    int index_prolong,
+                    int index_restrict,
+                    int num_cycles = 1,
+                    int overlap = 0) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverBlockMg);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverBlockMg (CkMigrateMessage *m)
+    : Solver(m),
+      num_cycles_(0),
+      overlap_(0),
+      ir_overlap_(-1)
+  {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Solver::pup(p);
+    p | num_cycles_;
+    p | overlap_;
+    p | ir_overlap_;
+  };
+
+  //--------------------------------------------------
+
+public: // virtual functions
+
+  /// Solve the linear system Ax = b
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "block_mg"; }
+
+  /// Continue after refreshing the overlap
+  void compute_overlap (Block * block) throw();
+
+protected: // methods
+
+  void compute_ (Block * block) throw();
+
+protected: // attributes
+
+  /// Number of V-cycles per application
+  int num_cycles_;
+
+  /// Ghost layers of B included in each Block's local problem
+  int overlap_;
+
+  /// Refresh of B in the overlap ghost layers
+  int ir_overlap_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_BLOCK_MG_HPP */
@@ -53,7 +53,8 @@ EnzoSolverCg::EnzoSolverCg
  int index_restrict,
  int min_level, int max_level,
  int iter_max, double res_tol,
- int index_precon
+ int index_precon,
+ bool pipelined
  )
   : Solver(name,
 	   field_x,
@@ -80,7 +81,13 @@ EnzoSolverCg::EnzoSolverCg
     bc_(0.0),
     local_(solve_type==solve_block),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
+    ir_loop_2_(-1),
+    pipelined_(pipelined && solve_type!=solve_block),
+    iw_(-1), iq_(-1),
+    wr_(0.0), ws_(0.0),
+    ir_pipe_r_(-1),
+    ir_pipe_w_{-1,-1},
+    is_alpha_(-1), is_gamma_(-1), is_iter_(-1), is_sync_(-1)
 
 {
   FieldDescr * field_descr = cello::field_descr();
@@ -124,6 +131,44 @@ EnzoSolverCg::EnzoSolverCg
     refresh_loop_2->set_callback(CkIndex_EnzoBlock::p_solver_cg_loop_2());
 
   }
+
+  if (pipelined_) {
+
+    iw_ = field_descr->insert_temporary();
+    iq_ = field_descr->insert_temporary();
+
+    ScalarDescr * scalar_descr_quad = cello::scalar_descr_long_double();
+    is_alpha_ = scalar_descr_quad->new_value(name + ":alpha");
+    is_gamma_ = scalar_descr_quad->new_value(name + ":gamma");
+    is_iter_  = cello::scalar_descr_int()->new_value(name + ":iter");
+    is_sync_  = cello::scalar_descr_sync()->new_value(name + ":sync");
+
+  //--------------------------------------------------
+
+    ir_pipe_r_ = add_refresh_();
+    cello::simulation()->refresh_set_name(ir_pipe_r_,name+":pipe_r");
+
+    Refresh * refresh_r = cello::refresh(ir_pipe_r_);
+
+    refresh_r->add_field (ir_);
+
+    refresh_r->set_callback(CkIndex_EnzoBlock::p_solver_cg_pipe_w());
+
+  //--------------------------------------------------
+
+    for (int k=0; k<2; k++) {
+
+      ir_pipe_w_[k] = add_refresh_();
+      cello::simulation()->refresh_set_name
+        (ir_pipe_w_[k],name+":pipe_w"+std::to_string(k));
+
+      Refresh * refresh_w = cello::refresh(ir_pipe_w_[k]);
+
+      refresh_w->add_field (iw_);
+
+      refresh_w->set_callback(CkIndex_EnzoBlock::p_solver_cg_pipe_q());
+    }
+  }
 }
 
 //----------------------------------------------------------------------
@@ -173,6 +218,19 @@ void EnzoSolverCg::pup (PUP::er &p)
   p | ir_matvec_;
   p | ir_loop_2_;
 
+  p | pipelined_;
+  p | iw_;
+  p | iq_;
+  p | wr_;
+  p | ws_;
+  p | ir_pipe_r_;
+  p | ir_pipe_w_[0];
+  p | ir_pipe_w_[1];
+  p | is_alpha_;
+  p | is_gamma_;
+  p | is_iter_;
+  p | is_sync_;
+
 }
 
 //======================================================================
@@ -296,6 +354,11 @@ void EnzoSolverCg::loop_0a
 
   delete msg;
 
+  if (pipelined_) {
+    pipe_begin_(enzo_block);
+    return;
+  }
+
 // Refresh field faces then call p_solver_cg_matvec
 
   Refresh * refresh = cello::refresh(ir_matvec_);
@@ -480,8 +543,8 @@ void EnzoSolverCg::loop_2b (EnzoBlock * enzo_block) throw()
 
   if (enzo_block->index().is_root()) monitor_output_(enzo_block);
 
-  const bool is_converged = (rr_ / rr0_ < res_tol_);
-  const bool is_diverged = (iter_ >= iter_max_);
+  const bool is_converged = (rr_ / rr0_ < adaptive_res_tol_(enzo_block,res_tol_));
+  const bool is_diverged = (iter_ >= adaptive_iter_max_(enzo_block,iter_max_));
 
   if (is_converged) {
 
@@ -723,6 +786,297 @@ void EnzoSolverCg::loop_6 (EnzoBlock * enzo_block) throw ()
 
 //----------------------------------------------------------------------
 
+//======================================================================
+// Pipelined CG
+//
+// Ghysels and Vanroose's pipelined CG: the dot products (R,R) and
+// (W,R) are fused into one reduction per iteration, which proceeds
+// while W is refreshed and Q = A*W is computed.  The iteration count
+// is advanced locally, so no separate max reduction is needed.
+//
+//     W = A*R
+//     loop:
+//        gamma = (R,R), delta = (W,R)    [reduction]
+//        Q = A*W                          [refresh W, overlapped]
+//        b = gamma / gamma_old
+//        a = gamma / (delta - b*gamma/a_old)
+//        Z = Q + b*Z
+//        Y = W + b*Y
+//        D = R + b*D
+//        X = X + a*D
+//        R = R - a*Y
+//        W = W - a*Z
+//======================================================================
+
+void EnzoSolverCg::pipe_begin_ (EnzoBlock * enzo_block) throw()
+{
+  Field field = enzo_block->data()->field();
+
+  if (is_finest_(enzo_block)) {
+
+    enzo_float * B = (enzo_float*) field.values(ib_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * D = (enzo_float*) field.values(id_);
+    enzo_float * Y = (enzo_float*) field.values(iy_);
+    enzo_float * Z = (enzo_float*) field.values(iz_);
+
+    // shift rhs B by projection of B onto e, as in shift_1()
+    const long double shift = A_->is_singular() ? -bs_ / bc_ : 0.0;
+
+    for (int i=0; i<mx_*my_*mz_; i++) {
+      B[i] += shift;
+      R[i] = B[i];
+      D[i] = 0.0;
+      Y[i] = 0.0;
+      Z[i] = 0.0;
+    }
+  }
+
+  s_iter_(enzo_block) = 0;
+  s_alpha_(enzo_block) = 0.0;
+  s_gamma_(enzo_block) = 0.0;
+
+  Refresh * refresh = cello::refresh(ir_pipe_r_);
+
+  refresh->set_active(is_finest_(enzo_block));
+
+  enzo_block->refresh_start
+    (ir_pipe_r_, CkIndex_EnzoBlock::p_solver_cg_pipe_w());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_cg_pipe_w()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->pipe_w(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_w (EnzoBlock * enzo_block) throw()
+{
+  if (is_finest_(enzo_block)) {
+
+    A_->matvec(iw_,ir_,enzo_block);
+
+  }
+
+  pipe_loop_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_loop_ (EnzoBlock * enzo_block) throw()
+{
+  // join the reduction and the matvec before updating vectors
+  s_sync_(enzo_block) = Sync(2);
+
+  long double reduce[6] = {5.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+
+  if (is_finest_(enzo_block)) {
+
+    Field field = enzo_block->data()->field();
+
+    enzo_float * X = (enzo_float*) field.values(ix_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * W = (enzo_float*) field.values(iw_);
+
+    for (int iz=gz_; iz<mz_-gz_; iz++) {
+      for (int iy=gy_; iy<my_-gy_; iy++) {
+	for (int ix=gx_; ix<mx_-gx_; ix++) {
+	  int i = ix + mx_*(iy + my_*iz);
+	  reduce[1] += R[i]*R[i];
+	  reduce[2] += W[i]*R[i];
+	  reduce[3] += R[i];
+	  reduce[4] += X[i];
+	  reduce[5] += W[i];
+	}
+      }
+    }
+  }
+
+  CkCallback callback(CkIndex_EnzoBlock::r_solver_cg_pipe_dot(NULL),
+		      enzo_block->proxy_array());
+
+  enzo_block->contribute (6*sizeof(long double), &reduce,
+			  sum_long_double_n_type,
+			  callback);
+
+  // refresh W while the reduction is in progress
+
+  const int ir_pipe_w = ir_pipe_w_[s_iter_(enzo_block) % 2];
+
+  Refresh * refresh = cello::refresh(ir_pipe_w);
+
+  refresh->set_active(is_finest_(enzo_block));
+
+  enzo_block->refresh_start
+    (ir_pipe_w, CkIndex_EnzoBlock::p_solver_cg_pipe_q());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_cg_pipe_q()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->pipe_q(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_q (EnzoBlock * enzo_block) throw()
+{
+  if (is_finest_(enzo_block)) {
+
+    A_->matvec(iq_,iw_,enzo_block);
+
+  }
+
+  if (s_sync_(enzo_block).next()) pipe_update_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_solver_cg_pipe_dot (CkReductionMsg * msg)
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverCg * solver =
+    static_cast<EnzoSolverCg*> (this->solver());
+
+  solver->pipe_dot(this,msg);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_dot
+(EnzoBlock * enzo_block, CkReductionMsg * msg) throw()
+{
+  long double * data = (long double *) msg->getData();
+
+  rr_ = data[1];
+  wr_ = data[2];
+  rs_ = data[3];
+  xs_ = data[4];
+  ws_ = data[5];
+
+  delete msg;
+
+  if (A_->is_singular()) {
+    // account for the shift R <== R - rs/bc applied in pipe_update_()
+    rr_ -= rs_*rs_ / bc_;
+    wr_ -= rs_*ws_ / bc_;
+  }
+
+  if (s_sync_(enzo_block).next()) pipe_update_(enzo_block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverCg::pipe_update_ (EnzoBlock * enzo_block) throw()
+{
+  const int iter = s_iter_(enzo_block);
+
+  iter_ = iter;
+
+  if (iter == 0) {
+    rr0_ = rr_;
+    rr_min_ = rr_;
+    rr_max_ = rr_;
+  } else {
+    rr_min_ = std::min(rr_min_,rr_);
+    rr_max_ = std::max(rr_max_,rr_);
+  }
+
+  if (enzo_block->index().is_root()) monitor_output_(enzo_block);
+
+  const bool is_converged = (rr_ / rr0_ < adaptive_res_tol_(enzo_block,res_tol_));
+  const bool is_diverged = (iter >= adaptive_iter_max_(enzo_block,iter_max_));
+
+  if (is_converged) {
+
+    end (enzo_block,return_converged);
+
+  } else if (is_diverged)  {
+
+    end (enzo_block,return_error);
+
+  } else {
+
+    if (is_finest_(enzo_block)) {
+
+      cello::check(rr_,"CG::rr_",__FILE__,__LINE__);
+      cello::check(wr_,"CG::wr_",__FILE__,__LINE__);
+
+      Field field = enzo_block->data()->field();
+
+      enzo_float * X = (enzo_float*) field.values(ix_);
+      enzo_float * R = (enzo_float*) field.values(ir_);
+      enzo_float * W = (enzo_float*) field.values(iw_);
+      enzo_float * Q = (enzo_float*) field.values(iq_);
+      enzo_float * D = (enzo_float*) field.values(id_);
+      enzo_float * Y = (enzo_float*) field.values(iy_);
+      enzo_float * Z = (enzo_float*) field.values(iz_);
+
+      const long double gamma = rr_;
+      long double a, b;
+      if (iter == 0) {
+        b = 0.0;
+        a = gamma / wr_;
+      } else {
+        b = gamma / s_gamma_(enzo_block);
+        a = gamma / (wr_ - b*gamma/s_alpha_(enzo_block));
+      }
+
+      cello::check(a,"CG::a",__FILE__,__LINE__);
+      cello::check(b,"CG::b",__FILE__,__LINE__);
+
+      s_gamma_(enzo_block) = gamma;
+      s_alpha_(enzo_block) = a;
+
+      // remove the null-space component before updating, consistent
+      // with the shifted dot products in pipe_dot()
+      const enzo_float xshift = A_->is_singular() ? xs_/bc_ : 0.0;
+      const enzo_float rshift = A_->is_singular() ? rs_/bc_ : 0.0;
+
+      const enzo_float af = a;
+      const enzo_float bf = b;
+
+      for (int i=0; i<mx_*my_*mz_; i++) {
+	X[i] -= xshift;
+	R[i] -= rshift;
+	Z[i] = Q[i] + bf * Z[i];
+	Y[i] = W[i] + bf * Y[i];
+	D[i] = R[i] + bf * D[i];
+	X[i] += af * D[i];
+	R[i] -= af * Y[i];
+	W[i] -= af * Z[i];
+      }
+    }
+
+    ++s_iter_(enzo_block);
+
+    pipe_loop_(enzo_block);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 {
   Field field = enzo_block->data()->field();
@@ -795,8 +1149,8 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
   rr0_ = rr_;
 
-  bool is_converged = (rr_ / rr0_ < res_tol_);
-  bool is_diverged = iter_ >= iter_max_;
+  bool is_converged = (rr_ / rr0_ < adaptive_res_tol_(enzo_block,res_tol_));
+  bool is_diverged = iter_ >= adaptive_iter_max_(enzo_block,iter_max_);
 
   while ( (! is_converged) && (! is_diverged) ) {
 
@@ -873,8 +1227,8 @@ void EnzoSolverCg::local_cg_(EnzoBlock * enzo_block)
 
     monitor_output_(enzo_block);
 
-    is_converged = (rr_ / rr0_ < res_tol_);
-    is_diverged = iter_ >= iter_max_;
+    is_converged = (rr_ / rr0_ < adaptive_res_tol_(enzo_block,res_tol_));
+    is_diverged = iter_ >= adaptive_iter_max_(enzo_block,iter_max_);
   }
 
   if (is_converged) {
@@ -1027,9 +1381,9 @@ void EnzoSolverCg::monitor_output_(EnzoBlock * enzo_block)
 {
   //  const bool l_is_root = enzo_block->index().is_root();
   const bool l_first_iter = (iter_ == 0);
-  const bool l_max_iter   = (iter_ >= iter_max_);
+  const bool l_max_iter   = (iter_ >= adaptive_iter_max_(enzo_block,iter_max_));
   const bool l_monitor    = (monitor_iter_ && (iter_ % monitor_iter_) == 0 );
-  const bool l_converged  = (rr_ / rr0_ < res_tol_);
+  const bool l_converged  = (rr_ / rr0_ < adaptive_res_tol_(enzo_block,res_tol_));
 
   const bool l_output = l_first_iter || l_max_iter || l_monitor || l_converged;
 
@@ -28,7 +28,8 @@ public: // interface
 		int max_level,
 		int iter_max,
 		double res_tol,
-		int index_precon);
+		int index_precon,
+		bool pipelined = false);
 
   /// Constructor
   EnzoSolverCg() throw()
@@ -48,7 +49,13 @@ public: // interface
     bc_(0.0),
     local_(false),
     ir_matvec_(-1),
-    ir_loop_2_(-1)
+    ir_loop_2_(-1),
+    pipelined_(false),
+    iw_(-1), iq_(-1),
+    wr_(0.0), ws_(0.0),
+    ir_pipe_r_(-1),
+    ir_pipe_w_{-1,-1},
+    is_alpha_(-1), is_gamma_(-1), is_iter_(-1), is_sync_(-1)
   {};
 
   /// Charm++ PUP::able declarations
@@ -72,7 +79,13 @@ public: // interface
       bc_(0.0),
       local_(false),
       ir_matvec_(-1),
-      ir_loop_2_(-1)
+      ir_loop_2_(-1),
+      pipelined_(false),
+      iw_(-1), iq_(-1),
+      wr_(0.0), ws_(0.0),
+      ir_pipe_r_(-1),
+      ir_pipe_w_{-1,-1},
+      is_alpha_(-1), is_gamma_(-1), is_iter_(-1), is_sync_(-1)
 
   {}
 
@@ -119,6 +132,15 @@ public: // virtual functions
 
   void end (EnzoBlock * enzo_block, int retval) throw();
 
+  /// Pipelined CG: compute W = A*R after refreshing R
+  void pipe_w(EnzoBlock * enzo_block) throw();
+
+  /// Pipelined CG: compute Q = A*W after refreshing W
+  void pipe_q(EnzoBlock * enzo_block) throw();
+
+  /// Pipelined CG: continuation after the fused global reduction
+  void pipe_dot(EnzoBlock * enzo_block, CkReductionMsg *) throw();
+
   /// Set rz_ by EnzoBlock after reduction
   void set_rz(double rz) throw()    {  rz_ = rz; }
 
@@ -150,13 +172,29 @@ protected: // methods
 
   void begin_1_() throw();
 
+  /// Pipelined CG: shift B and start the refresh of R for W = A*R
+  void pipe_begin_(EnzoBlock * enzo_block) throw();
+
+  /// Pipelined CG: start the fused reduction and, overlapping it,
+  /// the refresh of W for Q = A*W
+  void pipe_loop_(EnzoBlock * enzo_block) throw();
+
+  /// Pipelined CG: vector updates once both the reduction and Q = A*W
+  /// are complete
+  void pipe_update_(EnzoBlock * enzo_block) throw();
+
   /// Allocate temporary Fields
   void allocate_temporary_(Field field, Block * block = NULL)
   {
+    MemoryGroup memory_group (memory_group_solver);
     field.allocate_temporary(id_);
     field.allocate_temporary(ir_);
     field.allocate_temporary(iy_);
     field.allocate_temporary(iz_);
+    if (pipelined_) {
+      field.allocate_temporary(iw_);
+      field.allocate_temporary(iq_);
+    }
   }
 
   /// Dellocate temporary Fields
@@ -166,8 +204,22 @@ protected: // methods
     field.deallocate_temporary(ir_);
     field.deallocate_temporary(iy_);
     field.deallocate_temporary(iz_);
+    if (pipelined_) {
+      field.deallocate_temporary(iw_);
+      field.deallocate_temporary(iq_);
+    }
   }
 
+  /// Block-local scalars used by the pipelined CG recurrences
+  long double & s_alpha_(Block * block)
+  { return *block->data()->scalar_long_double().value(is_alpha_); }
+  long double & s_gamma_(Block * block)
+  { return *block->data()->scalar_long_double().value(is_gamma_); }
+  int & s_iter_(Block * block)
+  { return *block->data()->scalar_int().value(is_iter_); }
+  Sync & s_sync_(Block * block)
+  { return *block->data()->scalar_sync().value(is_sync_); }
+
   /// Serial CG solver if local_ == true
   void local_cg_ (EnzoBlock * enzo_block);
 
@@ -246,6 +298,36 @@ protected: // attributes
   int ir_matvec_;
   int ir_loop_2_;
 
+  /// Whether to use the pipelined (Ghysels-Vanroose) CG variant, with
+  /// one fused reduction per iteration overlapped with the matvec
+  bool pipelined_;
+
+  /// Pipelined CG vector id's: W = A*R, Q = A*W; D, Y = A*D, and
+  /// Z = A*Y are updated by recurrences
+  int iw_;
+  int iq_;
+
+  /// dot (W,R)
+  double wr_;
+
+  /// sum of elements W(i) for singular systems
+  double ws_;
+
+  /// Pipelined CG refresh of R for the initial W = A*R
+  int ir_pipe_r_;
+
+  /// Pipelined CG refreshes of W, alternating between iterations so
+  /// that a neighbor's next-iteration faces cannot be mistaken for the
+  /// current ones
+  int ir_pipe_w_[2];
+
+  /// Block scalar indices for pipelined CG: previous alpha and
+  /// gamma = dot (R,R), iteration, and reduction / matvec join
+  int is_alpha_;
+  int is_gamma_;
+  int is_iter_;
+  int is_sync_;
+
 };
 
 #endif /* ENZO_ENZO_SOLVER_CG_HPP */
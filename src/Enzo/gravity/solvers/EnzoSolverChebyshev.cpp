@@ -0,0 +1,302 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverChebyshev.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implements the EnzoSolverChebyshev class
+///
+/// Chebyshev iteration (Saad, Iterative Methods for Sparse Linear
+/// Systems, Algorithm 12.1) for M = D^-1 A on [alpha,beta]:
+///
+///    theta = (beta + alpha)/2, delta = (beta - alpha)/2, sigma = theta/delta
+///
+///    R = D^-1 (B - A*X)
+///    k == 0:  P = R / theta,                  rho = 1 / sigma
+///    k  > 0:  rho' = 1 / (2 sigma - rho)
+///             P = rho' rho P + 2 rho' / delta R,  rho = rho'
+///    X = X + P
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/gravity/gravity.hpp"
+
+/// Number of power iterations to estimate lambda_max
+#define CHEBYSHEV_POWER_ITER 10
+
+/// Safety factor applied to the estimated lambda_max
+#define CHEBYSHEV_LAMBDA_SAFETY 1.1
+
+//----------------------------------------------------------------------
+
+EnzoSolverChebyshev::EnzoSolverChebyshev
+( std::string name,
+  std::string field_x,
+  std::string field_b,
+  int monitor_iter,
+  int restart_cycle,
+  int solve_type,
+  int index_prolong,
+  int index_restrict,
+  int iter_max,
+  double ratio) throw()
+  : Solver(name,
+	   field_x,
+	   field_b,
+	   monitor_iter,
+	   restart_cycle,
+	   solve_type,
+           index_prolong,
+           index_restrict),
+    A_ (NULL),
+    ir_ (-1),
+    id_ (-1),
+    ip_ (-1),
+    n_(iter_max),
+    ratio_(ratio),
+    i_iter_(-1),
+    is_rho_(-1),
+    is_lambda_(-1),
+    ir_smooth_(-1)
+{
+  ASSERT1 ("EnzoSolverChebyshev::EnzoSolverChebyshev()",
+           "Solver %s: eigenvalue ratio must be greater than 1",
+           name.c_str(), (ratio > 1.0));
+
+  // Reserve temporary fields
+
+  FieldDescr * field_descr = cello::field_descr();
+  id_ = field_descr->insert_temporary();
+  ir_ = field_descr->insert_temporary();
+  ip_ = field_descr->insert_temporary();
+
+  Refresh * refresh = cello::refresh(ir_post_);
+  cello::simulation()->refresh_set_name(ir_post_,name);
+
+  refresh->add_field (ix_);
+  refresh->set_min_face_rank(cello::rank() - 1);
+
+  i_iter_ = cello::scalar_descr_int()->new_value(name_ + ":iter");
+
+  ScalarDescr * scalar_descr_quad = cello::scalar_descr_long_double();
+  is_rho_    = scalar_descr_quad->new_value(name_ + ":rho");
+  is_lambda_ = scalar_descr_quad->new_value(name_ + ":lambda");
+
+  ir_smooth_ = add_refresh_();
+
+  Refresh * refresh_smooth = cello::refresh(ir_smooth_);
+  cello::simulation()->refresh_set_name(ir_smooth_,name+":smooth");
+
+  refresh_smooth->add_field (ix_);
+  refresh_smooth->set_min_face_rank(cello::rank() - 1);
+  refresh_smooth->set_callback(CkIndex_EnzoBlock::p_solver_chebyshev_continue());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::apply
+( std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  begin_(block);
+
+  A_ = A;
+
+  Field field = block->data()->field();
+
+  allocate_temporary_(field,block);
+
+  s_iter_(block) = 0;
+
+  // Refresh X
+
+  do_refresh_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_solver_chebyshev_continue()
+{
+  performance_start_(perf_compute,__FILE__,__LINE__);
+
+  EnzoSolverChebyshev * solver =
+    static_cast<EnzoSolverChebyshev *> (this->solver());
+
+  solver->compute(this);
+
+  performance_stop_(perf_compute,__FILE__,__LINE__);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::compute(Block * block)
+{
+  if (s_iter_(block) < n_) {
+
+    apply_(block);
+
+  } else {
+
+    Field field = block->data()->field();
+    deallocate_temporary_ (field,block);
+
+    Solver::end_(block);
+
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::apply_(Block * block)
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions(ix_,&mx,&my,&mz);
+
+  const int ng = A_->ghost_depth();
+  const int gx = (mx > 1) ? ng : 0;
+  const int gy = (my > 1) ? ng : 0;
+  const int gz = (mz > 1) ? ng : 0;
+
+  const int iter = s_iter_(block);
+
+  if (is_finest_(block)) {
+
+    A_->diagonal (id_, block,ng);
+
+    if (iter == 0 && s_lambda_(block) == 0.0) {
+      s_lambda_(block) = estimate_lambda_max_(block);
+    }
+
+    const double beta  = CHEBYSHEV_LAMBDA_SAFETY * s_lambda_(block);
+    const double alpha = beta / ratio_;
+    const double theta = 0.5*(beta + alpha);
+    const double delta = 0.5*(beta - alpha);
+    const double sigma = theta / delta;
+
+    A_->residual (ir_, ib_, ix_, block,ng);
+
+    enzo_float * X = (enzo_float*) field.values(ix_);
+    enzo_float * R = (enzo_float*) field.values(ir_);
+    enzo_float * D = (enzo_float*) field.values(id_);
+    enzo_float * P = (enzo_float*) field.values(ip_);
+
+    enzo_float cp, cr;
+    if (iter == 0) {
+      cp = 0.0;
+      cr = 1.0 / theta;
+      s_rho_(block) = 1.0 / sigma;
+    } else {
+      const long double rho = s_rho_(block);
+      const long double rho_new = 1.0 / (2.0*sigma - rho);
+      cp = rho_new * rho;
+      cr = 2.0 * rho_new / delta;
+      s_rho_(block) = rho_new;
+    }
+
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+	for (int ix=gx; ix<mx-gx; ix++) {
+	  int i = ix + mx*(iy + my*iz);
+	  P[i] = ((iter == 0) ? 0.0 : cp*P[i]) + cr*(R[i] / D[i]);
+	  X[i] += P[i];
+	}
+      }
+    }
+  }
+
+  // Next iteration
+
+  ++s_iter_(block);
+
+  // Refresh X
+
+  do_refresh_(block);
+}
+
+//----------------------------------------------------------------------
+
+double EnzoSolverChebyshev::estimate_lambda_max_(Block * block)
+/// Power iteration V <-- D^-1 A V on the Block interior, with zero
+/// ghost zones.  Requires the diagonal in id_; overwrites ir_ and ip_
+{
+  Field field = block->data()->field();
+
+  int mx,my,mz;
+  field.dimensions(ix_,&mx,&my,&mz);
+  int gx,gy,gz;
+  field.ghost_depth(ix_,&gx,&gy,&gz);
+  if (mx == 1) gx = 0;
+  if (my == 1) gy = 0;
+  if (mz == 1) gz = 0;
+
+  enzo_float * V = (enzo_float*) field.values(ip_);
+  enzo_float * W = (enzo_float*) field.values(ir_);
+  enzo_float * D = (enzo_float*) field.values(id_);
+
+  // deterministic pseudo-random starting vector
+
+  std::fill_n (V,mx*my*mz,0.0);
+  unsigned int seed = 12345;
+  for (int iz=gz; iz<mz-gz; iz++) {
+    for (int iy=gy; iy<my-gy; iy++) {
+      for (int ix=gx; ix<mx-gx; ix++) {
+	int i = ix + mx*(iy + my*iz);
+	seed = 1664525u*seed + 1013904223u;
+	V[i] = 0.5 + (seed >> 8) / double(1 << 24);
+      }
+    }
+  }
+
+  const int ng = A_->ghost_depth();
+
+  long double lambda = 0.0;
+  for (int k=0; k<CHEBYSHEV_POWER_ITER; k++) {
+
+    A_->matvec (ir_, ip_, block, ng);
+
+    long double vv = 0.0, vw = 0.0, ww = 0.0;
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+	for (int ix=gx; ix<mx-gx; ix++) {
+	  int i = ix + mx*(iy + my*iz);
+	  W[i] /= D[i];
+	  vv += V[i]*V[i];
+	  vw += V[i]*W[i];
+	  ww += W[i]*W[i];
+	}
+      }
+    }
+
+    // Rayleigh quotient
+    lambda = std::abs(vw / vv);
+
+    const long double scale = 1.0 / sqrtl(ww);
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+	for (int ix=gx; ix<mx-gx; ix++) {
+	  int i = ix + mx*(iy + my*iz);
+	  V[i] = W[i] * scale;
+	}
+      }
+    }
+  }
+
+  ASSERT2 ("EnzoSolverChebyshev::estimate_lambda_max_()",
+           "Solver %s: invalid eigenvalue estimate %Lg",
+           name_.c_str(), lambda,
+           (lambda > 0.0 && std::isfinite(lambda)));
+
+  return lambda;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverChebyshev::do_refresh_(Block * block)
+{
+  Refresh * refresh = cello::refresh(ir_smooth_);
+
+  refresh->set_active(is_finest_(block));
+
+  block->refresh_start
+    (ir_smooth_, CkIndex_EnzoBlock::p_solver_chebyshev_continue());
+}
@@ -0,0 +1,185 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverChebyshev.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverChebyshev class
+
+#ifndef ENZO_ENZO_SOLVER_CHEBYSHEV_HPP
+#define ENZO_ENZO_SOLVER_CHEBYSHEV_HPP
+
+class EnzoSolverChebyshev : public Solver {
+
+  /// @class    EnzoSolverChebyshev
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Chebyshev polynomial smoother
+  ///
+  /// Applies iter_max steps of Chebyshev iteration to the Jacobi
+  /// preconditioned system D^-1 A X = D^-1 B, targeting the upper part
+  /// [lambda_max/ratio, lambda_max] of the spectrum of D^-1 A.  The
+  /// largest eigenvalue is estimated once per Block by a few
+  /// Block-local power iterations (zero ghost zones, no communication)
+  /// and kept in a Block scalar.  Each step needs one matvec and one
+  /// refresh, and no global reductions.
+
+public: // interface
+
+  /// Constructor
+  EnzoSolverChebyshev(std::string name,
+                      std::string field_x,
+                      std::string field_b,
+                      int monitor_iter,
+                      int restart_cycle,
+                      int solve_type,
+                      int index_prolong,
+                      int index_restrict,
+                      int iter_max = 2,
+                      double ratio = 30.0) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverChebyshev);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverChebyshev (CkMigrateMessage *m)
+    : Solver(m),
+      A_(NULL),
+      ir_(-1),
+      id_(-1),
+      ip_(-1),
+      n_(0),
+      ratio_(0.0),
+      i_iter_(-1),
+      is_rho_(-1),
+      is_lambda_(-1),
+      ir_smooth_(-1)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Solver::pup(p);
+
+    //    p | A_;
+    p | ir_;
+    p | id_;
+    p | ip_;
+    p | n_;
+    p | ratio_;
+    p | i_iter_;
+    p | is_rho_;
+    p | is_lambda_;
+    p | ir_smooth_;
+  }
+
+public: // virtual methods
+
+  /// Solve the linear system Ax = b
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "chebyshev"; }
+
+protected: // virtual methods
+
+  /// Whether Block is active
+  virtual bool is_active_(Block * block) const
+  {
+    if (solve_type_ == solve_level) {
+      return true;
+    } else {
+      return Solver::is_active_(block);
+    }
+  }
+
+  /// Whether solution is defined on this Block
+  virtual bool is_finest_(Block * block) const
+  {
+    if (solve_type_ == solve_level) {
+      return true;
+    } else {
+      return Solver::is_finest_(block);
+    }
+  }
+
+public: // methods
+
+  /// Continue after refresh to perform the next Chebyshev step
+  void compute (Block * block);
+
+protected: // methods
+
+  /// Perform one Chebyshev step X <-- X + P
+  void apply_(Block * block);
+
+  /// Estimate the largest eigenvalue of D^-1 A on the Block
+  double estimate_lambda_max_(Block * block);
+
+  /// Refresh X
+  void do_refresh_(Block * block);
+
+  /// Allocate temporary Fields
+  void allocate_temporary_(Field field, Block * block = NULL)
+  {
+    MemoryGroup memory_group (memory_group_solver);
+    field.allocate_temporary(id_);
+    field.allocate_temporary(ir_);
+    field.allocate_temporary(ip_);
+  }
+
+  /// Dellocate temporary Fields
+  void deallocate_temporary_(Field field, Block * block = NULL)
+  {
+    field.deallocate_temporary(id_);
+    field.deallocate_temporary(ir_);
+    field.deallocate_temporary(ip_);
+  }
+
+  /// Return the iteration counter on the block
+  int & s_iter_(Block * block)
+  { return *block->data()->scalar_int().value(i_iter_); }
+
+  /// Return the Chebyshev recurrence coefficient rho on the block
+  long double & s_rho_(Block * block)
+  { return *block->data()->scalar_long_double().value(is_rho_); }
+
+  /// Return the cached eigenvalue estimate on the block (0 if unset)
+  long double & s_lambda_(Block * block)
+  { return *block->data()->scalar_long_double().value(is_lambda_); }
+
+protected: // attributes
+
+  // NOTE: change pup() function whenever attributes change
+
+  /// Matrix A for smoothing A*X = B
+  std::shared_ptr<Matrix> A_;
+
+  /// Field index for preconditioned residual D^-1 (B - A*X)
+  int ir_;
+
+  /// Field index for matrix diagonal D
+  int id_;
+
+  /// Field index for update direction P
+  int ip_;
+
+  /// Number of Chebyshev steps (polynomial degree)
+  int n_;
+
+  /// Ratio lambda_max / lambda_min of the targeted interval
+  double ratio_;
+
+  /// Scalar index for current iteration on a Block
+  int i_iter_;
+
+  /// Scalar index for the recurrence coefficient rho
+  int is_rho_;
+
+  /// Scalar index for the eigenvalue estimate
+  int is_lambda_;
+
+  // Refresh after each step
+  int ir_smooth_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_CHEBYSHEV_HPP */
@@ -459,17 +459,11 @@ FieldMsg * EnzoSolverDd::pack_field_(EnzoBlock * enzo_block,
   }
 
   Field field = enzo_block->data()->field();
-  int narray;
-  char * array;
-  field_face->face_to_array(field,&narray,&array);
 
-  delete field_face;
-
-  FieldMsg * msg  = new (narray) FieldMsg;
+  FieldMsg * msg = FieldMsg::create(field_face->num_bytes_array(field));
+  field_face->face_to_array(field,msg->a);
 
-  msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
+  delete field_face;
 
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
@@ -514,6 +508,6 @@ void EnzoSolverDd::unpack_field_
   field_face->array_to_face(a, field);
   delete field_face;
 
-  delete msg;
+  FieldMsg::release(msg);
 }
 
@@ -139,6 +139,7 @@ public: // methods
   /// Allocate temporary Fields
   void allocate_temporary_(Block * block)
   {
+    MemoryGroup memory_group (memory_group_solver);
     Field field = block->data()->field();
     field.allocate_temporary(ixc_);
   }
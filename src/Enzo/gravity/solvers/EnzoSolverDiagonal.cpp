@@ -77,7 +77,10 @@ void EnzoSolverDiagonal::compute_
 
   if (is_finest_(block)) {
 
-    field.allocate_temporary(id_);
+    {
+      MemoryGroup memory_group (memory_group_solver);
+      field.allocate_temporary(id_);
+    }
 
     ///   - X = 0
     ///   - R = P = B ( residual with X = 0);
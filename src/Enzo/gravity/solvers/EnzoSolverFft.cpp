@@ -0,0 +1,319 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Direct FFT solver for periodic or isolated problems on a
+///           single Block
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/gravity/gravity.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoSolverFft::EnzoSolverFft
+(std::string name,
+ std::string field_x,
+ std::string field_b,
+ int monitor_iter,
+ int restart_cycle,
+ int solve_type,
+ int index_prolong,
+ int index_restrict,
+ int min_level,
+ int max_level,
+ bool isolated) throw()
+  : Solver
+    (name,
+     field_x,
+     field_b,
+     monitor_iter,
+     restart_cycle,
+     solve_type,
+     index_prolong,
+     index_restrict,
+     min_level,
+     max_level),
+    ie_(-1),
+    iy_(-1),
+    isolated_(isolated),
+    green_(),
+    green_key_()
+{
+  ASSERT1 ("EnzoSolverFft::EnzoSolverFft()",
+           "Solver %s: FFT solver requires solve_type \"block\"",
+           name.c_str(),
+           (solve_type == solve_block));
+
+  FieldDescr * field_descr = cello::field_descr();
+  ie_ = field_descr->insert_temporary();
+  iy_ = field_descr->insert_temporary();
+}
+
+//======================================================================
+
+void EnzoSolverFft::apply (std::shared_ptr<Matrix> A, Block * block) throw()
+{
+  Solver::begin_(block);
+
+  if (is_finest_(block)) {
+    if (isolated_) {
+      compute_isolated_(block);
+    } else {
+      compute_(A,block);
+    }
+  }
+
+  Solver::end_(block);
+}
+
+//======================================================================
+
+void EnzoSolverFft::compute_
+( std::shared_ptr<Matrix> A, Block * block) throw()
+//     E = unit impulse at (cx,cy,cz)
+//     S = FFT(A*E) shifted to the origin   (eigenvalues of A)
+//     X = IFFT (FFT(B) / S)
+{
+  Field field = block->data()->field();
+
+  int nx,ny,nz;
+  int mx,my,mz;
+  int gx,gy,gz;
+  field.size           (&nx,&ny,&nz);
+  field.dimensions (ib_,&mx,&my,&mz);
+  field.ghost_depth(ib_,&gx,&gy,&gz);
+
+  // impulse response must not wrap around within the Block
+
+  const int g = A->ghost_depth();
+  ASSERT4 ("EnzoSolverFft::compute_()",
+           "Block size %d x %d x %d too small for stencil half-width %d",
+           nx,ny,nz,g,
+           ((nx == 1 || nx > 2*g) &&
+            (ny == 1 || ny > 2*g) &&
+            (nz == 1 || nz > 2*g)));
+
+  {
+    MemoryGroup memory_group (memory_group_solver);
+    field.allocate_temporary(ie_);
+    field.allocate_temporary(iy_);
+  }
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+  enzo_float * B = (enzo_float*) field.values(ib_);
+  enzo_float * E = (enzo_float*) field.values(ie_);
+  enzo_float * Y = (enzo_float*) field.values(iy_);
+
+  const int cx = nx/2;
+  const int cy = ny/2;
+  const int cz = nz/2;
+
+  std::fill_n (E,mx*my*mz,0.0);
+  E[(gx+cx) + mx*((gy+cy) + my*(gz+cz))] = 1.0;
+
+  A->matvec(iy_,ie_,block);
+
+  const int n = nx*ny*nz;
+  std::vector< std::complex<double> > S(n), F(n);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+        const int i = (ix+gx) + mx*((iy+gy) + my*(iz+gz));
+        const int kx = (ix - cx + nx) % nx;
+        const int ky = (iy - cy + ny) % ny;
+        const int kz = (iz - cz + nz) % nz;
+        S[kx + nx*(ky + ny*kz)] = Y[i];
+        F[ix + nx*(iy + ny*iz)] = B[i];
+      }
+    }
+  }
+
+  fft_3d_(S,nx,ny,nz,false);
+  fft_3d_(F,nx,ny,nz,false);
+
+  // divide by eigenvalues, skipping the null space
+
+  double s_max = 0.0;
+  for (int k=0; k<n; k++) s_max = std::max(s_max,std::abs(S[k]));
+  const double s_min = s_max * 1e-12;
+
+  for (int k=0; k<n; k++) {
+    F[k] = (std::abs(S[k]) > s_min) ? F[k] / S[k] : 0.0;
+  }
+
+  fft_3d_(F,nx,ny,nz,true);
+
+  // copy solution, including periodic ghost zones
+
+  for (int iz=0; iz<mz; iz++) {
+    const int kz = ((iz-gz) % nz + nz) % nz;
+    for (int iy=0; iy<my; iy++) {
+      const int ky = ((iy-gy) % ny + ny) % ny;
+      for (int ix=0; ix<mx; ix++) {
+        const int kx = ((ix-gx) % nx + nx) % nx;
+        const int i = ix + mx*(iy + my*iz);
+        X[i] = enzo_float(F[kx + nx*(ky + ny*kz)].real() / n);
+      }
+    }
+  }
+
+  field.deallocate_temporary(ie_);
+  field.deallocate_temporary(iy_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::compute_isolated_ (Block * block) throw()
+//     G = Green's function of the Laplacian on the padded grid
+//     X = IFFT (FFT(B padded with zeros) * FFT(G))
+{
+  Field field = block->data()->field();
+
+  int nx,ny,nz;
+  int mx,my,mz;
+  int gx,gy,gz;
+  int mbx,mby,mbz;
+  int gbx,gby,gbz;
+  field.size           (&nx,&ny,&nz);
+  field.dimensions (ix_,&mx,&my,&mz);
+  field.ghost_depth(ix_,&gx,&gy,&gz);
+  field.dimensions (ib_,&mbx,&mby,&mbz);
+  field.ghost_depth(ib_,&gbx,&gby,&gbz);
+
+  // The padded grid must hold every offset between a cell and a cell
+  // or ghost zone without wrapping around
+
+  const int n3[3] = {nx,ny,nz};
+  const int g3[3] = {gx,gy,gz};
+  int p3[3];
+  for (int axis=0; axis<3; axis++) {
+    p3[axis] = 1;
+    if (n3[axis] > 1) {
+      while (p3[axis] < 2*(n3[axis]+g3[axis])) p3[axis] *= 2;
+    }
+  }
+  const int px = p3[0];
+  const int py = p3[1];
+  const int pz = p3[2];
+
+  double h3[3];
+  block->cell_width(h3,h3+1,h3+2);
+
+  compute_green_(p3,h3,cello::rank());
+
+  enzo_float * X = (enzo_float*) field.values(ix_);
+  enzo_float * B = (enzo_float*) field.values(ib_);
+
+  std::vector< std::complex<double> > F(px*py*pz, 0.0);
+
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+        const int i = (ix+gbx) + mbx*((iy+gby) + mby*(iz+gbz));
+        F[ix + px*(iy + py*iz)] = B[i];
+      }
+    }
+  }
+
+  fft_3d_(F,px,py,pz,false);
+  for (size_t k=0; k<F.size(); k++) F[k] *= green_[k];
+  fft_3d_(F,px,py,pz,true);
+
+  // copy solution, including the isolated solution in ghost zones
+
+  for (int iz=0; iz<mz; iz++) {
+    const int kz = ((iz-gz) + pz) % pz;
+    for (int iy=0; iy<my; iy++) {
+      const int ky = ((iy-gy) + py) % py;
+      for (int ix=0; ix<mx; ix++) {
+        const int kx = ((ix-gx) + px) % px;
+        const int i = ix + mx*(iy + my*iz);
+        X[i] = enzo_float(F[kx + px*(ky + py*kz)].real());
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::compute_green_
+(const int p3[3], const double h3[3], int rank)
+{
+  const std::vector<double> key =
+    { double(p3[0]), double(p3[1]), double(p3[2]), h3[0], h3[1], h3[2] };
+
+  if (key == green_key_) return;
+
+  green_key_ = key;
+
+  const int px = p3[0];
+  const int py = p3[1];
+  const int pz = p3[2];
+  const int np = px*py*pz;
+
+  // the Green's function is scaled by the cell volume, and by 1/np to
+  // normalize the inverse transform
+
+  double volume = h3[0];
+  if (rank >= 2) volume *= h3[1];
+  if (rank >= 3) volume *= h3[2];
+  const double h = pow(volume, 1.0/rank);
+  const double scale = volume / np;
+
+  // In the cell containing the source, use the Green's function
+  // averaged over the cell: the constants are the averages of ln(r)
+  // over a unit square and of 1/r over a unit cube about their centers
+
+  const double g0_1d = h / 8.0;
+  const double g0_2d = (log(h) - 1.0611754) / (2.0*cello::pi);
+  const double g0_3d = -2.3800772 / (4.0*cello::pi*h);
+
+  green_.resize(np);
+  for (int kz=0; kz<pz; kz++) {
+    const double z = h3[2] * ((kz < pz/2 || pz == 1) ? kz : kz - pz);
+    for (int ky=0; ky<py; ky++) {
+      const double y = h3[1] * ((ky < py/2 || py == 1) ? ky : ky - py);
+      for (int kx=0; kx<px; kx++) {
+        const double x = h3[0] * ((kx < px/2 || px == 1) ? kx : kx - px);
+        const double r = sqrt(x*x + y*y + z*z);
+        double g;
+        if (rank == 1) {
+          g = (r > 0.0) ? 0.5*r : g0_1d;
+        } else if (rank == 2) {
+          g = (r > 0.0) ? log(r) / (2.0*cello::pi) : g0_2d;
+        } else {
+          g = (r > 0.0) ? -1.0 / (4.0*cello::pi*r) : g0_3d;
+        }
+        green_[kx + px*(ky + py*kz)] = g * scale;
+      }
+    }
+  }
+
+  fft_3d_(green_,px,py,pz,false);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSolverFft::fft_3d_
+(std::vector< std::complex<double> > & a,
+ int nx, int ny, int nz, bool inverse)
+{
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      FftLevel::fft (&a[nx*(iy + ny*iz)], nx, 1, inverse);
+    }
+  }
+  for (int iz=0; iz<nz; iz++) {
+    for (int ix=0; ix<nx; ix++) {
+      FftLevel::fft (&a[ix + nx*ny*iz], ny, nx, inverse);
+    }
+  }
+  for (int iy=0; iy<ny; iy++) {
+    for (int ix=0; ix<nx; ix++) {
+      FftLevel::fft (&a[ix + nx*iy], nz, nx*ny, inverse);
+    }
+  }
+}
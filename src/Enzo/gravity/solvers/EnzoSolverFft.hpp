@@ -0,0 +1,116 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoSolverFft.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of the EnzoSolverFft class
+
+#ifndef ENZO_ENZO_SOLVER_FFT_HPP
+#define ENZO_ENZO_SOLVER_FFT_HPP
+
+class EnzoSolverFft : public Solver {
+
+  /// @class    EnzoSolverFft
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Direct FFT solver for periodic, constant
+  ///           coefficient linear systems on a single Block
+  ///
+  /// Solves A*X = B exactly on a Block that covers the whole periodic
+  /// domain, e.g. the coarsest level of EnzoSolverMg0 when min_level is
+  /// negative.  The eigenvalues of A are computed by applying A to a
+  /// unit impulse and transforming its response, so the solution is
+  /// exact for the discrete operator (of any order) rather than for the
+  /// continuous Laplacian.  Zero eigenvalues (the null space of
+  /// singular A) are skipped, giving the zero-mean solution.
+  ///
+  /// If isolated, A must be the Laplacian and the solution is instead
+  /// the vacuum (isolated) solution, computed by convolving B with the
+  /// free-space Green's function on a zero-padded grid (Hockney &
+  /// Eastwood 1988).  The padded grid also covers the ghost zones, so
+  /// ghost values are the isolated solution outside the domain.
+
+public: // interface
+
+  /// Constructor
+  EnzoSolverFft (std::string name,
+                 std::string field_x,
+                 std::string field_b,
+                 int monitor_iter,
+                 int restart_cycle,
+                 int solve_type,
+                 int index_prolong,
+                 int index_restrict,
+                 int min_level,
+                 int max_level,
+                 bool isolated) throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoSolverFft);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoSolverFft (CkMigrateMessage *m)
+    : Solver(m),
+      ie_(-1),
+      iy_(-1),
+      isolated_(false),
+      green_(),
+      green_key_()
+  {}
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p)
+  {
+    TRACEPUP;
+    Solver::pup(p);
+    p | ie_;
+    p | iy_;
+    p | isolated_;
+    // green_ and green_key_ are recomputed when needed
+  };
+
+  //--------------------------------------------------
+
+public: // virtual functions
+
+  /// Solve the linear system Ax = b
+  virtual void apply ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Type of this solver
+  virtual std::string type() const { return "fft"; }
+
+  //--------------------------------------------------
+
+protected: // methods
+
+  void compute_ ( std::shared_ptr<Matrix> A, Block * block) throw();
+
+  /// Isolated solution of the Laplacian
+  void compute_isolated_ (Block * block) throw();
+
+  /// Compute the transform of the free-space Green's function of the
+  /// Laplacian on a padded grid of p3 cells of widths h3 if not cached
+  void compute_green_ (const int p3[3], const double h3[3], int rank);
+
+  /// FFT of an nx*ny*nz array along each dimension of extent > 1
+  static void fft_3d_ (std::vector< std::complex<double> > & a,
+                       int nx, int ny, int nz, bool inverse);
+
+protected: // attributes
+
+  /// Index for temporary field for the unit impulse
+  int ie_;
+
+  /// Index for temporary field for the impulse response A*E
+  int iy_;
+
+  /// Whether to compute the isolated instead of the periodic solution
+  bool isolated_;
+
+  /// Transform of the Green's function scaled by the cell volume and
+  /// the inverse transform's normalization, and the padded sizes and
+  /// cell widths it was computed for
+  std::vector< std::complex<double> > green_;
+  std::vector<double> green_key_;
+};
+
+#endif /* ENZO_ENZO_SOLVER_FFT_HPP */
@@ -67,7 +67,7 @@ EnzoSolverJacobi::EnzoSolverJacobi
   int solve_type,
   int index_prolong,
   int index_restrict,
-  double weight, int iter_max) throw()
+  double weight, int iter_max, int sweeps_per_refresh) throw()
   : Solver(name,
 	   field_x,
 	   field_b,
@@ -81,7 +81,8 @@ EnzoSolverJacobi::EnzoSolverJacobi
     id_ (-1),
     w_(weight),
     n_(iter_max),
-    ir_smooth_(-1)
+    ir_smooth_(-1),
+    sweeps_per_refresh_(sweeps_per_refresh)
 {
   // Reserve temporary fields
 
@@ -191,69 +192,53 @@ void EnzoSolverJacobi::apply_(Block * block)
   // field.ghost_depth(ix_,&gx,&gy,&gz);
 
   const int ng = A_->ghost_depth();
-  const int gx = (mx > 1) ? ng : 0;
-  const int gy = (my > 1) ? ng : 0;
-  const int gz = (mz > 1) ? ng : 0;
+
+  // number of sweeps before the next refresh
+
+  const int num_sweeps = std::min(sweeps_per_refresh_, n_ - (*piter_(block)));
 
   if (is_finest_(block)) {
 
-    A_->diagonal (id_, block,ng);
-    A_->residual (ir_, ib_, ix_, block,ng);
+    int g3[3];
+    field.ghost_depth(ix_,g3,g3+1,g3+2);
+    ASSERT4 ("EnzoSolverJacobi::apply_()",
+             "%d sweeps per refresh require %d ghost zones, but field has %d for solver %s",
+             num_sweeps, num_sweeps*ng, g3[0], name_.c_str(),
+             (num_sweeps == 1 || num_sweeps*ng <= g3[0]));
+
+    // fused residual, diagonal, and update if supported by the matrix
+
+    if (! A_->jacobi (ix_, ib_, w_, num_sweeps, block, ng)) {
 
-#ifdef DEBUG_COPY
-    {
+      enzo_float * X = (enzo_float*) field.values(ix_);
       enzo_float * R = (enzo_float*) field.values(ir_);
-      enzo_float * R_J = (enzo_float*) field.values("R_J");
       enzo_float * D = (enzo_float*) field.values(id_);
-      enzo_float * D_J = (enzo_float*) field.values("D_J");
-      enzo_float * X = (enzo_float*) field.values(ix_);
-      enzo_float * X_J = (enzo_float*) field.values("X_J");
-      enzo_float * B = (enzo_float*) field.values(ib_);
-      enzo_float * B_J = (enzo_float*) field.values("B_J");
-      double rsum=0.0;
-      double dsum=0.0;
-      double xsum=0.0;
-      double bsum=0.0;
-      for (int i=0; i<mx*my*mz; i++) {
-	R_J[i]=R[i];
-	D_J[i]=D[i];
-	X_J[i]=X[i];
-	B_J[i]=B[i];
-	rsum+=std::abs(R[i]);
-	dsum+=std::abs(D[i]);
-	xsum+=X[i];
-	bsum+=std::abs(B[i]);
-      }
-      CkPrintf ("DEBUG_COPY rsum dsum xsum bsum %g %g %g %g\n",rsum,dsum,xsum,bsum);
-    }
-#endif    
-    enzo_float * X = (enzo_float*) field.values(ix_);
-    enzo_float * R = (enzo_float*) field.values(ir_);
-    enzo_float * D = (enzo_float*) field.values(id_);
-
-    if (w_ == 1.0) {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    X[i] += R[i] / D[i];
-	  }
-	}
-      }
-    } else {
-      for (int iz=gz; iz<mz-gz; iz++) {
-	for (int iy=gy; iy<my-gy; iy++) {
-	  for (int ix=gx; ix<mx-gx; ix++) {
-	    int i = ix + mx*(iy + my*iz);
-	    X[i] = w_*(R[i] / D[i]) + (1.0-w_)*X[i];
-	  }
-	}
+
+      for (int k=0; k<num_sweeps; k++) {
+
+        const int g = ng*(k+1);
+        const int gx = (mx > 1) ? g : 0;
+        const int gy = (my > 1) ? g : 0;
+        const int gz = (mz > 1) ? g : 0;
+
+        A_->diagonal (id_, block,g);
+        A_->residual (ir_, ib_, ix_, block,g);
+
+        for (int iz=gz; iz<mz-gz; iz++) {
+          for (int iy=gy; iy<my-gy; iy++) {
+            for (int ix=gx; ix<mx-gx; ix++) {
+              int i = ix + mx*(iy + my*iz);
+              X[i] += w_*(R[i] / D[i]);
+            }
+          }
+        }
       }
     }
   }
+
   // Next iteration
 
-  (*piter_(block))++;
+  (*piter_(block)) += num_sweeps;
   
   // Refresh X
 
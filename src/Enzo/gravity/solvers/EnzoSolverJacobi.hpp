@@ -26,7 +26,8 @@ public: // interface
                    int index_prolong,
                    int index_restrict,
                    double weight=1.0,
-                   int iter_max = 1) throw();
+                   int iter_max = 1,
+                   int sweeps_per_refresh = 1) throw();
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoSolverJacobi);
@@ -40,7 +41,8 @@ public: // interface
       w_(0),
       i_iter_(-1),
       n_(0),
-      ir_smooth_(-1)
+      ir_smooth_(-1),
+      sweeps_per_refresh_(1)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -56,6 +58,7 @@ public: // interface
     p | i_iter_;
     p | n_;
     p | ir_smooth_;
+    p | sweeps_per_refresh_;
   }
 
 public: // virtual methods
@@ -106,6 +109,7 @@ protected: // methods
   /// Allocate temporary Fields
   void allocate_temporary_(Field field, Block * block = NULL)
   {
+    MemoryGroup memory_group (memory_group_solver);
     field.allocate_temporary(id_);
     field.allocate_temporary(ir_);
   }
@@ -148,6 +152,10 @@ protected: // attributes
 
   // Refresh after each smoothing
   int ir_smooth_;
+
+  /// Number of sweeps between refreshes, each sweep reducing the
+  /// region of valid ghost zones by the matrix ghost_depth()
+  int sweeps_per_refresh_;
 };
 
 #endif /* ENZO_ENZO_SOLVER_JACOBI_HPP */
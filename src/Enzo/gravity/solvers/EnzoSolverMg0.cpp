@@ -582,6 +582,7 @@ void EnzoSolverMg0::restrict_send(EnzoBlock * enzo_block) throw()
   compute_residual_(enzo_block);
 
   FieldMsg * msg = pack_residual_(enzo_block);
+  MsgCounter::sent (msg_class_field,msg->n);
 
   Index index_parent = enzo_block->index().index_parent(min_level_);
 
@@ -617,6 +618,7 @@ void EnzoSolverMg0::compute_residual_(EnzoBlock * enzo_block) throw()
 void EnzoBlock::p_solver_mg0_restrict_recv(FieldMsg * msg)
 {
   SOLVER_CONTROL(this,"*","*", "p_restrict_recv");
+  MsgCounter::received (msg_class_field,msg->n);
 
   performance_start_(perf_compute,__FILE__,__LINE__);
 
@@ -712,6 +714,7 @@ void EnzoSolverMg0::prolong_send_(EnzoBlock * enzo_block) throw()
   while (it_child.next(ic3)) {
 
     FieldMsg * msg = pack_correction_(enzo_block,ic3);
+    MsgCounter::sent (msg_class_field,msg->n);
 
     Index index_child = enzo_block->index().index_child(ic3,min_level_);
 
@@ -726,6 +729,7 @@ void EnzoSolverMg0::prolong_send_(EnzoBlock * enzo_block) throw()
 void EnzoBlock::p_solver_mg0_prolong_recv(FieldMsg * msg)
 {
   SOLVER_CONTROL(this,"*","*", "p_prolong_recv");
+  MsgCounter::received (msg_class_field,msg->n);
   performance_start_(perf_compute,__FILE__,__LINE__);
   solver_mg0_prolong_recv(msg);
   performance_stop_(perf_compute,__FILE__,__LINE__);
@@ -934,27 +938,17 @@ FieldMsg * EnzoSolverMg0::pack_residual_(EnzoBlock * enzo_block) throw()
 
   refresh->set_restrict(index_restrict_);
 
-  int narray;
-  char * array;
-
   Field field = enzo_block->data()->field();
 
-  field_face->face_to_array(field,&narray,&array);
-
-  delete field_face;
-
-  // Create a FieldMsg for sending data to parent
-  // (note: charm messages not deleted on send; are deleted on receive)
-
-  FieldMsg * msg  = new (narray) FieldMsg;
+  // Create a FieldMsg for sending data to parent and copy FieldFace
+  // data directly into it
+  // (note: charm messages not deleted on send; are released on receive)
 
-  /// WARNING: double copy
+  FieldMsg * msg = FieldMsg::create(field_face->num_bytes_array(field));
+  field_face->face_to_array(field,msg->a);
 
-  // Copy FieldFace data to msg
+  delete field_face;
 
-  msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
   msg->ic3[2] = ic3[2];
@@ -991,7 +985,7 @@ void EnzoSolverMg0::unpack_residual_
   field_face->array_to_face(a, field);
   delete field_face;
 
-  delete msg;
+  FieldMsg::release(msg);
 }
 
 //----------------------------------------------------------------------
@@ -1017,24 +1011,16 @@ FieldMsg * EnzoSolverMg0::pack_correction_
     (if3, ic3, g3, refresh_fine, refresh);
 
   Field field = enzo_block->data()->field();
-  int narray;
-  char * array;
-  field_face->face_to_array (field,&narray,&array);
-
-  delete field_face;
 
-  // Create a FieldMsg for sending data to parent
-  // (note: charm messages not deleted on send; are deleted on receive)
+  // Create a FieldMsg for sending data to child and copy FieldFace
+  // data directly into it
+  // (note: charm messages not deleted on send; are released on receive)
 
-  FieldMsg * msg  = new (narray) FieldMsg;
+  FieldMsg * msg = FieldMsg::create(field_face->num_bytes_array(field));
+  field_face->face_to_array (field,msg->a);
 
-  /// WARNING: double copy
-
-  // Copy FieldFace data to msg
+  delete field_face;
 
-  msg->n = narray;
-  memcpy (msg->a, array, narray);
-  delete [] array;
   msg->ic3[0] = ic3[0];
   msg->ic3[1] = ic3[1];
   msg->ic3[2] = ic3[2];
@@ -1067,7 +1053,7 @@ void EnzoSolverMg0::unpack_correction_
   field_face->array_to_face (msg->a, field);
 
   delete field_face;
-  delete msg;
+  FieldMsg::release(msg);
 
 }
 
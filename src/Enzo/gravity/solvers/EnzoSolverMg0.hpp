@@ -272,6 +272,7 @@ protected: // methods
   /// Allocate temporary Fields
   void allocate_temporary_(Block * block)
   {
+    MemoryGroup memory_group (memory_group_solver);
     Field field = block->data()->field();
     field.allocate_temporary(ir_);
     field.allocate_temporary(ic_);
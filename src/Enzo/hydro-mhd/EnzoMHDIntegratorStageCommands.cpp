@@ -21,7 +21,9 @@ EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands
     reconstructors_(),
     integration_quan_updater_(nullptr),
     mhd_choice_(EnzoMHDIntegratorStageCommands::parse_bfield_choice_
-                (args.mhd_choice))
+                (args.mhd_choice)),
+    tile_rows_(args.tile_rows),
+    num_tasks_(args.num_tasks)
 {
   // check compatability with EnzoPhysicsFluidProps
   EnzoPhysicsFluidProps* fluid_props = enzo::fluid_props();
@@ -61,6 +63,11 @@ EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands
 
   integration_quan_updater_ =
     new EnzoIntegrationQuanUpdate(integration_field_list, true);
+
+  ASSERT("EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands",
+         "tile_rows can't be negative", tile_rows_ >= 0);
+  ASSERT("EnzoMHDIntegratorStageCommands::EnzoMHDIntegratorStageCommands",
+         "num_tasks must be positive", num_tasks_ > 0);
 }
 
 //----------------------------------------------------------------------
@@ -99,6 +106,31 @@ EnzoMHDIntegratorStageCommands::parse_bfield_choice_
 
 //----------------------------------------------------------------------
 
+std::array<int,3> EnzoMHDIntegratorStageCommands::reconstructed_scratch_shape
+(const std::array<int,3>& shape) const noexcept
+{
+  if (tile_rows_ == 0) { return shape; }
+
+  // find the largest stale depth just after reconstruction (assuming that the
+  // first stage starts with a stale depth of 0)
+  int stale_depth = 0;
+  int max_stale_depth = 0;
+  for (const std::unique_ptr<EnzoReconstructor>& recon : reconstructors_) {
+    max_stale_depth = std::max(max_stale_depth,
+                               stale_depth + recon->immediate_staling_rate());
+    stale_depth += recon->total_staling_rate();
+  }
+
+  // a tile buffer holds stale rows on either side of the tile. Tiles are
+  // layers of z-rows for dims 0 & 1 and of y-rows for dim 2. Each task has
+  // its own tile buffer
+  const int rows = tile_rows_ + 2*max_stale_depth;
+  const int size = rows * std::max(shape[1]*shape[2], shape[0]*shape[2]);
+  return {1, 1, size * num_tasks_};
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMHDIntegratorStageCommands::compute_update_stage
 (EnzoEFltArrayMap tstep_begin_integration_map,
  EnzoEFltArrayMap cur_stage_integration_map,
@@ -144,15 +176,10 @@ void EnzoMHDIntegratorStageCommands::compute_update_stage
 
   // Compute flux along each dimension
   for (int dim = 0; dim < 3; dim++){
-    // trim the shape of priml_map and primr_map (they're bigger than
-    // necessary so that they can be reused for each dim).
     CSlice x_slc = (dim == 0) ? CSlice(0,-1) : CSlice(0, nullptr);
     CSlice y_slc = (dim == 1) ? CSlice(0,-1) : CSlice(0, nullptr);
     CSlice z_slc = (dim == 2) ? CSlice(0,-1) : CSlice(0, nullptr);
 
-    EnzoEFltArrayMap pl_map = priml_map.subarray_map(z_slc, y_slc, x_slc);
-    EnzoEFltArrayMap pr_map = primr_map.subarray_map(z_slc, y_slc, x_slc);
-
     EFlt3DArray *interface_vel_arr_ptr, sliced_interface_vel_arr;
     if (fluid_props->dual_energy_config().any_enabled()){
       // when using dual energy formalism, trim the trim scratch-array for
@@ -168,10 +195,24 @@ void EnzoMHDIntegratorStageCommands::compute_update_stage
       interface_vel_arr_ptr = nullptr;
     }
 
-    compute_flux_(dim, cur_dt, cell_widths_xyz[dim], primitive_map,
-                  pl_map, pr_map, flux_maps_xyz[dim], dUcons_map,
-                  interface_vel_arr_ptr, *reconstructor, bfield_method_,
-                  stale_depth, passive_list);
+    if (tile_rows_ > 0) {
+      // priml_map and primr_map are flat buffers that are reused for each
+      // tile
+      compute_flux_tiled_(dim, cur_dt, cell_widths_xyz[dim], primitive_map,
+                          priml_map, primr_map, flux_maps_xyz[dim],
+                          dUcons_map, interface_vel_arr_ptr, *reconstructor,
+                          bfield_method_, stale_depth, passive_list);
+    } else {
+      // trim the shape of priml_map and primr_map (they're bigger than
+      // necessary so that they can be reused for each dim).
+      EnzoEFltArrayMap pl_map = priml_map.subarray_map(z_slc, y_slc, x_slc);
+      EnzoEFltArrayMap pr_map = primr_map.subarray_map(z_slc, y_slc, x_slc);
+
+      compute_flux_(dim, cur_dt, cell_widths_xyz[dim], primitive_map,
+                    pl_map, pr_map, flux_maps_xyz[dim], dUcons_map,
+                    interface_vel_arr_ptr, *reconstructor, bfield_method_,
+                    stale_depth, passive_list);
+    }
   }
 
   // increment the stale_depth
@@ -228,7 +269,8 @@ void EnzoMHDIntegratorStageCommands::compute_flux_
   // interfaces
   if (bfield_method != nullptr) {
     bfield_method->correct_reconstructed_bfield(priml_map, primr_map,
-                                                dim, cur_stale_depth);
+                                                dim, cur_stale_depth,
+                                                {0, 0, 0});
   }
 
   // Next, compute the fluxes
@@ -262,6 +304,169 @@ void EnzoMHDIntegratorStageCommands::compute_flux_
 
 //----------------------------------------------------------------------
 
+/// Returns slices that select rows [start,stop) along axis (and everything
+/// along the other axes)
+static std::array<CSlice,3> tile_slices_(int axis, int start, int stop)
+{
+  std::array<CSlice,3> out = {CSlice(nullptr, nullptr),
+                              CSlice(nullptr, nullptr),
+                              CSlice(nullptr, nullptr)};
+  out[axis] = CSlice(start, stop);
+  return out;
+}
+
+//----------------------------------------------------------------------
+
+/// Returns a map of contiguous arrays with the given shape, which occupy the
+/// start of part `task` of the (flat) buffer backing buffer_map, when the
+/// buffer is divided into `num_tasks` equal parts
+static EnzoEFltArrayMap tile_map_(const EnzoEFltArrayMap &buffer_map,
+                                  const str_vec_t &keys,
+                                  const std::array<int,3> &shape,
+                                  int task, int num_tasks)
+{
+  const CelloView<enzo_float,4> buffer = buffer_map.get_backing_array();
+  const int nkeys = buffer.shape(0);
+  const long part_size =
+    long(nkeys) * buffer.shape(1) * buffer.shape(2) * buffer.shape(3) /
+    num_tasks;
+  ASSERT("tile_map_", "the scratch buffer is too small for the tile",
+         (std::size_t)nkeys == keys.size() &&
+         (long(nkeys) * shape[0] * shape[1] * shape[2] <= part_size));
+  return EnzoEFltArrayMap(buffer_map.name(), keys,
+                          CelloView<enzo_float,4>(buffer.data() +
+                                                  task * part_size,
+                                                  nkeys, shape[0], shape[1],
+                                                  shape[2]));
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMHDIntegratorStageCommands::compute_flux_tiled_
+(const int dim, const double cur_dt, const enzo_float cell_width,
+ EnzoEFltArrayMap &primitive_map,
+ EnzoEFltArrayMap &priml_buffer, EnzoEFltArrayMap &primr_buffer,
+ EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+ const EFlt3DArray* const interface_velocity_arr_ptr,
+ EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
+ const int stale_depth, const str_vec_t& passive_list) const noexcept
+{
+  // tiles are layers of rows along tile_axis (which is never the axis along
+  // dim). Every array passed to the components is sliced along tile_axis
+  const int tile_axis = (dim == 2) ? 1 : 0;
+  const int n_rows = primitive_map.array_shape(tile_axis);
+
+  const int cur_stale_depth = stale_depth +
+    reconstructor.immediate_staling_rate();
+
+  const std::array<int,3> face_shape = {flux_map.array_shape(0),
+                                        flux_map.array_shape(1),
+                                        flux_map.array_shape(2)};
+
+  // the reconstructed primitives must be ordered as the Riemann solver
+  // expects them
+  str_vec_t keys = primitive_quantity_keys();
+  keys.insert(keys.end(), passive_list.begin(), passive_list.end());
+
+  const bool dual_energy =
+    enzo::fluid_props()->dual_energy_config().any_enabled();
+
+  // tiles write to disjoint rows of flux_map and dUcons_map, so the tiles
+  // are divided between tasks, each with its own part of the tile buffers
+  const int num_tiles =
+    (n_rows - 2*cur_stale_depth + tile_rows_ - 1) / tile_rows_;
+
+  auto compute_tiles = [&](int task, int first_tile, int last_tile)
+  {
+    for (int tile = first_tile; tile < last_tile; tile++) {
+      const int t0 = cur_stale_depth + tile * tile_rows_;
+      const int t1 = std::min(t0 + tile_rows_, n_rows - cur_stale_depth);
+
+      // This tile updates rows [t0,t1). Each component trims stale_depth rows
+      // from both ends of the arrays it's passed, so arrays passed alongside a
+      // stale depth of s cover rows [t0-s, t1+s). The tile buffers hold rows
+      // [t0-cur_stale_depth, t1+cur_stale_depth)
+      std::array<int,3> tile_shape = face_shape;
+      tile_shape[tile_axis] = (t1 - t0) + 2*cur_stale_depth;
+      EnzoEFltArrayMap pl_tile = tile_map_(priml_buffer, keys, tile_shape,
+                                           task, num_tasks_);
+      EnzoEFltArrayMap pr_tile = tile_map_(primr_buffer, keys, tile_shape,
+                                           task, num_tasks_);
+
+      // First, reconstruct the left and right interface values
+      {
+        const std::array<CSlice,3> cell_slc =
+          tile_slices_(tile_axis, t0 - stale_depth, t1 + stale_depth);
+        const std::array<CSlice,3> tile_slc =
+          tile_slices_(tile_axis, cur_stale_depth - stale_depth,
+                       cur_stale_depth + (t1 - t0) + stale_depth);
+        const EnzoEFltArrayMap prim_rows = primitive_map.subarray_map
+          (cell_slc[0], cell_slc[1], cell_slc[2]);
+        EnzoEFltArrayMap pl_rows = pl_tile.subarray_map
+          (tile_slc[0], tile_slc[1], tile_slc[2]);
+        EnzoEFltArrayMap pr_rows = pr_tile.subarray_map
+          (tile_slc[0], tile_slc[1], tile_slc[2]);
+        reconstructor.reconstruct_interface(prim_rows, pl_rows, pr_rows,
+                                            dim, stale_depth, passive_list);
+      }
+
+      // Overwrite the component of reconstructed B-field along dim
+      if (bfield_method != nullptr) {
+        std::array<int,3> offset = {0, 0, 0};
+        offset[tile_axis] = t0 - cur_stale_depth;
+        bfield_method->correct_reconstructed_bfield(pl_tile, pr_tile, dim,
+                                                    cur_stale_depth, offset);
+      }
+
+      const std::array<CSlice,3> slc =
+        tile_slices_(tile_axis, t0 - cur_stale_depth, t1 + cur_stale_depth);
+      EnzoEFltArrayMap flux_rows = flux_map.subarray_map(slc[0], slc[1],
+                                                         slc[2]);
+      EnzoEFltArrayMap dUcons_rows = dUcons_map.subarray_map(slc[0], slc[1],
+                                                             slc[2]);
+      EFlt3DArray interface_velocity_rows;
+      if (interface_velocity_arr_ptr != nullptr) {
+        interface_velocity_rows = interface_velocity_arr_ptr->subarray
+          (slc[0], slc[1], slc[2]);
+      }
+      const EFlt3DArray* const interface_velocity_rows_ptr =
+        (interface_velocity_arr_ptr != nullptr) ? &interface_velocity_rows
+        : nullptr;
+
+      // Next, compute the fluxes
+      riemann_solver_->solve(pl_tile, pr_tile, flux_rows, dim,
+                             cur_stale_depth, passive_list,
+                             interface_velocity_rows_ptr);
+
+      // Accumulate the changes in the conserved form of the integration
+      // quantities from the fluxes
+      integration_quan_updater_->accumulate_flux_component
+        (dim, cur_dt, cell_width, flux_rows, dUcons_rows, cur_stale_depth,
+         passive_list);
+
+      // if using dual energy formalism, compute the component of the internal
+      // energy source term for this dim
+      if (dual_energy){
+        EnzoSourceInternalEnergy eint_src;
+        eint_src.calculate_source(dim, cur_dt, cell_width,
+                                  primitive_map.subarray_map(slc[0], slc[1],
+                                                             slc[2]),
+                                  dUcons_rows, interface_velocity_rows,
+                                  cur_stale_depth);
+      }
+    }
+  };
+
+  cello::parallel_for(0, num_tiles, num_tasks_, compute_tiles);
+
+  // Finally, have bfield_method record the upwind direction (for handling CT)
+  if (bfield_method != nullptr){
+    bfield_method->identify_upwind(flux_map, dim, cur_stale_depth);
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMHDIntegratorStageCommands::compute_source_terms_
 (const double cur_dt, const bool full_timestep,
  const EnzoEFltArrayMap &orig_integration_map,
@@ -322,44 +527,57 @@ double EnzoMHDIntegratorStageCommands::timestep
   // initialize returned value
   double dtBaryons = std::numeric_limits<double>::max();
 
+  // the minimum is accumulated in a local variable for each row along x,
+  // so the inner loops carry no dependence through memory and can be
+  // vectorized
+  const int mz = density.shape(0);
+  const int my = density.shape(1);
+  const int mx = density.shape(2);
+
   if (this->is_pure_hydro()) {
-    auto loop_body = [=, &dtBaryons](int iz, int iy, int ix)
-      {
-        double cs = (double) eos.sound_speed(density(iz,iy,ix),
-                                             pressure(iz,iy,ix));
-        double local_dt = enzo_utils::min<double>
-          (dx/(std::fabs((double) velocity_x(iz,iy,ix)) + cs),
-           dy/(std::fabs((double) velocity_y(iz,iy,ix)) + cs),
-           dz/(std::fabs((double) velocity_z(iz,iy,ix)) + cs));
-        dtBaryons = std::min(dtBaryons, local_dt);
-      };
-    enzo_utils::exec_loop(density.shape(0), density.shape(1), density.shape(2),
-                          0, loop_body);
+    for (int iz = 0; iz < mz; iz++){
+      for (int iy = 0; iy < my; iy++){
+        double row_dt = dtBaryons;
+        for (int ix = 0; ix < mx; ix++){
+          double cs = (double) eos.sound_speed(density(iz,iy,ix),
+                                               pressure(iz,iy,ix));
+          double local_dt = enzo_utils::min<double>
+            (dx/(std::fabs((double) velocity_x(iz,iy,ix)) + cs),
+             dy/(std::fabs((double) velocity_y(iz,iy,ix)) + cs),
+             dz/(std::fabs((double) velocity_z(iz,iy,ix)) + cs));
+          row_dt = std::min(row_dt, local_dt);
+        }
+        dtBaryons = std::min(dtBaryons, row_dt);
+      }
+    }
 
   } else {
     const RdOnlyEFltView bfieldc_x = integration_map.at("bfield_x");
     const RdOnlyEFltView bfieldc_y = integration_map.at("bfield_y");
     const RdOnlyEFltView bfieldc_z = integration_map.at("bfield_z");
 
-    auto loop_body = [=, &dtBaryons](int iz, int iy, int ix)
-      {
-        // if the bfield is 0 at any given point, the fast magnetosonic speed
-        // correctly reduces to the sound speed.
-        //
-        // We follow the convention of using the maximum value of the fast
-        // magnetosonic speed:     cfast = sqrt(va^2+cs^2)
-        double cfast = (double) eos.fast_magnetosonic_speed<0>
-          (density(iz,iy,ix), pressure(iz,iy,ix),
-           bfieldc_x(iz,iy,ix), bfieldc_y(iz,iy,ix), bfieldc_z(iz,iy,ix));
-
-        double local_dt = enzo_utils::min<double>
-           (dx/(std::fabs((double) velocity_x(iz,iy,ix)) + cfast),
-            dy/(std::fabs((double) velocity_y(iz,iy,ix)) + cfast),
-            dz/(std::fabs((double) velocity_z(iz,iy,ix)) + cfast));
-        dtBaryons = std::min(dtBaryons, local_dt);
-      };
-    enzo_utils::exec_loop(density.shape(0), density.shape(1), density.shape(2),
-                          0, loop_body);
+    for (int iz = 0; iz < mz; iz++){
+      for (int iy = 0; iy < my; iy++){
+        double row_dt = dtBaryons;
+        for (int ix = 0; ix < mx; ix++){
+          // if the bfield is 0 at any given point, the fast magnetosonic
+          // speed correctly reduces to the sound speed.
+          //
+          // We follow the convention of using the maximum value of the fast
+          // magnetosonic speed:     cfast = sqrt(va^2+cs^2)
+          double cfast = (double) eos.fast_magnetosonic_speed<0>
+            (density(iz,iy,ix), pressure(iz,iy,ix),
+             bfieldc_x(iz,iy,ix), bfieldc_y(iz,iy,ix), bfieldc_z(iz,iy,ix));
+
+          double local_dt = enzo_utils::min<double>
+            (dx/(std::fabs((double) velocity_x(iz,iy,ix)) + cfast),
+             dy/(std::fabs((double) velocity_y(iz,iy,ix)) + cfast),
+             dz/(std::fabs((double) velocity_z(iz,iy,ix)) + cfast));
+          row_dt = std::min(row_dt, local_dt);
+        }
+        dtBaryons = std::min(dtBaryons, row_dt);
+      }
+    }
   }
 
   return dtBaryons; // courant factor is handled separately!
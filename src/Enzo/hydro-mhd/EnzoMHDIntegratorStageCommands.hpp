@@ -29,12 +29,19 @@ struct EnzoMHDIntegratorStageArgPack {
   std::vector<std::string> recon_names;
   double theta_limiter;
   std::string mhd_choice;
+  /// number of rows per tile when fluxes are computed one tile at a time
+  /// (a value of 0 computes them for the whole block at once)
+  int tile_rows;
+  /// number of tasks the tiles are divided between (see cello::parallel_for)
+  int num_tasks;
 
   void pup(PUP::er &p) {
     p | rsolver;
     p | recon_names;
     p | theta_limiter;
     p | mhd_choice;
+    p | tile_rows;
+    p | num_tasks;
   }
 };
 
@@ -144,6 +151,21 @@ public:
   bool is_pure_hydro() const noexcept
   { return mhd_choice_ == bfield_choice::no_bfield; }
 
+  /// number of rows per tile when fluxes are computed one tile at a time, or
+  /// 0 if they are computed for the whole block at once
+  int tile_rows() const noexcept
+  { return tile_rows_; }
+
+  /// gives the shape of the arrays that should be allocated for the
+  /// `priml_map` and `primr_map` arguments of compute_update_stage
+  ///
+  /// Without tiling this is just `shape`, the shape of a cell-centered
+  /// array. With tiling, the maps are flat buffers of shape `{1, 1, n}`,
+  /// where `n` is large enough to hold the reconstructed values of a
+  /// single tile along any dimension.
+  std::array<int,3> reconstructed_scratch_shape
+  (const std::array<int,3>& shape) const noexcept;
+
   /// main workhorse: actually execute a single stage of the MHD integrator.
   ///
   /// Except where otherwise noted, all instances of EnzoEFltArrayMap passed as
@@ -182,7 +204,9 @@ public:
   ///     keys from the "primitive keys" category.
   /// @param[in]     priml_map,primr_map Scratch-space maps that are used to
   ///     hold the left/right reconstructed face-centered primitives. It has
-  ///     keys from the "primitive keys" category (KEY-ORDER MATTERS!!!)
+  ///     keys from the "primitive keys" category (KEY-ORDER MATTERS!!!). The
+  ///     arrays should have the shape given by reconstructed_scratch_shape
+  ///     (when tiling, they are not sliced alongside the other maps).
   /// @param[in,out] flux_maps_xyz Array of 3 maps where the calculated fluxes
   ///     for the integration quantities will be stored for the x, y, and z
   ///     directions, respectively. Each map has keys from the
@@ -326,6 +350,27 @@ protected:
    EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
    const int stale_depth, const str_vec_t& passive_list) const noexcept;
 
+  /// Equivalent to `compute_flux_`, but reconstructs, computes the fluxes
+  /// and accumulates the changes in `dUcons_map` for one tile of rows at a
+  /// time, so that the data of a tile stays in cache between these steps.
+  ///
+  /// Tiles span `tile_rows_` rows along z when `dim` is 0 or 1, and along y
+  /// when `dim` is 2, and extend over the full block along the other 2
+  /// axes. Rather than holding face-centered arrays for the whole block,
+  /// `priml_buffer` and `primr_buffer` are flat buffers (see
+  /// `reconstructed_scratch_shape`) that are reused for each tile. Tiles
+  /// are divided between `num_tasks_` tasks (which may run concurrently),
+  /// each using its own part of the buffers. The other arguments are the
+  /// same as for `compute_flux_`.
+  void compute_flux_tiled_
+  (const int dim, const double cur_dt, const enzo_float cell_width,
+   EnzoEFltArrayMap &primitive_map,
+   EnzoEFltArrayMap &priml_buffer, EnzoEFltArrayMap &primr_buffer,
+   EnzoEFltArrayMap &flux_map, EnzoEFltArrayMap &dUcons_map,
+   const EFlt3DArray* const interface_velocity_arr_ptr,
+   EnzoReconstructor &reconstructor, EnzoBfieldMethod *bfield_method,
+   const int stale_depth, const str_vec_t& passive_list) const noexcept;
+
   /// Computes source terms and accumulate the changes to the integration
   /// quantities in `dUcons_map``dU_cons` accordingly.
   ///
@@ -380,6 +425,13 @@ private:
   /// Indicates how magnetic fields are handled
   bfield_choice mhd_choice_;
 
+  /// Number of rows per tile (0 disables tiling)
+  int tile_rows_;
+
+  /// Number of tasks the tiles are divided between. Each task has its own
+  /// part of the reconstructed-primitive buffers
+  int num_tasks_;
+
 };
 
 #endif /* ENZO_MHD_INTEGRATOR_STAGE_COMMANDS_HPP */
@@ -80,7 +80,9 @@ parse_mhdchoice_pack_pair_(ParameterGroup p)
     new EnzoMHDIntegratorStageArgPack {p.value_string("riemann_solver","hlld"),
                                        recon_names,
                                        p.value_float("theta_limiter", 1.5),
-                                       p.value_string("mhd_choice", "")};
+                                       p.value_string("mhd_choice", ""),
+                                       p.value_integer("tile_rows", 0),
+                                       p.value_integer("num_tasks", 1)};
 
   return {time_scheme, argpack_ptr};
 }
@@ -99,6 +101,7 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (ParameterGroup p,
   integrator_arg_pack_ = pair.second;
   const double dflt_courant = (time_scheme_ == "vl") ? 0.3 : 1.0;
   this->set_courant(p.value_float("courant",dflt_courant));
+  this->set_num_tasks(integrator_arg_pack_->num_tasks);
 
   int nstages = static_cast<int>(integrator_arg_pack_->recon_names.size());
 
@@ -140,6 +143,16 @@ EnzoMethodMHDVlct::EnzoMethodMHDVlct (ParameterGroup p,
            integrator_->is_pure_hydro());
   }
 
+  overlap_refresh_ = p.value_logical("overlap_refresh", false);
+  if (overlap_refresh_){
+    ASSERT("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+           "overlap_refresh is currently only supported in hydro-mode",
+           integrator_->is_pure_hydro());
+    ASSERT("EnzoMethodMHDVlct::EnzoMethodMHDVlct",
+           "overlap_refresh requires time_scheme = \"vl\"",
+           time_scheme_ == "vl");
+  }
+
   scratch_space_ = nullptr;
 
   // Finally, initialize the default Refresh object
@@ -163,6 +176,8 @@ EnzoMethodMHDVlct::~EnzoMethodMHDVlct()
   if (bfield_method_ != nullptr){
     delete bfield_method_;
   }
+  for (auto & it : interior_scratch_) { delete it.second; }
+  for (EnzoVlctScratchSpace * scratch : free_scratch_) { delete scratch; }
 }
 
 //----------------------------------------------------------------------
@@ -194,41 +209,60 @@ void EnzoMethodMHDVlct::pup (PUP::er &p)
   p|primitive_field_list_;
   p|lazy_passive_list_;
   p|store_fluxes_for_corrections_;
+  p|overlap_refresh_;
 }
 
 //----------------------------------------------------------------------
 
 EnzoEFltArrayMap EnzoMethodMHDVlct::get_integration_map_
-(Block * block,  const str_vec_t *passive_list) const noexcept
+(Block * block,  const str_vec_t *passive_list,
+ EnzoFieldStaging & staging) const noexcept
 {
-  str_vec_t field_list = (passive_list == nullptr) ? integration_field_list_ :
-    concat_str_vec_(integration_field_list_, *passive_list);
+  // field ids and map keys are looked up once, rather than for every Block
+  // (the list of passive scalars doesn't change after it is first known)
+  const std::size_t num_passive =
+    (passive_list == nullptr) ? 0 : passive_list->size();
+  if (integration_handles_.size() !=
+      integration_field_list_.size() + num_passive){
+    str_vec_t field_list = (passive_list == nullptr) ? integration_field_list_ :
+      concat_str_vec_(integration_field_list_, *passive_list);
+    integration_handles_.assign(field_list.begin(), field_list.end());
+    integration_keys_ = StringIndRdOnlyMap(field_list);
+  }
 
-  Field field = block->data()->field();
   std::vector<EFlt3DArray> arrays;
-  arrays.reserve(field_list.size());
-  for (const std::string& field_name : field_list){
-    arrays.push_back( field.view<enzo_float>(field_name) );
+  arrays.reserve(integration_handles_.size());
+  for (const FieldHandle& handle : integration_handles_){
+    arrays.push_back( staging.view(handle.id()) );
   }
 
-  return EnzoEFltArrayMap("integration",field_list,arrays);
+  return EnzoEFltArrayMap("integration",integration_keys_,arrays);
 }
 
 //----------------------------------------------------------------------
 
-static EnzoEFltArrayMap get_accel_map_(Block* block) noexcept
+EnzoEFltArrayMap EnzoMethodMHDVlct::get_accel_map_(Block* block)
+  const noexcept
 {
-  Field field = block->data()->field();
-  if (field.field_id("acceleration_x") < 0){
+  // as in get_integration_map_, field ids and map keys are looked up once
+  if (accel_handles_.empty()){
+    str_vec_t field_list = {"acceleration_x", "acceleration_y",
+                            "acceleration_z"};
+    accel_handles_.assign(field_list.begin(), field_list.end());
+    accel_keys_ = StringIndRdOnlyMap(field_list);
+  }
+
+  if (! accel_handles_[0].exists()){
     return EnzoEFltArrayMap();
   }
 
-  str_vec_t field_list = {"acceleration_x", "acceleration_y", "acceleration_z"};
-  std::vector<CelloView<enzo_float,3>> arrays
-    = {field.view<enzo_float>("acceleration_x"),
-       field.view<enzo_float>("acceleration_y"),
-       field.view<enzo_float>("acceleration_z")};
-  return EnzoEFltArrayMap("accel", field_list, arrays);
+  Field field = block->data()->field();
+  std::vector<CelloView<enzo_float,3>> arrays;
+  arrays.reserve(accel_handles_.size());
+  for (const FieldHandle& handle : accel_handles_){
+    arrays.push_back( handle.view<enzo_float>(field) );
+  }
+  return EnzoEFltArrayMap("accel", accel_keys_, arrays);
 }
 
 //----------------------------------------------------------------------
@@ -238,7 +272,8 @@ EnzoVlctScratchSpace* EnzoMethodMHDVlct::get_scratch_ptr_
 {
   if (scratch_space_ == nullptr){
     scratch_space_ = new EnzoVlctScratchSpace
-      (field_shape, integration_field_list_, primitive_field_list_,
+      (field_shape, integrator_->reconstructed_scratch_shape(field_shape),
+       integration_field_list_, primitive_field_list_,
        integrator_->dUcons_map_keys(), passive_list,
        enzo::fluid_props()->dual_energy_config().any_enabled());
   }
@@ -346,9 +381,120 @@ static void allocate_FC_flux_buffer_(Block * block) throw()
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
 
+  // neighbor fluxes are only received on faces with finer neighbors
+  bool neighbor_faces[3][2];
+  MethodFluxCorrect::correction_faces (block,neighbor_faces);
+
   // this needs to be allocated every cycle
   block->data()->flux_data()->allocate (nx,ny,nz,field_list,
-                                        true /* = single_flux_array */ );
+                                        true /* = single_flux_array */,
+                                        nullptr,nullptr,nullptr,
+                                        neighbor_faces);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMHDVlct::compute_predictor_region_
+(EnzoEFltArrayMap &external_integration_map, EnzoVlctScratchSpace *scratch,
+ const EnzoEFltArrayMap &accel_map, const str_vec_t &passive_list,
+ const std::array<int,3> &start, const std::array<int,3> &stop,
+ double cur_dt, const std::array<enzo_float,3> &cell_widths_xyz)
+  const noexcept
+{
+  // slices of cell-centered arrays, and of arrays that are face-centered
+  // along the given axis (these hold one fewer element along that axis)
+  const CSlice zc(start[0], stop[0]),  zf(start[0], stop[0]-1);
+  const CSlice yc(start[1], stop[1]),  yf(start[1], stop[1]-1);
+  const CSlice xc(start[2], stop[2]),  xf(start[2], stop[2]-1);
+
+  EnzoEFltArrayMap integration_map =
+    external_integration_map.subarray_map(zc, yc, xc);
+  EnzoEFltArrayMap out_integration_map =
+    scratch->temp_integration_map.subarray_map(zc, yc, xc);
+
+  std::array<EnzoEFltArrayMap, 3> flux_maps_xyz =
+    {scratch->xflux_map.subarray_map(zc, yc, xf),
+     scratch->yflux_map.subarray_map(zc, yf, xc),
+     scratch->zflux_map.subarray_map(zf, yc, xc)};
+
+  const EnzoEFltArrayMap sub_accel_map = (accel_map.size() == 0) ?
+    accel_map : accel_map.subarray_map(zc, yc, xc);
+
+  EFlt3DArray interface_vel_arr = (scratch->interface_vel_arr.is_null()) ?
+    scratch->interface_vel_arr :
+    scratch->interface_vel_arr.subarray(zc, yc, xc);
+
+  // when tiling, priml_map and primr_map are flat buffers that may be used
+  // for tiles of any region
+  const bool tiled = integrator_->tile_rows() > 0;
+
+  integrator_->compute_update_stage
+    (integration_map, integration_map, out_integration_map,
+     scratch->primitive_map.subarray_map(zc, yc, xc),
+     tiled ? scratch->priml_map : scratch->priml_map.subarray_map(zc, yc, xc),
+     tiled ? scratch->primr_map : scratch->primr_map.subarray_map(zc, yc, xc),
+     flux_maps_xyz,
+     scratch->dUcons_map.subarray_map(zc, yc, xc),
+     sub_accel_map, interface_vel_arr,
+     passive_list, nullptr, 0, cur_dt, 0, cell_widths_xyz);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodMHDVlct::compute_interior ( Block * block) throw()
+{
+  if (! block->is_leaf()) return;
+
+  // refer to the cached list of passive scalar names rather than copy it
+  const std::shared_ptr<const str_vec_t> passive_ptr =
+    lazy_passive_list_.get_list();
+  const str_vec_t & passive_list = *passive_ptr;
+  EnzoFieldStaging staging(block);
+  EnzoEFltArrayMap external_integration_map = get_integration_map_
+    (block, &passive_list, staging);
+
+  const std::array<int,3> shape = {external_integration_map.array_shape(0),
+                                   external_integration_map.array_shape(1),
+                                   external_integration_map.array_shape(2)};
+
+  // the interior reads every active cell; the results are valid for
+  // cells at least (ghost depth + stale) cells from the block edge
+  Field field = block->data()->field();
+  int gx, gy, gz;
+  field.ghost_depth(field.field_id("density"), &gx, &gy, &gz);
+  const std::array<int,3> g3 = {gz, gy, gx};
+  const int stale = integrator_->staling_from_stage(0);
+
+  std::array<int,3> start, stop;
+  for (int i = 0; i < 3; i++){
+    // fall back to the standard calculation if the interior is empty
+    if ((g3[i] == 0) || (shape[i] - 2*(g3[i] + stale) <= 0)) return;
+    start[i] = g3[i];
+    stop[i] = shape[i] - g3[i];
+  }
+
+  EnzoVlctScratchSpace * scratch;
+  if (free_scratch_.empty()) {
+    scratch = new EnzoVlctScratchSpace
+      (shape, integrator_->reconstructed_scratch_shape(shape),
+       integration_field_list_, primitive_field_list_,
+       integrator_->dUcons_map_keys(), passive_list,
+       enzo::fluid_props()->dual_energy_config().any_enabled());
+  } else {
+    scratch = free_scratch_.back();
+    free_scratch_.pop_back();
+  }
+  interior_scratch_[block] = scratch;
+
+  const std::array<enzo_float,3> cell_widths_xyz =
+    { enzo::block(block)->CellWidth[0],
+      enzo::block(block)->CellWidth[1],
+      enzo::block(block)->CellWidth[2],
+    };
+
+  compute_predictor_region_(external_integration_map, scratch,
+                            get_accel_map_(block), passive_list,
+                            start, stop, block->dt()/2., cell_widths_xyz);
 }
 
 //----------------------------------------------------------------------
@@ -362,24 +508,35 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
   if (store_fluxes_for_corrections_){ allocate_FC_flux_buffer_(block); }
 
   if (block->is_leaf()) {
-    // load the list of keys for the passively advected scalars
-    const str_vec_t passive_list = *(lazy_passive_list_.get_list());
+    // load the list of keys for the passively advected scalars (the list
+    // is cached by lazy_passive_list_, so it is referred to, not copied)
+    const std::shared_ptr<const str_vec_t> passive_ptr =
+      lazy_passive_list_.get_list();
+    const str_vec_t & passive_list = *passive_ptr;
 
     // initialize map that holds arrays wrapping the Cello Fields holding each
     // of the integration quantities. Additionally, this also includes
     // temporary arrays used to hold the specific form of the passive scalar
     //
     // by the very end of EnzoMethodMHDVlct::compute, the arrays in this map
-    // will be updated with their new values
+    // will be updated with their new values (fields stored with a precision
+    // other than enzo_float are staged, and are updated by write_back)
+    EnzoFieldStaging staging(block);
     EnzoEFltArrayMap external_integration_map = get_integration_map_
-      (block, &passive_list);
+      (block, &passive_list, staging);
 
     // get maps of arrays and stand-alone arrays that serve as scratch space.
     // (first, retrieve the pointer to the scratch space struct)
     const std::array<int,3> shape = {external_integration_map.array_shape(0),
                                      external_integration_map.array_shape(1),
                                      external_integration_map.array_shape(2)};
-    EnzoVlctScratchSpace* const scratch = get_scratch_ptr_(shape, passive_list);
+    //
+    // If compute_interior() was called for this block, use its scratch
+    // space, which already holds the predictor-stage interior
+    auto it_interior = interior_scratch_.find(block);
+    const bool is_interior_done = (it_interior != interior_scratch_.end());
+    EnzoVlctScratchSpace* const scratch = (is_interior_done) ?
+      it_interior->second : get_scratch_ptr_(shape, passive_list);
 
     // map used for storing integration values at the half time-step. This
     // includes key,array pairs for each entry in external_integration_map
@@ -465,14 +622,46 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
       EnzoEFltArrayMap out_integration_map =
         (is_final_stage) ? external_integration_map : temp_integration_map;
 
-      integrator_->compute_update_stage
-        (external_integration_map,  // holds values from start of the timestep
-         cur_stage_integration_map, // holds values from start of current stage
-         out_integration_map,       // where to write results of current stage
-         primitive_map, priml_map, primr_map,
-         flux_maps_xyz, dUcons_map, accel_map, interface_vel_arr,
-         passive_list, this->bfield_method_, stage_index,
-         cur_dt, stale_depth, cell_widths_xyz);
+      if (stage_index == 0 && is_interior_done) {
+        // only the shell of cells that depends on ghost zones remains:
+        // compute it as 6 slabs whose results don't overlap. Along axes
+        // already handled, slabs are limited to the interior
+        int gx, gy, gz;
+        Field field = block->data()->field();
+        field.ghost_depth(field.field_id("density"), &gx, &gy, &gz);
+        const std::array<int,3> g3 = {gz, gy, gx};
+        const int stale = integrator_->staling_from_stage(0);
+
+        for (int axis = 0; axis < 3; axis++) {
+          for (int face = 0; face < 2; face++) {
+            std::array<int,3> start, stop;
+            for (int i = 0; i < 3; i++){
+              if (i < axis) {
+                start[i] = g3[i];
+                stop[i] = shape[i] - g3[i];
+              } else if (i > axis) {
+                start[i] = 0;
+                stop[i] = shape[i];
+              } else {
+                start[i] = (face == 0) ? 0 : shape[i] - g3[i] - 2*stale;
+                stop[i]  = (face == 0) ? g3[i] + 2*stale : shape[i];
+              }
+            }
+            compute_predictor_region_(external_integration_map, scratch,
+                                      accel_map, passive_list,
+                                      start, stop, cur_dt, cell_widths_xyz);
+          }
+        }
+      } else {
+        integrator_->compute_update_stage
+          (external_integration_map,  // values from start of the timestep
+           cur_stage_integration_map, // values from start of current stage
+           out_integration_map,       // where to write results of stage
+           primitive_map, priml_map, primr_map,
+           flux_maps_xyz, dUcons_map, accel_map, interface_vel_arr,
+           passive_list, this->bfield_method_, stage_index,
+           cur_dt, stale_depth, cell_widths_xyz);
+      }
 
       // update the stale_depth from the current stage
       stale_depth += integrator_->staling_from_stage((int)stage_index);
@@ -494,6 +683,13 @@ void EnzoMethodMHDVlct::compute ( Block * block) throw()
       }
 
     }
+
+    if (is_interior_done) {
+      free_scratch_.push_back(scratch);
+      interior_scratch_.erase(it_interior);
+    }
+
+    staging.write_back();
   }
 
   block->compute_done();
@@ -555,8 +751,9 @@ double EnzoMethodMHDVlct::timestep ( Block * block ) throw()
 
   // Constructs a map containing the field data for each integration quantity
   // This includes each passively advected scalar (as densities)
+  EnzoFieldStaging staging(block);
   EnzoEFltArrayMap integration_map = get_integration_map_
-    (block, (lazy_passive_list_.get_list()).get());
+    (block, (lazy_passive_list_.get_list()).get(), staging);
 
   EnzoPhysicsFluidProps* fluid_props = enzo::fluid_props();
 
@@ -565,6 +762,7 @@ double EnzoMethodMHDVlct::timestep ( Block * block ) throw()
     // This is only strictly necessary after problem initialization and when
     // there is an inflow boundary condition
     fluid_props->apply_floor_to_energy_and_sync(integration_map, 0);
+    staging.write_back();
   }
 
   // Compute thermal pressure
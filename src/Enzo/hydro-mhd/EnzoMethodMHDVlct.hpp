@@ -67,7 +67,9 @@
 ///          to be reused while computing the flux along each dimesnion). While
 ///          computing the fluxes, the arrays are sliced so that they have the
 ///          same shape as xflux_map, yflux_map, or zflux_map (depending on the
-///          context).
+///          context). When the fluxes are computed one tile at a time (see
+///          the tile_rows parameter), they are instead flat buffers that
+///          only hold the reconstructed values for a single tile.
 ///        - For the purposes of these enumerated maps, we assume that the
 ///          length of a face-centered array along the dimension with
 ///          face-centering is 1 less than that of a cell-centered array
@@ -108,7 +110,14 @@ public: // interface
       integration_field_list_(),
       primitive_field_list_(),
       lazy_passive_list_(),
-      store_fluxes_for_corrections_(false)
+      integration_handles_(),
+      integration_keys_(),
+      accel_handles_(),
+      accel_keys_(),
+      store_fluxes_for_corrections_(false),
+      overlap_refresh_(false),
+      interior_scratch_(),
+      free_scratch_()
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -120,6 +129,14 @@ public: // interface
   /// Apply the method to advance a block one timestep 
   virtual void compute( Block * block) throw();
 
+  /// Whether the predictor-stage interior is computed during the refresh
+  virtual bool overlap_refresh () const throw()
+  { return overlap_refresh_; }
+
+  /// Compute the predictor stage for cells that don't depend on ghost
+  /// zones, storing the results in Block-specific scratch space
+  virtual void compute_interior( Block * block) throw();
+
   virtual std::string name () throw () 
   { return "mhd_vlct"; }
 
@@ -138,8 +155,12 @@ protected: // methods
   /// Constructs a map containing the field data for each integration quantity
   /// This includes all passively advected scalars (as densities) included in
   /// passive_list
+  ///
+  /// Fields that aren't stored with enzo_float precision are represented by
+  /// converted copies held by staging (which must outlive the map)
   EnzoEFltArrayMap get_integration_map_(Block * block,
-                                        const str_vec_t *passive_list)
+                                        const str_vec_t *passive_list,
+                                        EnzoFieldStaging & staging)
     const noexcept;
 
   /// Saves the fluxes (for a given dimension, `dim`), computed at the faces
@@ -164,6 +185,10 @@ protected: // methods
   (Block * block, const EnzoEFltArrayMap &flux_map, int dim, double cell_width,
    double dt) const noexcept;
 
+  /// Constructs a map wrapping the acceleration fields, or an empty map if
+  /// they aren't defined (the gravity source term is then not included)
+  EnzoEFltArrayMap get_accel_map_(Block * block) const noexcept;
+
   /// Returns a pointer to the scratch space struct. If the scratch space has
   /// not already been allocated, it will be allocated now.
   ///
@@ -178,6 +203,20 @@ protected: // methods
 					 const str_vec_t& passive_list)
     noexcept;
 
+  /// Computes the predictor stage over a subregion of the block
+  ///
+  /// The region, given as cell-centered ``start`` and ``stop`` indices
+  /// ordered as (z,y,x), includes the cells the calculation reads. The
+  /// results are only written to ``scratch->temp_integration_map`` for
+  /// cells that are at least ``integrator_->staling_from_stage(0)`` cells
+  /// from the edges of the region.
+  void compute_predictor_region_
+  (EnzoEFltArrayMap &external_integration_map, EnzoVlctScratchSpace *scratch,
+   const EnzoEFltArrayMap &accel_map, const str_vec_t &passive_list,
+   const std::array<int,3> &start, const std::array<int,3> &stop,
+   double cur_dt, const std::array<enzo_float,3> &cell_widths_xyz)
+    const noexcept;
+
 protected: // attributes
 
   /// Specifies the time_integration approach
@@ -208,8 +247,29 @@ protected: // attributes
   /// Lazy initializer of the list of fields holding passive scalars
   EnzoLazyPassiveScalarFieldList lazy_passive_list_;
 
+  /// Handles and map keys of the integration fields followed by the passive
+  /// scalars, built by get_integration_map_ on first use (not packed)
+  mutable std::vector<FieldHandle> integration_handles_;
+  mutable StringIndRdOnlyMap integration_keys_;
+
+  /// Handles and map keys of the acceleration fields, built by
+  /// get_accel_map_ on first use (not packed)
+  mutable std::vector<FieldHandle> accel_handles_;
+  mutable StringIndRdOnlyMap accel_keys_;
+
   /// Indicates whether fluxes should be stored for flux corrections
   bool store_fluxes_for_corrections_;
+
+  /// Indicates whether the predictor-stage interior is computed while
+  /// ghost zones are refreshed
+  bool overlap_refresh_;
+
+  /// Scratch space of Blocks whose predictor-stage interior has been
+  /// computed by compute_interior() but that haven't called compute()
+  std::map<Block *, EnzoVlctScratchSpace *> interior_scratch_;
+
+  /// Scratch space released by compute() for reuse by other Blocks
+  std::vector<EnzoVlctScratchSpace *> free_scratch_;
 };
 
 
@@ -226,6 +286,10 @@ public:
   ///
   /// @param[in] shape Gives the shape, including ghost-zones, of a hydro
   ///     cell-centered field, ordered as (mz,my,mx)
+  /// @param[in] recon_shape Gives the shape of the arrays in ``priml_map``
+  ///     and ``primr_map``. This should be returned by the
+  ///     ``reconstructed_scratch_shape`` method of
+  ///     ``EnzoMHDIntegratorStageCommands``.
   /// @param[in] integration_key_list List of keys (in the desired order) that
   ///     are associated with each actively-advected cell-centered integration
   ///     quantity. These are used to initialize ``temp_integration_map`` and
@@ -242,6 +306,7 @@ public:
   /// @param[in] dual_energy Indicates whether the dual energy formalism is in
   ///     use (which specifies if relevant scratch-space should be allocated).
   EnzoVlctScratchSpace(const std::array<int,3>& shape,
+                       const std::array<int,3>& recon_shape,
                        const str_vec_t& integration_key_list,
                        const str_vec_t& primitive_key_list,
                        const str_vec_t& integ_updater_keys,
@@ -251,25 +316,26 @@ public:
 			: EFlt3DArray())
   {
     // define function to setup the arraymaps
-    auto setup = [&shape, &passive_list](const std::string& name,
-                                         const std::array<int,3>& centering,
-                                         const str_vec_t& main_keys){
+    auto setup = [&passive_list](const std::string& name,
+                                 const std::array<int,3>& base_shape,
+                                 const std::array<int,3>& centering,
+                                 const str_vec_t& main_keys){
       str_vec_t all_keys(main_keys); // deepcopy of main_keys
       all_keys.insert(all_keys.end(), passive_list.begin(), passive_list.end());
-      std::array<int,3> cur_shape(shape); // deepcopy of shape
+      std::array<int,3> cur_shape(base_shape); // deepcopy of shape
       for (std::size_t i = 0; i<3; i++){ cur_shape[i] += centering[i]; }
       return EnzoEFltArrayMap(name, all_keys, cur_shape);
     };
 
-    temp_integration_map = setup("temp_integration", {0,0,0},
+    temp_integration_map = setup("temp_integration", shape, {0,0,0},
                                  integration_key_list);
-    xflux_map = setup("xflux", { 0, 0,-1}, integration_key_list);
-    yflux_map = setup("yflux", { 0,-1, 0}, integration_key_list);
-    zflux_map = setup("zflux", {-1, 0, 0}, integration_key_list);
-    dUcons_map = setup("dUcons", {0,0,0}, integ_updater_keys);
-    primitive_map = setup("primitive", {0,0,0}, primitive_key_list);
-    priml_map = setup("priml", {0,0,0}, primitive_key_list);
-    primr_map = setup("primr", {0,0,0}, primitive_key_list);
+    xflux_map = setup("xflux", shape, { 0, 0,-1}, integration_key_list);
+    yflux_map = setup("yflux", shape, { 0,-1, 0}, integration_key_list);
+    zflux_map = setup("zflux", shape, {-1, 0, 0}, integration_key_list);
+    dUcons_map = setup("dUcons", shape, {0,0,0}, integ_updater_keys);
+    primitive_map = setup("primitive", shape, {0,0,0}, primitive_key_list);
+    priml_map = setup("priml", recon_shape, {0,0,0}, primitive_key_list);
+    primr_map = setup("primr", recon_shape, {0,0,0}, primitive_key_list);
   }
 
 public: // attributes
@@ -297,6 +363,10 @@ public: // attributes
   ///   - y and have shape (  mz,my-1,  mx)
   ///   - x and have shape (  mz,  my,mx-1)
   /// where (mz,my,mx) is the shape of an cell-centered array.
+  ///
+  /// When fluxes are computed one tile at a time, these instead hold flat
+  /// arrays (of shape (1,1,n)) that only need to be big enough for a
+  /// single tile, and are reused for each tile.
   EnzoEFltArrayMap priml_map, primr_map;
 
   /// Maps of arrays that are used to store the x, y, and z fluxes. If a
@@ -8,8 +8,7 @@
 #include "Cello/cello.hpp"
 #include "Enzo/enzo.hpp"
 #include "Enzo/hydro-mhd/hydro-mhd.hpp"
-
-#include "Enzo/hydro-mhd/ppm_fortran/ppm_fortran.hpp" // FORTRAN_NAME(calc_dt)
+#include "Enzo/gravity/gravity.hpp" // EnzoMethodGravity
 
 // #define DEBUG_PPM
 // #define COPY_FIELDS_TO_OUTPUT
@@ -50,7 +49,8 @@ EnzoMethodPpm::EnzoMethodPpm (bool store_fluxes_for_corrections,
                                   ("use_minimum_pressure_support",false)),
     minimum_pressure_support_parameter_(p.value_integer
                                         ("minimum_pressure_support_parameter",
-                                         100))
+                                         100)),
+    acceleration_cached_(false)
 {
   this->set_courant(p.value_float("courant",1.0));
 
@@ -99,9 +99,6 @@ EnzoMethodPpm::EnzoMethodPpm (bool store_fluxes_for_corrections,
   refresh->add_field("total_energy");
   refresh->add_field("internal_energy");
   refresh->add_field("pressure");
-  refresh->add_field("acceleration_x");
-  refresh->add_field("acceleration_y");
-  refresh->add_field("acceleration_z");
 
   // add all color fields to refresh
   refresh->add_all_fields("color");
@@ -111,6 +108,23 @@ EnzoMethodPpm::EnzoMethodPpm (bool store_fluxes_for_corrections,
 
 //----------------------------------------------------------------------
 
+void EnzoMethodPpm::initialize_fields (bool overlap) throw()
+{
+  // PPM updates ghost zones up to three layers deep
+
+  acceleration_cached_ =
+    (EnzoMethodGravity::acceleration_cache(name(),3) != nullptr);
+
+  if (! acceleration_cached_) {
+    Refresh * refresh = cello::refresh(ir_post_);
+    refresh->add_field("acceleration_x");
+    refresh->add_field("acceleration_y");
+    refresh->add_field("acceleration_z");
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodPpm::pup (PUP::er &p)
 {
   // NOTE: change this function whenever attributes change
@@ -127,6 +141,7 @@ void EnzoMethodPpm::pup (PUP::er &p)
   p | steepening_;
   p | use_minimum_pressure_support_;
   p | minimum_pressure_support_parameter_;
+  p | acceleration_cached_;
 }
 
 //----------------------------------------------------------------------
@@ -162,13 +177,23 @@ void EnzoMethodPpm::compute ( Block * block) throw()
 
     int nx,ny,nz;
     field.size(&nx,&ny,&nz);
-    block->data()->flux_data()->allocate(nx,ny,nz,field_list,single_flux_array);
+    // neighbor fluxes are only received on faces with finer neighbors
+    bool neighbor_faces[3][2];
+    MethodFluxCorrect::correction_faces (block,neighbor_faces);
+    block->data()->flux_data()->allocate(nx,ny,nz,field_list,single_flux_array,
+                                         nullptr,nullptr,nullptr,
+                                         neighbor_faces);
   }
 
   if (block->is_leaf()) {
 
     EnzoBlock * enzo_block = enzo::block(block);
 
+    if (acceleration_cached_) {
+      static_cast<EnzoMethodGravity*>(enzo::problem()->method("gravity"))
+        ->update_accelerations(block);
+    }
+
     // (this should go in interpolation / restriction not here)
     //
     // // restore energy consistency if dual energy formalism used
@@ -283,27 +308,9 @@ double EnzoMethodPpm::timestep ( Block * block ) throw()
 
   /* calculate minimum timestep */
 
-  int pressure_free_int = pressure_free_;
-
-  FORTRAN_NAME(calc_dt)(&rank,
-			enzo_block->GridDimension,
-			enzo_block->GridDimension+1,
-			enzo_block->GridDimension+2,
-			enzo_block->GridStartIndex,
-			enzo_block->GridEndIndex,
-			enzo_block->GridStartIndex+1,
-			enzo_block->GridEndIndex+1,
-			enzo_block->GridStartIndex+2,
-			enzo_block->GridEndIndex+2,
-			&enzo_block->CellWidth[0],
-			&enzo_block->CellWidth[1],
-			&enzo_block->CellWidth[2],
-			&gamma, &pressure_free_int, &cosmo_a,
-			density, pressure,
-			velocity_x,
-			velocity_y,
-			velocity_z,
-			&dtBaryons);
+  dtBaryons = timestep_courant_
+    (enzo_block, gamma, cosmo_a, density, pressure,
+     velocity_x, velocity_y, velocity_z);
 
   TRACE1 ("dtBaryons: %f",dtBaryons);
 
@@ -313,3 +320,76 @@ double EnzoMethodPpm::timestep ( Block * block ) throw()
 
   return dt;
 }
+
+//----------------------------------------------------------------------
+
+enzo_float EnzoMethodPpm::timestep_courant_
+(EnzoBlock * enzo_block, enzo_float gamma, enzo_float cosmo_a,
+ const enzo_float * d, const enzo_float * p,
+ const enzo_float * u, const enzo_float * v, const enzo_float * w)
+  const throw()
+{
+  // Courant condition over the active cells, as formerly computed by
+  // calc_dt.F (including its rounding to single precision for rank <
+  // 3), with the minimum along each row of x accumulated in a local
+  // variable so the inner loops can be vectorized
+
+  const int rank = cello::rank();
+  const int mx = enzo_block->GridDimension[0];
+  const int my = enzo_block->GridDimension[1];
+  const int * i1 = enzo_block->GridStartIndex;
+  const int * i2 = enzo_block->GridEndIndex;
+  const enzo_float dx = enzo_block->CellWidth[0];
+  const enzo_float dy = enzo_block->CellWidth[1];
+  const enzo_float dz = enzo_block->CellWidth[2];
+
+  const enzo_float tiny = 1e-20;
+  const bool pressure_free = pressure_free_;
+
+  enzo_float dt = 1e20;
+
+  const int iz_start = (rank >= 3) ? i1[2] : 0;
+  const int iz_stop  = (rank >= 3) ? i2[2] : 0;
+  const int iy_start = (rank >= 2) ? i1[1] : 0;
+  const int iy_stop  = (rank >= 2) ? i2[1] : 0;
+
+  for (int iz=iz_start; iz<=iz_stop; iz++) {
+    for (int iy=iy_start; iy<=iy_stop; iy++) {
+      const int i0 = mx*(iy + my*iz);
+      enzo_float dt_row = dt;
+      if (rank == 1) {
+        for (int ix=i1[0]; ix<=i2[0]; ix++) {
+          const int i = i0 + ix;
+          const enzo_float cs = pressure_free ?
+            tiny : std::max(std::sqrt(gamma*p[i]/d[i]), tiny);
+          dt_row = std::min
+            (dt_row, enzo_float(float(dx*cosmo_a/(cs + std::fabs(u[i])))));
+        }
+      } else if (rank == 2) {
+        for (int ix=i1[0]; ix<=i2[0]; ix++) {
+          const int i = i0 + ix;
+          const enzo_float cs = pressure_free ?
+            tiny : std::max(std::sqrt(gamma*p[i]/d[i]), tiny);
+          // Godunov's formula (to make sure ppm works with 0.8)
+          dt_row = std::min
+            (dt_row, enzo_float(float(cosmo_a/((cs + std::fabs(u[i]))/dx +
+                                               (cs + std::fabs(v[i]))/dy))));
+        }
+      } else {
+        for (int ix=i1[0]; ix<=i2[0]; ix++) {
+          const int i = i0 + ix;
+          const enzo_float cs = pressure_free ?
+            tiny : std::max(std::sqrt(gamma*p[i]/d[i]), tiny);
+          // Godunov's formula
+          dt_row = std::min
+            (dt_row, cosmo_a/((cs + std::fabs(u[i]))/dx +
+                              (cs + std::fabs(v[i]))/dy +
+                              (cs + std::fabs(w[i]))/dz));
+        }
+      }
+      dt = std::min(dt, dt_row);
+    }
+  }
+
+  return dt;
+}
@@ -32,7 +32,8 @@ public: // interface
       pressure_free_(false),
       steepening_(false),
       use_minimum_pressure_support_(false),
-      minimum_pressure_support_parameter_(0.0)
+      minimum_pressure_support_parameter_(0.0),
+      acceleration_cached_(false)
   {}
 
   /// CHARM++ Pack / Unpack function
@@ -57,6 +58,14 @@ private:
                                  bool use_minimum_pressure_support,
                                  enzo_float minimum_pressure_support_parameter);
 
+  /// Return the minimum timestep over active cells allowed by the
+  /// Courant condition, without the Courant safety factor
+  enzo_float timestep_courant_ (EnzoBlock * enzo_block,
+                                enzo_float gamma, enzo_float cosmo_a,
+                                const enzo_float * d, const enzo_float * p,
+                                const enzo_float * u, const enzo_float * v,
+                                const enzo_float * w) const throw();
+
 public: // virtual methods
 
   /// Apply the method to advance a block one timestep 
@@ -65,6 +74,9 @@ public: // virtual methods
   virtual std::string name () throw () 
   { return "ppm"; }
 
+  /// Refresh accelerations unless a preceding gravity Method caches them
+  virtual void initialize_fields (bool overlap) throw();
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
@@ -82,6 +94,10 @@ protected: // interface
   // PhysicsFluidProps or EnzoFluidFloorsConfig
   bool use_minimum_pressure_support_;
   enzo_float minimum_pressure_support_parameter_;
+
+  /// Whether accelerations are read from the preceding gravity
+  /// Method's cache instead of being refreshed
+  bool acceleration_cached_;
 };
 
 #endif /* ENZO_ENZO_METHOD_PPM_HPP */
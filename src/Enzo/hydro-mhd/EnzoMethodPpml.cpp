@@ -17,7 +17,8 @@
 
 EnzoMethodPpml::EnzoMethodPpml(ParameterGroup p)
   : Method(),
-    comoving_coordinates_(enzo::cosmology() != nullptr)
+    comoving_coordinates_(enzo::cosmology() != nullptr),
+    scratch_()
 {
   // Initialize the default Refresh object
   cello::simulation()->refresh_set_name(ir_post_,name());
@@ -63,7 +64,7 @@ void EnzoMethodPpml::compute ( Block * block ) throw()
 
   EnzoBlock * enzo_block = enzo::block(block);
 
-  EnzoMethodPpml::SolveMHDEquations ( *enzo_block, block->dt() );
+  SolveMHDEquations ( *enzo_block, block->dt() );
 
   enzo_block->compute_done();
 
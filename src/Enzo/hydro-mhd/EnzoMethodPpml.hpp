@@ -25,7 +25,8 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodPpml (CkMigrateMessage *m)
     : Method (m),
-      comoving_coordinates_(false)
+      comoving_coordinates_(false),
+      scratch_()
   {}
 
   /// CHARM++ Pack / Unpack function
@@ -42,16 +43,18 @@ public: // interface
 
 private:
 
-  /// This method does most of the heavy-lifting
-  ///
-  /// @note
-  /// This is only a static method for historical reasons. Feel free to better
-  /// integrate this with the rest of the class
-  static int SolveMHDEquations( EnzoBlock& block, enzo_float dt );
+  /// This method does most of the heavy-lifting.  Block fields are
+  /// passed to the solver in place; its work arrays are kept in
+  /// scratch_ between calls
+  int SolveMHDEquations( EnzoBlock& block, enzo_float dt );
 
 protected: // interface
 
   bool comoving_coordinates_;
+
+  /// Work arrays for the PPML solver, reused by all Blocks on this
+  /// process (not packed)
+  std::vector<enzo_float> scratch_;
 };
 
 #endif /* ENZO_ENZO_METHOD_PPML_HPP */
@@ -20,7 +20,7 @@
 /// When this function was first ported to Enzo-E, it was an instance method of
 /// the EnzoBlock class. However as the codebase has matured, it has become
 /// customary for integrators to be encapsulated by Method Objects. As such
-/// this function has been converted to a static method of EnzoMethodPpml.
+/// this function has been converted to a method of EnzoMethodPpml.
 ///
 /// In the future, it probably makes sense to consolidate this file with
 /// EnzoMethodPpml.cpp (this consolidation has been left to a separate PR from
@@ -173,10 +173,11 @@ int EnzoMethodPpml::SolveMHDEquations( EnzoBlock& block, enzo_float dt )
       GridGlobalStart[i] = 0;
     }
 
-    /* allocate temporary space for solver */
+    /* reuse temporary space for solver between calls */
 
     int k = 0;
-    enzo_float *temp = new enzo_float[size*(31)];
+    if (scratch_.size() < size_t(size*31)) scratch_.resize(size*31);
+    enzo_float *temp = scratch_.data();
     enzo_float *f1 = &temp[k*size];  k++;
     enzo_float *f2 = &temp[k*size];  k++;
     enzo_float *f3 = &temp[k*size];  k++;
@@ -373,10 +374,6 @@ int EnzoMethodPpml::SolveMHDEquations( EnzoBlock& block, enzo_float dt )
 	 h1,h2,h3,h4,h5,h6,h7,
 	 ex,ey,ez,
 	 qu1,qu2,qu3,qu4,qu5,qu6,qu7);
-    /* deallocate temporary space for solver */
-
-    delete [] temp;
-
     delete [] leftface;
 
   }  // end: if (field.num_permanent() > 0)
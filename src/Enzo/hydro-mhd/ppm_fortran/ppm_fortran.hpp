@@ -10,14 +10,6 @@
 
 #include "Enzo/enzo.hpp" // enzo_float, FORTRAN_NAME
 
-extern "C" void FORTRAN_NAME(calc_dt)
-  (int *rank, int *idim, int *jdim, int *kdim,
-   int *i1, int *i2, int *j1, int *j2, int *k1, int *k2,
-   enzo_float *dx, enzo_float *dy, enzo_float *dz,
-   enzo_float *gamma, int *ipfree, enzo_float *aye,
-   enzo_float *d, enzo_float *p, enzo_float *u, enzo_float *v, enzo_float *w,
-   enzo_float *dt);
-
 extern "C" void FORTRAN_NAME(ppm_de)
   (enzo_float *d, enzo_float *E, enzo_float *u, enzo_float *v, enzo_float *w,
    enzo_float *ge,
@@ -235,45 +235,16 @@ public: // fields
 
 public: // methods
 
-  FORCE_INLINE void operator()(const int iz,
-                               const int iy,
-                               const int ix) const noexcept
+  /// Computes the fluxes at a single cell interface from the left and right
+  /// reconstructed primitives (see `EnzoRiemannImpl` for details)
+  FORCE_INLINE void interface_flux(const lutarray<LUT> &prim_l,
+                                   const lutarray<LUT> &prim_r,
+                                   lutarray<LUT> &flux,
+                                   enzo_float &internal_energy_flux,
+                                   enzo_float &velocity_i_bar) const noexcept
   {
-    const int external_velocity_i = config.dim + LUT::velocity_i;
-    const int external_velocity_j = ((config.dim+1)%3) + LUT::velocity_i;
-    const int external_velocity_k = ((config.dim+2)%3) + LUT::velocity_i;
-    const int external_bfield_i = config.dim + LUT::bfield_i;
-    const int external_bfield_j = ((config.dim+1)%3) + LUT::bfield_i;
-    const int external_bfield_k = ((config.dim+2)%3) + LUT::bfield_i;
-
-    // load primitives into local variables
-    lutarray<LUT> prim_l;
-    prim_l[LUT::density]     = config.prim_arr_l(LUT::density,iz,iy,ix);
-    prim_l[LUT::velocity_i]  = config.prim_arr_l(external_velocity_i,iz,iy,ix);
-    prim_l[LUT::velocity_j]  = config.prim_arr_l(external_velocity_j,iz,iy,ix);
-    prim_l[LUT::velocity_k]  = config.prim_arr_l(external_velocity_k,iz,iy,ix);
-    if (LUT::has_bfields){
-      prim_l[LUT::bfield_i]  = config.prim_arr_l(external_bfield_i,iz,iy,ix);
-      prim_l[LUT::bfield_j]  = config.prim_arr_l(external_bfield_j,iz,iy,ix);
-      prim_l[LUT::bfield_k]  = config.prim_arr_l(external_bfield_k,iz,iy,ix);
-    }
-    // this actually stores pressure:
-    prim_l[LUT::total_energy]= config.prim_arr_l(LUT::total_energy,iz,iy,ix);
-
-    lutarray<LUT> prim_r;
-    prim_r[LUT::density]     = config.prim_arr_r(LUT::density,iz,iy,ix);
-    prim_r[LUT::velocity_i]  = config.prim_arr_r(external_velocity_i,iz,iy,ix);
-    prim_r[LUT::velocity_j]  = config.prim_arr_r(external_velocity_j,iz,iy,ix);
-    prim_r[LUT::velocity_k]  = config.prim_arr_r(external_velocity_k,iz,iy,ix);
-    if (LUT::has_bfields){
-      prim_r[LUT::bfield_i]  = config.prim_arr_r(external_bfield_i,iz,iy,ix);
-      prim_r[LUT::bfield_j]  = config.prim_arr_r(external_bfield_j,iz,iy,ix);
-      prim_r[LUT::bfield_k]  = config.prim_arr_r(external_bfield_k,iz,iy,ix);
-    }
-    // this actually stores pressure:
-    prim_r[LUT::total_energy]= config.prim_arr_r(LUT::total_energy,iz,iy,ix);
-
-    // load left and right pressure values
+    // load left and right pressure values (the total_energy entries of the
+    // reconstructed primitives actually store pressure)
     const enzo_float pressure_l = prim_l[LUT::total_energy];
     const enzo_float pressure_r = prim_r[LUT::total_energy];
 
@@ -302,30 +273,18 @@ public: // methods
 
     // Compute the actual riemann fluxes
     // (we'll address dual energy considerations, afterwards)
-    lutarray<LUT> flux;
     for (std::size_t field = 0; field < LUT::num_entries; field++){
       flux[field] = ((bp*flux_l[field] - bm*flux_r[field] +
                       (cons_r[field] - cons_l[field])*bp*bm) * inv_speed_diff);
     }
 
-    config.flux_arr(LUT::density,iz,iy,ix) = flux[LUT::density];
-    config.flux_arr(external_velocity_i,iz,iy,ix) = flux[LUT::velocity_i];
-    config.flux_arr(external_velocity_j,iz,iy,ix) = flux[LUT::velocity_j];
-    config.flux_arr(external_velocity_k,iz,iy,ix) = flux[LUT::velocity_k];
-    if (LUT::has_bfields){
-      config.flux_arr(external_bfield_i,iz,iy,ix) = flux[LUT::bfield_i];
-      config.flux_arr(external_bfield_j,iz,iy,ix) = flux[LUT::bfield_j];
-      config.flux_arr(external_bfield_k,iz,iy,ix) = flux[LUT::bfield_k];
-    }
-    config.flux_arr(LUT::total_energy,iz,iy,ix) = flux[LUT::total_energy];
-
     // finally, deal with dual energy stuff.
     // compute internal energy flux, assuming passive advection
     // (this was not handled with the rest of the fluxes)
-    config.internal_energy_flux_arr(iz,iy,ix) =
+    internal_energy_flux =
       enzo_riemann_utils::passive_eint_flux
       (prim_l[LUT::density], pressure_l, prim_r[LUT::density], pressure_r,
-       config.eos, config.flux_arr(LUT::density,iz,iy,ix));
+       config.eos, flux[LUT::density]);
 
     // Estimate the value of the vi (ith component of velocity) which is used
     // to compute the internal energy source term. The following is adopted
@@ -335,7 +294,7 @@ public: // methods
     //   - otherwise linearly interpolate between vi_L and vi_R. Let the cell
     //     interface be at x=0. At some time t, the velocity is vi_L at x=t*bm
     //     and vi_R at x=t*bp. The factors of t cancel.
-    config.velocity_i_bar_arr(iz,iy,ix) =
+    velocity_i_bar =
       (bp*prim_l[LUT::velocity_i]
        - bm*prim_r[LUT::velocity_i]) * inv_speed_diff;
     // Alternatively, if vi is assumed to be constant in the intermediate zone
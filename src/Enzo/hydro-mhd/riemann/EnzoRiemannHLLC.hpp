@@ -31,33 +31,16 @@ public: // fields
 
 public: // methods
 
-  FORCE_INLINE void operator()(const int iz,
-                               const int iy,
-                               const int ix) const noexcept
+  /// Computes the fluxes at a single cell interface from the left and right
+  /// reconstructed primitives (see `EnzoRiemannImpl` for details)
+  FORCE_INLINE void interface_flux(const lutarray<LUT> &prim_l,
+                                   const lutarray<LUT> &prim_r,
+                                   lutarray<LUT> &flux,
+                                   enzo_float &internal_energy_flux,
+                                   enzo_float &velocity_i_bar) const noexcept
   {
-
-    const int external_velocity_i = config.dim + LUT::velocity_i;
-    const int external_velocity_j = ((config.dim+1)%3) + LUT::velocity_i;
-    const int external_velocity_k = ((config.dim+2)%3) + LUT::velocity_i;
-
-    // load primitives into local variables
-    lutarray<LUT> prim_l;
-    prim_l[LUT::density]     = config.prim_arr_l(LUT::density,iz,iy,ix);
-    prim_l[LUT::velocity_i]  = config.prim_arr_l(external_velocity_i,iz,iy,ix);
-    prim_l[LUT::velocity_j]  = config.prim_arr_l(external_velocity_j,iz,iy,ix);
-    prim_l[LUT::velocity_k]  = config.prim_arr_l(external_velocity_k,iz,iy,ix);
-    // this actually stores pressure:
-    prim_l[LUT::total_energy]= config.prim_arr_l(LUT::total_energy,iz,iy,ix);
-
-    lutarray<LUT> prim_r;
-    prim_r[LUT::density]     = config.prim_arr_r(LUT::density,iz,iy,ix);
-    prim_r[LUT::velocity_i]  = config.prim_arr_r(external_velocity_i,iz,iy,ix);
-    prim_r[LUT::velocity_j]  = config.prim_arr_r(external_velocity_j,iz,iy,ix);
-    prim_r[LUT::velocity_k]  = config.prim_arr_r(external_velocity_k,iz,iy,ix);
-    // this actually stores pressure:
-    prim_r[LUT::total_energy]= config.prim_arr_r(LUT::total_energy,iz,iy,ix);
-
-    // load left and right pressure values
+    // load left and right pressure values (the total_energy entries of the
+    // reconstructed primitives actually store pressure)
     const enzo_float pressure_l = prim_l[LUT::total_energy];
     const enzo_float pressure_r = prim_r[LUT::total_energy];
 
@@ -143,29 +126,29 @@ public: // methods
 	   + pressure_r * prim_r[LUT::velocity_i]);
 
     // compute HLLC Flux at interface (without diffusion)
-    config.flux_arr(LUT::density,iz,iy,ix) = sl*dfl + sr*dfr;
-    config.flux_arr(external_velocity_i,iz,iy,ix) = sl*ufl + sr*ufr;
-    config.flux_arr(external_velocity_j,iz,iy,ix) = sl*vfl + sr*vfr;
-    config.flux_arr(external_velocity_k,iz,iy,ix) = sl*wfl + sr*wfr;
-    config.flux_arr(LUT::total_energy,iz,iy,ix) = sl*efl + sr*efr;
+    flux[LUT::density] = sl*dfl + sr*dfr;
+    flux[LUT::velocity_i] = sl*ufl + sr*ufr;
+    flux[LUT::velocity_j] = sl*vfl + sr*vfr;
+    flux[LUT::velocity_k] = sl*wfl + sr*wfr;
+    flux[LUT::total_energy] = sl*efl + sr*efr;
 
     // Add the weighted contribution of the flux along the contact for
     // velocity_i and total_energy
     // (if you break 10.44 into 2 fractions, we are adding the right one)
-    config.flux_arr(external_velocity_i,iz,iy,ix) += (sm * cp);
-    config.flux_arr(LUT::total_energy,iz,iy,ix) += (sm * cp * cw);
+    flux[LUT::velocity_i] += (sm * cp);
+    flux[LUT::total_energy] += (sm * cp * cw);
 
 
     // finally, deal with dual energy stuff:
     // compute passive advection internal energy flux
-    config.internal_energy_flux_arr(iz,iy,ix) =
+    internal_energy_flux =
       enzo_riemann_utils::passive_eint_flux
       (prim_l[LUT::density], pressure_l, prim_r[LUT::density], pressure_r,
-       config.eos, config.flux_arr(LUT::density,iz,iy,ix));
+       config.eos, flux[LUT::density]);
 
     // An aside: compute the interface velocity (this is used to compute the
     // internal energy source term)
-    config.velocity_i_bar_arr(iz,iy,ix) =
+    velocity_i_bar =
       (sl * (prim_l[LUT::velocity_i] - bm) +
        sr * (prim_r[LUT::velocity_i] - bp));
 
@@ -37,52 +37,25 @@ public: // fields
 
 public: // methods
 
-  FORCE_INLINE void operator()(const int iz,
-                               const int iy,
-                               const int ix) const noexcept
+  /// Computes the fluxes at a single cell interface from the left and right
+  /// reconstructed primitives (see `EnzoRiemannImpl` for details)
+  FORCE_INLINE void interface_flux(const lutarray<LUT> &wli,
+                                   const lutarray<LUT> &wri,
+                                   lutarray<LUT> &flxi,
+                                   enzo_float &internal_energy_flux,
+                                   enzo_float &velocity_i_bar) const noexcept
   {
-    const int external_velocity_i = config.dim + LUT::velocity_i;
-    const int external_velocity_j = ((config.dim+1)%3) + LUT::velocity_i;
-    const int external_velocity_k = ((config.dim+2)%3) + LUT::velocity_i;
-    const int external_bfield_i = config.dim + LUT::bfield_i;
-    const int external_bfield_j = ((config.dim+1)%3) + LUT::bfield_i;
-    const int external_bfield_k = ((config.dim+2)%3) + LUT::bfield_i;
-
     const enzo_float gamma = config.eos.get_gamma();
     const enzo_float igm1 = 1.0 / (gamma - 1.0);
 
-    lutarray<LUT> flxi;      // temporary variable to store flux
-    lutarray<LUT> wli, wri;  // Left, Right reconstructed primitive
     enzo_float spd[5];       // signal speeds, left to right
 
     Cons1D ul,ur;                 // L/R states, conserved variables (computed)
     Cons1D ulst,uldst,urdst,urst; // Conserved variable for all states
     Cons1D fl,fr;                 // Fluxes for left & right states
 
-    //--- Step 1.  Load L/R states into local variables
-
-    wli[LUT::density]      = config.prim_arr_l(LUT::density,iz,iy,ix);
-    wli[LUT::velocity_i]   = config.prim_arr_l(external_velocity_i,iz,iy,ix);
-    wli[LUT::velocity_j]   = config.prim_arr_l(external_velocity_j,iz,iy,ix);
-    wli[LUT::velocity_k]   = config.prim_arr_l(external_velocity_k,iz,iy,ix);
-    wli[LUT::bfield_i]     = config.prim_arr_l(external_bfield_i,iz,iy,ix);
-    wli[LUT::bfield_j]     = config.prim_arr_l(external_bfield_j,iz,iy,ix);
-    wli[LUT::bfield_k]     = config.prim_arr_l(external_bfield_k,iz,iy,ix);
-    // the following actually stores pressure, not total_energy
-    wli[LUT::total_energy] = config.prim_arr_l(LUT::total_energy,iz,iy,ix);
-
-    wri[LUT::density]      = config.prim_arr_r(LUT::density,iz,iy,ix);
-    wri[LUT::velocity_i]   = config.prim_arr_r(external_velocity_i,iz,iy,ix);
-    wri[LUT::velocity_j]   = config.prim_arr_r(external_velocity_j,iz,iy,ix);
-    wri[LUT::velocity_k]   = config.prim_arr_r(external_velocity_k,iz,iy,ix);
-    wri[LUT::bfield_i]     = config.prim_arr_r(external_bfield_i,iz,iy,ix);
-    wri[LUT::bfield_j]     = config.prim_arr_r(external_bfield_j,iz,iy,ix);
-    wri[LUT::bfield_k]     = config.prim_arr_r(external_bfield_k,iz,iy,ix);
-    // the following actually stores pressure, not total_energy
-    wri[LUT::total_energy] = config.prim_arr_r(LUT::total_energy,iz,iy,ix);
-
-
-    // load left and right pressure values
+    //--- Step 1.  Load L/R pressures (the total_energy entries of the
+    //             reconstructed primitives actually store pressure)
     const enzo_float pressure_l = wli[LUT::total_energy];
     const enzo_float pressure_r = wri[LUT::total_energy];
 
@@ -394,22 +367,15 @@ public: // methods
       flxi[LUT::bfield_k] = fr.bz + urst.bz;
     }
 
-    config.flux_arr(LUT::density,iz,iy,ix) = flxi[LUT::density];
-    config.flux_arr(external_velocity_i,iz,iy,ix) = flxi[LUT::velocity_i];
-    config.flux_arr(external_velocity_j,iz,iy,ix) = flxi[LUT::velocity_j];
-    config.flux_arr(external_velocity_k,iz,iy,ix) = flxi[LUT::velocity_k];
-    config.flux_arr(external_bfield_i,iz,iy,ix) = 0.0;
-    config.flux_arr(external_bfield_j,iz,iy,ix) = flxi[LUT::bfield_j];
-    config.flux_arr(external_bfield_k,iz,iy,ix) = flxi[LUT::bfield_k];
-    config.flux_arr(LUT::total_energy,iz,iy,ix) = flxi[LUT::total_energy];
+    flxi[LUT::bfield_i] = 0.0;
 
     // finally, deal with dual energy stuff.
     // compute internal energy flux, assuming passive advection
     // (this was not handled with the rest of the fluxes)
-    config.internal_energy_flux_arr(iz,iy,ix) =
+    internal_energy_flux =
       enzo_riemann_utils::passive_eint_flux
       (wli[LUT::density], pressure_l, wri[LUT::density], pressure_r,
-       config.eos, config.flux_arr(LUT::density,iz,iy,ix));
+       config.eos, flxi[LUT::density]);
 
     // compute vi_bar, velocity component normal to the interface
     // for simplicity, we adopt the shorthand:
@@ -437,13 +403,13 @@ public: // methods
     const enzo_float l_coef = (S_l - wli[LUT::velocity_i])/(S_l - S_M);
     const enzo_float r_coef = (S_r - wri[LUT::velocity_i])/(S_r - S_M);
     if (S_l > 0) {
-      config.velocity_i_bar_arr(iz,iy,ix) = wli[LUT::velocity_i];
+      velocity_i_bar = wli[LUT::velocity_i];
     } else if (S_r < 0) {
-      config.velocity_i_bar_arr(iz,iy,ix) = wri[LUT::velocity_i];
+      velocity_i_bar = wri[LUT::velocity_i];
     } else if (S_M >=0){
-      config.velocity_i_bar_arr(iz,iy,ix) = S_M * l_coef;
+      velocity_i_bar = S_M * l_coef;
     } else {
-      config.velocity_i_bar_arr(iz,iy,ix) = S_M * r_coef;
+      velocity_i_bar = S_M * r_coef;
     }
   }
 };
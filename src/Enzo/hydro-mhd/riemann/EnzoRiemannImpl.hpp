@@ -124,8 +124,11 @@ struct KernelConfig{
   ///
   /// For any Dual-Energy compatible EOS, kernels should ALWAYS fill these
   /// arrays with the relevant values. If the dual energy formalism isn't used
-  /// outside of the Riemann Solver, these are initialized with scratch-space.
-  /// This is done to avoid unnecessary branching and code generation.
+  /// outside of the Riemann Solver, these are initialized with scratch-space
+  /// for kernels that only provide `operator()`. This is done to avoid
+  /// unnecessary branching and code generation. For kernels that provide
+  /// `interface_flux`, the outputs are simply discarded (and these arrays are
+  /// null) when the dual energy formalism isn't used.
   /**@{*/
   /// array to store the computed flux for the specific internal energy
   ///
@@ -142,6 +145,37 @@ struct KernelConfig{
 
 //----------------------------------------------------------------------
 
+namespace enzo_riemann_utils{
+
+  /// Type trait indicating whether a KernelFunctor provides an
+  /// `interface_flux` method (see `EnzoRiemannImpl`)
+  template <class KernelFunctor, class = void>
+  struct has_interface_flux : std::false_type {};
+
+  template <class KernelFunctor>
+  struct has_interface_flux
+  <KernelFunctor, std::void_t<decltype(&KernelFunctor::interface_flux)>>
+    : std::true_type {};
+
+  /// Returns the index along axis 0 of the arrays held by `KernelConfig` of
+  /// the quantity that the `LUT` entry `q` refers to when computing fluxes
+  /// along `dim` (i.e. the i, j, and k vector components are mapped to the
+  /// `dim`, `(dim+1)%3`, and `(dim+2)%3` components)
+  template <class LUT>
+  inline int external_index(const int q, const int dim) noexcept
+  {
+    if (LUT::velocity_i <= q && q <= LUT::velocity_k) {
+      return LUT::velocity_i + (q - LUT::velocity_i + dim) % 3;
+    } else if (LUT::has_bfields && LUT::bfield_i <= q && q <= LUT::bfield_k) {
+      return LUT::bfield_i + (q - LUT::bfield_i + dim) % 3;
+    }
+    return q;
+  }
+
+}
+
+//----------------------------------------------------------------------
+
 template <class KernelFunctor>
 class EnzoRiemannImpl : public EnzoRiemann
 {
@@ -153,8 +187,20 @@ class EnzoRiemannImpl : public EnzoRiemann
   /// @tparam KernelFunctor The functor used to specialize `EnzoRiemannImpl`.
   ///     The functor must provide a public member type called `LUT`, which is
   ///     a specialization of `EnzoRiemannLUT<InputLUT>`. It must also support
-  ///     initialization from KernelConfig and provide a public `operator()`
-  ///     method which accepts 3 integer indices.
+  ///     initialization from KernelConfig and provide either a public
+  ///     `interface_flux` method (preferred) or a public `operator()` method
+  ///     which accepts 3 integer indices.
+  ///
+  /// A kernel's `interface_flux` method computes the fluxes at a single
+  /// interface from `lutarray<LUT>` arrays of left and right primitives (in
+  /// which the i, j and k vector components already map to the components
+  /// normal and transverse to the interface); it returns the fluxes in the
+  /// same ordering, along with the internal energy flux and the interface
+  /// velocity. `EnzoRiemannImpl` then loads and stores values for each row of
+  /// interfaces through plain pointers to contiguous memory, which lets the
+  /// compiler vectorize the loop over the row. A kernel's `operator()`
+  /// instead reads and writes the arrays of `KernelConfig` directly at the
+  /// given `(iz,iy,ix)` location.
   ///
   /// EnzoRiemannImpl factors out the repeated code between different
   /// approximate Riemann Solvers (e.g. HLLE, HLLC, HLLD and possibly LLF &
@@ -174,10 +220,13 @@ class EnzoRiemannImpl : public EnzoRiemann
   using EOSStructT = typename KernelFunctor::EOSStructT;
 
   // Check whether KernelFunctor's operator() method has the expected signature
-  // and raise an error message if it doesn't:
-  static_assert(std::is_convertible<KernelFunctor&&,
+  // (unless interface_flux is defined) and raise an error message if it
+  // doesn't:
+  static_assert(enzo_riemann_utils::has_interface_flux<KernelFunctor>::value ||
+                std::is_convertible<KernelFunctor&&,
                                     std::function<void(int, int, int)>>::value,
-                "KernelFunctor must define the method: "
+                "KernelFunctor must define either the method "
+                "KernelFunctor::interface_flux or the method: "
                 "void KernelFunctor::operator() (int,int,int)");
 
 
@@ -211,10 +260,17 @@ private: // helper methods
 
   /// Actually executes the Riemann Solver
   ///
+  /// The template parameter specifies whether the dual energy formalism is
+  /// in use. It is selected once per call in `EnzoRiemannImpl::solve`, so
+  /// that the row loop neither branches on it nor stores the internal energy
+  /// flux and interface velocity when they aren't needed.
+  ///
   /// @note
   /// for purposes of getting icc to vectorize code, it seems to be important
   /// that this method's contents are separated from `EnzoRiemannImpl::solve`
+  template <bool DualEnergy>
   static void solve_(const KernelConfig<EOSStructT> config,
+                     const enzo_riemann_utils::PassiveArrays &passive,
                      const int stale_depth) noexcept;
 
 private: //attributes
@@ -275,16 +331,22 @@ void EnzoRiemannImpl<KernelFunctor>::solve
   const EnzoEOSIdeal eos_struct
     = enzo::fluid_props()->eos_variant().get<EnzoEOSIdeal>();
 
-  // The strategy is to allocate some scratch space for internal_energy_flux &
-  // velocity_i_bar_array, even if we don't care about dual-energy in order to
-  // avoid branching.
+  // Kernels that only provide operator() always write internal_energy_flux
+  // & velocity_i_bar_array, so the strategy is to allocate some scratch space
+  // for them, even if we don't care about dual-energy in order to avoid
+  // branching. Kernels that provide interface_flux are specialized on
+  // whether dual-energy is used, so they don't need the scratch space.
+  constexpr bool row_kernel =
+    enzo_riemann_utils::has_interface_flux<KernelFunctor>::value;
   const bool calculate_internal_energy_flux = calculate_internal_energy_flux_;
   EFlt3DArray internal_energy_flux, velocity_i_bar_array;
-  enzo_riemann_utils::prep_dual_energy_arrays_(calculate_internal_energy_flux,
-                                               flux_map, interface_velocity,
-                                               scratch_ptr_,
-                                               internal_energy_flux,
-                                               velocity_i_bar_array);
+  if (calculate_internal_energy_flux || !row_kernel) {
+    enzo_riemann_utils::prep_dual_energy_arrays_(calculate_internal_energy_flux,
+                                                 flux_map, interface_velocity,
+                                                 scratch_ptr_,
+                                                 internal_energy_flux,
+                                                 velocity_i_bar_array);
+  }
 
 #ifdef RIEMANN_DEBUG
   check_key_order_(prim_map_l, true, passive_list);
@@ -300,11 +362,17 @@ void EnzoRiemannImpl<KernelFunctor>::solve
                                            internal_energy_flux,
                                            velocity_i_bar_array};
 
-  solve_(config, stale_depth);
+  // the passive scalar fluxes are computed in the same pass, one row at a
+  // time, right after the density flux of the row
+  const enzo_riemann_utils::PassiveArrays passive =
+    enzo_riemann_utils::load_passive_arrays(prim_map_l, prim_map_r, flux_map,
+                                            passive_list);
 
-  enzo_riemann_utils::solve_passive_advection(prim_map_l, prim_map_r, flux_map,
-                                              flux_map.at("density"),
-                                              stale_depth, passive_list);
+  if (calculate_internal_energy_flux) {
+    solve_<true>(config, passive, stale_depth);
+  } else {
+    solve_<false>(config, passive, stale_depth);
+  }
 
   if (LUT::has_bfields){
     // If Dedner Fluxes are required, they might get handled here
@@ -315,8 +383,10 @@ void EnzoRiemannImpl<KernelFunctor>::solve
 //----------------------------------------------------------------------
 
 template <class KernelFunctor>
+template <bool DualEnergy>
 void EnzoRiemannImpl<KernelFunctor>::solve_
-(const KernelConfig<EOSStructT> config, const int stale_depth)
+(const KernelConfig<EOSStructT> config,
+ const enzo_riemann_utils::PassiveArrays &passive, const int stale_depth)
   noexcept
 {
   const KernelFunctor kernel{config};
@@ -326,14 +396,76 @@ void EnzoRiemannImpl<KernelFunctor>::solve_
   const int my = config.flux_arr.shape(2);
   const int mx = config.flux_arr.shape(3);
 
-  // compute the flux at all non-stale cell interfaces
-  for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
-    for (int iy = stale_depth; iy < my - stale_depth; iy++) {
-      #pragma omp simd
-      for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
-        kernel(iz,iy,ix);
+  if constexpr (enzo_riemann_utils::has_interface_flux<KernelFunctor>::value){
+
+    constexpr int nq = LUT::num_entries;
+
+    // map LUT entries to indices (along axis 0) of the config arrays
+    int external[nq];
+    for (int q = 0; q < nq; q++){
+      external[q] = enzo_riemann_utils::external_index<LUT>(q, config.dim);
+    }
+
+    // compute the flux at all non-stale cell interfaces, one row at a time,
+    // through pointers to the start of each row
+    for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
+      for (int iy = stale_depth; iy < my - stale_depth; iy++) {
+
+        const enzo_float * prim_l_row[nq];
+        const enzo_float * prim_r_row[nq];
+        enzo_float * flux_row[nq];
+        for (int q = 0; q < nq; q++){
+          prim_l_row[q] = &config.prim_arr_l(external[q],iz,iy,0);
+          prim_r_row[q] = &config.prim_arr_r(external[q],iz,iy,0);
+          flux_row[q] = &config.flux_arr(external[q],iz,iy,0);
+        }
+        enzo_float * eint_flux_row = nullptr;
+        enzo_float * vi_bar_row = nullptr;
+        if constexpr (DualEnergy) {
+          eint_flux_row = &config.internal_energy_flux_arr(iz,iy,0);
+          vi_bar_row = &config.velocity_i_bar_arr(iz,iy,0);
+        }
+
+        #pragma omp simd
+        for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
+          lutarray<LUT> prim_l, prim_r, flux;
+          for (int q = 0; q < nq; q++){
+            prim_l[q] = prim_l_row[q][ix];
+            prim_r[q] = prim_r_row[q][ix];
+          }
+          enzo_float eint_flux, vi_bar;
+          kernel.interface_flux(prim_l, prim_r, flux, eint_flux, vi_bar);
+          for (int q = 0; q < nq; q++){
+            flux_row[q][ix] = flux[q];
+          }
+          if constexpr (DualEnergy) {
+            eint_flux_row[ix] = eint_flux;
+            vi_bar_row[ix] = vi_bar;
+          }
+        }
+
+        enzo_riemann_utils::solve_passive_advection_row
+          (passive, flux_row[LUT::density], iz, iy,
+           stale_depth, mx - stale_depth);
+      }
+    }
+
+  } else {
+
+    // compute the flux at all non-stale cell interfaces
+    for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
+      for (int iy = stale_depth; iy < my - stale_depth; iy++) {
+        #pragma omp simd
+        for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
+          kernel(iz,iy,ix);
+        }
+
+        enzo_riemann_utils::solve_passive_advection_row
+          (passive, &config.flux_arr(LUT::density,iz,iy,0), iz, iy,
+           stale_depth, mx - stale_depth);
       }
     }
+
   }
 }
 
@@ -250,70 +250,92 @@ namespace enzo_riemann_utils{
 
   //----------------------------------------------------------------------
 
-  /// compute the flux of the passively advected scalar quantities
+  /// Views of the left/right reconstructed passive scalars and of their
+  /// fluxes, in the order of the passive scalar list
+  ///
+  /// These are non-owning views, so that nothing in the flux loop touches
+  /// a reference count
+  struct PassiveArrays {
+    std::vector<CelloViewRef<const enzo_float, 3>> wl;
+    std::vector<CelloViewRef<const enzo_float, 3>> wr;
+    std::vector<CelloViewRef<enzo_float, 3>> flux;
+  };
+
+  /// Load the passive scalar views from the maps used by the Riemann solver
   ///
   /// @param[in]  priml_map,primr_map Maps of arrays holding the left/right
   ///     reconstructed face-centered primitives.
-  /// @param[out] flux_map Holds arrays where the calculated fluxes for the
+  /// @param[in]  flux_map Holds arrays where the calculated fluxes for the
   ///     integration quantities will be stored.
-  /// @param[in]  density_flux Array of density fluxes at each location. This
-  ///     This probably aliases the array returned by `flux_map["density"]`
-  /// @param[in]  stale_depth indicates the current stale_depth.
   /// @param[in]  passive_list A list of keys for passive scalars.
-  ///
-  /// @note
-  /// The arrays in `priml_map`, `primr_map`, and `flux_map` should all have
-  /// the same shape as `density_flux`.
-  static void solve_passive_advection
+  inline PassiveArrays load_passive_arrays
   (const EnzoEFltArrayMap &prim_map_l, const EnzoEFltArrayMap &prim_map_r,
-   EnzoEFltArrayMap &flux_map,
-   const CelloView<const enzo_float,3> &density_flux,
-   const int stale_depth, const str_vec_t &passive_list) noexcept
+   EnzoEFltArrayMap &flux_map, const str_vec_t &passive_list) noexcept
   {
     const std::size_t num_keys = passive_list.size();
-    if (num_keys == 0) {return;}
-
-    // This was essentially transcribed from hydro_rk in Enzo:
-
-    // load array of fields
-    CelloView<const enzo_float, 3> *wl_arrays =
-      new CelloView<const enzo_float, 3>[num_keys];
-    CelloView<const enzo_float, 3> *wr_arrays =
-      new CelloView<const enzo_float, 3>[num_keys];
-    EFlt3DArray *flux_arrays = new EFlt3DArray[num_keys];
-
+    PassiveArrays passive{std::vector<CelloViewRef<const enzo_float, 3>>(num_keys),
+                          std::vector<CelloViewRef<const enzo_float, 3>>(num_keys),
+                          std::vector<CelloViewRef<enzo_float, 3>>(num_keys)};
     for (std::size_t ind=0; ind<num_keys; ind++){
-      wl_arrays[ind] = prim_map_l.at(passive_list[ind]);
-      wr_arrays[ind] = prim_map_r.at(passive_list[ind]);
-      flux_arrays[ind] = flux_map.at(passive_list[ind]);
+      passive.wl[ind] = prim_map_l.at(passive_list[ind]);
+      passive.wr[ind] = prim_map_r.at(passive_list[ind]);
+      passive.flux[ind] = flux_map.at(passive_list[ind]);
     }
+    return passive;
+  }
 
-    // preload shape of arrays (to inform compiler they won't change)
-    const int mz = density_flux.shape(0);
-    const int my = density_flux.shape(1);
-    const int mx = density_flux.shape(2);
-
-    for (int iz = stale_depth; iz < mz - stale_depth; iz++) {
-      for (int iy = stale_depth; iy < my - stale_depth; iy++) {
-
-        for (std::size_t key_ind = 0; key_ind < num_keys; key_ind++){
-          #pragma omp simd
-          for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
-            const enzo_float dens_flux = density_flux(iz,iy,ix);
-            const enzo_float wl = wl_arrays[key_ind](iz,iy,ix);
-            const enzo_float wr = wr_arrays[key_ind](iz,iy,ix);
-            flux_arrays[key_ind](iz,iy,ix) =
-              calc_passive_scalar_flux_(wl, wr, dens_flux);
-          }
-        }
+  //----------------------------------------------------------------------
 
+  /// compute the flux of the passively advected scalar quantities along a
+  /// single row of interfaces, right after the density flux of the row is
+  /// computed (while it is still in cache)
+  ///
+  /// This was essentially transcribed from hydro_rk in Enzo. Scalars are
+  /// processed in batches of 4 so that each load of the density flux is
+  /// shared by several scalars.
+  ///
+  /// @param[in]  passive Views of the passive scalars and their fluxes
+  /// @param[in]  dens_flux Pointer to the start of the row of density fluxes
+  /// @param[in]  iz,iy Indices of the row
+  /// @param[in]  ix_start,ix_stop Range of interfaces in the row to compute
+  inline void solve_passive_advection_row
+  (const PassiveArrays &passive, const enzo_float * RESTRICT dens_flux,
+   const int iz, const int iy, const int ix_start, const int ix_stop) noexcept
+  {
+    constexpr std::size_t batch = 4;
+    const std::size_t num_keys = passive.flux.size();
+
+    std::size_t k = 0;
+    for (; k + batch <= num_keys; k += batch){
+      const enzo_float * wl[batch];
+      const enzo_float * wr[batch];
+      enzo_float * flux[batch];
+      for (std::size_t b = 0; b < batch; b++){
+        wl[b] = passive.wl[k+b].row(iz,iy);
+        wr[b] = passive.wr[k+b].row(iz,iy);
+        flux[b] = passive.flux[k+b].row(iz,iy);
+      }
+      #pragma omp simd
+      for (int ix = ix_start; ix < ix_stop; ix++) {
+        const enzo_float density_flux = dens_flux[ix];
+        for (std::size_t b = 0; b < batch; b++){
+          flux[b][ix] = calc_passive_scalar_flux_(wl[b][ix], wr[b][ix],
+                                                  density_flux);
+        }
       }
     }
-    delete[] wl_arrays; delete[] wr_arrays; delete[] flux_arrays;
 
+    for (; k < num_keys; k++){
+      const enzo_float * RESTRICT wl = passive.wl[k].row(iz,iy);
+      const enzo_float * RESTRICT wr = passive.wr[k].row(iz,iy);
+      enzo_float * RESTRICT flux = passive.flux[k].row(iz,iy);
+      #pragma omp simd
+      for (int ix = ix_start; ix < ix_stop; ix++) {
+        flux[ix] = calc_passive_scalar_flux_(wl[ix], wr[ix], dens_flux[ix]);
+      }
+    }
   }
 
-
   //----------------------------------------------------------------------
 
   class ScratchArrays_{
@@ -113,9 +113,15 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
+  /// @param[in]     offset The (z,y,x) index of the first element of the
+  ///     arrays in `l_map` and `r_map` within the block's face-centered
+  ///     arrays. This is nonzero when the maps only hold a slab of the block
+  ///     (e.g. when computing fluxes one tile at a time).
   virtual void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
                                             EnzoEFltArrayMap &r_map, int dim,
-                                            int stale_depth) noexcept = 0;
+                                            int stale_depth,
+                                            const std::array<int,3> &offset)
+    noexcept = 0;
 
   /// In the case of Constrained Transport, identifies and stores the upwind
   /// direction.
@@ -12,6 +12,12 @@
 //----------------------------------------------------------------------
 
 namespace{
+
+  /// Number of z planes of cells updated together by
+  /// update_all_bfield_components(), so that the face-centered and
+  /// cell-centered B-fields of a tile are computed while in cache
+  const int ct_tile_planes = 2;
+
   std::array<CelloView<const enzo_float,3>,3> immutable_arr_of_EFlt3DArray
     (const std::array<CelloView<enzo_float,3>,3>& arg) noexcept
   {
@@ -121,7 +127,7 @@ void EnzoBfieldMethodCT::check_required_fields() const noexcept
 
 void EnzoBfieldMethodCT::correct_reconstructed_bfield
 (EnzoEFltArrayMap &l_map, EnzoEFltArrayMap &r_map, int dim,
- int stale_depth) noexcept
+ int stale_depth, const std::array<int,3> &offset) noexcept
 {
   require_registered_block_(); // confirm that target_block_ is valid
 
@@ -152,12 +158,19 @@ void EnzoBfieldMethodCT::correct_reconstructed_bfield
     EFlt3DArray l_bfield = l_map.at(names[dim]);
     EFlt3DArray r_bfield = r_map.at(names[dim]);
 
-    // All 3 array objects are the same shape
-    for (int iz = stale_depth; iz< bfield.shape(0) - stale_depth; iz++) {
-      for (int iy = stale_depth; iy< bfield.shape(1) - stale_depth; iy++) {
-        for (int ix = stale_depth; ix < bfield.shape(2) - stale_depth; ix++) {
-          l_bfield(iz,iy,ix) = bfield(iz,iy,ix);
-          r_bfield(iz,iy,ix) = bfield(iz,iy,ix);
+    // select the part of bfield corresponding to the maps (without an offset
+    // all 3 array objects are the same shape)
+    const int mz = l_bfield.shape(0), my = l_bfield.shape(1);
+    const int mx = l_bfield.shape(2);
+    EFlt3DArray bfield_slab = bfield.subarray
+      (CSlice(offset[0], offset[0] + mz), CSlice(offset[1], offset[1] + my),
+       CSlice(offset[2], offset[2] + mx));
+
+    for (int iz = stale_depth; iz< mz - stale_depth; iz++) {
+      for (int iy = stale_depth; iy< my - stale_depth; iy++) {
+        for (int ix = stale_depth; ix < mx - stale_depth; ix++) {
+          l_bfield(iz,iy,ix) = bfield_slab(iz,iy,ix);
+          r_bfield(iz,iy,ix) = bfield_slab(iz,iy,ix);
         }
       }
     }
@@ -245,21 +258,30 @@ void EnzoBfieldMethodCT::update_all_bfield_components
     (cur_integration_map, xflux_map, yflux_map, zflux_map, center_efield_,
      edge_efield_l_, immutable_arr_of_EFlt3DArray(weight_l_), stale_depth);
 
-  // Update longitudinal B-field (add source terms of constrained transport)
+  // Update longitudinal B-field (add source terms of constrained
+  // transport), then the cell-centered B-field, a few z planes at a
+  // time. Tiles are visited in increasing z, since cell-centered
+  // values along z use the upper face of the previous tile
   const auto const_edge_efield_l = immutable_arr_of_EFlt3DArray(edge_efield_l_);
-  for (int dim = 0; dim<3; dim++){
-    EnzoBfieldMethodCT::update_bfield
-      (cell_widths_, dim, const_edge_efield_l, (*cur_bfieldi_l)[dim],
-       (*out_bfieldi_l)[dim], dt, stale_depth);
-  }
-
-  // Finally, update cell-centered B-field
   const std::string names[3] = {"bfield_x", "bfield_y", "bfield_z"};
-  for (int dim = 0; dim<3; dim++){
-    EnzoBfieldMethodCT::compute_center_bfield
-      (dim, out_centered_bfield_map[names[dim]], (*out_bfieldi_l)[dim],
-       stale_depth);
-  }
+  const int mz = bfieldi_l_[0].shape(0);
+  int iz = stale_depth;
+  do {
+    // the last tile includes all remaining values
+    const int iz_stop = (iz + ct_tile_planes < mz - stale_depth) ?
+      iz + ct_tile_planes : std::numeric_limits<int>::max();
+    for (int dim = 0; dim<3; dim++){
+      EnzoBfieldMethodCT::update_bfield
+        (cell_widths_, dim, const_edge_efield_l, (*cur_bfieldi_l)[dim],
+         (*out_bfieldi_l)[dim], dt, stale_depth, iz, iz_stop);
+    }
+    for (int dim = 0; dim<3; dim++){
+      EnzoBfieldMethodCT::compute_center_bfield
+        (dim, out_centered_bfield_map[names[dim]], (*out_bfieldi_l)[dim],
+         stale_depth, iz, iz_stop);
+    }
+    iz += ct_tile_planes;
+  } while (iz < mz - stale_depth);
 }
 
 //----------------------------------------------------------------------
@@ -381,22 +403,26 @@ void EnzoBfieldMethodCT::compute_center_efield
 //     Eedge(k,j,i)    =     E(k+1/2,j+1/2,i)
 // To be independent of reconstruction method, compute E-field at all edges
 // that lie within the mesh.
+//
+// The arrays are passed as CelloViewRef, so that the compiler knows that
+// Eedge doesn't alias any of the other arrays and no reference counts are
+// touched in making the 13 copies.
 template<bool negate_Ej>
 void compute_edge_(int xstart, int ystart, int zstart,
 		   int xstop, int ystop, int zstop,
-		   const CelloView<enzo_float, 3> &Eedge,
-		   const CelloView<const enzo_float, 3> &Wj,
-		   const CelloView<const enzo_float, 3> &Wj_kp1,
-		   const CelloView<const enzo_float, 3> &Wk,
-		   const CelloView<const enzo_float, 3> &Wk_jp1,
-		   const CelloView<const enzo_float, 3> &Ec,
-		   const CelloView<const enzo_float, 3> &Ec_jkp1,
-		   const CelloView<const enzo_float, 3> &Ec_jp1,
-		   const CelloView<const enzo_float, 3> &Ec_kp1,
-		   const CelloView<const enzo_float, 3> &Ej,
-		   const CelloView<const enzo_float, 3> &Ej_kp1,
-		   const CelloView<const enzo_float, 3> &Ek,
-		   const CelloView<const enzo_float, 3> &Ek_jp1)
+		   const CelloViewRef<enzo_float, 3> Eedge,
+		   const CelloViewRef<const enzo_float, 3> Wj,
+		   const CelloViewRef<const enzo_float, 3> Wj_kp1,
+		   const CelloViewRef<const enzo_float, 3> Wk,
+		   const CelloViewRef<const enzo_float, 3> Wk_jp1,
+		   const CelloViewRef<const enzo_float, 3> Ec,
+		   const CelloViewRef<const enzo_float, 3> Ec_jkp1,
+		   const CelloViewRef<const enzo_float, 3> Ec_jp1,
+		   const CelloViewRef<const enzo_float, 3> Ec_kp1,
+		   const CelloViewRef<const enzo_float, 3> Ej,
+		   const CelloViewRef<const enzo_float, 3> Ej_kp1,
+		   const CelloViewRef<const enzo_float, 3> Ek,
+		   const CelloViewRef<const enzo_float, 3> Ek_jp1)
 {
   for (int iz = zstart; iz < zstop; iz++){
     for (int iy = ystart; iy < ystop; iy++){
@@ -619,7 +645,7 @@ void EnzoBfieldMethodCT::update_bfield
  const std::array<CelloView<const enzo_float, 3>,3> &efield_l,
  const CelloView<enzo_float, 3> &cur_interface_bfield,
  const CelloView<enzo_float, 3> &out_interface_bfield,
- enzo_float dt, int stale_depth)
+ enzo_float dt, int stale_depth, int iz_start, int iz_stop)
 {
   EnzoPermutedCoordinates coord(dim);
 
@@ -666,9 +692,17 @@ void EnzoBfieldMethodCT::update_bfield
   bcur = coord.get_subarray(cur_bfield, inner_cent, inner_cent, CSlice(1,-1));
   bout = coord.get_subarray(out_bfield, inner_cent, inner_cent, CSlice(1,-1));
 
+  // restrict to the requested cells: bout plane iz holds values for
+  // cell z index stale_depth + 1 + iz, except along z, where it holds
+  // the upper face of cell stale_depth + iz
+  const int iz_cell = stale_depth + ((dim == 2) ? 0 : 1);
+  const int iz_lo = std::max(0, iz_start - iz_cell);
+  const int iz_hi = (iz_stop - iz_cell < bout.shape(0)) ?
+    iz_stop - iz_cell : bout.shape(0);
+
   // We could simplify this iteration by using subarrays - However, it would be
   // more complicated
-  for (int iz=0; iz<bout.shape(0); iz++) {
+  for (int iz=iz_lo; iz<iz_hi; iz++) {
     for (int iy=0; iy<bout.shape(1); iy++) {
       for (int ix=0; ix<bout.shape(2); ix++) {
 
@@ -701,7 +735,8 @@ void EnzoBfieldMethodCT::update_bfield
 //   Bi_right(k,j,i)   ->  B_i(k,j,i+3/2)
 void EnzoBfieldMethodCT::compute_center_bfield
 (int dim, const CelloView<enzo_float,3> &bfieldc_comp,
- const CelloView<const enzo_float,3> &bfieldi_comp, int stale_depth)
+ const CelloView<const enzo_float,3> &bfieldi_comp, int stale_depth,
+ int iz_start, int iz_stop)
 {
   EnzoPermutedCoordinates coord(dim);
   CSlice stale_slc = (stale_depth > 0) ?
@@ -717,8 +752,13 @@ void EnzoBfieldMethodCT::compute_center_bfield
   const CelloView<const enzo_float,3> bi_right
     = coord.left_edge_offset(bi_left,0,0,1);
 
+  // b_center plane iz holds cells with z index stale_depth + iz
+  const int iz_lo = std::max(0, iz_start - stale_depth);
+  const int iz_hi = (iz_stop - stale_depth < b_center.shape(0)) ?
+    iz_stop - stale_depth : b_center.shape(0);
+
   // iteration limits are compatible with a 2D grid and 3D grid
-  for (int iz=0; iz<b_center.shape(0); iz++) {
+  for (int iz=iz_lo; iz<iz_hi; iz++) {
     for (int iy=0; iy<b_center.shape(1); iy++) {
       for (int ix=0; ix<b_center.shape(2); ix++) {
 	b_center(iz,iy,ix) = 0.5*(bi_left(iz,iy,ix) + bi_right(iz,iy,ix));
@@ -41,9 +41,13 @@ public: // interface
   /// @param[in]     stale_depth The current staling depth. This is the stale
   ///     depth from just before reconstruction plus the reconstructor's
   ///     immediate staling rate.
+  /// @param[in]     offset The (z,y,x) index of the first element of the
+  ///     arrays in `l_map` and `r_map` within the block's face-centered
+  ///     arrays.
   void correct_reconstructed_bfield(EnzoEFltArrayMap &l_map,
                                     EnzoEFltArrayMap &r_map, int dim,
-                                    int stale_depth) noexcept;
+                                    int stale_depth,
+                                    const std::array<int,3> &offset) noexcept;
 
   /// identifies and stores the upwind direction
   ///
@@ -95,11 +99,14 @@ public: // interface
   ///     more value.
   /// @param[in]  stale_depth indicates the current stale_depth for the
   ///     supplied quantities.
+  /// @param[in]  iz_start,iz_stop Only cells with z index (from the start
+  ///     of the full array) in [iz_start, iz_stop) are computed.
   ///
   /// @note this function is called in `update_all_bfield_components`
   static void compute_center_bfield
   (int dim, const CelloView<enzo_float,3> &bfieldc_comp,
-   const CelloView<const enzo_float,3> &bfieldi_comp, int stale_depth = 0);
+   const CelloView<const enzo_float,3> &bfieldi_comp, int stale_depth = 0,
+   int iz_start = 0, int iz_stop = std::numeric_limits<int>::max());
 
 protected: // methods
 
@@ -229,12 +236,18 @@ protected: // methods
   /// @param[in] dt The time time-step over which to apply the fluxes
   /// @param[in] stale_depth indicates the current stale_depth for the supplied
   ///     quantities
+  /// @param[in] iz_start,iz_stop Only faces belonging to cells with z index
+  ///     (from the start of the full array) in [iz_start, iz_stop) are
+  ///     updated. Along z, a cell owns its upper face, so that
+  ///     `compute_center_bfield` may be called for the same cells right
+  ///     after updating them, once lower cells have been updated.
   static void update_bfield
   (const enzo_float* &cell_widths, int dim,
    const std::array<CelloView<const enzo_float, 3>, 3> &efield_l,
    const CelloView<enzo_float, 3> &cur_interface_bfield,
    const CelloView<enzo_float, 3> &out_interface_bfield,
-   enzo_float dt, int stale_depth);
+   enzo_float dt, int stale_depth,
+   int iz_start = 0, int iz_stop = std::numeric_limits<int>::max());
 
 protected: // attributes
 
@@ -175,9 +175,13 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
 
   auto fn = [coord, limiter_func, theta_limiter, stale_depth,
              &prim_map, &priml_map, &primr_map](const std::string &key,
-                                                const bool use_floor,
+                                                auto use_floor,
                                                 const enzo_float prim_floor)
     {
+      // use_floor is a std::integral_constant, so that the floor is
+      // resolved at compile time rather than in the inner loop
+      constexpr bool has_floor = decltype(use_floor)::value;
+
       // Cast the problem as reconstructing values at:
       //   wl(k, j, i+3/2) and wr(k,j,i+1/2)
 
@@ -204,18 +208,37 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
       // initializing the left (right) interface value thanks to the adoption
       // of immediate_staling_rate
 
-      for (int iz=0; iz<wc_right.shape(0); iz++) {
-        for (int iy=0; iy<wc_right.shape(1); iy++) {
-          for (int ix=0; ix<wc_right.shape(2); ix++) {
+      // The loop walks contiguous rows of non-owning views, so that the
+      // inner loop is free of index arithmetic and the compiler knows that
+      // the outputs don't alias the inputs
+      const CelloViewRef<const enzo_float,3> wc_left_ref(wc_left);
+      const CelloViewRef<const enzo_float,3> wc_center_ref(wc_center);
+      const CelloViewRef<const enzo_float,3> wc_right_ref(wc_right);
+      const CelloViewRef<enzo_float,3> wr_ref(wr);
+      const CelloViewRef<enzo_float,3> wl_offset_ref(wl_offset);
+
+      const int mz = wc_right.shape(0);
+      const int my = wc_right.shape(1);
+      const int mx = wc_right.shape(2);
+
+      for (int iz=0; iz<mz; iz++) {
+        for (int iy=0; iy<my; iy++) {
+          const enzo_float * RESTRICT w_left = wc_left_ref.row(iz,iy);
+          const enzo_float * RESTRICT w_center = wc_center_ref.row(iz,iy);
+          const enzo_float * RESTRICT w_right = wc_right_ref.row(iz,iy);
+          enzo_float * RESTRICT w_r = wr_ref.row(iz,iy);
+          enzo_float * RESTRICT w_l = wl_offset_ref.row(iz,iy);
+
+          for (int ix=0; ix<mx; ix++) {
 
             // compute limited slopes
-            enzo_float val = wc_center(iz,iy,ix);
-            enzo_float dv = limiter_func(wc_left(iz,iy,ix), val,
-                                         wc_right(iz,iy,ix), theta_limiter);
+            enzo_float val = w_center[ix];
+            enzo_float dv = limiter_func(w_left[ix], val, w_right[ix],
+                                         theta_limiter);
             enzo_float half_dv = dv*0.5;
             enzo_float left_val, right_val;
 
-            if (use_floor) {
+            if constexpr (has_floor) {
               right_val = enzo_utils::apply_floor(val - half_dv, prim_floor);
               left_val  = enzo_utils::apply_floor(val + half_dv, prim_floor);
             } else {
@@ -224,27 +247,28 @@ void EnzoReconstructorPLM<Limiter>::reconstruct_interface
             }
 
             // face centered fields: index i corresponds to the value at i-1/2
-            wr(iz,iy,ix) = right_val;
-            wl_offset(iz,iy,ix) = left_val;
+            w_r[ix] = right_val;
+            w_l[ix] = left_val;
           }
         }
       }
     };
 
   for (const std::string &key : active_key_names_){
-    enzo_float prim_floor = 0;
-    bool use_floor = false;
     if (key == "density"){
-      prim_floor = enzo::fluid_props()->fluid_floor_config().density();
-      use_floor=true;
+      fn(key, std::true_type(),
+         enzo::fluid_props()->fluid_floor_config().density());
     } else if (key == "pressure"){
-      prim_floor = enzo::fluid_props()->fluid_floor_config().pressure();
-      use_floor=true;
+      fn(key, std::true_type(),
+         enzo::fluid_props()->fluid_floor_config().pressure());
+    } else {
+      fn(key, std::false_type(), 0.);
     }
-    fn(key, use_floor, prim_floor);
   }
 
-  for (const std::string &key : passive_list){ fn(key, false, 0.); }
+  for (const std::string &key : passive_list){
+    fn(key, std::false_type(), 0.);
+  }
 }
 
 //----------------------------------------------------------------------
@@ -53,10 +53,7 @@ EnzoLevelArray::EnzoLevelArray
   nix_ = r*nb3[0];
   niy_ = r*nb3[1];
   niz_ = r*nb3[2];
-  field_values_.resize(num_fields_);
-  for (int i=0; i<num_fields_; i++) {
-    field_values_[i].resize(nix_*niy_*niz_);
-  }
+  field_values_.resize(num_fields_*nix_*niy_*niz_);
   proxy_enzo_simulation[0].p_infer_array_created();
 }
 
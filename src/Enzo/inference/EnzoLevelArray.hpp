@@ -33,7 +33,9 @@ public: // interface
   /// Send data request to containing EnzoBlock in level_base
   void p_request_data ();
 
-  /// Accept requested data from blocks
+  /// Accept requested data from blocks.  Portions of blocks at or
+  /// finer than level_infer arrive restricted and sized to the array
+  /// portion; coarser ones include an extra layer for interpolation
   void p_transfer_data (Index, int nf, enzo_float * field_data_list );
 
   /// Exit EnzoMethodInference
@@ -59,8 +61,15 @@ public: // interface
     upper[2] = 1.0*(thisIndex[2]+1)/naz_;
   }
 
-  /// Return the coordinates of the lower point of the inference array
+  /// Return the values of field i_f of the inference array
+  enzo_float * field_values (int i_f)
+  { return field_values_.data() + i_f*nix_*niy_*niz_; }
 
+  /// Return the values of all fields of the inference array, as one
+  /// contiguous [num_fields][niz][niy][nix] tensor for the inference
+  /// backend
+  const std::vector<enzo_float> & inference_input() const
+  { return field_values_; }
 
 protected: // functions
 
@@ -74,10 +83,6 @@ protected: // functions
    const enzo_float * ac,
    int mcx, int mcy, int mcz, int ncx, int ncy, int ncz, int ecx, int ecy, int ecz);
 
-  void copy_
-  (      enzo_float * af, int mfx, int mfy, int mfz, int nfx, int nfy, int nfz,
-   const enzo_float * ac, int mcx, int mcy, int mcz, int ncx, int ncy, int ncz);
-
 private: // attributes
 
   /// AMR level of blocks associated with this array
@@ -104,8 +109,8 @@ private: // attributes
   /// Number of fields in the field_group_
   int num_fields_;
 
-  /// Arrays of fields
-  std::vector< std::vector < enzo_float > > field_values_;
+  /// Values of all fields, contiguous with the field index varying slowest
+  std::vector<enzo_float> field_values_;
 
   /// Variable for keeping track of volume of incoming data
   float volume_ratio_;
@@ -616,7 +616,13 @@ void EnzoMethodInference::request_data (Block * block, int ia3[3])
       }
       // Reserve storage for array size (3) offsets (3), and field
       // value portion (taking into account size after any restrict
-      // operations)
+      // operations).  Portions not needing interpolation are sent
+      // without the extra layer, ready to copy into the array
+      if (level >= level_infer_) {
+        nxa[i_f] -= 2*ex;
+        nya[i_f] -= 2*ey;
+        nza[i_f] -= 2*ez;
+      }
       nb += 6 + nxa[i_f]*nya[i_f]*nza[i_f];
     }
 
@@ -689,15 +695,23 @@ void EnzoMethodInference::request_data (Block * block, int ia3[3])
           ncx = (nfx-2*ex)/rx+2*ex;
           ncy = (nfy-2*ey)/ry+2*ey;
           ncz = (nfz-2*ez)/rz+2*ez;
+          // Last level is restricted directly into the buffer in the
+          // array's layout, computing only the values copied into it
+          int mcx = ncx;
+          int mcy = ncy;
+          int mcz = ncz;
           if (is_last) {
-            buffer_values[i_b++] = ncx;
-            buffer_values[i_b++] = ncy;
-            buffer_values[i_b++] = ncz;
+            mcx = nxa[i_f];
+            mcy = nya[i_f];
+            mcz = nza[i_f];
+            buffer_values[i_b++] = mcx;
+            buffer_values[i_b++] = mcy;
+            buffer_values[i_b++] = mcz;
             buffer_values[i_b++] = oxa[i_f];
             buffer_values[i_b++] = oya[i_f];
             buffer_values[i_b++] = oza[i_f];
             a_c = buffer_values.data() + i_b;
-            i_b += ncx*ncy*ncz;
+            i_b += mcx*mcy*mcz;
           } else {
             a_c = new enzo_float [ncx*ncy*ncz];
           }
@@ -707,17 +721,17 @@ void EnzoMethodInference::request_data (Block * block, int ia3[3])
           CkPrintf ("DEBUG_INFER coarsen a_f %d %d %d  %d %d %d  %d %d %d\n",
                     mfx,mfy,mfz,nfx,nfy,nfz,ex,ey,ez);
 #endif
-          coarsen_(a_c,ncx,ncy,ncz,ncx,ncy,ncz,ex,ey,ez,
+          coarsen_(a_c,mcx,mcy,mcz,ncx,ncy,ncz,ex,ey,ez,
                    a_f,mfx,mfy,mfz,nfx,nfy,nfz,ex,ey,ez);
 
 #ifdef DEBUG_INFER
         int c,cx,cy,cz;
         block->index().child(block->level(),&cx,&cy,&cz);
         c=1+cx+2*(cy+2*cz);
-        for (int iz=0; iz<ncz; iz++) {
-          for (int iy=0; iy<ncy; iy++) {
-            for (int ix=0; ix<ncx; ix++) {
-              const int i = ix + ncx*(iy+ncy*iz);
+        for (int iz=0; iz<mcz; iz++) {
+          for (int iy=0; iy<mcy; iy++) {
+            for (int ix=0; ix<mcx; ix++) {
+              const int i = ix + mcx*(iy+mcy*iz);
               a_c[i] = c;
             }
           }
@@ -755,32 +769,32 @@ void EnzoMethodInference::request_data (Block * block, int ia3[3])
         // First copy o[xyz] and n[xyz] indices to buffer
         // (to avoid having to recompute)
 
-        buffer_values[i_b++] = nx[i_f];
-        buffer_values[i_b++] = ny[i_f];
-        buffer_values[i_b++] = nz[i_f];
+        buffer_values[i_b++] = nxa[i_f];
+        buffer_values[i_b++] = nya[i_f];
+        buffer_values[i_b++] = nza[i_f];
         buffer_values[i_b++] = oxa[i_f];
         buffer_values[i_b++] = oya[i_f];
         buffer_values[i_b++] = oza[i_f];
 
-        // Then copy field portion values to buffer
+        // Then copy the rows of the field portion that are copied
+        // into the array to the buffer
 #ifdef DEBUG_INFER
         int c,cx,cy,cz;
         block->index().child(block->level(),&cx,&cy,&cz);
         c=1+cx+2*(cy+2*cz);
 #endif
-        for (int iz=0; iz<nz[i_f]; iz++) {
+        for (int iz=0; iz<nza[i_f]; iz++) {
           const int ifz = oz[i_f] + iz;
-          for (int iy=0; iy<ny[i_f]; iy++) {
+          for (int iy=0; iy<nya[i_f]; iy++) {
             const int ify = oy[i_f] + iy;
-            for (int ix=0; ix<nx[i_f]; ix++) {
-              const int ifx = ox[i_f] + ix;
-              const int iff = ifx + mx*(ify+my*ifz);
+            const int iff = ox[i_f] + mx*(ify+my*ifz);
 #ifdef DEBUG_INFER
-              buffer_values[i_b++] = c;
+            std::fill_n (buffer_values.data() + i_b, nxa[i_f], c);
 #else
-              buffer_values[i_b++] = field_values[iff];
+            std::copy_n (field_values + iff, nxa[i_f],
+                         buffer_values.data() + i_b);
 #endif
-            }
+            i_b += nxa[i_f];
           }
         }
       } // for i_f
@@ -846,7 +860,7 @@ void EnzoLevelArray::p_transfer_data
 
     // Get initial field portion and final array values
     enzo_float * field = buffer_values + i_b;
-    enzo_float * array = field_values_[i_f].data();
+    enzo_float * array = field_values(i_f);
 
     enzo_float * a_c = field;
     enzo_float * a_f = array;
@@ -922,23 +936,14 @@ void EnzoLevelArray::p_transfer_data
 
     } else { // copy
 
-      // Copy (if restriction is required it's performed at source)
-      int l = level;
-      const int mfx = nix_;
-      const int mfy = niy_;
-      const int mfz = niz_;
-      const int ncx = nbx;
-      const int ncy = nby;
-      const int ncz = nbz;
-      a_f = array + oax + mfx*(oay + mfy*oaz);
-#ifdef DEBUG_INFER
-      CkPrintf ("DEBUG_INFER copy a_d %d %d %d  %d %d %d  %d %d %d\n",
-                mfx,mfy,mfz,nbx-2,nby-2,nbz-2,0,0,0);
-      CkPrintf ("DEBUG_INFER copy a_s %d %d %d  %d %d %d  %d %d %d\n",
-                ncx,ncy,ncz,ncx-2,ncy-2,ncz-2,0,0,0);
-#endif
-      copy_(a_f,mfx,mfy,mfz,nbx-2,nby-2,nbz-2,
-            a_c,ncx,ncy,ncz,ncx-2,ncy-2,ncz-2);
+      // Portion arrives restricted if needed and sized to the array
+      // portion, so only its rows need copying into place
+      for (int iz=0; iz<nbz; iz++) {
+        for (int iy=0; iy<nby; iy++) {
+          std::copy_n (field + nbx*(iy + nby*iz), nbx,
+                       array + oax + nix_*((oay+iy) + niy_*(oaz+iz)));
+        }
+      }
     }
 
     // advance pointer to next field
@@ -989,15 +994,16 @@ void EnzoLevelArray::apply_inference()
     double min=+1e10;
     double max=-1e10;
     double wsum=0.0;
+    const enzo_float * values = field_values(i_f);
 
     for (int iz=0; iz<niz_; iz++) {
       for (int iy=0; iy<niy_; iy++) {
         for (int ix=0; ix<nix_; ix++) {
           const int i = ix+nix_*(iy+niy_*iz);
-          sum += field_values_[i_f][i];
-          min = std::min(min,field_values_[i_f][i]);
-          max = std::max(max,field_values_[i_f][i]);
-          wsum += (ix+1+2*(iy+1)-3*(iz+1))*field_values_[i_f][i];
+          sum += values[i];
+          min = std::min(min,values[i]);
+          max = std::max(max,values[i]);
+          wsum += (ix+1+2*(iy+1)-3*(iz+1))*values[i];
         }
       }
     }
@@ -1016,6 +1022,8 @@ void EnzoLevelArray::apply_inference()
   //
   // ADD DEEP LEARNING INFERENCE HERE
   //
+  // inference_input() holds all fields as one contiguous tensor
+  //
   //==================================================
 
   // Update blocks with inference results
@@ -1367,51 +1375,6 @@ void EnzoLevelArray::interpolate_
 
 //----------------------------------------------------------------------
 
-void EnzoLevelArray::copy_
-(enzo_float * a_dst,
- int mdx, int mdy, int mdz, int ndx,int ndy, int ndz,
- const enzo_float * a_src,
- int msx, int msy, int msz, int nsx,int nsy, int nsz)
-{
-  ASSERT6("EnzoLevelArray::copy_",
-          "Mismatch between expected sizes: src %d %d %d dst %d %d %d\n",
-          nsx,nsy,nsz,ndx,ndy,ndz,
-          (nsx==ndx) && (nsy==ndy) && (nsz==ndz));
-  if (cello::rank() == 1) {
-    for (int idx=0; idx<ndx; idx++) {
-      const int isx = idx;
-      const int id= idx;
-      const int is= isx;
-      a_dst[id] = a_src[is];
-    }
-  } else if (cello::rank() == 2) {
-    for (int idy=0; idy<ndy; idy++) {
-      const int isy = idy;
-      for (int idx=0; idx<ndx; idx++) {
-        const int isx = idx;
-        const int id= idx+mdx*idy;
-        const int is= isx+msx*isy;
-        a_dst[id] = a_src[is];
-      }
-    }
-  } else if (cello::rank() == 3) {
-    for (int idz=0; idz<ndz; idz++) {
-      const int isz = idz;
-      for (int idy=0; idy<ndy; idy++) {
-        const int isy = idy;
-        for (int idx=0; idx<ndx; idx++) {
-          const int isx = idx;
-          const int id= idx+mdx*(idy+mdy*idz);
-          const int is= isx+msx*(isy+msy*isz);
-          a_dst[id] = a_src[is];
-        }
-      }
-    }
-  }
-}
-
-//----------------------------------------------------------------------
-
 void EnzoBlock::p_method_infer_count_arrays (int count)
 {
   EnzoMethodInference * method =
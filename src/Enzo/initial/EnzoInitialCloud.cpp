@@ -521,7 +521,7 @@ public:
 
   enzo_float magnetic_edens_wind() const { return magnetic_edens_wind_; }
 
-  enzo_float magnetic_edens(int iz, int iy, int ix){
+  enzo_float magnetic_edens(int iz, int iy, int ix) const {
     if (!has_bfield_) { return 0;}
     return 0.5*(bfield_x(iz,iy,ix)*bfield_x(iz,iy,ix)+
                 bfield_y(iz,iy,ix)*bfield_y(iz,iy,ix)+
@@ -681,68 +681,76 @@ void EnzoInitialCloud::enforce_block
   ASSERT("EnzoInitialCloud::enforce_block",
 	 "Internal Energy Density must be positive", eint_density > 0);
 
-  for (int iz = 0; iz<density.shape(0); iz++){
-    for (int iy = 0; iy<density.shape(1); iy++){
-      for (int ix = 0; ix<density.shape(2); ix++){
-	velocity_y(iz,iy,ix) = 0.;
-	velocity_z(iz,iy,ix) = 0.;
-
-	// In the case of overlap, we use a volume weighted average density
-	// For other primitive quantities, like velocity_x (and eventually
-	// specific total energy), we use mass weighted average quantities
-	//
-	// let f = fraction_enclosed  -> V_cloud = f * V_cell
-	// V_wind = (1-f) * V_cell
-	//
-	// rho_cell = f*rho_cl + (1-f)*rho_wind
-	// cell_mass:  M_cell = V_cell * rho_cell
-	// mass_from cloud:
-	//   M_cloud = V_cloud * rho_cloud = f * V_cell * rho_cloud
-	// mass from wind:
-	//   M_wind = V_wind * rho_wind = (1-f) * V_cell * rho_wind
-	//
-	// cloud_mass_weight = M_cloud/M_cell
-	//   = f * rho_cloud / rho_cell
-	// cloud_mass_weight = M_wind/M_cell
-	//   = (1-f) * rho_wind / rho_cell
-
-	double frac_enclosed, perturbation;
-        init_helper.query_cell(iz, iy, ix, frac_enclosed, perturbation);
-        perturbation += 1.;
-
-	double avg_density = (frac_enclosed * density_cloud_ * perturbation +
-			      (1. - frac_enclosed) * density_wind_);
-
-	density(iz,iy,ix) = avg_density;
-	if (use_cloud_dye){
-	  cloud_dye_density(iz,iy,ix) = (frac_enclosed * density_cloud_ *
-                                         perturbation);
-	}
-	if (set_metal_density){
-	  metal_density(iz,iy,ix) = metal_mass_frac_ * avg_density;
-	}
+  // each cell depends only on its own position, so z-slabs of the
+  // Block are initialized independently
+  auto init_slab = [&](int task, int iz0, int iz1)
+  {
+    for (int iz = iz0; iz<iz1; iz++){
+      for (int iy = 0; iy<density.shape(1); iy++){
+        for (int ix = 0; ix<density.shape(2); ix++){
+          velocity_y(iz,iy,ix) = 0.;
+          velocity_z(iz,iy,ix) = 0.;
+
+          // In the case of overlap, we use a volume weighted average density
+          // For other primitive quantities, like velocity_x (and eventually
+          // specific total energy), we use mass weighted average quantities
+          //
+          // let f = fraction_enclosed  -> V_cloud = f * V_cell
+          // V_wind = (1-f) * V_cell
+          //
+          // rho_cell = f*rho_cl + (1-f)*rho_wind
+          // cell_mass:  M_cell = V_cell * rho_cell
+          // mass_from cloud:
+          //   M_cloud = V_cloud * rho_cloud = f * V_cell * rho_cloud
+          // mass from wind:
+          //   M_wind = V_wind * rho_wind = (1-f) * V_cell * rho_wind
+          //
+          // cloud_mass_weight = M_cloud/M_cell
+          //   = f * rho_cloud / rho_cell
+          // cloud_mass_weight = M_wind/M_cell
+          //   = (1-f) * rho_wind / rho_cell
+
+          double frac_enclosed, perturbation;
+          init_helper.query_cell(iz, iy, ix, frac_enclosed, perturbation);
+          perturbation += 1.;
+
+          double avg_density = (frac_enclosed * density_cloud_ * perturbation +
+                                (1. - frac_enclosed) * density_wind_);
+
+          density(iz,iy,ix) = avg_density;
+          if (use_cloud_dye){
+            cloud_dye_density(iz,iy,ix) = (frac_enclosed * density_cloud_ *
+                                           perturbation);
+          }
+          if (set_metal_density){
+            metal_density(iz,iy,ix) = metal_mass_frac_ * avg_density;
+          }
 
-	//cloud_mass_weight = frac_enclosed * density_cloud_ / avg_density;
+          //cloud_mass_weight = frac_enclosed * density_cloud_ / avg_density;
 
-	double wind_to_average_ratio = density_wind_ / avg_density;
-	double wind_mass_weight = (1. - frac_enclosed) * wind_to_average_ratio;
-	velocity_x(iz,iy,ix) = (wind_mass_weight * velocity_wind_);
+          double wind_to_average_ratio = density_wind_ / avg_density;
+          double wind_mass_weight = (1. - frac_enclosed) * wind_to_average_ratio;
+          velocity_x(iz,iy,ix) = (wind_mass_weight * velocity_wind_);
 
-	if (dual_energy) {
-	  internal_energy(iz,iy,ix) = eint_wind_ * wind_to_average_ratio;
-	}
+          if (dual_energy) {
+            internal_energy(iz,iy,ix) = eint_wind_ * wind_to_average_ratio;
+          }
 
-	if (frac_enclosed == 0){
-	  total_energy(iz,iy,ix) = etot_wind_;
-	} else {
-	  double magnetic_edens = mhd_handler.magnetic_edens(iz,iy,ix);
+          if (frac_enclosed == 0){
+            total_energy(iz,iy,ix) = etot_wind_;
+          } else {
+            double magnetic_edens = mhd_handler.magnetic_edens(iz,iy,ix);
 
-	  total_energy(iz,iy,ix)
-	    = ((eint_density + magnetic_edens) / avg_density +
-	       0.5 * velocity_x(iz,iy,ix) * velocity_x(iz,iy,ix));
-	}
+            total_energy(iz,iy,ix)
+              = ((eint_density + magnetic_edens) / avg_density +
+                 0.5 * velocity_x(iz,iy,ix) * velocity_x(iz,iy,ix));
+          }
+        }
       }
     }
-  }
+  };
+
+  cello::parallel_for(0, density.shape(0), num_tasks(), init_slab);
+
   block->initial_done();
 }
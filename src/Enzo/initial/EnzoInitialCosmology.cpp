@@ -69,13 +69,17 @@ void EnzoInitialCosmology::enforce_block
   field.dimensions (0,&mx,&my,&mz);
   field.ghost_depth(0,&gx,&gy,&gz);
 
-  gx=gy=gz=0;
-  for (int iz=gz; iz<mz-gz; iz++) {
-    for (int iy=gy; iy<my-gy; iy++) {
-      for (int ix=gx; ix<mx-gx; ix++) {
-	int i = ix + mx*(iy + my*iz);
-	ei[i] = internal_energy;
-	et[i] = ei[i] + 0.5*(vx[i]*vx[i] + vy[i]*vy[i] + vz[i]*vz[i]);
+  // Dark-matter-only runs define no gas fields
+
+  if (ei && et) {
+    gx=gy=gz=0;
+    for (int iz=gz; iz<mz-gz; iz++) {
+      for (int iy=gy; iy<my-gy; iy++) {
+        for (int ix=gx; ix<mx-gx; ix++) {
+          int i = ix + mx*(iy + my*iz);
+          ei[i] = internal_energy;
+          et[i] = ei[i] + 0.5*(vx[i]*vx[i] + vy[i]*vy[i] + vz[i]*vz[i]);
+        }
       }
     }
   }
@@ -182,8 +182,13 @@ void EnzoInitialTurbulence::enforce_block
   o3[1] += iy0 - gy;
   o3[2] += iz0 - gz;
 
+  const int mx = ndx*ndy;
+
   if ( rank == 2 ) {
 
+    // turboinit2d draws its random modes in sequence, so it is not
+    // split between tasks
+
     FORTRAN_NAME(turboinit2d)
       (&rank, &Nx, 
        (enzo_float *)v3[0],
@@ -191,66 +196,67 @@ void EnzoInitialTurbulence::enforce_block
        &ndx,&ndy,
        &o3[0],&o3[1]);
 
-  } else if ( rank == 3) {
-
-    FORTRAN_NAME(turboinit)
-      (&rank, &Nx, 
-       (enzo_float *)v3[0],
-       (enzo_float *)v3[1],
-       (enzo_float *)v3[2],
-       &ndx,&ndy,&ndz,
-       &o3[0],&o3[1],&o3[2]);
   }
 
-  if (rank >= 1) for (int i=0; i<ndx*ndy*ndz; i++) a3[0][i] = v3[0][i];
-  if (rank >= 2) for (int i=0; i<ndx*ndy*ndz; i++) a3[1][i] = v3[1][i];
-  if (rank >= 3) for (int i=0; i<ndx*ndy*ndz; i++) a3[2][i] = v3[2][i];
+  const bool pressure_defined = (pressure_initial_ != 0.0);
+  const bool temperature_defined = (temperature_initial_ != 0.0);
 
+  ASSERT("EnzoInitialTurbulence",
+         "Temperature computation with undefined pressure "
+         "not implemented yet",
+         temperature_defined);
+
+  // z-slabs [iz0,iz1) are independent: turboinit sums a fixed set of
+  // modes at each zone's global position, so each task calls it on
+  // its own slab with the corresponding global z offset
+
+  auto init_slab = [&] (int task, int iz0, int iz1)
+  {
+    const int i0 = mx*iz0;
+    const int i1 = mx*iz1;
+
+    if ( rank == 3 && iz1 > iz0) {
+      int nz_slab = iz1 - iz0;
+      int oz_slab = o3[2] + iz0;
+      FORTRAN_NAME(turboinit)
+        (&rank, &Nx, 
+         (enzo_float *)v3[0] + i0,
+         (enzo_float *)v3[1] + i0,
+         (enzo_float *)v3[2] + i0,
+         &ndx,&ndy,&nz_slab,
+         &o3[0],&o3[1],&oz_slab);
+    }
 
-  for (int iz=0; iz<ndz; iz++) {
-    for (int iy=0; iy<ndy; iy++) {
-      for (int ix=0; ix<ndx; ix++) {
-	int i = ix + ndx*(iy + ndy*iz);
-	d[i]  = density_initial_;
-      }
+    for (int id=0; id<rank; id++) {
+      for (int i=i0; i<i1; i++) a3[id][i] = v3[id][i];
     }
-  }
 
-  const bool pressure_defined = (pressure_initial_ != 0.0);
-  const bool temperature_defined = (temperature_initial_ != 0.0);
+    for (int i=i0; i<i1; i++) d[i] = density_initial_;
 
-  if (pressure_defined) {
-    for (int iz=0; iz<ndz; iz++) {
-      for (int iy=0; iy<ndy; iy++) {
-	for (int ix=0; ix<ndx; ix++) {
-	  int i = ix + ndx*(iy + ndy*iz);
-	  p[i] = pressure_initial_;
-	}
-      }
+    if (pressure_defined) {
+      for (int i=i0; i<i1; i++) p[i] = pressure_initial_;
     }
-  } else {
+  };
+
+  cello::parallel_for(0, ndz, num_tasks(), init_slab);
+
+  if (! pressure_defined) {
     bool comoving_coordinates = false;
     EnzoComputePressure compute_pressure (gamma_,comoving_coordinates);
     compute_pressure.compute(block);
   }
 
-  if (temperature_defined) {
-    for (int iz=0; iz<ndz; iz++) {
-      for (int iy=0; iy<ndy; iy++) {
-	for (int ix=0; ix<ndx; ix++) {
-	  int i = ix + ndx*(iy + ndy*iz);
-	  te[i] = temperature_initial_;
-	  for (int id=0; id<rank; id++) {
-	    te[i] += 0.5*v3[id][i]*v3[id][i];
-	  }
-	}
+  auto init_energy = [&] (int task, int iz0, int iz1)
+  {
+    for (int i=mx*iz0; i<mx*iz1; i++) {
+      te[i] = temperature_initial_;
+      for (int id=0; id<rank; id++) {
+        te[i] += 0.5*v3[id][i]*v3[id][i];
       }
     }
-  } else {
-    ERROR("EnzoInitialTurbulence",
-	  "Temperature computation with undefined pressure "
-	  "not implemented yet");
-  }
+  };
+
+  cello::parallel_for(0, ndz, num_tasks(), init_energy);
 
   block->initial_done();
 }
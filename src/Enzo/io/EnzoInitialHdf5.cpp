@@ -12,6 +12,11 @@
 #include <thread>
 #include <vector>
 
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 #define CHECK_COSMO_PARAMS true
 
 //----------------------------------------------------------------------
@@ -33,7 +38,8 @@ EnzoInitialHdf5::EnzoInitialHdf5
  std::vector < std::string > particle_coords,
  std::vector < std::string > particle_types,
  std::vector < std::string > particle_attributes,
- std::vector < int >         particle_levels) throw()
+ std::vector < int >         particle_levels,
+ bool                        use_mmap) throw()
    : Initial (cycle,time),
      max_level_(max_level),
      format_ (format),
@@ -50,7 +56,8 @@ EnzoInitialHdf5::EnzoInitialHdf5
      particle_attributes_ (particle_attributes),
      particle_levels_(particle_levels),
      l_particle_displacements_(false),
-     particle_position_names_()
+     particle_position_names_(),
+     use_mmap_(use_mmap)
 {
   for (int i=0; i<3; i++) blocking_[i]=blocking[i];
 
@@ -86,13 +93,17 @@ void EnzoInitialHdf5::pup (PUP::er &p)
   p | field_datasets_;
   p | field_coords_;
   p | field_names_;
+  p | field_levels_;
 
   p | particle_files_;
   p | particle_datasets_;
   p | particle_coords_;
   p | particle_types_;
   p | particle_attributes_;
+  p | particle_levels_;
+  p | l_particle_displacements_;
   PUParray (p,particle_position_names_,3);
+  p | use_mmap_;
 
 }
 
@@ -115,8 +126,7 @@ void EnzoInitialHdf5::enforce_block
 
   // Assert: to reach this point, block must be a reading block
 
-  FieldLoader field_loader(block, format_);
-  ParticleLoader particle_loader(block, l_particle_displacements_, format_);
+  FieldLoader field_loader(block, format_, use_mmap_);
   int min_level = cello::hierarchy()->min_level();
 
   // Maintain running count of messages sent
@@ -137,20 +147,20 @@ void EnzoInitialHdf5::enforce_block
               field_loader);
   }
 
-  // Read in particle files
-  for (size_t index=0; index<particle_files_.size(); index++) {
-    int level = particle_levels_[index];
-    if (level > max_level_) {continue;}
-    particle_loader.open_file(particle_files_[index],
-                              particle_types_[index],
-                              particle_attributes_[index],
-                              particle_coords_[index],
-                              particle_datasets_[index]);
-    load_data(count_messages[level],
-              block,
-              level,
-              min_level,
-              particle_loader);
+  // Read in particle files, grouped by level so that all particle
+  // attributes for a block are sent in a single message
+  for (int level = 0; level <= max_level_; level++) {
+    std::vector<int> particle_indices;
+    for (size_t index=0; index<particle_files_.size(); index++) {
+      if (particle_levels_[index] == level) particle_indices.push_back(index);
+    }
+    if (! particle_indices.empty()) {
+      load_particles(count_messages[level],
+                     block,
+                     level,
+                     min_level,
+                     particle_indices);
+    }
   }
 
   // Update all blocks in range of this reader with the number of messages sent to them.
@@ -203,6 +213,73 @@ void EnzoInitialHdf5::load_data(int & count_messages,
   loader.close_file();
 }
 
+void EnzoInitialHdf5::load_particles(int & count_messages,
+                                     Block * block,
+                                     int level, int min_level,
+                                     const std::vector<int> & particle_indices) {
+  // Count number of messages to send per block
+  ++count_messages;
+
+  // Open all particle files at this level together, so that each
+  // block's attributes are read into one array and sent as soon as
+  // they are read, overlapping sends with reading the next block
+  std::vector< std::unique_ptr<ParticleLoader> > loaders;
+  for (int index : particle_indices) {
+    loaders.emplace_back(new ParticleLoader
+                         (block, l_particle_displacements_, format_, use_mmap_));
+    loaders.back()->open_file(particle_files_[index],
+                              particle_types_[index],
+                              particle_attributes_[index],
+                              particle_coords_[index],
+                              particle_datasets_[index]);
+  }
+
+  int lower[3], upper[3];
+  get_reader_range(block->index(), lower, upper, level);
+  int region_lower[3];
+  cello::hierarchy()->refined_region_lower(region_lower, level-1);
+
+  for (int ax = lower[0]; ax < upper[0]; ax++) {
+    for (int ay = lower[1]; ay < upper[1]; ay++) {
+      for (int az = lower[2]; az < upper[2]; az++) {
+        int block_index[3] = {ax, ay, az};
+        for (int i = 0; i < 3; i++) block_index[i] -= (region_lower[i] << 1);
+        Index index_block = block->index_from_global(ax, ay, az, level, min_level);
+
+        int bytes = 0;
+        for (auto & loader : loaders) bytes += loader->block_bytes();
+        char * data = new char[bytes];
+
+        int offset = 0;
+        for (auto & loader : loaders) {
+          loader->read_block(data + offset, index_block, block_index);
+          offset += loader->block_bytes();
+        }
+
+        if (index_block == block->index()) {
+          offset = 0;
+          for (auto & loader : loaders) {
+            loader->copy_data_local(data + offset);
+            offset += loader->block_bytes();
+          }
+          delete [] data;
+        } else {
+          MsgInitial * msg_initial = new MsgInitial;
+          offset = 0;
+          for (auto & loader : loaders) {
+            loader->add_to_msg(msg_initial, offset);
+            offset += loader->block_bytes();
+          }
+          // message takes ownership of data
+          msg_initial->set_particle_list_data(data, bytes);
+          enzo::block_array()[index_block].p_initial_hdf5_recv(msg_initial);
+        }
+      }
+    }
+  }
+  for (auto & loader : loaders) loader->close_file();
+}
+
 void EnzoInitialHdf5::get_reader_range(Index reader_index, int lower[3], int upper[3], int level) throw() {
   // Get the lower and upper values defining the region of parent blocks at level-1
   // which refine to create the blocks on the given level.
@@ -246,7 +323,8 @@ void EnzoInitialHdf5::recv_data (Block * block, MsgInitial * msg_initial)
   const int blocking = (blocking_[0]*blocking_[1]*blocking_[2]-1);
   if (monitor_iter_ &&
       (msg_initial->data_type()!="field" &&
-       msg_initial->data_type()!="particle") &&
+       msg_initial->data_type()!="particle" &&
+       msg_initial->data_type()!="particle_list") &&
       ((count_monitor == 0 || count_monitor == count-1) ||
        ((count_monitor % (monitor_iter_*blocking)) == 0))) {
     cello::monitor()->print("Initial", "hdf5 %d / %d",
@@ -268,6 +346,13 @@ void EnzoInitialHdf5::recv_data (Block * block, MsgInitial * msg_initial)
     particle_loader.read_msg(msg_initial, &data);
     particle_loader.copy_data_local(data);
 
+  } else if (msg_initial->data_type() == "particle_list") {
+    ParticleLoader particle_loader(block, l_particle_displacements_, format_);
+    for (int i=0; i<msg_initial->num_particle_list(); i++) {
+      char * data;
+      particle_loader.read_msg_list(msg_initial, i, &data);
+      particle_loader.copy_data_local(data);
+    }
   }
 
   if (sync_msg->next()) {
@@ -338,12 +423,11 @@ void EnzoInitialHdf5::initialize_particle_mass(Block * block) {
 
 template <class T>
 void EnzoInitialHdf5::initialize_particle_mass(T * array, Particle particle, int it, int ia, T mass) {
-  int np = particle.num_particles(it);
-  for (int ip=0; ip<np; ip++) {
-    int ib, io;
-    particle.index(ip,&ib,&io);
+  const int ps = particle.stride(it,ia);
+  for (int ib=0; ib<particle.num_batches(it); ib++) {
+    const int np = particle.num_particles(it,ib);
     array = (T*) particle.attribute_array(it,ia,ib);
-    array[io] = mass;
+    for (int ip=0; ip<np; ip++) array[ip*ps] = mass;
   }
 }
 
@@ -353,7 +437,12 @@ void EnzoInitialHdf5::initialize_particle_mass(T * array, Particle particle, int
 
 
 //=========================================================================
-DataLoader::DataLoader(Block* block, std::string format) : block(block), m4()
+DataLoader::DataLoader(Block* block, std::string format, bool use_mmap)
+  : block(block), file(nullptr), m4(), o4(),
+    use_mmap_(use_mmap),
+    map_(nullptr),
+    map_bytes_(0),
+    map_offset_(-1)
 {
   Field field = block->data()->field();
   // int index_field = field.field_id(name);
@@ -382,17 +471,32 @@ void DataLoader::open_file(std::string filename, std::string dataset, std::strin
             (type_data == type_double) ) );
 
   coords = coordinates;
+
+  if (use_mmap_) map_file_(filename);
+}
+
+void DataLoader::close_file() {
+  unmap_file_();
+  file->data_close();
+  file->file_close();
+  delete file;
+  file = nullptr;
 }
 
 void DataLoader::load(int* block_index, Index index_block) {
   char * data;
   read_dataset_(&data, index_block, block_index);
 
-  (index_block == block->index()) ? copy_data_local(data) : copy_data_remote(index_block, data);
-  delete_array_(&data, type_data);
+  if (index_block == block->index()) {
+    copy_data_local(data);
+    delete_array_(&data, type_data);
+  } else {
+    // message takes ownership of data
+    copy_data_remote(index_block, data);
+  }
 }
 
-void DataLoader::read_dataset_(char ** data, Index index_block, int block_index[3])
+void DataLoader::select_dataset_(Index index_block, int block_index[3])
 {
   // Get the grid size at level_
   // Hierarchy * hierarchy = cello::simulation()->hierarchy();
@@ -426,7 +530,7 @@ void DataLoader::read_dataset_(char ** data, Index index_block, int block_index[
   h4[IZ] = (upper_block[2] - lower_block[2]) / (nz << index_block.level());
 
   // determine offsets
-  int o4[4] = {0,0,0,0};
+  o4[0] = o4[1] = o4[2] = o4[3] = 0;
   o4[IX] = block_index[0]*nx;
   o4[IY] = block_index[1]*ny;
   o4[IZ] = block_index[2]*nz;
@@ -436,37 +540,134 @@ void DataLoader::read_dataset_(char ** data, Index index_block, int block_index[
     (m4[0],m4[1],m4[2],m4[3],
      n4[0],n4[1],n4[2],n4[3],
      o4[0],o4[1],o4[2],o4[3]);
+}
 
-  // create memory space
-  // (fields was n4[(*IX)], n4[(*IY)], n4[(*IZ)])
-  file->mem_create (nx,ny,nz,nx,ny,nz,0,0,0);
+void DataLoader::read_dataset_(char ** data, Index index_block, int block_index[3])
+{
+  select_dataset_(index_block, block_index);
 
   // input domain size
   const int n = nx*ny*nz;
   (*data) = allocate_array_ (n, type_data);
-  file->data_read ((*data));
+  read_selection_((*data), type_data, nx,ny,nz, 0,0,0);
 }
 
-void DataLoader::delete_array_(char ** array, int type_data)
+void DataLoader::read_selection_
+(char * array, int type_array,
+ int mx, int my, int mz,
+ int gx, int gy, int gz)
 {
-  if (type_data == type_single) {
-    delete [] (float*)(*array);
-  } else if (type_data == type_double) {
-    delete [] (double*)(*array);
+  // Read the selected block region of the dataset into the (x-fastest)
+  // array of size mx*my*mz, offset by ghost depths (gx,gy,gz), and
+  // converted to type_array
+
+  if (map_ != nullptr) {
+
+    const char * data = map_ + map_offset_;
+    if (type_array == type_single) {
+      if (type_data == type_single) {
+        copy_mapped_((float *)array,(const float *)data, mx,my,mz,gx,gy,gz);
+      } else {
+        copy_mapped_((float *)array,(const double *)data,mx,my,mz,gx,gy,gz);
+      }
+    } else if (type_array == type_double) {
+      if (type_data == type_single) {
+        copy_mapped_((double *)array,(const float *)data, mx,my,mz,gx,gy,gz);
+      } else {
+        copy_mapped_((double *)array,(const double *)data,mx,my,mz,gx,gy,gz);
+      }
+    } else {
+      ERROR1 ("DataLoader::read_selection_()",
+              "Unsupported array type %d",type_array);
+    }
+
   } else {
-    ERROR1 ("DataLoader::delete_array_()",
-            "Unsupported data type %d",type_data);
+
+    // memory space in HDF5 (slowest to fastest) order, matching the
+    // file selection with its x-axis fastest
+    file->mem_create (mz,my,mx,nz,ny,nx,gz,gy,gx);
+    file->data_read_type (array, type_array);
+    file->mem_close();
+
+  }
+}
+
+template <class T, class S>
+void DataLoader::copy_mapped_
+(T * array, const S * data,
+ int mx, int my, int mz,
+ int gx, int gy, int gz) const
+{
+  // map_file_() ensures IX == 3, so rows along x are contiguous
+  int k4[4] = {o4[0],o4[1],o4[2],o4[3]};
+  for (int iz=0; iz<nz; iz++) {
+    k4[IZ] = o4[IZ] + iz;
+    for (int iy=0; iy<ny; iy++) {
+      k4[IY] = o4[IY] + iy;
+      const long long k =
+        k4[3] + (long long)(m4[3])*(k4[2] + m4[2]*(k4[1] + m4[1]*k4[0]));
+      const S * row = data + k;
+      T * dest = array + gx + mx*((iy+gy) + my*(iz+gz));
+      for (int ix=0; ix<nx; ix++) dest[ix] = row[ix];
+    }
+  }
+}
+
+void DataLoader::map_file_(std::string filename)
+{
+  // Only uncompressed contiguous datasets in native byte order with
+  // the x-axis fastest can be accessed in place; otherwise read
+  // through HDF5
+  map_offset_ = file->data_offset();
+  if (map_offset_ < 0 || coords.find("x") != 3) return;
+
+  const int fd = ::open (filename.c_str(), O_RDONLY);
+  if (fd < 0) return;
+
+  struct stat file_stat;
+  if (fstat (fd,&file_stat) == 0 && file_stat.st_size > 0) {
+    void * map = mmap (nullptr, file_stat.st_size,
+                       PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map != MAP_FAILED) {
+      map_ = (char *) map;
+      map_bytes_ = file_stat.st_size;
+    }
+  }
+  ::close (fd);
+
+  // the mapping stays valid after closing the file descriptor
+  if (map_ != nullptr) {
+    const long long bytes = (long long)(m4[0])*m4[1]*m4[2]*m4[3]*
+      ((type_data == type_single) ? sizeof(float) : sizeof(double));
+    ASSERT3 ("DataLoader::map_file_()",
+             "Dataset in file %s extends past end of file (%lld > %lld)",
+             filename.c_str(), map_offset_+bytes, (long long)map_bytes_,
+             (map_offset_ + bytes <= (long long)map_bytes_));
   }
+}
+
+void DataLoader::unmap_file_()
+{
+  if (map_ != nullptr) munmap (map_, map_bytes_);
+  map_ = nullptr;
+  map_bytes_ = 0;
+  map_offset_ = -1;
+}
+
+void DataLoader::delete_array_(char ** array, int type_data)
+{
+  delete [] (*array);
   (*array) = nullptr;
 }
 
 char * DataLoader::allocate_array_ (int n, int type_data)
 {
+  // allocated as char so MsgInitial can take ownership
   char * data;
   if (type_data == type_single) {
-    data = (char *)new float [n];
+    data = new char [n*sizeof(float)];
   } else if (type_data == type_double) {
-    data = (char *)new double [n];
+    data = new char [n*sizeof(double)];
   } else {
     data = nullptr;
     ERROR1 ("DataLoader::allocate_array_()",
@@ -523,6 +724,20 @@ void DataLoader::check_cosmology_(File * file) const
 
 
 
+void FieldLoader::load(int * block_index, Index index_block) {
+  if (index_block == block->index()) {
+    // Destination is this block--read directly into the field
+    select_dataset_(index_block, block_index);
+    Field field = block->data()->field();
+    const int index_field = field.field_id(name);
+    field.dimensions (index_field,&mx,&my,&mz);
+    read_selection_(field.values(index_field), type_enzo_float,
+                    mx,my,mz, gx,gy,gz);
+  } else {
+    DataLoader::load(block_index, index_block);
+  }
+}
+
 void FieldLoader::read_msg(MsgInitial * msg_initial, char ** data) {
   msg_initial->get_dataset(n4,h4,&nx,&ny,&nz,&IX,&IY,&IZ);
   msg_initial->get_field_data(&name, data, &type_data);
@@ -538,7 +753,7 @@ void FieldLoader::copy_data_local(char * data) {
 void FieldLoader::copy_data_remote(Index index_block, char * data) {
   MsgInitial * msg_initial = new MsgInitial;
   msg_initial->set_dataset(n4,h4,nx,ny,nz,IX,IY,IZ);
-  msg_initial->set_field_data(name, data, nx*ny*nz, type_data);
+  msg_initial->set_field_data(name, data, nx*ny*nz, type_data, false);
   enzo::block_array()[index_block].p_initial_hdf5_recv(msg_initial);
 }
 
@@ -581,6 +796,31 @@ void ParticleLoader::read_msg(MsgInitial * msg_initial, char ** data) {
                                  data,&data_size,&type_data);
 }
 
+void ParticleLoader::read_msg_list(MsgInitial * msg_initial, int i, char ** data) {
+  msg_initial->get_dataset (n4,h4,&nx,&ny,&nz,&IX,&IY,&IZ);
+  int data_size;
+  msg_initial->get_particle_list(i, &type, &attribute,
+                                 data,&data_size,&type_data);
+}
+
+int ParticleLoader::block_bytes() const {
+  const int bytes = nx*ny*nz*
+    ((type_data == type_single) ? sizeof(float) : sizeof(double));
+  // keep each attribute in a shared array aligned for doubles
+  return ((bytes + 7) / 8) * 8;
+}
+
+void ParticleLoader::read_block(char * data, Index index_block, int * block_index) {
+  select_dataset_(index_block, block_index);
+  read_selection_(data, type_data, nx,ny,nz, 0,0,0);
+}
+
+void ParticleLoader::add_to_msg(MsgInitial * msg_initial, int offset) {
+  msg_initial->set_dataset (n4,h4,nx,ny,nz,IX,IY,IZ);
+  msg_initial->add_particle_list(type, attribute, offset,
+                                 nx*ny*nz, type_data);
+}
+
 void ParticleLoader::copy_data_local(char * data) {
   copy_dataset_to_particle_(data);
 }
@@ -589,7 +829,7 @@ void ParticleLoader::copy_data_remote(Index index_block, char * data) {
   MsgInitial * msg_initial = new MsgInitial;
   msg_initial->set_dataset (n4,h4,nx,ny,nz,IX,IY,IZ);
   msg_initial->set_particle_data(type, attribute,
-                                data, nx*ny*nz, type_data);
+                                data, nx*ny*nz, type_data, false);
   enzo::block_array()[index_block].p_initial_hdf5_recv(msg_initial);
 }
 
@@ -669,11 +909,14 @@ template <class T, class S>
 void ParticleLoader::copy_particle_data_to_array_
 (T * array, S * data, Particle particle, int it, int ia, int np)
 {
-  for (int ip=0; ip<np; ip++) {
-    int ib,io;
-    particle.index(ip,&ib,&io);
+  // copy batch by batch rather than looking up each particle's batch
+  const int ps = particle.stride(it,ia);
+  int ip0 = 0;
+  for (int ib=0; ib<particle.num_batches(it) && ip0<np; ib++) {
+    const int npb = std::min(particle.num_particles(it,ib), np-ip0);
     array = (T*)particle.attribute_array(it,ia,ib);
-    array[io] = data[ip];
+    for (int ip=0; ip<npb; ip++) array[ip*ps] = data[ip0+ip];
+    ip0 += npb;
   }
 }
 
@@ -687,15 +930,22 @@ void ParticleLoader::update_particle_displacements_
   const int by = (axis == 1) ? 1 : 0;
   const int bz = (axis == 2) ? 1 : 0;
 
+  // particles are stored in order, so step through batches rather
+  // than looking up each particle's batch
+  const int ps = particle.stride(it,ia);
+  int ib = 0;
+  int io = 0;
+  int npb = particle.num_particles(it,ib);
+  array = ( T *) particle.attribute_array(it,ia,ib);
   for (int iz=0; iz<nz; iz++) {
     for (int iy=0; iy<ny; iy++) {
       for (int ix=0; ix<nx; ix++) {
-        int ip = ix + nx*(iy + ny*iz);
-        int ib,io;
-        // get batch and offset into batch for the ip'th particle
-        particle.index(ip,&ib,&io);
-        array = ( T *) particle.attribute_array(it,ia,ib);
-        array[io] += lower + h*(bx*ix+by*iy+bz*iz + 0.5);
+        if (io == npb) {
+          io = 0;
+          npb = particle.num_particles(it,++ib);
+          array = ( T *) particle.attribute_array(it,ia,ib);
+        }
+        array[(io++)*ps] += lower + h*(bx*ix+by*iy+bz*iz + 0.5);
       }
     }
   }
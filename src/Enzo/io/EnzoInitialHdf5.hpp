@@ -20,22 +20,23 @@ class DataLoader {
   public: // interface
 
     // Constructor
-    DataLoader(Block* block, std::string format);
+    DataLoader(Block* block, std::string format, bool use_mmap = false);
+
+    // Destructor
+    virtual ~DataLoader() { unmap_file_(); }
 
     // Open the given dataset in the given HDF5 file.
     virtual void open_file(std::string filename, std::string dataset, std::string coordinates);
 
     // Close any file which may be opened.
-    void close_file() {
-      file->data_close();
-      file->file_close();
-    }
+    void close_file();
 
     // Load data from an opened file into the block with the given
     // block index.
-    void load(int * block_index, Index index_block);
+    virtual void load(int * block_index, Index index_block);
 
-    // Copy data to a local or remote block.
+    // Copy data to a local block, or send it to a remote block.  The
+    // remote copy takes ownership of data.
     virtual void copy_data_local(char * data) {}
     virtual void copy_data_remote(Index index_block, char * data) {}
 
@@ -44,8 +45,19 @@ class DataLoader {
     void delete_array_(char ** array, int type_data);
     char * allocate_array_(int n, int type_data);
     void read_dataset_(char ** data, Index index_block, int block_index[3]);
+    void select_dataset_(Index index_block, int block_index[3]);
+    void read_selection_(char * array, int type_array,
+                         int mx, int my, int mz,
+                         int gx, int gy, int gz);
+    void map_file_(std::string filename);
+    void unmap_file_();
     void check_cosmology_(File * file) const;
 
+    template <class T, class S>
+    void copy_mapped_(T * array, const S * data,
+                      int mx, int my, int mz,
+                      int gx, int gy, int gz) const;
+
     // Attributes
     Block * block;
     FileHdf5 * file;
@@ -53,8 +65,15 @@ class DataLoader {
     double lower_block[3], upper_block[3];
     int nx, ny, nz, IX, IY, IZ;
     double h4[4];
-    int m4[4], n4[4];
+    int m4[4], n4[4], o4[4];
     std::string coords, format_;
+
+    // Whether to read contiguous datasets through mmap()
+    bool use_mmap_;
+    // Mapped file, or nullptr if the dataset is read through HDF5
+    char * map_;
+    size_t map_bytes_;
+    long long map_offset_;
 };
 
 
@@ -69,7 +88,8 @@ class FieldLoader : public DataLoader {
   public: // interface
 
     // FieldLoader Constructor
-    FieldLoader(Block* block, std::string format) : DataLoader(block, format) {
+    FieldLoader(Block* block, std::string format, bool use_mmap = false)
+      : DataLoader(block, format, use_mmap) {
       Field field = block->data()->field();
       field.ghost_depth(0,&gx,&gy,&gz);
       field.dimensions (0,&mx,&my,&mz);
@@ -84,6 +104,10 @@ class FieldLoader : public DataLoader {
       name = field_name;
     }
 
+    // Read field data directly into the local block, or into a
+    // buffer sent to a remote block
+    virtual void load(int * block_index, Index index_block);
+
     // Load field data from received MsgInitial message.
     void read_msg(MsgInitial * msg_initial, char ** data);
     virtual void copy_data_local(char * data);
@@ -115,8 +139,9 @@ class ParticleLoader : public DataLoader {
     // ParticleLoader Constructor
     ParticleLoader(Block* block, 
                    bool particle_displacements,
-                   std::string format
-                   ) : DataLoader(block, format) {
+                   std::string format,
+                   bool use_mmap = false
+                   ) : DataLoader(block, format, use_mmap) {
       l_particle_displacements_ = particle_displacements;
     }
 
@@ -134,6 +159,20 @@ class ParticleLoader : public DataLoader {
     // Load particle data from received MsgInitial message.
     void read_msg(MsgInitial * msg_initial, char ** data);
 
+    // Load the i'th particle attribute from a received "particle_list"
+    // MsgInitial message
+    void read_msg_list(MsgInitial * msg_initial, int i, char ** data);
+
+    // Number of bytes, padded for alignment, for one block's data
+    int block_bytes() const;
+
+    // Read the block's particle attribute into the given array
+    void read_block(char * data, Index index_block, int * block_index);
+
+    // Add this loader's attribute stored at the given byte offset to
+    // a "particle_list" message
+    void add_to_msg(MsgInitial * msg_initial, int offset);
+
     virtual void copy_data_local(char * data);
     virtual void copy_data_remote(Index index_block, char * data);
 
@@ -179,7 +218,8 @@ public: // interface
                   std::vector < std::string > particle_coords,
                   std::vector < std::string > particle_types,
                   std::vector < std::string > particle_attributes,
-                  std::vector < int >         particle_levels
+                  std::vector < int >         particle_levels,
+                  bool                        use_mmap = false
                   ) throw();
 
   /// Constructor
@@ -193,6 +233,7 @@ public: // interface
   EnzoInitialHdf5(CkMigrateMessage *m)
     : Initial (m),
       max_level_(0),
+      use_mmap_(false),
       i_sync_msg_(-1)
   {  }
 
@@ -215,6 +256,11 @@ public: // interface
   // Use the provided DataLoader to load data onto blocks at the specified level.
   void load_data(int & count_messages, Block * block, int level, int min_level, DataLoader & loader);
 
+  // Load all particle attributes with the given file indices onto
+  // blocks at the specified level, sending one message per block
+  void load_particles(int & count_messages, Block * block, int level, int min_level,
+                      const std::vector<int> & particle_indices);
+
     // initialize particle masses from root level mass constant.
   void initialize_particle_mass(Block * block);
 
@@ -270,6 +316,10 @@ protected: // attributes
   bool l_particle_displacements_;
   std::string particle_position_names_[3];
 
+  /// Whether to read uncompressed contiguous datasets through mmap()
+  /// instead of HDF5
+  bool use_mmap_;
+
   /// Index of the Sync object for counting incoming messages if not
   /// a reader; used to call initial_done() (only) after all expected
   /// messages have been received
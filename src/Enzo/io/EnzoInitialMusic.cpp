@@ -626,10 +626,13 @@ void EnzoInitialMusic::copy_particle_data_to_array_
 (T * array, S * data,
  Particle particle, int it, int ia, int np)
 {
-  for (int ip=0; ip<np; ip++) {
-    int ib,io;
-    particle.index(ip,&ib,&io);
+  // copy batch by batch rather than looking up each particle's batch
+  const int ps = particle.stride(it,ia);
+  int ip0 = 0;
+  for (int ib=0; ib<particle.num_batches(it) && ip0<np; ib++) {
+    const int npb = std::min(particle.num_particles(it,ib), np-ip0);
     array = (T*)particle.attribute_array(it,ia,ib);
-    array[io] = data[ip];
+    for (int ip=0; ip<npb; ip++) array[ip*ps] = data[ip0+ip];
+    ip0 += npb;
   }
 }
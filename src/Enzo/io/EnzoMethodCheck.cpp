@@ -50,14 +50,30 @@ EnzoMethodCheck::EnzoMethodCheck
   Refresh * refresh = cello::refresh(ir_post_);
   cello::simulation()->refresh_set_name(ir_post_,name());
   refresh->add_field("density");
-  // Create IO writer
+
+  // Block scalars for delta checkpoints: a hash of each field at the
+  // last full checkpoint, and the file the Block was written to
+  if (enzo::config()->method_check_delta_interval > 0) {
+    FieldDescr * field_descr = cello::field_descr();
+    ScalarDescr * scalar_descr = cello::scalar_descr_long_long();
+    for (int i_f=0; i_f<field_descr->field_count(); i_f++) {
+      scalar_descr->new_value("check:hash:" + field_descr->field_name(i_f));
+    }
+    scalar_descr->new_value("check:file");
+  }
+
+  // Create IO writers: one per file, or num_aggregators spread
+  // evenly over the nodes, num_aggregators / num_files per file
   if (CkMyPe() == 0) {
 
-    enzo::simulation()->set_sync_check_writer(num_files_);
+    const int num_aggregators = enzo::config()->method_check_num_aggregators;
+    const int num_writers = (num_aggregators > 0) ? num_aggregators : num_files;
+
+    enzo::simulation()->set_sync_check_writer(num_writers);
 
-    CProxy_MappingIo io_map  = CProxy_MappingIo::ckNew(num_files);
+    CProxy_MappingIo io_map  = CProxy_MappingIo::ckNew(num_writers);
 
-    CkArrayOptions opts(num_files);
+    CkArrayOptions opts(num_writers);
     opts.setMap(io_map);
     proxy_io_enzo_writer = CProxy_IoEnzoWriter::ckNew
       (num_files, ordering,monitor_iter, include_ghosts_, opts);
@@ -117,7 +133,50 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
   check_num_files_  = enzo::config()->method_check_num_files;
   check_ordering_   = enzo::config()->method_check_ordering;
   check_directory_  = enzo::config()->method_check_dir;
+  check_async_      = enzo::config()->method_check_async;
+
+  // Write memory_interval in-memory checkpoints between successive
+  // disk checkpoints
+  const int memory_interval = enzo::config()->method_check_memory_interval;
+
+  if (memory_interval > 0 && check_memory_count_ < memory_interval) {
+    ++check_memory_count_;
+    if (check_async_active_) {
+      // Chares are in the middle of writing the previous disk
+      // checkpoint: skip this in-memory checkpoint
+      enzo::block_array().p_check_done();
+    } else {
+#if CMK_MEM_CHECKPOINT
+      // Each PE keeps its own and a buddy PE's chare data; after a
+      // failure Charm++ restores it and calls r_check_memory_done()
+      CkCallback callback (CkIndex_EnzoSimulation::r_check_memory_done(),
+                           proxy_enzo_simulation[0]);
+      CkStartMemCheckpoint (callback);
+#else
+      ERROR("EnzoSimulation::r_method_check_enter()",
+            "Method:check:memory_interval requires Charm++ built "
+            "with syncft for in-memory checkpointing");
+#endif
+    }
+    return;
+  }
+
+  check_memory_count_ = 0;
+
+  if (check_async_active_) {
+    // Only one asynchronous checkpoint is staged at a time: Blocks
+    // wait in EnzoMethodCheck until the previous one is written
+    check_async_deferred_ = true;
+  } else {
+    check_start_();
+  }
+}
+
+//----------------------------------------------------------------------
 
+void EnzoSimulation::check_start_()
+// [ Called on ip=0 only ]
+{
   /// Initialize synchronization counters
   sync_check_done_.          set_stop(check_num_files_);
 
@@ -134,6 +193,24 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
   } else {
     // Else start checkpoint
 
+    // Write a delta checkpoint unless delta_interval deltas have
+    // been written since the last full checkpoint
+    const int delta_interval = enzo::config()->method_check_delta_interval;
+    check_is_delta_ = (delta_interval > 0 && check_base_dir_ != "" &&
+                       check_delta_count_ < delta_interval);
+    if (check_is_delta_) {
+      ++check_delta_count_;
+      // Manifest naming the full checkpoint that holds unchanged data
+      std::ofstream stream_delta (name_dir + "/check.delta");
+      ASSERT1("EnzoSimulation::check_start_()",
+              "Cannot open delta manifest in %s for writing",
+              name_dir.c_str(),stream_delta);
+      stream_delta << check_base_dir_ << "\n";
+    } else {
+      check_delta_count_ = 0;
+      check_base_dir_ = name_dir;
+    }
+
     // Create hierarchy file if root writer
 
     std::string name_file = name_dir + "/check.file_list";
@@ -151,8 +228,17 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
     }
     stream_file_list.flush();
 
-    enzo::block_array().p_check_write_first
-      (check_num_files_, check_ordering_, name_dir);
+    if (check_async_) {
+      // Open files before Blocks continue so that the Simulation
+      // metadata written is that of the checkpoint cycle
+      check_async_active_ = true;
+      check_name_dir_ = name_dir;
+      sync_check_opened_.set_stop(check_num_files_);
+      proxy_io_enzo_writer.p_open_async(name_dir);
+    } else {
+      enzo::block_array().p_check_write_first
+        (check_num_files_, check_ordering_, check_is_delta_, name_dir);
+    }
   }
   // Create IoEnzoWriter array. Synchronizes by calling
   // EnzoSimulation[0]::p_writer_created() when done
@@ -161,6 +247,18 @@ void EnzoSimulation::r_method_check_enter(CkReductionMsg *msg)
 
 //----------------------------------------------------------------------
 
+void EnzoSimulation::p_check_opened()
+// [ Called on ip=0 only ]
+{
+  TRACE_CHECK("[3a] EnzoSimulation::p_check_opened()");
+  if (sync_check_opened_.next()) {
+    enzo::block_array().p_check_write_async
+      (check_num_files_, check_ordering_, check_is_delta_, check_name_dir_);
+  }
+}
+
+//----------------------------------------------------------------------
+
 IoEnzoWriter::IoEnzoWriter
 (int num_files,
  std::string ordering,
@@ -169,8 +267,16 @@ IoEnzoWriter::IoEnzoWriter
   : CBase_IoEnzoWriter(),
     num_files_(num_files),
     ordering_(ordering),
+    stream_block_list_(),
+    file_(nullptr),
+    native_file_(nullptr),
     monitor_iter_(monitor_iter),
-    include_ghosts_(include_ghosts)
+    include_ghosts_(include_ghosts),
+    msg_check_pending_(),
+    index_block_next_(-1),
+    count_block_(0),
+    name_dir_(),
+    has_token_(false)
 {
   TRACE_CHECK("[4] IoEnzoWriter::IoEnzoWriter()");
 }
@@ -178,16 +284,24 @@ IoEnzoWriter::IoEnzoWriter
 //----------------------------------------------------------------------
 
 void EnzoBlock::p_check_write_first
-(int num_files, std::string ordering, std::string name_dir)
+(int num_files, std::string ordering, bool is_delta, std::string name_dir)
 {
   TRACE_CHECK_BLOCK("[8] EnzoBlock::p_check_write_first",this);
 
   EnzoMsgCheck * msg_check;
   bool is_first (false);
   const int index_file = create_msg_check_
-    (&msg_check,num_files,ordering,name_dir,&is_first);
+    (&msg_check,num_files,ordering,is_delta,name_dir,&is_first);
 
-  if (is_first) {
+  const int num_aggregators = enzo::config()->method_check_num_aggregators;
+
+  if (num_aggregators > 0) {
+    // Every Block sends its data to the aggregator of its segment of
+    // the ordering, which is on the same node for balanced orderings
+    const int index_aggregator =
+      msg_check->index_block_*num_aggregators/msg_check->count_block_;
+    proxy_io_enzo_writer[index_aggregator].p_write_aggregate (msg_check);
+  } else if (is_first) {
     proxy_io_enzo_writer[index_file].p_write (msg_check);
   } else {
     delete msg_check;
@@ -196,20 +310,55 @@ void EnzoBlock::p_check_write_first
 
 //----------------------------------------------------------------------
 
-void EnzoBlock::p_check_write_next(int num_files, std::string ordering)
+void EnzoBlock::p_check_write_next
+(int num_files, std::string ordering, bool is_delta)
 {
   TRACE_CHECK_BLOCK("[9] EnzoBlock::p_check_write_next",this);
 
   std::string name_dir {""};
   EnzoMsgCheck * msg_check;
   const int index_file = create_msg_check_
-    (&msg_check,num_files,ordering);
+    (&msg_check,num_files,ordering,is_delta);
 
   proxy_io_enzo_writer[index_file].p_write (msg_check);
 }
 
 //----------------------------------------------------------------------
 
+void EnzoBlock::p_check_write_async
+(int num_files, std::string ordering, bool is_delta, std::string name_dir)
+{
+  TRACE_CHECK_BLOCK("[9a] EnzoBlock::p_check_write_async",this);
+
+  EnzoMsgCheck * msg_check;
+  bool is_first (false);
+  const int index_file = create_msg_check_
+    (&msg_check,num_files,ordering,is_delta,name_dir,&is_first);
+
+  msg_check->stage_pe_    = CkMyPe();
+  msg_check->stage_bytes_ = msg_check->size_();
+  const long long bytes = msg_check->stage_bytes_;
+
+  // Messages to a remote writer are packed when sent, which copies
+  // the Block data; a local writer would instead receive pointers into
+  // the Block, so explicitly pack and unpack to stage a snapshot
+
+  if (proxy_io_enzo_writer[index_file].ckLocal() != nullptr) {
+    msg_check = EnzoMsgCheck::unpack(EnzoMsgCheck::pack(msg_check));
+  }
+
+  proxy_io_enzo_writer[index_file].p_write_async (msg_check);
+
+  // Continue unless the staging budget on this process is exceeded,
+  // in which case p_check_done() is called when enough is written
+
+  if (enzo::simulation()->check_stage(index(),bytes)) {
+    compute_done();
+  }
+}
+
+//----------------------------------------------------------------------
+
 void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
 {
   TRACE_CHECK("[A] IoEnzoWriter::p_write");
@@ -223,60 +372,240 @@ void IoEnzoWriter::p_write (EnzoMsgCheck * msg_check)
     (index_this,index_next,name_this,name_next,
      index_block,is_first,is_last,name_dir);
 
-  if (thisIndex == 0 && monitor_iter_ &&
-      ((is_first || is_last) || ((index_block % monitor_iter_) == 0))) {
-    cello::monitor()->print("Method", "check %d",index_block);
+  if (is_first) {
+    file_open_block_data_(name_dir,thisIndex);
   }
-  
-  // Write to block list file, opening or closing file as needed
 
-  if (is_first) {
+  const bool is_delta = msg_check->is_delta_;
+
+  write_msg_check_(msg_check);
+
+  delete msg_check;
+
+  if (!is_last) {
+    enzo::block_array()[index_next].p_check_write_next
+      (num_files_, ordering_, is_delta);
+  } else {
+    proxy_enzo_simulation[0].p_check_done();
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::p_open_async (std::string name_dir)
+{
+  TRACE_CHECK("[A1] IoEnzoWriter::p_open_async");
 
-    // Create HDF5 file
+  file_open_block_data_(name_dir,thisIndex);
+
+  proxy_enzo_simulation[0].p_check_opened();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::p_write_async (EnzoMsgCheck * msg_check)
+{
+  TRACE_CHECK("[A2] IoEnzoWriter::p_write_async");
+
+  msg_check_pending_[msg_check->index_block_] = msg_check;
+
+  // Write pending Blocks in order, starting with the file's first
+
+  while (! msg_check_pending_.empty()) {
+
+    auto it = msg_check_pending_.begin();
+    EnzoMsgCheck * msg = it->second;
+
+    if (index_block_next_ < 0 && msg->is_first_) {
+      index_block_next_ = it->first;
+    }
+    if (it->first != index_block_next_) break;
 
-    std::stringstream stream_block_list;
-    stream_block_list << std::setfill('0');
-    int max_digits = log(num_files_-1)/log(10) + 1;
-    stream_block_list << "block_data-" << std::setw(max_digits) << thisIndex;
+    msg_check_pending_.erase(it);
+    ++index_block_next_;
 
-    // Create block list
-    stream_block_list_ = create_block_list_
-      (name_dir,stream_block_list.str()+".block_list");
+    const bool is_last   = msg->is_last_;
+    const int stage_pe   = msg->stage_pe_;
+    const long long stage_bytes = msg->stage_bytes_;
 
-    std::string name_file = stream_block_list.str() + ".h5";
-    file_ = file_open_(name_dir,name_file);
+    write_msg_check_(msg);
 
-    // Write HDF5 header meta data
-    file_write_hierarchy_();
+    delete msg;
+
+    proxy_enzo_simulation[stage_pe].p_check_unstage(stage_bytes);
+
+    if (is_last) {
+      index_block_next_ = -1;
+      proxy_enzo_simulation[0].p_check_done();
+    }
   }
+}
 
-  // Write block list
-  write_block_list_(name_this, msg_check->block_level());
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::file_open_block_data_
+(std::string name_dir, int index_file, bool append)
+{
+  // Create HDF5 file
+
+  std::stringstream stream_block_list;
+  stream_block_list << std::setfill('0');
+  int max_digits = log(num_files_-1)/log(10) + 1;
+  stream_block_list << "block_data-" << std::setw(max_digits) << index_file;
+
+  // Create block list
+  stream_block_list_ = create_block_list_
+    (name_dir,stream_block_list.str()+".block_list",append);
+
+  if (enzo::config()->method_check_format == "native") {
+    // Create native file (never appended to)
+    native_file_ = new IoEnzoNativeFile
+      (name_dir, stream_block_list.str() + ".native");
+    native_file_->file_create();
+    file_write_hierarchy_native_();
+    return;
+  }
 
-  // Write Block to HDF5
-  file_write_block_(msg_check);
+  std::string name_file = stream_block_list.str() + ".h5";
+  file_ = file_open_(name_dir,name_file,append);
 
-  delete msg_check;
+  // Write HDF5 header meta data
+  if (! append) file_write_hierarchy_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::p_write_aggregate (EnzoMsgCheck * msg_check)
+{
+  TRACE_CHECK("[A3] IoEnzoWriter::p_write_aggregate");
+
+  msg_check_pending_[msg_check->index_block_] = msg_check;
+  count_block_ = msg_check->count_block_;
+  name_dir_    = msg_check->name_dir_;
+
+  aggregate_write_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::p_write_aggregate_next
+(long long count_block, std::string name_dir)
+{
+  TRACE_CHECK("[A4] IoEnzoWriter::p_write_aggregate_next");
+
+  has_token_   = true;
+  count_block_ = count_block;
+  name_dir_    = name_dir;
+
+  aggregate_write_();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::aggregate_write_ ()
+// Aggregators of a file append their segments in order: the one
+// holding the file's first Block creates it, and each passes the file
+// on to the next when done
+{
+  const long long na = enzo::config()->method_check_num_aggregators;
+  const long long nb = count_block_;
+  const long long j  = thisIndex;
+
+  // segment of Blocks ib with ib*na/nb == j
+  const long long num_blocks = ((j+1)*nb + na - 1)/na - (j*nb + na - 1)/na;
+
+  // wait for all Blocks of the segment
+  if ((long long)msg_check_pending_.size() < num_blocks) return;
+
+  const bool is_first = (num_blocks > 0) &&
+    msg_check_pending_.begin()->second->is_first_;
+
+  // wait for the file unless this segment starts it
+  if (! (is_first || has_token_)) return;
+
+  has_token_ = false;
+
+  bool is_last = false;
+
+  if (num_blocks > 0) {
+
+    const int index_file = j*num_files_/na;
+    file_open_block_data_(name_dir_,index_file,! is_first);
+
+    for (auto & it : msg_check_pending_) {
+      EnzoMsgCheck * msg = it.second;
+      is_last = msg->is_last_;
+      // closes the file after the file's last Block
+      write_msg_check_(msg);
+      delete msg;
+    }
+    msg_check_pending_.clear();
+
+    if (! is_last) {
+      stream_block_list_.close();
+      file_->file_close();
+    }
+    delete file_;
+    file_ = nullptr;
+  }
 
   if (is_last) {
-    // close block list
-    close_block_list_();
-    // close HDF5 file
-    file_->file_close();
+    proxy_enzo_simulation[0].p_check_done();
+  } else {
+    thisProxy[thisIndex+1].p_write_aggregate_next(nb,name_dir_);
   }
+}
 
-  if (!is_last) {
-    enzo::block_array()[index_next].p_check_write_next(num_files_, ordering_);
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::write_msg_check_ (EnzoMsgCheck * msg_check)
+{
+  std::string name_this, name_next;
+  Index index_this, index_next;
+  long long index_block;
+  bool is_first, is_last;
+  std::string name_dir;
+
+  msg_check->get_parameters
+    (index_this,index_next,name_this,name_next,
+     index_block,is_first,is_last,name_dir);
+
+  if (thisIndex == 0 && monitor_iter_ &&
+      ((is_first || is_last) || ((index_block % monitor_iter_) == 0))) {
+    cello::monitor()->print("Method", "check %d",index_block);
+  }
+
+  // Write block list
+  write_block_list_(name_this, msg_check->block_level());
+
+  // Write Block to HDF5 or native file
+  if (native_file_ != nullptr) {
+    file_write_block_native_(msg_check);
   } else {
-    proxy_enzo_simulation[0].p_check_done();
+    file_write_block_(msg_check);
+  }
+
+  if (is_last) {
+    // close block list
+    close_block_list_();
+    // close HDF5 or native file
+    if (native_file_ != nullptr) {
+      native_file_->file_close();
+      delete native_file_;
+      native_file_ = nullptr;
+    } else {
+      file_->file_close();
+    }
   }
 }
 
 //----------------------------------------------------------------------
 
-std::ofstream IoEnzoWriter::create_block_list_(std::string name_dir, std::string name_file)
+std::ofstream IoEnzoWriter::create_block_list_
+(std::string name_dir, std::string name_file, bool append)
 {
-  std::ofstream stream_block_list (name_dir + "/" + name_file);
+  std::ofstream stream_block_list
+    (name_dir + "/" + name_file, append ? std::ios::app : std::ios::out);
 
   ASSERT1("Simulation::create_block_list_",
           "Cannot open block_list file %s for writing",
@@ -305,12 +634,77 @@ void EnzoSimulation::p_check_done()
 {
   TRACE_CHECK("[B] EnzoSimulation::p_check_done()");
   if (sync_check_done_.next()) {
-    enzo::block_array().p_check_done();
+    if (check_async_active_) {
+      // Blocks have already continued: start any deferred checkpoint
+      // or exit
+      check_async_active_ = false;
+      if (check_async_deferred_) {
+        check_async_deferred_ = false;
+        check_start_();
+      } else if (check_exit_deferred_) {
+        check_exit_deferred_ = false;
+        proxy_main.p_exit(1);
+      }
+    } else {
+      enzo::block_array().p_check_done();
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoSimulation::r_check_memory_done()
+// [ Called on ip=0 only ]
+{
+  TRACE_CHECK("[M] EnzoSimulation::r_check_memory_done()");
+  enzo::block_array().p_check_done();
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoSimulation::check_stage (Index index, long long bytes)
+{
+  check_staged_bytes_ += bytes;
+
+  const long long max_staged_bytes =
+    (long long)(enzo::config()->method_check_max_staged_mb) << 20;
+
+  if (max_staged_bytes > 0 && check_staged_bytes_ > max_staged_bytes) {
+    check_stage_wait_.push_back(index);
+    return false;
+  } else {
+    return true;
   }
 }
 
 //----------------------------------------------------------------------
 
+void EnzoSimulation::p_check_unstage(long long bytes)
+{
+  check_staged_bytes_ -= bytes;
+
+  const long long max_staged_bytes =
+    (long long)(enzo::config()->method_check_max_staged_mb) << 20;
+
+  if (check_staged_bytes_ <= max_staged_bytes) {
+    for (const Index & index : check_stage_wait_) {
+      enzo::block_array()[index].p_check_done();
+    }
+    check_stage_wait_.clear();
+  }
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoSimulation::check_defer_exit()
+// [ Called on ip=0 only ]
+{
+  if (check_async_active_) check_exit_deferred_ = true;
+  return check_async_active_;
+}
+
+//----------------------------------------------------------------------
+
 void EnzoBlock::p_check_done()
 {
   TRACE_CHECK_BLOCK("[C] EnzoBlock::p_check_done()",this);
@@ -322,6 +716,7 @@ void EnzoBlock::p_check_done()
 int EnzoBlock::create_msg_check_
 ( EnzoMsgCheck ** msg_check,
   int num_files, std::string ordering,
+  bool is_delta,
   std::string name_dir,
   bool * is_first
   )
@@ -376,9 +771,15 @@ int EnzoBlock::create_msg_check_
 
   (*msg_check)->set_name_dir (name_dir);
 
+  (*msg_check)->count_block_ = count;
+
   (*msg_check)->set_adapt(adapt_);
-  
-  DataMsg * data_msg = create_data_msg_();
+
+  if (enzo::config()->method_check_delta_interval > 0) {
+    check_delta_fields_(*msg_check, is_delta, index_file);
+  }
+
+  DataMsg * data_msg = create_data_msg_((*msg_check)->field_base_file_);
   (*msg_check)->set_data_msg(data_msg);
 
   return index_file;
@@ -386,6 +787,59 @@ int EnzoBlock::create_msg_check_
 
 //----------------------------------------------------------------------
 
+void EnzoBlock::check_delta_fields_
+(EnzoMsgCheck * msg_check, bool is_delta, int index_file)
+{
+  ScalarDescr * scalar_descr = cello::scalar_descr_long_long();
+  Scalar<long long> scalar (scalar_descr, data()->scalar_data_long_long());
+  long long * check_file = scalar.value(scalar_descr->index("check:file"));
+
+  Field field = data()->field();
+  const int num_fields = field.field_count();
+
+  msg_check->is_delta_ = is_delta;
+  if (is_delta) msg_check->field_base_file_.assign(num_fields,-1);
+
+  // FNV-1a hash of each field's values, seeded with the Block name so
+  // that hashes copied to another Block never match
+
+  const std::string block_name = name();
+  unsigned long long seed = 14695981039346656037ull;
+  for (char c : block_name) {
+    seed = (seed ^ (unsigned char)c) * 1099511628211ull;
+  }
+
+  for (int i_f=0; i_f<num_fields; i_f++) {
+
+    const int i_s = scalar_descr->index("check:hash:" + field.field_name(i_f));
+    const char * values = field.values(i_f);
+    if (i_s < 0 || values == nullptr) continue;
+
+    int mx,my,mz;
+    field.dimensions(i_f,&mx,&my,&mz);
+    const long long bytes = (long long)mx*my*mz*
+      cello::sizeof_precision(field.precision(i_f));
+
+    unsigned long long hash = seed;
+    for (long long i=0; i<bytes; i++) {
+      hash = (hash ^ (unsigned char)values[i]) * 1099511628211ull;
+    }
+
+    long long * check_hash = scalar.value(i_s);
+    if (is_delta) {
+      if (*check_hash == (long long)hash && *check_file >= 0) {
+        msg_check->field_base_file_[i_f] = *check_file;
+      }
+    } else {
+      *check_hash = (long long) hash;
+    }
+  }
+
+  if (! is_delta) *check_file = index_file;
+}
+
+//----------------------------------------------------------------------
+
 std::string Simulation::file_create_dir_
 (std::vector<std::string> directory_format, bool & already_exists)
 {
@@ -408,11 +862,19 @@ std::string Simulation::file_create_dir_
 
 //----------------------------------------------------------------------
 FileHdf5 * IoEnzoWriter::file_open_
-(std::string path_name, std::string file_name)
+(std::string path_name, std::string file_name, bool append)
 {
-  // Create File
+  // Create File, aligning large datasets to the file system stripe
+  // and coalescing small writes into stripe-sized ones
   FileHdf5 * file = new FileHdf5 (path_name, file_name);
-  file->file_create();
+  const int stripe_size = enzo::config()->method_check_stripe_size;
+  file->set_alignment(stripe_size);
+  file->set_buffer_size(stripe_size);
+  if (append) {
+    file->file_append();
+  } else {
+    file->file_create();
+  }
 
   return file;
 }
@@ -502,6 +964,16 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
   file_->group_write_meta
     (msg_check->adapt_buffer_,"adapt_buffer",type_int,ADAPT_BUFFER_SIZE);
 
+  // Write the file in the full checkpoint holding each field, or -1
+  // if it is in this file
+
+  std::vector<int> & field_base_file = msg_check->field_base_file_;
+  if (msg_check->is_delta_) {
+    file_->group_write_meta
+      (field_base_file.data(),"delta_base_file",type_int,
+       field_base_file.size());
+  }
+
   // Create new data object to hold EnzoMsgCheck/DataMsg fields and particles
 
   Data * data;
@@ -531,7 +1003,11 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
       FieldData * field_data = data->field_data(i_h);
       for (int i_f=0; i_f<nf; i_f++) {
         const int index_field = i_f;
-;
+
+        // skip fields unchanged since the last full checkpoint
+        if (i_f < int(field_base_file.size()) &&
+            field_base_file[i_f] >= 0) continue;
+
         IoFieldData * io_field_data = enzo::factory()->create_io_field_data();
         io_field_data -> set_include_ghosts (include_ghosts_);
 
@@ -637,7 +1113,69 @@ void IoEnzoWriter::file_write_block_ (EnzoMsgCheck * msg_check)
 
 //----------------------------------------------------------------------
 
-DataMsg * EnzoBlock::create_data_msg_ ()
+void IoEnzoWriter::file_write_hierarchy_native_()
+{
+  // Simulation metadata values, concatenated in order; hierarchy
+  // metadata is not needed to restart
+  IoSimulation io_simulation = (cello::simulation());
+
+  long long size = 0;
+  for (size_t i=0; i<io_simulation.meta_count(); i++) {
+    void * buffer;
+    int type_scalar;
+    int nx,ny,nz;
+    io_simulation.meta_value(i,& buffer, nullptr, &type_scalar, &nx,&ny,&nz);
+    size += cello::type_bytes[type_scalar]*
+      std::max(nx,1)*std::max(ny,1)*std::max(nz,1);
+  }
+
+  char * pc = native_file_->record_buffer(size);
+  for (size_t i=0; i<io_simulation.meta_count(); i++) {
+    void * buffer;
+    int type_scalar;
+    int nx,ny,nz;
+    io_simulation.meta_value(i,& buffer, nullptr, &type_scalar, &nx,&ny,&nz);
+    const int n = cello::type_bytes[type_scalar]*
+      std::max(nx,1)*std::max(ny,1)*std::max(nz,1);
+    memcpy(pc,buffer,n);
+    pc += n;
+  }
+  native_file_->write_record("simulation",size);
+
+  io_simulation.save_to(cello::simulation());
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoWriter::file_write_block_native_ (EnzoMsgCheck * msg_check)
+{
+  // The record is the serialized message, as packed for sending: a
+  // message received from another process still holds its packed
+  // buffer, while a local one is serialized here
+
+  long long size;
+  char * buffer;
+  if (msg_check->buffer_ != nullptr) {
+    size   = msg_check->buffer_size_;
+    buffer = native_file_->record_buffer(size);
+    memcpy(buffer,msg_check->buffer_,size);
+  } else {
+    size   = msg_check->size_();
+    buffer = native_file_->record_buffer(size);
+    char * pc = msg_check->save_(buffer);
+    ASSERT2("IoEnzoWriter::file_write_block_native_()",
+            "buffer size mismatch %ld written %lld expected",
+            (pc - buffer),size,
+            (pc - buffer) == size);
+  }
+
+  native_file_->write_record(msg_check->name_this_,size);
+}
+
+//----------------------------------------------------------------------
+
+DataMsg * EnzoBlock::create_data_msg_
+(const std::vector<int> & field_base_file)
 {
   int if3[3] = {0,0,0};
   int ic3[3] = {0,0,0};
@@ -649,8 +1187,18 @@ DataMsg * EnzoBlock::create_data_msg_ ()
   // Initialize refresh fields
   bool any_fields = false;
   if (cello::field_descr()->field_count() > 0) {
-    refresh->add_all_fields();
-    any_fields = true;
+    if (field_base_file.empty()) {
+      refresh->add_all_fields();
+      any_fields = true;
+    } else {
+      // delta checkpoint: skip fields unchanged since the full one
+      for (size_t i_f=0; i_f<field_base_file.size(); i_f++) {
+        if (field_base_file[i_f] < 0) {
+          refresh->add_field(i_f);
+          any_fields = true;
+        }
+      }
+    }
   }
 
   // Initialize refresh particles
@@ -0,0 +1,375 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoOutputLightcone.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of EnzoOutputLightcone, streaming output of
+///           the past lightcone
+///
+/// The comoving distance to redshift z, measured from the final
+/// redshift z_f of the simulation, is
+///
+///    chi(z) = (c/H0) int_{z_f}^{z} dz' / E(z'),
+///    E(z)   = sqrt (Omega_m (1+z)^3 + Omega_k (1+z)^2 + Omega_Lambda),
+///
+/// with c/H0 in Mpc/h, converted to code units by the comoving box
+/// size.
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/cosmology/cosmology.hpp"
+#include "Enzo/io/io.hpp"
+
+/// Hubble distance c/H0 in Mpc/h
+#define LIGHTCONE_HUBBLE_DISTANCE 2997.92458
+
+/// Simpson's rule intervals per unit redshift for comoving_distance()
+#define LIGHTCONE_INTERVALS 256
+
+//----------------------------------------------------------------------
+
+EnzoOutputLightcone::EnzoOutputLightcone
+(int index,
+ const Factory * factory,
+ Config * config,
+ ParameterGroup p) throw()
+  : Output(index,factory),
+    redshift_max_(p.value_float("redshift_max",-1.0)),
+    chi_last_(-1.0),
+    redshift_last_(0.0),
+    chi_inner_(0.0),
+    chi_outer_(0.0),
+    redshift_inner_(0.0),
+    block_(nullptr),
+    mask_()
+{
+  for (int axis=0; axis<3; axis++) {
+    const double center =
+      0.5*(config->domain_lower[axis] + config->domain_upper[axis]);
+    observer_[axis] = p.list_value_float(axis,"observer",center);
+  }
+
+  // Each process appends its own Blocks to its own file
+
+  ASSERT1 ("EnzoOutputLightcone::EnzoOutputLightcone()",
+           "Output:%s:stride_write must be 1 for lightcone output",
+           config->output_list[index].c_str(),
+           (config->output_stride_write[index] <= 1));
+
+  const int stride = config->output_stride_wait[index_];
+  stride_wait_ = (stride == 0) ? 1 : stride;
+}
+
+//----------------------------------------------------------------------
+
+EnzoOutputLightcone::~EnzoOutputLightcone() throw()
+{
+  close();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoOutputLightcone::pup (PUP::er &p)
+{
+  TRACEPUP;
+
+  // NOTE: change this function whenever attributes change
+
+  Output::pup(p);
+
+  PUParray(p,observer_,3);
+  p | redshift_max_;
+  p | chi_last_;
+  p | redshift_last_;
+}
+
+//----------------------------------------------------------------------
+
+double EnzoOutputLightcone::comoving_distance (double redshift) const throw()
+{
+  EnzoPhysicsCosmology * cosmology = enzo::cosmology();
+
+  const double z_f = cosmology->final_redshift();
+  if (redshift <= z_f) return 0.0;
+
+  const double omega_m = cosmology->omega_matter_now();
+  const double omega_l = cosmology->omega_lambda_now();
+  const double omega_k = 1.0 - omega_m - omega_l;
+
+  auto inverse_e = [omega_m,omega_l,omega_k] (double z) {
+    const double a = 1.0 + z;
+    return 1.0 / sqrt(omega_m*a*a*a + omega_k*a*a + omega_l);
+  };
+
+  // composite Simpson's rule with an even number of intervals
+
+  const int n = 2*std::max(1,int(ceil(0.5*LIGHTCONE_INTERVALS*(redshift-z_f))));
+  const double h = (redshift - z_f) / n;
+
+  double sum = inverse_e(z_f) + inverse_e(redshift);
+  for (int i=1; i<n; i++) {
+    sum += ((i % 2) ? 4.0 : 2.0) * inverse_e(z_f + i*h);
+  }
+
+  return LIGHTCONE_HUBBLE_DISTANCE * (sum*h/3.0)
+    / cosmology->comoving_box_size();
+}
+
+//======================================================================
+
+void EnzoOutputLightcone::init () throw()
+{
+  EnzoPhysicsCosmology * cosmology = enzo::cosmology();
+
+  ASSERT ("EnzoOutputLightcone::init()",
+          "Output type \"lightcone\" requires \"cosmology\" physics",
+          cosmology != nullptr);
+
+  redshift_inner_ = cosmology->redshift_from_time(cello::simulation()->time());
+  chi_inner_ = comoving_distance(redshift_inner_);
+
+  if (chi_last_ < 0.0) {
+    redshift_last_ = (redshift_max_ >= 0.0) ?
+      redshift_max_ : cosmology->initial_redshift();
+    chi_last_ = comoving_distance(redshift_last_);
+  }
+
+  chi_outer_ = chi_last_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoOutputLightcone::open () throw()
+{
+  std::string file_name = expand_name_(&file_name_,&file_args_);
+
+  std::string dir = directory();
+
+  Monitor::instance()->print
+    ("Output","appending lightcone z = [%g,%g) to file %s",
+     redshift_inner_,redshift_last_,(dir + "/" + file_name).c_str());
+
+  FileHdf5 * file = new FileHdf5 (dir,file_name);
+
+  file_ = file;
+
+  file->file_append();
+}
+
+//----------------------------------------------------------------------
+
+void EnzoOutputLightcone::close () throw()
+{
+  if (file_) file_->file_close();
+  delete file_;  file_ = nullptr;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoOutputLightcone::finalize () throw ()
+{
+  chi_last_      = chi_inner_;
+  redshift_last_ = redshift_inner_;
+
+  Output::finalize();
+}
+
+//----------------------------------------------------------------------
+
+bool EnzoOutputLightcone::is_block_written
+( const Block * block ) const throw()
+{
+  if (! block->is_leaf() || chi_outer_ <= chi_inner_) return false;
+
+  if (! Output::is_block_written(block)) return false;
+
+  double lower[3], upper[3];
+  block->lower(lower,lower+1,lower+2);
+  block->upper(upper,upper+1,upper+2);
+
+  // nearest and farthest distances from the observer to the Block
+
+  const int rank = cello::rank();
+  double d2_min = 0.0;
+  double d2_max = 0.0;
+  for (int axis=0; axis<rank; axis++) {
+    const double o = observer_[axis];
+    const double d_min = std::max(0.0,std::max(lower[axis]-o,o-upper[axis]));
+    const double d_max = std::max(fabs(o-lower[axis]),fabs(upper[axis]-o));
+    d2_min += d_min*d_min;
+    d2_max += d_max*d_max;
+  }
+
+  return (sqrt(d2_min) < chi_outer_ && sqrt(d2_max) >= chi_inner_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoOutputLightcone::write_block ( const Block * block ) throw()
+{
+  block_ = block;
+
+  Field field = ((Block *)block)->data()->field();
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+
+  double xm,ym,zm;
+  block->lower(&xm,&ym,&zm);
+  double hx,hy,hz;
+  block->cell_width(&hx,&hy,&hz);
+
+  // unused axes are placed at the observer
+
+  const int rank = cello::rank();
+
+  std::vector<double> x,y,z,redshift;
+
+  mask_.assign(nx*ny*nz,0);
+  for (int iz=0; iz<nz; iz++) {
+    const double zc = (rank >= 3) ? zm + (iz+0.5)*hz : observer_[2];
+    for (int iy=0; iy<ny; iy++) {
+      const double yc = (rank >= 2) ? ym + (iy+0.5)*hy : observer_[1];
+      for (int ix=0; ix<nx; ix++) {
+        const double xc = xm + (ix+0.5)*hx;
+        const double r = distance_(xc,yc,zc);
+        if (in_shell_(r)) {
+          mask_[ix+nx*(iy+ny*iz)] = 1;
+          x.push_back(xc);
+          y.push_back(yc);
+          z.push_back(zc);
+          redshift.push_back(redshift_(r));
+        }
+      }
+    }
+  }
+
+  FileHdf5 * file = static_cast<FileHdf5 *>(file_);
+
+  const int n = redshift.size();
+  if (n > 0) {
+    const std::vector<double> width (n,hx);
+    file->data_append("cell_x",type_double,n,x.data());
+    file->data_append("cell_y",type_double,n,y.data());
+    file->data_append("cell_z",type_double,n,z.data());
+    file->data_append("cell_width",type_double,n,width.data());
+    file->data_append("cell_redshift",type_double,n,redshift.data());
+  }
+
+  // Particles may be in the shell even if no cell centers are
+
+  Output::write_block(block);
+
+  block_ = nullptr;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoOutputLightcone::write_field_data
+( const FieldData * field_data, int index_field) throw()
+{
+  io_field_data()->set_field_data((FieldData*)field_data);
+  io_field_data()->set_field_index(index_field);
+
+  void * buffer;
+  std::string name;
+  int type;
+  int nxd,nyd,nzd;  // Array dimension
+  int nx,ny,nz;     // Array size
+
+  io_field_data()->field_array(&buffer, &name, &type,
+                               &nxd,&nyd,&nzd,
+                               &nx, &ny, &nz);
+
+  ASSERT2 ("EnzoOutputLightcone::write_field_data()",
+           "Field %s size does not match the %d cells of the Block",
+           name.c_str(),int(mask_.size()),
+           (size_t(nx)*ny*nz == mask_.size()));
+
+  // pack values of cells within the shell
+
+  const int bytes = cello::type_bytes[type];
+  const char * array = (const char *) buffer;
+  std::vector<char> pack;
+  int n = 0;
+  for (int iz=0; iz<nz; iz++) {
+    for (int iy=0; iy<ny; iy++) {
+      for (int ix=0; ix<nx; ix++) {
+        if (mask_[ix+nx*(iy+ny*iz)]) {
+          const char * value = array + size_t(bytes)*(ix+nxd*(iy+nyd*iz));
+          pack.insert(pack.end(),value,value+bytes);
+          ++n;
+        }
+      }
+    }
+  }
+
+  static_cast<FileHdf5 *>(file_)->data_append(name,type,n,pack.data());
+}
+
+//----------------------------------------------------------------------
+
+void EnzoOutputLightcone::write_particle_data
+( const ParticleData * particle_data, int it) throw()
+{
+  Particle particle (cello::particle_descr(),
+                     (ParticleData*) particle_data);
+
+  double lower[3], upper[3];
+  block_->lower(lower,lower+1,lower+2);
+  block_->upper(upper,upper+1,upper+2);
+
+  const int rank = cello::rank();
+  const int nb = particle.num_batches(it);
+
+  // mask of particles within the shell, over all batches
+
+  std::vector<char> mask;
+  std::vector<double> redshift;
+  for (int ib=0; ib<nb; ib++) {
+    const int np = particle.num_particles(it,ib);
+    std::vector<double> x3[3];
+    for (int axis=0; axis<3; axis++) x3[axis].assign(np,observer_[axis]);
+    particle.position(it,ib,x3[0].data(),
+                      (rank >= 2) ? x3[1].data() : nullptr,
+                      (rank >= 3) ? x3[2].data() : nullptr,
+                      lower,upper);
+    for (int ip=0; ip<np; ip++) {
+      const double r = distance_(x3[0][ip],x3[1][ip],x3[2][ip]);
+      const bool in_shell = in_shell_(r);
+      mask.push_back(in_shell);
+      if (in_shell) redshift.push_back(redshift_(r));
+    }
+  }
+
+  const int n = redshift.size();
+  if (n == 0) return;
+
+  FileHdf5 * file = static_cast<FileHdf5 *>(file_);
+
+  const std::string prefix = "particle_" + particle.type_name(it) + "_";
+
+  const int na = particle.num_attributes(it);
+  for (int ia=0; ia<na; ia++) {
+    const int type   = particle.attribute_type(it,ia);
+    const int bytes  = particle.attribute_bytes(it,ia);
+    const int stride = particle.stride(it,ia);
+    std::vector<char> pack;
+    pack.reserve(size_t(bytes)*n);
+    int k = 0;
+    for (int ib=0; ib<nb; ib++) {
+      const char * array = particle.attribute_array(it,ia,ib);
+      const int np = particle.num_particles(it,ib);
+      for (int ip=0; ip<np; ip++) {
+        if (mask[k++]) {
+          const char * value = array + size_t(bytes)*stride*ip;
+          pack.insert(pack.end(),value,value+bytes);
+        }
+      }
+    }
+    file->data_append(prefix + particle.attribute_name(it,ia),
+                      type,n,pack.data());
+  }
+
+  file->data_append(prefix + "redshift",type_double,n,redshift.data());
+}
@@ -0,0 +1,156 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoOutputLightcone.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of EnzoOutputLightcone, streaming
+///           output of the cells and particles on the past lightcone
+
+#ifndef ENZO_IO_ENZO_OUTPUT_LIGHTCONE_HPP
+#define ENZO_IO_ENZO_OUTPUT_LIGHTCONE_HPP
+
+class EnzoOutputLightcone : public Output {
+
+  /// @class    EnzoOutputLightcone
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Append lightcone shells to HDF5 datasets
+  ///
+  /// Each output writes the shell of the observer's past lightcone
+  /// crossed since the previous output: cells and particles whose
+  /// comoving distance r from the observer lies in [chi(z), chi(z_last)),
+  /// where chi is the comoving distance to redshift z, z is the current
+  /// redshift and z_last that of the previous output.  Leaf Blocks
+  /// that do not intersect the shell are skipped without computing
+  /// derived fields or touching their data.  Selected values are
+  /// appended to one-dimensional unlimited HDF5 datasets, so a file
+  /// name without the cycle accumulates the whole lightcone; the
+  /// redshift of each value is interpolated linearly in r across the
+  /// shell.  Periodic images of the domain are not replicated.
+
+public: // functions
+
+  /// Empty constructor for Charm++ pup()
+  EnzoOutputLightcone() throw()
+    : redshift_max_(0.0),
+      chi_last_(-1.0),
+      redshift_last_(0.0),
+      chi_inner_(0.0),
+      chi_outer_(0.0),
+      redshift_inner_(0.0),
+      block_(nullptr),
+      mask_()
+  {
+    for (int i=0; i<3; i++) observer_[i] = 0.0;
+  }
+
+  /// Create an EnzoOutputLightcone object
+  EnzoOutputLightcone (int index,
+                       const Factory * factory,
+                       Config * config,
+                       ParameterGroup p) throw();
+
+  /// Close the file if it is open
+  virtual ~EnzoOutputLightcone() throw();
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoOutputLightcone);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoOutputLightcone (CkMigrateMessage *m)
+    : Output (m),
+      redshift_max_(0.0),
+      chi_last_(-1.0),
+      redshift_last_(0.0),
+      chi_inner_(0.0),
+      chi_outer_(0.0),
+      redshift_inner_(0.0),
+      block_(nullptr),
+      mask_()
+  {
+    for (int i=0; i<3; i++) observer_[i] = 0.0;
+  }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Comoving distance in code units to the given redshift, from the
+  /// final redshift of the simulation
+  double comoving_distance (double redshift) const throw();
+
+public: // virtual functions
+
+  /// Compute the shell of the current output
+  virtual void init () throw();
+
+  /// Open (or create) the file for appending
+  virtual void open () throw();
+
+  /// Close the file
+  virtual void close () throw();
+
+  /// Remember the inner edge of the shell for the next output
+  virtual void finalize () throw ();
+
+  /// Whether the leaf Block intersects the current shell
+  virtual bool is_block_written ( const Block * block ) const throw();
+
+  /// Append the cells and particles of the Block within the shell
+  virtual void write_block ( const Block * block ) throw();
+
+  /// Append the values of a field in cells within the shell
+  virtual void write_field_data
+  ( const FieldData * field_data, int index_field) throw();
+
+  /// Append the attributes of particles within the shell
+  virtual void write_particle_data
+  ( const ParticleData * particle_data, int index_particle) throw();
+
+protected: // functions
+
+  /// Distance of the point (x,y,z) from the observer
+  double distance_ (double x, double y, double z) const throw()
+  {
+    const double dx = x - observer_[0];
+    const double dy = y - observer_[1];
+    const double dz = z - observer_[2];
+    return sqrt(dx*dx + dy*dy + dz*dz);
+  }
+
+  /// Redshift at distance r within the current shell
+  double redshift_ (double r) const throw()
+  {
+    const double width = chi_outer_ - chi_inner_;
+    return (width > 0.0) ?
+      redshift_inner_ + (redshift_last_ - redshift_inner_) *
+      (r - chi_inner_) / width : redshift_inner_;
+  }
+
+  /// Whether distance r lies within the current shell
+  bool in_shell_ (double r) const throw()
+  { return (chi_inner_ <= r && r < chi_outer_); }
+
+protected: // attributes
+
+  /// Position of the observer in code units
+  double observer_[3];
+
+  /// Redshift of the outer edge of the first shell
+  double redshift_max_;
+
+  /// Comoving distance and redshift of the previous output, or
+  /// chi_last_ < 0 before the first output
+  double chi_last_;
+  double redshift_last_;
+
+  /// Current shell [chi_inner_, chi_outer_) and redshift at chi_inner_
+  /// [not pup'ed: computed by init()]
+  double chi_inner_;
+  double chi_outer_;
+  double redshift_inner_;
+
+  /// Block being written, and mask of its cells within the shell
+  const Block * block_;
+  std::vector<char> mask_;
+};
+
+#endif /* ENZO_IO_ENZO_OUTPUT_LIGHTCONE_HPP */
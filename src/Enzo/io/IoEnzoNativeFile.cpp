@@ -0,0 +1,291 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_IoEnzoNativeFile.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    Implementation of the IoEnzoNativeFile class
+///
+/// File layout, with each part padded to a multiple of NATIVE_ALIGN
+/// bytes:
+///
+///    header    magic "ENZONATV", int version
+///    records   record bytes
+///    index     long long count, then per record: int name length,
+///              name, long long offset, long long size
+///    trailer   last 32 bytes of the index part: long long index
+///              offset, long long index size, magic "ENZONATV"
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/io/io.hpp"
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+  const char native_magic[8] = {'E','N','Z','O','N','A','T','V'};
+  const int  native_version  = 1;
+  const int  native_trailer  = 32;
+
+  long long native_round_(long long size)
+  { return ((size + NATIVE_ALIGN - 1) / NATIVE_ALIGN) * NATIVE_ALIGN; }
+}
+
+//----------------------------------------------------------------------
+
+IoEnzoNativeFile::IoEnzoNativeFile
+(std::string path_name, std::string file_name) throw()
+  : path_name_(path_name),
+    file_name_(file_name),
+    fd_(-1),
+    is_write_(false),
+    is_direct_(false),
+    offset_(0),
+    buffer_(nullptr),
+    buffer_size_(0),
+    index_(),
+    index_order_(),
+    map_(nullptr),
+    map_size_(0)
+{
+}
+
+//----------------------------------------------------------------------
+
+IoEnzoNativeFile::~IoEnzoNativeFile() throw()
+{
+  if (fd_ >= 0) file_close();
+  free(buffer_);
+  buffer_ = nullptr;
+}
+
+//----------------------------------------------------------------------
+
+bool IoEnzoNativeFile::file_exists
+(std::string path_name, std::string file_name)
+{
+  struct stat file_stat;
+  return stat((path_name + "/" + file_name).c_str(),&file_stat) == 0;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoNativeFile::file_create()
+{
+  const std::string name = path_name_ + "/" + file_name_;
+
+  const int flags = O_WRONLY | O_CREAT | O_TRUNC;
+  fd_ = -1;
+#ifdef O_DIRECT
+  // bypass the page cache where the file system allows it
+  fd_ = open(name.c_str(), flags | O_DIRECT, 0644);
+  is_direct_ = (fd_ >= 0);
+#endif
+  if (fd_ < 0) fd_ = open(name.c_str(), flags, 0644);
+
+  ASSERT2("IoEnzoNativeFile::file_create()",
+          "Cannot create native checkpoint file %s: %s",
+          name.c_str(),strerror(errno),
+          fd_ >= 0);
+
+  is_write_ = true;
+  offset_   = 0;
+  index_.clear();
+  index_order_.clear();
+
+  // header
+  char * header = record_buffer(NATIVE_ALIGN);
+  std::memset(header,0,NATIVE_ALIGN);
+  std::memcpy(header,native_magic,sizeof(native_magic));
+  std::memcpy(header+sizeof(native_magic),&native_version,sizeof(int));
+  write_aligned_(header,NATIVE_ALIGN);
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoNativeFile::file_open()
+{
+  const std::string name = path_name_ + "/" + file_name_;
+
+  fd_ = open(name.c_str(), O_RDONLY);
+
+  ASSERT2("IoEnzoNativeFile::file_open()",
+          "Cannot open native checkpoint file %s: %s",
+          name.c_str(),strerror(errno),
+          fd_ >= 0);
+
+  struct stat file_stat;
+  fstat(fd_,&file_stat);
+  map_size_ = file_stat.st_size;
+
+  ASSERT1("IoEnzoNativeFile::file_open()",
+          "Native checkpoint file %s is truncated",
+          name.c_str(),
+          map_size_ >= NATIVE_ALIGN + native_trailer);
+
+  void * map = mmap(nullptr, map_size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+
+  ASSERT2("IoEnzoNativeFile::file_open()",
+          "Cannot map native checkpoint file %s: %s",
+          name.c_str(),strerror(errno),
+          map != MAP_FAILED);
+
+  map_ = (char *) map;
+  is_write_ = false;
+
+  // trailer
+  const char * pc = map_ + map_size_ - native_trailer;
+  long long index_offset, index_size;
+  std::memcpy(&index_offset,pc,sizeof(long long)); pc += sizeof(long long);
+  std::memcpy(&index_size,  pc,sizeof(long long)); pc += sizeof(long long);
+
+  ASSERT1("IoEnzoNativeFile::file_open()",
+          "File %s is not a native checkpoint file",
+          name.c_str(),
+          (std::memcmp(map_,native_magic,sizeof(native_magic)) == 0 &&
+           std::memcmp(pc,native_magic,sizeof(native_magic)) == 0 &&
+           index_offset >= NATIVE_ALIGN &&
+           index_offset + index_size <= map_size_));
+
+  // index
+  index_.clear();
+  index_order_.clear();
+  pc = map_ + index_offset;
+  long long count;
+  std::memcpy(&count,pc,sizeof(long long)); pc += sizeof(long long);
+  for (long long i=0; i<count; i++) {
+    int length;
+    std::memcpy(&length,pc,sizeof(int)); pc += sizeof(int);
+    std::string record_name (pc,length); pc += length;
+    long long offset, size;
+    std::memcpy(&offset,pc,sizeof(long long)); pc += sizeof(long long);
+    std::memcpy(&size,  pc,sizeof(long long)); pc += sizeof(long long);
+    index_[record_name] = {offset,size};
+    index_order_.push_back(record_name);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoNativeFile::file_close()
+{
+  if (fd_ < 0) return;
+
+  if (is_write_) {
+
+    // index and trailer
+    long long index_size = sizeof(long long);
+    for (const std::string & name : index_order_) {
+      index_size += sizeof(int) + name.size() + 2*sizeof(long long);
+    }
+    const long long size = native_round_(index_size + native_trailer);
+    const long long index_offset = offset_;
+
+    char * pc = record_buffer(size);
+    std::memset(pc,0,size);
+    const long long count = index_order_.size();
+    std::memcpy(pc,&count,sizeof(long long)); pc += sizeof(long long);
+    for (const std::string & name : index_order_) {
+      const int length = name.size();
+      const auto & entry = index_[name];
+      std::memcpy(pc,&length,sizeof(int)); pc += sizeof(int);
+      std::memcpy(pc,name.data(),length); pc += length;
+      std::memcpy(pc,&entry.first, sizeof(long long)); pc += sizeof(long long);
+      std::memcpy(pc,&entry.second,sizeof(long long)); pc += sizeof(long long);
+    }
+    pc = buffer_ + size - native_trailer;
+    std::memcpy(pc,&index_offset,sizeof(long long)); pc += sizeof(long long);
+    std::memcpy(pc,&index_size,  sizeof(long long)); pc += sizeof(long long);
+    std::memcpy(pc,native_magic,sizeof(native_magic));
+
+    write_aligned_(buffer_,size);
+
+  } else if (map_ != nullptr) {
+
+    munmap(map_,map_size_);
+    map_ = nullptr;
+    map_size_ = 0;
+  }
+
+  close(fd_);
+  fd_ = -1;
+}
+
+//----------------------------------------------------------------------
+
+char * IoEnzoNativeFile::record_buffer(long long size)
+{
+  const long long size_aligned = native_round_(size);
+  if (size_aligned > buffer_size_) {
+    free(buffer_);
+    void * buffer = nullptr;
+    const int err = posix_memalign(&buffer,NATIVE_ALIGN,size_aligned);
+    ASSERT1("IoEnzoNativeFile::record_buffer()",
+            "Cannot allocate %lld bytes for native checkpoint record",
+            size_aligned,
+            err == 0);
+    buffer_ = (char *) buffer;
+    buffer_size_ = size_aligned;
+  }
+  return buffer_;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoNativeFile::write_record(std::string name, long long size)
+{
+  ASSERT1("IoEnzoNativeFile::write_record()",
+          "Native checkpoint file %s is not open for writing",
+          file_name_.c_str(),
+          (fd_ >= 0 && is_write_));
+
+  const long long size_aligned = native_round_(size);
+  std::memset(buffer_+size,0,size_aligned-size);
+
+  index_[name] = {offset_,size};
+  index_order_.push_back(name);
+
+  write_aligned_(buffer_,size_aligned);
+}
+
+//----------------------------------------------------------------------
+
+const char * IoEnzoNativeFile::read_record
+(std::string name, long long * size) const
+{
+  auto it = index_.find(name);
+  if (map_ == nullptr || it == index_.end()) return nullptr;
+  *size = it->second.second;
+  return map_ + it->second.first;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoNativeFile::write_aligned_(const char * buffer, long long size)
+{
+  long long written = 0;
+  while (written < size) {
+    const ssize_t n = pwrite
+      (fd_, buffer + written, size - written, offset_ + written);
+#ifdef O_DIRECT
+    if (n < 0 && errno == EINVAL && is_direct_) {
+      // file system accepted O_DIRECT at open but not for writes
+      fcntl(fd_, F_SETFL, fcntl(fd_,F_GETFL) & ~O_DIRECT);
+      is_direct_ = false;
+      continue;
+    }
+#endif
+    if (n < 0 && errno == EINTR) continue;
+    ASSERT2("IoEnzoNativeFile::write_aligned_()",
+            "Error writing native checkpoint file %s: %s",
+            file_name_.c_str(),strerror(errno),
+            n > 0);
+    written += n;
+  }
+  offset_ += size;
+}
@@ -0,0 +1,99 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_IoEnzoNativeFile.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-15
+/// @brief    [\ref Io] Declaration of the IoEnzoNativeFile class
+
+#ifndef ENZO_IO_ENZO_NATIVE_FILE_HPP
+#define ENZO_IO_ENZO_NATIVE_FILE_HPP
+
+/// Alignment in bytes of records in native checkpoint files
+#define NATIVE_ALIGN 4096
+
+class IoEnzoNativeFile {
+
+  /// @class    IoEnzoNativeFile
+  /// @ingroup  Io
+  /// @brief    [\ref Io] Flat binary checkpoint file of named records
+  ///
+  /// A native checkpoint file holds a sequence of records, each a
+  /// serialized EnzoMsgCheck or other byte array, followed by an
+  /// index of record names, offsets, and sizes and a fixed-size
+  /// trailer locating the index.  The header, every record, and the
+  /// index are padded to NATIVE_ALIGN bytes, so files are written
+  /// with O_DIRECT where the file system supports it, and read by
+  /// mapping the file into memory.
+
+public: // interface
+
+  /// Constructor
+  IoEnzoNativeFile(std::string path_name, std::string file_name) throw();
+
+  /// Destructor: closes the file if open
+  ~IoEnzoNativeFile() throw();
+
+  /// Whether the given native file exists
+  static bool file_exists(std::string path_name, std::string file_name);
+
+  /// Create the file for writing
+  void file_create();
+
+  /// Open the file for reading
+  void file_open();
+
+  /// Close the file, writing the index first if it was created
+  void file_close();
+
+  /// Return an aligned buffer holding at least size bytes, into which
+  /// the next record is serialized before calling write_record()
+  char * record_buffer(long long size);
+
+  /// Write the first size bytes of the record buffer as the named
+  /// record
+  void write_record(std::string name, long long size);
+
+  /// Return a pointer to the named record of a file opened for
+  /// reading and set its size, or return nullptr if not found
+  const char * read_record(std::string name, long long * size) const;
+
+private: // functions
+
+  /// Write size bytes, a multiple of NATIVE_ALIGN, at the end of the
+  /// file
+  void write_aligned_(const char * buffer, long long size);
+
+private: // attributes
+
+  /// Directory and name of the file
+  std::string path_name_;
+  std::string file_name_;
+
+  /// File descriptor, or -1 if closed
+  int fd_;
+
+  /// Whether the file is open for writing
+  bool is_write_;
+
+  /// Whether the file was opened with O_DIRECT
+  bool is_direct_;
+
+  /// Size of the file written so far
+  long long offset_;
+
+  /// Aligned record buffer and its size
+  char * buffer_;
+  long long buffer_size_;
+
+  /// Offset and size of each record by name
+  std::map<std::string, std::pair<long long,long long> > index_;
+
+  /// Order in which records were written
+  std::vector<std::string> index_order_;
+
+  /// Memory-mapped file contents if opened for reading
+  char * map_;
+  long long map_size_;
+};
+
+#endif /* ENZO_IO_ENZO_NATIVE_FILE_HPP */
@@ -34,11 +34,21 @@ public: // interface
     //    p | file_;
     p | sync_blocks_;
     //    p | io_msg_check_;
+    p | part_;
+    p | num_parts_;
+    p | prefetch_;
+    p | level_read_;
+    p | base_dir_;
+    p | base_files_;
   }
 
-  /// Send data to existing root blocks
+  /// Send data to existing root blocks.  The reader reads every
+  /// num_parts'th Block of each level in the file, starting with part;
+  /// if prefetch, each level is read while the previous one is
+  /// initialized
   void p_init_root
-  (std::string name_dir, std::string name_file, int max_level);
+  (std::string name_dir, std::string name_file, int max_level,
+   int part, int num_parts, bool prefetch);
 
   /// Create blocks in the given level
   void p_create_level(int level);
@@ -59,9 +69,21 @@ protected: // functions
   void block_ready_();
   void block_created_();
 
+  /// Read data for blocks in the given refined level
+  void read_level_(int level);
+
+  /// Process on which to create a refined Block, from the Block costs
+  /// and ordering saved in the checkpoint, or -1 if neither was saved
+  int restart_block_process_(IoBlock * io_block) const;
+
   void file_open_block_list_(std::string name_dir, std::string name_file);
   void file_read_block_(EnzoMsgCheck * msg_check, std::string file_name);
-  void file_read_block_fields_(DataMsg * data_msg, int nx, int ny, int nz);
+  void file_read_block_native_(EnzoMsgCheck * msg_check,
+                               std::string name_block);
+  void file_read_block_fields_(DataMsg * data_msg, int nx, int ny, int nz,
+                               std::string name_block);
+  void file_open_base_(std::string name_dir);
+  FileHdf5 * base_file_(int index_file);
   void file_read_block_particles_(DataMsg * data_msg);
   bool read_block_list_(std::string & block_name, int & level);
   void file_close_block_list_();
@@ -70,7 +92,7 @@ protected: // functions
   void file_read_hierarchy_();
   void read_meta_ ( FileHdf5 * file, Io * io, std::string type_meta );
   void file_read_dataset_
-  (char * buffer, int type_data,
+  (FileHdf5 * file, char * buffer, int type_data,
    int nx, int ny, int nz,
    int m4[4]);
 
@@ -90,6 +112,10 @@ private: // attributes
 
   FileHdf5 * file_;
 
+  /// Memory-mapped file if the checkpoint was written with
+  /// Method:check:format = "native", else nullptr
+  IoEnzoNativeFile * native_file_;
+
   Sync sync_blocks_;
 
   /// List of blocks in the file by level (negative blocks included in
@@ -106,6 +132,25 @@ private: // attributes
 
   /// Count of blocks in each level_
   std::vector<int> blocks_in_level_;
+
+  /// Part of the file read by this reader, and number of readers
+  /// sharing the file
+  int part_;
+  int num_parts_;
+
+  /// Whether to read the next level before it is requested
+  bool prefetch_;
+
+  /// Highest level whose blocks have been read
+  int level_read_;
+
+  /// If restarting from a delta checkpoint, the directory and file
+  /// names of the full checkpoint holding its unchanged fields
+  std::string base_dir_;
+  std::vector<std::string> base_files_;
+
+  /// Full checkpoint files opened so far, by file index
+  std::map<int,FileHdf5 *> base_file_map_;
 };
 
 #endif /* ENZO_IO_ENZO_READER_HPP */
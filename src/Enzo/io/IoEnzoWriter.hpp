@@ -22,8 +22,14 @@ public: // interface
     ordering_(""),
     stream_block_list_(),
     file_(nullptr),
+    native_file_(nullptr),
     monitor_iter_(0),
-    include_ghosts_(false)
+    include_ghosts_(false),
+    msg_check_pending_(),
+    index_block_next_(-1),
+    count_block_(0),
+    name_dir_(),
+    has_token_(false)
   {  }
 
   /// Constructor
@@ -50,14 +56,36 @@ public: // entry methods
 
   void p_write(EnzoMsgCheck *);
 
+  /// Open the file for an asynchronous checkpoint
+  void p_open_async(std::string name_dir);
+
+  /// Receive a staged Block snapshot, writing it and any following
+  /// pending snapshots when it is next in the Block ordering
+  void p_write_async(EnzoMsgCheck *);
+
+  /// Receive a Block of this aggregator's segment of the ordering,
+  /// writing the segment when all its Blocks and the file are ready
+  void p_write_aggregate(EnzoMsgCheck *);
+
+  /// Receive the file from the previous aggregator of the file
+  void p_write_aggregate_next(long long count_block, std::string name_dir);
+
   // void r_created(CkReductionMsg *msg);
 
 protected: // functions
 
-  FileHdf5 * file_open_(std::string name_dir, std::string name_file);
-  std::ofstream create_block_list_(std::string name_dir, std::string name_file);
+  FileHdf5 * file_open_(std::string name_dir, std::string name_file,
+                        bool append = false);
+  void file_open_block_data_(std::string name_dir, int index_file,
+                             bool append = false);
+  void aggregate_write_();
+  void write_msg_check_(EnzoMsgCheck * msg_check);
+  std::ofstream create_block_list_(std::string name_dir, std::string name_file,
+                                   bool append = false);
   void file_write_hierarchy_();
   void file_write_block_(EnzoMsgCheck * msg_check);
+  void file_write_hierarchy_native_();
+  void file_write_block_native_(EnzoMsgCheck * msg_check);
   void write_meta_ ( FileHdf5 * file, Io * io, std::string type_meta );
 
   void write_block_list_(std::string block_name, int level);
@@ -77,12 +105,32 @@ protected: // attributes
 
   FileHdf5 * file_;
 
+  /// File for Method:check:format = "native", else nullptr
+  IoEnzoNativeFile * native_file_;
+
   /// How often to output write status wrt block indices in first
   /// file; 0 for no output
   int monitor_iter_;
 
   /// Whether to include ghost zones
   bool include_ghosts_;
+
+  /// Staged Block snapshots received out of order in asynchronous
+  /// checkpoints, keyed by Block index in the ordering; not pupped
+  /// since it is empty between checkpoints
+  std::map<long long, EnzoMsgCheck *> msg_check_pending_;
+
+  /// Ordering index of the next Block to write, or -1 before the
+  /// first Block of the file is received
+  long long index_block_next_;
+
+  /// Number of Blocks in the ordering and checkpoint directory of the
+  /// aggregated checkpoint being written; not pupped
+  long long count_block_;
+  std::string name_dir_;
+
+  /// Whether the previous aggregator of the file is done with it
+  bool has_token_;
 };
 
 #endif /* ENZO_IO_ENZO_WRITER_HPP */
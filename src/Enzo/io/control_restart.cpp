@@ -131,16 +131,27 @@ void Simulation::p_restart_enter (std::string name_dir)
   restart_stream_file_list_ = file_open_file_list_(restart_directory_);
   restart_stream_file_list_ >> restart_num_files_;
 
+  // Number of readers defaults to one per file; more readers split
+  // each file's Blocks between them
+  const int num_readers = cello::config()->initial_restart_num_readers;
+  restart_num_readers_ = std::max(num_readers,restart_num_files_);
+  if (0 < num_readers && num_readers < restart_num_files_) {
+    WARNING2 ("Simulation::p_restart_enter()",
+              "Initial:restart_num_readers = %d is less than the number "
+              "of files %d: using one reader per file",
+              num_readers,restart_num_files_);
+  }
+
   // set synchronization
   TRACE_SYNC(sync_restart_created_,"sync_restart_created_ set_stop()");
-  sync_restart_created_.set_stop(restart_num_files_);
+  sync_restart_created_.set_stop(restart_num_readers_);
   TRACE_SYNC(sync_restart_next_,"sync_restart_next_ set_stop()");
-  sync_restart_next_.set_stop(restart_num_files_);
+  sync_restart_next_.set_stop(restart_num_readers_);
 
   // Create new empty IoEnzoReader chare array and distribute to other processing elements
-  CProxy_MappingIo io_map  = CProxy_MappingIo::ckNew(restart_num_files_);
+  CProxy_MappingIo io_map  = CProxy_MappingIo::ckNew(restart_num_readers_);
 
-  CkArrayOptions opts(restart_num_files_);
+  CkArrayOptions opts(restart_num_readers_);
   opts.setMap(io_map);
   // create array
   proxy_io_enzo_reader = CProxy_IoEnzoReader::ckNew(opts);
@@ -155,12 +166,20 @@ IoEnzoReader::IoEnzoReader()
     max_level_(),
     stream_block_list_(),
     file_(nullptr),
+    native_file_(nullptr),
     sync_blocks_(),
     io_msg_check_(),
     level_(0),
     block_name_list_(),
     block_level_list_(),
-    blocks_in_level_()
+    blocks_in_level_(),
+    part_(0),
+    num_parts_(1),
+    prefetch_(false),
+    level_read_(0),
+    base_dir_(),
+    base_files_(),
+    base_file_map_()
 {
   proxy_enzo_simulation[0].p_io_reader_created();
 }
@@ -197,14 +216,24 @@ void Simulation::r_restart_start (CkReductionMsg * msg)
   delete msg;
   // [ Called on root process only ]
 
-  // Insert an IoEnzoReader element for each file
+  std::vector<std::string> restart_files(restart_num_files_);
+  for (int i_f=0; i_f<restart_num_files_; i_f++) {
+    restart_stream_file_list_ >> restart_files[i_f];
+  }
+
+  // Initialize IoEnzoReader elements: reader i reads part i - i0 of
+  // file i*nf/nr, where readers i0 <= i < i1 share the file
   const int max_level = cello::config()->mesh_max_level;
-  for (int i=0; i<restart_num_files_; i++) {
-    std::string restart_file;
-    restart_stream_file_list_ >> restart_file;
-    // Create ith io_reader to read name_file
+  const bool prefetch = cello::config()->initial_restart_prefetch;
+  const long long nf = restart_num_files_;
+  const long long nr = restart_num_readers_;
+  for (int i=0; i<restart_num_readers_; i++) {
+    const long long i_f = i*nf/nr;
+    const int i0 = (i_f*nr     + nf - 1) / nf;
+    const int i1 = ((i_f+1)*nr + nf - 1) / nf;
     proxy_io_enzo_reader[i].p_init_root
-      (restart_directory_,restart_file,max_level);
+      (restart_directory_,restart_files[i_f],max_level,
+       i - i0, i1 - i0, prefetch);
   }
 }
 
@@ -213,19 +242,27 @@ void Simulation::r_restart_start (CkReductionMsg * msg)
 //----------------------------------------------------------------------
 
 void IoEnzoReader::p_init_root
-(std::string name_dir, std::string name_file, int max_level)
+(std::string name_dir, std::string name_file, int max_level,
+ int part, int num_parts, bool prefetch)
 {
   TRACE_READER("p_init_root()",this);
   // save initialization parameters
   name_dir_  = name_dir;
   name_file_ = name_file;
   max_level_ = max_level;
+  part_      = part;
+  num_parts_ = num_parts;
+  prefetch_  = prefetch;
+  level_read_ = 0;
 
   stream_block_list_ = stream_open_blocks_(name_dir, name_file);
 
   // open the HDF5 file
   file_open_block_list_(name_dir,name_file);
 
+  // locate the full checkpoint if this is a delta checkpoint
+  file_open_base_(name_dir);
+
   sync_blocks_.reset();
   TRACE_SYNC(sync_blocks_,"sync_blocks_ reset()");
 
@@ -236,9 +273,16 @@ void IoEnzoReader::p_init_root
 
   std::string block_name;
   int block_level;
+  // Count of blocks in the file per level, for splitting each level
+  // evenly between the readers of the file
+  std::vector<int> blocks_in_file_level(max_level+1,0);
   // Read list of blocks and associated refinement levels
   while (read_block_list_(block_name,block_level)) {
 
+    // skip blocks read by other readers of the file
+    const int i_block = blocks_in_file_level[std::max(block_level,0)]++;
+    if (i_block % num_parts_ != part_) continue;
+
     // save block name and level
     block_name_list_.push_back(block_name);
     block_level_list_.push_back(block_level);
@@ -317,6 +361,9 @@ void IoEnzoReader::p_init_root
   // self + 1
   ++ sync_blocks_;
   block_ready_();
+
+  // read the next level while root-level Blocks are initialized
+  if (prefetch_ && max_level_ >= 1) read_level_(1);
 }
 
 //----------------------------------------------------------------------
@@ -380,16 +427,12 @@ void EnzoSimulation::p_restart_next_level()
 // LEVEL K
 //----------------------------------------------------------------------
 
-void IoEnzoReader::p_create_level (int level)
+void IoEnzoReader::read_level_ (int level)
 {
-  level_ = level;
-  TRACE_READER("p_create_level()",this);
-  const int num_blocks_level = io_msg_check_[level].size();
-  sync_blocks_.reset();
-  sync_blocks_.set_stop(num_blocks_level+1);
+  TRACE_READER("read_level_()",this);
   int i=0;
   for (int k=0; k<block_name_list_.size(); k++) {
-    // skip over blocks not in current level
+    // skip over blocks not in the level
     if (block_level_list_[k] != level) continue;
 
     EnzoMsgCheck * msg_check = io_msg_check_[level][i];
@@ -399,6 +442,26 @@ void IoEnzoReader::p_create_level (int level)
     std::string block_name = block_name_list_[k];
     file_read_block_ (msg_check, block_name);
 
+    i++;
+  }
+  level_read_ = level;
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::p_create_level (int level)
+{
+  level_ = level;
+  TRACE_READER("p_create_level()",this);
+  const int num_blocks_level = io_msg_check_[level].size();
+  sync_blocks_.reset();
+  sync_blocks_.set_stop(num_blocks_level+1);
+
+  // read the level unless already prefetched
+  if (level_read_ < level) read_level_(level);
+
+  for (int i=0; i<num_blocks_level; i++) {
+
     IoEnzoBlock * io_block = io_msg_check_[level][i]->io_block();
     int i3[3];
     io_block->index(i3);
@@ -408,17 +471,39 @@ void IoEnzoReader::p_create_level (int level)
     int ic3[3];
     index.child(level,ic3,ic3+1,ic3+2);
 
-    long long index_order,count_order;
-    io_block->get_order(&index_order,&count_order);
-    int ip = (long long) CkNumPes()*index_order / count_order;
+    // create the Block directly on the process given by cutting the
+    // saved ordering into equal-cost segments, one per process,
+    // falling back to equal Block counts if costs were not measured,
+    // else on the parent's process
+    const int ip = restart_block_process_(io_block);
 
     enzo::block_array()[index_parent].p_restart_refine(ic3,thisIndex,ip);
-
-    i++;
   }
   // self
   block_created_();
 }
+
+//----------------------------------------------------------------------
+
+int IoEnzoReader::restart_block_process_ (IoBlock * io_block) const
+{
+  const int np = CkNumPes();
+  double cost_self,cost_index,cost_total;
+  io_block->get_order_cost(&cost_self,&cost_index,&cost_total);
+  long long index_order,count_order;
+  io_block->get_order(&index_order,&count_order);
+
+  int ip = -1;
+  if (cost_total > 0.0) {
+    ip = np*(cost_index + 0.5*cost_self)/cost_total;
+  } else if (count_order > 0) {
+    ip = (long long) np*index_order / count_order;
+  } else {
+    return -1;
+  }
+  return std::max(0,std::min(ip,np-1));
+}
+
 //----------------------------------------------------------------------
 
 void EnzoBlock::p_restart_refine(int ic3[3],int io_reader, int ip)
@@ -544,6 +629,9 @@ void IoEnzoReader::p_init_level (int level)
       file_close_block_list_();
     }
   block_ready_();
+
+  // read the next level while this level's Blocks are initialized
+  if (prefetch_ && level < max_level_) read_level_(level+1);
 }
 
 //----------------------------------------------------------------------
@@ -592,6 +680,18 @@ void IoEnzoReader::file_read_hierarchy_()
   // Simulation data
   if (thisIndex == 0) {
     IoSimulation io_simulation = (cello::simulation());
+
+    // native files hold the metadata values concatenated in order
+    const char * pc = nullptr;
+    long long size = 0;
+    if (native_file_ != nullptr) {
+      pc = native_file_->read_record("simulation",&size);
+      ASSERT1("IoEnzoReader::file_read_hierarchy_()",
+              "Missing simulation record in native checkpoint file %s",
+              name_file_.c_str(),
+              pc != nullptr);
+    }
+
     for (size_t i=0; i<io_simulation.meta_count(); i++) {
 
       void * buffer;
@@ -603,7 +703,14 @@ void IoEnzoReader::file_read_hierarchy_()
       io_simulation.meta_value(i,& buffer, &name, &type_scalar, &nx,&ny,&nz);
 
       // Read object's ith metadata
-      file_->file_read_meta(buffer,name.c_str(),&type_scalar,&nx,&ny,&nz);
+      if (native_file_ != nullptr) {
+        const int n = cello::type_bytes[type_scalar]*
+          std::max(nx,1)*std::max(ny,1)*std::max(nz,1);
+        memcpy(buffer,pc,n);
+        pc += n;
+      } else {
+        file_->file_read_meta(buffer,name.c_str(),&type_scalar,&nx,&ny,&nz);
+      }
     }
 
     // Get current state
@@ -626,6 +733,11 @@ void IoEnzoReader::file_read_block_
 (EnzoMsgCheck * msg_check,
  std::string    name_block)
 {
+  if (native_file_ != nullptr) {
+    file_read_block_native_(msg_check,name_block);
+    return;
+  }
+
   // Open HDF5 group for the block
   std::string group_name = "/" + name_block;
   file_->group_chdir(group_name);
@@ -657,15 +769,108 @@ void IoEnzoReader::file_read_block_
 
   file_read_block_particles_(data_msg);
 
-  file_read_block_fields_ (data_msg,nx,ny,nz);
+  file_read_block_fields_ (data_msg,nx,ny,nz,name_block);
 
   file_->group_close();
 }
 
 //----------------------------------------------------------------------
 
+void IoEnzoReader::file_read_block_native_
+(EnzoMsgCheck * msg_check,
+ std::string    name_block)
+{
+  long long size;
+  const char * record = native_file_->read_record(name_block,&size);
+
+  ASSERT2("IoEnzoReader::file_read_block_native_()",
+          "Block %s not found in native checkpoint file %s",
+          name_block.c_str(),name_file_.c_str(),
+          record != nullptr);
+
+  // De-serialize the written message directly from the mapped file;
+  // its field array points into the mapping
+
+  EnzoMsgCheck * msg_file = new EnzoMsgCheck;
+  char * pc = msg_file->load_((char *) record);
+
+  ASSERT3("IoEnzoReader::file_read_block_native_()",
+          "Block %s record size mismatch %ld read %lld written",
+          name_block.c_str(),(pc - record),size,
+          (pc - record) == size);
+
+  // Block attributes and Adapt
+
+  delete msg_check->io_block_;
+  msg_check->set_io_block(msg_file->io_block_);
+  msg_file->io_block_ = nullptr;
+
+  std::copy_n (msg_file->adapt_buffer_, ADAPT_BUFFER_SIZE,
+               msg_check->adapt_buffer_);
+
+  // Copy the written data into new Block data to send, as in
+  // file_read_block_()
+
+  DataMsg * data_file = msg_file->data_msg_;
+  DataMsg * data_msg  = new DataMsg;
+  msg_check->data_msg_ = data_msg;
+
+  if (data_file != nullptr && data_file->particle_data() != nullptr) {
+    data_msg->set_particle_data (data_file->particle_data(),true);
+    data_file->set_particle_data (nullptr,false);
+  }
+
+  FieldFace * field_face_file =
+    (data_file != nullptr) ? data_file->field_face() : nullptr;
+  char * field_array =
+    (data_file != nullptr) ? data_file->field_array() : nullptr;
+
+  if (field_face_file != nullptr && field_array != nullptr) {
+
+    Hierarchy * hierarchy = cello::hierarchy();
+    int root_blocks[3];
+    int root_size[3];
+    hierarchy->root_blocks(root_blocks,root_blocks+1,root_blocks+2);
+    hierarchy->root_size(root_size,root_size+1,root_size+2);
+    const int nx=root_size[0]/root_blocks[0];
+    const int ny=root_size[1]/root_blocks[1];
+    const int nz=root_size[2]/root_blocks[2];
+
+    FieldDescr * field_descr = cello::field_descr();
+    FieldData * field_data = new FieldData (field_descr,nx,ny,nz);
+    field_data->allocate_permanent(field_descr,true);
+    Field field(field_descr,field_data);
+
+    // invert face since incoming not outgoing
+    field_face_file->invert_face();
+    field_face_file->array_to_face(field_array,field);
+
+    Refresh * refresh = new Refresh;
+    refresh->add_all_data();
+    FieldFace  * field_face = new FieldFace(cello::rank());
+
+    field_face -> set_refresh_type (refresh_same);
+    field_face -> set_child (0,0,0);
+    field_face -> set_face (0,0,0);
+    field_face -> set_ghost(true,true,true);
+    field_face -> set_refresh(refresh,true);
+    bool is_new;
+    data_msg -> set_field_face (field_face,is_new=true);
+    data_msg -> set_field_data (field_data,is_new=true);
+  }
+
+  if (field_face_file != nullptr) {
+    FieldFacePool::release(field_face_file);
+    data_file->set_field_face(nullptr,false);
+  }
+
+  delete msg_file;
+}
+
+//----------------------------------------------------------------------
+
 void IoEnzoReader::file_read_block_fields_
-(DataMsg * data_msg, int nx, int ny, int nz)
+(DataMsg * data_msg, int nx, int ny, int nz, std::string name_block)
 {
   FieldDescr * field_descr = cello::field_descr();
   // Initialize field data
@@ -690,16 +895,33 @@ void IoEnzoReader::file_read_block_fields_
     data_msg -> set_field_face (field_face,is_new=true);
     data_msg -> set_field_data (field_data,is_new=true);
   }
+
+  // In a delta checkpoint, fields unchanged since the full checkpoint
+  // are read from the given file of the full checkpoint instead
+  std::vector<int> field_base_file(field_descr->field_count(),-1);
+  if (base_dir_ != "") {
+    int type, size;
+    file_->group_read_meta
+      (field_base_file.data(),"delta_base_file",&type,&size);
+  }
+
   for (int i_f=0; i_f<num_fields; i_f++) {
 
     const std::string field_name = field_descr->field_name(i_f);
     int index_field = field_descr->field_id(field_name);
 
+    FileHdf5 * file = file_;
+    if (field_base_file[i_f] >= 0) {
+      file = base_file_(field_base_file[i_f]);
+      file->group_chdir("/" + name_block);
+      file->group_open();
+    }
+
     const std::string dataset_name = std::string("field_") + field_name;
     int m4[4];
     int type_data = type_unknown;
-    file_->data_open (dataset_name, &type_data,
-                      m4,m4+1,m4+2,m4+3);
+    file->data_open (dataset_name, &type_data,
+                     m4,m4+1,m4+2,m4+3);
     int mx,my,mz;
     int gx,gy,gz;
 
@@ -709,9 +931,10 @@ void IoEnzoReader::file_read_block_fields_
     char * buffer = field.values(field_name);
 
     file_read_dataset_
-      (buffer, type_data, mx,my,mz,m4);
+      (file, buffer, type_data, mx,my,mz,m4);
 
-    file_->data_close();
+    file->data_close();
+    if (file != file_) file->group_close();
 
   }
 }
@@ -773,7 +996,7 @@ void IoEnzoReader::file_read_block_particles_ (DataMsg * data_msg)
       int nx=m4[0];
       int ny=m4[1];
       int nz=m4[2];
-      file_read_dataset_(buffer, type_data, nx,ny,nz,m4);
+      file_read_dataset_(file_, buffer, type_data, nx,ny,nz,m4);
 
       // ...then copy to particle batches
 
@@ -837,6 +1060,9 @@ void IoEnzoReader::read_meta_
 
     // Read object's ith metadata
     if ( type_meta == "group" ) {
+      // Block costs are missing from older checkpoints, so leave them
+      // zero and restart_block_process_() falls back to Block counts
+      if (name == "cost_order" && ! file->group_meta_exists(name)) continue;
       file->group_read_meta(buffer,name.c_str(),&type_scalar,&nx,&ny,&nz);
     } else if (type_meta == "file") {
       file->file_read_meta(buffer,name.c_str(),&type_scalar,&nx,&ny,&nz);
@@ -859,6 +1085,12 @@ bool IoEnzoReader::read_block_list_(std::string & block_name, int & level)
 void IoEnzoReader::file_open_block_list_
 (std::string path_name, std::string file_name)
 {
+  // Map the native file if written, else open the HDF5 file
+  if (IoEnzoNativeFile::file_exists(path_name, file_name + ".native")) {
+    native_file_ = new IoEnzoNativeFile (path_name, file_name + ".native");
+    native_file_->file_open();
+    return;
+  }
   // Create File
   file_name = file_name + ".h5";
   file_ = new FileHdf5 (path_name, file_name);
@@ -868,7 +1100,7 @@ void IoEnzoReader::file_open_block_list_
 //----------------------------------------------------------------------
 
 void IoEnzoReader::file_read_dataset_
-(char * buffer, int type_data,
+(FileHdf5 * file, char * buffer, int type_data,
  int nx, int ny, int nz,
  int m4[4])
 {
@@ -886,7 +1118,7 @@ void IoEnzoReader::file_read_dataset_
 
   // open the dataspace
 
-  file_-> data_slice
+  file-> data_slice
     (m4[0],m4[1],m4[2],m4[3],
      n4[0],n4[1],n4[2],n4[3],
      o4[0],o4[1],o4[2],o4[3]);
@@ -897,20 +1129,71 @@ void IoEnzoReader::file_read_dataset_
     const int gx=(nx-m4[0])/2;
     const int gy=(ny-m4[1])/2;
     const int gz=(nz-m4[2])/2;
-    file_->mem_create (nx,ny,nz,m4[0],m4[1],m4[2],gx,gy,gz);
+    file->mem_create (nx,ny,nz,m4[0],m4[1],m4[2],gx,gy,gz);
   } else {
     // include_ghosts = true
-    file_->mem_create (nx,ny,nz,nx,ny,nz,0,0,0);
+    file->mem_create (nx,ny,nz,nx,ny,nz,0,0,0);
   }
 
-  file_->data_read (buffer);
+  file->data_read (buffer);
 }
 //----------------------------------------------------------------------
 
 void IoEnzoReader::file_close_block_list_()
 {
+  if (native_file_ != nullptr) {
+    native_file_->file_close();
+    delete native_file_;
+    native_file_ = nullptr;
+    return;
+  }
   file_->data_close();
   file_->file_close();
   delete file_;
+  for (auto & it : base_file_map_) {
+    it.second->file_close();
+    delete it.second;
+  }
+  base_file_map_.clear();
+}
+
+//----------------------------------------------------------------------
+
+void IoEnzoReader::file_open_base_(std::string name_dir)
+{
+  // A delta checkpoint's manifest names its full checkpoint
+  base_dir_ = "";
+  base_files_.clear();
+  std::ifstream stream_delta (name_dir + "/check.delta");
+  if (! (stream_delta >> base_dir_)) return;
+
+  std::string name_file = base_dir_ + "/check.file_list";
+  std::ifstream stream_file_list (name_file);
+  ASSERT1("IoEnzoReader::file_open_base_",
+          "Cannot open full checkpoint file list %s for reading",
+          name_file.c_str(),stream_file_list);
+
+  int num_files = 0;
+  stream_file_list >> num_files;
+  base_files_.resize(num_files);
+  for (int i=0; i<num_files; i++) stream_file_list >> base_files_[i];
+}
+
+//----------------------------------------------------------------------
+
+FileHdf5 * IoEnzoReader::base_file_(int index_file)
+{
+  auto it = base_file_map_.find(index_file);
+  if (it != base_file_map_.end()) return it->second;
+
+  ASSERT2("IoEnzoReader::base_file_",
+          "Full checkpoint file %d out of range [0,%d)",
+          index_file,int(base_files_.size()),
+          (0 <= index_file && index_file < int(base_files_.size())));
+
+  FileHdf5 * file = new FileHdf5 (base_dir_, base_files_[index_file] + ".h5");
+  file->file_open();
+  base_file_map_[index_file] = file;
+  return file;
 }
 
@@ -12,6 +12,7 @@
 // System includes
 //----------------------------------------------------------------------
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -32,6 +33,7 @@
 //----------------------------------------------------------------------
 
 #include "io/IoEnzoBlock.hpp"
+#include "io/IoEnzoNativeFile.hpp"
 #include "io/IoEnzoReader.hpp"
 #include "io/IoEnzoWriter.hpp"
 
@@ -40,4 +42,6 @@
 #include "io/EnzoInitialHdf5.hpp"
 #include "io/EnzoInitialMusic.hpp"
 
+#include "io/EnzoOutputLightcone.hpp"
+
 #endif /* ENZO_IO_IO_HPP */
@@ -89,6 +89,7 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
   int gx,gy,gz;
   field.dimensions (id_field, &mx,&my,&mz);
   field.ghost_depth(id_field, &gx,&gy,&gz);
+  apply_buffer_(&gx,&gy,&gz);
 
   precision_type precision = field.precision(id_field);
 
@@ -146,15 +147,11 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 		name_.c_str(),mass_min_refine);
 #endif      
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho4[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
+    {
+      // both conditions depend only on the maximum mass
+      const double mass = vol*array_max_(rho4,mx,my,mz,gx,gy,gz);
+      any_refine  = (mass > mass_min_refine);
+      all_coarsen = ! (mass > mass_max_coarsen);
     }
     break;
   case precision_double:
@@ -175,15 +172,11 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 	}
       }
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  double mass = vol*rho8[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
+    {
+      // both conditions depend only on the maximum mass
+      const double mass = vol*array_max_(rho8,mx,my,mz,gx,gy,gz);
+      any_refine  = (mass > mass_min_refine);
+      all_coarsen = ! (mass > mass_max_coarsen);
     }
     break;
   case precision_quadruple:
@@ -200,15 +193,11 @@ int EnzoRefineMass::apply ( Block * block ) throw ()
 	}
       }
     }
-    for (int iz=gz; iz<mz-gz; iz++) {
-      for (int iy=gy; iy<my-gy; iy++) {
-	for (int ix=gx; ix<mx-gx; ix++) {
-	  int i = ix + mx*(iy + my*iz);
-	  long double mass = vol*rho16[i];
-	  if (mass > mass_min_refine)  any_refine  = true;
-	  if (mass > mass_max_coarsen) all_coarsen = false;
-	}
-      }
+    {
+      // both conditions depend only on the maximum mass
+      const long double mass = vol*array_max_(rho16,mx,my,mz,gx,gy,gz);
+      any_refine  = (mass > mass_min_refine);
+      all_coarsen = ! (mass > mass_max_coarsen);
     }
     break;
   default:
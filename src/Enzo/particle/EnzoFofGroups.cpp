@@ -0,0 +1,141 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFofGroups.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the EnzoFofGroups class
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/particle/particle.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoFofGroups::EnzoFofGroups (int np, const enzo_float * x, enzo_float link)
+  : parent_(np),
+    size_(np,1),
+    group_(np),
+    group_start_(1,0),
+    group_members_(np)
+{
+  for (int i=0; i<np; i++) parent_[i] = i;
+
+  if (np > 1) {
+
+    // Bounding box of the points
+
+    double xm[3], xp[3];
+    for (int axis=0; axis<3; axis++) {
+      xm[axis] = xp[axis] = x[axis];
+    }
+    for (int i=1; i<np; i++) {
+      for (int axis=0; axis<3; axis++) {
+        xm[axis] = std::min(xm[axis],double(x[3*i+axis]));
+        xp[axis] = std::max(xp[axis],double(x[3*i+axis]));
+      }
+    }
+
+    // Cell width: at least the linking length, and large enough that
+    // the number of cells is not much more than the number of points
+
+    double h = link;
+    const double volume =
+      (xp[0]-xm[0]+h)*(xp[1]-xm[1]+h)*(xp[2]-xm[2]+h);
+    h = std::max(h, std::cbrt(volume / (8.0*np)));
+
+    int n3[3];
+    for (int axis=0; axis<3; axis++) {
+      n3[axis] = int((xp[axis]-xm[axis])/h) + 1;
+    }
+    const int nc = n3[0]*n3[1]*n3[2];
+
+    // Cell-linked list: points sorted by cell, with cell c holding
+    // points cell_points[cell_start[c]:cell_start[c+1]]
+
+    std::vector<int> cell(np);
+    for (int i=0; i<np; i++) {
+      int i3[3];
+      for (int axis=0; axis<3; axis++) {
+        i3[axis] = std::min(int((x[3*i+axis]-xm[axis])/h),n3[axis]-1);
+      }
+      cell[i] = i3[0] + n3[0]*(i3[1] + n3[1]*i3[2]);
+    }
+
+    std::vector<int> cell_start(nc+1,0);
+    for (int i=0; i<np; i++) ++cell_start[cell[i]+1];
+    for (int c=0; c<nc; c++) cell_start[c+1] += cell_start[c];
+
+    std::vector<int> cell_points(np);
+    std::vector<int> cell_count(cell_start.begin(),cell_start.end()-1);
+    for (int i=0; i<np; i++) cell_points[cell_count[cell[i]]++] = i;
+
+    // Join friends in the same cell, and in the 13 adjacent cells
+    // "after" each cell, so that each pair of cells is searched once
+
+    const double link2 = double(link)*link;
+
+    for (int iz=0; iz<n3[2]; iz++) {
+      for (int iy=0; iy<n3[1]; iy++) {
+        for (int ix=0; ix<n3[0]; ix++) {
+          const int c1 = ix + n3[0]*(iy + n3[1]*iz);
+          if (cell_start[c1] == cell_start[c1+1]) continue;
+          for (int kz=0; kz<=1; kz++) {
+            for (int ky=(kz ? -1 : 0); ky<=1; ky++) {
+              for (int kx=((kz || ky) ? -1 : 0); kx<=1; kx++) {
+                const int jx = ix+kx, jy = iy+ky, jz = iz+kz;
+                if (jx < 0 || jx >= n3[0] ||
+                    jy < 0 || jy >= n3[1] ||
+                    jz >= n3[2]) continue;
+                const int c2 = jx + n3[0]*(jy + n3[1]*jz);
+                const bool same = (c1 == c2);
+                for (int k1=cell_start[c1]; k1<cell_start[c1+1]; k1++) {
+                  const int i1 = cell_points[k1];
+                  const enzo_float * x1 = x + 3*i1;
+                  const int k20 = same ? k1 + 1 : cell_start[c2];
+                  for (int k2=k20; k2<cell_start[c2+1]; k2++) {
+                    const int i2 = cell_points[k2];
+                    const enzo_float * x2 = x + 3*i2;
+                    const double dx = x1[0]-x2[0];
+                    const double dy = x1[1]-x2[1];
+                    const double dz = x1[2]-x2[2];
+                    if (dx*dx + dy*dy + dz*dz < link2) union_(i1,i2);
+                  }
+                }
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+
+  // Number groups in order of their lowest-indexed member, and list
+  // members consecutively by group in increasing order
+
+  std::vector<int> root_group(np,-1);
+  int ng = 0;
+  for (int i=0; i<np; i++) {
+    const int r = find_(i);
+    if (root_group[r] < 0) {
+      root_group[r] = ng++;
+      group_start_.push_back(size_[r]);
+    }
+    group_[i] = root_group[r];
+  }
+  for (int ig=0; ig<ng; ig++) group_start_[ig+1] += group_start_[ig];
+
+  std::vector<int> group_count(group_start_.begin(),group_start_.end()-1);
+  for (int i=0; i<np; i++) group_members_[group_count[group_[i]]++] = i;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFofGroups::union_ (int i, int j)
+{
+  int ri = find_(i);
+  int rj = find_(j);
+  if (ri == rj) return;
+  if (size_[ri] < size_[rj]) std::swap(ri,rj);
+  parent_[rj] = ri;
+  size_[ri] += size_[rj];
+}
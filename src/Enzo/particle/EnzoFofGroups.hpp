@@ -0,0 +1,85 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFofGroups.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of the EnzoFofGroups class
+
+#ifndef ENZO_PARTICLE_ENZO_FOF_GROUPS_HPP
+#define ENZO_PARTICLE_ENZO_FOF_GROUPS_HPP
+
+class EnzoFofGroups {
+
+  /// @class    EnzoFofGroups
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Friends-of-friends groups of a set of points
+  ///
+  /// Two points are friends if their distance is less than the linking
+  /// length, and groups are the connected components of the friend
+  /// relation.  Points are binned into a uniform grid of cells at
+  /// least one linking length wide, stored as a flat cell-linked list
+  /// (points sorted by cell with an offset array), so that friends of
+  /// a point can only be in the same or an adjacent cell.  Friends are
+  /// joined using union-find with path compression and union by size.
+  ///
+  /// Groups are numbered in order of their lowest-indexed member, and
+  /// members of each group are listed in increasing order, so the
+  /// first member of each group is its lowest-indexed point.
+
+public: // interface
+
+  /// Find the groups of the np points with coordinates x[3*i+axis]
+  /// and the given linking length
+  EnzoFofGroups (int np, const enzo_float * x, enzo_float link);
+
+  /// Return the number of groups
+  int num_groups () const
+  { return group_start_.size() - 1; }
+
+  /// Return the number of points in group ig
+  int group_size (int ig) const
+  { return group_start_[ig+1] - group_start_[ig]; }
+
+  /// Return the array of indices of points in group ig
+  const int * group_members (int ig) const
+  { return group_members_.data() + group_start_[ig]; }
+
+  /// Return the group containing point i
+  int group (int i) const
+  { return group_[i]; }
+
+private: // functions
+
+  /// Return the root of the set containing point i, compressing the
+  /// path from i to the root
+  int find_ (int i)
+  {
+    while (parent_[i] != i) {
+      parent_[i] = parent_[parent_[i]];
+      i = parent_[i];
+    }
+    return i;
+  }
+
+  /// Merge the sets containing points i and j
+  void union_ (int i, int j);
+
+private: // attributes
+
+  /// Union-find parent and set size of each point
+  std::vector<int> parent_;
+  std::vector<int> size_;
+
+  /// Group of each point
+  std::vector<int> group_;
+
+  /// Offset of each group's members in group_members_, and the total
+  /// number of points at the end
+  std::vector<int> group_start_;
+
+  /// Indices of points, listed consecutively by group
+  std::vector<int> group_members_;
+
+};
+
+#endif /* ENZO_PARTICLE_ENZO_FOF_GROUPS_HPP */
@@ -0,0 +1,542 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodFofHalos.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the in-situ friends-of-friends halo finder
+///
+/// Catalog reduction array (double):
+///
+///    [0]  index of the Method in the Problem's method list
+///    [1]  cycle
+///    [2]  time
+///    [3 ...] one record per group, in increasing order of label:
+///            label, count, mass, x, y, z, vx, vy, vz
+///
+/// Positions are mass-weighted means folded into the domain, and
+/// velocities are mass-weighted means.  Records of Blocks contain
+/// only the groups with at least min_members local particles or with
+/// particles within a linking length of the Block boundary, since all
+/// other groups are known to be too small.
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/particle/particle.hpp"
+
+#include <array>
+
+/// Number of header values in the catalog reduction array
+#define FOF_HALOS_HEADER 3
+
+/// Number of values per group in the catalog reduction array
+#define FOF_HALOS_RECORD 9
+
+//----------------------------------------------------------------------
+
+EnzoMethodFofHalos::EnzoMethodFofHalos(ParameterGroup p)
+  : Method(),
+    type_(p.value_string("type","dark")),
+    linking_length_(0.0),
+    min_members_(p.value_integer("min_members",20)),
+    file_name_(p.value_string("file_name","fof_halos-%06d.data")),
+    ir_link_(-1)
+{
+  const EnzoConfig * enzo_config = enzo::config();
+
+  ASSERT ("EnzoMethodFofHalos::EnzoMethodFofHalos()",
+          "EnzoMethodFofHalos requires that Adapt:min_face_rank = 0, so "
+          "that particles are copied across Block edges and corners",
+          enzo_config->adapt_min_face_rank == 0);
+
+  ASSERT1 ("EnzoMethodFofHalos::EnzoMethodFofHalos()",
+           "Method:fof_halos:min_members = %d must be at least 1",
+           min_members_, (min_members_ >= 1));
+
+  ParticleDescr * particle_descr = cello::particle_descr();
+  const int it = particle_descr->type_index(type_);
+
+  ASSERT1 ("EnzoMethodFofHalos::EnzoMethodFofHalos()",
+           "Particle type %s is not defined", type_.c_str(), (it >= 0));
+
+  // labels must be carried with copied particles, and copies must be
+  // distinguishable from local particles
+
+  const char * required[] = {"id", "is_copy", "fof_label"};
+  for (const char * attribute : required) {
+    ASSERT2 ("EnzoMethodFofHalos::EnzoMethodFofHalos()",
+             "Particle type %s must have an int64 attribute %s "
+             "(see Particle:list)",
+             type_.c_str(), attribute,
+             particle_descr->has_attribute(it,attribute));
+  }
+
+  // linking length is given in units of the root-level cell width
+
+  double cell_width = 0.0;
+  for (int axis = 0; axis < cello::rank(); axis++) {
+    cell_width = std::max
+      (cell_width,
+       (enzo_config->domain_upper[axis] - enzo_config->domain_lower[axis]) /
+       enzo_config->mesh_root_size[axis]);
+  }
+  const double linking_length = p.value_float("linking_length",0.2);
+
+  ASSERT1 ("EnzoMethodFofHalos::EnzoMethodFofHalos()",
+           "Method:fof_halos:linking_length = %g must be positive",
+           linking_length, (linking_length > 0.0));
+
+  linking_length_ = linking_length * cell_width;
+
+  // no fields are needed; particles are copied by a separate Refresh
+  // in each linking iteration
+
+  cello::simulation()->refresh_set_name(ir_post_,name());
+
+  ir_link_ = add_refresh_();
+  cello::simulation()->refresh_set_name(ir_link_,name()+":link");
+  Refresh * refresh = cello::refresh(ir_link_);
+  refresh->add_particle(it);
+  refresh->set_particles_are_copied(true);
+  refresh->set_particle_copy_width(linking_length_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFofHalos::pup (PUP::er &p)
+{
+  // NOTE: Change this function whenever attributes change
+
+  TRACEPUP;
+
+  Method::pup(p);
+
+  p | type_;
+  p | linking_length_;
+  p | min_members_;
+  p | file_name_;
+  p | ir_link_;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFofHalos::compute ( Block * block) throw()
+{
+  if (block->is_leaf()) {
+
+    Particle particle = block->data()->particle();
+    const int it = particle.type_index(type_);
+    const int ia_id    = particle.attribute_index(it,"id");
+    const int ia_label = particle.attribute_index(it,"fof_label");
+    const int d_id    = particle.stride(it,ia_id);
+    const int d_label = particle.stride(it,ia_label);
+
+    double xm,ym,zm;
+    double xp,yp,zp;
+    block->lower(&xm,&ym,&zm);
+    block->upper(&xp,&yp,&zp);
+
+    // copies are only found within one Block width of each face
+
+    const int rank = cello::rank();
+    const double width[3] = {xp-xm, yp-ym, zp-zm};
+    for (int axis=0; axis<rank; axis++) {
+      ASSERT3 ("EnzoMethodFofHalos::compute()",
+               "Linking length %g exceeds the width %g of Block %s",
+               linking_length_, width[axis], block->name().c_str(),
+               (linking_length_ < width[axis]));
+    }
+
+    // every particle starts in its own group
+
+    for (int ib=0; ib<particle.num_batches(it); ib++) {
+      const int np = particle.num_particles(it,ib);
+      const int64_t * id  = (const int64_t *)
+        particle.attribute_array(it,ia_id,ib);
+      int64_t * label = (int64_t *)
+        particle.attribute_array(it,ia_label,ib);
+      for (int ip=0; ip<np; ip++) {
+        label[ip*d_label] = id[ip*d_id];
+      }
+    }
+  }
+
+  link_start_(block);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFofHalos::link_start_ (Block * block) throw()
+{
+  if (block->is_leaf()) {
+    block->refresh_start
+      (ir_link_,CkIndex_EnzoBlock::p_method_fof_halos_link());
+  } else {
+    link(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::p_method_fof_halos_link()
+{
+  EnzoMethodFofHalos * method =
+    static_cast<EnzoMethodFofHalos*> (this->method());
+  method->link(this);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFofHalos::link (Block * block) throw()
+{
+  int num_changed = 0;
+
+  if (block->is_leaf()) {
+
+    Hierarchy * hierarchy = cello::hierarchy();
+    Particle particle = block->data()->particle();
+    const int it = particle.type_index(type_);
+    const int ia_label = particle.attribute_index(it,"fof_label");
+    const int ia_copy  = particle.attribute_index(it,"is_copy");
+    const int d_label = particle.stride(it,ia_label);
+    const int d_copy  = particle.stride(it,ia_copy);
+
+    double lower[3], upper[3];
+    block->lower(lower,lower+1,lower+2);
+    block->upper(upper,upper+1,upper+2);
+    const double center[3] = { 0.5*(lower[0]+upper[0]),
+                               0.5*(lower[1]+upper[1]),
+                               0.5*(lower[2]+upper[2]) };
+
+    // gather positions, as the periodic images nearest the Block
+    // center, of local particles and copies
+
+    const int np = particle.num_particles(it);
+    std::vector<enzo_float> x (3*np,0.0);
+    std::vector<int64_t *> label (np,nullptr);
+    std::vector<char> is_copy (np,0);
+
+    int i = 0;
+    for (int ib=0; ib<particle.num_batches(it); ib++) {
+      const int npb = particle.num_particles(it,ib);
+      int64_t * label_batch = (int64_t *)
+        particle.attribute_array(it,ia_label,ib);
+      const int64_t * copy_batch = (const int64_t *)
+        particle.attribute_array(it,ia_copy,ib);
+      std::vector<double> xa(npb,0.0), ya(npb,0.0), za(npb,0.0);
+      particle.position(it,ib,xa.data(),ya.data(),za.data(),lower,upper);
+      for (int ip=0; ip<npb; ip++,i++) {
+        const double pos[3] = {xa[ip],ya[ip],za[ip]};
+        double npi[3];
+        hierarchy->get_nearest_periodic_image(pos,center,npi);
+        for (int axis=0; axis<3; axis++) x[3*i+axis] = npi[axis];
+        label[i] = label_batch + ip*d_label;
+        is_copy[i] = (copy_batch[ip*d_copy] != 0);
+      }
+    }
+
+    EnzoFofGroups fof_groups (np, x.data(), linking_length_);
+
+    // lower labels of local particles to the smallest in their group
+
+    for (int ig=0; ig<fof_groups.num_groups(); ig++) {
+      const int size = fof_groups.group_size(ig);
+      if (size == 1) continue;
+      const int * members = fof_groups.group_members(ig);
+      int64_t label_min = *label[members[0]];
+      for (int k=1; k<size; k++) {
+        label_min = std::min(label_min,*label[members[k]]);
+      }
+      for (int k=0; k<size; k++) {
+        int64_t * l = label[members[k]];
+        if (*l > label_min && ! is_copy[members[k]]) {
+          *l = label_min;
+          ++num_changed;
+        }
+      }
+    }
+
+    // delete copies, which may lie inside the Block if it is
+    // periodic with itself
+
+    int count = 0;
+    for (int ib=0; ib<particle.num_batches(it); ib++) {
+      const int npb = particle.num_particles(it,ib);
+      const int64_t * copy = (const int64_t *)
+        particle.attribute_array(it,ia_copy,ib);
+      bool * mask = new bool[npb];
+      for (int ip=0; ip<npb; ip++) mask[ip] = (copy[ip*d_copy] != 0);
+      count += particle.delete_particles(it,ib,mask);
+      delete [] mask;
+    }
+    if (count > 0) particle.compress(it);
+    cello::simulation()->data_delete_particles(count);
+  }
+
+  EnzoBlock * enzo_block = enzo::block(block);
+  CkCallback callback (CkIndex_EnzoBlock::r_method_fof_halos_linked(NULL),
+                       enzo_block->proxy_array());
+  enzo_block->contribute(sizeof(int),&num_changed,
+                         CkReduction::sum_int,callback);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoBlock::r_method_fof_halos_linked(CkReductionMsg * msg)
+{
+  const int num_changed = *(int *)msg->getData();
+  delete msg;
+  EnzoMethodFofHalos * method =
+    static_cast<EnzoMethodFofHalos*> (this->method());
+  method->linked(this,num_changed);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFofHalos::linked (Block * block, int num_changed) throw()
+{
+  if (num_changed > 0) {
+    link_start_(block);
+  } else {
+    catalog_(block);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFofHalos::catalog_ (Block * block) throw()
+{
+  // locate this Method in the Problem's method list so the root
+  // process can find it when the reduction completes
+
+  Problem * problem = cello::problem();
+  int index_method = 0;
+  while (problem->method(index_method) != this) ++index_method;
+
+  std::vector<double> reduce (FOF_HALOS_HEADER,0.0);
+  reduce[0] = index_method;
+  reduce[1] = block->cycle();
+  reduce[2] = block->time();
+
+  if (block->is_leaf()) {
+
+    Hierarchy * hierarchy = cello::hierarchy();
+    Particle particle = block->data()->particle();
+    const int it = particle.type_index(type_);
+    const int ia_label = particle.attribute_index(it,"fof_label");
+    const int d_label = particle.stride(it,ia_label);
+    const int rank = cello::rank();
+
+    double lower[3], upper[3];
+    block->lower(lower,lower+1,lower+2);
+    block->upper(upper,upper+1,upper+2);
+    const double center[3] = { 0.5*(lower[0]+upper[0]),
+                               0.5*(lower[1]+upper[1]),
+                               0.5*(lower[2]+upper[2]) };
+
+    // partial sums of count, mass, mass*position, and mass*velocity
+    // of each group, and whether the group may extend past the Block
+
+    std::map<int64_t,std::array<double,FOF_HALOS_RECORD>> sums;
+    std::set<int64_t> is_boundary;
+
+    const bool mass_is_attribute = particle.has_attribute(it,"mass");
+    const bool mass_is_constant  = particle.has_constant(it,"mass");
+
+    for (int ib=0; ib<particle.num_batches(it); ib++) {
+      const int np = particle.num_particles(it,ib);
+      const int64_t * label = (const int64_t *)
+        particle.attribute_array(it,ia_label,ib);
+
+      std::vector<double> xa(np,0.0), ya(np,0.0), za(np,0.0);
+      std::vector<double> va(np,0.0), vb(np,0.0), vc(np,0.0);
+      particle.position(it,ib,xa.data(),ya.data(),za.data(),lower,upper);
+      particle.velocity(it,ib,va.data(),vb.data(),vc.data());
+
+      const enzo_float * pmass = nullptr;
+      int dm = 0;
+      if (mass_is_attribute) {
+        const int ia_m = particle.attribute_index(it,"mass");
+        pmass = (const enzo_float *) particle.attribute_array(it,ia_m,ib);
+        dm = particle.stride(it,ia_m);
+      } else if (mass_is_constant) {
+        const int ic_m = particle.constant_index(it,"mass");
+        pmass = (const enzo_float *) particle.constant_value(it,ic_m);
+      }
+
+      for (int ip=0; ip<np; ip++) {
+        const int64_t l = label[ip*d_label];
+        const double m = pmass ? pmass[ip*dm] : 1.0;
+        const double pos[3] = {xa[ip],ya[ip],za[ip]};
+        double npi[3];
+        hierarchy->get_nearest_periodic_image(pos,center,npi);
+
+        auto it_sum = sums.find(l);
+        if (it_sum == sums.end()) {
+          std::array<double,FOF_HALOS_RECORD> zero;
+          zero.fill(0.0);
+          zero[0] = l;
+          it_sum = sums.emplace(l,zero).first;
+        }
+        std::array<double,FOF_HALOS_RECORD> & s = it_sum->second;
+        s[1] += 1.0;
+        s[2] += m;
+        s[3] += m*npi[0];
+        s[4] += m*npi[1];
+        s[5] += m*npi[2];
+        s[6] += m*va[ip];
+        s[7] += m*vb[ip];
+        s[8] += m*vc[ip];
+
+        for (int axis=0; axis<rank; axis++) {
+          if (npi[axis] - lower[axis] < linking_length_ ||
+              upper[axis] - npi[axis] < linking_length_) {
+            is_boundary.insert(l);
+          }
+        }
+      }
+    }
+
+    for (auto & it_sum : sums) {
+      std::array<double,FOF_HALOS_RECORD> & s = it_sum.second;
+      if (s[1] < min_members_ && is_boundary.count(it_sum.first) == 0) continue;
+      const double m = s[2];
+      double com[3] = {s[3]/m, s[4]/m, s[5]/m};
+      double folded[3];
+      hierarchy->get_folded_position(com,folded);
+      s[3] = folded[0];
+      s[4] = folded[1];
+      s[5] = folded[2];
+      for (int axis=0; axis<3; axis++) s[6+axis] /= m;
+      reduce.insert(reduce.end(),s.begin(),s.end());
+    }
+  }
+
+  CkCallback callback (CkIndex_EnzoSimulation::r_method_fof_halos_catalog(NULL),
+                       proxy_enzo_simulation[0]);
+
+  block->contribute
+    (reduce.size()*sizeof(double), reduce.data(),
+     r_method_fof_halos_type, callback);
+
+  block->compute_done();
+}
+
+//======================================================================
+
+CkReduction::reducerType r_method_fof_halos_type;
+
+void register_method_fof_halos(void)
+{ r_method_fof_halos_type = CkReduction::addReducer(r_method_fof_halos); }
+
+CkReductionMsg * r_method_fof_halos(int n, CkReductionMsg ** msgs)
+// Header values are copied from the first contribution, and records
+// with the same label are merged
+{
+  if (n <= 0) return NULL;
+
+  Hierarchy * hierarchy = cello::hierarchy();
+
+  std::map<int64_t,std::array<double,FOF_HALOS_RECORD>> groups;
+
+  for (int i=0; i<n; i++) {
+    const double * values = (const double *) msgs[i]->getData();
+    const int length = msgs[i]->getSize() / sizeof(double);
+    for (int j=FOF_HALOS_HEADER; j+FOF_HALOS_RECORD<=length;
+         j+=FOF_HALOS_RECORD) {
+      const double * b = values + j;
+      const int64_t label = b[0];
+      auto it_group = groups.find(label);
+      if (it_group == groups.end()) {
+        std::array<double,FOF_HALOS_RECORD> record;
+        std::copy_n(b,FOF_HALOS_RECORD,record.begin());
+        groups.emplace(label,record);
+        continue;
+      }
+
+      // combine means, using the image of b's position nearest a's
+
+      std::array<double,FOF_HALOS_RECORD> & a = it_group->second;
+      const double m = a[2] + b[2];
+      const double wa = (m > 0.0) ? a[2]/m : 0.5;
+      const double wb = 1.0 - wa;
+      const double xa[3] = {a[3],a[4],a[5]};
+      const double xb[3] = {b[3],b[4],b[5]};
+      double npi[3];
+      hierarchy->get_nearest_periodic_image(xb,xa,npi);
+      double x[3];
+      for (int axis=0; axis<3; axis++) x[axis] = wa*xa[axis] + wb*npi[axis];
+      double folded[3];
+      hierarchy->get_folded_position(x,folded);
+      a[1] += b[1];
+      a[2] = m;
+      for (int axis=0; axis<3; axis++) {
+        a[3+axis] = folded[axis];
+        a[6+axis] = wa*a[6+axis] + wb*b[6+axis];
+      }
+    }
+  }
+
+  std::vector<double> accum ((const double *) msgs[0]->getData(),
+                             (const double *) msgs[0]->getData() +
+                             FOF_HALOS_HEADER);
+  for (const auto & it_group : groups) {
+    accum.insert(accum.end(),it_group.second.begin(),it_group.second.end());
+  }
+
+  return CkReductionMsg::buildNew(accum.size()*sizeof(double),accum.data());
+}
+
+//======================================================================
+
+void EnzoSimulation::r_method_fof_halos_catalog(CkReductionMsg * msg)
+{
+  const double * data = (const double *) msg->getData();
+  const int index_method = data[0];
+
+  EnzoMethodFofHalos * method =
+    static_cast<EnzoMethodFofHalos *> (problem()->method(index_method));
+
+  method->write(msg);
+
+  delete msg;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodFofHalos::write (CkReductionMsg * msg) throw()
+{
+  const double * data = (const double *) msg->getData();
+  const int length = msg->getSize() / sizeof(double);
+  const int cycle = data[1];
+  const double time = data[2];
+
+  char file_name[256];
+  snprintf (file_name,sizeof(file_name),file_name_.c_str(),cycle);
+
+  FILE * fp = fopen (file_name,"w");
+
+  ASSERT1 ("EnzoMethodFofHalos::write()",
+           "Cannot open file %s for writing",
+           file_name, (fp != nullptr));
+
+  fprintf (fp,"# cycle %d time %20.16g linking_length %g\n",
+           cycle,time,linking_length_);
+  fprintf (fp,"# id count mass x y z vx vy vz\n");
+
+  int num_halos = 0;
+  for (int j=FOF_HALOS_HEADER; j+FOF_HALOS_RECORD<=length;
+       j+=FOF_HALOS_RECORD) {
+    const double * r = data + j;
+    if (r[1] < min_members_) continue;
+    fprintf (fp,"%lld %lld %20.16g %20.16g %20.16g %20.16g %g %g %g\n",
+             (long long) r[0], (long long) r[1], r[2],
+             r[3], r[4], r[5], r[6], r[7], r[8]);
+    ++num_halos;
+  }
+
+  fclose (fp);
+
+  cello::monitor()->print
+    ("Method", "fof_halos: %d halos with at least %d particles in %s",
+     num_halos, min_members_, file_name);
+}
@@ -0,0 +1,92 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoMethodFofHalos.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of EnzoMethodFofHalos, an in-situ
+///           friends-of-friends halo finder
+
+#ifndef ENZO_PARTICLE_ENZO_METHOD_FOF_HALOS_HPP
+#define ENZO_PARTICLE_ENZO_METHOD_FOF_HALOS_HPP
+
+class EnzoMethodFofHalos : public Method {
+
+  /// @class    EnzoMethodFofHalos
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Find friends-of-friends halos of particles
+  ///
+  /// Each particle carries a group label, initially its id.  Each
+  /// iteration copies the particles within one linking length of
+  /// each leaf Block's neighbors into the Block, finds the FoF groups
+  /// of the local and copied particles with EnzoFofGroups, and lowers
+  /// the labels of local particles to the smallest label in their
+  /// group.  Iterations stop when no label changes anywhere, at which
+  /// point every particle is labelled with the smallest id in its
+  /// global group.  Per-Block partial sums of each group are then
+  /// merged by a reduction keyed by label, and the root process
+  /// writes a catalog of groups with at least min_members particles.
+
+public: // interface
+
+  /// Create a new EnzoMethodFofHalos object
+  EnzoMethodFofHalos(ParameterGroup p);
+
+  /// Charm++ PUP::able declarations
+  PUPable_decl(EnzoMethodFofHalos);
+
+  /// Charm++ PUP::able migration constructor
+  EnzoMethodFofHalos (CkMigrateMessage *m)
+    : Method (m),
+      type_(),
+      linking_length_(0.0),
+      min_members_(0),
+      file_name_(),
+      ir_link_(-1)
+  { }
+
+  /// CHARM++ Pack / Unpack function
+  void pup (PUP::er &p);
+
+  /// Apply the method to find halos
+  virtual void compute( Block * block) throw();
+
+  virtual std::string name () throw ()
+  { return "fof_halos"; }
+
+  /// Join local particles to the groups of copied neighbor particles
+  void link (Block * block) throw();
+
+  /// Continue after all Blocks have linked: either link again or
+  /// contribute to the halo catalog
+  void linked (Block * block, int num_changed) throw();
+
+  /// Write the catalog of merged groups [called on the root process]
+  void write (CkReductionMsg * msg) throw();
+
+protected: // methods
+
+  /// Start a linking iteration
+  void link_start_ (Block * block) throw();
+
+  /// Contribute partial sums of the groups of local particles
+  void catalog_ (Block * block) throw();
+
+protected: // attributes
+
+  /// Name of the particle type
+  std::string type_;
+
+  /// Linking length in code units
+  double linking_length_;
+
+  /// Minimum number of particles in a catalogued halo
+  int min_members_;
+
+  /// Format of the catalog file name, given the cycle
+  std::string file_name_;
+
+  /// Refresh that copies neighbor particles for linking
+  int ir_link_;
+};
+
+#endif /* ENZO_PARTICLE_ENZO_METHOD_FOF_HALOS_HPP */
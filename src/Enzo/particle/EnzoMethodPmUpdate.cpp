@@ -8,6 +8,7 @@
 
 #include "Enzo/enzo.hpp"
 #include "Enzo/particle/particle.hpp"
+#include "Enzo/gravity/gravity.hpp" // EnzoMethodGravity
 
 // #define DEBUG_UPDATE
 
@@ -25,10 +26,20 @@ EnzoMethodPmUpdate::EnzoMethodPmUpdate
 ( ParameterGroup p )
   : Method(),
     // load value from Method:pm_update:max_dt
-    max_dt_(p.value_float("max_dt", std::numeric_limits<double>::max()))
+    max_dt_(p.value_float("max_dt", std::numeric_limits<double>::max())),
+    // load value from Method:pm_update:assignment
+    assignment_(enzo_pm::assignment_from_string
+                (p.value_string("assignment","cic"))),
+    short_range_(p.value_logical("short_range",false)),
+    short_range_cut_(p.value_float("short_range_cut",3.0)),
+    short_range_softening_(p.value_float("short_range_softening",0.0)),
+    acceleration_cached_(false)
 {
   TRACE_PM("EnzoMethodPmUpdate()");
 
+  // load value from Method:pm_update:num_tasks
+  this->set_num_tasks(p.value_integer("num_tasks", 1));
+
   const int rank = cello::rank();
  
   if (rank >= 1) cello::define_field("acceleration_x");
@@ -40,9 +51,6 @@ EnzoMethodPmUpdate::EnzoMethodPmUpdate
   cello::simulation()->refresh_set_name(ir_post_,name());
   
   Refresh * refresh = cello::refresh(ir_post_);
-  refresh->add_field("acceleration_x");
-  refresh->add_field("acceleration_y");
-  refresh->add_field("acceleration_z");
 
   ParticleDescr * particle_descr = cello::particle_descr();
   Grouping * particle_groups = particle_descr->groups();
@@ -53,11 +61,49 @@ EnzoMethodPmUpdate::EnzoMethodPmUpdate
     refresh->add_particle
       (particle_descr->type_index(particle_groups->item("is_gravitating",ipt)));
 
+  if (short_range_) {
+
+    ASSERT ("EnzoMethodPmUpdate::EnzoMethodPmUpdate()",
+            "Method:pm_update:short_range requires rank 3",
+            rank == 3);
+    ASSERT1 ("EnzoMethodPmUpdate::EnzoMethodPmUpdate()",
+             "Method:pm_update:short_range_cut = %g must be positive",
+             short_range_cut_, (short_range_cut_ > 0.0));
+
+    // Copy particles to neighbors, which delete copies after
+    // gathering the short-range sources
+
+    refresh->set_particles_are_copied(true);
+
+    for (int ipt = 0; ipt < num_is_grav; ipt++) {
+      const std::string type = particle_groups->item("is_gravitating",ipt);
+      particle_descr->check_particle_attribute(type,"is_copy");
+    }
+  }
+
   // PM parameters initialized in EnzoBlock::initialize()
 }
 
 //----------------------------------------------------------------------
 
+void EnzoMethodPmUpdate::initialize_fields (bool overlap) throw()
+{
+  // TSC interpolation reads two layers of ghost zones, others one
+
+  acceleration_cached_ = (EnzoMethodGravity::acceleration_cache
+                          (name(),(assignment_ == pm_assignment::tsc) ? 2 : 1)
+                          != nullptr);
+
+  if (! acceleration_cached_) {
+    Refresh * refresh = cello::refresh(ir_post_);
+    refresh->add_field("acceleration_x");
+    refresh->add_field("acceleration_y");
+    refresh->add_field("acceleration_z");
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodPmUpdate::pup (PUP::er &p)
 {
   // NOTE: change this function whenever attributes change
@@ -67,6 +113,67 @@ void EnzoMethodPmUpdate::pup (PUP::er &p)
   Method::pup(p);
 
   p | max_dt_;
+  int assignment = int(assignment_);
+  p | assignment;
+  assignment_ = pm_assignment(assignment);
+  p | short_range_;
+  p | short_range_cut_;
+  p | short_range_softening_;
+  p | acceleration_cached_;
+}
+
+//----------------------------------------------------------------------
+
+namespace {
+
+  /// Kick-drift-kick update of one coordinate for unit-stride arrays
+  void update_contiguous_
+  (enzo_float * __restrict__ x,
+   enzo_float * __restrict__ v,
+   const enzo_float * __restrict__ a,
+   int np, double cp, double cvv, double cva)
+  {
+#pragma omp simd
+    for (int ip=0; ip<np; ip++) {
+      const enzo_float vh = cvv*v[ip] + cva*a[ip];
+      x[ip] += cp*vh;
+      v[ip]  = cvv*vh + cva*a[ip];
+    }
+  }
+
+  /// Kick-drift-kick update of one coordinate for integer positions
+  /// relative to the Block, where scale converts a global distance to
+  /// integer units
+  template <class T>
+  void update_int_
+  (T * x, enzo_float * v, const enzo_float * a,
+   int np, int dp, int dv, int da,
+   double cp, double cvv, double cva, double scale)
+  {
+    for (int ip=0; ip<np; ip++) {
+      const enzo_float vh = cvv*v[ip*dv] + cva*a[ip*da];
+      x[ip*dp] += T(llround(scale*cp*vh));
+      v[ip*dv]  = cvv*vh + cva*a[ip*da];
+    }
+  }
+
+  /// Dispatch update_int_() on the position attribute type
+  void update_int_position_
+  (int type, void * x, enzo_float * v, const enzo_float * a,
+   int np, int dp, int dv, int da,
+   double cp, double cvv, double cva, double width)
+  {
+    if (type == type_int8) {
+      update_int_((int8_t *)x,v,a,np,dp,dv,da,cp,cvv,cva,2.0*PMAX_8/width);
+    } else if (type == type_int16) {
+      update_int_((int16_t *)x,v,a,np,dp,dv,da,cp,cvv,cva,2.0*PMAX_16/width);
+    } else if (type == type_int32) {
+      update_int_((int32_t *)x,v,a,np,dp,dv,da,cp,cvv,cva,2.0*PMAX_32/width);
+    } else if (type == type_int64) {
+      update_int_((int64_t *)x,v,a,np,dp,dv,da,cp,cvv,cva,2.0*PMAX_64/width);
+    }
+  }
+
 }
 
 //----------------------------------------------------------------------
@@ -112,29 +219,50 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
     const double cva = 0.5*dt / (1.0 + coef);
 
 
+    if (acceleration_cached_) {
+      static_cast<EnzoMethodGravity*>(enzo::problem()->method("gravity"))
+        ->update_accelerations(block);
+    }
+
     Particle particle = block->data()->particle();
 
+    std::vector<double> xs, ms;
+    if (short_range_) gather_sources_ (block,xs,ms);
+
     for (int ipt = 0; ipt < num_is_grav; ipt++){
 
       std::string particle_type = particle_groups->item("is_gravitating",ipt);
       int it = particle.type_index (particle_type);
 
+      // Without short-range forces, interpolation of all acceleration
+      // components and the kick-drift-kick update are fused into a
+      // single pass over the particles below
+
+      const bool is_fused = ! short_range_ && ! particle.position_is_int(it);
+
       //    double dt_shift = 0.0;
-      if (rank >= 1) {
-        EnzoComputeCicInterp interp_x ("acceleration_x", particle_type, "ax", dt_shift);
+      if (is_fused) {
+        // interpolated in the update loop below
+      } else if (rank >= 1) {
+        EnzoComputeCicInterp interp_x ("acceleration_x", particle_type, "ax", dt_shift,
+                                       assignment_);
         interp_x.compute(block);
       }
 
-      if (rank >= 2) {
-        EnzoComputeCicInterp interp_y ("acceleration_y", particle_type, "ay", dt_shift);
+      if (! is_fused && rank >= 2) {
+        EnzoComputeCicInterp interp_y ("acceleration_y", particle_type, "ay", dt_shift,
+                                       assignment_);
         interp_y.compute(block);
       }
 
-      if (rank >= 3) {
-        EnzoComputeCicInterp interp_z ("acceleration_z", particle_type, "az", dt_shift);
+      if (! is_fused && rank >= 3) {
+        EnzoComputeCicInterp interp_z ("acceleration_z", particle_type, "az", dt_shift,
+                                       assignment_);
         interp_z.compute(block);
       }
 
+      if (short_range_) add_short_range_ (block,it,xs,ms,cosmo_a);
+
 
       const int ia_x  = (rank >= 1) ? particle.attribute_index (it, "x") : -1;
       const int ia_y  = (rank >= 2) ? particle.attribute_index (it, "y") : -1;
@@ -154,6 +282,30 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
       const int nb = particle.num_batches (it);
 
+      // integer positions are relative to the Block, and drifted in
+      // integer units
+
+      if (particle.position_is_int(it)) {
+        double lower[3],upper[3];
+        block->lower(lower,lower+1,lower+2);
+        block->upper(upper,upper+1,upper+2);
+        const int ia_x3[3] = {ia_x,ia_y,ia_z};
+        const int ia_v3[3] = {ia_vx,ia_vy,ia_vz};
+        const int ia_a3[3] = {ia_ax,ia_ay,ia_az};
+        for (int ib=0; ib<nb; ib++) {
+          const int np = particle.num_particles(it,ib);
+          for (int axis=0; axis<rank; axis++) {
+            update_int_position_
+              (particle.attribute_type(it,ia_x3[axis]),
+               particle.attribute_array (it, ia_x3[axis], ib),
+               (enzo_float *) particle.attribute_array (it, ia_v3[axis], ib),
+               (enzo_float *) particle.attribute_array (it, ia_a3[axis], ib),
+               np,dp,dv,da,cp,cvv,cva, upper[axis] - lower[axis]);
+          }
+        }
+        continue;
+      }
+
       // check precisions match
 
       const int ba = particle.attribute_bytes(it,ia_x); // "bytes (actual)"
@@ -169,6 +321,11 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 	        ((be == 8) ? "double" : "quadruple")),
 	       (ba == be));
 
+      if (is_fused) {
+        update_fused_ (block,it,dt_shift,cp,cvv,cva);
+        continue;
+      }
+
       for (int ib=0; ib<nb; ib++) {
 
         enzo_float *x=0, *y=0, *z=0;
@@ -193,6 +350,16 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
         const int np = particle.num_particles(it,ib);
 
+#ifndef DEBUG_UPDATE
+        if (dp == 1 && dv == 1 && da == 1) {
+          // non-interleaved attributes are contiguous and aligned
+          if (rank >= 1) update_contiguous_(x,vx,ax,np,cp,cvv,cva);
+          if (rank >= 2) update_contiguous_(y,vy,ay,np,cp,cvv,cva);
+          if (rank >= 3) update_contiguous_(z,vz,az,np,cp,cvv,cva);
+          continue;
+        }
+#endif
+
         if (rank >= 1) {
 
 	        for (int ip=0; ip<np; ip++) {
@@ -276,6 +443,237 @@ void EnzoMethodPmUpdate::compute ( Block * block) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodPmUpdate::update_fused_
+(Block * block, int it, double dt_shift,
+ double cp, double cvv, double cva) const
+{
+  Particle particle = block->data()->particle();
+  Field field = block->data()->field();
+
+  const int rank = cello::rank();
+
+  int ia_x3[3] = {-1,-1,-1};
+  int ia_v3[3] = {-1,-1,-1};
+  int ia_a3[3] = {-1,-1,-1};
+  const enzo_float * vf[3] = {nullptr,nullptr,nullptr};
+  const char * acceleration[3] = {"ax","ay","az"};
+  const char * field_name[3] =
+    {"acceleration_x","acceleration_y","acceleration_z"};
+  for (int axis=0; axis<rank; axis++) {
+    ia_x3[axis] = particle.attribute_position(it,axis);
+    ia_v3[axis] = particle.attribute_velocity(it,axis);
+    ia_a3[axis] = particle.attribute_index(it,acceleration[axis]);
+    vf[axis] = (const enzo_float *) field.values(field_name[axis]);
+  }
+
+  const int dp = particle.stride(it,ia_x3[0]);
+  const int dv = particle.stride(it,ia_v3[0]);
+  const int da = particle.stride(it,ia_a3[0]);
+
+  // same geometry as EnzoComputeCicInterp, with positions drifted by
+  // dt_shift for interpolation
+
+  int nx,ny,nz;
+  field.size(&nx,&ny,&nz);
+  double xm,ym,zm;
+  double xp,yp,zp;
+  block->lower(&xm,&ym,&zm);
+  block->upper(&xp,&yp,&zp);
+
+  enzo_pm::PmGeometry<enzo_float> geometry;
+  field.dimensions(0,&geometry.mx,&geometry.my,&geometry.mz);
+  field.ghost_depth(0,&geometry.gx,&geometry.gy,&geometry.gz);
+  geometry.lower[0] = xm;
+  geometry.lower[1] = ym;
+  geometry.lower[2] = zm;
+  geometry.scale[0] = nx / (xp - xm);
+  geometry.scale[1] = ny / (yp - ym);
+  geometry.scale[2] = nz / (zp - zm);
+  geometry.dp = dp;
+  geometry.dv = dv;
+  geometry.dt = dt_shift;
+
+  const bool lshift = (dt_shift != 0.0);
+
+  // Batches [ib0,ib1) are independent, so may be updated concurrently
+
+  auto update_batches = [&] (int task, int ib0, int ib1) {
+
+    enzo_pm::PmGeometry<enzo_float> geometry_task = geometry;
+
+    for (int ib=ib0; ib<ib1; ib++) {
+
+      const int np = particle.num_particles(it,ib);
+
+      enzo_float * x[3] = {nullptr,nullptr,nullptr};
+      enzo_float * v[3] = {nullptr,nullptr,nullptr};
+      enzo_float * a[3] = {nullptr,nullptr,nullptr};
+      for (int axis=0; axis<3; axis++) {
+        if (axis < rank) {
+          x[axis] = (enzo_float *) particle.attribute_array(it,ia_x3[axis],ib);
+          v[axis] = (enzo_float *) particle.attribute_array(it,ia_v3[axis],ib);
+          a[axis] = (enzo_float *) particle.attribute_array(it,ia_a3[axis],ib);
+        }
+        geometry_task.x[axis] = x[axis];
+        geometry_task.v[axis] = lshift ? v[axis] : nullptr;
+      }
+
+      // kick-drift-kick each chunk right after its accelerations are
+      // interpolated, and before the next chunk's stencils are computed
+
+      auto update = [&] (int ip0, int nc) {
+        for (int axis=0; axis<rank; axis++) {
+          enzo_float * xa = x[axis];
+          enzo_float * va = v[axis];
+          const enzo_float * aa = a[axis];
+          for (int ip=ip0; ip<ip0+nc; ip++) {
+            const enzo_float vh = cvv*va[ip*dv] + cva*aa[ip*da];
+            xa[ip*dp] += cp*vh;
+            va[ip*dv]  = cvv*vh + cva*aa[ip*da];
+          }
+        }
+      };
+
+      enzo_pm::interpolate_vector
+        (assignment_, rank, vf, geometry_task, np, a, da, update);
+    }
+  };
+
+  cello::parallel_for (0, particle.num_batches(it), num_tasks(),
+                       update_batches);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodPmUpdate::gather_sources_
+(Block * block, std::vector<double> & xs, std::vector<double> & ms) const
+{
+  ParticleDescr * particle_descr = cello::particle_descr();
+  Grouping * particle_groups     = particle_descr->groups();
+  Particle particle = block->data()->particle();
+
+  const int num_is_grav = particle_groups->size("is_gravitating");
+
+  xs.clear();
+  ms.clear();
+
+  double lower[3],upper[3];
+  block->lower(lower,lower+1,lower+2);
+  block->upper(upper,upper+1,upper+2);
+
+  for (int ipt = 0; ipt < num_is_grav; ipt++) {
+
+    const int it = particle.type_index
+      (particle_groups->item("is_gravitating",ipt));
+
+    const bool is_mass_attribute = particle.has_attribute(it,"mass");
+    const int imass = is_mass_attribute ?
+      particle.attribute_index(it,"mass") : particle.constant_index(it,"mass");
+    const int dm = is_mass_attribute ? particle.stride(it,imass) : 0;
+
+    const int nb = particle.num_batches(it);
+    for (int ib=0; ib<nb; ib++) {
+
+      const int np = particle.num_particles(it,ib);
+      if (np == 0) continue;
+
+      std::vector<double> x(np), y(np), z(np);
+      particle.position(it,ib,x.data(),y.data(),z.data(),lower,upper);
+
+      // If mass is a constant, then dm is 0 and pmass[ip*dm] is pmass[0]
+      const enzo_float * pmass = is_mass_attribute ?
+        (const enzo_float *) particle.attribute_array(it,imass,ib) :
+        (const enzo_float *) particle.constant_value(it,imass);
+
+      for (int ip=0; ip<np; ip++) {
+        xs.push_back(x[ip]);
+        xs.push_back(y[ip]);
+        xs.push_back(z[ip]);
+        ms.push_back(pmass[ip*dm]);
+      }
+    }
+
+    // copies are only needed as sources
+
+    block->delete_non_local_particles_(it);
+  }
+}
+
+//----------------------------------------------------------------------
+
+void EnzoMethodPmUpdate::add_short_range_
+(Block * block, int it,
+ const std::vector<double> & xs, const std::vector<double> & ms,
+ double cosmo_a) const
+{
+  Particle particle = block->data()->particle();
+
+  double hx,hy,hz;
+  block->cell_width(&hx,&hy,&hz);
+  const double h = cbrt(hx*hy*hz);
+
+  // sources are only copied from adjacent Blocks
+
+  int nx,ny,nz;
+  block->data()->field().size(&nx,&ny,&nz);
+  ASSERT2 ("EnzoMethodPmUpdate::add_short_range_()",
+           "Method:pm_update:short_range_cut = %g exceeds the "
+           "Block width of %d cells",
+           short_range_cut_, std::min(nx,std::min(ny,nz)),
+           (short_range_cut_*h <= std::min(nx*hx,std::min(ny*hy,nz*hz))));
+
+  EnzoShortRangeForce short_range
+    (short_range_cut_*h, short_range_softening_*h);
+
+  // In cosmological simulations units are such that 4 pi G = 1, and
+  // comoving accelerations are scaled by 1/a as for the potential
+
+  const double grav_const = enzo::cosmology() ?
+    1.0/(4.0*cello::pi) : enzo::grav_constant_codeU();
+  const double scale = grav_const / cosmo_a;
+
+  const int ia_ax = particle.attribute_index (it, "ax");
+  const int ia_ay = particle.attribute_index (it, "ay");
+  const int ia_az = particle.attribute_index (it, "az");
+  const int da = particle.stride(it, ia_ax);
+
+  double lower[3],upper[3];
+  block->lower(lower,lower+1,lower+2);
+  block->upper(upper,upper+1,upper+2);
+
+  const int nb = particle.num_batches(it);
+  for (int ib=0; ib<nb; ib++) {
+
+    const int np = particle.num_particles(it,ib);
+    if (np == 0) continue;
+
+    std::vector<double> x(np), y(np), z(np);
+    particle.position(it,ib,x.data(),y.data(),z.data(),lower,upper);
+
+    std::vector<double> xt(3*np), at(3*np,0.0);
+    for (int ip=0; ip<np; ip++) {
+      xt[3*ip+0] = x[ip];
+      xt[3*ip+1] = y[ip];
+      xt[3*ip+2] = z[ip];
+    }
+
+    short_range.add_accelerations
+      (np, xt.data(), ms.size(), xs.data(), ms.data(), at.data());
+
+    enzo_float * ax = (enzo_float *) particle.attribute_array (it, ia_ax, ib);
+    enzo_float * ay = (enzo_float *) particle.attribute_array (it, ia_ay, ib);
+    enzo_float * az = (enzo_float *) particle.attribute_array (it, ia_az, ib);
+
+    for (int ip=0; ip<np; ip++) {
+      ax[ip*da] += scale*at[3*ip+0];
+      ay[ip*da] += scale*at[3*ip+1];
+      az[ip*da] += scale*at[3*ip+2];
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 double EnzoMethodPmUpdate::timestep ( Block * block ) throw()
 {
   TRACE_PM("timestep()");
@@ -13,6 +13,11 @@ class EnzoMethodPmUpdate : public Method {
   /// @class    EnzoMethodPmUpdate
   /// @ingroup  Enzo
   /// @brief    [\ref Enzo] PM method particle update
+  ///
+  /// If short_range is enabled, the mesh acceleration interpolated to
+  /// each particle is corrected by the particle-particle force
+  /// computed by EnzoShortRangeForce (P3M), using gravitating
+  /// particles in the Block and copies of those in neighboring Blocks
 
 public: // interface
 
@@ -25,7 +30,12 @@ public: // interface
   /// Charm++ PUP::able migration constructor
   EnzoMethodPmUpdate (CkMigrateMessage *m)
     : Method (m),
-      max_dt_(0.0)
+      max_dt_(0.0),
+      assignment_(pm_assignment::cic),
+      short_range_(false),
+      short_range_cut_(0.0),
+      short_range_softening_(0.0),
+      acceleration_cached_(false)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -37,13 +47,52 @@ public: // interface
   virtual std::string name () throw () 
   { return "pm_update"; }
 
+  /// Refresh accelerations unless a preceding gravity Method caches them
+  virtual void initialize_fields (bool overlap) throw();
+
   /// Compute maximum timestep for this method
   virtual double timestep ( Block * block) throw();
 
+protected: // methods
+
+  /// Interpolate accelerations to particles of type it and apply the
+  /// kick-drift-kick update in a single pass over the particles
+  void update_fused_ (Block * block, int it, double dt_shift,
+                      double cp, double cvv, double cva) const;
+
+  /// Gather positions and masses of all gravitating particles,
+  /// including copies from neighboring Blocks, then delete the copies
+  void gather_sources_ (Block * block,
+                        std::vector<double> & xs,
+                        std::vector<double> & ms) const;
+
+  /// Add the short-range correction from the sources to the
+  /// accelerations of particles of type it
+  void add_short_range_ (Block * block, int it,
+                         const std::vector<double> & xs,
+                         const std::vector<double> & ms,
+                         double cosmo_a) const;
+
 protected: // attributes
 
   double max_dt_;
 
+  /// Scheme for interpolating accelerations to particles
+  pm_assignment assignment_;
+
+  /// Whether to add the short-range particle-particle force
+  bool short_range_;
+
+  /// Cutoff radius of the short-range force in cells
+  double short_range_cut_;
+
+  /// Plummer softening length of the short-range force in cells
+  double short_range_softening_;
+
+  /// Whether accelerations are read from the preceding gravity
+  /// Method's cache instead of being refreshed
+  bool acceleration_cached_;
+
 };
 
 #endif /* ENZO_ENZO_METHOD_PM_UPDATE_HPP */
@@ -0,0 +1,142 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoShortRangeForce.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implementation of the EnzoShortRangeForce class
+
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+#include "Enzo/particle/particle.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoShortRangeForce::EnzoShortRangeForce (double a, double softening)
+  : a_(a),
+    eps2_(softening*softening)
+{
+  ASSERT1 ("EnzoShortRangeForce::EnzoShortRangeForce()",
+           "Cutoff radius %g must be positive",
+           a, (a > 0.0));
+}
+
+//----------------------------------------------------------------------
+
+double EnzoShortRangeForce::s2_force (double r, double a)
+{
+  const double s = 2.0*r/a;
+  if (s >= 2.0) return 1.0/(r*r);
+  const double s2 = s*s;
+  const double s3 = s2*s;
+  const double s4 = s2*s2;
+  const double s5 = s4*s;
+  const double s6 = s3*s3;
+  const double f = (s <= 1.0) ?
+    (224.0*s - 224.0*s3 + 70.0*s4 + 48.0*s5 - 21.0*s6) :
+    (12.0/s2 - 224.0 + 896.0*s - 840.0*s2 + 224.0*s3
+     + 70.0*s4 - 48.0*s5 + 7.0*s6);
+  return f / (35.0*a*a);
+}
+
+//----------------------------------------------------------------------
+
+double EnzoShortRangeForce::correction (double r) const
+{
+  if (r >= a_) return 0.0;
+  const double d2 = r*r + eps2_;
+  return r / (d2*sqrt(d2)) - s2_force(r,a_);
+}
+
+//----------------------------------------------------------------------
+
+void EnzoShortRangeForce::add_accelerations
+(int nt, const double * xt,
+ int ns, const double * xs, const double * ms,
+ double * at) const
+{
+  if (nt == 0 || ns == 0) return;
+
+  // Bounding box of the sources, with cells of width a_
+
+  double xm[3], xp[3];
+  for (int axis=0; axis<3; axis++) {
+    xm[axis] = xp[axis] = xs[axis];
+  }
+  for (int j=1; j<ns; j++) {
+    for (int axis=0; axis<3; axis++) {
+      xm[axis] = std::min(xm[axis],xs[3*j+axis]);
+      xp[axis] = std::max(xp[axis],xs[3*j+axis]);
+    }
+  }
+
+  const double h = a_;
+  int n3[3];
+  for (int axis=0; axis<3; axis++) {
+    n3[axis] = int((xp[axis]-xm[axis])/h) + 1;
+  }
+  const int nc = n3[0]*n3[1]*n3[2];
+
+  // Cell-linked list of sources, as in EnzoFofGroups
+
+  std::vector<int> cell(ns);
+  for (int j=0; j<ns; j++) {
+    int i3[3];
+    for (int axis=0; axis<3; axis++) {
+      i3[axis] = std::min(int((xs[3*j+axis]-xm[axis])/h),n3[axis]-1);
+    }
+    cell[j] = i3[0] + n3[0]*(i3[1] + n3[1]*i3[2]);
+  }
+
+  std::vector<int> cell_start(nc+1,0);
+  for (int j=0; j<ns; j++) ++cell_start[cell[j]+1];
+  for (int c=0; c<nc; c++) cell_start[c+1] += cell_start[c];
+
+  std::vector<int> cell_points(ns);
+  std::vector<int> cell_count(cell_start.begin(),cell_start.end()-1);
+  for (int j=0; j<ns; j++) cell_points[cell_count[cell[j]]++] = j;
+
+  const double a2 = a_*a_;
+
+  for (int i=0; i<nt; i++) {
+
+    const double * x1 = xt + 3*i;
+
+    // cell containing the target, which may lie outside the sources'
+    // bounding box
+
+    int i3[3];
+    for (int axis=0; axis<3; axis++) {
+      i3[axis] = int(std::floor((x1[axis]-xm[axis])/h));
+    }
+
+    double a3[3] = {0.0, 0.0, 0.0};
+    for (int kz=-1; kz<=1; kz++) {
+      const int jz = i3[2]+kz;
+      if (jz < 0 || jz >= n3[2]) continue;
+      for (int ky=-1; ky<=1; ky++) {
+        const int jy = i3[1]+ky;
+        if (jy < 0 || jy >= n3[1]) continue;
+        for (int kx=-1; kx<=1; kx++) {
+          const int jx = i3[0]+kx;
+          if (jx < 0 || jx >= n3[0]) continue;
+          const int c = jx + n3[0]*(jy + n3[1]*jz);
+          for (int k=cell_start[c]; k<cell_start[c+1]; k++) {
+            const int j = cell_points[k];
+            const double * x2 = xs + 3*j;
+            const double dx = x2[0]-x1[0];
+            const double dy = x2[1]-x1[1];
+            const double dz = x2[2]-x1[2];
+            const double r2 = dx*dx + dy*dy + dz*dz;
+            if (r2 == 0.0 || r2 >= a2) continue;
+            const double r = sqrt(r2);
+            const double f = ms[j]*correction(r)/r;
+            a3[0] += f*dx;
+            a3[1] += f*dy;
+            a3[2] += f*dz;
+          }
+        }
+      }
+    }
+    for (int axis=0; axis<3; axis++) at[3*i+axis] += a3[axis];
+  }
+}
@@ -0,0 +1,58 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoShortRangeForce.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of the EnzoShortRangeForce class
+
+#ifndef ENZO_PARTICLE_ENZO_SHORT_RANGE_FORCE_HPP
+#define ENZO_PARTICLE_ENZO_SHORT_RANGE_FORCE_HPP
+
+class EnzoShortRangeForce {
+
+  /// @class    EnzoShortRangeForce
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Particle-particle correction to the PM force
+  ///
+  /// Short-range part of a P3M force split: the (softened) Newtonian
+  /// force minus the force between two S2 spheres of diameter a
+  /// (Hockney & Eastwood 1988, eq. 8-22), which models the mesh
+  /// force.  The correction vanishes for separations r >= a, so
+  /// sources are binned into a cell-linked list with cells of width a
+  /// and each target only searches its own and the 26 adjacent cells.
+  ///
+  /// Accelerations are per unit gravitational constant.
+
+public: // interface
+
+  /// Create a correction with cutoff radius a and Plummer softening
+  /// length softening
+  EnzoShortRangeForce (double a, double softening = 0.0);
+
+  /// Return the magnitude of the correction between two unit masses
+  /// at separation r
+  double correction (double r) const;
+
+  /// Add the correction from the ns sources with coordinates
+  /// xs[3*j+axis] and masses ms[j] to the accelerations at[3*i+axis]
+  /// of the nt targets with coordinates xt[3*i+axis].  Pairs at zero
+  /// separation (e.g. a target and itself) are skipped.
+  void add_accelerations (int nt, const double * xt,
+                          int ns, const double * xs, const double * ms,
+                          double * at) const;
+
+  /// Return the force between two unit mass S2 spheres of diameter a
+  /// at separation r
+  static double s2_force (double r, double a);
+
+private: // attributes
+
+  /// Cutoff radius, the S2 sphere diameter
+  double a_;
+
+  /// Plummer softening length squared
+  double eps2_;
+
+};
+
+#endif /* ENZO_PARTICLE_ENZO_SHORT_RANGE_FORCE_HPP */
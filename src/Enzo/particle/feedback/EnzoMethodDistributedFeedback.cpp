@@ -340,6 +340,23 @@ EnzoMethodDistributedFeedback::EnzoMethodDistributedFeedback
   stencil_rad_               = ( (int) ((stencil_ - 1) / 2.0));
   number_of_feedback_cells_  = stencil_ * stencil_ * stencil_;
 
+  // The momentum scale factor depends only on the position in the
+  // stencil, so is tabulated once rather than per deposit
+  mom_scale_.resize(number_of_feedback_cells_);
+  for (int k = -stencil_rad_; k <= stencil_rad_; k++){
+    for (int j = -stencil_rad_; j <= stencil_rad_; j++){
+      for (int i = -stencil_rad_; i <= stencil_rad_; i++){
+        int mom_norm = 3 - (i == 0) - (j == 0) - (k == 0);
+        // center cell gets no momentum; avoid dividing by zero
+        mom_norm = (mom_norm == 0) ? 1 : mom_norm;
+        mom_scale_[(i + stencil_rad_) +
+                   stencil_*((j + stencil_rad_) +
+                             stencil_*(k + stencil_rad_))]
+          = 1.0 / ( sqrt((double) mom_norm));
+      }
+    }
+  }
+
   // Flag to turn on / off particle kicking from boundaries
   shift_cell_center_         = p.value_logical("shift_cell_center", true);
 
@@ -378,6 +395,7 @@ void EnzoMethodDistributedFeedback::pup (PUP::er &p)
   p | stencil_;
   p | stencil_rad_;
   p | number_of_feedback_cells_;
+  p | mom_scale_;
   p | shift_cell_center_;
 
   return;
@@ -1071,27 +1089,21 @@ void EnzoMethodDistributedFeedback::inject_feedback(
     pvx = v3[0][index]; pvy = v3[1][index]; pvz = v3[2][index];
   }
 
-  enzo_float *u_local=0, *v_local=0, *w_local=0, *d_local=0, *ge_local=0, *te_local=0;
-  enzo_float *ke_before=0, *metal_local=0;
-
   // number of feedback cells + 1 cell in each dimension
   int num_loc = (stencil_ + 1) * (stencil_ + 1) * (stencil_ + 1);
 
-  u_local     = new enzo_float[num_loc];
-  v_local     = new enzo_float[num_loc];
-  w_local     = new enzo_float[num_loc];
-  d_local     = new enzo_float[num_loc];
-  ge_local    = new enzo_float[num_loc];
-  te_local    = new enzo_float[num_loc];
-  metal_local = new enzo_float[num_loc];
-  ke_before   = new enzo_float[num_loc];
-
-  // assign initial values to these
-  for (int i = 0; i < num_loc; i++){
-    u_local[i] = 0.0; v_local[i] = 0.0; w_local[i] = 0.0;
-    d_local[i] = 0.0; te_local[i] = 0.0; ge_local[i] = 0.0;
-    ke_before[i] = 0.0; metal_local[i] = 0.0;
-  }
+  // reuse the scratch arrays between events instead of allocating
+  // them for each one
+  scratch_.assign(8*num_loc, 0.0);
+
+  enzo_float * u_local     = scratch_.data();
+  enzo_float * v_local     = u_local  + num_loc;
+  enzo_float * w_local     = v_local  + num_loc;
+  enzo_float * d_local     = w_local  + num_loc;
+  enzo_float * ge_local    = d_local  + num_loc;
+  enzo_float * te_local    = ge_local + num_loc;
+  enzo_float * metal_local = te_local + num_loc;
+  enzo_float * ke_before   = metal_local + num_loc;
 
   const double mu_cell = (double)enzo::fluid_props()->mol_weight();
 
@@ -1286,15 +1298,6 @@ void EnzoMethodDistributedFeedback::inject_feedback(
   }
 
 
-  delete [] u_local; u_local = NULL;
-  delete [] v_local; v_local = NULL;
-  delete [] w_local; w_local = NULL;
-  delete [] d_local; d_local = NULL;
-  delete [] ge_local; ge_local = NULL;
-  delete [] te_local; te_local = NULL;
-  delete [] metal_local; metal_local = NULL;
-  delete [] ke_before; ke_before = NULL;
-
   return;
 }
 
@@ -1404,57 +1407,59 @@ void EnzoMethodDistributedFeedback::add_feedback_to_grid(
   CkPrintf("xyz - add_FB_to_grid: %g %g %g %g\n", mass_per_cell,mom_per_cell,therm_per_cell,metal_fraction);
 #endif
 
+  // CIC weights of the two cells each stencil cell overlaps along
+  // each axis: these depend only on the sub-cell offset, so are the
+  // same for every stencil cell
+  const double wx[2] = { dxc, 1.0 - dxc };
+  const double wy[2] = { dyc, 1.0 - dyc };
+  const double wz[2] = { dzc, 1.0 - dzc };
+
+  // range of offsets from (ix,iy,iz) that lie on the grid, so that
+  // cells clipped by the grid boundary are skipped without testing
+  // each one
+  const int i1_min = std::max(-stencil_rad_, -ix);
+  const int i1_max = std::min(stencil_rad_ + 1, mx - 1 - ix);
+  const int j1_min = std::max(-stencil_rad_, -iy);
+  const int j1_max = std::min(stencil_rad_ + 1, my - 1 - iy);
+  const int k1_min = std::max(-stencil_rad_, -iz);
+  const int k1_max = std::min(stencil_rad_ + 1, mz - 1 - iz);
+
+  const double * mom_scale_ijk = mom_scale_.data();
+
   for (int k = -stencil_rad_; k <= stencil_rad_; k++){
+    // use sign of i,j,k to assign direction. No momentum in center cell
+    const double sign_k = (k > 0) ? 1 : (k < 0 ? -1 : 0);
     for (int j = -stencil_rad_; j <= stencil_rad_; j++){
+      const double sign_j = (j > 0) ? 1 : (j < 0 ? -1 : 0);
       for (int i = -stencil_rad_; i <= stencil_rad_; i++){
+        const double sign_i = (i > 0) ? 1 : (i < 0 ? -1 : 0);
 
-        for (int i1 = i; i1 <= i + 1; i1++){
-          double dxc1 = dxc;
-          if (i1 == (i + 1)) dxc1 = 1.0 - dxc;
+        // scale factor to account for the fact that delta_p's may be
+        // zero for cardinal directions along cardinal axes, but we
+        // still want total momentum change (|delta_p|) to be the same
+        // for all cells
+        const double mom_scale = *mom_scale_ijk++;
 
-          if ( ((ix+i1) < 0) || ((ix+i1)>=mx)) continue;
+        for (int i1 = std::max(i, i1_min); i1 <= std::min(i + 1, i1_max); i1++){
+          const double dxc1 = wx[i1 - i];
 
-          for (int j1 = j; j1 <= j + 1; j1++){
-            double dyc1 = dyc;
-            if (j1 == (j + 1)) dyc1 = 1.0 - dyc;
-            if ( ((iy+j1) < 0) || ((iy+j1)>=my)) continue;
+          for (int j1 = std::max(j, j1_min); j1 <= std::min(j + 1, j1_max); j1++){
+            const double dyc1 = wy[j1 - j];
 
-            for (int k1 = k; k1 <= k + 1; k1++){
-              double dzc1 = dzc;
-              if (k1 == (k + 1)) dzc1 = 1.0 - dzc;
-              if ( ((iz+k1) < 0) || ((iz+k1)>=mz)) continue;
+            for (int k1 = std::max(k, k1_min); k1 <= std::min(k + 1, k1_max); k1++){
+              const double dzc1 = wz[k1 - k];
 
-              double delta_mass =    mass_per_cell * dxc1 * dyc1 * dzc1;
-              // use sign of i,j,k to assign direction. No momentum in cener
-              // cell
-              double delta_pu = ( (i > 0) ? 1 : (i < 0 ? -1 : 0)) * mom_per_cell * dxc1 * dyc1 * dzc1;
-              double delta_pv = ( (j > 0) ? 1 : (j < 0 ? -1 : 0)) * mom_per_cell * dxc1 * dyc1 * dzc1;
-              double delta_pw = ( (k > 0) ? 1 : (k < 0 ? -1 : 0)) * mom_per_cell * dxc1 * dyc1 * dzc1;
+              double delta_mass = mass_per_cell * dxc1 * dyc1 * dzc1;
+              double delta_pu   = sign_i * mom_per_cell * dxc1 * dyc1 * dzc1;
+              double delta_pv   = sign_j * mom_per_cell * dxc1 * dyc1 * dzc1;
+              double delta_pw   = sign_k * mom_per_cell * dxc1 * dyc1 * dzc1;
 
               double delta_therm = therm_per_cell * dxc1 * dyc1 * dzc1;
 
               int index = INDEX(i1+ix,j1+iy,k1+iz,mx,my);
 
-              //CkPrintf("xyz - add_FB_loop: %d %e %e", index, delta_therm, delta_mass);
-
-              //if ( (index < 0) || (index >= mx*my*mz)) continue;
-
               double inv_dens = 1.0 / (d[index] + delta_mass);
 
-              // scale factor to account for the fact that delta_p's may be
-              // zero for cardinal directions along cardinal axes, but we
-              // still want total momentum change (|delta_p|) to be the same
-              // for all cells
-              int mom_norm = 3;
-              mom_norm -= (i == 0) ? 1 : 0;
-              mom_norm -= (j == 0) ? 1 : 0;
-              mom_norm -= (k == 0) ? 1 : 0;
-
-              // but set to 1 if in center cell since delta's above are zero
-              // already and we don't want to divide by zero below
-              mom_norm = (mom_norm == 0) ? 1 : mom_norm;
-              double mom_scale = 1.0 / ( sqrt((double) mom_norm));
-
               px[index] +=  delta_pu * mom_scale;
               py[index] +=  delta_pv * mom_scale;
               pz[index] +=  delta_pw * mom_scale;
@@ -1476,7 +1481,6 @@ void EnzoMethodDistributedFeedback::add_feedback_to_grid(
           } // end j1 loop
         } // end i1 loop
 
-
       } // end i loop
     } // end j loop
   } // end k loop
@@ -35,6 +35,10 @@ public:
   /// Apply the method
   virtual void compute (Block * block) throw();
 
+  /// compute() does nothing on non-leaf Blocks
+  virtual bool leaf_only () const throw()
+  { return true; }
+
   void compute_ (Block * block);
 
   /// name
@@ -110,6 +114,15 @@ protected:
   int number_of_feedback_cells_;
   int dual_energy_;
 
+  /// Momentum scale factor 1/sqrt(number of nonzero offsets) of each
+  /// stencil cell, indexed (i + stencil_*(j + stencil_*k)) from the
+  /// lower corner of the stencil
+  std::vector<double> mom_scale_;
+
+  /// Scratch arrays for inject_feedback(), reused between events
+  /// (not pupped)
+  std::vector<enzo_float> scratch_;
+
   bool shift_cell_center_;
 
   bool use_ionization_feedback_;
@@ -35,6 +35,10 @@ public:
   /// Apply the method
   virtual void compute (Block * block) throw();
 
+  /// compute() does nothing on non-leaf Blocks
+  virtual bool leaf_only () const throw()
+  { return true; }
+
   void compute_ (Block * block) throw();
 
   /// name
@@ -187,33 +187,48 @@ int EnzoMethodFeedbackSTARSS::determineWinds(double age_Myr, double * eWinds, do
 void EnzoMethodFeedbackSTARSS::transformComovingWithStar(enzo_float * density, 
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw()
+                                  const int mx, const int my, const int mz, int direction,
+                                  const int * i3m, const int * i3p) const throw()
 {
-  int size = mx*my*mz;
+  // cells in the box from i3m to i3p inclusive (the whole grid by default)
+  const int ixm = i3m ? i3m[0] : 0, ixp = i3p ? i3p[0] : mx - 1;
+  const int iym = i3m ? i3m[1] : 0, iyp = i3p ? i3p[1] : my - 1;
+  const int izm = i3m ? i3m[2] : 0, izp = i3p ? i3p[2] : mz - 1;
+
   if (direction > 0)
   {
     // to comoving with star
     // NOTE: This transforms the velocity field into a momentum density
     //       field for the sake of depositing momentum easily
  
-    for (int ind = 0; ind<size; ind++) {
-      double mult = density[ind];
-      velocity_x[ind] = (velocity_x[ind]-up)*mult;
-      velocity_y[ind] = (velocity_y[ind]-vp)*mult;
-      velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+    for (int iz = izm; iz <= izp; iz++) {
+      for (int iy = iym; iy <= iyp; iy++) {
+        for (int ix = ixm; ix <= ixp; ix++) {
+          const int ind = INDEX(ix,iy,iz,mx,my);
+          double mult = density[ind];
+          velocity_x[ind] = (velocity_x[ind]-up)*mult;
+          velocity_y[ind] = (velocity_y[ind]-vp)*mult;
+          velocity_z[ind] = (velocity_z[ind]-wp)*mult;
+        }
+      }
     }
   }
 
   else if (direction < 0)
   {
     // back to "lab" frame. Convert momentum density field back to velocity
-    for (int ind = 0; ind<size; ind++) {
-      //if (density[ind] <= 10*1e-20) continue;
-      if (density[ind] == 0) continue;
-      double mult = 1/density[ind];
-      velocity_x[ind] = velocity_x[ind]*mult + up;
-      velocity_y[ind] = velocity_y[ind]*mult + vp;
-      velocity_z[ind] = velocity_z[ind]*mult + wp;
+    for (int iz = izm; iz <= izp; iz++) {
+      for (int iy = iym; iy <= iyp; iy++) {
+        for (int ix = ixm; ix <= ixp; ix++) {
+          const int ind = INDEX(ix,iy,iz,mx,my);
+          //if (density[ind] <= 10*1e-20) continue;
+          if (density[ind] == 0) continue;
+          double mult = 1/density[ind];
+          velocity_x[ind] = velocity_x[ind]*mult + up;
+          velocity_y[ind] = velocity_y[ind]*mult + vp;
+          velocity_z[ind] = velocity_z[ind]*mult + wp;
+        }
+      }
     }
   }
 
@@ -613,6 +628,10 @@ void EnzoMethodFeedbackSTARSS::compute_ (Block * block)
     d_shell_a[i] = 0;
   }
 
+  // the temperature field is computed by the first event, and again only
+  // when an event's cell was changed by an earlier event
+  temperature_stale_.assign(mx*my*mz, 1);
+
   double cell_volume = hx*hy*hz;
 
   const int ia_m = particle.attribute_index (it, "mass");
@@ -897,29 +916,44 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   // holds just shell densities (used for refresh+accumulate)
   enzo_float * d_shell   = (enzo_float *) field.values(i_d_shell);
 
-  // allocate another set of temporary deposit fields for this event 
-  enzo_float *  d_dep = new enzo_float[size]; 
-  enzo_float * te_dep = new enzo_float[size];
-  enzo_float * ge_dep = new enzo_float[size];
-  enzo_float * mf_dep = new enzo_float[size];
-  enzo_float * vx_dep = new enzo_float[size];
-  enzo_float * vy_dep = new enzo_float[size];
-  enzo_float * vz_dep = new enzo_float[size];
+  // cells changed by this event: the CiC clouds of the coupling particles,
+  // which are one cell width from the star, reach two cells from it.
+  // Only these cells are transformed, cleared, and copied below, so that
+  // the cost of an event doesn't depend on the Block size
+  const int i3m[3] = { std::max(ix-2,0), std::max(iy-2,0), std::max(iz-2,0) };
+  const int i3p[3] = { std::min(ix+2,mx-1), std::min(iy+2,my-1),
+                       std::min(iz+2,mz-1) };
+
+  // another set of temporary deposit fields for this event, reused by
+  // later events
+  if (deposit_scratch_.size() < std::size_t(7*size)) {
+    deposit_scratch_.resize(7*size);
+  }
+  enzo_float *  d_dep = deposit_scratch_.data();
+  enzo_float * te_dep = d_dep  + size;
+  enzo_float * ge_dep = te_dep + size;
+  enzo_float * mf_dep = ge_dep + size;
+  enzo_float * vx_dep = mf_dep + size;
+  enzo_float * vy_dep = vx_dep + size;
+  enzo_float * vz_dep = vy_dep + size;
 
   // initialize temporary deposit fields as zero
   // Not doing so gives in screwy results
-  for (int i=0; i<size; i++) {
-    d_dep [i] = 0;
-    te_dep[i] = 0;
-    ge_dep[i] = 0;
-    mf_dep[i] = 0;
-    vx_dep[i] = 0;
-    vy_dep[i] = 0;
-    vz_dep[i] = 0;
+  for (int iz_ = i3m[2]; iz_ <= i3p[2]; iz_++) {
+    for (int iy_ = i3m[1]; iy_ <= i3p[1]; iy_++) {
+      for (int ix_ = i3m[0]; ix_ <= i3p[0]; ix_++) {
+        const int i = INDEX(ix_,iy_,iz_,mx,my);
+        d_dep [i] = 0;
+        te_dep[i] = 0;
+        ge_dep[i] = 0;
+        mf_dep[i] = 0;
+        vx_dep[i] = 0;
+        vy_dep[i] = 0;
+        vz_dep[i] = 0;
+      }
+    }
   }
 
-
-
   const int index = INDEX(ix,iy,iz,mx,my);
 
   int stretch_factor = 1.0; // put coupling particles one cell-width away from star particle
@@ -965,8 +999,9 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
          around is velocity
      */
   
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, 1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, 1);
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, 1, i3m, i3p);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, 1,
+                                  i3m, i3p);
 
   const GrackleChemistryData * grackle_chem = enzo::grackle_chemistry();
   const int primordial_chemistry = (grackle_chem == nullptr) ?
@@ -1069,7 +1104,10 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
   EnzoComputeTemperature compute_temperature(enzo::fluid_props(),
                                              enzo_config->physics_cosmology);
 
-  compute_temperature.compute(enzo_block);
+  if (temperature_stale_[index]) {
+    compute_temperature.compute(enzo_block);
+    std::fill(temperature_stale_.begin(), temperature_stale_.end(), 0);
+  }
 
   double T = temperature[index];
 
@@ -1460,7 +1498,10 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
    &mx, &my, &mz, &hx, &A);
 
   // copy deposited quantites to original fields
-  for (int i=0; i<size; i++){
+  for (int iz_ = i3m[2]; iz_ <= i3p[2]; iz_++) {
+  for (int iy_ = i3m[1]; iy_ <= i3p[1]; iy_++) {
+  for (int ix_ = i3m[0]; ix_ <= i3p[0]; ix_++) {
+    const int i = INDEX(ix_,iy_,iz_,mx,my);
     double d_old = d[i]; 
     d[i] += d_dep[i];
     double d_new = d[i];
@@ -1496,19 +1537,23 @@ void EnzoMethodFeedbackSTARSS::deposit_feedback (Block * block,
     vy_dep_tot[i] += vy_dep[i];
     vz_dep_tot[i] += vz_dep[i];
   }
+  }
+  }
   // transform velocities back to "lab" frame
   // convert velocity (actually momentum density at the moment) field back to velocity 
-  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, -1);
-  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, -1);
-
-  // clear temporary fields 
-  delete []  d_dep;
-  delete [] mf_dep;
-  delete [] te_dep;
-  delete [] ge_dep;
-  delete [] vx_dep;
-  delete [] vy_dep;
-  delete [] vz_dep;
+  this->transformComovingWithStar(d,vx,vy,vz,up,vp,wp,mx,my,mz, -1, i3m, i3p);
+  this->transformComovingWithStar(d_shell,vx_dep_tot,vy_dep_tot,vz_dep_tot,up,vp,wp,mx,my,mz, -1,
+                                  i3m, i3p);
+
+  // later events in these cells need the temperature recomputed
+  for (int iz_ = i3m[2]; iz_ <= i3p[2]; iz_++) {
+    for (int iy_ = i3m[1]; iy_ <= i3p[1]; iy_++) {
+      for (int ix_ = i3m[0]; ix_ <= i3p[0]; ix_++) {
+        temperature_stale_[INDEX(ix_,iy_,iz_,mx,my)] = 1;
+      }
+    }
+  }
+
 }
 
 
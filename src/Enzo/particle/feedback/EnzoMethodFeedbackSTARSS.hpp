@@ -41,6 +41,10 @@ public:
    /// Apply the method
    virtual void compute (Block * block) throw();
 
+   /// compute() does nothing on non-leaf Blocks
+   virtual bool leaf_only () const throw()
+   { return true; }
+
    void compute_ (Block * block);
 
    /// name
@@ -65,10 +69,13 @@ public:
                           const int winds, const int nSNII, const int nSNIa,
                           const double starZ) const throw();
 
+   // transforms the cells from i3m to i3p inclusive (by default all cells)
    void transformComovingWithStar(enzo_float * density,
                                   enzo_float * velocity_x, enzo_float * velocity_y, enzo_float * velocity_z,
                                   const enzo_float up, const enzo_float vp, const enzo_float wp,
-                                  const int mx, const int my, const int mz, int direction) const throw();
+                                  const int mx, const int my, const int mz, int direction,
+                                  const int * i3m = nullptr,
+                                  const int * i3p = nullptr) const throw();
 
    void add_accumulate_fields(EnzoBlock * enzo_block) throw();
 
@@ -150,6 +157,14 @@ protected:
   int i_vz_dep, i_vz_dep_a;
   int i_d_shell, i_d_shell_a;
 
+  // per-event deposit arrays of deposit_feedback(), reused by later
+  // events (not packed)
+  mutable std::vector<enzo_float> deposit_scratch_;
+
+  // cells changed by deposit_feedback() since the temperature field was
+  // last computed (not packed)
+  mutable std::vector<char> temperature_stale_;
+
 };
 
 #endif
@@ -56,48 +56,47 @@ void EnzoBondiHoyleSinkParticle::init_() throw()
   // of the bound fractions of all 26 neighboring cells.
   double min_neighboring_bound_fraction = 1.0;
 
-  // Loop over cells in region bounding accretion zone
-  for (int iz = min_ind_z_; iz < max_ind_z_; iz++){
-    for (int iy = min_ind_y_; iy < max_ind_y_; iy++){
-      for (int ix = min_ind_x_; ix < max_ind_x_; ix++){
-	double r2;
-	if (cell_in_accretion_zone(ix,iy,iz,&r2)) {
-	  const int index = INDEX(ix,iy,iz,mx,my);
-
-	  // append index to vector of accretion zone cell indices
-	  acc_zone_1d_indices_.push_back(index);
-
-	  // Compute cell weight
-	  const double cell_weight = get_cell_weight_(r2);
-	  cell_weights_.push_back(cell_weight);
-	  sum_of_cell_weights += cell_weight;
-
-	  // Now to compute the bound fraction.
-	  // If this is the host cell, set equal to zero, and set
-	  // host_cell_vector_index equal to current_vector_index
-	  // If this is a cell neighboring the host cell, update
-	  // min_neighboring_bound_fraction.
-	  double bound_fraction = 0.0;
-	  if (index == host_cell_1d_index_)
-	      host_cell_vector_index = current_vector_index;
-	  else {
-	    bound_fraction = get_cell_bound_fraction_(ix,iy,iz);
-
-	    // This cell neighbors the host cell if the maximum difference
-	    // between the x/y/z index if this cell and the x/y/z index
-	    // of the host cell is 1
-	    if (std::max(std::max(std::abs(ix - host_cell_ix_),
-				  std::abs(iy - host_cell_iy_)),
-			   std::abs(iz - host_cell_iz_)))
-	      min_neighboring_bound_fraction =
-		std::min(min_neighboring_bound_fraction,bound_fraction);
-	  }
-	  bound_fractions_.push_back(bound_fraction);
-	  current_vector_index++;
-	} // if cell in accretion zone
-      }
+  // Gather the cells in the accretion zone, and their squared distances from
+  // the particle
+  std::vector<double> zone_r2;
+  gather_accretion_zone(acc_zone_1d_indices_, &zone_r2, false);
+
+  // Loop over cells in accretion zone
+  const int n_cells = acc_zone_1d_indices_.size();
+  for (int l = 0; l < n_cells; l++){
+    const int index = acc_zone_1d_indices_[l];
+    const int ix = index % mx;
+    const int iy = (index / mx) % my;
+    const int iz = index / (mx * my);
+
+    // Compute cell weight
+    const double cell_weight = get_cell_weight_(zone_r2[l]);
+    cell_weights_.push_back(cell_weight);
+    sum_of_cell_weights += cell_weight;
+
+    // Now to compute the bound fraction.
+    // If this is the host cell, set equal to zero, and set
+    // host_cell_vector_index equal to current_vector_index
+    // If this is a cell neighboring the host cell, update
+    // min_neighboring_bound_fraction.
+    double bound_fraction = 0.0;
+    if (index == host_cell_1d_index_)
+      host_cell_vector_index = current_vector_index;
+    else {
+      bound_fraction = get_cell_bound_fraction_(ix,iy,iz);
+
+      // This cell neighbors the host cell if the maximum difference
+      // between the x/y/z index if this cell and the x/y/z index
+      // of the host cell is 1
+      if (std::max(std::max(std::abs(ix - host_cell_ix_),
+                            std::abs(iy - host_cell_iy_)),
+                   std::abs(iz - host_cell_iz_)))
+        min_neighboring_bound_fraction =
+          std::min(min_neighboring_bound_fraction,bound_fraction);
     }
-  } // Triple loop over cells in region bounding accretion zone
+    bound_fractions_.push_back(bound_fraction);
+    current_vector_index++;
+  } // Loop over cells in accretion zone
 
   // Normalize cell weights
   for (auto &w : cell_weights_) w /= sum_of_cell_weights;
@@ -557,6 +556,8 @@ void EnzoBondiHoyleSinkParticle::compute(double density_threshold,
   Field field = block_->data()->field();
   enzo_float * density = (enzo_float*) field.values("density");
 
+  std::vector<enzo_float> density_changes(n_cells);
+
   // Loop over cells in accretion zone
   for (int i = 0; i < n_cells; i++){
     const int index = acc_zone_1d_indices_[i];
@@ -567,9 +568,11 @@ void EnzoBondiHoyleSinkParticle::compute(double density_threshold,
     density_change = std::min(std::min(density_change,density[index] - density_threshold),
 			      max_mass_fraction * density[index]);
 
-    update(density_change,index);
+    density_changes[i] = density_change;
 
   } // Loop over cells in accretion zone
 
+  update(n_cells, density_changes.data(), acc_zone_1d_indices_.data());
+
   return;
 }
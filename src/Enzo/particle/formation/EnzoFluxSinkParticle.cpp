@@ -39,35 +39,27 @@ void EnzoFluxSinkParticle::init_() throw()
   // Get pointer to density field data
   enzo_float * density = (enzo_float*) field.values("density");
 
-  // Will create a vector of indices of cells in the accretion zone.
-  decltype(acc_zone_1d_indices_.size()) current_vector_index = 0;
+  // Create a vector of indices of cells in the accretion zone.
+  gather_accretion_zone(acc_zone_1d_indices_, nullptr, false);
 
   // Variable to store the total mass flux into the accretion zone, divided by the cell
   // volume.
   double total_mass_flux_over_cell_volume = 0.0;
 
-  // Loop over cells in region bounding accretion zone
-  for (int iz = min_ind_z_; iz < max_ind_z_; iz++){
-    for (int iy = min_ind_y_; iy < max_ind_y_; iy++){
-      for (int ix = min_ind_x_; ix < max_ind_x_; ix++){
-
-	if (cell_in_accretion_zone(ix,iy,iz)) {
-	  const int index = INDEX(ix,iy,iz,mx,my);
-
-	  // append index to vector of accretion zone cell indices
-	  acc_zone_1d_indices_.push_back(index);
+  // Loop over cells in accretion zone
+  for (const int index : acc_zone_1d_indices_){
+    const int ix = index % mx;
+    const int iy = (index / mx) % my;
+    const int iz = index / (mx * my);
 
-	  // compute the mass flux over cell volume through this cell
-	  // and increment total_mass_flux_over_cell_volume (Equation 35)
-	  total_mass_flux_over_cell_volume += get_mass_flux_over_cell_volume_(ix,iy,iz);
+    // compute the mass flux over cell volume through this cell
+    // and increment total_mass_flux_over_cell_volume (Equation 35)
+    total_mass_flux_over_cell_volume += get_mass_flux_over_cell_volume_(ix,iy,iz);
 
-	  // increment sum_of_densities_
-	  sum_of_densities_ += density[index];
+    // increment sum_of_densities_
+    sum_of_densities_ += density[index];
 
-	} // if cell in accretion zone
-      }
-    }
-  } // Triple loop over cells in region bounding accretion zone
+  } // Loop over cells in accretion zone
 
   const double mean_density = sum_of_densities_ / acc_zone_1d_indices_.size();
 
@@ -142,6 +134,8 @@ void EnzoFluxSinkParticle::compute(double max_mass_fraction) throw()
 
   const double inv_sum_of_densities = 1.0 / sum_of_densities_;
 
+  std::vector<enzo_float> density_changes(n_cells);
+
   // Loop over cells in accretion zone
   for (int i = 0; i < n_cells; i++){
     const int index = acc_zone_1d_indices_[i];
@@ -158,9 +152,11 @@ void EnzoFluxSinkParticle::compute(double max_mass_fraction) throw()
     density_change = std::min(std::min(density_change,density[index] - density_threshold_),
 			      max_mass_fraction * density[index]);
 
-    update(density_change,index);
+    density_changes[i] = density_change;
 
   } // Loop over cells in accretion zone
 
+  update(n_cells, density_changes.data(), acc_zone_1d_indices_.data());
+
   return;
 }
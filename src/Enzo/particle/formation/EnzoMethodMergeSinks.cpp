@@ -16,8 +16,6 @@
 #include "Enzo/enzo.hpp"
 #include "Enzo/particle/particle.hpp"
 
-#include "Enzo/particle/FofLib.hpp"
-
 #include <time.h>
 
 //#define DEBUG_MERGESINKS
@@ -58,6 +56,21 @@ EnzoMethodMergeSinks::EnzoMethodMergeSinks(ParameterGroup p)
   ParticleDescr * particle_descr = cello::particle_descr();
   refresh->add_particle(particle_descr->type_index("sink"));
   refresh->set_particles_are_copied(true);
+
+  // Optionally copy only the sink particles near each neighbouring block
+  const double copy_width_cells = p.value_float("copy_width_cells",0.0);
+  ASSERT("EnzoMethodMergeSinks::EnzoMethodMergeSinks()",
+	 "Method:merge_sinks:copy_width_cells must be zero, or at least "
+	 "merging_radius_cells",
+	 copy_width_cells == 0.0 || copy_width_cells >= merging_radius_cells_);
+  double max_cell_width = 0.0;
+  for (int axis = 0; axis < 3; axis++) {
+    max_cell_width = std::max
+      (max_cell_width,
+       (enzo_config->domain_upper[axis] - enzo_config->domain_lower[axis]) /
+       enzo_config->mesh_root_size[axis]);
+  }
+  refresh->set_particle_copy_width(copy_width_cells * max_cell_width);
 }
 
 void EnzoMethodMergeSinks::pup (PUP::er &p)
@@ -146,18 +159,6 @@ void EnzoMethodMergeSinks::compute_(Block * block)
     const int dmf  = (metals) ? particle.stride(it, ia_mf) : 0;
     const int did  = particle.stride(it, ia_id);
 
-    // Array giving the FoF group number of each particle
-    int * group_index = new int[num_particles];
-
-    // group_sizes will be an array giving the number of particles in each
-    // group
-    int *  group_size;
-
-    // group_lists will be an 'array of arrays'. Each element will be an
-    // array containing the indices of particles belonging to a particular
-    // group
-    int ** group_lists;
-
     // Array containing particle positions in 'block units'
     enzo_float * particle_coordinates = new enzo_float[3 * num_particles];
 
@@ -176,14 +177,14 @@ void EnzoMethodMergeSinks::compute_(Block * block)
       std::max(std::max(cell_width_x,cell_width_y),cell_width_z);
     const enzo_float merging_radius = merging_radius_cells_ * max_cell_width;
 
-    // FofList runs the Friends-of-Friends algorithm on particle positions
-    // (given by the particle_coordinates  array),with the linking length
-    // equal to the merging radius. This function fills in the
-    // previously allocated) group_index array, and allocates
-    // and fills in the group_size and group_lists arrays.
+    // Run the Friends-of-Friends algorithm on particle positions
+    // (given by the particle_coordinates array), with the linking length
+    // equal to the merging radius. Groups are numbered in order of their
+    // lowest-indexed particle, which is listed first in each group.
 
-    int ngroups = FofList(num_particles, particle_coordinates,merging_radius,
-			  group_index, &group_size, &group_lists);
+    EnzoFofGroups fof_groups (num_particles, particle_coordinates,
+                              merging_radius);
+    const int ngroups = fof_groups.num_groups();
 
 #ifdef DEBUG_MERGESINKS
     CkPrintf("The %d particles on Block %s are in %d FoF groups \n",num_particles,
@@ -194,12 +195,15 @@ void EnzoMethodMergeSinks::compute_(Block * block)
 
 #ifdef DEBUG_MERGESINKS
       CkPrintf("Group %d out of %d on block %s: Group size = %d \n",i+1, ngroups,
-	       block->name().c_str(),group_size[i]);
+	       block->name().c_str(),fof_groups.group_size(i));
 #endif
 
       // Only need to merge particles if there are two or more particles in the
       // group
-      if (group_size[i] > 1){
+      const int group_size = fof_groups.group_size(i);
+      const int * group_list = fof_groups.group_members(i);
+
+      if (group_size > 1){
 
 	ASSERT("EnzoMethodMergeSinks::compute_()",
 	       "There is a FoF group containing a pair of sink particles "
@@ -208,11 +212,11 @@ void EnzoMethodMergeSinks::compute_(Block * block)
 	       "happened because the merging radius is too large in "
 	       "comparison to the block size.",
 	       particles_in_neighbouring_blocks_(enzo_block,particle_coordinates,
-						 group_lists,group_size,i));
+						 group_list,group_size));
 
 	// ib1 and ip1 index the first particle in this group
 	int ib1, ip1;
-	particle.index(group_lists[i][0],&ib1,&ip1);
+	particle.index(group_list[0],&ib1,&ip1);
 
 	// We get the attribrutes of this particle and store them in a new
 	// variable
@@ -244,11 +248,11 @@ void EnzoMethodMergeSinks::compute_(Block * block)
 	// now loop over the rest of the particles in this group, and merge
 	// them in to the first particle
 
-	for (int j = 1; j < group_size[i]; j++){
+	for (int j = 1; j < group_size; j++){
 
 	  // ib2 and ip2 are used to index the other particles in this group
 	  int ib2, ip2;
-	  particle.index(group_lists[i][j],&ib2,&ip2);
+	  particle.index(group_list[j],&ib2,&ip2);
 
 	  // get attributes of this particle
 	  pmass = (enzo_float *) particle.attribute_array(it, ia_m, ib2);
@@ -355,15 +359,12 @@ void EnzoMethodMergeSinks::compute_(Block * block)
 	if (metals) pmetal[ip1*dmf] = pmetal1;
 	pid[ip1*did] = pid1;
 
-      }// if (group_size[i] > 1)
+      }// if (group_size > 1)
 
     }// Loop over Fof groups
 
     // Delete the dynamically allocated arrays
 
-    delete [] group_index;
-    free(group_size);
-    free(group_lists);
     delete [] particle_coordinates;
 #ifdef DEBUG_MERGESINKS
     CkPrintf("Block %s: After merging, num_particles = %d \n",
@@ -448,13 +449,12 @@ void EnzoMethodMergeSinks::get_particle_coordinates_
   return;
 }
 
-// Checks if all the particles within a group (specified by group_index)
+// Checks if all the particles within a group (given by group_list)
 // are in neighbouring blocks
 bool EnzoMethodMergeSinks::particles_in_neighbouring_blocks_
 (EnzoBlock * enzo_block,
  enzo_float * particle_coordinates,
- int ** group_lists, int * group_size,
- int group_index)
+ const int * group_list, int group_size)
 {
   bool return_val = 1;
 
@@ -471,8 +471,8 @@ bool EnzoMethodMergeSinks::particles_in_neighbouring_blocks_
   // 3 dimensions, have coordinates 0 and 1 respectively. Checking if a particle
   // is in the block is equivalent to its x,y,z coordinates in this
   // frame-of-reference being between 0 and 1.
-  for (int j = 0; j < group_size[group_index]; j++){
-    const int ind_1 = group_lists[group_index][j];
+  for (int j = 0; j < group_size; j++){
+    const int ind_1 = group_list[j];
 
     const enzo_float px1 =
       (particle_coordinates[3*ind_1]     - block_xm) / block_width_x;
@@ -490,8 +490,8 @@ bool EnzoMethodMergeSinks::particles_in_neighbouring_blocks_
     // Otherwise need to loop over all particles which have not already
     // been considered, checking if the pair (j,k) are on non-neighbouring
     // blocks.
-    for (int k = j; k < group_size[group_index]; k++){
-      const int ind_2 = group_lists[group_index][k];
+    for (int k = j; k < group_size; k++){
+      const int ind_2 = group_list[k];
       const enzo_float px2 =
 	(particle_coordinates[3*ind_2]     - block_xm) / block_width_x;
       const enzo_float py2 =
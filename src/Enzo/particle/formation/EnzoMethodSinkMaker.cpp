@@ -193,6 +193,13 @@ void EnzoMethodSinkMaker::compute_ ( Block *block) throw()
   // This vector will be used to store the new densities of these cells
   std::vector<enzo_float> new_densities;
 
+  // Sink particles formed, which are inserted together after the loop
+  struct NewSink {
+    enzo_float mass, x, y, z, vx, vy, vz, metal_fraction;
+    int64_t id;
+  };
+  std::vector<NewSink> new_sinks;
+
   // Get gravitational constant in code units
   const double const_G =
     enzo::grav_constant_cgs() * enzo::units()->density() *
@@ -266,18 +273,6 @@ void EnzoMethodSinkMaker::compute_ ( Block *block) throw()
 	// So. now create a sink particle
 	n_sinks_formed++;
 
-	// ip_block is the index of the particle in the block
-	// ip_batch is the index if the particle in its batch
-	// ibatch is the index of the batch
-	int ip_block = particle.insert_particles(it, 1);
-	int ip_batch;
-	int ibatch;
-	particle.index(ip_block, &ibatch, &ip_batch);
-
-	// Set the mass of the sink particle to be sink_mass
-	pmass = (enzo_float *) particle.attribute_array(it, ia_m, ibatch);
-	pmass[ip_batch * dm] = sink_mass;
-
 	// Get 3 seeds for the random number generator using the global cell index and
 	// offset_seed_shift_
 	uint64_t x_seed = offset_seed_shift_ + 3 * global_cell_index;
@@ -297,47 +292,76 @@ void EnzoMethodSinkMaker::compute_ ( Block *block) throw()
 	const double z_offset =
 	  hz * max_offset_cell_fraction_ * (2.0 * distribution(generator) - 1.0);
 
-	// Set particle position to be at centre of cell plus the offset
-	px = (enzo_float *) particle.attribute_array(it, ia_x, ibatch);
-	py = (enzo_float *) particle.attribute_array(it, ia_y, ibatch);
-	pz = (enzo_float *) particle.attribute_array(it, ia_z, ibatch);
-
-	px[ip_batch * dp] = xm + (ix - gx + 0.5) * hz + x_offset;
-	py[ip_batch * dp] = ym + (iy - gy + 0.5) * hy + y_offset;
-	pz[ip_batch * dp] = zm + (iz - gz + 0.5) * hz + z_offset;
-
-	// Set particle velocity equal to gas velocity in cell
-	pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ibatch);
-	pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ibatch);
-	pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ibatch);
-	pvx[ip_batch * dv] = vx_gas[block_cell_index];
-	pvy[ip_batch * dv] = vy_gas[block_cell_index];
-	pvz[ip_batch * dv] = vz_gas[block_cell_index];
-
-	// Set creation time equal to current time
-	pcreation_time     =
-	  (enzo_float *) particle.attribute_array(it, ia_creation_time, ibatch);
-	pcreation_time[ip_batch * dcreation_time] = enzo::block(block)->time();
-
-	// Set ID to be the global cell index
-	pid = (int64_t * ) particle.attribute_array(it, ia_id, ibatch);
-	pid[ip_batch * did] = global_cell_index;
-
-	// If we are tracking metals, set metal fraction of sink particle
-	if (metal_density){
-	  pmetal_fraction  =
-	    (enzo_float *) particle.attribute_array(it, ia_metal_fraction, ibatch);
-	  pmetal_fraction[ip_batch * dmetal_fraction] =
-	    metal_density[block_cell_index] / density[block_cell_index];
-	}
-
-	/* Specify that newly created particle is not a copy*/
-	is_copy = (int64_t *) particle.attribute_array(it,ia_copy,ibatch);
-	is_copy[ip_batch * dcopy] = 0;
+	// Mass is sink_mass, position is the centre of cell plus the
+	// offset, velocity is the gas velocity in the cell, and ID is the
+	// global cell index
+	new_sinks.push_back
+	  ({sink_mass,
+	    enzo_float(xm + (ix - gx + 0.5) * hz + x_offset),
+	    enzo_float(ym + (iy - gy + 0.5) * hy + y_offset),
+	    enzo_float(zm + (iz - gz + 0.5) * hz + z_offset),
+	    vx_gas[block_cell_index],
+	    vy_gas[block_cell_index],
+	    vz_gas[block_cell_index],
+	    (metal_density) ?
+	    enzo_float(metal_density[block_cell_index] / density[block_cell_index]) :
+	    enzo_float(0.0),
+	    int64_t(global_cell_index)});
       }
     }
   } // Loop over active cells
 
+  // Now create the sink particles together. ip_first is the index of
+  // the first in the block, and the rest follow it
+  const int ip_first = (n_sinks_formed > 0) ?
+    particle.insert_particles(it, n_sinks_formed) : 0;
+
+  for (int k = 0; k < n_sinks_formed; k++){
+    const NewSink & sink = new_sinks[k];
+
+    // ip_batch is the index if the particle in its batch
+    // ibatch is the index of the batch
+    int ip_batch;
+    int ibatch;
+    particle.index(ip_first + k, &ibatch, &ip_batch);
+
+    pmass = (enzo_float *) particle.attribute_array(it, ia_m, ibatch);
+    pmass[ip_batch * dm] = sink.mass;
+
+    px = (enzo_float *) particle.attribute_array(it, ia_x, ibatch);
+    py = (enzo_float *) particle.attribute_array(it, ia_y, ibatch);
+    pz = (enzo_float *) particle.attribute_array(it, ia_z, ibatch);
+    px[ip_batch * dp] = sink.x;
+    py[ip_batch * dp] = sink.y;
+    pz[ip_batch * dp] = sink.z;
+
+    pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ibatch);
+    pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ibatch);
+    pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ibatch);
+    pvx[ip_batch * dv] = sink.vx;
+    pvy[ip_batch * dv] = sink.vy;
+    pvz[ip_batch * dv] = sink.vz;
+
+    // Set creation time equal to current time
+    pcreation_time     =
+      (enzo_float *) particle.attribute_array(it, ia_creation_time, ibatch);
+    pcreation_time[ip_batch * dcreation_time] = enzo::block(block)->time();
+
+    pid = (int64_t * ) particle.attribute_array(it, ia_id, ibatch);
+    pid[ip_batch * did] = sink.id;
+
+    // If we are tracking metals, set metal fraction of sink particle
+    if (metal_density){
+      pmetal_fraction  =
+	(enzo_float *) particle.attribute_array(it, ia_metal_fraction, ibatch);
+      pmetal_fraction[ip_batch * dmetal_fraction] = sink.metal_fraction;
+    }
+
+    /* Specify that newly created particle is not a copy*/
+    is_copy = (int64_t *) particle.attribute_array(it,ia_copy,ibatch);
+    is_copy[ip_batch * dcopy] = 0;
+  }
+
   // Add newly created sink particles to simulation.
   enzo::simulation()->data_insert_particles(n_sinks_formed);
 
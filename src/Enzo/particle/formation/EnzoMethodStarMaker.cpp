@@ -103,6 +103,30 @@ void EnzoMethodStarMaker::compute ( Block *block) throw()
 
 //----------------------------------------------------------------------
 
+void EnzoMethodStarMaker::density_candidates_
+(const enzo_float * density, double density_min,
+ int mx, int my, int mz, int gx, int gy, int gz,
+ std::vector<int> & cells) throw()
+{
+  const int nx = mx - 2*gx;
+  std::vector<char> mask(nx);
+
+  for (int iz=gz; iz<mz-gz; iz++){
+    for (int iy=gy; iy<my-gy; iy++){
+      const int i0 = gx + mx*(iy + my*iz);
+      // mask, then compact, so that the comparisons vectorize
+      for (int ix=0; ix<nx; ix++){
+        mask[ix] = (density[i0+ix] >= density_min);
+      }
+      for (int ix=0; ix<nx; ix++){
+        if (mask[ix]) cells.push_back(i0+ix);
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------
+
 void EnzoMethodStarMaker::rescale_densities(EnzoBlock * enzo_block,
                                             const int index,
                                             const double density_ratio) throw() {
@@ -110,6 +110,19 @@ protected: // methods
   int check_metallicity(const double &Z);
   int check_temperature(const double &T);
 
+  /// Append to cells, in order, the indices of the active cells whose
+  /// density is at least density_min
+  ///
+  /// This is a vectorizable first pass over the Block, after which the
+  /// star formation criteria are applied, in order, to these cells only.
+  /// The result doesn't change as long as density_min is no more than the
+  /// smallest density that can pass the criteria.
+  static void density_candidates_(const enzo_float * density,
+                                  double density_min,
+                                  int mx, int my, int mz,
+                                  int gx, int gy, int gz,
+                                  std::vector<int> & cells) throw();
+
 
 protected: // attributes
 
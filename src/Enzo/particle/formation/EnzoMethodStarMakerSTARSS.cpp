@@ -235,12 +235,35 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
     0 : grackle_chem->get<int>("primordial_chemistry");
 
   const double dflt_mu = static_cast<double>(enzo::fluid_props()->mol_weight());
-  // iterate over all cells (not including ghost zones)
-  for (int iz=gz; iz<nz+gz; iz++){
-    for (int iy=gy; iy<ny+gy; iy++){
-      for (int ix=gx; ix<nx+gx; ix++){
 
-        int i = INDEX(ix,iy,iz,mx,my);//ix + mx*(iy + my*iz);
+  // only cells dense enough to pass the density thresholds can form
+  // stars, so they are found first (not including ghost zones).  The
+  // number density threshold only bounds the density when mu is fixed
+  double density_min = 0.0;
+  if (use_overdensity_threshold_) {
+    density_min = std::max(density_min, overdensity_threshold_);
+  }
+  if (use_density_threshold_ && primordial_chemistry == 0) {
+    density_min = std::max
+      (density_min, number_density_threshold_ * dflt_mu *
+       enzo_constants::mass_hydrogen / rhounit);
+  }
+  density_min *= (1.0 - 1e-6); // margin for roundoff in the checks below
+  std::vector<int> cells;
+  density_candidates_(density, density_min, mx, my, mz, gx, gy, gz, cells);
+
+  // stars formed, which are inserted together after the loop
+  struct NewStar {
+    enzo_float mass, x, y, z, vx, vy, vz, creation_time, metal_fraction;
+  };
+  std::vector<NewStar> new_stars;
+
+  // iterate over the candidate cells
+  for (const int i : cells){
+
+        const int ix = i % mx;
+        const int iy = (i / mx) % my;
+        const int iz = i / (mx*my);
 
         double mu;
         // compute MMW -- TODO: Make EnzoComputeMeanMolecularWeight class and reference
@@ -432,32 +455,6 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
             CkPrintf("MethodStarMakerSTARSS -- Forming star in gas with number density %f cm^-3\n", ndens);
           #endif
 
-          // now create a star particle
-          int my_particle = particle.insert_particles(it, 1);
-
-          // For the inserted particle, obtain the batch number (ib)
-          // and the particle index (ipp)
-          particle.index(my_particle, &ib, &ipp);
-
-          int io = ipp; // ipp*ps
-          // pointer to mass array in block
-          pmass = (enzo_float *) particle.attribute_array(it, ia_m, ib);
-
-          pmass[io] = massPerStar;
-          px = (enzo_float *) particle.attribute_array(it, ia_x, ib);
-          py = (enzo_float *) particle.attribute_array(it, ia_y, ib);
-          pz = (enzo_float *) particle.attribute_array(it, ia_z, ib);
-
-          // give it position at center of host cell
-          // TODO: Calculate CM instead?
-          px[io] = lx + (ix - gx + 0.5) * dx;
-          py[io] = ly + (iy - gy + 0.5) * dy;
-          pz[io] = lz + (iz - gz + 0.5) * dz;
-
-          pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ib);
-          pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ib);
-          pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ib);
-
           // average particle velocity over many cells to prevent runaway
           double rhosum = 0.0;
           double vx = 0.0;
@@ -484,16 +481,72 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
           if (std::abs(vy) > max_velocity) vy = vy/std::abs(vy) * max_velocity;
           if (std::abs(vz) > max_velocity) vz = vz/std::abs(vz) * max_velocity;
 
-          pvx[io] = vx;
-          pvy[io] = vy;
-          pvz[io] = vz;
+          // record the star particle, giving it the position at the
+          // center of the host cell (TODO: Calculate CM instead?)
+          const NewStar star =
+            {enzo_float(massPerStar),
+             enzo_float(lx + (ix - gx + 0.5) * dx),
+             enzo_float(ly + (iy - gy + 0.5) * dy),
+             enzo_float(lz + (iz - gz + 0.5) * dz),
+             enzo_float(vx), enzo_float(vy), enzo_float(vz),
+             enzo_float(ctime),
+             (metal) ? enzo_float(metal[i] / density[i]) : enzo_float(0.0)};
+          new_stars.push_back(star);
+
+          // Remove mass from grid and rescale fraction fields
+          // TODO: If particle position is updated to CM instead of being cell-centered, will have to 
+          //       remove mass using CiC, which could complicate things because that CiC cloud could
+          //       leak into the ghost zones. Would have to use same refresh+accumulate machinery
+          //       as MethodFeedbackSTARSS to account for this.
+          double scale = (1.0 - star.mass / cell_mass);
+          density[i] *= scale;
+          // rescale color fields too 
+          this->rescale_densities(enzo_block, i, scale);
+
+        } // end loop through particles created in this cell
+
+
+  } // end loop over cells
+
+  // now create the star particles together; insert_particles() returns
+  // the index of the first, and the rest follow it
+  const int first_particle = (new_stars.size() > 0) ?
+    particle.insert_particles(it, new_stars.size()) : 0;
+
+  for (std::size_t k = 0; k < new_stars.size(); k++){
+          const NewStar & star = new_stars[k];
+
+          // For the inserted particle, obtain the batch number (ib)
+          // and the particle index (ipp)
+          particle.index(first_particle + k, &ib, &ipp);
+
+          int io = ipp; // ipp*ps
+          // pointer to mass array in block
+          pmass = (enzo_float *) particle.attribute_array(it, ia_m, ib);
+
+          pmass[io] = star.mass;
+          px = (enzo_float *) particle.attribute_array(it, ia_x, ib);
+          py = (enzo_float *) particle.attribute_array(it, ia_y, ib);
+          pz = (enzo_float *) particle.attribute_array(it, ia_z, ib);
+
+          px[io] = star.x;
+          py[io] = star.y;
+          pz[io] = star.z;
+
+          pvx = (enzo_float *) particle.attribute_array(it, ia_vx, ib);
+          pvy = (enzo_float *) particle.attribute_array(it, ia_vy, ib);
+          pvz = (enzo_float *) particle.attribute_array(it, ia_vz, ib);
+
+          pvx[io] = star.vx;
+          pvy[io] = star.vy;
+          pvz[io] = star.vz;
 
           // finalize attributes
           plifetime = (enzo_float *) particle.attribute_array(it, ia_l, ib);
           pform     = (enzo_float *) particle.attribute_array(it, ia_to, ib);
           plevel    = (enzo_float *) particle.attribute_array(it, ia_lev, ib);
 
-          pform[io]     =  ctime;   // formation time
+          pform[io]     =  star.creation_time;   // formation time
 
           //TODO: Need to have some way of calculating lifetime based on particle mass
           plifetime[io] =  25.0 * enzo_constants::Myr_s / enzo_units->time() ; // lifetime (not accessed for STARSS FB)
@@ -502,19 +555,9 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
 
           if (metal){
             pmetal     = (enzo_float *) particle.attribute_array(it, ia_metal, ib);
-            pmetal[io] = metal[i] / density[i]; // in ABSOLUTE units
+            pmetal[io] = star.metal_fraction; // in ABSOLUTE units
           }
 
-          // Remove mass from grid and rescale fraction fields
-          // TODO: If particle position is updated to CM instead of being cell-centered, will have to 
-          //       remove mass using CiC, which could complicate things because that CiC cloud could
-          //       leak into the ghost zones. Would have to use same refresh+accumulate machinery
-          //       as MethodFeedbackSTARSS to account for this.
-          double scale = (1.0 - pmass[io] / cell_mass);
-          density[i] *= scale;
-          // rescale color fields too 
-          this->rescale_densities(enzo_block, i, scale);
-
           #ifdef DEBUG_STORE_INITIAL_PROPERTIES 
             enzo_float * pmass0 = (enzo_float *) particle.attribute_array(it, ia_m_0 , ib);
             enzo_float * px0    = (enzo_float *) particle.attribute_array(it, ia_x_0 , ib);
@@ -532,13 +575,7 @@ void EnzoMethodStarMakerSTARSS::compute ( Block *block) throw()
             pvy0[io] = pvy[io];
             pvz0[io] = pvz[io];
           #endif
-
-        } // end loop through particles created in this cell
-
-
-      }
-    }
-  } // end loop iz
+  }
 
   #ifdef DEBUG_SF_CRITERIA
     if (count > 0){
@@ -151,20 +151,33 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
 
   compute_temperature.compute(enzo_block);
 
-  // iterate over all cells (not including ghost zones)
+  // only cells dense enough to pass the number density threshold can form
+  // stars, so they are found first (not including ghost zones)
+  const double mean_particle_mass =
+    nominal_mol_weight * enzo_constants::mass_hydrogen;
+  const double density_min = (use_density_threshold_) ?
+    number_density_threshold_ * mean_particle_mass / enzo_units->density() *
+    (1.0 - 1e-6) : // margin for roundoff in check_number_density_threshold
+    0.0;
+  std::vector<int> cells;
+  density_candidates_(density, density_min, mx, my, mz, gx, gy, gz, cells);
+
+  // stars formed, which are inserted together after the loop
+  struct NewStar {
+    int i;
+    enzo_float mass, lifetime, metal_fraction;
+  };
+  std::vector<NewStar> new_stars;
+
+  // iterate over the candidate cells
   //
   //   To Do: Allow for multi-zone star formation by adding mass in
   //          surrounding cells if needed to accumulte enough mass
   //          to hit target star particle mass ()
-  for (int iz=gz; iz<nz+gz; iz++){
-    for (int iy=gy; iy<ny+gy; iy++){
-      for (int ix=gx; ix<nx+gx; ix++){
-
-        int i = ix + mx*(iy + my*iz);
+  for (const int i : cells){
 
         // need to compute this better for Grackle fields (on to-do list)
         double rho_cgs = density[i] * enzo_units->density();
-        double mean_particle_mass = nominal_mol_weight * enzo_constants::mass_hydrogen;
         double ndens = rho_cgs / mean_particle_mass;
 
         double mass  = density[i] *dx*dy*dz * enzo_units->mass() / enzo_constants::mass_solar;
@@ -245,13 +258,49 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
 
         count++; //
 
-        // now create a star particle
-        //    insert_particles( particle_type, number_of_particles )
-        int my_particle = particle.insert_particles(it, 1);
+        // record the star particle, since removing its mass below changes
+        // the cell
+        new_stars.push_back
+          ({i, enzo_float(star_fraction * (density[i] * dx * dy * dz)),
+            enzo_float(tdyn),
+            (metal) ? enzo_float(metal[i] / density[i]) : enzo_float(0.0)});
+
+        // Remove mass from grid and rescale fraction fields
+        density[i] = (1.0 - star_fraction) * density[i];
+        double scale = (1.0 - star_fraction) / 1.0;
+
+        if (density[i] < 0){
+          CkPrintf("StochasticSF: density index star_fraction mass: %g %i %g %g\n",
+                   density[i],i,star_fraction,mass);
+          ERROR("EnzoMethodStarMakerStochasticSF::compute()",
+                "Negative densities in star formation");
+        }
+
+        // rescale tracer fields to maintain constant mass fraction
+        // with the corresponding new density...
+        //    scale = new_density / old_density
+        rescale_densities(enzo_block, i, scale);
+  } // end loop over cells
+
+  // now create the star particles together
+  //    insert_particles( particle_type, number_of_particles )
+  // returns the index of the first, and the rest follow it
+  const int first_particle = (new_stars.size() > 0) ?
+    particle.insert_particles(it, new_stars.size()) : 0;
+
+  // ids of the new stars come from one range of this process's counter
+  const int64_t first_id = ParticleData::reserve_ids(new_stars.size());
+
+  for (std::size_t k = 0; k < new_stars.size(); k++){
+        const NewStar & star = new_stars[k];
+        const int i  = star.i;
+        const int ix = i % mx;
+        const int iy = (i / mx) % my;
+        const int iz = i / (mx*my);
 
         // For the inserted particle, obtain the batch number (ib)
         //  and the particle index (ipp)
-        particle.index(my_particle, &ib, &ipp);
+        particle.index(first_particle + k, &ib, &ipp);
 
         int io = ipp; // ipp*ps
         // pointer to mass array in block
@@ -259,9 +308,9 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
 
         id = (int64_t * ) particle.attribute_array(it, ia_id, ib);
 
-        id[io] = CkMyPe() + (ParticleData::id_counter[cello::index_static()]++) * CkNumPes();
+        id[io] = ParticleData::id(first_id + k);
 
-        pmass[io] = star_fraction * (density[i] * dx * dy * dz);
+        pmass[io] = star.mass;
         px = (enzo_float *) particle.attribute_array(it, ia_x, ib);
         py = (enzo_float *) particle.attribute_array(it, ia_y, ib);
         pz = (enzo_float *) particle.attribute_array(it, ia_z, ib);
@@ -287,31 +336,13 @@ void EnzoMethodStarMakerStochasticSF::compute ( Block *block) throw()
         pform     = (enzo_float *) particle.attribute_array(it, ia_to, ib);
 
         pform[io]     =  enzo_block->time();   // formation time
-        plifetime[io] =  tdyn;  // 10.0 * enzo_constants::Myr_s / enzo_units->time() ; // lifetime
+        plifetime[io] =  star.lifetime;  // 10.0 * enzo_constants::Myr_s / enzo_units->time() ; // lifetime
 
         if (metal){
           pmetal     = (enzo_float *) particle.attribute_array(it, ia_metal, ib);
-          pmetal[io] = metal[i] / density[i];
-        }
-
-        // Remove mass from grid and rescale fraction fields
-        density[i] = (1.0 - star_fraction) * density[i];
-        double scale = (1.0 - star_fraction) / 1.0;
-
-        if (density[i] < 0){
-          CkPrintf("StochasticSF: density index star_fraction mass: %g %i %g %g\n",
-                   density[i],i,star_fraction,mass);
-          ERROR("EnzoMethodStarMakerStochasticSF::compute()",
-                "Negative densities in star formation");
+          pmetal[io] = star.metal_fraction;
         }
-
-        // rescale tracer fields to maintain constant mass fraction
-        // with the corresponding new density...
-        //    scale = new_density / old_density
-        rescale_densities(enzo_block, i, scale);
-      }
-    }
-  } // end loop iz
+  }
 
   if (count > 0){
       CkPrintf("StochasticSF: Number of particles formed = %i \n", count);
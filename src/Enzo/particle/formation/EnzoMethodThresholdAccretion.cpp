@@ -84,6 +84,11 @@ void EnzoMethodThresholdAccretion::compute_(Block * block)
     int mx, my, mz;
     field.dimensions (0, &mx, &my, &mz);
 
+    // Cells in the accretion zone of each particle, and those accreted from
+    std::vector<int> zone_indices;
+    std::vector<int> accreting_indices;
+    std::vector<enzo_float> density_changes;
+
     // Loop over batches
     const int nb = particle.num_batches(it);
     for (int ib=0; ib < nb; ib++){
@@ -95,29 +100,25 @@ void EnzoMethodThresholdAccretion::compute_(Block * block)
 	// Create an EnzoSinkParticle object
 	EnzoSinkParticle sp =  EnzoSinkParticle(block,ib,ip,accretion_radius);
 
-	// Loop over all cells which contain the accretion zone
-	for (int k = sp.min_ind_z(); k <= sp.max_ind_z(); k++){
-	  for (int j = sp.min_ind_y(); j <= sp.max_ind_y(); j++){
-	    for (int i = sp.min_ind_x(); i <= sp.max_ind_x(); i++){
-
-	      // Check if cell is in accretion zone
-	      if (sp.cell_in_accretion_zone(i, j, k)){
-		const int index = INDEX(i,j,k,mx,my);
-		if (density[index] > density_threshold){
-
-		  const enzo_float density_change =
-		    std::min(density[index] - density_threshold,
-			     max_mass_fraction_ * density[index]);
-
-		  // Update sink particle data and source fields due to accretion
-		  // from this cell
-		  sp.update(density_change, index);
-
-		} // if density is above threshold
-	      } // if cell is in accretion zone
-	    }
+	// Gather the cells in the accretion zone
+	zone_indices.clear();
+	sp.gather_accretion_zone(zone_indices, nullptr);
+
+	// Compute the density change of the cells above the threshold
+	accreting_indices.clear();
+	density_changes.clear();
+	for (const int index : zone_indices){
+	  if (density[index] > density_threshold){
+	    accreting_indices.push_back(index);
+	    density_changes.push_back(std::min(density[index] - density_threshold,
+					       max_mass_fraction_ * density[index]));
 	  }
-	} // Triple loop over cells containing accretion zone
+	}
+
+	// Update sink particle data and source fields due to accretion
+	// from these cells
+	sp.update(accreting_indices.size(), density_changes.data(),
+		  accreting_indices.data());
 
 	// Write the sink particle data to the particle attribute array
 	sp.write_particle_data();
@@ -12,6 +12,11 @@
 #include "Enzo/enzo.hpp"
 #include "Enzo/particle/particle.hpp"
 
+std::map<std::array<double,3>, EnzoSinkParticle::AccretionStencil>
+EnzoSinkParticle::stencils_[CONFIG_NODE_SIZE];
+
+// -------------------------------------------------------------------------------------------
+
 EnzoSinkParticle::EnzoSinkParticle
 (Block * block,
  int ib,
@@ -149,7 +154,96 @@ bool EnzoSinkParticle::cell_in_accretion_zone(int i, int j, int k,
 
 // ---------------------------------------------------------------------------------------------
 
-void EnzoSinkParticle::update(enzo_float density_change, int index) throw() {
+const EnzoSinkParticle::AccretionStencil & EnzoSinkParticle::accretion_stencil_
+(double rx, double ry, double rz) throw()
+{
+  auto & stencils = stencils_[cello::index_static()];
+  const std::array<double,3> key = {rx, ry, rz};
+  auto it = stencils.find(key);
+  if (it != stencils.end()) return it->second;
+
+  AccretionStencil & stencil = stencils[key];
+
+  // A cell at offset `d` from the host cell has its center between d - 0.5 and
+  // d + 0.5 cell widths from the particle, so it can be in the accretion zone
+  // only if the nearest of these is within the radius.  The margin allows for
+  // roundoff in locating the host cell.
+  const double margin = 1e-6;
+  auto nearest = [margin](int d) { return std::max(0.0, std::abs(d) - 0.5 - margin); };
+  const int nx = std::ceil(rx) + 1;
+  const int ny = std::ceil(ry) + 1;
+  const int nz = std::ceil(rz) + 1;
+  for (int dk = -nz; dk <= nz; dk++){
+    for (int dj = -ny; dj <= ny; dj++){
+      for (int di = -nx; di <= nx; di++){
+        const double sx = nearest(di) / rx;
+        const double sy = nearest(dj) / ry;
+        const double sz = nearest(dk) / rz;
+        if (sx*sx + sy*sy + sz*sz < 1.0) {
+          stencil.di.push_back(di);
+          stencil.dj.push_back(dj);
+          stencil.dk.push_back(dk);
+        }
+      }
+    }
+  }
+  return stencil;
+}
+
+// ---------------------------------------------------------------------------------------------
+
+void EnzoSinkParticle::gather_accretion_zone(std::vector<int> & indices,
+                                             std::vector<double> * r2,
+                                             bool upper_inclusive) throw()
+{
+  double hx, hy, hz;
+  block_->cell_width(&hx, &hy, &hz);
+  double xm, ym, zm;
+  block_->data()->lower(&xm,&ym,&zm);
+  Field field = block_->data()->field();
+  int gx, gy, gz;
+  field.ghost_depth(0,&gx,&gy,&gz);
+  int mx, my, mz;
+  field.dimensions (0, &mx, &my, &mz);
+
+  const AccretionStencil & stencil =
+    accretion_stencil_(accretion_radius_ / hx, accretion_radius_ / hy,
+                       accretion_radius_ / hz);
+
+  // The host cell, and the bounding region
+  const int ih = floor((px_ - xm) / hx) + gx;
+  const int jh = floor((py_ - ym) / hy) + gy;
+  const int kh = floor((pz_ - zm) / hz) + gz;
+  const int upper = upper_inclusive ? 0 : 1;
+  const int max_i = max_ind_x_ - upper;
+  const int max_j = max_ind_y_ - upper;
+  const int max_k = max_ind_z_ - upper;
+
+  const int n = stencil.di.size();
+  for (int s = 0; s < n; s++){
+    const int i = ih + stencil.di[s];
+    const int j = jh + stencil.dj[s];
+    const int k = kh + stencil.dk[s];
+    if (i < min_ind_x_ || i > max_i ||
+        j < min_ind_y_ || j > max_j ||
+        k < min_ind_z_ || k > max_k) continue;
+
+    // Same test as cell_in_accretion_zone()
+    const double disp_x = xm + (i - gx + 0.5) * hx - px_;
+    const double disp_y = ym + (j - gy + 0.5) * hy - py_;
+    const double disp_z = zm + (k - gz + 0.5) * hz - pz_;
+    const double d2 = disp_x * disp_x + disp_y * disp_y + disp_z * disp_z;
+    if (d2 < accretion_radius_ * accretion_radius_) {
+      indices.push_back(INDEX(i,j,k,mx,my));
+      if (r2) r2->push_back(d2);
+    }
+  }
+}
+
+// ---------------------------------------------------------------------------------------------
+
+void EnzoSinkParticle::update(int n, const enzo_float * density_change,
+                              const int * index) throw() {
 
   int it = cello::particle_descr()->type_index("sink");
 
@@ -161,9 +255,9 @@ void EnzoSinkParticle::update(enzo_float density_change, int index) throw() {
   enzo_float * vy_gas      = (enzo_float*) field.values("velocity_y");
   enzo_float * vz_gas      = (enzo_float*) field.values("velocity_z");
 
+  const bool metals = cello::particle_descr()->has_attribute(it,"metal_fraction");
   enzo_float * metal_density =
-    cello::particle_descr()->has_attribute(it,"metal_fraction") ?
-    (enzo_float*) field.values("metal_density") : nullptr;
+    metals ? (enzo_float*) field.values("metal_density") : nullptr;
 
   enzo_float * density_source    = (enzo_float*) field.values("density_source");
   enzo_float * mom_dens_x_source = (enzo_float*) field.values("mom_dens_x_source");
@@ -175,38 +269,37 @@ void EnzoSinkParticle::update(enzo_float density_change, int index) throw() {
   block_->cell_width(&hx, &hy, &hz);
   const double cell_volume = hx * hy * hz;
 
-  // Get the mass change from this cell and update the total mass change
-  const enzo_float mass_change = density_change * cell_volume;
-  total_pmass_change_ += mass_change;
-
-  // Update total metal mass change if required
-  if (cello::particle_descr()->has_attribute(it,"metal_fraction"))
-    total_pmetal_mass_change_ = (density_change / density[index]) * metal_density[index];
-
-  // Set density_sink equal to minus the density change
-  density_source[index] = -density_change;
-
-  // These variables store the change of the particle's momentum due to accretion
-  // from this cell
-  enzo_float momentum_x_change;
-  enzo_float momentum_y_change;
-  enzo_float momentum_z_change;
-
-  // Compute change in momentum of particle due to accretion from this cell
-  momentum_x_change = mass_change * vx_gas[index];
-  momentum_y_change = mass_change * vy_gas[index];
-  momentum_z_change = mass_change * vz_gas[index];
-
-  // Update total particle momentum change
-  total_momentum_x_change_ += momentum_x_change;
-  total_momentum_y_change_ += momentum_y_change;
-  total_momentum_z_change_ += momentum_z_change;
-
-  // Set "mom_dens_source" fields to minus the particle's
-  // momentum change divided by cell volume
-  mom_dens_x_source[index] = -momentum_x_change / cell_volume;
-  mom_dens_y_source[index] = -momentum_y_change / cell_volume;
-  mom_dens_z_source[index] = -momentum_z_change / cell_volume;
+  for (int l = 0; l < n; l++){
+
+    const int i = index[l];
+
+    // Get the mass change from this cell and update the total mass change
+    const enzo_float mass_change = density_change[l] * cell_volume;
+    total_pmass_change_ += mass_change;
+
+    // Update total metal mass change if required
+    if (metals)
+      total_pmetal_mass_change_ = (density_change[l] / density[i]) * metal_density[i];
+
+    // Set density_sink equal to minus the density change
+    density_source[i] = -density_change[l];
+
+    // Compute change in momentum of particle due to accretion from this cell
+    const enzo_float momentum_x_change = mass_change * vx_gas[i];
+    const enzo_float momentum_y_change = mass_change * vy_gas[i];
+    const enzo_float momentum_z_change = mass_change * vz_gas[i];
+
+    // Update total particle momentum change
+    total_momentum_x_change_ += momentum_x_change;
+    total_momentum_y_change_ += momentum_y_change;
+    total_momentum_z_change_ += momentum_z_change;
+
+    // Set "mom_dens_source" fields to minus the particle's
+    // momentum change divided by cell volume
+    mom_dens_x_source[i] = -momentum_x_change / cell_volume;
+    mom_dens_y_source[i] = -momentum_y_change / cell_volume;
+    mom_dens_z_source[i] = -momentum_z_change / cell_volume;
+  }
 
   return;
 }
@@ -46,6 +46,15 @@ public:
   /// center of the cell from the sink particle.
   bool cell_in_accretion_zone(int i, int j, int k, double* r2) throw();
 
+  /// Appends the (1D) indices of the cells in the accretion zone to `indices`,
+  /// in the same order as a loop over the bounding region with x varying fastest,
+  /// and the squares of their distances from the particle to `r2` if it is not
+  /// null.  Only the cells of a stencil of offsets from the host cell, precomputed
+  /// for the accretion radius and cell widths, are tested.  If `upper_inclusive` is
+  /// false, cells at the maximum bounding indices are excluded.
+  void gather_accretion_zone(std::vector<int> & indices, std::vector<double> * r2,
+                             bool upper_inclusive = true) throw();
+
   /// `density_change` is the change in density in given cell (specified by `index`)
   /// due to accretion.
   ///
@@ -53,7 +62,12 @@ public:
   ///
   /// This function updates the sink particle date and computes values for the source fields
   /// in the given cell (specified by `index`).
-  void update(enzo_float density_change, int index) throw();
+  void update(enzo_float density_change, int index) throw()
+  { update(1, &density_change, &index); }
+
+  /// Same as above for `n` cells, with the density changes and (1D) cell indices in
+  /// the arrays `density_change` and `index`.
+  void update(int n, const enzo_float * density_change, const int * index) throw();
 
   /// Writes particle data to the attribute arrays
   void write_particle_data() throw();
@@ -68,6 +82,19 @@ public:
 
 protected:
 
+  /// Offsets from the host cell of the cells which can be in the accretion zone
+  struct AccretionStencil {
+    std::vector<int> di, dj, dk;
+  };
+
+  /// Returns the stencil for an accretion radius of `rx`,`ry`,`rz` cell widths
+  /// along each axis, computing it on first use
+  static const AccretionStencil & accretion_stencil_
+  (double rx, double ry, double rz) throw();
+
+  /// Stencils computed so far, by accretion radius in cell widths (not packed)
+  static std::map<std::array<double,3>, AccretionStencil> stencils_[CONFIG_NODE_SIZE];
+
   /// Attributes
 
   /// Pointer to the block containing this particle
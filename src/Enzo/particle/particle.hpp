@@ -30,7 +30,10 @@
 // Component headers
 //----------------------------------------------------------------------
 
+#include "particle/EnzoFofGroups.hpp"
+#include "particle/EnzoMethodFofHalos.hpp"
 #include "particle/EnzoMethodPmUpdate.hpp"
+#include "particle/EnzoShortRangeForce.hpp"
 
 // [order dependencies:]
 #include "particle/formation/EnzoSinkParticle.hpp"
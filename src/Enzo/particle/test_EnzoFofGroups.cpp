@@ -0,0 +1,90 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoFofGroups.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Test program for the EnzoFofGroups class
+///
+/// Checks that EnzoFofGroups finds the same groups, with the same
+/// numbering and member order, as the FofList() routine in FofLib,
+/// and reports the time taken by each.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#include "Enzo/particle/particle.hpp"
+#include "Enzo/particle/FofLib.hpp"
+
+//----------------------------------------------------------------------
+
+bool test_groups (int np, enzo_float link)
+{
+  std::vector<enzo_float> x(3*np);
+  for (int i=0; i<3*np; i++) x[i] = (rand() + 0.5) / (RAND_MAX + 1.0);
+
+  Timer timer;
+  timer.start();
+  EnzoFofGroups fof_groups (np,x.data(),link);
+  const double time_cell = timer.stop();
+
+  std::vector<int> group(np);
+  int * group_size;
+  int ** group_list;
+  timer.clear();
+  timer.start();
+  const int ng = FofList(np,x.data(),link,group.data(),&group_size,&group_list);
+  const double time_tree = timer.stop();
+
+  bool match = (ng == fof_groups.num_groups());
+  for (int ig=0; match && ig<ng; ig++) {
+    match = (group_size[ig] == fof_groups.group_size(ig));
+    // FofList() lists members in search order rather than sorted order
+    std::vector<int> members (group_list[ig],group_list[ig]+group_size[ig]);
+    std::sort(members.begin(),members.end());
+    for (int k=0; match && k<group_size[ig]; k++) {
+      match = (members[k] == fof_groups.group_members(ig)[k]);
+    }
+  }
+  for (int i=0; match && i<np; i++) {
+    match = (group[i] == fof_groups.group(i));
+  }
+
+  for (int ig=0; ig<ng; ig++) free(group_list[ig]);
+  free(group_list);
+  free(group_size);
+
+  CkPrintf ("np %d groups %d EnzoFofGroups %g s FofList %g s\n",
+            np,ng,time_cell,time_tree);
+
+  return match;
+}
+
+//======================================================================
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoFofGroups");
+
+  srand(31415);
+
+  unit_func ("EnzoFofGroups()");
+
+  // single point, isolated points, and mostly-linked points
+
+  unit_assert (test_groups (1,0.1));
+  unit_assert (test_groups (1000,0.01));
+  unit_assert (test_groups (1000,0.1));
+  unit_assert (test_groups (20000,0.01));
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -0,0 +1,114 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoShortRangeForce.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Test program for the EnzoShortRangeForce class
+///
+/// Checks that the S2 force is continuous and matches 1/r^2 at the
+/// cutoff, that the correction vanishes beyond the cutoff, and that
+/// accelerations computed using the cell-linked list match a direct
+/// sum over all pairs.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+#include "Enzo/particle/particle.hpp"
+
+//----------------------------------------------------------------------
+
+bool test_kernel (double a)
+{
+  const double e = 1e-9*a;
+  const double f1m = EnzoShortRangeForce::s2_force(0.5*a-e,a);
+  const double f1p = EnzoShortRangeForce::s2_force(0.5*a+e,a);
+  const double f2m = EnzoShortRangeForce::s2_force(a-e,a);
+  const double f2p = EnzoShortRangeForce::s2_force(a+e,a);
+
+  EnzoShortRangeForce short_range (a);
+
+  return (std::abs(f1m-f1p) < 1e-6*f1p) &&
+    (std::abs(f2m-f2p) < 1e-6*f2p) &&
+    (std::abs(f2p - 1.0/(a*a)) < 1e-6*f2p) &&
+    (short_range.correction(a) == 0.0) &&
+    (short_range.correction(2.0*a) == 0.0) &&
+    (short_range.correction(0.5*a) > 0.0);
+}
+
+//----------------------------------------------------------------------
+
+bool test_sum (int np, double a, double softening)
+{
+  std::vector<double> x(3*np), m(np);
+  for (int i=0; i<3*np; i++) x[i] = (rand() + 0.5) / (RAND_MAX + 1.0);
+  for (int i=0; i<np; i++)   m[i] = 1.0 + rand() % 3;
+
+  EnzoShortRangeForce short_range (a,softening);
+
+  std::vector<double> a_cell(3*np,0.0), a_direct(3*np,0.0);
+
+  Timer timer;
+  timer.start();
+  short_range.add_accelerations
+    (np,x.data(),np,x.data(),m.data(),a_cell.data());
+  const double time_cell = timer.stop();
+
+  timer.clear();
+  timer.start();
+  for (int i=0; i<np; i++) {
+    for (int j=0; j<np; j++) {
+      if (i == j) continue;
+      double d[3], r2 = 0.0;
+      for (int axis=0; axis<3; axis++) {
+        d[axis] = x[3*j+axis] - x[3*i+axis];
+        r2 += d[axis]*d[axis];
+      }
+      const double r = sqrt(r2);
+      const double f = m[j]*short_range.correction(r)/r;
+      for (int axis=0; axis<3; axis++) a_direct[3*i+axis] += f*d[axis];
+    }
+  }
+  const double time_direct = timer.stop();
+
+  double error = 0.0, a_max = 0.0;
+  for (int i=0; i<3*np; i++) {
+    error = std::max(error,std::abs(a_cell[i]-a_direct[i]));
+    a_max = std::max(a_max,std::abs(a_direct[i]));
+  }
+
+  CkPrintf ("np %d a %g cell list %g s direct %g s error %g\n",
+            np,a,time_cell,time_direct,error/a_max);
+
+  return (a_max > 0.0) && (error <= 1e-10*a_max);
+}
+
+//======================================================================
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("EnzoShortRangeForce");
+
+  srand(27182);
+
+  unit_func ("s2_force()");
+
+  unit_assert (test_kernel (1.0));
+  unit_assert (test_kernel (0.01));
+
+  unit_func ("add_accelerations()");
+
+  unit_assert (test_sum (1000,0.1,0.0));
+  unit_assert (test_sum (2000,0.05,0.005));
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
@@ -17,11 +17,13 @@ EnzoComputeCicInterp::EnzoComputeCicInterp
 (std::string     field_name,
  std::string     particle_type,
  std::string     particle_attribute,
- double          dt)
+ double          dt,
+ pm_assignment   assignment)
   : it_p_ (cello::particle_descr()->type_index (particle_type)),
     ia_p_ (cello::particle_descr()->attribute_index (it_p_,particle_attribute)),
     if_ (cello::field_descr()->field_id (field_name)),
-    dt_(dt)
+    dt_(dt),
+    assignment_(assignment)
 {
 }
 
@@ -40,6 +42,9 @@ void EnzoComputeCicInterp::pup (PUP::er &p)
   p | ia_p_;
   p | if_;
   p | dt_;
+  int assignment = int(assignment_);
+  p | assignment;
+  assignment_ = pm_assignment(assignment);
 }
 
 //----------------------------------------------------------------------
@@ -64,36 +69,18 @@ void EnzoComputeCicInterp::compute_(Block * block)
 
   enzo_float * vf = (enzo_float*)field.values(if_);
 
-  const int ia_x = particle.attribute_position(it_p_,0);
-  const int ia_y = particle.attribute_position(it_p_,1);
-  const int ia_z = particle.attribute_position(it_p_,2);
+  const int rank = cello::rank();
 
-  const int ia_vx = particle.attribute_velocity(it_p_,0);
-  const int ia_vy = particle.attribute_velocity(it_p_,1);
-  const int ia_vz = particle.attribute_velocity(it_p_,2);
+  int ia_x3[3], ia_v3[3];
+  for (int axis=0; axis<3; axis++) {
+    ia_x3[axis] = particle.attribute_position(it_p_,axis);
+    ia_v3[axis] = particle.attribute_velocity(it_p_,axis);
+  }
 
-  const int dp =  particle.stride(it_p_,ia_x);
   const int da =  particle.stride(it_p_,ia_p_);
-  const int dv =  particle.stride(it_p_,ia_vx);
-
-  const int rank = cello::rank();
 
-  int mx,my,mz;
-  field.dimensions(0,&mx,&my,&mz);
-  const int mxy=mx*my;
-  const int i000 = 0;
-  const int i001 = mxy;
-  const int i010 = mx;
-  const int i011 = mx+mxy;
-  const int i100 = 1;
-  const int i101 = 1+mxy;
-  const int i110 = 1+mx;
-  const int i111 = 1+mx+mxy;
-  
   int nx,ny,nz;
   field.size(&nx,&ny,&nz);
-  int gx,gy,gz;
-  field.ghost_depth(0,&gx,&gy,&gz);
 
   // Get block extents and cell widths
   double xm,ym,zm;
@@ -101,129 +88,56 @@ void EnzoComputeCicInterp::compute_(Block * block)
   block->lower(&xm,&ym,&zm);
   block->upper(&xp,&yp,&zp);
 
-  const bool lshift = (dt_ != 0.0);
-  
-  const int nb = particle.num_batches(it_p_);
-
-  if (rank == 1) {
-
-    for (int ib=0; ib<nb; ib++) {
-
-      enzo_float * vp = (enzo_float*) particle.attribute_array(it_p_, ia_p_, ib);
-
-      const int np = particle.num_particles(it_p_,ib);
+  enzo_pm::PmGeometry<enzo_float> geometry;
+  field.dimensions(0,&geometry.mx,&geometry.my,&geometry.mz);
+  field.ghost_depth(0,&geometry.gx,&geometry.gy,&geometry.gz);
+  geometry.lower[0] = xm;
+  geometry.lower[1] = ym;
+  geometry.lower[2] = zm;
+  geometry.scale[0] = nx / (xp - xm);
+  geometry.scale[1] = ny / (yp - ym);
+  geometry.scale[2] = nz / (zp - zm);
+  geometry.dp = particle.stride(it_p_,ia_x3[0]);
+  geometry.dv = particle.stride(it_p_,ia_v3[0]);
+  geometry.dt = dt_;
 
-      enzo_float * xa = (enzo_float *) particle.attribute_array (it_p_,ia_x,ib);
-      enzo_float * vxa = lshift ?
-	(enzo_float *) particle.attribute_array (it_p_,ia_vx,ib) : nullptr;
-
-      for (int ip=0; ip<np; ip++) {
-
-	enzo_float x = lshift ? xa[ip*dp] + dt_*vxa[ip*dv] : xa[ip*dp];
+  const bool lshift = (dt_ != 0.0);
 
-	enzo_float tx = nx*(x - xm) / (xp - xm) - 0.5;
+  const int nb = particle.num_batches(it_p_);
 
-	int ix0 = gx + floor(tx);
+  // Global positions, if positions are integers relative to the Block
+  const bool is_int = particle.position_is_int(it_p_);
+  std::vector<double> position_global;
+  std::vector<enzo_float> position_float;
 
-	int ix1 = ix0 + 1;
+  for (int ib=0; ib<nb; ib++) {
 
-	enzo_float x0 = 1.0 - (tx - floor(tx));
+    enzo_float * vp = (enzo_float*) particle.attribute_array(it_p_, ia_p_, ib);
 
-	enzo_float x1 = 1.0 - x0;
+    const int np = particle.num_particles(it_p_,ib);
 
-	vp[ip*da] = x0*vf[ix0] + x1*vf[ix1];
-      }
+    for (int axis=0; axis<3; axis++) {
+      geometry.x[axis] = (axis < rank) ? (enzo_float *)
+        particle.attribute_array (it_p_,ia_x3[axis],ib) : nullptr;
+      geometry.v[axis] = (axis < rank && lshift) ? (enzo_float *)
+        particle.attribute_array (it_p_,ia_v3[axis],ib) : nullptr;
     }
-  } else if (rank == 2) {
-
-    for (int ib=0; ib<nb; ib++) {
-
-      enzo_float * vp = (enzo_float*) particle.attribute_array(it_p_, ia_p_, ib);
-
-      const int np = particle.num_particles(it_p_,ib);
-
-      enzo_float * xa = (enzo_float *) particle.attribute_array (it_p_,ia_x,ib);
-      enzo_float * ya = (enzo_float *) particle.attribute_array (it_p_,ia_y,ib);
-
-      enzo_float * vxa = lshift ?
-	(enzo_float *) particle.attribute_array (it_p_,ia_vx,ib) : nullptr;
-      enzo_float * vya = lshift ?
-	(enzo_float *) particle.attribute_array (it_p_,ia_vy,ib) : nullptr;
-
-      for (int ip=0; ip<np; ip++) {
-
-	enzo_float x = lshift ? xa[ip*dp] + dt_*vxa[ip*dv] : xa[ip*dp];
-	enzo_float y = lshift ? ya[ip*dp] + dt_*vya[ip*dv] : ya[ip*dp];
-
-	enzo_float tx = nx*(x - xm) / (xp - xm) - 0.5;
-	enzo_float ty = ny*(y - ym) / (yp - ym) - 0.5;
-
-	int ix0 = gx + floor(tx);
-	int iy0 = gy + floor(ty);
-
-	enzo_float x0 = 1.0 - (tx - floor(tx));
-	enzo_float y0 = 1.0 - (ty - floor(ty));
-
-	enzo_float x1 = 1.0 - x0;
-	enzo_float y1 = 1.0 - y0;
-
-	enzo_float * vf0 = vf+ix0+mx*iy0;
-	
-	vp[ip*da] = x0*(y0*vf0[i000] + y1*vf0[i010])
-	  +         x1*(y0*vf0[i100] + y1*vf0[i110]);
 
+    if (is_int) {
+      const double lower[3] = {xm,ym,zm};
+      const double upper[3] = {xp,yp,zp};
+      position_global.resize(3*np);
+      position_float.resize(3*np);
+      double * xd = position_global.data();
+      particle.position (it_p_,ib, xd, (rank >= 2) ? xd + np : nullptr,
+                         (rank >= 3) ? xd + 2*np : nullptr, lower,upper);
+      for (int i=0; i<rank*np; i++) position_float[i] = xd[i];
+      for (int axis=0; axis<rank; axis++) {
+        geometry.x[axis] = position_float.data() + axis*np;
       }
+      geometry.dp = 1;
     }
 
-  } else if (rank == 3) {
-
-    for (int ib=0; ib<nb; ib++) {
-
-      enzo_float * vp = (enzo_float*) particle.attribute_array(it_p_, ia_p_, ib);
-
-      const int np = particle.num_particles(it_p_,ib);
-
-      enzo_float * xa = (enzo_float *) particle.attribute_array (it_p_,ia_x,ib);
-      enzo_float * ya = (enzo_float *) particle.attribute_array (it_p_,ia_y,ib);
-      enzo_float * za = (enzo_float *) particle.attribute_array (it_p_,ia_z,ib);
-
-      enzo_float * vxa = lshift ?
-	(enzo_float *) particle.attribute_array (it_p_,ia_vx,ib) : nullptr;
-      enzo_float * vya = lshift ?
-	(enzo_float *) particle.attribute_array (it_p_,ia_vy,ib) : nullptr;
-      enzo_float * vza = lshift ?
-	(enzo_float *) particle.attribute_array (it_p_,ia_vz,ib) : nullptr;
-      
-      for (int ip=0; ip<np; ip++) {
-
-	enzo_float x = lshift ? xa[ip*dp] + dt_*vxa[ip*dv] : xa[ip*dp];
-	enzo_float y = lshift ? ya[ip*dp] + dt_*vya[ip*dv] : ya[ip*dp];
-	enzo_float z = lshift ? za[ip*dp] + dt_*vza[ip*dv] : za[ip*dp];
-
-	enzo_float tx = nx*(x - xm) / (xp - xm) - 0.5;
-	enzo_float ty = ny*(y - ym) / (yp - ym) - 0.5;
-	enzo_float tz = nz*(z - zm) / (zp - zm) - 0.5;
-
-	int ix0 = gx + floor(tx);
-	int iy0 = gy + floor(ty);
-	int iz0 = gz + floor(tz);
-
-	enzo_float x0 = 1.0 - (tx - floor(tx));
-	enzo_float y0 = 1.0 - (ty - floor(ty));
-	enzo_float z0 = 1.0 - (tz - floor(tz));
-
-	enzo_float x1 = 1.0 - x0;
-	enzo_float y1 = 1.0 - y0;
-	enzo_float z1 = 1.0 - z0;
-
-	enzo_float * vf0 = vf + ix0+mx*(iy0+my*iz0);
-
-	vp[ip*da] = x0*(y0*(z0*vf0[i000] + z1*vf0[i001]) +
-			y1*(z0*vf0[i010] + z1*vf0[i011])) 
-	  +         x1*(y0*(z0*vf0[i100] + z1*vf0[i101]) +
-			y1*(z0*vf0[i110] + z1*vf0[i111]));
-      }
-    }
+    enzo_pm::interpolate (assignment_, rank, vf, geometry, np, vp, da);
   }
-}  
-
+}
@@ -13,6 +13,9 @@ class EnzoComputeCicInterp : public Compute {
   /// @class    EnzoComputeCicInterp
   /// @ingroup  Enzo
   /// @brief    [\ref Enzo] Encapsulate CIC (Cloud-in-cell) particle-field interpolation
+  ///
+  /// NGP or TSC interpolation may be selected instead, which should
+  /// match the assignment scheme used for depositing particle mass.
 
 public: // interface
 
@@ -20,7 +23,8 @@ public: // interface
   EnzoComputeCicInterp (std::string field_name,
 			std::string particle_type,
 			std::string particle_attribute,
-			double dt = 0.0);
+			double dt = 0.0,
+			pm_assignment assignment = pm_assignment::cic);
 
   /// Charm++ PUP::able declarations
   PUPable_decl(EnzoComputeCicInterp);
@@ -31,7 +35,8 @@ public: // interface
       it_p_(0),
       ia_p_(0),
       if_(0),
-      dt_(0.0)
+      dt_(0.0),
+      assignment_(pm_assignment::cic)
   { }
 
   /// CHARM++ Pack / Unpack function
@@ -58,6 +63,9 @@ private: // attributes
   /// dt at which to apply the interpolation
   double dt_;
 
+  /// Interpolation scheme
+  pm_assignment assignment_;
+
 };
 
 #endif /* ENZO_ENZO_COMPUTE_CIC_INTERP_HPP */
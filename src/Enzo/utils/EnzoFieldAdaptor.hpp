@@ -71,6 +71,10 @@ namespace enzo_field_adaptor_detail {
     inline const enzo_float* ptr_grackle(const std::string& name) const noexcept
     { return array_map_.contains(name) ? array_map_[name].data() : nullptr; }
 
+    inline const enzo_float* ptr_grackle(const FieldHandle& handle)
+      const noexcept
+    { return ptr_grackle(handle.name()); }
+
     std::array<int,3> field_strides() const noexcept;
 
     void cell_width(double *hx, double *hy, double *hz) const noexcept
@@ -102,9 +106,30 @@ namespace enzo_field_adaptor_detail {
     }
 
     inline const enzo_float* ptr_grackle(const std::string& name) const noexcept
-    {
-      int id_field = field_.field_id(name);
+    { return ptr_grackle_(field_.field_id(name), name); }
+
+    inline const enzo_float* ptr_grackle(const FieldHandle& handle)
+      const noexcept
+    { return ptr_grackle_(handle.id(), handle.name()); }
+
+    std::array<int,3> field_strides() const noexcept;
+
+    void cell_width(double *hx, double *hy, double *hz) const noexcept
+    { block_->cell_width(hx, hy, hz); }
+
+    /// grid_start and grid_end will include the ghost zones
+    void grackle_field_grid_props(std::array<int,3>& grid_dimension,
+                                  std::array<int,3>& grid_start,
+                                  std::array<int,3>& grid_end) const noexcept;
+
+    double compute_time() const noexcept;
 
+  private:
+
+    inline const enzo_float* ptr_grackle_(int id_field,
+                                          const std::string& name)
+      const noexcept
+    {
       bool correct_prec;
       switch (field_.precision(id_field)){
         case precision_default:
@@ -130,19 +155,6 @@ namespace enzo_field_adaptor_detail {
       return (const enzo_float*)field_.values(id_field, index_history_);
     }
 
-    std::array<int,3> field_strides() const noexcept;
-
-    void cell_width(double *hx, double *hy, double *hz) const noexcept
-    { block_->cell_width(hx, hy, hz); }
-
-    /// grid_start and grid_end will include the ghost zones
-    void grackle_field_grid_props(std::array<int,3>& grid_dimension,
-                                  std::array<int,3>& grid_start,
-                                  std::array<int,3>& grid_end) const noexcept;
-
-    double compute_time() const noexcept;
-
-  private:
     Block* block_;
     Field field_;
     int index_history_;
@@ -268,20 +280,14 @@ public:
   /// header-inclusion order. This is totally fine since gr_float must be
   /// equivalent to enzo_float.
   inline enzo_float* ptr_for_grackle(const std::string& name,
-                                     bool require_exists = false) const{
-    const enzo_float* ptr;
-    if (holds_block_){
-      ptr = reinterpret_cast<BlockWrapper*>(wrapper_)->ptr_grackle(name);
-    } else {
-      ptr = reinterpret_cast<ArrayMapWrapper*>(wrapper_)->ptr_grackle(name);
-    }
+                                     bool require_exists = false) const
+  { return ptr_for_grackle_(name, name, require_exists); }
 
-    if ((ptr == nullptr) & (require_exists)){
-      ERROR1("EnzoFieldAdaptor::ptr_for_grackle",
-             "there is no array called \"%s\"", name.c_str());
-    }
-    return const_cast<enzo_float*>(ptr);
-  }
+  /// Same as above, but looks up the field id from a FieldHandle (this
+  /// avoids a search by name when wrapping a Block)
+  inline enzo_float* ptr_for_grackle(const FieldHandle& handle,
+                                     bool require_exists = false) const
+  { return ptr_for_grackle_(handle, handle.name(), require_exists); }
 
   /// Compute the grackle grid properties.
   ///
@@ -334,6 +340,24 @@ public:
 
 private:
 
+  /// Implements ptr_for_grackle for a field name or FieldHandle
+  template<class Key>
+  inline enzo_float* ptr_for_grackle_(const Key& key, const std::string& name,
+                                      bool require_exists) const{
+    const enzo_float* ptr;
+    if (holds_block_){
+      ptr = reinterpret_cast<BlockWrapper*>(wrapper_)->ptr_grackle(key);
+    } else {
+      ptr = reinterpret_cast<ArrayMapWrapper*>(wrapper_)->ptr_grackle(key);
+    }
+
+    if ((ptr == nullptr) & (require_exists)){
+      ERROR1("EnzoFieldAdaptor::ptr_for_grackle",
+             "there is no array called \"%s\"", name.c_str());
+    }
+    return const_cast<enzo_float*>(ptr);
+  }
+
   /// Specifies whether the instance holds a Field or EnzoEFltArrayMap
   bool holds_block_;
   /// Pointer to wrapper around the Field or EnzoEFltArrayMap
@@ -0,0 +1,64 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFieldStaging.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Implements the EnzoFieldStaging class
+
+#include "Enzo/utils/utils.hpp"
+#include "Cello/cello.hpp"
+#include "Enzo/enzo.hpp"
+
+//----------------------------------------------------------------------
+
+EnzoFieldStaging::EnzoFieldStaging(Block * block, int index_history)
+  : field_(block->data()->field()),
+    index_history_(index_history),
+    staged_()
+{
+  ASSERT("EnzoFieldStaging", "ghost zones must be allocated",
+         field_.ghosts_allocated());
+}
+
+//----------------------------------------------------------------------
+
+enzo_float * EnzoFieldStaging::values(int id_field, bool write) noexcept
+{
+  return view(id_field, write).data();
+}
+
+//----------------------------------------------------------------------
+
+EFlt3DArray EnzoFieldStaging::view(int id_field, bool write) noexcept
+{
+  if (field_.is_type<enzo_float>(id_field)) {
+    return field_.view<enzo_float>(id_field, ghost_choice::include,
+                                   index_history_);
+  }
+
+  for (Staged_ & staged : staged_) {
+    if (staged.id_field == id_field) {
+      staged.write |= write;
+      return staged.array;
+    }
+  }
+
+  int mx, my, mz;
+  field_.dimensions(id_field, &mx, &my, &mz);
+  EFlt3DArray array(mz, my, mx);
+  field_.copy_to_array(id_field, array.data(), index_history_);
+  staged_.push_back({id_field, write, array});
+  return array;
+}
+
+//----------------------------------------------------------------------
+
+void EnzoFieldStaging::write_back() noexcept
+{
+  for (const Staged_ & staged : staged_) {
+    if (staged.write) {
+      field_.copy_from_array(staged.id_field, staged.array.data(),
+                             index_history_);
+    }
+  }
+}
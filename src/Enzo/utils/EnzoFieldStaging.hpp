@@ -0,0 +1,72 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoFieldStaging.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Declaration of the EnzoFieldStaging class
+
+#ifndef ENZO_UTILS_ENZO_FIELD_STAGING_HPP
+#define ENZO_UTILS_ENZO_FIELD_STAGING_HPP
+
+class EnzoFieldStaging {
+
+  /// @class    EnzoFieldStaging
+  /// @ingroup  Enzo
+  /// @brief    [\ref Enzo] Provides enzo_float access to the fields of a
+  ///           Block, whatever precision they are stored in
+  ///
+  /// Fields may be stored with a precision other than that of enzo_float
+  /// (e.g. passive scalars and chemical species in single precision while
+  /// the conserved quantities are in double precision). Numerical kernels
+  /// operate on enzo_float arrays, so such fields are converted at the
+  /// kernel boundary: values() and view() return the field's own memory when
+  /// it already stores enzo_float values, and otherwise a staged enzo_float
+  /// copy of it. write_back() copies modified staged values back into the
+  /// fields, converting them to each field's precision.
+  ///
+  /// Fields are staged including their ghost zones, and each field is
+  /// staged at most once per instance.
+
+public: // interface
+
+  /// Create an EnzoFieldStaging for the fields of the given Block
+  EnzoFieldStaging(Block * block, int index_history = 0);
+
+  /// Return a pointer to the enzo_float values of a field (including
+  /// ghost zones). If write is true, staged values are copied back to the
+  /// field by write_back().
+  enzo_float * values(int id_field, bool write = true) noexcept;
+
+  /// Return a view of the enzo_float values of a field (including ghost
+  /// zones). If write is true, staged values are copied back to the field
+  /// by write_back().
+  EFlt3DArray view(int id_field, bool write = true) noexcept;
+
+  /// Copy staged values of fields that were requested for writing back
+  /// into their fields
+  void write_back() noexcept;
+
+  /// Return the number of fields that have been staged
+  int num_staged() const noexcept
+  { return staged_.size(); }
+
+private: // attributes
+
+  struct Staged_ {
+    int id_field;
+    bool write;
+    EFlt3DArray array;
+  };
+
+  /// Fields of the Block
+  Field field_;
+
+  /// The history index of the fields
+  int index_history_;
+
+  /// Staged copies of fields whose precision differs from enzo_float
+  std::vector<Staged_> staged_;
+
+};
+
+#endif /* ENZO_UTILS_ENZO_FIELD_STAGING_HPP */
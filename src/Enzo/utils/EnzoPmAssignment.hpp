@@ -0,0 +1,317 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     enzo_EnzoPmAssignment.hpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    [\ref Enzo] Particle-mesh assignment kernels (NGP, CIC, TSC)
+///
+/// Deposit particle quantities onto a grid, and interpolate grid values
+/// to particles, using nearest-grid-point (NGP), cloud-in-cell (CIC), or
+/// triangular-shaped-cloud (TSC) assignment.  Kernels are templated on
+/// precision, assignment order and rank.
+///
+/// Particles are processed in chunks.  Stencil indices and weights for
+/// all particles of a chunk are first computed in a loop with no
+/// dependencies between iterations, which the compiler can vectorize.
+/// Deposit then scatters each particle's contribution in order (there
+/// are no write conflicts within a single thread), and interpolation
+/// gathers grid values in a second vectorizable loop.
+
+#ifndef ENZO_UTILS_ENZO_PM_ASSIGNMENT_HPP
+#define ENZO_UTILS_ENZO_PM_ASSIGNMENT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+/// Particle-mesh assignment schemes, in increasing order of accuracy
+enum class pm_assignment { ngp = 0, cic = 1, tsc = 2 };
+
+namespace enzo_pm {
+
+  /// Return the pm_assignment corresponding to "ngp", "cic" or "tsc"
+  inline pm_assignment assignment_from_string (const std::string & name)
+  {
+    if (name == "ngp") return pm_assignment::ngp;
+    if (name == "cic") return pm_assignment::cic;
+    if (name == "tsc") return pm_assignment::tsc;
+    ERROR1 ("enzo_pm::assignment_from_string()",
+            "Unknown particle-mesh assignment \"%s\": "
+            "expecting \"ngp\", \"cic\" or \"tsc\"",
+            name.c_str());
+    return pm_assignment::cic;
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Number of particles per chunk
+  constexpr int chunk_size = 128;
+
+  /// Stencil width in cells along each axis for the given scheme
+  template <pm_assignment A>
+  constexpr int stencil_width ()
+  { return int(A) + 1; }
+
+  /// Compute the first stencil cell and the stencil weights along one
+  /// axis, given the particle coordinate t in cell widths relative to
+  /// the center of the first active cell
+  template <pm_assignment A, typename T>
+  FORCE_INLINE int stencil (double t, T * w, int k)
+  {
+    if constexpr (A == pm_assignment::ngp) {
+      w[k] = 1.0;
+      return (int) std::floor(t + 0.5);
+    } else if constexpr (A == pm_assignment::cic) {
+      const double f = std::floor(t);
+      w[k]            = 1.0 - (t - f);
+      w[k+chunk_size] = t - f;
+      return (int) f;
+    } else {
+      const double c = std::floor(t + 0.5);
+      const double d = t - c;
+      w[k]              = 0.5*(0.5 - d)*(0.5 - d);
+      w[k+chunk_size]   = 0.75 - d*d;
+      w[k+2*chunk_size] = 0.5*(0.5 + d)*(0.5 + d);
+      return (int) c - 1;
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Particle coordinates and grid geometry shared by the kernels
+  template <typename T>
+  struct PmGeometry {
+
+    /// Grid dimensions including ghost zones, and ghost depths
+    int mx, my, mz;
+    int gx, gy, gz;
+
+    /// Lower Block extents, and active cells per unit length
+    double lower[3];
+    double scale[3];
+
+    /// Particle position and (optional) velocity attribute arrays and
+    /// strides; positions are drifted by dt * velocity
+    const T * x[3];
+    const T * v[3];
+    int dp, dv;
+    double dt;
+  };
+
+  /// Compute flattened first stencil indices and weights for particles
+  /// [ip0,ip0+nc) of a batch
+  template <pm_assignment A, int RANK, typename T>
+  void stencils_ (const PmGeometry<T> & g, int ip0, int nc,
+                  int * index, T * weights)
+  {
+    constexpr int W = stencil_width<A>();
+    const int m3[3] = {1, g.mx, g.mx*g.my};
+    const int g3[3] = {g.gx, g.gy, g.gz};
+
+#pragma omp simd
+    for (int k=0; k<nc; k++) {
+      const int ip = ip0 + k;
+      int i = 0;
+      for (int axis=0; axis<RANK; axis++) {
+        double xa = g.x[axis][ip*g.dp];
+        if (g.v[axis]) xa += g.dt*g.v[axis][ip*g.dv];
+        const double t = (xa - g.lower[axis])*g.scale[axis] - 0.5;
+        const int i0 = g3[axis] + stencil<A>(t, weights + axis*W*chunk_size, k);
+        i += m3[axis]*i0;
+      }
+      index[k] = i;
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Deposit m[ip*dm]*scale onto the grid array de for particles
+  /// [0,np) of a batch.  Use dm = 0 for particles of constant mass.
+  template <pm_assignment A, int RANK, typename T>
+  void deposit (T * de, const PmGeometry<T> & g, int np,
+                const T * m, int dm, double scale)
+  {
+    constexpr int W = stencil_width<A>();
+    int index[chunk_size];
+    alignas(64) T w[3*W*chunk_size];
+    const T * wx = w;
+    const T * wy = w + W*chunk_size;
+    const T * wz = w + 2*W*chunk_size;
+    const int mx = g.mx;
+    const int mxy = g.mx*g.my;
+
+    for (int ip0=0; ip0<np; ip0+=chunk_size) {
+      const int nc = std::min(chunk_size,np-ip0);
+      stencils_<A,RANK,T>(g,ip0,nc,index,w);
+      for (int k=0; k<nc; k++) {
+        const T pm = m[(ip0+k)*dm]*scale;
+        T * d0 = de + index[k];
+        if constexpr (RANK == 1) {
+          for (int ax=0; ax<W; ax++)
+            d0[ax] += pm*wx[k+ax*chunk_size];
+        } else if constexpr (RANK == 2) {
+          for (int ay=0; ay<W; ay++) {
+            const T py = pm*wy[k+ay*chunk_size];
+            for (int ax=0; ax<W; ax++)
+              d0[ax+mx*ay] += py*wx[k+ax*chunk_size];
+          }
+        } else {
+          for (int az=0; az<W; az++) {
+            const T pz = pm*wz[k+az*chunk_size];
+            for (int ay=0; ay<W; ay++) {
+              const T py = pz*wy[k+ay*chunk_size];
+              for (int ax=0; ax<W; ax++)
+                d0[ax+mx*ay+mxy*az] += py*wx[k+ax*chunk_size];
+            }
+          }
+        }
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Gather the grid array vf to vp[(ip0+k)*da] for the nc particles
+  /// of a chunk, given their stencil indices and weights
+  template <pm_assignment A, int RANK, typename T>
+  FORCE_INLINE void gather_ (const T * vf, const PmGeometry<T> & g,
+                             int ip0, int nc,
+                             const int * index, const T * w,
+                             T * vp, int da)
+  {
+    constexpr int W = stencil_width<A>();
+    const T * wx = w;
+    const T * wy = w + W*chunk_size;
+    const T * wz = w + 2*W*chunk_size;
+    const int mx = g.mx;
+    const int mxy = g.mx*g.my;
+
+#pragma omp simd
+    for (int k=0; k<nc; k++) {
+      const T * v0 = vf + index[k];
+      T value = 0.0;
+      if constexpr (RANK == 1) {
+        for (int ax=0; ax<W; ax++)
+          value += wx[k+ax*chunk_size]*v0[ax];
+      } else if constexpr (RANK == 2) {
+        for (int ay=0; ay<W; ay++) {
+          T vy = 0.0;
+          for (int ax=0; ax<W; ax++)
+            vy += wx[k+ax*chunk_size]*v0[ax+mx*ay];
+          value += wy[k+ay*chunk_size]*vy;
+        }
+      } else {
+        for (int az=0; az<W; az++) {
+          T vz = 0.0;
+          for (int ay=0; ay<W; ay++) {
+            T vy = 0.0;
+            for (int ax=0; ax<W; ax++)
+              vy += wx[k+ax*chunk_size]*v0[ax+mx*ay+mxy*az];
+            vz += wy[k+ay*chunk_size]*vy;
+          }
+          value += wz[k+az*chunk_size]*vz;
+        }
+      }
+      vp[(ip0+k)*da] = value;
+    }
+  }
+
+  /// Interpolate the grid array vf to vp[ip*dv] for particles [0,np)
+  /// of a batch
+  template <pm_assignment A, int RANK, typename T>
+  void interpolate (const T * vf, const PmGeometry<T> & g, int np,
+                    T * vp, int da)
+  {
+    constexpr int W = stencil_width<A>();
+    int index[chunk_size];
+    alignas(64) T w[3*W*chunk_size];
+
+    for (int ip0=0; ip0<np; ip0+=chunk_size) {
+      const int nc = std::min(chunk_size,np-ip0);
+      stencils_<A,RANK,T>(g,ip0,nc,index,w);
+      gather_<A,RANK,T>(vf,g,ip0,nc,index,w,vp,da);
+    }
+  }
+
+  /// Interpolate the grid arrays vf[axis] to va[axis][ip*da] for each
+  /// axis < RANK, computing stencils once per particle.  After each
+  /// chunk, chunk_done(ip0,nc) is called so that the caller can use
+  /// the interpolated values while the chunk is still in cache, e.g.
+  /// to update particle positions and velocities
+  template <pm_assignment A, int RANK, typename T, typename F>
+  void interpolate_vector (const T * const vf[3], const PmGeometry<T> & g,
+                           int np, T * const va[3], int da, F && chunk_done)
+  {
+    constexpr int W = stencil_width<A>();
+    int index[chunk_size];
+    alignas(64) T w[3*W*chunk_size];
+
+    for (int ip0=0; ip0<np; ip0+=chunk_size) {
+      const int nc = std::min(chunk_size,np-ip0);
+      stencils_<A,RANK,T>(g,ip0,nc,index,w);
+      for (int axis=0; axis<RANK; axis++) {
+        gather_<A,RANK,T>(vf[axis],g,ip0,nc,index,w,va[axis],da);
+      }
+      chunk_done(ip0,nc);
+    }
+  }
+
+  //----------------------------------------------------------------------
+
+  /// Dispatch deposit() on run-time assignment scheme and rank
+  template <typename T>
+  void deposit (pm_assignment a, int rank,
+                T * de, const PmGeometry<T> & g, int np,
+                const T * m, int dm, double scale)
+  {
+#define PM_DEPOSIT(A,R)                                         \
+    if (a == A && rank == R) { deposit<A,R,T>(de,g,np,m,dm,scale); return; }
+    PM_DEPOSIT(pm_assignment::ngp,1); PM_DEPOSIT(pm_assignment::ngp,2);
+    PM_DEPOSIT(pm_assignment::ngp,3); PM_DEPOSIT(pm_assignment::cic,1);
+    PM_DEPOSIT(pm_assignment::cic,2); PM_DEPOSIT(pm_assignment::cic,3);
+    PM_DEPOSIT(pm_assignment::tsc,1); PM_DEPOSIT(pm_assignment::tsc,2);
+    PM_DEPOSIT(pm_assignment::tsc,3);
+#undef PM_DEPOSIT
+  }
+
+  /// Dispatch interpolate() on run-time assignment scheme and rank
+  template <typename T>
+  void interpolate (pm_assignment a, int rank,
+                    const T * vf, const PmGeometry<T> & g, int np,
+                    T * vp, int da)
+  {
+#define PM_INTERPOLATE(A,R)                                     \
+    if (a == A && rank == R) { interpolate<A,R,T>(vf,g,np,vp,da); return; }
+    PM_INTERPOLATE(pm_assignment::ngp,1); PM_INTERPOLATE(pm_assignment::ngp,2);
+    PM_INTERPOLATE(pm_assignment::ngp,3); PM_INTERPOLATE(pm_assignment::cic,1);
+    PM_INTERPOLATE(pm_assignment::cic,2); PM_INTERPOLATE(pm_assignment::cic,3);
+    PM_INTERPOLATE(pm_assignment::tsc,1); PM_INTERPOLATE(pm_assignment::tsc,2);
+    PM_INTERPOLATE(pm_assignment::tsc,3);
+#undef PM_INTERPOLATE
+  }
+
+  /// Dispatch interpolate_vector() on run-time assignment scheme and rank
+  template <typename T, typename F>
+  void interpolate_vector (pm_assignment a, int rank,
+                           const T * const vf[3], const PmGeometry<T> & g,
+                           int np, T * const va[3], int da, F && chunk_done)
+  {
+#define PM_INTERPOLATE_VECTOR(A,R)                                      \
+    if (a == A && rank == R) {                                          \
+      interpolate_vector<A,R,T>(vf,g,np,va,da,chunk_done); return;      \
+    }
+    PM_INTERPOLATE_VECTOR(pm_assignment::ngp,1);
+    PM_INTERPOLATE_VECTOR(pm_assignment::ngp,2);
+    PM_INTERPOLATE_VECTOR(pm_assignment::ngp,3);
+    PM_INTERPOLATE_VECTOR(pm_assignment::cic,1);
+    PM_INTERPOLATE_VECTOR(pm_assignment::cic,2);
+    PM_INTERPOLATE_VECTOR(pm_assignment::cic,3);
+    PM_INTERPOLATE_VECTOR(pm_assignment::tsc,1);
+    PM_INTERPOLATE_VECTOR(pm_assignment::tsc,2);
+    PM_INTERPOLATE_VECTOR(pm_assignment::tsc,3);
+#undef PM_INTERPOLATE_VECTOR
+  }
+
+}
+
+#endif /* ENZO_UTILS_ENZO_PM_ASSIGNMENT_HPP */
@@ -0,0 +1,173 @@
+// See LICENSE_CELLO file for license and copyright information
+
+/// @file     test_EnzoPmAssignment.cpp
+/// @author   James Bordner (jobordner@ucsd.edu)
+/// @date     2026-10-14
+/// @brief    Test program for the enzo_pm particle-mesh assignment kernels
+///
+/// Checks that NGP, CIC and TSC deposit conserve mass, that CIC and
+/// TSC interpolation reproduce linear fields exactly, and that CIC
+/// deposit agrees with the Fortran cic_deposit() routine.  Also
+/// reports particles per second for each kernel and for the Fortran
+/// routine.
+
+#include "test.hpp"
+#include "main.hpp"
+#include "enzo.hpp"
+
+extern "C" void FORTRAN_NAME(cic_deposit)
+  ( enzo_float * px, enzo_float * py, enzo_float * pz, const int * rank,
+    const int * np, enzo_float * mass, enzo_float * field,
+    enzo_float * left_edge, int * mx, int * my, int * mz,
+    double * hx, const double * cloudsize );
+
+//----------------------------------------------------------------------
+
+/// Active cells along each axis, ghost depth, and number of particles
+const int n = 32, g = 3, m = n + 2*g;
+const int num_particles = 1 << 18;
+
+//----------------------------------------------------------------------
+
+void init_geometry (enzo_pm::PmGeometry<enzo_float> & geometry,
+                    std::vector<enzo_float> x3[3])
+{
+  geometry.mx = geometry.my = geometry.mz = m;
+  geometry.gx = geometry.gy = geometry.gz = g;
+  for (int axis=0; axis<3; axis++) {
+    geometry.lower[axis] = 0.0;
+    geometry.scale[axis] = n;
+    geometry.x[axis] = x3[axis].data();
+    geometry.v[axis] = nullptr;
+  }
+  geometry.dp = 1;
+  geometry.dv = 1;
+  geometry.dt = 0.0;
+}
+
+//----------------------------------------------------------------------
+
+double linear (double x, double y, double z)
+{ return 1.0 + 2.0*x - 3.0*y + 0.5*z; }
+
+//----------------------------------------------------------------------
+
+void test_assignment (pm_assignment a, const char * name,
+                      const enzo_pm::PmGeometry<enzo_float> & geometry,
+                      std::vector<enzo_float> x3[3])
+{
+  const enzo_float mass = 1.0;
+
+  // deposit
+
+  std::vector<enzo_float> de (m*m*m, 0.0);
+  Timer timer;
+  timer.start();
+  enzo_pm::deposit (a,3,de.data(),geometry,num_particles,&mass,0,1.0);
+  const double time_deposit = timer.stop();
+
+  double sum = 0.0;
+  for (size_t i=0; i<de.size(); i++) sum += de[i];
+
+  unit_func ("deposit()");
+  unit_assert (cello::err_rel(sum,(double)num_particles) < 1e-5);
+
+  // interpolate
+
+  std::vector<enzo_float> vf (m*m*m);
+  for (int iz=0; iz<m; iz++) {
+    for (int iy=0; iy<m; iy++) {
+      for (int ix=0; ix<m; ix++) {
+        vf[ix+m*(iy+m*iz)] = linear ((ix-g+0.5)/n,(iy-g+0.5)/n,(iz-g+0.5)/n);
+      }
+    }
+  }
+  std::vector<enzo_float> vp (num_particles);
+  timer.clear();
+  timer.start();
+  enzo_pm::interpolate (a,3,vf.data(),geometry,num_particles,vp.data(),1);
+  const double time_interpolate = timer.stop();
+
+  if (a != pm_assignment::ngp) {
+    double err = 0.0;
+    for (int ip=0; ip<num_particles; ip++) {
+      const double e = linear (x3[0][ip],x3[1][ip],x3[2][ip]);
+      err = std::max(err,std::abs(vp[ip] - e));
+    }
+    unit_func ("interpolate()");
+    unit_assert (err < 1e-5);
+  }
+
+  char bench[80];
+  snprintf (bench,sizeof(bench),"%s/deposit",name);
+  unit_bench (bench, num_particles / time_deposit, "particles/s");
+  snprintf (bench,sizeof(bench),"%s/interpolate",name);
+  unit_bench (bench, num_particles / time_interpolate, "particles/s");
+}
+
+//======================================================================
+
+PARALLEL_MAIN_BEGIN
+{
+
+  PARALLEL_INIT;
+
+  unit_init(0,1);
+
+  unit_class ("enzo_pm");
+
+  // random particle positions in the unit cube
+
+  std::vector<enzo_float> x3[3];
+  srand(31415);
+  for (int axis=0; axis<3; axis++) {
+    x3[axis].resize(num_particles);
+    for (int ip=0; ip<num_particles; ip++) {
+      x3[axis][ip] = (rand() + 0.5) / (RAND_MAX + 1.0);
+    }
+  }
+
+  enzo_pm::PmGeometry<enzo_float> geometry;
+  init_geometry (geometry,x3);
+
+  test_assignment (pm_assignment::ngp,"ngp",geometry,x3);
+  test_assignment (pm_assignment::cic,"cic",geometry,x3);
+  test_assignment (pm_assignment::tsc,"tsc",geometry,x3);
+
+  // compare CIC with the Fortran cic_deposit() routine
+
+  std::vector<enzo_float> de_c (m*m*m, 0.0);
+  std::vector<enzo_float> de_f (m*m*m, 0.0);
+  std::vector<enzo_float> mass (num_particles, 1.0);
+
+  enzo_pm::deposit (pm_assignment::cic,3,de_c.data(),geometry,
+                    num_particles,mass.data(),1,1.0);
+
+  const int rank = 3;
+  int mx = m, my = m, mz = m;
+  double h = 1.0 / n;
+  enzo_float left_edge[3] = {enzo_float(-g*h),enzo_float(-g*h),enzo_float(-g*h)};
+
+  Timer timer;
+  timer.start();
+  FORTRAN_NAME(cic_deposit)
+    (x3[0].data(),x3[1].data(),x3[2].data(),&rank,&num_particles,
+     mass.data(),de_f.data(),left_edge,&mx,&my,&mz,&h,&h);
+  const double time_fortran = timer.stop();
+
+  double err = 0.0;
+  for (size_t i=0; i<de_c.size(); i++) {
+    err = std::max(err,(double)std::abs(de_c[i]-de_f[i]));
+  }
+  unit_func ("deposit() vs cic_deposit()");
+  unit_assert (err < 1e-4 * num_particles / (n*n*n));
+
+  unit_bench ("cic_deposit.F/deposit", num_particles / time_fortran,
+              "particles/s");
+
+  unit_finalize();
+
+  exit_();
+}
+
+PARALLEL_MAIN_END
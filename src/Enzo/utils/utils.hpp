@@ -35,8 +35,10 @@
 //----------------------------------------------------------------------
 
 #include "utils/EnzoCenteredFieldRegistry.hpp"
+#include "utils/EnzoPmAssignment.hpp"
 #include "utils/EnzoComputeCicInterp.hpp"
 #include "utils/EnzoFieldAdaptor.hpp"
+#include "utils/EnzoFieldStaging.hpp"
 #include "utils/EnzoPermutedCoordinates.hpp"
 
 //----------------------------------------------------------------------
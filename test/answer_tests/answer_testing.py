@@ -14,6 +14,9 @@ from yt.funcs import ensure_dir
 from yt.testing import assert_rel_equal
 
 from test_utils.enzoe_driver import EnzoEDriver
+from test_utils.performance import \
+    parse_performance, compare_performance, performance_fname, \
+    read_performance, write_performance
 
 _base_file = os.path.basename(__file__)
 
@@ -24,6 +27,8 @@ class TestOptions:
     generate_results: bool
     test_results_dir: str
     grackle_input_data_dir : Optional[str]
+    perf_results_dir : Optional[str] = None
+    perf_tolerance : float = 0.25
 
 _CACHED_OPTS = None
 
@@ -50,6 +55,15 @@ def set_cached_opts(**kwargs):
             "grackle input data dir not found: "
             f"{_CACHED_OPTS.grackle_input_data_dir}")
 
+    if _CACHED_OPTS.perf_results_dir is not None:
+        yt.mylog.info(f"{_base_file}: perf_results_dir = "
+                      f"{_CACHED_OPTS.perf_results_dir}")
+        if _CACHED_OPTS.generate_results:
+            ensure_dir(_CACHED_OPTS.perf_results_dir)
+        elif not os.path.exists(_CACHED_OPTS.perf_results_dir):
+            raise RuntimeError("Performance results dir not found: "
+                               f"{_CACHED_OPTS.perf_results_dir}.")
+
     yt.mylog.info(
         f"{_base_file}: use_double = {_CACHED_OPTS.uses_double_prec}")
 
@@ -64,6 +78,13 @@ input_dir = "input"
 
 _grackle_tagged_tests = set()
 
+# maps the name of each test class whose performance regressed to a list of
+# descriptions of the regressions (reported by conftest.py)
+_perf_regressions = {}
+
+def perf_regressions():
+    return _perf_regressions
+
 def uses_grackle(cls):
     """
     Decorator that annotates that a test class uses grackle
@@ -109,10 +130,41 @@ class EnzoETest(TestCase):
 
         self.setup_symlinks()
         os.chdir(self.tmpdir)
-        cached_opts().enzoe_driver.run(
+        record_perf = cached_opts().perf_results_dir is not None
+        walltime = cached_opts().enzoe_driver.run(
             parameter_fname = os.path.join(input_dir, self.parameter_file),
             max_runtime = self.max_runtime, ncpus = self.ncpus,
-            sim_name = f"Simulation {self.__class__.__name__}")
+            sim_name = f"Simulation {self.__class__.__name__}",
+            buffer_outputs_on_disk = record_perf)
+        if record_perf:
+            self.check_performance(walltime)
+
+    def check_performance(self, walltime):
+        """
+        Store or compare the performance of the simulation just run
+
+        The simulation's output is parsed from log.out, which is echoed so
+        that it remains visible with ``pytest -s``.
+        """
+        with open('log.out', 'r') as f:
+            lines = f.readlines()
+        print(''.join(lines), end = '')
+
+        name = self.__class__.__name__
+        summary = parse_performance(lines, walltime = walltime)
+        fname = performance_fname(cached_opts().perf_results_dir, name)
+        if cached_opts().generate_results:
+            write_performance(fname, summary)
+        elif not os.path.exists(fname):
+            yt.mylog.warning(f"{_base_file}: no performance baseline {fname}")
+        else:
+            regressions = compare_performance(
+                read_performance(fname), summary,
+                cached_opts().perf_tolerance)
+            if len(regressions) > 0:
+                _perf_regressions[name] = regressions
+            else:
+                _perf_regressions.pop(name, None)
 
     def tearDown(self):
         os.chdir(self.curdir)
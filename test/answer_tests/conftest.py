@@ -6,7 +6,7 @@ import sys
 
 import pytest
 
-from answer_testing import set_cached_opts, cached_opts
+from answer_testing import set_cached_opts, cached_opts, perf_regressions
 from test_utils.enzoe_driver import EnzoEDriver
 from test_utils.parse_cmake_cache import parse_cmake_cache
 
@@ -45,6 +45,24 @@ _CONFIG_OPTIONS = {
         help = "Indicates whether to generate test results.",
         other_argparse_kwargs = dict(action = "store_const", const = True),
         coerce_env_val = lambda s: s.lower() == "true"
+    ),
+    "--perf-dir" : _ConfigParam(
+        env_var = "PERF_RESULTS_DIR",
+        default = None,
+        help = ("Path to directory where performance baselines (walltime, "
+                "time spent in each Performance region and peak memory) "
+                "are/will be stored. Performance is not recorded if this "
+                "isn't specified."),
+        other_argparse_kwargs = dict(action = "store"),
+        coerce_env_val = lambda s: s
+    ),
+    "--perf-tolerance" : _ConfigParam(
+        env_var = "PERF_TOLERANCE",
+        default = 0.25,
+        help = ("Largest relative increase over the performance baseline "
+                "that isn't reported as a regression."),
+        other_argparse_kwargs = dict(action = "store", type = float),
+        coerce_env_val = float
     )
 }
 
@@ -158,7 +176,9 @@ def pytest_configure(config):
         uses_double_prec = enzoe_driver.query_uses_double_precision(),
         generate_results = vals['answer_store'],
         test_results_dir = _to_abs_path(vals['local_dir']),
-        grackle_input_data_dir = _to_abs_path(vals['grackle_input_data_dir'])
+        grackle_input_data_dir = _to_abs_path(vals['grackle_input_data_dir']),
+        perf_results_dir = _to_abs_path(vals['perf_dir']),
+        perf_tolerance = vals['perf_tolerance']
     )
 
 
@@ -182,3 +202,20 @@ def pytest_report_header(config):
     ))
 
     return part1 + part2
+
+
+# hook for listing performance regressions at the end of the test report
+def pytest_terminal_summary(terminalreporter, exitstatus, config):
+    regressions = perf_regressions()
+    if len(regressions) == 0:
+        return
+    terminalreporter.section("performance regressions", red = True)
+    for name, descriptions in sorted(regressions.items()):
+        for description in descriptions:
+            terminalreporter.line(f"REGRESSION {name} {description}")
+
+
+# performance regressions fail the session, like failed tests
+def pytest_sessionfinish(session, exitstatus):
+    if (exitstatus == 0) and len(perf_regressions()) > 0:
+        session.exitstatus = 1
@@ -178,11 +178,13 @@ class EnzoEDriver:
 
             if proc.returncode != 0:
                 if buffer_outputs_on_disk:
-                    print("Dumpting stdout:")
-                    for line in f_out.seek(0):
+                    print("Dumping stdout:")
+                    f_out.seek(0)
+                    for line in f_out:
                         print(line, end = '')
-                    print("Dumpting stderr:")
-                    for line in f_err.seek(0):
+                    print("Dumping stderr:")
+                    f_err.seek(0)
+                    for line in f_err:
                         print(line, end = '')
 
                 raise RuntimeError(
@@ -0,0 +1,98 @@
+import json
+import os.path
+
+# Regions whose baseline time is below this are too short to time reliably,
+# so they are never flagged as regressions
+_MIN_REGION_USEC = 100000
+
+def parse_performance(lines, walltime = None):
+    """
+    Extract a performance summary from the output of an Enzo-E simulation
+
+    Enzo-E periodically prints lines like
+
+        0 00012.34 Performance <region> <counter> <value>
+
+    where relative counters (e.g. "time-usec") accumulate since the start of
+    the simulation and are summed over processes, so the last value printed
+    for each region is kept.
+
+    Parameters
+    ----------
+    lines: iterable of str
+        Lines of the simulation's stdout
+    walltime: float, optional
+        Elapsed time of the simulation in seconds, as measured by the caller
+
+    Returns
+    -------
+    out: dict
+        Holds "walltime" (seconds), "regions" (mapping each Performance region
+        to its time-usec counter) and "bytes-highest" (peak memory tracked by
+        Cello's Memory class, or None if it wasn't reported)
+    """
+    regions = {}
+    bytes_highest = None
+    for line in lines:
+        words = line.split()
+        if len(words) != 6 or words[2] != 'Performance':
+            continue
+        region, counter, value = words[3:]
+        try:
+            value = int(value)
+        except ValueError:
+            continue
+        if counter == 'time-usec':
+            regions[region] = value
+        elif counter == 'bytes-highest' and region == 'cycle' and value > 0:
+            bytes_highest = value
+    return {"walltime" : walltime,
+            "regions" : regions,
+            "bytes-highest" : bytes_highest}
+
+def compare_performance(baseline, current, tolerance):
+    """
+    Compare two performance summaries returned by parse_performance
+
+    Parameters
+    ----------
+    baseline, current: dict
+    tolerance: float
+        Largest allowed relative increase of any quantity over its baseline
+
+    Returns
+    -------
+    out: list of str
+        Describes each quantity that increased by more than tolerance. An
+        empty list indicates there was no regression.
+    """
+    regressions = []
+
+    def _check(name, old, new, scale = 1.0, unit = ''):
+        if (old is None) or (new is None) or (old <= 0):
+            return
+        if new > old * (1.0 + tolerance):
+            regressions.append(
+                f"{name}: {new*scale:.3f}{unit} vs baseline "
+                f"{old*scale:.3f}{unit} (+{100.0*(new/old - 1.0):.1f}%)")
+
+    _check("walltime", baseline["walltime"], current["walltime"],
+           unit = ' s')
+    for region, old in sorted(baseline["regions"].items()):
+        if old >= _MIN_REGION_USEC:
+            _check(f"region {region}", old, current["regions"].get(region),
+                   scale = 1e-6, unit = ' s')
+    _check("bytes-highest", baseline["bytes-highest"],
+           current["bytes-highest"], scale = 1.0/(1 << 20), unit = ' MiB')
+    return regressions
+
+def performance_fname(perf_dir, test_name):
+    return os.path.join(perf_dir, f"{test_name}.perf.json")
+
+def write_performance(fname, summary):
+    with open(fname, 'w') as f:
+        json.dump(summary, f, indent = 2, sort_keys = True)
+
+def read_performance(fname):
+    with open(fname, 'r') as f:
+        return json.load(f)
@@ -0,0 +1,265 @@
+#!/usr/bin/env python3
+
+# Recommend a Block size and process counts for a problem from short
+# calibration probes at several Block sizes and ghost depths.
+#
+#    calibrate.py generate <parameter-file> --root-size N [N N]
+#                          [--block-sizes S [S ...]] [--ghost-depths G [G ...]]
+#                          [--cycles C] [--prefix DIR]
+#
+#    calibrate.py fit <output> [<output> ...] --root-size N [N N]
+#                     [--probe-root-size N [N N]] [--procs P [P ...]]
+#                     [--min-blocks-per-proc B] [--efficiency E]
+#                     [--skip S] [--model FILE]
+#
+# Each probe includes the given parameter file and overrides only
+# Mesh:root_blocks, Field:ghost_depth, and Stopping:cycle, so run it
+# with the same Adapt settings as production (max_level 0 gives the
+# cleanest model).  The fit models the wall time per cycle on each
+# process as
+#
+#    t = a * cells + b * ghost_cells + c * blocks + d * log2(procs)
+#
+# where cells and ghost_cells are the interior and ghost zones of the
+# Blocks on a process; a is the inverse kernel rate, b the cost of
+# refreshing a ghost zone, c the fixed overhead per Block, and d a
+# synchronization cost fitted only if the probes were run on more
+# than one process count.  The model and the recommendation are
+# written to calibration.out, next to the parameters.out dump of the
+# probe runs.
+
+import argparse
+import math
+import os
+import re
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from scaling import parse
+
+#----------------------------------------------------------------------
+
+def probe_name(size, ghost):
+    return 'calibrate-b{}-g{}'.format(size, ghost)
+
+def generate(args):
+    for size in args.block_sizes:
+        if any(n % size for n in args.root_size):
+            print('skipping block size {}: does not divide root size {}'
+                  .format(size, args.root_size))
+            continue
+        blocks = [n // size for n in args.root_size]
+        for ghost in args.ghost_depths:
+            path = os.path.join(args.prefix,
+                                probe_name(size, ghost) + '.in')
+            with open(path, 'w') as fp:
+                fp.write('# Problem: calibration probe of {} with {}^{} '
+                         'Blocks and ghost depth {}\n'
+                         .format(args.parameter_file, size,
+                                 len(args.root_size), ghost))
+                fp.write('#          (generated by tools/calibrate.py)'
+                         '\n\n')
+                fp.write('include "{}"\n\n'.format(args.parameter_file))
+                fp.write('Mesh {{ root_size = [{}]; root_blocks = [{}]; }}'
+                         '\n\n'.format(', '.join(map(str, args.root_size)),
+                                       ', '.join(map(str, blocks))))
+                fp.write('Field {{ ghost_depth = {}; }}\n\n'.format(ghost))
+                fp.write('Stopping {{ cycle = {}; }}\n'.format(args.cycles))
+            print('{}: root_blocks {}'.format(path, blocks))
+
+#----------------------------------------------------------------------
+
+re_probe = re.compile(r'calibrate-b(\d+)-g(\d+)')
+
+def features(block_size, ghost, rank, blocks_per_proc, procs):
+    """Return the model terms of one process"""
+    cells = block_size**rank
+    total = (block_size + 2*ghost)**rank
+    return [blocks_per_proc * cells, blocks_per_proc * (total - cells),
+            blocks_per_proc, math.log2(procs)]
+
+def solve(rows, values, num_terms):
+    """Least squares fit of values to the first num_terms of rows"""
+    a = [[sum(r[i]*r[j] for r in rows) for j in range(num_terms)]
+         for i in range(num_terms)]
+    b = [sum(r[i]*v for r, v in zip(rows, values))
+         for i in range(num_terms)]
+    # Gaussian elimination with partial pivoting
+    for k in range(num_terms):
+        p = max(range(k, num_terms), key = lambda i : abs(a[i][k]))
+        a[k], a[p] = a[p], a[k]
+        b[k], b[p] = b[p], b[k]
+        if a[k][k] == 0.0:
+            sys.exit('calibration probes do not determine the model: '
+                     'use more block sizes or ghost depths')
+        for i in range(k+1, num_terms):
+            f = a[i][k] / a[k][k]
+            for j in range(k, num_terms):
+                a[i][j] -= f * a[k][j]
+            b[i] -= f * b[k]
+    x = [0.0] * num_terms
+    for k in reversed(range(num_terms)):
+        x[k] = (b[k] - sum(a[k][j]*x[j]
+                           for j in range(k+1, num_terms))) / a[k][k]
+    return x
+
+def probe(file_name, skip, root_size):
+    m = re_probe.search(os.path.basename(file_name))
+    if not m:
+        sys.exit('{}: not a calibrate-b<size>-g<ghost> output'
+                 .format(file_name))
+    block_size, ghost = int(m.group(1)), int(m.group(2))
+    procs, cycles, regions, messages = parse(file_name)
+    if len(cycles) < skip + 2:
+        sys.exit('{}: {} cycles is too few to skip {}'
+                 .format(file_name, len(cycles), skip))
+    num_cycles = cycles[-1][0] - cycles[skip][0]
+    time = (cycles[-1][1] - cycles[skip][1]) / num_cycles
+    # region counters are summed over processes
+    def region_time(names):
+        t = 0
+        for name in names:
+            r0 = regions[skip].get(name)
+            r1 = regions[-1].get(name)
+            if r0 is not None and r1 is not None: t += r1 - r0
+        return 1e-6 * t / (procs * num_cycles)
+    num_blocks = 1
+    for n in root_size: num_blocks *= n // block_size
+    return { 'file' : file_name, 'block_size' : block_size,
+             'ghost' : ghost, 'procs' : procs,
+             'blocks_per_proc' : num_blocks / procs, 'time' : time,
+             'compute' : region_time(['compute']),
+             'refresh' : region_time(['refresh_store', 'refresh_child',
+                                      'refresh_exit']) }
+
+def predict(model, block_size, ghost, rank, blocks_per_proc, procs):
+    return sum(c * f for c, f in zip
+               (model, features(block_size, ghost, rank,
+                                blocks_per_proc, procs)))
+
+def fit(args):
+    rank = len(args.root_size)
+    probe_root_size = args.probe_root_size or args.root_size
+    probes = [probe(f, args.skip, probe_root_size) for f in args.files]
+    rows = [features(p['block_size'], p['ghost'], rank,
+                     p['blocks_per_proc'], p['procs']) for p in probes]
+    num_terms = 4 if len(set(p['procs'] for p in probes)) > 1 else 3
+    model = solve(rows, [p['time'] for p in probes], num_terms)
+    model += [0.0] * (4 - num_terms)
+
+    lines = []
+    lines.append('# calibration model: seconds per cycle per process')
+    lines.append('cell        {:.6e}'.format(model[0]))
+    lines.append('ghost-cell  {:.6e}'.format(model[1]))
+    lines.append('block       {:.6e}'.format(model[2]))
+    lines.append('log2-procs  {:.6e}'.format(model[3]))
+    if model[0] > 0.0:
+        lines.append('# kernel rate {:.3e} cells per second'
+                     .format(1.0 / model[0]))
+    lines.append('')
+    lines.append('# probes: measured and modeled time per cycle, and '
+                 'compute and refresh region rates')
+    lines.append('{:>6} {:>6} {:>6} {:>8} {:>12} {:>12} {:>14} {:>14}'
+                 .format('block', 'ghost', 'procs', 'blocks', 'time',
+                         'model', 'cells/sec', 'usec/ghost'))
+    for p, r in zip(probes, rows):
+        t = predict(model, p['block_size'], p['ghost'], rank,
+                    p['blocks_per_proc'], p['procs'])
+        rate = r[0] / p['compute'] if p['compute'] > 0 else 0.0
+        ghost_cost = 1e6 * p['refresh'] / r[1] if r[1] > 0 else 0.0
+        lines.append('{:>6d} {:>6d} {:>6d} {:>8.1f} {:>12.6f} {:>12.6f} '
+                     '{:>14.3e} {:>14.3e}'.format
+                     (p['block_size'], p['ghost'], p['procs'],
+                      p['blocks_per_proc'], p['time'], t, rate,
+                      ghost_cost))
+
+    # recommended Block size for each process count, keeping at
+    # least min_blocks_per_proc Blocks per process for parallel slack
+
+    ghost = min(p['ghost'] for p in probes)
+    sizes = sorted(set(s for s in range(4, min(args.root_size) + 1)
+                       if all(n % s == 0 for n in args.root_size)))
+    lines.append('')
+    lines.append('# recommendation for root_size {} with ghost depth {} '
+                 'and at least {} Blocks per process'.format
+                 (args.root_size, ghost, args.min_blocks_per_proc))
+    lines.append('{:>6} {:>6} {:>8} {:>12} {:>10}'.format
+                 ('procs', 'block', 'blocks', 'time', 'efficiency'))
+    base = None
+    recommended = None
+    for procs in sorted(args.procs):
+        best = None
+        for s in sizes:
+            num_blocks = 1
+            for n in args.root_size: num_blocks *= n // s
+            blocks_per_proc = num_blocks / procs
+            if blocks_per_proc < args.min_blocks_per_proc: continue
+            t = predict(model, s, ghost, rank, blocks_per_proc, procs)
+            if best is None or t < best[1]:
+                best = (s, t, blocks_per_proc)
+        if best is None:
+            lines.append('{:>6d} {:>6} {:>8} {:>12} {:>10}'.format
+                         (procs, '-', '-', '-', '-'))
+            continue
+        if base is None: base = (procs, best[1])
+        efficiency = (base[0] * base[1]) / (procs * best[1])
+        if efficiency >= args.efficiency: recommended = (procs, best[0])
+        lines.append('{:>6d} {:>6d} {:>8.1f} {:>12.6f} {:>10.3f}'.format
+                     (procs, best[0], best[2], best[1], efficiency))
+    if recommended:
+        lines.append('# recommended: {} processes with {}^{} Blocks '
+                     '(largest process count with efficiency >= {})'
+                     .format(recommended[0], recommended[1], rank,
+                             args.efficiency))
+
+    text = '\n'.join(lines) + '\n'
+    print(text, end='')
+    with open(args.model, 'w') as fp:
+        fp.write(text)
+
+#----------------------------------------------------------------------
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Calibrate an Enzo-E performance model and recommend '
+        'a Block size')
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    g = sub.add_parser('generate', help='write probe parameter files')
+    g.add_argument('parameter_file', help='problem parameter file to include')
+    g.add_argument('--root-size', type=int, nargs='+', required=True,
+                   help='root cells along each axis of the probes')
+    g.add_argument('--block-sizes', type=int, nargs='+',
+                   default=[8, 16, 32])
+    g.add_argument('--ghost-depths', type=int, nargs='+', default=[3, 4])
+    g.add_argument('--cycles', type=int, default=10)
+    g.add_argument('--prefix', default='.',
+                   help='directory for the parameter files')
+    g.set_defaults(func=generate)
+
+    f = sub.add_parser('fit', help='fit the model to probe output')
+    f.add_argument('files', nargs='+', help='enzo-e output of the probes')
+    f.add_argument('--root-size', type=int, nargs='+', required=True,
+                   help='root cells along each axis of the problem '
+                   'to recommend for')
+    f.add_argument('--probe-root-size', type=int, nargs='+',
+                   help='root cells along each axis of the probes, '
+                   'if different')
+    f.add_argument('--procs', type=int, nargs='+',
+                   default=[1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024])
+    f.add_argument('--min-blocks-per-proc', type=float, default=4,
+                   help='parallel slack for load balance and overlap')
+    f.add_argument('--efficiency', type=float, default=0.7,
+                   help='minimum parallel efficiency of the '
+                   'recommended process count')
+    f.add_argument('--skip', type=int, default=1,
+                   help='initial cycles to exclude')
+    f.add_argument('--model', default='calibration.out',
+                   help='file for the model and recommendation')
+    f.set_defaults(func=fit)
+
+    args = parser.parse_args()
+    args.func(args)
+
+if __name__ == '__main__':
+    main()
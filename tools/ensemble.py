@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+
+# Run a parameter sweep of small Enzo-E simulations inside one batch
+# allocation.
+#
+#    ensemble.py generate <parameter-file> --set PARAM=V[,V ...] [...]
+#                         [--prefix DIR]
+#
+#    ensemble.py run <member-dir> [<member-dir> ...] --enzo PATH
+#                    [--slots S] [--procs P] [--launch CMD]
+#                    [--link PATH [PATH ...]] [--summary FILE]
+#
+# generate writes one member directory per combination of the --set
+# values, holding a parameter file that includes the given parameter
+# file and overrides only the swept parameters, e.g.
+#
+#    --set Method:ppm:courant=0.3,0.5 --set Stopping:cycle=10
+#
+# run keeps S members running at once, each launched as
+#
+#    <launch> <enzo> -parameter-cache member.in
+#
+# in its own directory with P processes, and starts the next member as
+# soon as any finishes, so members of different cost balance over the
+# slots of the allocation.  Each member keeps its own parameters.out,
+# output and log (member.out); PATHs given to --link (default "input")
+# are symlinked into each member directory so that relative includes
+# and data files resolve.  Each member's status and wall time are
+# written to the summary file.
+
+import argparse
+import itertools
+import os
+import shlex
+import subprocess
+import sys
+import time
+
+#----------------------------------------------------------------------
+
+def overlay(parameter, value):
+    """Return the parameter file text setting Group:...:name to value"""
+    names = parameter.split(':')
+    text = ' '.join('{} {{'.format(name) for name in names[:-1])
+    text += ' {} = {}; '.format(names[-1], value)
+    text += ' '.join('}' for name in names[:-1])
+    return text
+
+def member_name(index):
+    return 'member-{:04d}'.format(index)
+
+def generate(args):
+    sweep = []
+    for option in args.set:
+        parameter, _, values = option.partition('=')
+        if not values:
+            sys.exit('--set {}: expected PARAM=V[,V ...]'.format(option))
+        sweep.append([(parameter, v) for v in values.split(',')])
+
+    base = os.path.abspath(args.parameter_file)
+    for index, combination in enumerate(itertools.product(*sweep)):
+        path = os.path.join(args.prefix, member_name(index))
+        os.makedirs(path, exist_ok=True)
+        with open(os.path.join(path, 'member.in'), 'w') as fp:
+            fp.write('# Problem: ensemble member {} of {}\n'
+                     .format(index, args.parameter_file))
+            fp.write('#          (generated by tools/ensemble.py)\n\n')
+            fp.write('include "{}"\n\n'.format(base))
+            for parameter, value in combination:
+                fp.write(overlay(parameter, value) + '\n')
+        print('{}: {}'.format(path, ' '.join(
+            '{}={}'.format(p, v) for p, v in combination)))
+
+#----------------------------------------------------------------------
+
+def start(member, args):
+    for target in args.link:
+        source = os.path.abspath(target)
+        link = os.path.join(member, os.path.basename(target.rstrip('/')))
+        if os.path.exists(source) and not os.path.lexists(link):
+            os.symlink(source, link)
+    command = (shlex.split(args.launch.format(procs=args.procs)) +
+               [os.path.abspath(args.enzo), '-parameter-cache', 'member.in'])
+    log = open(os.path.join(member, 'member.out'), 'w')
+    process = subprocess.Popen(command, cwd=member, stdout=log,
+                               stderr=subprocess.STDOUT)
+    log.close()
+    return process
+
+def run(args):
+    pending = list(args.members)
+    running = {}
+    results = []
+    while pending or running:
+        while pending and len(running) < args.slots:
+            member = pending.pop(0)
+            running[member] = (start(member, args), time.time())
+        time.sleep(0.2)
+        for member, (process, time_start) in list(running.items()):
+            if process.poll() is not None:
+                walltime = time.time() - time_start
+                del running[member]
+                results.append((member, process.returncode, walltime))
+                print('{}: exit {} after {:.1f} s ({} pending)'.format(
+                    member, process.returncode, walltime, len(pending)))
+
+    with open(args.summary, 'w') as fp:
+        for member, status, walltime in sorted(results):
+            fp.write('{} {} {:.3f}\n'.format(member, status, walltime))
+    failed = sum(1 for result in results if result[1] != 0)
+    print('{} members, {} failed; summary in {}'.format(
+        len(results), failed, args.summary))
+    return 1 if failed else 0
+
+#----------------------------------------------------------------------
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Run a parameter sweep of Enzo-E simulations '
+        'within one allocation')
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    g = sub.add_parser('generate', help='write member parameter files')
+    g.add_argument('parameter_file', help='problem parameter file to include')
+    g.add_argument('--set', action='append', required=True,
+                   metavar='PARAM=V[,V ...]',
+                   help='parameter and its values to sweep; may be repeated')
+    g.add_argument('--prefix', default='.',
+                   help='directory for the member directories')
+    g.set_defaults(func=generate)
+
+    r = sub.add_parser('run', help='run the members')
+    r.add_argument('members', nargs='+', help='member directories')
+    r.add_argument('--enzo', required=True, help='path to enzo-e')
+    r.add_argument('--slots', type=int, default=1,
+                   help='members running at once')
+    r.add_argument('--procs', type=int, default=1,
+                   help='processes per member')
+    r.add_argument('--launch', default='charmrun +p{procs}',
+                   help='launcher command; {procs} is replaced by --procs')
+    r.add_argument('--link', nargs='*', default=['input'],
+                   help='paths to symlink into each member directory')
+    r.add_argument('--summary', default='ensemble.out',
+                   help='file for the status and wall time of each member')
+    r.set_defaults(func=run)
+
+    args = parser.parse_args()
+    sys.exit(args.func(args))
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+
+# Generate parameter files for the canonical scaling problems in
+# input/Scaling, and summarize the Performance output of their runs.
+#
+#    scaling.py generate <problem> <weak|strong> --procs P [P ...]
+#                        [--block-size N] [--blocks-per-proc B]
+#                        [--cycles C] [--prefix DIR]
+#
+#    scaling.py report <weak|strong> <output> [<output> ...]
+#                      [--skip S] [--regions R [R ...]]
+#
+# Weak scaling keeps the Blocks per process fixed; strong scaling keeps
+# the total Blocks of the smallest run.  The report gives, for each run
+# ordered by process count, the wall time per cycle, the parallel
+# efficiency relative to the smallest run, the time per cycle of each
+# Performance region averaged over processes, and the messages and
+# bytes sent between processes per cycle by message class.
+
+import argparse
+import os
+import re
+import sys
+
+problems = ['vlct', 'sedov', 'cosmology', 'poisson']
+
+default_regions = ['cycle', 'adapt_apply', 'adapt_notify', 'adapt_update',
+                   'adapt_end', 'refresh_store', 'refresh_child',
+                   'refresh_exit', 'compute', 'control', 'output',
+                   'stopping', 'grackle']
+
+#----------------------------------------------------------------------
+
+def factor3(n):
+    """Return the three factors of n closest to a cube, largest first"""
+    best = None
+    for a in range(1, n+1):
+        if n % a: continue
+        for b in range(a, n//a + 1):
+            if (n//a) % b: continue
+            c = n // (a*b)
+            if c < b: continue
+            if best is None or c - a < best[0] - best[2]:
+                best = (c, b, a)
+    return list(best)
+
+def block_layout(problem, mode, procs, min_procs, blocks_per_proc):
+    """Return the root Block array for a run on procs processes"""
+    if mode == 'weak':
+        return factor3(procs * blocks_per_proc)
+    else:
+        return factor3(min_procs * blocks_per_proc)
+
+def generate(args):
+    min_procs = min(args.procs)
+    for procs in sorted(args.procs):
+        blocks = block_layout(args.problem, args.mode, procs,
+                              min_procs, args.blocks_per_proc)
+        size = [args.block_size * b for b in blocks]
+        name = 'scaling-{}-{}-p{}'.format(args.problem, args.mode, procs)
+        path = os.path.join(args.prefix, name + '.in')
+        with open(path, 'w') as fp:
+            fp.write('# Problem: {} scaling of scaling-{}.incl on {} '
+                     'processes\n'.format(args.mode, args.problem, procs))
+            fp.write('#          (generated by tools/scaling.py)\n\n')
+            fp.write('include "input/Scaling/scaling-{}.incl"\n\n'
+                     .format(args.problem))
+            fp.write('Mesh {{\n   root_size   = [{}];\n'
+                     '   root_blocks = [{}];\n}}\n\n'
+                     .format(', '.join(map(str, size)),
+                             ', '.join(map(str, blocks))))
+            if args.problem == 'sedov':
+                fp.write('Initial {{ sedov {{ array = [{}]; }} }}\n\n'
+                         .format(', '.join(map(str, blocks))))
+            fp.write('Stopping {{ cycle = {}; }}\n'.format(args.cycles))
+        print('{}: {} processes root_blocks {} root_size {}'
+              .format(path, procs, blocks, size))
+
+#----------------------------------------------------------------------
+
+re_cycle  = re.compile(r'^\s*0\s+(\S+)\s+Simulation\s+cycle\s+(\d+)')
+re_region = re.compile(r'^\s*0\s+\S+\s+Performance\s+(\S+)\s+time-usec\s+(\d+)')
+re_msg    = re.compile(r'^\s*0\s+\S+\s+Performance\s+counter\s+msg\s+(\S+)'
+                       r'\s+sent\s+(\d+)\s+sent-bytes\s+(\d+)')
+re_procs  = re.compile(r'Define\s+Simulation\s+processors\s+(\d+)')
+re_file   = re.compile(r'-p(\d+)\D*$')
+
+def parse(file_name):
+    """Return processes, cycle wall times, per-cycle region times, and
+    per-cycle messages sent"""
+    procs = None
+    cycles = []
+    regions = []
+    messages = []
+    with open(file_name) as fp:
+        for line in fp:
+            m = re_cycle.match(line)
+            if m:
+                cycles.append((int(m.group(2)), float(m.group(1))))
+                regions.append({})
+                messages.append({})
+                continue
+            m = re_region.match(line)
+            if m and regions:
+                regions[-1][m.group(1)] = int(m.group(2))
+                continue
+            m = re_msg.match(line)
+            if m and messages:
+                messages[-1][m.group(1)] = (int(m.group(2)), int(m.group(3)))
+                continue
+            m = re_procs.search(line)
+            if m and procs is None:
+                procs = int(m.group(1))
+    if procs is None:
+        m = re_file.search(os.path.splitext(file_name)[0])
+        if m: procs = int(m.group(1))
+    if procs is None:
+        sys.exit('{}: cannot determine the number of processes'
+                 .format(file_name))
+    return procs, cycles, regions, messages
+
+def summarize(file_name, skip, region_names):
+    procs, cycles, regions, messages = parse(file_name)
+    if len(cycles) < skip + 2:
+        sys.exit('{}: {} cycles is too few to skip {}'
+                 .format(file_name, len(cycles), skip))
+    c0, t0 = cycles[skip]
+    c1, t1 = cycles[-1]
+    num_cycles = c1 - c0
+    # region counters are summed over processes and accumulate
+    # from the start of the run
+    phase = {}
+    for region in region_names:
+        r0 = regions[skip].get(region)
+        r1 = regions[-1].get(region)
+        if r0 is not None and r1 is not None:
+            phase[region] = 1e-6 * (r1 - r0) / (procs * num_cycles)
+    # message counters are reset each cycle
+    traffic = {}
+    for counts in messages[skip+1:]:
+        for name, (num, size) in counts.items():
+            t = traffic.setdefault(name, [0, 0])
+            t[0] += num / (procs * num_cycles)
+            t[1] += size / (procs * num_cycles)
+    return { 'file' : file_name, 'procs' : procs,
+             'cycles' : num_cycles,
+             'time' : (t1 - t0) / num_cycles, 'phase' : phase,
+             'traffic' : traffic }
+
+def report(args):
+    runs = sorted([summarize(f, args.skip, args.regions) for f in args.files],
+                  key = lambda run : run['procs'])
+    base = runs[0]
+    print('# {} scaling, times in seconds per cycle'.format(args.mode))
+    print('{:>8} {:>8} {:>12} {:>10}'.format
+          ('procs','cycles','time','efficiency'))
+    for run in runs:
+        if args.mode == 'weak':
+            efficiency = base['time'] / run['time']
+        else:
+            efficiency = ((base['time'] * base['procs']) /
+                          (run['time']  * run['procs']))
+        print('{:>8d} {:>8d} {:>12.6f} {:>10.3f}'.format
+              (run['procs'], run['cycles'], run['time'], efficiency))
+    print()
+    print('# time per cycle of each Performance region, averaged over '
+          'processes')
+    regions = [r for r in args.regions
+               if any(r in run['phase'] for run in runs)]
+    print(('{:>8}' + ' {:>12}'*len(regions)).format('procs', *regions))
+    for run in runs:
+        print(('{:>8d}' + ' {:>12}'*len(regions)).format
+              (run['procs'],
+               *['{:.6f}'.format(run['phase'][r]) if r in run['phase']
+                 else '-' for r in regions]))
+    classes = sorted(set(c for run in runs for c in run['traffic']))
+    if classes:
+        print()
+        print('# messages and bytes sent between processes per cycle per '
+              'process')
+        print(('{:>8}' + ' {:>24}'*len(classes)).format('procs', *classes))
+        for run in runs:
+            print(('{:>8d}' + ' {:>24}'*len(classes)).format
+                  (run['procs'],
+                   *['{:.1f}/{:.0f}'.format(*run['traffic'][c])
+                     if c in run['traffic'] else '-' for c in classes]))
+
+#----------------------------------------------------------------------
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Generate and report Enzo-E scaling studies')
+    sub = parser.add_subparsers(dest='command', required=True)
+
+    g = sub.add_parser('generate', help='write parameter files')
+    g.add_argument('problem', choices=problems)
+    g.add_argument('mode', choices=['weak', 'strong'])
+    g.add_argument('--procs', type=int, nargs='+', required=True,
+                   help='process counts')
+    g.add_argument('--block-size', type=int, default=32,
+                   help='cells along each axis of a Block')
+    g.add_argument('--blocks-per-proc', type=int, default=8,
+                   help='Blocks per process (of the smallest run if strong)')
+    g.add_argument('--cycles', type=int, default=20)
+    g.add_argument('--prefix', default='.',
+                   help='directory for the parameter files')
+    g.set_defaults(func=generate)
+
+    r = sub.add_parser('report', help='summarize enzo-e output')
+    r.add_argument('mode', choices=['weak', 'strong'])
+    r.add_argument('files', nargs='+', help='enzo-e output files')
+    r.add_argument('--skip', type=int, default=1,
+                   help='initial cycles to exclude')
+    r.add_argument('--regions', nargs='+', default=default_regions,
+                   help='Performance regions to report')
+    r.set_defaults(func=report)
+
+    args = parser.parse_args()
+    args.func(args)
+
+if __name__ == '__main__':
+    main()